@@ -97,6 +97,7 @@ clang++ \
   -I "${FBW_COMMON_DIR}/src" \
   -I "${FBW_COMMON_DIR}/src/inih" \
   -I "${DIR}/src/interface" \
+  "${DIR}/src/interface/LocalVariableTable.cpp" \
   "${DIR}/src/interface/SimConnectInterface.cpp" \
   -I "${DIR}/src/busStructures" \
   -I "${DIR}/src/elac" \
@@ -118,6 +119,10 @@ clang++ \
   "${DIR}/src/utils/SRFlipFLop.cpp" \
   "${DIR}/src/utils/PulseNode.cpp" \
   "${DIR}/src/utils/HysteresisNode.cpp" \
+  "${DIR}/src/utils/FileWatcher.cpp" \
+  "${DIR}/src/utils/FixedStep.cpp" \
+  "${DIR}/src/utils/StageScheduler.cpp" \
+  "${DIR}/src/utils/StageTimings.cpp" \
   -I "${DIR}/src/model" \
   "${DIR}/src/model/ElacComputer_data.cpp" \
   "${DIR}/src/model/ElacComputer.cpp" \
@@ -139,20 +144,31 @@ clang++ \
   "${DIR}/src/model/FadecComputer.cpp" \
   "${DIR}/src/model/look1_iflf_binlxpw.cpp" \
   "${DIR}/src/model/look1_binlxpw.cpp" \
+  "${DIR}/src/model/look1_evenlxpw.cpp" \
+  "${DIR}/src/model/look1_pbinlxpw.cpp" \
   "${DIR}/src/model/look2_binlxpw.cpp" \
   "${DIR}/src/model/look2_pbinlxpw.cpp" \
   "${DIR}/src/model/rt_modd.cpp" \
   "${DIR}/src/model/binsearch_u32d.cpp" \
+  "${DIR}/src/model/binsearch_u32d_prevIdx.cpp" \
+  "${DIR}/src/model/intrp1d_l_pw.cpp" \
+  "${DIR}/src/model/intrp2d_l_pw.cpp" \
   "${DIR}/src/model/intrp3d_l_pw.cpp" \
   "${DIR}/src/model/plook_binx.cpp" \
+  "${DIR}/src/model/plook_binxp.cpp" \
+  "${DIR}/src/model/plook_evenx.cpp" \
   -I "${FBW_COMMON_DIR}/src/zlib" \
   "${FBW_COMMON_DIR}/src/zlib/zfstream.cc" \
   "${DIR}/src/FlyByWireInterface.cpp" \
   "${DIR}/src/recording/FlightDataRecorder.cpp" \
+  "${DIR}/src/recording/RecordingFileWriter.cpp" \
+  "${DIR}/src/recording/RecordingProfile.cpp" \
+  "${DIR}/src/recording/RecordingSchema.cpp" \
   "${DIR}/src/Arinc429.cpp" \
   "${DIR}/src/Arinc429Utils.cpp" \
   "${FBW_COMMON_DIR}/src/LocalVariable.cpp" \
   "${FBW_COMMON_DIR}/src/InterpolatingLookupTable.cpp" \
+  "${DIR}/src/SimulationRateGovernor.cpp" \
   "${DIR}/src/SpoilersHandler.cpp" \
   "${FBW_COMMON_DIR}/src/ThrottleAxisMapping.cpp" \
   "${DIR}/src/CalculatedRadioReceiver.cpp" \
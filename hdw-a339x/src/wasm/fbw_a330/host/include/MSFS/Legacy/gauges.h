@@ -0,0 +1,79 @@
+#pragma once
+
+// Host replacement for <MSFS/Legacy/gauges.h>. Only the parts of the gauge API used by the fbw module and the common
+// framework are declared, the implementation lives in host/src/HostGauge.cpp.
+
+#include "../MSFS_WindowsTypes.h"
+
+typedef int ID;
+typedef unsigned int ID32;
+typedef int SINT32;
+typedef unsigned int UINT32;
+typedef int ENUM;
+typedef double FLOAT64;
+typedef const char* PCSTRINGZ;
+typedef unsigned long long FsContext;
+
+#define PANEL_SERVICE_PRE_QUERY 0
+#define PANEL_SERVICE_POST_QUERY 1
+#define PANEL_SERVICE_PRE_INSTALL 2
+#define PANEL_SERVICE_POST_INSTALL 3
+#define PANEL_SERVICE_PRE_INITIALIZE 4
+#define PANEL_SERVICE_POST_INITIALIZE 5
+#define PANEL_SERVICE_PRE_UPDATE 6
+#define PANEL_SERVICE_POST_UPDATE 7
+#define PANEL_SERVICE_PRE_GENERATE 8
+#define PANEL_SERVICE_POST_GENERATE 9
+#define PANEL_SERVICE_PRE_DRAW 10
+#define PANEL_SERVICE_POST_DRAW 11
+#define PANEL_SERVICE_PRE_KILL 12
+#define PANEL_SERVICE_POST_KILL 13
+
+struct sGaugeDrawData {
+  double mx;
+  double my;
+  double t;
+  double dt;
+  int winWidth;
+  int winHeight;
+  int fbWidth;
+  int fbHeight;
+};
+
+// key event ids, only the ones handled by the module
+#define KEY_ID_MIN 0x00010000
+#define KEY_AILERON_LEFT (KEY_ID_MIN + 0x0017)
+#define KEY_AILERON_RIGHT (KEY_ID_MIN + 0x0018)
+
+typedef void (*GAUGE_KEY_EVENT_HANDLER)(ID32 event, UINT32 evdata, PVOID userdata);
+typedef void (*GAUGE_KEY_EVENT_HANDLER_EX1)(ID32 event,
+                                            UINT32 evdata0,
+                                            UINT32 evdata1,
+                                            UINT32 evdata2,
+                                            UINT32 evdata3,
+                                            UINT32 evdata4,
+                                            PVOID userdata);
+
+// named variables
+ID register_named_variable(PCSTRINGZ name);
+ID check_named_variable(PCSTRINGZ name);
+PCSTRINGZ get_name_of_named_variable(ID id);
+FLOAT64 get_named_variable_value(ID id);
+FLOAT64 get_named_variable_typed_value(ID id, ENUM units);
+void set_named_variable_value(ID id, FLOAT64 value);
+void set_named_variable_typed_value(ID id, FLOAT64 value, ENUM units);
+void unregister_all_named_vars();
+
+// simulation variables and units
+ENUM get_units_enum(PCSTRINGZ unitname);
+ENUM get_aircraft_var_enum(PCSTRINGZ simvar);
+FLOAT64 aircraft_varget(ENUM simvar, ENUM units, SINT32 index);
+
+// calculator code
+BOOL execute_calculator_code(PCSTRINGZ code, FLOAT64* fvalue, SINT32* ivalue, PCSTRINGZ* svalue);
+
+// key events
+void register_key_event_handler(GAUGE_KEY_EVENT_HANDLER handler, PVOID userdata);
+void unregister_key_event_handler(GAUGE_KEY_EVENT_HANDLER handler, PVOID userdata);
+void register_key_event_handler_EX1(GAUGE_KEY_EVENT_HANDLER_EX1 handler, PVOID userdata);
+void unregister_key_event_handler_EX1(GAUGE_KEY_EVENT_HANDLER_EX1 handler, PVOID userdata);
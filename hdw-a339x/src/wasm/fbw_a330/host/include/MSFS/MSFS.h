@@ -0,0 +1,5 @@
+#pragma once
+
+// Host replacement for <MSFS/MSFS.h>. The module only needs the gauge types, which live in the legacy header.
+
+#include "Legacy/gauges.h"
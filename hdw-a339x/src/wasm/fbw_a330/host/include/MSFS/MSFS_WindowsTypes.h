@@ -0,0 +1,30 @@
+#pragma once
+
+// Host replacement for the Windows style types the MSFS SDK headers provide.
+//
+// DWORD is kept at the native 'unsigned long' width so that the sign extension done by the stand-in for negative
+// event data survives the 'static_cast<long>(data)' casts used in SimConnectInterface. HRESULT has to stay 32 bit,
+// otherwise E_FAIL would not be negative and SUCCEEDED() would never terminate the dispatch loop.
+
+#include <cstdint>
+
+typedef int BOOL;
+typedef unsigned long DWORD;
+typedef std::int32_t HRESULT;
+typedef void* HANDLE;
+typedef void* HWND;
+typedef void* PVOID;
+typedef const char* LPCSTR;
+
+#ifndef TRUE
+#define TRUE 1
+#endif
+
+#ifndef FALSE
+#define FALSE 0
+#endif
+
+#define S_OK ((HRESULT)0L)
+#define E_FAIL ((HRESULT)0x80004005L)
+#define SUCCEEDED(hr) (((HRESULT)(hr)) >= 0)
+#define FAILED(hr) (((HRESULT)(hr)) < 0)
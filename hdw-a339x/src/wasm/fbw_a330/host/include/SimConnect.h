@@ -0,0 +1,277 @@
+#pragma once
+
+// Host replacement for <SimConnect.h>. Declares the subset of the SimConnect API used by the fbw module, backed by the
+// in-process stand-in in host/src/HostSimConnect.cpp. Values follow the SDK where the module depends on them.
+
+#include "MSFS/MSFS_WindowsTypes.h"
+
+typedef DWORD SIMCONNECT_OBJECT_ID;
+typedef DWORD SIMCONNECT_CLIENT_EVENT_ID;
+typedef DWORD SIMCONNECT_NOTIFICATION_GROUP_ID;
+typedef DWORD SIMCONNECT_DATA_DEFINITION_ID;
+typedef DWORD SIMCONNECT_DATA_REQUEST_ID;
+typedef DWORD SIMCONNECT_CLIENT_DATA_ID;
+typedef DWORD SIMCONNECT_CLIENT_DATA_DEFINITION_ID;
+typedef DWORD SIMCONNECT_DATA_REQUEST_FLAG;
+typedef DWORD SIMCONNECT_DATA_SET_FLAG;
+typedef DWORD SIMCONNECT_EVENT_FLAG;
+typedef DWORD SIMCONNECT_CREATE_CLIENT_DATA_FLAG;
+typedef DWORD SIMCONNECT_CLIENT_DATA_REQUEST_FLAG;
+typedef DWORD SIMCONNECT_CLIENT_DATA_SET_FLAG;
+
+static const DWORD SIMCONNECT_UNUSED = (DWORD)-1;
+static const DWORD SIMCONNECT_OBJECT_ID_USER = 0;
+
+static const DWORD SIMCONNECT_CLIENTDATAOFFSET_AUTO = (DWORD)-1;
+static const DWORD SIMCONNECT_CLIENTDATATYPE_INT8 = (DWORD)-1;
+static const DWORD SIMCONNECT_CLIENTDATATYPE_INT16 = (DWORD)-2;
+static const DWORD SIMCONNECT_CLIENTDATATYPE_INT32 = (DWORD)-3;
+static const DWORD SIMCONNECT_CLIENTDATATYPE_INT64 = (DWORD)-4;
+static const DWORD SIMCONNECT_CLIENTDATATYPE_FLOAT32 = (DWORD)-5;
+static const DWORD SIMCONNECT_CLIENTDATATYPE_FLOAT64 = (DWORD)-6;
+
+static const DWORD SIMCONNECT_GROUP_PRIORITY_HIGHEST = 1;
+static const DWORD SIMCONNECT_GROUP_PRIORITY_HIGHEST_MASKABLE = 10000000;
+static const DWORD SIMCONNECT_GROUP_PRIORITY_STANDARD = 1900000000;
+static const DWORD SIMCONNECT_GROUP_PRIORITY_DEFAULT = 2000000000;
+static const DWORD SIMCONNECT_GROUP_PRIORITY_LOWEST = 4000000000;
+
+static const DWORD SIMCONNECT_EVENT_FLAG_DEFAULT = 0x00000000;
+static const DWORD SIMCONNECT_EVENT_FLAG_GROUPID_IS_PRIORITY = 0x00000010;
+
+static const DWORD SIMCONNECT_CREATE_CLIENT_DATA_FLAG_DEFAULT = 0x00000000;
+static const DWORD SIMCONNECT_CLIENT_DATA_SET_FLAG_DEFAULT = 0x00000000;
+static const DWORD SIMCONNECT_CLIENT_DATA_REQUEST_FLAG_DEFAULT = 0x00000000;
+
+enum SIMCONNECT_RECV_ID {
+  SIMCONNECT_RECV_ID_NULL,
+  SIMCONNECT_RECV_ID_EXCEPTION,
+  SIMCONNECT_RECV_ID_OPEN,
+  SIMCONNECT_RECV_ID_QUIT,
+  SIMCONNECT_RECV_ID_EVENT,
+  SIMCONNECT_RECV_ID_EVENT_OBJECT_ADDREMOVE,
+  SIMCONNECT_RECV_ID_EVENT_FILENAME,
+  SIMCONNECT_RECV_ID_EVENT_FRAME,
+  SIMCONNECT_RECV_ID_SIMOBJECT_DATA,
+  SIMCONNECT_RECV_ID_SIMOBJECT_DATA_BYTYPE,
+  SIMCONNECT_RECV_ID_WEATHER_OBSERVATION,
+  SIMCONNECT_RECV_ID_CLOUD_STATE,
+  SIMCONNECT_RECV_ID_ASSIGNED_OBJECT_ID,
+  SIMCONNECT_RECV_ID_RESERVED_KEY,
+  SIMCONNECT_RECV_ID_CUSTOM_ACTION,
+  SIMCONNECT_RECV_ID_SYSTEM_STATE,
+  SIMCONNECT_RECV_ID_CLIENT_DATA,
+  SIMCONNECT_RECV_ID_EVENT_EX1 = 0x40,
+};
+
+enum SIMCONNECT_DATATYPE {
+  SIMCONNECT_DATATYPE_INVALID,
+  SIMCONNECT_DATATYPE_INT32,
+  SIMCONNECT_DATATYPE_INT64,
+  SIMCONNECT_DATATYPE_FLOAT32,
+  SIMCONNECT_DATATYPE_FLOAT64,
+  SIMCONNECT_DATATYPE_STRING8,
+  SIMCONNECT_DATATYPE_STRING32,
+  SIMCONNECT_DATATYPE_STRING64,
+  SIMCONNECT_DATATYPE_STRING128,
+  SIMCONNECT_DATATYPE_STRING256,
+  SIMCONNECT_DATATYPE_STRING260,
+  SIMCONNECT_DATATYPE_STRINGV,
+  SIMCONNECT_DATATYPE_INITPOSITION,
+  SIMCONNECT_DATATYPE_MARKERSTATE,
+  SIMCONNECT_DATATYPE_WAYPOINT,
+  SIMCONNECT_DATATYPE_LATLONALT,
+  SIMCONNECT_DATATYPE_XYZ,
+  SIMCONNECT_DATATYPE_MAX
+};
+
+enum SIMCONNECT_EXCEPTION {
+  SIMCONNECT_EXCEPTION_NONE,
+  SIMCONNECT_EXCEPTION_ERROR,
+  SIMCONNECT_EXCEPTION_SIZE_MISMATCH,
+  SIMCONNECT_EXCEPTION_UNRECOGNIZED_ID,
+  SIMCONNECT_EXCEPTION_UNOPENED,
+  SIMCONNECT_EXCEPTION_VERSION_MISMATCH,
+  SIMCONNECT_EXCEPTION_TOO_MANY_GROUPS,
+  SIMCONNECT_EXCEPTION_NAME_UNRECOGNIZED,
+  SIMCONNECT_EXCEPTION_TOO_MANY_EVENT_NAMES,
+  SIMCONNECT_EXCEPTION_EVENT_ID_DUPLICATE,
+  SIMCONNECT_EXCEPTION_TOO_MANY_MAPS,
+  SIMCONNECT_EXCEPTION_TOO_MANY_OBJECTS,
+  SIMCONNECT_EXCEPTION_TOO_MANY_REQUESTS,
+  SIMCONNECT_EXCEPTION_WEATHER_INVALID_PORT,
+  SIMCONNECT_EXCEPTION_WEATHER_INVALID_METAR,
+  SIMCONNECT_EXCEPTION_WEATHER_UNABLE_TO_GET_OBSERVATION,
+  SIMCONNECT_EXCEPTION_WEATHER_UNABLE_TO_CREATE_STATION,
+  SIMCONNECT_EXCEPTION_WEATHER_UNABLE_TO_REMOVE_STATION,
+  SIMCONNECT_EXCEPTION_INVALID_DATA_TYPE,
+  SIMCONNECT_EXCEPTION_INVALID_DATA_SIZE,
+  SIMCONNECT_EXCEPTION_DATA_ERROR,
+  SIMCONNECT_EXCEPTION_INVALID_ARRAY,
+  SIMCONNECT_EXCEPTION_CREATE_OBJECT_FAILED,
+  SIMCONNECT_EXCEPTION_LOAD_FLIGHTPLAN_FAILED,
+  SIMCONNECT_EXCEPTION_OPERATION_INVALID_FOR_OBJECT_TYPE,
+  SIMCONNECT_EXCEPTION_ILLEGAL_OPERATION,
+  SIMCONNECT_EXCEPTION_ALREADY_SUBSCRIBED,
+  SIMCONNECT_EXCEPTION_INVALID_ENUM,
+  SIMCONNECT_EXCEPTION_DEFINITION_ERROR,
+  SIMCONNECT_EXCEPTION_DUPLICATE_ID,
+  SIMCONNECT_EXCEPTION_DATUM_ID,
+  SIMCONNECT_EXCEPTION_OUT_OF_BOUNDS,
+  SIMCONNECT_EXCEPTION_ALREADY_CREATED,
+  SIMCONNECT_EXCEPTION_OBJECT_OUTSIDE_REALITY_BUBBLE,
+  SIMCONNECT_EXCEPTION_OBJECT_CONTAINER,
+  SIMCONNECT_EXCEPTION_OBJECT_AI,
+  SIMCONNECT_EXCEPTION_OBJECT_ATC,
+  SIMCONNECT_EXCEPTION_OBJECT_SCHEDULE,
+};
+
+enum SIMCONNECT_PERIOD {
+  SIMCONNECT_PERIOD_NEVER,
+  SIMCONNECT_PERIOD_ONCE,
+  SIMCONNECT_PERIOD_VISUAL_FRAME,
+  SIMCONNECT_PERIOD_SIM_FRAME,
+  SIMCONNECT_PERIOD_SECOND,
+};
+
+enum SIMCONNECT_CLIENT_DATA_PERIOD {
+  SIMCONNECT_CLIENT_DATA_PERIOD_NEVER,
+  SIMCONNECT_CLIENT_DATA_PERIOD_ONCE,
+  SIMCONNECT_CLIENT_DATA_PERIOD_VISUAL_FRAME,
+  SIMCONNECT_CLIENT_DATA_PERIOD_ON_SET,
+  SIMCONNECT_CLIENT_DATA_PERIOD_SECOND,
+};
+
+struct SIMCONNECT_DATA_XYZ {
+  double x;
+  double y;
+  double z;
+};
+
+struct SIMCONNECT_DATA_LATLONALT {
+  double Latitude;
+  double Longitude;
+  double Altitude;
+};
+
+struct SIMCONNECT_RECV {
+  DWORD dwSize;
+  DWORD dwVersion;
+  DWORD dwID;
+};
+
+struct SIMCONNECT_RECV_EXCEPTION : public SIMCONNECT_RECV {
+  DWORD dwException;
+  DWORD dwSendID;
+  DWORD dwIndex;
+};
+
+struct SIMCONNECT_RECV_EVENT : public SIMCONNECT_RECV {
+  DWORD uGroupID;
+  DWORD uEventID;
+  DWORD dwData;
+};
+
+struct SIMCONNECT_RECV_EVENT_EX1 : public SIMCONNECT_RECV {
+  DWORD uGroupID;
+  DWORD uEventID;
+  DWORD dwData0;
+  DWORD dwData1;
+  DWORD dwData2;
+  DWORD dwData3;
+  DWORD dwData4;
+};
+
+struct SIMCONNECT_RECV_SIMOBJECT_DATA : public SIMCONNECT_RECV {
+  DWORD dwRequestID;
+  DWORD dwObjectID;
+  DWORD dwDefineID;
+  DWORD dwFlags;
+  DWORD dwentrynumber;
+  DWORD dwoutof;
+  DWORD dwDefineCount;
+  DWORD dwData;
+};
+
+struct SIMCONNECT_RECV_CLIENT_DATA : public SIMCONNECT_RECV_SIMOBJECT_DATA {};
+
+HRESULT SimConnect_Open(HANDLE* phSimConnect, LPCSTR szName, HWND hWnd, DWORD UserEventWin32, HANDLE hEventHandle, DWORD ConfigIndex);
+HRESULT SimConnect_Close(HANDLE hSimConnect);
+HRESULT SimConnect_GetNextDispatch(HANDLE hSimConnect, SIMCONNECT_RECV** ppData, DWORD* pcbData);
+
+HRESULT SimConnect_MapClientEventToSimEvent(HANDLE hSimConnect, SIMCONNECT_CLIENT_EVENT_ID EventID, const char* EventName = "");
+HRESULT SimConnect_AddClientEventToNotificationGroup(HANDLE hSimConnect,
+                                                     SIMCONNECT_NOTIFICATION_GROUP_ID GroupID,
+                                                     SIMCONNECT_CLIENT_EVENT_ID EventID,
+                                                     BOOL bMaskable = FALSE);
+HRESULT SimConnect_SetNotificationGroupPriority(HANDLE hSimConnect, SIMCONNECT_NOTIFICATION_GROUP_ID GroupID, DWORD uPriority);
+HRESULT SimConnect_SubscribeToSystemEvent(HANDLE hSimConnect, SIMCONNECT_CLIENT_EVENT_ID EventID, const char* SystemEventName);
+HRESULT SimConnect_UnsubscribeFromSystemEvent(HANDLE hSimConnect, SIMCONNECT_CLIENT_EVENT_ID EventID);
+HRESULT SimConnect_TransmitClientEvent(HANDLE hSimConnect,
+                                       SIMCONNECT_OBJECT_ID ObjectID,
+                                       SIMCONNECT_CLIENT_EVENT_ID EventID,
+                                       DWORD dwData,
+                                       SIMCONNECT_NOTIFICATION_GROUP_ID GroupID,
+                                       SIMCONNECT_EVENT_FLAG Flags);
+HRESULT SimConnect_TransmitClientEvent_EX1(HANDLE hSimConnect,
+                                           SIMCONNECT_OBJECT_ID ObjectID,
+                                           SIMCONNECT_CLIENT_EVENT_ID EventID,
+                                           SIMCONNECT_NOTIFICATION_GROUP_ID GroupID,
+                                           SIMCONNECT_EVENT_FLAG Flags,
+                                           DWORD dwData0,
+                                           DWORD dwData1,
+                                           DWORD dwData2,
+                                           DWORD dwData3,
+                                           DWORD dwData4);
+
+HRESULT SimConnect_AddToDataDefinition(HANDLE hSimConnect,
+                                       SIMCONNECT_DATA_DEFINITION_ID DefineID,
+                                       const char* DatumName,
+                                       const char* UnitsName,
+                                       SIMCONNECT_DATATYPE DatumType = SIMCONNECT_DATATYPE_FLOAT64,
+                                       float fEpsilon = 0,
+                                       DWORD DatumID = SIMCONNECT_UNUSED);
+HRESULT SimConnect_RequestDataOnSimObject(HANDLE hSimConnect,
+                                          SIMCONNECT_DATA_REQUEST_ID RequestID,
+                                          SIMCONNECT_DATA_DEFINITION_ID DefineID,
+                                          SIMCONNECT_OBJECT_ID ObjectID,
+                                          SIMCONNECT_PERIOD Period,
+                                          SIMCONNECT_DATA_REQUEST_FLAG Flags = 0,
+                                          DWORD origin = 0,
+                                          DWORD interval = 0,
+                                          DWORD limit = 0);
+HRESULT SimConnect_SetDataOnSimObject(HANDLE hSimConnect,
+                                      SIMCONNECT_DATA_DEFINITION_ID DefineID,
+                                      SIMCONNECT_OBJECT_ID ObjectID,
+                                      SIMCONNECT_DATA_SET_FLAG Flags,
+                                      DWORD ArrayCount,
+                                      DWORD cbUnitSize,
+                                      void* pDataSet);
+
+HRESULT SimConnect_MapClientDataNameToID(HANDLE hSimConnect, const char* szClientDataName, SIMCONNECT_CLIENT_DATA_ID ClientDataID);
+HRESULT SimConnect_CreateClientData(HANDLE hSimConnect,
+                                    SIMCONNECT_CLIENT_DATA_ID ClientDataID,
+                                    DWORD dwSize,
+                                    SIMCONNECT_CREATE_CLIENT_DATA_FLAG Flags);
+HRESULT SimConnect_AddToClientDataDefinition(HANDLE hSimConnect,
+                                             SIMCONNECT_CLIENT_DATA_DEFINITION_ID DefineID,
+                                             DWORD dwOffset,
+                                             DWORD dwSizeOrType,
+                                             float fEpsilon = 0,
+                                             DWORD DatumID = SIMCONNECT_UNUSED);
+HRESULT SimConnect_RequestClientData(HANDLE hSimConnect,
+                                     SIMCONNECT_CLIENT_DATA_ID ClientDataID,
+                                     SIMCONNECT_DATA_REQUEST_ID RequestID,
+                                     SIMCONNECT_CLIENT_DATA_DEFINITION_ID DefineID,
+                                     SIMCONNECT_CLIENT_DATA_PERIOD Period = SIMCONNECT_CLIENT_DATA_PERIOD_ONCE,
+                                     SIMCONNECT_CLIENT_DATA_REQUEST_FLAG Flags = 0,
+                                     DWORD origin = 0,
+                                     DWORD interval = 0,
+                                     DWORD limit = 0);
+HRESULT SimConnect_SetClientData(HANDLE hSimConnect,
+                                 SIMCONNECT_CLIENT_DATA_ID ClientDataID,
+                                 SIMCONNECT_CLIENT_DATA_DEFINITION_ID DefineID,
+                                 SIMCONNECT_CLIENT_DATA_SET_FLAG Flags,
+                                 DWORD dwReserved,
+                                 DWORD cbUnitSize,
+                                 void* pDataSet);
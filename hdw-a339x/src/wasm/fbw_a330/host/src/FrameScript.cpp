@@ -0,0 +1,149 @@
+#include "FrameScript.h"
+
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+#include "HostGauge.h"
+#include "HostSimConnect.h"
+
+bool FrameScript::load(const std::string& path) {
+  std::ifstream file(path);
+  if (!file.is_open()) {
+    std::cout << "HOST: Failed to open frame script '" << path << "'" << std::endl;
+    return false;
+  }
+  std::stringstream text;
+  text << file.rdbuf();
+  return parse(text.str(), path);
+}
+
+bool FrameScript::parse(const std::string& text, const std::string& source) {
+  commands.clear();
+  restart();
+
+  std::istringstream lines(text);
+  std::string line;
+  std::size_t lineNumber = 0;
+  while (std::getline(lines, line)) {
+    lineNumber++;
+    line = line.substr(0, line.find('#'));
+
+    std::istringstream tokens(line);
+    std::string keyword;
+    if (!(tokens >> keyword)) {
+      continue;
+    }
+
+    Command command = {};
+    bool valid = false;
+    if (keyword == "set" || keyword == "ramp") {
+      command.type = keyword == "set" ? CommandType::Set : CommandType::Ramp;
+      valid = static_cast<bool>(tokens >> command.name >> command.value);
+      command.field = findSimDataField(command.name);
+      if (valid && command.field == nullptr) {
+        std::cout << "HOST: " << source << ":" << lineNumber << ": unknown SimData field '" << command.name << "'" << std::endl;
+        return false;
+      }
+    } else if (keyword == "lvar") {
+      command.type = CommandType::LocalVariable;
+      valid = static_cast<bool>(tokens >> command.name >> command.value);
+    } else if (keyword == "event") {
+      command.type = CommandType::Event;
+      valid = static_cast<bool>(tokens >> command.name >> command.value);
+    } else if (keyword == "pause") {
+      command.type = CommandType::Pause;
+      valid = static_cast<bool>(tokens >> command.value);
+    } else if (keyword == "run") {
+      command.type = CommandType::Run;
+      command.value = DEFAULT_SAMPLE_TIME;
+      valid = static_cast<bool>(tokens >> command.frames);
+      if (valid && !(tokens >> command.value)) {
+        command.value = DEFAULT_SAMPLE_TIME;
+      }
+      valid &= command.value > 0.0;
+    }
+
+    if (!valid) {
+      std::cout << "HOST: " << source << ":" << lineNumber << ": invalid command '" << line << "'" << std::endl;
+      return false;
+    }
+    commands.push_back(command);
+  }
+
+  return true;
+}
+
+bool FrameScript::nextFrame(SimData& simData, double& dt) {
+  // execute commands until we are inside a run
+  while (runFrame >= runFrames) {
+    if (commandIndex >= commands.size()) {
+      return false;
+    }
+    execute(commands[commandIndex++], simData);
+  }
+
+  // advance ramps, the target is reached on the last frame of the run
+  runFrame++;
+  double fraction = static_cast<double>(runFrame) / static_cast<double>(runFrames);
+  for (const auto& ramp : activeRamps) {
+    setSimDataField(simData, *ramp.field, ramp.start + (ramp.target - ramp.start) * fraction);
+  }
+
+  simData.simulationTime += runSampleTime;
+  dt = runSampleTime;
+  return true;
+}
+
+void FrameScript::restart() {
+  commandIndex = 0;
+  runFrames = 0;
+  runFrame = 0;
+  runSampleTime = DEFAULT_SAMPLE_TIME;
+  pendingRamps.clear();
+  activeRamps.clear();
+}
+
+std::size_t FrameScript::getFrameCount() const {
+  std::size_t frames = 0;
+  for (const auto& command : commands) {
+    if (command.type == CommandType::Run) {
+      frames += command.frames;
+    }
+  }
+  return frames;
+}
+
+void FrameScript::execute(const Command& command, SimData& simData) {
+  switch (command.type) {
+    case CommandType::Set:
+      setSimDataField(simData, *command.field, command.value);
+      break;
+
+    case CommandType::Ramp:
+      pendingRamps.push_back({command.field, getSimDataField(simData, *command.field), command.value});
+      break;
+
+    case CommandType::LocalVariable:
+      HostGauge::instance().setNamedVariable(command.name, command.value);
+      break;
+
+    case CommandType::Event:
+      if (!HostSimConnect::instance().publishClientEvent(command.name, static_cast<long>(command.value))) {
+        std::cout << "HOST: Event '" << command.name << "' is not mapped by the module" << std::endl;
+      }
+      break;
+
+    case CommandType::Pause:
+      HostSimConnect::instance().publishSystemEvent("Pause_EX1", static_cast<long>(command.value));
+      break;
+
+    case CommandType::Run:
+      runFrames = command.frames;
+      runFrame = 0;
+      runSampleTime = command.value;
+      activeRamps = std::move(pendingRamps);
+      pendingRamps.clear();
+      break;
+  }
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "SimConnectData.h"
+#include "SimDataFields.h"
+
+/**
+ * @brief Scripted sequence of SimData frames replayed by the host driver.
+ *
+ * A script is a plain text file with one command per line, '#' starts a comment:
+ *
+ *   set <field> <value>     set a SimData field (member name, struct members as "member.x")
+ *   ramp <field> <value>    move a SimData field linearly to the value over the next run
+ *   lvar <name> <value>     set a local variable
+ *   event <name> <value>    send a sim event the module mapped (e.g. AXIS_ELEVATOR_SET)
+ *   pause <state>           send the Pause_EX1 system event
+ *   run <frames> [dt]       step the given number of frames, dt defaults to 1/30 s
+ */
+class FrameScript {
+ public:
+  static constexpr double DEFAULT_SAMPLE_TIME = 1.0 / 30.0;
+
+  bool load(const std::string& path);
+  bool parse(const std::string& text, const std::string& source);
+
+  /**
+   * @brief Executes commands up to the next frame and fills simData and dt for it.
+   * @return false when the script is exhausted.
+   */
+  bool nextFrame(SimData& simData, double& dt);
+
+  void restart();
+
+  std::size_t getFrameCount() const;
+
+ private:
+  enum class CommandType { Set, Ramp, LocalVariable, Event, Pause, Run };
+
+  struct Command {
+    CommandType type;
+    std::string name;
+    const SimDataField* field;
+    double value;
+    std::size_t frames;
+  };
+
+  struct Ramp {
+    const SimDataField* field;
+    double start;
+    double target;
+  };
+
+  void execute(const Command& command, SimData& simData);
+
+  std::vector<Command> commands;
+  std::size_t commandIndex = 0;
+  std::size_t runFrames = 0;
+  std::size_t runFrame = 0;
+  double runSampleTime = DEFAULT_SAMPLE_TIME;
+  std::vector<Ramp> pendingRamps;
+  std::vector<Ramp> activeRamps;
+};
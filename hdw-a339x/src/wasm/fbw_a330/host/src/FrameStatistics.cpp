@@ -0,0 +1,25 @@
+#include "FrameStatistics.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+
+void printFrameStatistics(const std::string& name, std::vector<std::int64_t>& frameTimes) {
+  if (frameTimes.empty()) {
+    std::cout << "HOST: " << name << ": no frames measured" << std::endl;
+    return;
+  }
+  std::sort(frameTimes.begin(), frameTimes.end());
+  double sum = 0.0;
+  for (auto frameTime : frameTimes) {
+    sum += static_cast<double>(frameTime);
+  }
+  auto percentile = [&frameTimes](double p) {
+    return frameTimes[std::min(frameTimes.size() - 1, static_cast<std::size_t>(p * static_cast<double>(frameTimes.size())))];
+  };
+
+  std::cout << std::fixed << std::setprecision(0);
+  std::cout << "HOST: " << name << ": frames = " << frameTimes.size() << ", ns/frame min = " << frameTimes.front()
+            << ", mean = " << sum / static_cast<double>(frameTimes.size()) << ", p50 = " << percentile(0.50)
+            << ", p90 = " << percentile(0.90) << ", p99 = " << percentile(0.99) << ", max = " << frameTimes.back() << std::endl;
+}
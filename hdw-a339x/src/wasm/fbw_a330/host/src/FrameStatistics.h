@@ -0,0 +1,10 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Prints count and min/mean/p50/p90/p99/max of the given ns/frame samples, the samples are sorted in place.
+ */
+void printFrameStatistics(const std::string& name, std::vector<std::int64_t>& frameTimes);
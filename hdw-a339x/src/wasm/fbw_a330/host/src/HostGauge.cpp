@@ -0,0 +1,193 @@
+#include "HostGauge.h"
+
+#include <algorithm>
+#include <cstdlib>
+
+namespace {
+// extracts NAME from "(L:NAME)" or "(L:NAME, unit)" starting at the given prefix, returns an empty string otherwise
+std::string getLocalVariableName(const std::string& code, const std::string& prefix) {
+  if (code.size() <= prefix.size() || code.rfind(prefix, 0) != 0 || code.back() != ')') {
+    return "";
+  }
+  std::string name = code.substr(prefix.size(), code.size() - prefix.size() - 1);
+  return name.substr(0, name.find(','));
+}
+}  // namespace
+
+HostGauge& HostGauge::instance() {
+  static HostGauge hostGauge;
+  return hostGauge;
+}
+
+void HostGauge::reset() {
+  *this = HostGauge();
+}
+
+ID HostGauge::registerNamedVariable(const std::string& name) {
+  auto existing = namedVariableIds.find(name);
+  if (existing != namedVariableIds.end()) {
+    return existing->second;
+  }
+  ID id = static_cast<ID>(namedVariables.size());
+  namedVariables.emplace_back(name, 0.0);
+  namedVariableIds[name] = id;
+  return id;
+}
+
+ID HostGauge::checkNamedVariable(const std::string& name) const {
+  auto existing = namedVariableIds.find(name);
+  return existing != namedVariableIds.end() ? existing->second : -1;
+}
+
+const char* HostGauge::getNameOfNamedVariable(ID id) const {
+  if (id < 0 || static_cast<std::size_t>(id) >= namedVariables.size()) {
+    return nullptr;
+  }
+  return namedVariables[id].first.c_str();
+}
+
+double HostGauge::getNamedVariable(ID id) const {
+  if (id < 0 || static_cast<std::size_t>(id) >= namedVariables.size()) {
+    return 0.0;
+  }
+  return namedVariables[id].second;
+}
+
+void HostGauge::setNamedVariable(ID id, double value) {
+  if (id < 0 || static_cast<std::size_t>(id) >= namedVariables.size()) {
+    return;
+  }
+  namedVariables[id].second = value;
+}
+
+double HostGauge::getNamedVariable(const std::string& name) {
+  return getNamedVariable(registerNamedVariable(name));
+}
+
+void HostGauge::setNamedVariable(const std::string& name, double value) {
+  setNamedVariable(registerNamedVariable(name), value);
+}
+
+std::size_t HostGauge::getNamedVariableCount() const {
+  return namedVariables.size();
+}
+
+bool HostGauge::executeCalculatorCode(const std::string& code, double* value) {
+  calculatorCode[code]++;
+
+  // only plain local variable reads "(L:X)" and writes "value (>L:X)" are evaluated, everything else is counted only
+  std::string readName = getLocalVariableName(code, "(L:");
+  if (!readName.empty()) {
+    if (value != nullptr) {
+      *value = getNamedVariable(readName);
+    }
+    return true;
+  }
+
+  auto separator = code.find(' ');
+  if (separator != std::string::npos) {
+    std::string writeName = getLocalVariableName(code.substr(separator + 1), "(>L:");
+    if (!writeName.empty()) {
+      setNamedVariable(writeName, std::strtod(code.substr(0, separator).c_str(), nullptr));
+      return true;
+    }
+  }
+
+  if (value != nullptr) {
+    *value = 0.0;
+  }
+  return true;
+}
+
+std::uint64_t HostGauge::getCalculatorCodeCount(const std::string& code) const {
+  auto existing = calculatorCode.find(code);
+  return existing != calculatorCode.end() ? existing->second : 0;
+}
+
+void HostGauge::registerKeyEventHandler(GAUGE_KEY_EVENT_HANDLER_EX1 handler, PVOID userdata) {
+  keyEventHandlers.emplace_back(handler, userdata);
+}
+
+void HostGauge::unregisterKeyEventHandler(GAUGE_KEY_EVENT_HANDLER_EX1 handler, PVOID userdata) {
+  keyEventHandlers.erase(std::remove(keyEventHandlers.begin(), keyEventHandlers.end(), std::make_pair(handler, userdata)),
+                         keyEventHandlers.end());
+}
+
+void HostGauge::publishKeyEvent(ID32 event, UINT32 data0, UINT32 data1) {
+  for (const auto& [handler, userdata] : keyEventHandlers) {
+    handler(event, data0, data1, 0, 0, 0, userdata);
+  }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// gauge API
+// ---------------------------------------------------------------------------------------------------------------------
+
+ID register_named_variable(PCSTRINGZ name) {
+  return HostGauge::instance().registerNamedVariable(name);
+}
+
+ID check_named_variable(PCSTRINGZ name) {
+  return HostGauge::instance().checkNamedVariable(name);
+}
+
+PCSTRINGZ get_name_of_named_variable(ID id) {
+  return HostGauge::instance().getNameOfNamedVariable(id);
+}
+
+FLOAT64 get_named_variable_value(ID id) {
+  return HostGauge::instance().getNamedVariable(id);
+}
+
+FLOAT64 get_named_variable_typed_value(ID id, ENUM) {
+  return HostGauge::instance().getNamedVariable(id);
+}
+
+void set_named_variable_value(ID id, FLOAT64 value) {
+  HostGauge::instance().setNamedVariable(id, value);
+}
+
+void set_named_variable_typed_value(ID id, FLOAT64 value, ENUM) {
+  HostGauge::instance().setNamedVariable(id, value);
+}
+
+void unregister_all_named_vars() {}
+
+ENUM get_units_enum(PCSTRINGZ) {
+  return 0;
+}
+
+ENUM get_aircraft_var_enum(PCSTRINGZ) {
+  return 0;
+}
+
+FLOAT64 aircraft_varget(ENUM, ENUM, SINT32) {
+  return 0.0;
+}
+
+BOOL execute_calculator_code(PCSTRINGZ code, FLOAT64* fvalue, SINT32* ivalue, PCSTRINGZ* svalue) {
+  double value = 0.0;
+  bool result = HostGauge::instance().executeCalculatorCode(code != nullptr ? code : "", &value);
+  if (fvalue != nullptr) {
+    *fvalue = value;
+  }
+  if (ivalue != nullptr) {
+    *ivalue = static_cast<SINT32>(value);
+  }
+  if (svalue != nullptr) {
+    *svalue = "";
+  }
+  return result ? TRUE : FALSE;
+}
+
+void register_key_event_handler(GAUGE_KEY_EVENT_HANDLER, PVOID) {}
+
+void unregister_key_event_handler(GAUGE_KEY_EVENT_HANDLER, PVOID) {}
+
+void register_key_event_handler_EX1(GAUGE_KEY_EVENT_HANDLER_EX1 handler, PVOID userdata) {
+  HostGauge::instance().registerKeyEventHandler(handler, userdata);
+}
+
+void unregister_key_event_handler_EX1(GAUGE_KEY_EVENT_HANDLER_EX1 handler, PVOID userdata) {
+  HostGauge::instance().unregisterKeyEventHandler(handler, userdata);
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <MSFS/Legacy/gauges.h>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief In-process stand-in for the gauge API (named variables, calculator code and key events) used by the host build.
+ */
+class HostGauge {
+ public:
+  static HostGauge& instance();
+
+  void reset();
+
+  // named variables
+  ID registerNamedVariable(const std::string& name);
+  ID checkNamedVariable(const std::string& name) const;
+  const char* getNameOfNamedVariable(ID id) const;
+  double getNamedVariable(ID id) const;
+  void setNamedVariable(ID id, double value);
+
+  /**
+   * @brief Convenience accessors for the host driver, the variable is registered when it does not exist yet.
+   */
+  double getNamedVariable(const std::string& name);
+  void setNamedVariable(const std::string& name, double value);
+
+  std::size_t getNamedVariableCount() const;
+
+  // calculator code
+  bool executeCalculatorCode(const std::string& code, double* value);
+  std::uint64_t getCalculatorCodeCount(const std::string& code) const;
+
+  // key events
+  void registerKeyEventHandler(GAUGE_KEY_EVENT_HANDLER_EX1 handler, PVOID userdata);
+  void unregisterKeyEventHandler(GAUGE_KEY_EVENT_HANDLER_EX1 handler, PVOID userdata);
+  void publishKeyEvent(ID32 event, UINT32 data0 = 0, UINT32 data1 = 0);
+
+ private:
+  HostGauge() = default;
+
+  std::vector<std::pair<std::string, double>> namedVariables;
+  std::map<std::string, ID> namedVariableIds;
+  std::map<std::string, std::uint64_t> calculatorCode;
+  std::vector<std::pair<GAUGE_KEY_EVENT_HANDLER_EX1, PVOID>> keyEventHandlers;
+};
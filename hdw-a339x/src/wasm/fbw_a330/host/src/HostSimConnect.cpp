@@ -0,0 +1,390 @@
+#include "HostSimConnect.h"
+
+#include <cstddef>
+#include <cstring>
+#include <iostream>
+
+namespace {
+// size of the header in front of the data, dwData is the first data word
+constexpr std::size_t SIMOBJECT_DATA_HEADER_SIZE = sizeof(SIMCONNECT_RECV_SIMOBJECT_DATA) - sizeof(DWORD);
+
+// dummy handle value handed to the module, it is never dereferenced
+HANDLE const HOST_SIMCONNECT_HANDLE = reinterpret_cast<HANDLE>(static_cast<std::uintptr_t>(0x5c));
+
+std::size_t getDataTypeSize(SIMCONNECT_DATATYPE dataType) {
+  switch (dataType) {
+    case SIMCONNECT_DATATYPE_INT32:
+    case SIMCONNECT_DATATYPE_FLOAT32:
+      return 4;
+    case SIMCONNECT_DATATYPE_INT64:
+    case SIMCONNECT_DATATYPE_FLOAT64:
+      return 8;
+    case SIMCONNECT_DATATYPE_LATLONALT:
+    case SIMCONNECT_DATATYPE_XYZ:
+      return 24;
+    default:
+      return 0;
+  }
+}
+}  // namespace
+
+HostSimConnect& HostSimConnect::instance() {
+  static HostSimConnect hostSimConnect;
+  return hostSimConnect;
+}
+
+void HostSimConnect::reset() {
+  *this = HostSimConnect();
+}
+
+bool HostSimConnect::isOpen() const {
+  return opened;
+}
+
+void HostSimConnect::publishSimObjectData(SIMCONNECT_DATA_DEFINITION_ID defineId, const void* data, std::size_t size) {
+  // warn when the published block does not match what the module defined, this catches layout drift of SimData
+  auto definition = dataDefinitionSizes.find(defineId);
+  if (definition != dataDefinitionSizes.end() && definition->second != size) {
+    std::cout << "HOST: Size mismatch for data definition " << defineId << ": defined " << definition->second << " bytes, published "
+              << size << " bytes" << std::endl;
+  }
+
+  for (const auto& request : dataRequests) {
+    if (request.defineId != defineId || request.period == SIMCONNECT_PERIOD_NEVER) {
+      continue;
+    }
+    SIMCONNECT_RECV_SIMOBJECT_DATA header = {};
+    header.dwRequestID = request.requestId;
+    header.dwObjectID = SIMCONNECT_OBJECT_ID_USER;
+    header.dwDefineID = defineId;
+    header.dwentrynumber = 1;
+    header.dwoutof = 1;
+    header.dwDefineCount = 1;
+    queueMessage(SIMCONNECT_RECV_ID_SIMOBJECT_DATA, &header, SIMOBJECT_DATA_HEADER_SIZE, data, size);
+  }
+}
+
+void HostSimConnect::publishSystemEvent(const std::string& name, long data) {
+  auto event = systemEvents.find(name);
+  if (event == systemEvents.end()) {
+    return;
+  }
+  SIMCONNECT_RECV_EVENT message = {};
+  message.uEventID = event->second;
+  message.dwData = static_cast<DWORD>(data);
+  queueMessage(SIMCONNECT_RECV_ID_EVENT, &message, sizeof(message), nullptr, 0);
+}
+
+bool HostSimConnect::publishClientEvent(const std::string& name, long data0, long data1) {
+  auto event = clientEvents.find(name);
+  if (event == clientEvents.end()) {
+    return false;
+  }
+  SIMCONNECT_RECV_EVENT_EX1 message = {};
+  message.uEventID = event->second;
+  message.dwData0 = static_cast<DWORD>(data0);
+  message.dwData1 = static_cast<DWORD>(data1);
+  queueMessage(SIMCONNECT_RECV_ID_EVENT_EX1, &message, sizeof(message), nullptr, 0);
+  return true;
+}
+
+const std::vector<char>* HostSimConnect::getSimObjectOutput(SIMCONNECT_DATA_DEFINITION_ID defineId) const {
+  auto output = simObjectOutputs.find(defineId);
+  return output != simObjectOutputs.end() ? &output->second : nullptr;
+}
+
+std::uint64_t HostSimConnect::getTransmittedEventCount(const std::string& name) const {
+  auto event = transmittedEvents.find(name);
+  return event != transmittedEvents.end() ? event->second : 0;
+}
+
+std::uint64_t HostSimConnect::getDispatchedMessageCount() const {
+  return dispatchedMessageCount;
+}
+
+HRESULT HostSimConnect::open(HANDLE* phSimConnect) {
+  if (opened) {
+    return E_FAIL;
+  }
+  opened = true;
+  *phSimConnect = HOST_SIMCONNECT_HANDLE;
+  SIMCONNECT_RECV message = {};
+  queueMessage(SIMCONNECT_RECV_ID_OPEN, &message, sizeof(message), nullptr, 0);
+  return S_OK;
+}
+
+HRESULT HostSimConnect::close() {
+  if (!opened) {
+    return E_FAIL;
+  }
+  reset();
+  return S_OK;
+}
+
+HRESULT HostSimConnect::getNextDispatch(SIMCONNECT_RECV** ppData, DWORD* pcbData) {
+  if (!opened || messageQueue.empty()) {
+    return E_FAIL;
+  }
+  // the current message stays valid until the next call, like the sim does it
+  currentMessage = std::move(messageQueue.front());
+  messageQueue.pop_front();
+  dispatchedMessageCount++;
+  *ppData = reinterpret_cast<SIMCONNECT_RECV*>(currentMessage.data());
+  *pcbData = static_cast<DWORD>(currentMessage.size());
+  return S_OK;
+}
+
+HRESULT HostSimConnect::mapClientEventToSimEvent(SIMCONNECT_CLIENT_EVENT_ID eventId, const char* eventName) {
+  std::string name = eventName != nullptr ? eventName : "";
+  if (name.empty() || clientEvents.count(name) > 0) {
+    return E_FAIL;
+  }
+  clientEvents[name] = eventId;
+  clientEventNames[eventId] = name;
+  return S_OK;
+}
+
+HRESULT HostSimConnect::subscribeToSystemEvent(SIMCONNECT_CLIENT_EVENT_ID eventId, const char* eventName) {
+  if (eventName == nullptr) {
+    return E_FAIL;
+  }
+  systemEvents[eventName] = eventId;
+  return S_OK;
+}
+
+HRESULT HostSimConnect::unsubscribeFromSystemEvent(SIMCONNECT_CLIENT_EVENT_ID eventId) {
+  for (auto it = systemEvents.begin(); it != systemEvents.end(); ++it) {
+    if (it->second == eventId) {
+      systemEvents.erase(it);
+      return S_OK;
+    }
+  }
+  return E_FAIL;
+}
+
+HRESULT HostSimConnect::transmitClientEvent(SIMCONNECT_CLIENT_EVENT_ID eventId) {
+  auto name = clientEventNames.find(eventId);
+  if (name == clientEventNames.end()) {
+    return E_FAIL;
+  }
+  transmittedEvents[name->second]++;
+  return S_OK;
+}
+
+HRESULT HostSimConnect::addToDataDefinition(SIMCONNECT_DATA_DEFINITION_ID defineId, SIMCONNECT_DATATYPE dataType) {
+  dataDefinitionSizes[defineId] += getDataTypeSize(dataType);
+  return S_OK;
+}
+
+HRESULT HostSimConnect::requestDataOnSimObject(SIMCONNECT_DATA_REQUEST_ID requestId,
+                                               SIMCONNECT_DATA_DEFINITION_ID defineId,
+                                               SIMCONNECT_PERIOD period) {
+  for (auto& request : dataRequests) {
+    if (request.requestId == requestId) {
+      request.defineId = defineId;
+      request.period = period;
+      return S_OK;
+    }
+  }
+  dataRequests.push_back({requestId, defineId, period});
+  return S_OK;
+}
+
+HRESULT HostSimConnect::setDataOnSimObject(SIMCONNECT_DATA_DEFINITION_ID defineId, DWORD size, const void* data) {
+  auto& output = simObjectOutputs[defineId];
+  output.resize(size);
+  std::memcpy(output.data(), data, size);
+  return S_OK;
+}
+
+HRESULT HostSimConnect::mapClientDataNameToId(const char* name, SIMCONNECT_CLIENT_DATA_ID clientDataId) {
+  if (name == nullptr) {
+    return E_FAIL;
+  }
+  auto existing = clientDataNames.find(name);
+  if (existing != clientDataNames.end() && existing->second != clientDataId) {
+    return E_FAIL;
+  }
+  clientDataNames[name] = clientDataId;
+  return S_OK;
+}
+
+HRESULT HostSimConnect::createClientData(SIMCONNECT_CLIENT_DATA_ID clientDataId, DWORD size) {
+  auto& area = clientDataAreas[clientDataId];
+  if (area.size() < size) {
+    area.resize(size);
+  }
+  return S_OK;
+}
+
+HRESULT HostSimConnect::requestClientData(SIMCONNECT_CLIENT_DATA_ID clientDataId,
+                                          SIMCONNECT_DATA_REQUEST_ID requestId,
+                                          SIMCONNECT_CLIENT_DATA_DEFINITION_ID defineId,
+                                          SIMCONNECT_CLIENT_DATA_PERIOD period) {
+  if (clientDataAreas.count(clientDataId) == 0) {
+    return E_FAIL;
+  }
+  clientDataRequests.push_back({clientDataId, requestId, defineId, period});
+  return S_OK;
+}
+
+HRESULT HostSimConnect::setClientData(SIMCONNECT_CLIENT_DATA_ID clientDataId, DWORD size, const void* data) {
+  auto area = clientDataAreas.find(clientDataId);
+  if (area == clientDataAreas.end() || area->second.size() < size) {
+    return E_FAIL;
+  }
+  std::memcpy(area->second.data(), data, size);
+
+  // notify everyone who asked to be told when this area is set
+  for (const auto& request : clientDataRequests) {
+    if (request.clientDataId != clientDataId || request.period != SIMCONNECT_CLIENT_DATA_PERIOD_ON_SET) {
+      continue;
+    }
+    SIMCONNECT_RECV_CLIENT_DATA header = {};
+    header.dwRequestID = request.requestId;
+    header.dwDefineID = request.defineId;
+    header.dwentrynumber = 1;
+    header.dwoutof = 1;
+    header.dwDefineCount = 1;
+    queueMessage(SIMCONNECT_RECV_ID_CLIENT_DATA, &header, SIMOBJECT_DATA_HEADER_SIZE, area->second.data(),
+                 area->second.size());
+  }
+  return S_OK;
+}
+
+void HostSimConnect::queueMessage(SIMCONNECT_RECV_ID id, const void* header, std::size_t headerSize, const void* data, std::size_t size) {
+  std::vector<char> message(headerSize + size);
+  std::memcpy(message.data(), header, headerSize);
+  if (data != nullptr && size > 0) {
+    std::memcpy(message.data() + headerSize, data, size);
+  }
+  auto* recv = reinterpret_cast<SIMCONNECT_RECV*>(message.data());
+  recv->dwSize = static_cast<DWORD>(message.size());
+  recv->dwVersion = 1;
+  recv->dwID = id;
+  messageQueue.push_back(std::move(message));
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// SimConnect API
+// ---------------------------------------------------------------------------------------------------------------------
+
+HRESULT SimConnect_Open(HANDLE* phSimConnect, LPCSTR, HWND, DWORD, HANDLE, DWORD) {
+  return HostSimConnect::instance().open(phSimConnect);
+}
+
+HRESULT SimConnect_Close(HANDLE) {
+  return HostSimConnect::instance().close();
+}
+
+HRESULT SimConnect_GetNextDispatch(HANDLE, SIMCONNECT_RECV** ppData, DWORD* pcbData) {
+  return HostSimConnect::instance().getNextDispatch(ppData, pcbData);
+}
+
+HRESULT SimConnect_MapClientEventToSimEvent(HANDLE, SIMCONNECT_CLIENT_EVENT_ID EventID, const char* EventName) {
+  return HostSimConnect::instance().mapClientEventToSimEvent(EventID, EventName);
+}
+
+HRESULT SimConnect_AddClientEventToNotificationGroup(HANDLE, SIMCONNECT_NOTIFICATION_GROUP_ID, SIMCONNECT_CLIENT_EVENT_ID, BOOL) {
+  return S_OK;
+}
+
+HRESULT SimConnect_SetNotificationGroupPriority(HANDLE, SIMCONNECT_NOTIFICATION_GROUP_ID, DWORD) {
+  return S_OK;
+}
+
+HRESULT SimConnect_SubscribeToSystemEvent(HANDLE, SIMCONNECT_CLIENT_EVENT_ID EventID, const char* SystemEventName) {
+  return HostSimConnect::instance().subscribeToSystemEvent(EventID, SystemEventName);
+}
+
+HRESULT SimConnect_UnsubscribeFromSystemEvent(HANDLE, SIMCONNECT_CLIENT_EVENT_ID EventID) {
+  return HostSimConnect::instance().unsubscribeFromSystemEvent(EventID);
+}
+
+HRESULT SimConnect_TransmitClientEvent(HANDLE,
+                                       SIMCONNECT_OBJECT_ID,
+                                       SIMCONNECT_CLIENT_EVENT_ID EventID,
+                                       DWORD,
+                                       SIMCONNECT_NOTIFICATION_GROUP_ID,
+                                       SIMCONNECT_EVENT_FLAG) {
+  return HostSimConnect::instance().transmitClientEvent(EventID);
+}
+
+HRESULT SimConnect_TransmitClientEvent_EX1(HANDLE,
+                                           SIMCONNECT_OBJECT_ID,
+                                           SIMCONNECT_CLIENT_EVENT_ID EventID,
+                                           SIMCONNECT_NOTIFICATION_GROUP_ID,
+                                           SIMCONNECT_EVENT_FLAG,
+                                           DWORD,
+                                           DWORD,
+                                           DWORD,
+                                           DWORD,
+                                           DWORD) {
+  return HostSimConnect::instance().transmitClientEvent(EventID);
+}
+
+HRESULT SimConnect_AddToDataDefinition(HANDLE,
+                                       SIMCONNECT_DATA_DEFINITION_ID DefineID,
+                                       const char*,
+                                       const char*,
+                                       SIMCONNECT_DATATYPE DatumType,
+                                       float,
+                                       DWORD) {
+  return HostSimConnect::instance().addToDataDefinition(DefineID, DatumType);
+}
+
+HRESULT SimConnect_RequestDataOnSimObject(HANDLE,
+                                          SIMCONNECT_DATA_REQUEST_ID RequestID,
+                                          SIMCONNECT_DATA_DEFINITION_ID DefineID,
+                                          SIMCONNECT_OBJECT_ID,
+                                          SIMCONNECT_PERIOD Period,
+                                          SIMCONNECT_DATA_REQUEST_FLAG,
+                                          DWORD,
+                                          DWORD,
+                                          DWORD) {
+  return HostSimConnect::instance().requestDataOnSimObject(RequestID, DefineID, Period);
+}
+
+HRESULT SimConnect_SetDataOnSimObject(HANDLE,
+                                      SIMCONNECT_DATA_DEFINITION_ID DefineID,
+                                      SIMCONNECT_OBJECT_ID,
+                                      SIMCONNECT_DATA_SET_FLAG,
+                                      DWORD,
+                                      DWORD cbUnitSize,
+                                      void* pDataSet) {
+  return HostSimConnect::instance().setDataOnSimObject(DefineID, cbUnitSize, pDataSet);
+}
+
+HRESULT SimConnect_MapClientDataNameToID(HANDLE, const char* szClientDataName, SIMCONNECT_CLIENT_DATA_ID ClientDataID) {
+  return HostSimConnect::instance().mapClientDataNameToId(szClientDataName, ClientDataID);
+}
+
+HRESULT SimConnect_CreateClientData(HANDLE, SIMCONNECT_CLIENT_DATA_ID ClientDataID, DWORD dwSize, SIMCONNECT_CREATE_CLIENT_DATA_FLAG) {
+  return HostSimConnect::instance().createClientData(ClientDataID, dwSize);
+}
+
+HRESULT SimConnect_AddToClientDataDefinition(HANDLE, SIMCONNECT_CLIENT_DATA_DEFINITION_ID, DWORD, DWORD, float, DWORD) {
+  return S_OK;
+}
+
+HRESULT SimConnect_RequestClientData(HANDLE,
+                                     SIMCONNECT_CLIENT_DATA_ID ClientDataID,
+                                     SIMCONNECT_DATA_REQUEST_ID RequestID,
+                                     SIMCONNECT_CLIENT_DATA_DEFINITION_ID DefineID,
+                                     SIMCONNECT_CLIENT_DATA_PERIOD Period,
+                                     SIMCONNECT_CLIENT_DATA_REQUEST_FLAG,
+                                     DWORD,
+                                     DWORD,
+                                     DWORD) {
+  return HostSimConnect::instance().requestClientData(ClientDataID, RequestID, DefineID, Period);
+}
+
+HRESULT SimConnect_SetClientData(HANDLE,
+                                 SIMCONNECT_CLIENT_DATA_ID ClientDataID,
+                                 SIMCONNECT_CLIENT_DATA_DEFINITION_ID,
+                                 SIMCONNECT_CLIENT_DATA_SET_FLAG,
+                                 DWORD,
+                                 DWORD cbUnitSize,
+                                 void* pDataSet) {
+  return HostSimConnect::instance().setClientData(ClientDataID, cbUnitSize, pDataSet);
+}
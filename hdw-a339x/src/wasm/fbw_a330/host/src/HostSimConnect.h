@@ -0,0 +1,113 @@
+#pragma once
+
+#include <SimConnect.h>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <string>
+#include <vector>
+
+/**
+ * @brief In-process stand-in for the SimConnect server used by the host build.
+ *
+ * The module side talks to it through the regular SimConnect_* functions, the host driver uses the public methods
+ * below to publish sim object data and events and to inspect what the module sent back. Messages are queued and
+ * handed out by SimConnect_GetNextDispatch in the order they were published.
+ */
+class HostSimConnect {
+ public:
+  static HostSimConnect& instance();
+
+  /**
+   * @brief Drops all connection state, definitions, client data areas and queued messages.
+   */
+  void reset();
+
+  bool isOpen() const;
+
+  /**
+   * @brief Publishes a block of sim object data to every request registered for the given definition.
+   */
+  void publishSimObjectData(SIMCONNECT_DATA_DEFINITION_ID defineId, const void* data, std::size_t size);
+
+  /**
+   * @brief Publishes a system event (e.g. "Pause_EX1") to the subscribed client event.
+   */
+  void publishSystemEvent(const std::string& name, long data);
+
+  /**
+   * @brief Publishes a sim event (e.g. "AXIS_ELEVATOR_SET") to the mapped client event. Negative data is sign
+   * extended so the module sees the same value it would get from the sim.
+   */
+  bool publishClientEvent(const std::string& name, long data0, long data1 = 0);
+
+  /**
+   * @brief Returns the last data block the module sent with SimConnect_SetDataOnSimObject for a definition.
+   */
+  const std::vector<char>* getSimObjectOutput(SIMCONNECT_DATA_DEFINITION_ID defineId) const;
+
+  /**
+   * @brief Number of times the module transmitted the named sim event.
+   */
+  std::uint64_t getTransmittedEventCount(const std::string& name) const;
+
+  /**
+   * @brief Total number of messages handed out through SimConnect_GetNextDispatch.
+   */
+  std::uint64_t getDispatchedMessageCount() const;
+
+  // SimConnect API implementation
+  HRESULT open(HANDLE* phSimConnect);
+  HRESULT close();
+  HRESULT getNextDispatch(SIMCONNECT_RECV** ppData, DWORD* pcbData);
+  HRESULT mapClientEventToSimEvent(SIMCONNECT_CLIENT_EVENT_ID eventId, const char* eventName);
+  HRESULT subscribeToSystemEvent(SIMCONNECT_CLIENT_EVENT_ID eventId, const char* eventName);
+  HRESULT unsubscribeFromSystemEvent(SIMCONNECT_CLIENT_EVENT_ID eventId);
+  HRESULT transmitClientEvent(SIMCONNECT_CLIENT_EVENT_ID eventId);
+  HRESULT addToDataDefinition(SIMCONNECT_DATA_DEFINITION_ID defineId, SIMCONNECT_DATATYPE dataType);
+  HRESULT requestDataOnSimObject(SIMCONNECT_DATA_REQUEST_ID requestId, SIMCONNECT_DATA_DEFINITION_ID defineId, SIMCONNECT_PERIOD period);
+  HRESULT setDataOnSimObject(SIMCONNECT_DATA_DEFINITION_ID defineId, DWORD size, const void* data);
+  HRESULT mapClientDataNameToId(const char* name, SIMCONNECT_CLIENT_DATA_ID clientDataId);
+  HRESULT createClientData(SIMCONNECT_CLIENT_DATA_ID clientDataId, DWORD size);
+  HRESULT requestClientData(SIMCONNECT_CLIENT_DATA_ID clientDataId,
+                            SIMCONNECT_DATA_REQUEST_ID requestId,
+                            SIMCONNECT_CLIENT_DATA_DEFINITION_ID defineId,
+                            SIMCONNECT_CLIENT_DATA_PERIOD period);
+  HRESULT setClientData(SIMCONNECT_CLIENT_DATA_ID clientDataId, DWORD size, const void* data);
+
+ private:
+  struct DataRequest {
+    SIMCONNECT_DATA_REQUEST_ID requestId;
+    SIMCONNECT_DATA_DEFINITION_ID defineId;
+    SIMCONNECT_PERIOD period;
+  };
+
+  struct ClientDataRequest {
+    SIMCONNECT_CLIENT_DATA_ID clientDataId;
+    SIMCONNECT_DATA_REQUEST_ID requestId;
+    SIMCONNECT_CLIENT_DATA_DEFINITION_ID defineId;
+    SIMCONNECT_CLIENT_DATA_PERIOD period;
+  };
+
+  HostSimConnect() = default;
+
+  void queueMessage(SIMCONNECT_RECV_ID id, const void* header, std::size_t headerSize, const void* data, std::size_t size);
+
+  bool opened = false;
+  std::deque<std::vector<char>> messageQueue;
+  std::vector<char> currentMessage;
+  std::uint64_t dispatchedMessageCount = 0;
+
+  std::map<std::string, SIMCONNECT_CLIENT_EVENT_ID> clientEvents;
+  std::map<SIMCONNECT_CLIENT_EVENT_ID, std::string> clientEventNames;
+  std::map<std::string, SIMCONNECT_CLIENT_EVENT_ID> systemEvents;
+  std::map<std::string, std::uint64_t> transmittedEvents;
+
+  std::map<SIMCONNECT_DATA_DEFINITION_ID, std::size_t> dataDefinitionSizes;
+  std::vector<DataRequest> dataRequests;
+  std::map<SIMCONNECT_DATA_DEFINITION_ID, std::vector<char>> simObjectOutputs;
+
+  std::map<std::string, SIMCONNECT_CLIENT_DATA_ID> clientDataNames;
+  std::map<SIMCONNECT_CLIENT_DATA_ID, std::vector<char>> clientDataAreas;
+  std::vector<ClientDataRequest> clientDataRequests;
+};
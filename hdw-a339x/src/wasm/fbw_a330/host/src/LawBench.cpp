@@ -0,0 +1,250 @@
+// Micro benchmark of the step functions of single generated models, driven by a synthetic flight profile.
+//
+// The profile sweeps the scheduling inputs (airspeeds, Mach, radio height, flap configuration, weight) across the
+// breakpoints of the lookup tables, so the step time includes the table lookups of all segments. The outputs of every
+// step are folded into a hash, runs of different builds are expected to print the same hash when the models compute
+// bit identical results.
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "FacComputer.h"
+#include "FrameStatistics.h"
+#include "PitchNormalLaw.h"
+
+namespace {
+const double PI = 3.14159265358979323846;
+const double SAMPLE_TIME = 1.0 / 30.0;
+
+// the models rely on zero initialized members, keep them in static storage like the module does
+PitchNormalLaw pitchNormalLaw;
+FacComputer facComputer;
+
+struct Options {
+  std::size_t steps = 200000;
+  std::size_t warmupSteps = 1000;
+};
+
+void printUsage(const char* name) {
+  std::cout << "Usage: " << name << " [--steps <steps>] [--warmup <steps>]" << std::endl;
+  std::cout << "  --steps <steps>   measured steps per model (default: 200000)" << std::endl;
+  std::cout << "  --warmup <steps>  steps excluded from the statistics (default: 1000)" << std::endl;
+}
+
+bool parseOptions(int argc, char** argv, Options& options) {
+  for (int i = 1; i < argc; i++) {
+    std::string argument = argv[i];
+    bool hasValue = i + 1 < argc;
+    if (argument == "--steps" && hasValue) {
+      options.steps = std::strtoul(argv[++i], nullptr, 10);
+    } else if (argument == "--warmup" && hasValue) {
+      options.warmupSteps = std::strtoul(argv[++i], nullptr, 10);
+    } else {
+      return false;
+    }
+  }
+  return options.steps > 0;
+}
+
+// FNV-1a over the bytes of the outputs
+class OutputHash {
+ public:
+  template <typename T>
+  void add(const T& value) {
+    const auto* bytes = reinterpret_cast<const unsigned char*>(&value);
+    for (std::size_t i = 0; i < sizeof(T); i++) {
+      hash = (hash ^ bytes[i]) * 0x100000001b3ULL;
+    }
+  }
+
+  std::uint64_t get() const { return hash; }
+
+ private:
+  std::uint64_t hash = 0xcbf29ce484222325ULL;
+};
+
+double sweep(double time, double center, double amplitude, double period) {
+  return center + amplitude * std::sin(2.0 * PI * time / period);
+}
+
+template <typename Bus>
+void setNormalOperation(Bus& bus) {
+  static_assert(sizeof(Bus) % sizeof(base_arinc_429) == 0, "bus is expected to only contain ARINC 429 words");
+  auto* words = reinterpret_cast<base_arinc_429*>(&bus);
+  for (std::size_t i = 0; i < sizeof(Bus) / sizeof(base_arinc_429); i++) {
+    words[i].SSM = static_cast<uint32_T>(SignStatusMatrix::NormalOperation);
+  }
+}
+
+void printResult(const std::string& name, std::vector<std::int64_t>& stepTimes, const OutputHash& hash) {
+  printFrameStatistics(name, stepTimes);
+  std::cout << "HOST: " << name << ": output hash = " << std::hex << std::setw(16) << std::setfill('0') << hash.get()
+            << std::dec << std::setfill(' ') << std::endl;
+}
+
+void benchPitchNormalLaw(const Options& options) {
+  pitchNormalLaw.init();
+
+  real_T dt = SAMPLE_TIME;
+  real_T nz = 1.0;
+  real_T theta = 0.0;
+  real_T phi = 0.0;
+  real_T qk = 0.0;
+  real_T qkDot = 0.0;
+  real_T eta = 0.0;
+  real_T etaTrim = 0.0;
+  real_T alpha = 2.0;
+  real_T vIas = 250.0;
+  real_T vTas = 300.0;
+  real_T hRadio = 2500.0;
+  real_T flapsHandleIndex = 0.0;
+  real_T spoilersLeft = 0.0;
+  real_T spoilersRight = 0.0;
+  real_T thrustLever1 = 25.0;
+  real_T thrustLever2 = 25.0;
+  boolean_T tailstrikeProtectionOn = true;
+  real_T vls = 140.0;
+  real_T deltaEta = 0.0;
+  boolean_T onGround = false;
+  real_T inFlight = 1.0;
+  boolean_T trackingModeOn = false;
+  boolean_T highAoaProtActive = false;
+  boolean_T highSpeedProtActive = false;
+  real_T alphaProt = 10.0;
+  real_T alphaMax = 12.0;
+  real_T highSpeedProtHigh = 360.0;
+  real_T highSpeedProtLow = 350.0;
+  real_T apThetaC = 2.0;
+  boolean_T anyApEngaged = false;
+  real_T outEta = 0.0;
+  real_T outEtaTrimDot = 0.0;
+  real_T outEtaTrimLimitLo = 0.0;
+  real_T outEtaTrimLimitUp = 0.0;
+
+  std::vector<std::int64_t> stepTimes;
+  stepTimes.reserve(options.steps);
+  OutputHash hash;
+
+  for (std::size_t i = 0; i < options.warmupSteps + options.steps; i++) {
+    double time = static_cast<double>(i) * SAMPLE_TIME;
+    vTas = sweep(time, 260.0, 150.0, 120.0);
+    vIas = 0.8 * vTas;
+    hRadio = std::fmax(0.0, sweep(time, 1000.0, 1200.0, 90.0));
+    theta = sweep(time, 3.0, 8.0, 40.0);
+    phi = sweep(time, 0.0, 30.0, 60.0);
+    qk = sweep(time, 0.0, 3.0, 7.0);
+    qkDot = sweep(time, 0.0, 1.0, 5.0);
+    nz = sweep(time, 1.0, 0.3, 11.0);
+    eta = sweep(time, 0.0, 5.0, 13.0);
+    alpha = sweep(time, 4.0, 4.0, 17.0);
+    deltaEta = sweep(time, 0.0, 0.5, 9.0);
+    flapsHandleIndex = std::floor(sweep(time, 2.5, 2.99, 200.0));
+    anyApEngaged = std::fmod(time, 150.0) > 100.0;
+    apThetaC = sweep(time, 2.0, 3.0, 30.0);
+
+    auto start = std::chrono::steady_clock::now();
+    pitchNormalLaw.step(&dt, &nz, &theta, &phi, &qk, &qkDot, &eta, &etaTrim, &alpha, &vIas, &vTas, &hRadio,
+                        &flapsHandleIndex, &spoilersLeft, &spoilersRight, &thrustLever1, &thrustLever2,
+                        &tailstrikeProtectionOn, &vls, &deltaEta, &onGround, &inFlight, &trackingModeOn, &highAoaProtActive,
+                        &highSpeedProtActive, &alphaProt, &alphaMax, &highSpeedProtHigh, &highSpeedProtLow, &apThetaC,
+                        &anyApEngaged, &outEta, &outEtaTrimDot, &outEtaTrimLimitLo, &outEtaTrimLimitUp);
+    auto end = std::chrono::steady_clock::now();
+
+    hash.add(outEta);
+    hash.add(outEtaTrimDot);
+    hash.add(outEtaTrimLimitLo);
+    hash.add(outEtaTrimLimitUp);
+    if (i >= options.warmupSteps) {
+      stepTimes.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+    }
+  }
+
+  printResult("PitchNormalLaw", stepTimes, hash);
+}
+
+void benchFacComputer(const Options& options) {
+  facComputer.initialize();
+
+  auto& inputs = facComputer.getExternalInputs().in;
+  inputs.time.dt = SAMPLE_TIME;
+  inputs.sim_data.computer_running = true;
+  inputs.discrete_inputs.fac_engaged_from_switch = true;
+  inputs.discrete_inputs.is_unit_1 = true;
+  setNormalOperation(inputs.bus_inputs.adr_own_bus);
+  setNormalOperation(inputs.bus_inputs.adr_opp_bus);
+  setNormalOperation(inputs.bus_inputs.adr_3_bus);
+  setNormalOperation(inputs.bus_inputs.ir_own_bus);
+  setNormalOperation(inputs.bus_inputs.ir_opp_bus);
+  setNormalOperation(inputs.bus_inputs.ir_3_bus);
+  setNormalOperation(inputs.bus_inputs.fmgc_own_bus);
+  setNormalOperation(inputs.bus_inputs.sfcc_own_bus);
+
+  std::vector<std::int64_t> stepTimes;
+  stepTimes.reserve(options.steps);
+  OutputHash hash;
+
+  for (std::size_t i = 0; i < options.warmupSteps + options.steps; i++) {
+    double time = static_cast<double>(i) * SAMPLE_TIME;
+    inputs.time.simulation_time = time;
+    inputs.time.monotonic_time = time;
+
+    auto& adr = inputs.bus_inputs.adr_own_bus;
+    adr.airspeed_computed_kn.Data = static_cast<real32_T>(sweep(time, 250.0, 130.0, 120.0));
+    adr.airspeed_true_kn.Data = static_cast<real32_T>(1.2 * adr.airspeed_computed_kn.Data);
+    adr.mach.Data = static_cast<real32_T>(sweep(time, 0.55, 0.5, 150.0));
+    adr.aoa_corrected_deg.Data = static_cast<real32_T>(sweep(time, 4.0, 4.0, 17.0));
+    adr.altitude_corrected_ft.Data = static_cast<real32_T>(sweep(time, 20000.0, 19000.0, 300.0));
+    adr.corrected_average_static_pressure.Data = static_cast<real32_T>(1013.25 * std::exp(-adr.altitude_corrected_ft.Data / 27000.0));
+    inputs.bus_inputs.adr_3_bus = adr;
+    inputs.bus_inputs.adr_opp_bus = adr;
+
+    auto& ir = inputs.bus_inputs.ir_own_bus;
+    ir.body_yaw_rate_deg_s.Data = static_cast<real32_T>(sweep(time, 0.0, 2.0, 13.0));
+    ir.body_lat_accel_g.Data = static_cast<real32_T>(sweep(time, 0.0, 0.05, 7.0));
+    ir.pitch_angle_deg.Data = static_cast<real32_T>(sweep(time, 3.0, 8.0, 40.0));
+    ir.roll_angle_deg.Data = static_cast<real32_T>(sweep(time, 0.0, 30.0, 60.0));
+    inputs.bus_inputs.ir_3_bus = ir;
+    inputs.bus_inputs.ir_opp_bus = ir;
+
+    inputs.bus_inputs.fmgc_own_bus.fac_weight_lbs.Data = static_cast<real32_T>(sweep(time, 420000.0, 120000.0, 500.0));
+    inputs.bus_inputs.fmgc_own_bus.fm_weight_lbs.Data = inputs.bus_inputs.fmgc_own_bus.fac_weight_lbs.Data;
+    // changing slat and flap configurations, the bits are evaluated from the integer value of the word
+    auto configuration = static_cast<std::uint32_t>(time / 20.0);
+    inputs.bus_inputs.sfcc_own_bus.slat_flap_system_status_word.Data =
+        static_cast<real32_T>((configuration * 2654435761U) & 0x3FFFFFU);
+
+    auto start = std::chrono::steady_clock::now();
+    facComputer.step();
+    auto end = std::chrono::steady_clock::now();
+
+    const auto& outputs = facComputer.getExternalOutputs().out;
+    hash.add(outputs.laws);
+    hash.add(outputs.analog_outputs);
+    hash.add(outputs.bus_outputs);
+    if (i >= options.warmupSteps) {
+      stepTimes.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+    }
+  }
+
+  printResult("FacComputer", stepTimes, hash);
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+  Options options;
+  if (!parseOptions(argc, argv, options)) {
+    printUsage(argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  benchPitchNormalLaw(options);
+  benchFacComputer(options);
+  return EXIT_SUCCESS;
+}
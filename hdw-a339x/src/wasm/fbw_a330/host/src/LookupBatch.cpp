@@ -0,0 +1,312 @@
+#include "LookupBatch.h"
+
+#include <cassert>
+
+#include "binsearch_u32d_prevIdx.h"
+
+#if defined(__AVX__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+namespace {
+// points that are prelooked up before they are interpolated, keeps the scratch arrays on the stack
+constexpr uint32_T CHUNK_SIZE = 256;
+
+// up to this number of intervals the interval is found by counting the breakpoints below the input, which has no
+// branches to mispredict on unordered inputs
+constexpr uint32_T COUNT_SEARCH_MAX_INDEX = 16;
+
+// double lanes of the widest vector unit the compiler targets, the operations round exactly like the scalar ones
+#if defined(__AVX__)
+struct Lanes {
+  static constexpr uint32_T WIDTH = 4;
+  __m256d v;
+};
+
+inline Lanes load(const real_T* values) {
+  return {_mm256_loadu_pd(values)};
+}
+
+inline Lanes broadcast(real_T value) {
+  return {_mm256_set1_pd(value)};
+}
+
+inline Lanes gather(const real_T table[], const uint32_T offset[]) {
+  return {_mm256_set_pd(table[offset[3]], table[offset[2]], table[offset[1]], table[offset[0]])};
+}
+
+inline void store(real_T* values, Lanes lanes) {
+  _mm256_storeu_pd(values, lanes.v);
+}
+
+inline Lanes operator+(Lanes a, Lanes b) {
+  return {_mm256_add_pd(a.v, b.v)};
+}
+
+inline Lanes operator-(Lanes a, Lanes b) {
+  return {_mm256_sub_pd(a.v, b.v)};
+}
+
+inline Lanes operator*(Lanes a, Lanes b) {
+  return {_mm256_mul_pd(a.v, b.v)};
+}
+#elif defined(__SSE2__)
+struct Lanes {
+  static constexpr uint32_T WIDTH = 2;
+  __m128d v;
+};
+
+inline Lanes load(const real_T* values) {
+  return {_mm_loadu_pd(values)};
+}
+
+inline Lanes broadcast(real_T value) {
+  return {_mm_set1_pd(value)};
+}
+
+inline Lanes gather(const real_T table[], const uint32_T offset[]) {
+  return {_mm_set_pd(table[offset[1]], table[offset[0]])};
+}
+
+inline void store(real_T* values, Lanes lanes) {
+  _mm_storeu_pd(values, lanes.v);
+}
+
+inline Lanes operator+(Lanes a, Lanes b) {
+  return {_mm_add_pd(a.v, b.v)};
+}
+
+inline Lanes operator-(Lanes a, Lanes b) {
+  return {_mm_sub_pd(a.v, b.v)};
+}
+
+inline Lanes operator*(Lanes a, Lanes b) {
+  return {_mm_mul_pd(a.v, b.v)};
+}
+#else
+struct Lanes {
+  static constexpr uint32_T WIDTH = 1;
+  real_T v;
+};
+
+inline Lanes load(const real_T* values) {
+  return {*values};
+}
+
+inline Lanes broadcast(real_T value) {
+  return {value};
+}
+
+inline Lanes gather(const real_T table[], const uint32_T offset[]) {
+  return {table[offset[0]]};
+}
+
+inline void store(real_T* values, Lanes lanes) {
+  *values = lanes.v;
+}
+
+inline Lanes operator+(Lanes a, Lanes b) {
+  return {a.v + b.v};
+}
+
+inline Lanes operator-(Lanes a, Lanes b) {
+  return {a.v - b.v};
+}
+
+inline Lanes operator*(Lanes a, Lanes b) {
+  return {a.v * b.v};
+}
+#endif
+
+// the interpolations below repeat the operations of the generated kernels in the same order, the first function of
+// each pair runs on vectors and the second one on the remaining points of a chunk
+
+// look1_binlxpw, intrp1d_l_pw
+template <typename T>
+inline T interpolate1(T yL, T yR, T frac) {
+  return (yR - yL) * frac + yL;
+}
+
+// look2_binlxpw, intrp2d_l_pw
+template <typename T>
+inline T interpolate2(T y00, T y10, T y01, T y11, T frac0, T frac1) {
+  T yL_0d0 = y00 + (y10 - y00) * frac0;
+  return (((y11 - y01) * frac0 + y01) - yL_0d0) * frac1 + yL_0d0;
+}
+
+// intrp3d_l_pw
+template <typename T>
+inline T interpolate3(T y000, T y100, T y010, T y110, T y001, T y101, T y011, T y111, T frac0, T frac1, T frac2) {
+  T yL_1d = (y100 - y000) * frac0 + y000;
+  T yL_2d = (((y110 - y010) * frac0 + y010) - yL_1d) * frac1 + yL_1d;
+  yL_1d = (y101 - y001) * frac0 + y001;
+  return (((((y111 - y011) * frac0 + y011) - yL_1d) * frac1 + yL_1d) - yL_2d) * frac2 + yL_2d;
+}
+
+// same result as plook_binx, larger tables start the search from the interval of the previous input
+inline uint32_T prelookupFrom(real_T u, const real_T bp[], uint32_T maxIndex, uint32_T previousIndex, real_T& fraction) {
+  uint32_T index;
+  if (u <= bp[0]) {
+    index = 0;
+    fraction = (u - bp[0]) / (bp[1] - bp[0]);
+  } else if (u < bp[maxIndex]) {
+    if (maxIndex <= COUNT_SEARCH_MAX_INDEX) {
+      // the breakpoints at or below the input are the ones up to the left end of its interval
+      index = 0;
+      for (uint32_T i = 1; i < maxIndex; i++) {
+        index += bp[i] <= u;
+      }
+    } else {
+      index = binsearch_u32d_prevIdx(u, bp, previousIndex, maxIndex);
+    }
+    fraction = (u - bp[index]) / (bp[index + 1] - bp[index]);
+  } else {
+    index = maxIndex - 1;
+    fraction = (u - bp[maxIndex - 1]) / (bp[maxIndex] - bp[maxIndex - 1]);
+  }
+  return index;
+}
+
+inline uint32_T chunkSize(uint32_T count, uint32_T start) {
+  return count - start < CHUNK_SIZE ? count - start : CHUNK_SIZE;
+}
+}  // namespace
+
+namespace LookupBatch {
+Prelookup prelookup(real_T u, const real_T bp[], uint32_T maxIndex) {
+  Prelookup result;
+  result.index = prelookupFrom(u, bp, maxIndex, maxIndex >> 1, result.fraction);
+  return result;
+}
+
+void prelookup(const real_T u[], uint32_T count, const real_T bp[], uint32_T maxIndex, uint32_T index[], real_T fraction[]) {
+  uint32_T previousIndex = maxIndex >> 1;
+  for (uint32_T i = 0; i < count; i++) {
+    previousIndex = prelookupFrom(u[i], bp, maxIndex, previousIndex, fraction[i]);
+    index[i] = previousIndex;
+  }
+}
+
+void look1(const real_T u0[], uint32_T count, const real_T bp0[], const real_T table[], uint32_T maxIndex, real_T y[]) {
+  uint32_T index[CHUNK_SIZE];
+  real_T fraction[CHUNK_SIZE];
+  for (uint32_T start = 0; start < count; start += CHUNK_SIZE) {
+    uint32_T size = chunkSize(count, start);
+    prelookup(&u0[start], size, bp0, maxIndex, index, fraction);
+
+    uint32_T i = 0;
+    for (; i + Lanes::WIDTH <= size; i += Lanes::WIDTH) {
+      store(&y[start + i], interpolate1(gather(table, &index[i]), gather(table + 1, &index[i]), load(&fraction[i])));
+    }
+    for (; i < size; i++) {
+      y[start + i] = interpolate1(table[index[i]], table[index[i] + 1], fraction[i]);
+    }
+  }
+}
+
+void look2(const real_T u0[],
+           const real_T u1[],
+           uint32_T count,
+           const real_T bp0[],
+           const real_T bp1[],
+           const real_T table[],
+           const uint32_T maxIndex[],
+           uint32_T stride,
+           real_T y[]) {
+  uint32_T index0[CHUNK_SIZE];
+  uint32_T index1[CHUNK_SIZE];
+  real_T fraction0[CHUNK_SIZE];
+  real_T fraction1[CHUNK_SIZE];
+  for (uint32_T start = 0; start < count; start += CHUNK_SIZE) {
+    uint32_T size = chunkSize(count, start);
+    prelookup(&u0[start], size, bp0, maxIndex[0], index0, fraction0);
+    prelookup(&u1[start], size, bp1, maxIndex[1], index1, fraction1);
+    // offsets of the lower corners
+    for (uint32_T i = 0; i < size; i++) {
+      index0[i] += index1[i] * stride;
+    }
+
+    const real_T* row1 = table + stride;
+    uint32_T i = 0;
+    for (; i + Lanes::WIDTH <= size; i += Lanes::WIDTH) {
+      store(&y[start + i], interpolate2(gather(table, &index0[i]), gather(table + 1, &index0[i]), gather(row1, &index0[i]),
+                                        gather(row1 + 1, &index0[i]), load(&fraction0[i]), load(&fraction1[i])));
+    }
+    for (; i < size; i++) {
+      uint32_T offset = index0[i];
+      y[start + i] = interpolate2(table[offset], table[offset + 1], row1[offset], row1[offset + 1], fraction0[i], fraction1[i]);
+    }
+  }
+}
+
+void look2(const real_T u0[],
+           const Prelookup& u1,
+           uint32_T count,
+           const real_T bp0[],
+           const real_T table[],
+           uint32_T maxIndex0,
+           uint32_T stride,
+           real_T y[]) {
+  uint32_T index[CHUNK_SIZE];
+  real_T fraction[CHUNK_SIZE];
+  // the rows of the shared second dimension
+  const real_T* row0 = table + u1.index * stride;
+  const real_T* row1 = row0 + stride;
+  Lanes fraction1 = broadcast(u1.fraction);
+  for (uint32_T start = 0; start < count; start += CHUNK_SIZE) {
+    uint32_T size = chunkSize(count, start);
+    prelookup(&u0[start], size, bp0, maxIndex0, index, fraction);
+
+    uint32_T i = 0;
+    for (; i + Lanes::WIDTH <= size; i += Lanes::WIDTH) {
+      store(&y[start + i], interpolate2(gather(row0, &index[i]), gather(row0 + 1, &index[i]), gather(row1, &index[i]),
+                                        gather(row1 + 1, &index[i]), load(&fraction[i]), fraction1));
+    }
+    for (; i < size; i++) {
+      uint32_T offset = index[i];
+      y[start + i] = interpolate2(row0[offset], row0[offset + 1], row1[offset], row1[offset + 1], fraction[i], u1.fraction);
+    }
+  }
+}
+
+void intrp3d(const real_T u0[],
+             const Prelookup& u1,
+             const Prelookup& u2,
+             uint32_T count,
+             const real_T bp0[],
+             uint32_T maxIndex0,
+             const real_T table[],
+             const uint32_T stride[],
+             real_T y[]) {
+  // u1 and u2 select the shared rows once for the whole batch, the rows of u1 must be inside of the second dimension
+  assert(stride[1] > 0 && u1.index + 1 < stride[2] / stride[1]);
+
+  uint32_T index[CHUNK_SIZE];
+  real_T fraction[CHUNK_SIZE];
+  // the four rows of the shared second and third dimensions
+  const real_T* row00 = table + (u2.index * stride[2] + u1.index * stride[1]);
+  const real_T* row10 = row00 + stride[1];
+  const real_T* row01 = row00 + stride[2];
+  const real_T* row11 = row01 + stride[1];
+  Lanes fraction1 = broadcast(u1.fraction);
+  Lanes fraction2 = broadcast(u2.fraction);
+  for (uint32_T start = 0; start < count; start += CHUNK_SIZE) {
+    uint32_T size = chunkSize(count, start);
+    prelookup(&u0[start], size, bp0, maxIndex0, index, fraction);
+
+    uint32_T i = 0;
+    for (; i + Lanes::WIDTH <= size; i += Lanes::WIDTH) {
+      const uint32_T* offset = &index[i];
+      store(&y[start + i],
+            interpolate3(gather(row00, offset), gather(row00 + 1, offset), gather(row10, offset), gather(row10 + 1, offset),
+                         gather(row01, offset), gather(row01 + 1, offset), gather(row11, offset), gather(row11 + 1, offset),
+                         load(&fraction[i]), fraction1, fraction2));
+    }
+    for (; i < size; i++) {
+      uint32_T offset = index[i];
+      y[start + i] = interpolate3(row00[offset], row00[offset + 1], row10[offset], row10[offset + 1], row01[offset], row01[offset + 1],
+                                  row11[offset], row11[offset + 1], fraction[i], u1.fraction, u2.fraction);
+    }
+  }
+}
+}  // namespace LookupBatch
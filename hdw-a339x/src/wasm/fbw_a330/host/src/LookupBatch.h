@@ -0,0 +1,76 @@
+#pragma once
+
+#include "rtwtypes.h"
+
+/**
+ * @brief Batched evaluation of the lookup kernels of the generated models.
+ *
+ * Meant for offline work that evaluates the same table for many inputs, like envelope sweeps, characteristic speeds or
+ * plots of the laws, so it is only part of the host build and not linked into the module. The results are bit
+ * identical to the scalar kernels (look1_binlxpw, look2_binlxpw, intrp3d_l_pw).
+ *
+ * Small tables find the interval of an input by counting the breakpoints below it, without branches to mispredict on
+ * unordered inputs. The search of larger tables starts from the interval of the previous input of the batch, so
+ * ordered sweeps find their interval in constant time. Dimensions that are constant over a batch are looked up once
+ * and shared by all points. The interpolation runs on AVX or SSE2 when the compiler targets them (AVX needs
+ * FBW_HOST_AVX) and falls back to scalar code otherwise.
+ */
+namespace LookupBatch {
+/**
+ * @brief Breakpoint index and fraction of an input, as computed by plook_binx.
+ */
+struct Prelookup {
+  uint32_T index;
+  real_T fraction;
+};
+
+Prelookup prelookup(real_T u, const real_T bp[], uint32_T maxIndex);
+
+void prelookup(const real_T u[], uint32_T count, const real_T bp[], uint32_T maxIndex, uint32_T index[], real_T fraction[]);
+
+/**
+ * @brief y[i] = look1_binlxpw(u0[i], bp0, table, maxIndex)
+ */
+void look1(const real_T u0[], uint32_T count, const real_T bp0[], const real_T table[], uint32_T maxIndex, real_T y[]);
+
+/**
+ * @brief y[i] = look2_binlxpw(u0[i], u1[i], bp0, bp1, table, maxIndex, stride)
+ */
+void look2(const real_T u0[],
+           const real_T u1[],
+           uint32_T count,
+           const real_T bp0[],
+           const real_T bp1[],
+           const real_T table[],
+           const uint32_T maxIndex[],
+           uint32_T stride,
+           real_T y[]);
+
+/**
+ * @brief y[i] = look2_binlxpw(u0[i], u1, bp0, bp1, table, maxIndex, stride), with u1 constant over the batch.
+ */
+void look2(const real_T u0[],
+           const Prelookup& u1,
+           uint32_T count,
+           const real_T bp0[],
+           const real_T table[],
+           uint32_T maxIndex0,
+           uint32_T stride,
+           real_T y[]);
+
+/**
+ * @brief y[i] = intrp3d_l_pw of the prelookup of u0[i] in the first dimension and of u1 and u2 in the other dimensions.
+ * @note u1 and u2 must be constant over the batch: the four rows they select are shared by all points, so points with
+ * other inputs in the second or third dimension need a call of their own. Debug builds assert that u1 selects rows
+ * inside of the table.
+ */
+void intrp3d(const real_T u0[],
+             const Prelookup& u1,
+             const Prelookup& u2,
+             uint32_T count,
+             const real_T bp0[],
+             uint32_T maxIndex0,
+             const real_T table[],
+             const uint32_T stride[],
+             real_T y[]);
+}  // namespace LookupBatch
@@ -0,0 +1,186 @@
+// Throughput of the scalar lookup kernels of the generated models against the batched evaluation of LookupBatch.
+//
+// Every kernel is evaluated for the same inputs once per point with the scalar kernel and once with the batch API, on an
+// ordered sweep like the ones of envelope and characteristic speed tables and on random inputs. The tables have the
+// shapes of the FAC tables. The results of both are compared bit by bit, the run fails on the first difference.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "LookupBatch.h"
+#include "intrp3d_l_pw.h"
+#include "look1_binlxpw.h"
+#include "look2_binlxpw.h"
+#include "plook_binx.h"
+
+namespace {
+struct Options {
+  std::size_t points = 1000000;
+  int repeat = 5;
+};
+
+void printUsage(const char* name) {
+  std::cout << "Usage: " << name << " [--points <points>] [--repeat <runs>]" << std::endl;
+  std::cout << "  --points <points>  inputs per kernel and input pattern (default: 1000000)" << std::endl;
+  std::cout << "  --repeat <runs>    runs per measurement, the fastest is reported (default: 5)" << std::endl;
+}
+
+bool parseOptions(int argc, char** argv, Options& options) {
+  for (int i = 1; i < argc; i++) {
+    std::string argument = argv[i];
+    bool hasValue = i + 1 < argc;
+    if (argument == "--points" && hasValue) {
+      options.points = std::strtoul(argv[++i], nullptr, 10);
+    } else if (argument == "--repeat" && hasValue) {
+      options.repeat = std::atoi(argv[++i]);
+    } else {
+      return false;
+    }
+  }
+  return options.points > 0 && options.repeat > 0;
+}
+
+// fastest of the runs in ns per point
+double measure(const Options& options, const std::function<void()>& run) {
+  double best = 0;
+  for (int i = 0; i < options.repeat; i++) {
+    auto start = std::chrono::steady_clock::now();
+    run();
+    auto end = std::chrono::steady_clock::now();
+    double time = std::chrono::duration<double, std::nano>(end - start).count() / static_cast<double>(options.points);
+    best = i == 0 ? time : std::min(best, time);
+  }
+  return best;
+}
+
+struct Table {
+  std::vector<real_T> bp0;
+  std::vector<real_T> bp1;
+  std::vector<real_T> bp2;
+  std::vector<real_T> values;
+};
+
+Table makeTable(std::mt19937_64& random) {
+  Table table;
+  // weight, altitude and configuration breakpoints of the FAC characteristic speeds
+  table.bp0 = {300000, 335000, 415000, 445000, 495000, 535000};
+  table.bp1 = {290, 310, 330, 350, 370, 390, 410, 415};
+  table.bp2 = {1, 1.3, 1.5};
+  std::uniform_real_distribution<real_T> value(100, 300);
+  table.values.resize(table.bp0.size() * table.bp1.size() * table.bp2.size());
+  for (auto& v : table.values) {
+    v = value(random);
+  }
+  return table;
+}
+
+// inputs beyond both ends, so the extrapolation is part of the measurement
+std::vector<real_T> makeInputs(const std::vector<real_T>& bp, std::size_t points, bool ordered, std::mt19937_64& random) {
+  real_T margin = 0.1 * (bp.back() - bp.front());
+  real_T lo = bp.front() - margin;
+  real_T hi = bp.back() + margin;
+  std::vector<real_T> inputs(points);
+  std::uniform_real_distribution<real_T> distribution(lo, hi);
+  for (std::size_t i = 0; i < points; i++) {
+    inputs[i] = ordered ? lo + (hi - lo) * static_cast<real_T>(i) / static_cast<real_T>(points) : distribution(random);
+  }
+  return inputs;
+}
+
+bool report(const std::string& name, double scalar, double batch, const std::vector<real_T>& expected, const std::vector<real_T>& y) {
+  bool identical = std::memcmp(expected.data(), y.data(), expected.size() * sizeof(real_T)) == 0;
+  std::cout << std::fixed << std::setprecision(2) << "HOST: " << std::left << std::setw(16) << name << std::right
+            << ": scalar = " << scalar << " ns/point, batch = " << batch << " ns/point, speed-up = " << scalar / batch
+            << (identical ? "" : ", RESULTS DIFFER") << std::endl;
+  return identical;
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+  Options options;
+  if (!parseOptions(argc, argv, options)) {
+    printUsage(argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  std::mt19937_64 random(1);
+  Table table = makeTable(random);
+  auto maxIndex0 = static_cast<uint32_T>(table.bp0.size() - 1);
+  auto maxIndex1 = static_cast<uint32_T>(table.bp1.size() - 1);
+  auto maxIndex2 = static_cast<uint32_T>(table.bp2.size() - 1);
+  const uint32_T maxIndex[2] = {maxIndex0, maxIndex1};
+  const uint32_T stride[3] = {1, static_cast<uint32_T>(table.bp0.size()), static_cast<uint32_T>(table.bp0.size() * table.bp1.size())};
+  const real_T u1 = 352.5;
+  const real_T u2 = 1.4;
+  auto count = static_cast<uint32_T>(options.points);
+
+  std::vector<real_T> expected(options.points);
+  std::vector<real_T> y(options.points);
+  bool identical = true;
+
+  for (bool ordered : {true, false}) {
+    std::string pattern = ordered ? " sweep" : " random";
+    std::vector<real_T> u0 = makeInputs(table.bp0, options.points, ordered, random);
+    std::vector<real_T> u1s = makeInputs(table.bp1, options.points, ordered, random);
+
+    double scalar = measure(options, [&] {
+      for (std::size_t i = 0; i < options.points; i++) {
+        expected[i] = look1_binlxpw(u0[i], table.bp0.data(), table.values.data(), maxIndex0);
+      }
+    });
+    double batch = measure(options, [&] {
+      LookupBatch::look1(u0.data(), count, table.bp0.data(), table.values.data(), maxIndex0, y.data());
+    });
+    identical &= report("look1" + pattern, scalar, batch, expected, y);
+
+    scalar = measure(options, [&] {
+      for (std::size_t i = 0; i < options.points; i++) {
+        expected[i] = look2_binlxpw(u0[i], u1s[i], table.bp0.data(), table.bp1.data(), table.values.data(), maxIndex, stride[1]);
+      }
+    });
+    batch = measure(options, [&] {
+      LookupBatch::look2(u0.data(), u1s.data(), count, table.bp0.data(), table.bp1.data(), table.values.data(), maxIndex,
+                         stride[1], y.data());
+    });
+    identical &= report("look2" + pattern, scalar, batch, expected, y);
+
+    scalar = measure(options, [&] {
+      for (std::size_t i = 0; i < options.points; i++) {
+        expected[i] = look2_binlxpw(u0[i], u1, table.bp0.data(), table.bp1.data(), table.values.data(), maxIndex, stride[1]);
+      }
+    });
+    batch = measure(options, [&] {
+      LookupBatch::look2(u0.data(), LookupBatch::prelookup(u1, table.bp1.data(), maxIndex1), count, table.bp0.data(),
+                         table.values.data(), maxIndex0, stride[1], y.data());
+    });
+    identical &= report("look2 1-D" + pattern, scalar, batch, expected, y);
+
+    scalar = measure(options, [&] {
+      for (std::size_t i = 0; i < options.points; i++) {
+        uint32_T bpIndex[3];
+        real_T fraction[3];
+        bpIndex[0] = plook_binx(u0[i], table.bp0.data(), maxIndex0, &fraction[0]);
+        bpIndex[1] = plook_binx(u1, table.bp1.data(), maxIndex1, &fraction[1]);
+        bpIndex[2] = plook_binx(u2, table.bp2.data(), maxIndex2, &fraction[2]);
+        expected[i] = intrp3d_l_pw(bpIndex, fraction, table.values.data(), stride);
+      }
+    });
+    batch = measure(options, [&] {
+      LookupBatch::intrp3d(u0.data(), LookupBatch::prelookup(u1, table.bp1.data(), maxIndex1),
+                           LookupBatch::prelookup(u2, table.bp2.data(), maxIndex2), count, table.bp0.data(), maxIndex0,
+                           table.values.data(), stride, y.data());
+    });
+    identical &= report("intrp3d 1-D" + pattern, scalar, batch, expected, y);
+  }
+
+  return identical ? EXIT_SUCCESS : EXIT_FAILURE;
+}
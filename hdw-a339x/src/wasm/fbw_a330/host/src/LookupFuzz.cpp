@@ -0,0 +1,279 @@
+// Differential fuzzing of the lookup kernels that replaced the generated ones against the generated kernels.
+//
+// The kernels that start the search from the interval of the previous step (binsearch_u32d_prevIdx, plook_binxp,
+// look1_pbinlxpw, look2_pbinlxpw) and the kernels that compute the interval of evenly spaced breakpoints (plook_evenx,
+// look1_evenlxpw) are evaluated on random tables next to the binary search kernels they replaced (binsearch_u32d,
+// plook_binx, look1_binlxpw, look2_binlxpw). The inputs walk slowly, jump across and beyond the table, hit the
+// breakpoints exactly or by one ulp and include ±inf, NaN and -0. Some tables repeat breakpoints, the evenly spaced
+// tables are also evaluated with wrong bpSpaceInv hints. Indices and results are compared bit by bit, the run fails on
+// any difference.
+
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "binsearch_u32d.h"
+#include "binsearch_u32d_prevIdx.h"
+#include "look1_binlxpw.h"
+#include "look1_evenlxpw.h"
+#include "look1_pbinlxpw.h"
+#include "look2_binlxpw.h"
+#include "look2_pbinlxpw.h"
+#include "plook_binx.h"
+#include "plook_binxp.h"
+#include "plook_evenx.h"
+
+namespace {
+struct Options {
+  int tables = 20000;
+  int points = 500;
+  std::uint64_t seed = 1;
+};
+
+void printUsage(const char* name) {
+  std::cout << "Usage: " << name << " [--tables <tables>] [--points <points>] [--seed <seed>]" << std::endl;
+  std::cout << "  --tables <tables>  random tables per kernel family (default: 20000)" << std::endl;
+  std::cout << "  --points <points>  inputs per table (default: 500)" << std::endl;
+  std::cout << "  --seed <seed>      seed of the random tables and inputs (default: 1)" << std::endl;
+}
+
+bool parseOptions(int argc, char** argv, Options& options) {
+  for (int i = 1; i < argc; i++) {
+    std::string argument = argv[i];
+    bool hasValue = i + 1 < argc;
+    if (argument == "--tables" && hasValue) {
+      options.tables = std::atoi(argv[++i]);
+    } else if (argument == "--points" && hasValue) {
+      options.points = std::atoi(argv[++i]);
+    } else if (argument == "--seed" && hasValue) {
+      options.seed = std::strtoull(argv[++i], nullptr, 10);
+    } else {
+      return false;
+    }
+  }
+  return options.tables > 0 && options.points > 0;
+}
+
+bool identical(real_T a, real_T b) {
+  return std::memcmp(&a, &b, sizeof(real_T)) == 0;
+}
+
+struct Kernel {
+  std::string name;
+  std::uint64_t checks = 0;
+  std::uint64_t mismatches = 0;
+
+  // the first mismatch of a kernel is printed with the inputs described by details()
+  template <typename Details>
+  void check(bool match, const Details& details) {
+    checks++;
+    if (!match && mismatches++ == 0) {
+      std::cout << "HOST: " << name << ": mismatch at " << details() << std::endl;
+    }
+  }
+
+  bool report() const {
+    std::cout << "HOST: " << std::left << std::setw(25) << name << std::right << ": checks = " << checks
+              << ", mismatches = " << mismatches << std::endl;
+    return mismatches == 0;
+  }
+};
+
+std::string describe(real_T u, const std::vector<real_T>& bp) {
+  std::ostringstream stream;
+  stream << std::setprecision(17) << "u = " << u << ", bp = {";
+  for (std::size_t i = 0; i < bp.size(); i++) {
+    stream << (i > 0 ? ", " : "") << bp[i];
+  }
+  stream << "}";
+  return stream.str();
+}
+
+std::uniform_real_distribution<real_T> unit(0.0, 1.0);
+
+// strictly increasing breakpoints, interior breakpoints are repeated when requested, the first and the last interval
+// always have a width as the extrapolation divides by it
+std::vector<real_T> makeBreakpoints(std::mt19937_64& random, bool repeated) {
+  std::size_t count = 2 + random() % 13;
+  std::vector<real_T> bp(count);
+  real_T x = unit(random) * 200 - 100;
+  for (std::size_t i = 0; i < count; i++) {
+    bp[i] = x;
+    bool repeat = repeated && i > 0 && i + 2 < count && unit(random) < 0.3;
+    x += repeat ? 0.0 : unit(random) * 50 + 1e-9;
+  }
+  return bp;
+}
+
+const real_T specialInputs[] = {std::numeric_limits<real_T>::quiet_NaN(), std::numeric_limits<real_T>::infinity(),
+                                -std::numeric_limits<real_T>::infinity(), -0.0, 0.0};
+
+// the next input of a sequence: a slow walk from the previous input, a jump across and beyond the table, a breakpoint
+// or its neighbours at one ulp, or a special value
+real_T nextInput(std::mt19937_64& random, const std::vector<real_T>& bp, real_T previous) {
+  real_T span = bp.back() - bp.front();
+  real_T r = unit(random);
+  if (r < 0.5) {
+    real_T start = std::isfinite(previous) ? previous : bp.front();
+    return start + (unit(random) - 0.5) * 0.1 * span;
+  }
+  if (r < 0.7) {
+    return bp.front() + (unit(random) * 3 - 1) * span;
+  }
+  if (r < 0.95) {
+    real_T breakpoint = bp[random() % bp.size()];
+    switch (random() % 3) {
+      case 0:
+        return breakpoint;
+      case 1:
+        return std::nextafter(breakpoint, -std::numeric_limits<real_T>::infinity());
+      default:
+        return std::nextafter(breakpoint, std::numeric_limits<real_T>::infinity());
+    }
+  }
+  return specialInputs[random() % std::size(specialInputs)];
+}
+
+std::vector<real_T> makeValues(std::mt19937_64& random, std::size_t count) {
+  std::vector<real_T> values(count);
+  for (auto& value : values) {
+    value = unit(random) * 100 - 50;
+  }
+  return values;
+}
+
+// kernels searching from the interval of the previous step
+bool fuzzPreviousIndex(const Options& options, std::mt19937_64& random) {
+  Kernel binsearch{"binsearch_u32d_prevIdx"};
+  Kernel plook{"plook_binxp"};
+  Kernel look1{"look1_pbinlxpw"};
+  Kernel look2{"look2_pbinlxpw"};
+
+  for (int t = 0; t < options.tables; t++) {
+    bool repeated = t % 3 == 0;
+    std::vector<real_T> bp0 = makeBreakpoints(random, repeated);
+    std::vector<real_T> bp1 = makeBreakpoints(random, repeated);
+    std::vector<real_T> table = makeValues(random, bp0.size() * bp1.size());
+    const uint32_T maxIndex[2] = {static_cast<uint32_T>(bp0.size() - 1), static_cast<uint32_T>(bp1.size() - 1)};
+    const auto stride = static_cast<uint32_T>(bp0.size());
+
+    uint32_T plookIndex = 0;
+    uint32_T look1Index = 0;
+    uint32_T look2Index[2] = {0, 0};
+    real_T u0 = bp0.front();
+    real_T u1 = bp1.front();
+
+    for (int k = 0; k < options.points; k++) {
+      u0 = nextInput(random, bp0, u0);
+      u1 = nextInput(random, bp1, u1);
+
+      // the kernels only search inputs inside of the table, from any interval of it
+      if (u0 > bp0.front() && u0 < bp0.back()) {
+        auto startIndex = static_cast<uint32_T>(random() % maxIndex[0]);
+        uint32_T expected = binsearch_u32d(u0, bp0.data(), maxIndex[0] >> 1U, maxIndex[0]);
+        uint32_T actual = binsearch_u32d_prevIdx(u0, bp0.data(), startIndex, maxIndex[0]);
+        binsearch.check(expected == actual,
+                        [&] { return describe(u0, bp0) + ", startIndex = " + std::to_string(startIndex); });
+      }
+
+      real_T expectedFraction;
+      real_T actualFraction;
+      uint32_T expectedIndex = plook_binx(u0, bp0.data(), maxIndex[0], &expectedFraction);
+      uint32_T actualIndex = plook_binxp(u0, bp0.data(), maxIndex[0], &actualFraction, &plookIndex);
+      bool match = expectedIndex == actualIndex && identical(expectedFraction, actualFraction);
+      plook.check(match && plookIndex == actualIndex, [&] { return describe(u0, bp0); });
+
+      real_T expected = look1_binlxpw(u0, bp0.data(), table.data(), maxIndex[0]);
+      real_T actual = look1_pbinlxpw(u0, bp0.data(), table.data(), &look1Index, maxIndex[0]);
+      look1.check(identical(expected, actual), [&] { return describe(u0, bp0); });
+
+      expected = look2_binlxpw(u0, u1, bp0.data(), bp1.data(), table.data(), maxIndex, stride);
+      actual = look2_pbinlxpw(u0, u1, bp0.data(), bp1.data(), table.data(), look2Index, maxIndex, stride);
+      look2.check(identical(expected, actual), [&] { return describe(u0, bp0) + ", " + describe(u1, bp1); });
+    }
+  }
+
+  bool passed = binsearch.report();
+  passed &= plook.report();
+  passed &= look1.report();
+  passed &= look2.report();
+  return passed;
+}
+
+// kernels computing the interval of evenly spaced breakpoints
+bool fuzzEvenlySpaced(const Options& options, std::mt19937_64& random) {
+  Kernel plook{"plook_evenx"};
+  Kernel look1{"look1_evenlxpw"};
+  Kernel plookHint{"plook_evenx wrong hint"};
+  Kernel look1Hint{"look1_evenlxpw wrong hint"};
+
+  // spacings of the model tables and ones that are not representable exactly
+  const real_T spacings[] = {1.0, 50.0, 0.1, 0.05, 1.0 / 3.0, 2.5, 1e-3, 1000.0};
+
+  for (int t = 0; t < options.tables; t++) {
+    std::size_t count = 2 + random() % 14;
+    real_T spacing = spacings[random() % std::size(spacings)];
+    real_T first = std::round(unit(random) * 20 - 10) * spacing;
+    std::vector<real_T> bp(count);
+    for (std::size_t i = 0; i < count; i++) {
+      bp[i] = first + static_cast<real_T>(i) * spacing;
+    }
+    std::vector<real_T> table = makeValues(random, count);
+    const auto maxIndex = static_cast<uint32_T>(count - 1);
+
+    // a wrong hint only costs steps of the correction of the index, the result must not change
+    real_T wrongHint = (1.0 / spacing) * (random() % 2 == 0 ? 0.5 + unit(random) : 1.0 + 10 * unit(random));
+
+    real_T u = bp.front();
+    for (int k = 0; k < options.points; k++) {
+      u = nextInput(random, bp, u);
+      auto details = [&] { return describe(u, bp); };
+      auto hintDetails = [&] { return describe(u, bp) + ", bpSpaceInv = " + std::to_string(wrongHint); };
+
+      real_T expectedFraction;
+      real_T actualFraction;
+      uint32_T expectedIndex = plook_binx(u, bp.data(), maxIndex, &expectedFraction);
+      real_T expected = look1_binlxpw(u, bp.data(), table.data(), maxIndex);
+
+      uint32_T actualIndex = plook_evenx(u, bp.data(), 1.0 / spacing, maxIndex, &actualFraction);
+      plook.check(expectedIndex == actualIndex && identical(expectedFraction, actualFraction), details);
+      real_T actual = look1_evenlxpw(u, bp.data(), table.data(), 1.0 / spacing, maxIndex);
+      look1.check(identical(expected, actual), details);
+
+      actualIndex = plook_evenx(u, bp.data(), wrongHint, maxIndex, &actualFraction);
+      plookHint.check(expectedIndex == actualIndex && identical(expectedFraction, actualFraction), hintDetails);
+      actual = look1_evenlxpw(u, bp.data(), table.data(), wrongHint, maxIndex);
+      look1Hint.check(identical(expected, actual), hintDetails);
+    }
+  }
+
+  bool passed = plook.report();
+  passed &= look1.report();
+  passed &= plookHint.report();
+  passed &= look1Hint.report();
+  return passed;
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+  Options options;
+  if (!parseOptions(argc, argv, options)) {
+    printUsage(argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  std::mt19937_64 random(options.seed);
+  bool passed = fuzzPreviousIndex(options, random);
+  passed &= fuzzEvenlySpaced(options, random);
+
+  return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
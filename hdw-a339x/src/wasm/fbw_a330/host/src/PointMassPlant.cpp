@@ -0,0 +1,584 @@
+#include "PointMassPlant.h"
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+
+#include "Arinc429.h"
+#include "Arinc429Utils.h"
+#include "HostGauge.h"
+
+namespace {
+constexpr double PI = 3.14159265358979323846;
+constexpr double DEG_TO_RAD = PI / 180.0;
+constexpr double RAD_TO_DEG = 180.0 / PI;
+constexpr double FEET_TO_METERS = 0.3048;
+constexpr double KNOTS_TO_METERS_PER_SECOND = 1852.0 / 3600.0;
+constexpr double EARTH_RADIUS = 6371000.0;
+
+// international standard atmosphere
+constexpr double GRAVITY = 9.80665;
+constexpr double GAS_CONSTANT = 287.053;
+constexpr double SEA_LEVEL_TEMPERATURE = 288.15;
+constexpr double SEA_LEVEL_PRESSURE = 101325.0;
+constexpr double SEA_LEVEL_SPEED_OF_SOUND = 340.294;
+constexpr double TEMPERATURE_LAPSE_RATE = 0.0065;
+constexpr double TROPOPAUSE_ALTITUDE = 11000.0;
+constexpr double TROPOPAUSE_TEMPERATURE = 216.65;
+constexpr double TROPOPAUSE_PRESSURE = 22632.06;
+
+// geometry and inertia
+constexpr double WING_AREA = 361.6;
+constexpr double MEAN_AERODYNAMIC_CHORD = 7.26;
+constexpr double WING_SPAN = 60.3;
+constexpr double INERTIA_ROLL = 1.9e7;
+constexpr double INERTIA_PITCH = 3.0e7;
+constexpr double INERTIA_YAW = 4.8e7;
+
+// lift, drag and side force, per rad
+constexpr double CL_0 = 0.25;
+constexpr double CL_ALPHA = 5.5;
+constexpr double CL_ELEVATOR = 0.3;
+constexpr double CL_THS = 0.6;
+constexpr double CD_0 = 0.018;
+constexpr double CD_INDUCED = 0.045;
+constexpr double CD_SPOILERS = 0.05;
+constexpr double CY_BETA = -0.9;
+constexpr double CY_RUDDER = 0.15;
+
+// moments, per rad and per rad of the normalized rates
+constexpr double CM_0 = 0.05;
+constexpr double CM_ALPHA = -1.2;
+constexpr double CM_Q = -25.0;
+constexpr double CM_ELEVATOR = -1.4;
+constexpr double CM_THS = -2.8;
+constexpr double CL_BETA = -0.1;
+constexpr double CL_P = -0.45;
+constexpr double CL_R = 0.1;
+constexpr double CL_AILERON = 0.12;
+constexpr double CL_SPOILERS = 0.15;
+constexpr double CN_BETA = 0.12;
+constexpr double CN_R = -0.15;
+constexpr double CN_RUDDER = -0.09;
+
+// the orders are limited to the mechanical travel of the surfaces
+constexpr double ELEVATOR_LIMIT = 30.0;
+constexpr double AILERON_LIMIT = 25.0;
+constexpr double SPOILER_LIMIT = 50.0;
+constexpr double SPOILER_RATE = 60.0;
+
+// the engines hold the trim airspeed like the autothrust would, with a first order lag
+constexpr double THRUST_SPEED_GAIN = 5.0;
+constexpr double THRUST_TIME_CONSTANT = 3.0;
+
+constexpr double HYDRAULIC_PRESSURE = 3000.0;
+constexpr double RADIO_ALTIMETER_RANGE = 8192.0;
+
+const char* const ADIRS_VARIABLE_NAMES[] = {
+    "ADR_{}_ALTITUDE",
+    "ADR_{}_BARO_CORRECTED_ALTITUDE_1",
+    "ADR_{}_MACH",
+    "ADR_{}_COMPUTED_AIRSPEED",
+    "ADR_{}_TRUE_AIRSPEED",
+    "ADR_{}_BAROMETRIC_VERTICAL_SPEED",
+    "ADR_{}_ANGLE_OF_ATTACK",
+    "ADR_{}_CORRECTED_AVERAGE_STATIC_PRESSURE",
+    "IR_{}_LATITUDE",
+    "IR_{}_LONGITUDE",
+    "IR_{}_GROUND_SPEED",
+    "IR_{}_WIND_SPEED",
+    "IR_{}_WIND_DIRECTION",
+    "IR_{}_TRACK",
+    "IR_{}_TRUE_TRACK",
+    "IR_{}_HEADING",
+    "IR_{}_TRUE_HEADING",
+    "IR_{}_DRIFT_ANGLE",
+    "IR_{}_FLIGHT_PATH_ANGLE",
+    "IR_{}_PITCH",
+    "IR_{}_ROLL",
+    "IR_{}_BODY_PITCH_RATE",
+    "IR_{}_BODY_ROLL_RATE",
+    "IR_{}_BODY_YAW_RATE",
+    "IR_{}_BODY_LONGITUDINAL_ACC",
+    "IR_{}_BODY_LATERAL_ACC",
+    "IR_{}_BODY_NORMAL_ACC",
+    "IR_{}_HEADING_RATE",
+    "IR_{}_PITCH_ATT_RATE",
+    "IR_{}_ROLL_ATT_RATE",
+    "IR_{}_VERTICAL_SPEED",
+};
+
+double toArinc429(double value, Arinc429SignStatus ssm = NormalOperation) {
+  base_arinc_429 word;
+  word.SSM = ssm;
+  word.Data = static_cast<float>(value);
+  return Arinc429Utils::toSimVar(word);
+}
+
+// subsonic, from the impact pressure
+double computeCalibratedAirspeed(double mach, double pressure) {
+  double impactPressure = pressure * (std::pow(1.0 + 0.2 * mach * mach, 3.5) - 1.0);
+  return SEA_LEVEL_SPEED_OF_SOUND * std::sqrt(5.0 * (std::pow(impactPressure / SEA_LEVEL_PRESSURE + 1.0, 2.0 / 7.0) - 1.0));
+}
+
+double wrapHeading(double heading) {
+  heading = std::fmod(heading, 360.0);
+  return heading < 0.0 ? heading + 360.0 : heading;
+}
+
+void moveActuator(double& position, double order, double rate, double dt) {
+  position += std::clamp(order - position, -rate * dt, rate * dt);
+}
+
+// the order of the first servo in active mode, the surface keeps its position when no servo is active
+double activeOrder(const ID* active, const ID* order, std::size_t count, bool activeWhenEnergized, double position) {
+  HostGauge& gauge = HostGauge::instance();
+  for (std::size_t i = 0; i < count; i++) {
+    if ((gauge.getNamedVariable(active[i]) != 0.0) == activeWhenEnergized) {
+      return gauge.getNamedVariable(order[i]);
+    }
+  }
+  return position;
+}
+}  // namespace
+
+PointMassPlant::Atmosphere PointMassPlant::computeAtmosphere(double altitude) {
+  Atmosphere atmosphere;
+  if (altitude < TROPOPAUSE_ALTITUDE) {
+    atmosphere.temperature = SEA_LEVEL_TEMPERATURE - TEMPERATURE_LAPSE_RATE * altitude;
+    atmosphere.pressure = SEA_LEVEL_PRESSURE * std::pow(atmosphere.temperature / SEA_LEVEL_TEMPERATURE,
+                                                        GRAVITY / (TEMPERATURE_LAPSE_RATE * GAS_CONSTANT));
+  } else {
+    atmosphere.temperature = TROPOPAUSE_TEMPERATURE;
+    atmosphere.pressure =
+        TROPOPAUSE_PRESSURE * std::exp(-GRAVITY * (altitude - TROPOPAUSE_ALTITUDE) / (GAS_CONSTANT * TROPOPAUSE_TEMPERATURE));
+  }
+  atmosphere.density = atmosphere.pressure / (GAS_CONSTANT * atmosphere.temperature);
+  atmosphere.speedOfSound = std::sqrt(1.4 * GAS_CONSTANT * atmosphere.temperature);
+  return atmosphere;
+}
+
+void PointMassPlant::reset(const SimData& simData) {
+  registerLocalVariables();
+
+  altitude = simData.H_ft * FEET_TO_METERS;
+  latitude = simData.latitude_deg * DEG_TO_RAD;
+  longitude = simData.longitude_deg * DEG_TO_RAD;
+  psi = simData.Psi_true_deg * DEG_TO_RAD;
+  mass = simData.total_weight_kg;
+  phi = 0.0;
+  p = q = r = 0.0;
+  v = 0.0;
+  time = 0.0;
+
+  // solve lift and pitching moment for alpha and THS with the elevator neutral, then thrust for zero acceleration
+  Atmosphere atmosphere = computeAtmosphere(altitude);
+  double airspeed = simData.V_tas_kn * KNOTS_TO_METERS_PER_SECOND;
+  double dynamicPressure = 0.5 * atmosphere.density * airspeed * airspeed;
+  double alpha = 0.0;
+  double thsRad = 0.0;
+  thrust = 0.0;
+  for (int i = 0; i < 3; i++) {
+    double liftCoefficient = (mass * GRAVITY - thrust * std::sin(alpha)) / (dynamicPressure * WING_AREA);
+    alpha = (liftCoefficient - CL_0 + CL_THS * CM_0 / CM_THS) / (CL_ALPHA - CL_THS * CM_ALPHA / CM_THS);
+    thsRad = -(CM_0 + CM_ALPHA * alpha) / CM_THS;
+    double dragCoefficient = CD_0 + CD_INDUCED * liftCoefficient * liftCoefficient;
+    thrust = dynamicPressure * WING_AREA * dragCoefficient / std::cos(alpha);
+  }
+  trimThrust = thrust;
+  trimAirspeed = airspeed;
+
+  theta = alpha;
+  u = airspeed * std::cos(alpha);
+  w = airspeed * std::sin(alpha);
+
+  elevatorLeft.position = elevatorRight.position = 0.0;
+  aileronLeft.position = aileronRight.position = 0.0;
+  ths.position = thsRad * RAD_TO_DEG;
+  yawDamper.position = rudderTrim.position = rudderTravelLimiter.position = 0.0;
+  for (std::size_t i = 0; i < spoilersLeft.size(); i++) {
+    spoilersLeft[i] = {0.0, SPOILER_RATE};
+    spoilersRight[i] = {0.0, SPOILER_RATE};
+  }
+
+  elevatorLeftOrder = elevatorRightOrder = 0.0;
+  aileronLeftOrder = aileronRightOrder = 0.0;
+  thsOrder = -ths.position;
+  yawDamperOrder = rudderTrimOrder = rudderTravelLimiterOrder = 0.0;
+  spoilersLeftOrder.fill(0.0);
+  spoilersRightOrder.fill(0.0);
+
+  computeForcesAndMoments();
+}
+
+void PointMassPlant::registerLocalVariables() {
+  HostGauge& gauge = HostGauge::instance();
+
+  // same names as in FlyByWireInterface::setupLocalVariables()
+  for (int i = 0; i < 2; i++) {
+    std::string aileronStringLeft = i == 0 ? "BLUE" : "GREEN";
+    std::string aileronStringRight = i == 0 ? "GREEN" : "BLUE";
+    std::string elevatorStringLeft = i == 0 ? "BLUE" : "GREEN";
+    std::string elevatorStringRight = i == 0 ? "BLUE" : "YELLOW";
+    std::string yawDamperString = i == 0 ? "GREEN" : "YELLOW";
+    std::string idString = std::to_string(i + 1);
+
+    idLeftAileronSolenoidEnergized[i] = gauge.registerNamedVariable("A32NX_LEFT_AIL_" + aileronStringLeft + "_SERVO_SOLENOID_ENERGIZED");
+    idLeftAileronCommandedPosition[i] = gauge.registerNamedVariable("A32NX_LEFT_AIL_" + aileronStringLeft + "_COMMANDED_POSITION");
+    idRightAileronSolenoidEnergized[i] = gauge.registerNamedVariable("A32NX_RIGHT_AIL_" + aileronStringRight + "_SERVO_SOLENOID_ENERGIZED");
+    idRightAileronCommandedPosition[i] = gauge.registerNamedVariable("A32NX_RIGHT_AIL_" + aileronStringRight + "_COMMANDED_POSITION");
+    idLeftElevatorSolenoidEnergized[i] = gauge.registerNamedVariable("A32NX_LEFT_ELEV_" + elevatorStringLeft + "_SERVO_SOLENOID_ENERGIZED");
+    idLeftElevatorCommandedPosition[i] = gauge.registerNamedVariable("A32NX_LEFT_ELEV_" + elevatorStringLeft + "_COMMANDED_POSITION");
+    idRightElevatorSolenoidEnergized[i] =
+        gauge.registerNamedVariable("A32NX_RIGHT_ELEV_" + elevatorStringRight + "_SERVO_SOLENOID_ENERGIZED");
+    idRightElevatorCommandedPosition[i] = gauge.registerNamedVariable("A32NX_RIGHT_ELEV_" + elevatorStringRight + "_COMMANDED_POSITION");
+
+    idYawDamperSolenoidEnergized[i] = gauge.registerNamedVariable("A32NX_YAW_DAMPER_" + yawDamperString + "_SERVO_SOLENOID_ENERGIZED");
+    idYawDamperCommandedPosition[i] = gauge.registerNamedVariable("A32NX_YAW_DAMPER_" + yawDamperString + "_COMMANDED_POSITION");
+    idRudderTrimActiveModeCommanded[i] = gauge.registerNamedVariable("A32NX_RUDDER_TRIM_" + idString + "_ACTIVE_MODE_COMMANDED");
+    idRudderTrimCommandedPosition[i] = gauge.registerNamedVariable("A32NX_RUDDER_TRIM_" + idString + "_COMMANDED_POSITION");
+    idRudderTravelLimitActiveModeCommanded[i] =
+        gauge.registerNamedVariable("A32NX_RUDDER_TRAVEL_LIM_" + idString + "_ACTIVE_MODE_COMMANDED");
+    idRudderTravelLimCommandedPosition[i] = gauge.registerNamedVariable("A32NX_RUDDER_TRAVEL_LIM_" + idString + "_COMMANDED_POSITION");
+
+    idRadioAltimeterHeight[i] = gauge.registerNamedVariable("A32NX_RA_" + idString + "_RADIO_ALTITUDE");
+  }
+
+  for (int i = 0; i < 3; i++) {
+    std::string idString = std::to_string(i + 1);
+    idTHSActiveModeCommanded[i] = gauge.registerNamedVariable("A32NX_THS_" + idString + "_ACTIVE_MODE_COMMANDED");
+    idTHSCommandedPosition[i] = gauge.registerNamedVariable("A32NX_THS_" + idString + "_COMMANDED_POSITION");
+
+    for (int j = 0; j < ADIRS_VARIABLE_COUNT; j++) {
+      std::string name = ADIRS_VARIABLE_NAMES[j];
+      name.replace(name.find("{}"), 2, idString);
+      idAdirs[i][j] = gauge.registerNamedVariable("A32NX_ADIRS_" + name);
+    }
+  }
+
+  for (int i = 0; i < 5; i++) {
+    std::string idString = std::to_string(i + 1);
+    idLeftSpoilerCommandedPosition[i] = gauge.registerNamedVariable("A32NX_LEFT_SPOILER_" + idString + "_COMMANDED_POSITION");
+    idRightSpoilerCommandedPosition[i] = gauge.registerNamedVariable("A32NX_RIGHT_SPOILER_" + idString + "_COMMANDED_POSITION");
+    idLeftSpoilerPosition[i] = gauge.registerNamedVariable("A32NX_HYD_SPOILER_" + idString + "_LEFT_DEFLECTION");
+    idRightSpoilerPosition[i] = gauge.registerNamedVariable("A32NX_HYD_SPOILER_" + idString + "_RIGHT_DEFLECTION");
+  }
+
+  idLeftAileronPosition = gauge.registerNamedVariable("A32NX_HYD_AILERON_LEFT_DEFLECTION");
+  idRightAileronPosition = gauge.registerNamedVariable("A32NX_HYD_AILERON_RIGHT_DEFLECTION");
+  idLeftElevatorPosition = gauge.registerNamedVariable("A32NX_HYD_ELEVATOR_LEFT_DEFLECTION");
+  idRightElevatorPosition = gauge.registerNamedVariable("A32NX_HYD_ELEVATOR_RIGHT_DEFLECTION");
+  idRudderTrimPosition = gauge.registerNamedVariable("A32NX_HYD_RUDDER_TRIM_FEEDBACK_ANGLE");
+  idRudderTravelLimiterPosition = gauge.registerNamedVariable("A32NX_HYD_RUDDER_LIMITER_FEEDBACK_ANGLE");
+
+  const char* const systems[] = {"GREEN", "BLUE", "YELLOW"};
+  for (int i = 0; i < 3; i++) {
+    idHydraulicPressure[i] = gauge.registerNamedVariable(std::string("A32NX_HYD_") + systems[i] + "_SYSTEM_1_SECTION_PRESSURE");
+    idHydraulicPressurised[i] = gauge.registerNamedVariable(std::string("A32NX_HYD_") + systems[i] + "_SYSTEM_1_SECTION_PRESSURE_SWITCH");
+  }
+}
+
+void PointMassPlant::readSurfaceOrders() {
+  HostGauge& gauge = HostGauge::instance();
+
+  // the elevator servos are in damping mode when the solenoid is energized, all other servos when it is not
+  elevatorLeftOrder = activeOrder(idLeftElevatorSolenoidEnergized.data(), idLeftElevatorCommandedPosition.data(), 2, false,
+                                  elevatorLeft.position);
+  elevatorRightOrder = activeOrder(idRightElevatorSolenoidEnergized.data(), idRightElevatorCommandedPosition.data(), 2, false,
+                                   elevatorRight.position);
+  aileronLeftOrder =
+      activeOrder(idLeftAileronSolenoidEnergized.data(), idLeftAileronCommandedPosition.data(), 2, true, aileronLeft.position);
+  aileronRightOrder =
+      activeOrder(idRightAileronSolenoidEnergized.data(), idRightAileronCommandedPosition.data(), 2, true, aileronRight.position);
+  thsOrder = activeOrder(idTHSActiveModeCommanded.data(), idTHSCommandedPosition.data(), 3, true, -ths.position);
+  yawDamperOrder = activeOrder(idYawDamperSolenoidEnergized.data(), idYawDamperCommandedPosition.data(), 2, true, 0.0);
+  rudderTrimOrder =
+      activeOrder(idRudderTrimActiveModeCommanded.data(), idRudderTrimCommandedPosition.data(), 2, true, rudderTrim.position);
+  rudderTravelLimiterOrder = activeOrder(idRudderTravelLimitActiveModeCommanded.data(), idRudderTravelLimCommandedPosition.data(), 2,
+                                         true, rudderTravelLimiter.position);
+
+  for (std::size_t i = 0; i < spoilersLeft.size(); i++) {
+    spoilersLeftOrder[i] = gauge.getNamedVariable(idLeftSpoilerCommandedPosition[i]);
+    spoilersRightOrder[i] = gauge.getNamedVariable(idRightSpoilerCommandedPosition[i]);
+  }
+}
+
+void PointMassPlant::moveSurfaces(double dt) {
+  moveActuator(elevatorLeft.position, std::clamp(elevatorLeftOrder, -ELEVATOR_LIMIT, ELEVATOR_LIMIT), elevatorLeft.rate, dt);
+  moveActuator(elevatorRight.position, std::clamp(elevatorRightOrder, -ELEVATOR_LIMIT, ELEVATOR_LIMIT), elevatorRight.rate, dt);
+  moveActuator(aileronLeft.position, std::clamp(aileronLeftOrder, -AILERON_LIMIT, AILERON_LIMIT), aileronLeft.rate, dt);
+  moveActuator(aileronRight.position, std::clamp(aileronRightOrder, -AILERON_LIMIT, AILERON_LIMIT), aileronRight.rate, dt);
+  // the THS order is written with the inverted sign of the position the computers read back
+  moveActuator(ths.position, -thsOrder, ths.rate, dt);
+  moveActuator(yawDamper.position, yawDamperOrder, yawDamper.rate, dt);
+  moveActuator(rudderTrim.position, rudderTrimOrder, rudderTrim.rate, dt);
+  moveActuator(rudderTravelLimiter.position, rudderTravelLimiterOrder, rudderTravelLimiter.rate, dt);
+  for (std::size_t i = 0; i < spoilersLeft.size(); i++) {
+    moveActuator(spoilersLeft[i].position, std::clamp(spoilersLeftOrder[i], 0.0, SPOILER_LIMIT), spoilersLeft[i].rate, dt);
+    moveActuator(spoilersRight[i].position, std::clamp(spoilersRightOrder[i], 0.0, SPOILER_LIMIT), spoilersRight[i].rate, dt);
+  }
+}
+
+void PointMassPlant::computeForcesAndMoments() {
+  double airspeed = std::sqrt(u * u + v * v + w * w);
+  double alpha = std::atan2(w, u);
+  double beta = std::asin(std::clamp(v / airspeed, -1.0, 1.0));
+  double dynamicPressure = 0.5 * computeAtmosphere(altitude).density * airspeed * airspeed;
+
+  double elevator = 0.5 * (elevatorLeft.position + elevatorRight.position) * DEG_TO_RAD;
+  double aileron = 0.5 * (aileronLeft.position - aileronRight.position) * DEG_TO_RAD;
+  double rudder = (yawDamper.position + rudderTrim.position) * DEG_TO_RAD;
+  double spoilersLeftMean = 0.0;
+  double spoilersRightMean = 0.0;
+  for (std::size_t i = 0; i < spoilersLeft.size(); i++) {
+    spoilersLeftMean += spoilersLeft[i].position * DEG_TO_RAD / spoilersLeft.size();
+    spoilersRightMean += spoilersRight[i].position * DEG_TO_RAD / spoilersRight.size();
+  }
+
+  double pitchRate = q * MEAN_AERODYNAMIC_CHORD / (2.0 * airspeed);
+  double rollRate = p * WING_SPAN / (2.0 * airspeed);
+  double yawRate = r * WING_SPAN / (2.0 * airspeed);
+
+  double liftCoefficient = CL_0 + CL_ALPHA * alpha + CL_ELEVATOR * elevator + CL_THS * ths.position * DEG_TO_RAD;
+  double dragCoefficient = CD_0 + CD_INDUCED * liftCoefficient * liftCoefficient + CD_SPOILERS * (spoilersLeftMean + spoilersRightMean) / 2;
+  double sideForceCoefficient = CY_BETA * beta + CY_RUDDER * rudder;
+  double rollCoefficient = CL_BETA * beta + CL_P * rollRate + CL_R * yawRate + CL_AILERON * aileron +
+                           CL_SPOILERS * (spoilersRightMean - spoilersLeftMean);
+  double pitchCoefficient = CM_0 + CM_ALPHA * alpha + CM_Q * pitchRate + CM_ELEVATOR * elevator + CM_THS * ths.position * DEG_TO_RAD;
+  double yawCoefficient = CN_BETA * beta + CN_R * yawRate + CN_RUDDER * rudder;
+
+  double lift = dynamicPressure * WING_AREA * liftCoefficient;
+  double drag = dynamicPressure * WING_AREA * dragCoefficient;
+  forceX = thrust - drag * std::cos(alpha) + lift * std::sin(alpha);
+  forceY = dynamicPressure * WING_AREA * sideForceCoefficient;
+  forceZ = -drag * std::sin(alpha) - lift * std::cos(alpha);
+  momentRoll = dynamicPressure * WING_AREA * WING_SPAN * rollCoefficient;
+  momentPitch = dynamicPressure * WING_AREA * MEAN_AERODYNAMIC_CHORD * pitchCoefficient;
+  momentYaw = dynamicPressure * WING_AREA * WING_SPAN * yawCoefficient;
+  loadFactor = -forceZ / (mass * GRAVITY);
+}
+
+void PointMassPlant::integrate(double dt) {
+  computeForcesAndMoments();
+
+  double sinPhi = std::sin(phi);
+  double cosPhi = std::cos(phi);
+  double sinTheta = std::sin(theta);
+  double cosTheta = std::cos(theta);
+  double sinPsi = std::sin(psi);
+  double cosPsi = std::cos(psi);
+
+  double airspeed = std::sqrt(u * u + v * v + w * w);
+  double targetThrust =
+      std::clamp(trimThrust * (1.0 + THRUST_SPEED_GAIN * (trimAirspeed - airspeed) / trimAirspeed), 0.0, 2.0 * trimThrust);
+  thrust += (targetThrust - thrust) * dt / THRUST_TIME_CONSTANT;
+  double betaBefore = std::asin(std::clamp(v / airspeed, -1.0, 1.0));
+
+  uDot = r * v - q * w + forceX / mass - GRAVITY * sinTheta;
+  vDot = p * w - r * u + forceY / mass + GRAVITY * sinPhi * cosTheta;
+  wDot = q * u - p * v + forceZ / mass + GRAVITY * cosPhi * cosTheta;
+  pDot = (momentRoll + (INERTIA_PITCH - INERTIA_YAW) * q * r) / INERTIA_ROLL;
+  qDot = (momentPitch + (INERTIA_YAW - INERTIA_ROLL) * p * r) / INERTIA_PITCH;
+  rDot = (momentYaw + (INERTIA_ROLL - INERTIA_PITCH) * p * q) / INERTIA_YAW;
+
+  double phiDot = p + (q * sinPhi + r * cosPhi) * sinTheta / cosTheta;
+  double thetaDot = q * cosPhi - r * sinPhi;
+  double psiDot = (q * sinPhi + r * cosPhi) / cosTheta;
+
+  // body to north, east, down
+  double velocityNorth = u * cosTheta * cosPsi + v * (sinPhi * sinTheta * cosPsi - cosPhi * sinPsi) +
+                         w * (cosPhi * sinTheta * cosPsi + sinPhi * sinPsi);
+  double velocityEast = u * cosTheta * sinPsi + v * (sinPhi * sinTheta * sinPsi + cosPhi * cosPsi) +
+                        w * (cosPhi * sinTheta * sinPsi - sinPhi * cosPsi);
+  double velocityDown = -u * sinTheta + v * sinPhi * cosTheta + w * cosPhi * cosTheta;
+
+  u += uDot * dt;
+  v += vDot * dt;
+  w += wDot * dt;
+  p += pDot * dt;
+  q += qDot * dt;
+  r += rDot * dt;
+  phi += phiDot * dt;
+  theta += thetaDot * dt;
+  psi = std::fmod(psi + psiDot * dt + 2.0 * PI, 2.0 * PI);
+  altitude -= velocityDown * dt;
+  latitude += velocityNorth / (EARTH_RADIUS + altitude) * dt;
+  longitude += velocityEast / ((EARTH_RADIUS + altitude) * std::cos(latitude)) * dt;
+  time += dt;
+
+  airspeed = std::sqrt(u * u + v * v + w * w);
+  betaDot = (std::asin(std::clamp(v / airspeed, -1.0, 1.0)) - betaBefore) / dt;
+}
+
+void PointMassPlant::step(double dt) {
+  readSurfaceOrders();
+
+  int steps = std::max(1, static_cast<int>(std::ceil(dt / MAXIMUM_STEP)));
+  double stepSize = dt / steps;
+  for (int i = 0; i < steps; i++) {
+    moveSurfaces(stepSize);
+    integrate(stepSize);
+  }
+  computeForcesAndMoments();
+
+  publishLocalVariables();
+}
+
+void PointMassPlant::publishLocalVariables() const {
+  HostGauge& gauge = HostGauge::instance();
+
+  // surface feedback, scaled the way the computers read it back
+  gauge.setNamedVariable(idLeftElevatorPosition, -elevatorLeft.position / 30);
+  gauge.setNamedVariable(idRightElevatorPosition, -elevatorRight.position / 30);
+  gauge.setNamedVariable(idLeftAileronPosition, aileronLeft.position / 25);
+  gauge.setNamedVariable(idRightAileronPosition, aileronRight.position / 25);
+  gauge.setNamedVariable(idRudderTrimPosition, -rudderTrim.position);
+  gauge.setNamedVariable(idRudderTravelLimiterPosition, rudderTravelLimiter.position);
+  for (std::size_t i = 0; i < spoilersLeft.size(); i++) {
+    gauge.setNamedVariable(idLeftSpoilerPosition[i], spoilersLeft[i].position / 50);
+    gauge.setNamedVariable(idRightSpoilerPosition[i], spoilersRight[i].position / 50);
+  }
+
+  for (std::size_t i = 0; i < idHydraulicPressure.size(); i++) {
+    gauge.setNamedVariable(idHydraulicPressure[i], HYDRAULIC_PRESSURE);
+    gauge.setNamedVariable(idHydraulicPressurised[i], 1);
+  }
+
+  double altitudeFeet = getAltitudeFeet();
+  for (auto id : idRadioAltimeterHeight) {
+    gauge.setNamedVariable(id, toArinc429(altitudeFeet, altitudeFeet > RADIO_ALTIMETER_RANGE ? NoComputedData : NormalOperation));
+  }
+
+  Atmosphere atmosphere = computeAtmosphere(altitude);
+  double airspeed = std::sqrt(u * u + v * v + w * w);
+  double mach = airspeed / atmosphere.speedOfSound;
+  double calibratedAirspeed = computeCalibratedAirspeed(mach, atmosphere.pressure);
+
+  double sinPhi = std::sin(phi);
+  double cosPhi = std::cos(phi);
+  double cosTheta = std::cos(theta);
+  double velocityDown = -u * std::sin(theta) + v * sinPhi * cosTheta + w * cosPhi * cosTheta;
+  double groundSpeed = std::sqrt(std::max(0.0, airspeed * airspeed - velocityDown * velocityDown));
+  double flightPathAngle = std::asin(std::clamp(-velocityDown / airspeed, -1.0, 1.0));
+  double heading = wrapHeading(psi * RAD_TO_DEG);
+
+  std::array<double, ADIRS_VARIABLE_COUNT> values;
+  values[ADR_ALTITUDE] = altitudeFeet;
+  values[ADR_BARO_CORRECTED_ALTITUDE_1] = altitudeFeet;
+  values[ADR_MACH] = mach;
+  values[ADR_COMPUTED_AIRSPEED] = calibratedAirspeed / KNOTS_TO_METERS_PER_SECOND;
+  values[ADR_TRUE_AIRSPEED] = airspeed / KNOTS_TO_METERS_PER_SECOND;
+  values[ADR_BAROMETRIC_VERTICAL_SPEED] = -velocityDown / FEET_TO_METERS * 60;
+  values[ADR_ANGLE_OF_ATTACK] = getAngleOfAttackDegrees();
+  values[ADR_CORRECTED_AVERAGE_STATIC_PRESSURE] = atmosphere.pressure / 100;
+  values[IR_LATITUDE] = latitude * RAD_TO_DEG;
+  values[IR_LONGITUDE] = longitude * RAD_TO_DEG;
+  values[IR_GROUND_SPEED] = groundSpeed / KNOTS_TO_METERS_PER_SECOND;
+  values[IR_WIND_SPEED] = 0;
+  values[IR_WIND_DIRECTION] = 0;
+  values[IR_TRACK] = heading;
+  values[IR_TRUE_TRACK] = heading;
+  values[IR_HEADING] = heading;
+  values[IR_TRUE_HEADING] = heading;
+  values[IR_DRIFT_ANGLE] = 0;
+  values[IR_FLIGHT_PATH_ANGLE] = flightPathAngle * RAD_TO_DEG;
+  values[IR_PITCH] = getPitchDegrees();
+  values[IR_ROLL] = getRollDegrees();
+  values[IR_BODY_PITCH_RATE] = q * RAD_TO_DEG;
+  values[IR_BODY_ROLL_RATE] = p * RAD_TO_DEG;
+  values[IR_BODY_YAW_RATE] = r * RAD_TO_DEG;
+  values[IR_BODY_LONGITUDINAL_ACC] = forceX / (mass * GRAVITY);
+  values[IR_BODY_LATERAL_ACC] = forceY / (mass * GRAVITY);
+  values[IR_BODY_NORMAL_ACC] = loadFactor;
+  values[IR_HEADING_RATE] = (q * sinPhi + r * cosPhi) / cosTheta * RAD_TO_DEG;
+  values[IR_PITCH_ATT_RATE] = (q * cosPhi - r * sinPhi) * RAD_TO_DEG;
+  values[IR_ROLL_ATT_RATE] = (p + (q * sinPhi + r * cosPhi) * std::tan(theta)) * RAD_TO_DEG;
+  values[IR_VERTICAL_SPEED] = values[ADR_BAROMETRIC_VERTICAL_SPEED];
+
+  for (const auto& ids : idAdirs) {
+    for (int i = 0; i < ADIRS_VARIABLE_COUNT; i++) {
+      gauge.setNamedVariable(ids[i], toArinc429(values[i]));
+    }
+  }
+}
+
+void PointMassPlant::writeSimData(SimData& simData) const {
+  Atmosphere atmosphere = computeAtmosphere(altitude);
+  double airspeed = std::sqrt(u * u + v * v + w * w);
+  double mach = airspeed / atmosphere.speedOfSound;
+  double calibratedAirspeed = computeCalibratedAirspeed(mach, atmosphere.pressure);
+  double velocityDown = -u * std::sin(theta) + v * std::sin(phi) * std::cos(theta) + w * std::cos(phi) * std::cos(theta);
+
+  // the sim reports pitch and bank positive nose down and left wing down, the rotation rates in the same sense
+  simData.nz_g = loadFactor;
+  simData.Theta_deg = -getPitchDegrees();
+  simData.Phi_deg = -getRollDegrees();
+  simData.bodyRotationVelocity.x = -q;
+  simData.bodyRotationVelocity.y = r;
+  simData.bodyRotationVelocity.z = -p;
+  simData.bodyRotationAcceleration.x = -qDot;
+  simData.bodyRotationAcceleration.y = rDot;
+  simData.bodyRotationAcceleration.z = -pDot;
+  simData.bx_m_s2 = vDot;
+  simData.by_m_s2 = -wDot;
+  simData.bz_m_s2 = uDot;
+  simData.Psi_magnetic_deg = wrapHeading(psi * RAD_TO_DEG);
+  simData.Psi_true_deg = simData.Psi_magnetic_deg;
+  simData.Psi_magnetic_track_deg = simData.Psi_magnetic_deg;
+  simData.eta_pos = -0.5 * (elevatorLeft.position + elevatorRight.position) / ELEVATOR_LIMIT;
+  simData.eta_trim_deg = -ths.position;
+  simData.xi_pos = 0.5 * (aileronLeft.position - aileronRight.position) / AILERON_LIMIT;
+  simData.zeta_pos = (yawDamper.position + rudderTrim.position) / 30.0;
+  simData.alpha_deg = getAngleOfAttackDegrees();
+  simData.beta_deg = std::asin(std::clamp(v / airspeed, -1.0, 1.0)) * RAD_TO_DEG;
+  simData.beta_dot_deg_s = betaDot * RAD_TO_DEG;
+  simData.V_ias_kn = calibratedAirspeed / KNOTS_TO_METERS_PER_SECOND;
+  simData.V_tas_kn = airspeed / KNOTS_TO_METERS_PER_SECOND;
+  simData.V_mach = mach;
+  simData.V_gnd_kn = std::sqrt(std::max(0.0, airspeed * airspeed - velocityDown * velocityDown)) / KNOTS_TO_METERS_PER_SECOND;
+  simData.H_ft = getAltitudeFeet();
+  simData.H_ind_ft = simData.H_ft;
+  simData.H_radio_ft = simData.H_ft;
+  simData.H_dot_fpm = -velocityDown / FEET_TO_METERS * 60;
+  simData.altitude_m = altitude;
+  simData.latitude_deg = latitude * RAD_TO_DEG;
+  simData.longitude_deg = longitude * RAD_TO_DEG;
+  simData.total_weight_kg = mass;
+  simData.linear_cl_alpha_per_deg = CL_ALPHA * DEG_TO_RAD;
+  simData.alpha_zero_lift_deg = -CL_0 / CL_ALPHA * RAD_TO_DEG;
+  simData.ambient_density_kg_per_m3 = atmosphere.density;
+  simData.ambient_pressure_mbar = atmosphere.pressure / 100;
+  simData.ambient_temperature_celsius = atmosphere.temperature - 273.15;
+  simData.total_air_temperature_celsius = atmosphere.temperature * (1.0 + 0.2 * mach * mach) - 273.15;
+  simData.simOnGround = 0;
+}
+
+bool PointMassPlant::isFinite() const {
+  return std::isfinite(u) && std::isfinite(v) && std::isfinite(w) && std::isfinite(p) && std::isfinite(q) && std::isfinite(r) &&
+         std::isfinite(phi) && std::isfinite(theta) && std::isfinite(psi) && std::isfinite(altitude) && std::isfinite(latitude) &&
+         std::isfinite(longitude);
+}
+
+double PointMassPlant::getAltitudeFeet() const {
+  return altitude / FEET_TO_METERS;
+}
+
+double PointMassPlant::getTrueAirspeedKnots() const {
+  return std::sqrt(u * u + v * v + w * w) / KNOTS_TO_METERS_PER_SECOND;
+}
+
+double PointMassPlant::getPitchDegrees() const {
+  return theta * RAD_TO_DEG;
+}
+
+double PointMassPlant::getRollDegrees() const {
+  return phi * RAD_TO_DEG;
+}
+
+double PointMassPlant::getAngleOfAttackDegrees() const {
+  return std::atan2(w, u) * RAD_TO_DEG;
+}
+
+double PointMassPlant::getLoadFactor() const {
+  return loadFactor;
+}
@@ -0,0 +1,205 @@
+#pragma once
+
+#include <MSFS/Legacy/gauges.h>
+#include <array>
+
+#include "SimConnectData.h"
+
+/**
+ * @brief Simple rigid body flight model closing the loop around the module in the host build.
+ *
+ * The aircraft is a point mass with three rotational degrees of freedom, driven by linear stability derivatives of a
+ * generic wide body in clean configuration, the thrust holds the trim airspeed. The control surfaces follow the orders the computers
+ * write to the hydraulic local variables with a rate limit, and the plant publishes the feedback, ADIRS, radio
+ * altimeter and hydraulic local variables the hydraulics and ADIRS systems would provide in the sim.
+ *
+ * It is meant for soak tests of the laws and of the frame time, not for handling qualities: there is no ground,
+ * no high lift devices, no engine model and no compressibility besides the calibrated airspeed conversion.
+ */
+class PointMassPlant {
+ public:
+  /**
+   * @brief Trims the aircraft in level flight at the altitude, true airspeed, heading, position and weight of the
+   * given frame.
+   */
+  void reset(const SimData& simData);
+
+  /**
+   * @brief Publishes the local variables of the current state, to be called once after reset() before the first frame.
+   */
+  void publishLocalVariables() const;
+
+  /**
+   * @brief Reads the surface orders of the last frame and integrates the plant over dt.
+   */
+  void step(double dt);
+
+  /**
+   * @brief Overwrites the flight state fields of the frame, the remaining fields are left untouched.
+   */
+  void writeSimData(SimData& simData) const;
+
+  bool isFinite() const;
+
+  double getAltitudeFeet() const;
+  double getTrueAirspeedKnots() const;
+  double getPitchDegrees() const;
+  double getRollDegrees() const;
+  double getAngleOfAttackDegrees() const;
+  double getLoadFactor() const;
+
+ private:
+  struct Actuator {
+    double position;
+    double rate;
+  };
+
+  struct Atmosphere {
+    double temperature;
+    double pressure;
+    double density;
+    double speedOfSound;
+  };
+
+  // values published for every ADIRU, in the order of ADIRS_VARIABLE_NAMES
+  enum AdirsVariable {
+    ADR_ALTITUDE,
+    ADR_BARO_CORRECTED_ALTITUDE_1,
+    ADR_MACH,
+    ADR_COMPUTED_AIRSPEED,
+    ADR_TRUE_AIRSPEED,
+    ADR_BAROMETRIC_VERTICAL_SPEED,
+    ADR_ANGLE_OF_ATTACK,
+    ADR_CORRECTED_AVERAGE_STATIC_PRESSURE,
+    IR_LATITUDE,
+    IR_LONGITUDE,
+    IR_GROUND_SPEED,
+    IR_WIND_SPEED,
+    IR_WIND_DIRECTION,
+    IR_TRACK,
+    IR_TRUE_TRACK,
+    IR_HEADING,
+    IR_TRUE_HEADING,
+    IR_DRIFT_ANGLE,
+    IR_FLIGHT_PATH_ANGLE,
+    IR_PITCH,
+    IR_ROLL,
+    IR_BODY_PITCH_RATE,
+    IR_BODY_ROLL_RATE,
+    IR_BODY_YAW_RATE,
+    IR_BODY_LONGITUDINAL_ACC,
+    IR_BODY_LATERAL_ACC,
+    IR_BODY_NORMAL_ACC,
+    IR_HEADING_RATE,
+    IR_PITCH_ATT_RATE,
+    IR_ROLL_ATT_RATE,
+    IR_VERTICAL_SPEED,
+    ADIRS_VARIABLE_COUNT
+  };
+
+  static Atmosphere computeAtmosphere(double altitude);
+
+  void registerLocalVariables();
+  void readSurfaceOrders();
+  void moveSurfaces(double dt);
+  void computeForcesAndMoments();
+  void integrate(double dt);
+
+  // state, body axes x forward, y right, z down, angles and rates in rad, positions in m
+  double u = 0.0;
+  double v = 0.0;
+  double w = 0.0;
+  double p = 0.0;
+  double q = 0.0;
+  double r = 0.0;
+  double phi = 0.0;
+  double theta = 0.0;
+  double psi = 0.0;
+  double altitude = 0.0;
+  double latitude = 0.0;
+  double longitude = 0.0;
+  double mass = 0.0;
+  double thrust = 0.0;
+  double trimThrust = 0.0;
+  double trimAirspeed = 0.0;
+  double time = 0.0;
+
+  // derivatives of the last step
+  double uDot = 0.0;
+  double vDot = 0.0;
+  double wDot = 0.0;
+  double pDot = 0.0;
+  double qDot = 0.0;
+  double rDot = 0.0;
+  double betaDot = 0.0;
+  double loadFactor = 1.0;
+
+  // surfaces in deg, in the sign convention of the computer orders
+  Actuator elevatorLeft = {0.0, 40.0};
+  Actuator elevatorRight = {0.0, 40.0};
+  Actuator aileronLeft = {0.0, 40.0};
+  Actuator aileronRight = {0.0, 40.0};
+  Actuator ths = {0.0, 0.5};
+  Actuator yawDamper = {0.0, 25.0};
+  Actuator rudderTrim = {0.0, 1.0};
+  Actuator rudderTravelLimiter = {0.0, 5.0};
+  std::array<Actuator, 5> spoilersLeft = {};
+  std::array<Actuator, 5> spoilersRight = {};
+
+  // orders of the last frame
+  double elevatorLeftOrder = 0.0;
+  double elevatorRightOrder = 0.0;
+  double aileronLeftOrder = 0.0;
+  double aileronRightOrder = 0.0;
+  double thsOrder = 0.0;
+  double yawDamperOrder = 0.0;
+  double rudderTrimOrder = 0.0;
+  double rudderTravelLimiterOrder = 0.0;
+  std::array<double, 5> spoilersLeftOrder = {};
+  std::array<double, 5> spoilersRightOrder = {};
+
+  // forces and moments in body axes
+  double forceX = 0.0;
+  double forceY = 0.0;
+  double forceZ = 0.0;
+  double momentRoll = 0.0;
+  double momentPitch = 0.0;
+  double momentYaw = 0.0;
+
+  // local variables written by the module
+  std::array<ID, 2> idLeftElevatorSolenoidEnergized = {};
+  std::array<ID, 2> idLeftElevatorCommandedPosition = {};
+  std::array<ID, 2> idRightElevatorSolenoidEnergized = {};
+  std::array<ID, 2> idRightElevatorCommandedPosition = {};
+  std::array<ID, 2> idLeftAileronSolenoidEnergized = {};
+  std::array<ID, 2> idLeftAileronCommandedPosition = {};
+  std::array<ID, 2> idRightAileronSolenoidEnergized = {};
+  std::array<ID, 2> idRightAileronCommandedPosition = {};
+  std::array<ID, 3> idTHSActiveModeCommanded = {};
+  std::array<ID, 3> idTHSCommandedPosition = {};
+  std::array<ID, 2> idYawDamperSolenoidEnergized = {};
+  std::array<ID, 2> idYawDamperCommandedPosition = {};
+  std::array<ID, 2> idRudderTrimActiveModeCommanded = {};
+  std::array<ID, 2> idRudderTrimCommandedPosition = {};
+  std::array<ID, 2> idRudderTravelLimitActiveModeCommanded = {};
+  std::array<ID, 2> idRudderTravelLimCommandedPosition = {};
+  std::array<ID, 5> idLeftSpoilerCommandedPosition = {};
+  std::array<ID, 5> idRightSpoilerCommandedPosition = {};
+
+  // local variables written by the plant
+  ID idLeftElevatorPosition = 0;
+  ID idRightElevatorPosition = 0;
+  ID idLeftAileronPosition = 0;
+  ID idRightAileronPosition = 0;
+  ID idRudderTrimPosition = 0;
+  ID idRudderTravelLimiterPosition = 0;
+  std::array<ID, 5> idLeftSpoilerPosition = {};
+  std::array<ID, 5> idRightSpoilerPosition = {};
+  std::array<ID, 3> idHydraulicPressure = {};
+  std::array<ID, 3> idHydraulicPressurised = {};
+  std::array<ID, 2> idRadioAltimeterHeight = {};
+  std::array<std::array<ID, ADIRS_VARIABLE_COUNT>, 3> idAdirs = {};
+
+  // the plant is integrated with sub steps of at most this size, independent of the frame rate
+  static constexpr double MAXIMUM_STEP = 1.0 / 120.0;
+};
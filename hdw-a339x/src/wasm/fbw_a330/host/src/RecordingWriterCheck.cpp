@@ -0,0 +1,197 @@
+// Checks the files of RecordingFileWriter against the frames that were pushed.
+//
+// Frames of varying size are pushed through a writer with a small ring, the first frame is the smallest one so that
+// later frames grow the slots while frames are queued. The files are written once as a single gzip stream and once as
+// chunked containers. They are read back with zlib, the run fails when a byte differs, a frame is missing or a block of
+// the index does not contain the frames it counts.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "recording/RecordingFileWriter.h"
+#include "zlib.h"
+
+namespace {
+struct Frame {
+  std::vector<char> data;
+  double timestamp;
+};
+
+const std::string headerData = "RECORDING WRITER CHECK";
+
+// the first frame is the smallest, every tenth frame is larger than all before it
+std::vector<Frame> makeFrames(std::mt19937_64& random, std::size_t frameCount) {
+  std::vector<Frame> frames(frameCount);
+  std::size_t largestSize = 64;
+  for (std::size_t i = 0; i < frameCount; i++) {
+    std::size_t size = 64;
+    if (i > 0) {
+      size = i % 10 == 0 ? largestSize + 1 + random() % 256 : 64 + random() % largestSize;
+    }
+    largestSize = std::max(largestSize, size);
+    frames[i].data.resize(size);
+    for (auto& byte : frames[i].data) {
+      byte = static_cast<char>(random() % 16);
+    }
+    frames[i].timestamp = static_cast<double>(i) * 0.02;
+  }
+  return frames;
+}
+
+// the pushed frames of a file as one sequence of bytes, preceded by the header
+std::vector<char> expectedContent(const std::vector<Frame>& frames, std::size_t first, std::size_t last) {
+  std::vector<char> content(headerData.begin(), headerData.end());
+  for (std::size_t i = first; i < last; i++) {
+    content.insert(content.end(), frames[i].data.begin(), frames[i].data.end());
+  }
+  return content;
+}
+
+// pushes the frames into two files, the second file starts at the middle frame
+void writeFrames(const std::vector<Frame>& frames, const std::string (&filepaths)[2], std::size_t blockFrameCount) {
+  RecordingFileWriter writer(".check", 4);
+  writer.setHeader(headerData.data(), headerData.size());
+  writer.setBlockFrameCount(blockFrameCount);
+  for (std::size_t i = 0; i < frames.size(); i++) {
+    std::string newFilepath;
+    if (i == 0) {
+      newFilepath = filepaths[0];
+    } else if (i == frames.size() / 2) {
+      newFilepath = filepaths[1];
+    }
+    writer.push(frames[i].data.data(), frames[i].data.size(), newFilepath, 100, frames[i].timestamp);
+    writer.drain(std::chrono::microseconds(50));
+  }
+  writer.close();
+}
+
+std::vector<char> readFile(const std::string& filepath) {
+  std::ifstream stream(filepath, std::ios::binary);
+  return std::vector<char>(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+}
+
+// inflates a single gzip member starting at the offset
+bool inflateMember(const std::vector<char>& file, std::uint64_t offset, std::vector<char>& content) {
+  z_stream stream = {};
+  inflateInit2(&stream, 15 + 16);
+  stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(file.data() + offset));
+  stream.avail_in = static_cast<uInt>(file.size() - offset);
+  char buffer[4096];
+  int result;
+  do {
+    stream.next_out = reinterpret_cast<Bytef*>(buffer);
+    stream.avail_out = sizeof(buffer);
+    result = inflate(&stream, Z_NO_FLUSH);
+    content.insert(content.end(), buffer, buffer + sizeof(buffer) - stream.avail_out);
+  } while (result == Z_OK);
+  inflateEnd(&stream);
+  return result == Z_STREAM_END;
+}
+
+bool checkGzipFile(const std::string& filepath, const std::vector<char>& expected) {
+  gzFile file = gzopen(filepath.c_str(), "rb");
+  if (file == nullptr) {
+    std::cout << "HOST: " << filepath << ": cannot be opened" << std::endl;
+    return false;
+  }
+  std::vector<char> content;
+  char buffer[4096];
+  int size;
+  while ((size = gzread(file, buffer, sizeof(buffer))) > 0) {
+    content.insert(content.end(), buffer, buffer + size);
+  }
+  gzclose(file);
+
+  bool passed = content == expected;
+  std::cout << "HOST: " << filepath << ": bytes = " << content.size() << ", expected = " << expected.size()
+            << (passed ? "" : ", content differs") << std::endl;
+  return passed;
+}
+
+bool checkChunkedFile(const std::string& filepath,
+                      const std::vector<Frame>& frames,
+                      std::size_t first,
+                      std::size_t last,
+                      std::size_t blockFrameCount) {
+  std::vector<char> file = readFile(filepath);
+  std::uint64_t trailer[3];
+  if (file.size() < headerData.size() + sizeof(trailer)) {
+    std::cout << "HOST: " << filepath << ": too short for a chunked container" << std::endl;
+    return false;
+  }
+  std::memcpy(trailer, file.data() + file.size() - sizeof(trailer), sizeof(trailer));
+  if (trailer[2] != RecordingFileWriter::BLOCK_INDEX_MARKER) {
+    std::cout << "HOST: " << filepath << ": block index marker missing" << std::endl;
+    return false;
+  }
+  if (std::memcmp(file.data(), headerData.data(), headerData.size()) != 0) {
+    std::cout << "HOST: " << filepath << ": header differs" << std::endl;
+    return false;
+  }
+
+  // every block must contain exactly the frames it counts, starting with the frame of its timestamp
+  bool passed = true;
+  std::size_t frame = first;
+  for (std::uint64_t block = 0; block < trailer[1]; block++) {
+    struct {
+      double timestamp;
+      std::uint64_t offset;
+      std::uint64_t frameCount;
+    } entry;
+    std::memcpy(&entry, file.data() + trailer[0] + block * sizeof(entry), sizeof(entry));
+
+    std::vector<char> content;
+    bool complete = inflateMember(file, entry.offset, content);
+    std::size_t blockLast = std::min<std::size_t>(frame + entry.frameCount, last);
+    std::vector<char> expected = expectedContent(frames, frame, blockLast);
+    expected.erase(expected.begin(), expected.begin() + static_cast<std::ptrdiff_t>(headerData.size()));
+
+    bool match = complete && frame < last && entry.timestamp == frames[frame].timestamp &&
+                 entry.frameCount <= blockFrameCount && content == expected;
+    if (!match && passed) {
+      std::cout << "HOST: " << filepath << ": block " << block << " with " << entry.frameCount
+                << " frames differs from the frames starting at " << frame << std::endl;
+    }
+    passed &= match;
+    frame = blockLast;
+  }
+  passed &= frame == last;
+
+  std::cout << "HOST: " << filepath << ": blocks = " << trailer[1] << ", frames = " << frame - first
+            << ", expected = " << last - first << (passed ? "" : ", content differs") << std::endl;
+  return passed;
+}
+}  // namespace
+
+int main() {
+  std::mt19937_64 random(1);
+  std::vector<Frame> frames = makeFrames(random, 1000);
+  std::size_t middle = frames.size() / 2;
+
+  const std::string gzipFilepaths[2] = {"recording-writer-check-1.gz", "recording-writer-check-2.gz"};
+  writeFrames(frames, gzipFilepaths, 0);
+  bool passed = checkGzipFile(gzipFilepaths[0], expectedContent(frames, 0, middle));
+  passed &= checkGzipFile(gzipFilepaths[1], expectedContent(frames, middle, frames.size()));
+
+  const std::size_t blockFrameCount = 32;
+  const std::string chunkedFilepaths[2] = {"recording-writer-check-1.fdr", "recording-writer-check-2.fdr"};
+  writeFrames(frames, chunkedFilepaths, blockFrameCount);
+  passed &= checkChunkedFile(chunkedFilepaths[0], frames, 0, middle, blockFrameCount);
+  passed &= checkChunkedFile(chunkedFilepaths[1], frames, middle, frames.size(), blockFrameCount);
+
+  for (const auto& filepath : {gzipFilepaths[0], gzipFilepaths[1], chunkedFilepaths[0], chunkedFilepaths[1]}) {
+    std::remove(filepath.c_str());
+  }
+
+  return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,226 @@
+// Offline replay of the model replay files (.rpl) written by the flight data recorder when MODEL_REPLAY_ENABLED is set.
+//
+// The recorded inputs are fed into the computer wrappers at full speed, the time per step is measured per computer and
+// the outputs are compared bit by bit against the recorded ones. Files are replayed in the given order on the same
+// computers, so the outputs are only expected to match when the first file starts with the recording.
+
+#include <zlib.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "FrameStatistics.h"
+#include "recording/ModelReplayDataTypes.h"
+
+namespace {
+// IMPORTANT: keep in sync with FlightDataRecorder::MODEL_REPLAY_INTERFACE_VERSION
+const std::uint64_t MODEL_REPLAY_INTERFACE_VERSION = 1;
+
+// the wrappers rely on zero initialized members, keep them in static storage like the module does
+Elac elacs[2] = {Elac(true), Elac(false)};
+Sec secs[3] = {Sec(true, false), Sec(false, false), Sec(false, true)};
+Fac facs[2] = {Fac(true), Fac(false)};
+Fmgc fmgcs[2] = {Fmgc(true), Fmgc(false)};
+FadecComputer fadecs[2];
+
+ModelReplayFrame frame;
+
+struct ComputerResult {
+  std::string name;
+  std::vector<std::int64_t> frameTimes;
+  std::size_t mismatchCount = 0;
+  std::size_t firstMismatchFrame = 0;
+};
+
+struct Options {
+  std::vector<std::string> paths;
+  std::size_t warmupFrames = 60;
+};
+
+void printUsage(const char* name) {
+  std::cout << "Usage: " << name << " [--warmup <frames>] <file.rpl>..." << std::endl;
+  std::cout << "  --warmup <frames>  frames excluded from the statistics (default: 60)" << std::endl;
+}
+
+bool parseOptions(int argc, char** argv, Options& options) {
+  for (int i = 1; i < argc; i++) {
+    std::string argument = argv[i];
+    bool hasValue = i + 1 < argc;
+    if (argument == "--warmup" && hasValue) {
+      options.warmupFrames = std::strtoul(argv[++i], nullptr, 10);
+    } else if (argument.rfind("--", 0) == 0) {
+      return false;
+    } else {
+      options.paths.push_back(argument);
+    }
+  }
+  return !options.paths.empty();
+}
+
+template <typename T>
+bool isEqual(const T& recorded, const T& replayed) {
+  return std::memcmp(&recorded, &replayed, sizeof(T)) == 0;
+}
+
+template <typename Wrapper, typename Step>
+std::int64_t measure(Wrapper& wrapper, Step step) {
+  auto start = std::chrono::steady_clock::now();
+  step(wrapper);
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+}
+
+void compare(ComputerResult& result, std::size_t frameIndex, bool equal) {
+  if (!equal) {
+    if (result.mismatchCount == 0) {
+      result.firstMismatchFrame = frameIndex;
+    }
+    result.mismatchCount++;
+  }
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+  Options options;
+  if (!parseOptions(argc, argv, options)) {
+    printUsage(argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  std::vector<ComputerResult> results = {{"ELAC 1", {}}, {"ELAC 2", {}}, {"SEC 1", {}},   {"SEC 2", {}},
+                                         {"SEC 3", {}},  {"FAC 1", {}},  {"FAC 2", {}},   {"FMGC 1", {}},
+                                         {"FMGC 2", {}}, {"FADEC 1", {}}, {"FADEC 2", {}}};
+  ComputerResult* elacResults = &results[0];
+  ComputerResult* secResults = &results[2];
+  ComputerResult* facResults = &results[5];
+  ComputerResult* fmgcResults = &results[7];
+  ComputerResult* fadecResults = &results[9];
+
+  std::size_t frameIndex = 0;
+  for (const auto& path : options.paths) {
+    gzFile file = gzopen(path.c_str(), "rb");
+    if (file == nullptr) {
+      std::cout << "HOST: Failed to open model replay file '" << path << "'" << std::endl;
+      return EXIT_FAILURE;
+    }
+
+    std::uint64_t version = 0;
+    std::uint64_t frameSize = 0;
+    gzread(file, &version, sizeof(version));
+    gzread(file, &frameSize, sizeof(frameSize));
+    if (version != MODEL_REPLAY_INTERFACE_VERSION || frameSize != sizeof(ModelReplayFrame)) {
+      std::cout << "HOST: '" << path << "' has version " << version << " and frame size " << frameSize << ", expected "
+                << MODEL_REPLAY_INTERFACE_VERSION << " and " << sizeof(ModelReplayFrame) << std::endl;
+      gzclose(file);
+      return EXIT_FAILURE;
+    }
+
+    while (gzread(file, &frame, sizeof(frame)) == static_cast<int>(sizeof(frame))) {
+      bool measured = frameIndex >= options.warmupFrames;
+
+      for (int i = 0; i < 2; i++) {
+        auto& data = frame.elacs[i];
+        if (!data.update.updated) {
+          continue;
+        }
+        elacs[i].modelInputs = data.inputs;
+        auto time = measure(elacs[i], [&data](Elac& elac) {
+          elac.update(data.update.deltaTime, data.update.simulationTime, data.update.faultActive, data.update.isPowered);
+        });
+        compare(elacResults[i], frameIndex,
+                isEqual(data.busOutputs, elacs[i].getBusOutputs()) && isEqual(data.discreteOutputs, elacs[i].getDiscreteOutputs()) &&
+                    isEqual(data.analogOutputs, elacs[i].getAnalogOutputs()));
+        if (measured) {
+          elacResults[i].frameTimes.push_back(time);
+        }
+      }
+
+      for (int i = 0; i < 3; i++) {
+        auto& data = frame.secs[i];
+        if (!data.update.updated) {
+          continue;
+        }
+        secs[i].modelInputs = data.inputs;
+        auto time = measure(secs[i], [&data](Sec& sec) {
+          sec.update(data.update.deltaTime, data.update.simulationTime, data.update.faultActive, data.update.isPowered);
+        });
+        compare(secResults[i], frameIndex,
+                isEqual(data.busOutputs, secs[i].getBusOutputs()) && isEqual(data.discreteOutputs, secs[i].getDiscreteOutputs()) &&
+                    isEqual(data.analogOutputs, secs[i].getAnalogOutputs()));
+        if (measured) {
+          secResults[i].frameTimes.push_back(time);
+        }
+      }
+
+      for (int i = 0; i < 2; i++) {
+        auto& data = frame.facs[i];
+        if (!data.update.updated) {
+          continue;
+        }
+        facs[i].modelInputs = data.inputs;
+        auto time = measure(facs[i], [&data](Fac& fac) {
+          fac.update(data.update.deltaTime, data.update.simulationTime, data.update.faultActive, data.update.isPowered);
+        });
+        compare(facResults[i], frameIndex,
+                isEqual(data.busOutputs, facs[i].getBusOutputs()) && isEqual(data.discreteOutputs, facs[i].getDiscreteOutputs()) &&
+                    isEqual(data.analogOutputs, facs[i].getAnalogOutputs()));
+        if (measured) {
+          facResults[i].frameTimes.push_back(time);
+        }
+      }
+
+      for (int i = 0; i < 2; i++) {
+        auto& data = frame.fmgcs[i];
+        if (!data.update.updated) {
+          continue;
+        }
+        fmgcs[i].modelInputs = data.inputs;
+        auto time = measure(fmgcs[i], [&data](Fmgc& fmgc) {
+          fmgc.update(data.update.deltaTime, data.update.simulationTime, data.update.faultActive, data.update.isPowered);
+        });
+        compare(fmgcResults[i], frameIndex, isEqual(data.outputs, fmgcs[i].getDebugOutputs()));
+        if (measured) {
+          fmgcResults[i].frameTimes.push_back(time);
+        }
+      }
+
+      for (int i = 0; i < 2; i++) {
+        auto& data = frame.fadecs[i];
+        if (!data.update.updated) {
+          continue;
+        }
+        auto time = measure(fadecs[i], [&data](FadecComputer& fadec) {
+          fadec.setExternalInputs(&data.inputs);
+          fadec.step();
+        });
+        compare(fadecResults[i], frameIndex, isEqual(data.outputs, fadecs[i].getExternalOutputs().out));
+        if (measured) {
+          fadecResults[i].frameTimes.push_back(time);
+        }
+      }
+
+      frameIndex++;
+    }
+
+    gzclose(file);
+  }
+
+  std::cout << "HOST: replayed frames = " << frameIndex << std::endl;
+
+  bool outputsMatch = true;
+  for (auto& result : results) {
+    printFrameStatistics(result.name, result.frameTimes);
+    if (result.mismatchCount > 0) {
+      std::cout << "HOST: " << result.name << ": outputs differ in " << result.mismatchCount << " frames, first in frame "
+                << result.firstMismatchFrame << std::endl;
+      outputsMatch = false;
+    }
+  }
+
+  return outputsMatch ? EXIT_SUCCESS : EXIT_FAILURE;
+}
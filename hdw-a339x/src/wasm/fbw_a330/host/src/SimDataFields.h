@@ -0,0 +1,178 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+
+#include "SimConnectData.h"
+
+/**
+ * @brief Name and location of every scalar in SimData, so frame scripts can address fields by their member name.
+ * Struct members are flattened to "member.x" / "member.Latitude". Keep in sync with SimData in SimConnectData.h.
+ */
+struct SimDataField {
+  enum class FieldType { Double, UInt64 };
+  using enum FieldType;
+
+  const char* name;
+  std::size_t offset;
+  FieldType type;
+};
+
+// clang-format off
+inline constexpr SimDataField SIM_DATA_FIELDS[] = {
+    {"nz_g", offsetof(SimData, nz_g), SimDataField::Double},
+    {"Theta_deg", offsetof(SimData, Theta_deg), SimDataField::Double},
+    {"Phi_deg", offsetof(SimData, Phi_deg), SimDataField::Double},
+    {"bodyRotationVelocity.x", offsetof(SimData, bodyRotationVelocity) + offsetof(SIMCONNECT_DATA_XYZ, x), SimDataField::Double},
+    {"bodyRotationVelocity.y", offsetof(SimData, bodyRotationVelocity) + offsetof(SIMCONNECT_DATA_XYZ, y), SimDataField::Double},
+    {"bodyRotationVelocity.z", offsetof(SimData, bodyRotationVelocity) + offsetof(SIMCONNECT_DATA_XYZ, z), SimDataField::Double},
+    {"bodyRotationAcceleration.x", offsetof(SimData, bodyRotationAcceleration) + offsetof(SIMCONNECT_DATA_XYZ, x), SimDataField::Double},
+    {"bodyRotationAcceleration.y", offsetof(SimData, bodyRotationAcceleration) + offsetof(SIMCONNECT_DATA_XYZ, y), SimDataField::Double},
+    {"bodyRotationAcceleration.z", offsetof(SimData, bodyRotationAcceleration) + offsetof(SIMCONNECT_DATA_XYZ, z), SimDataField::Double},
+    {"bx_m_s2", offsetof(SimData, bx_m_s2), SimDataField::Double},
+    {"by_m_s2", offsetof(SimData, by_m_s2), SimDataField::Double},
+    {"bz_m_s2", offsetof(SimData, bz_m_s2), SimDataField::Double},
+    {"Psi_magnetic_deg", offsetof(SimData, Psi_magnetic_deg), SimDataField::Double},
+    {"Psi_true_deg", offsetof(SimData, Psi_true_deg), SimDataField::Double},
+    {"Psi_magnetic_track_deg", offsetof(SimData, Psi_magnetic_track_deg), SimDataField::Double},
+    {"eta_pos", offsetof(SimData, eta_pos), SimDataField::Double},
+    {"eta_trim_deg", offsetof(SimData, eta_trim_deg), SimDataField::Double},
+    {"xi_pos", offsetof(SimData, xi_pos), SimDataField::Double},
+    {"zeta_pos", offsetof(SimData, zeta_pos), SimDataField::Double},
+    {"zeta_trim_pos", offsetof(SimData, zeta_trim_pos), SimDataField::Double},
+    {"alpha_deg", offsetof(SimData, alpha_deg), SimDataField::Double},
+    {"beta_deg", offsetof(SimData, beta_deg), SimDataField::Double},
+    {"beta_dot_deg_s", offsetof(SimData, beta_dot_deg_s), SimDataField::Double},
+    {"V_ias_kn", offsetof(SimData, V_ias_kn), SimDataField::Double},
+    {"V_tas_kn", offsetof(SimData, V_tas_kn), SimDataField::Double},
+    {"V_mach", offsetof(SimData, V_mach), SimDataField::Double},
+    {"V_gnd_kn", offsetof(SimData, V_gnd_kn), SimDataField::Double},
+    {"H_ft", offsetof(SimData, H_ft), SimDataField::Double},
+    {"H_ind_ft", offsetof(SimData, H_ind_ft), SimDataField::Double},
+    {"H_radio_ft", offsetof(SimData, H_radio_ft), SimDataField::Double},
+    {"H_dot_fpm", offsetof(SimData, H_dot_fpm), SimDataField::Double},
+    {"CG_percent_MAC", offsetof(SimData, CG_percent_MAC), SimDataField::Double},
+    {"total_weight_kg", offsetof(SimData, total_weight_kg), SimDataField::Double},
+    {"gear_animation_pos_0", offsetof(SimData, gear_animation_pos_0), SimDataField::Double},
+    {"gear_animation_pos_1", offsetof(SimData, gear_animation_pos_1), SimDataField::Double},
+    {"gear_animation_pos_2", offsetof(SimData, gear_animation_pos_2), SimDataField::Double},
+    {"spoilers_handle_position", offsetof(SimData, spoilers_handle_position), SimDataField::Double},
+    {"spoilers_left_pos", offsetof(SimData, spoilers_left_pos), SimDataField::Double},
+    {"spoilers_right_pos", offsetof(SimData, spoilers_right_pos), SimDataField::Double},
+    {"slew_on", offsetof(SimData, slew_on), SimDataField::UInt64},
+    {"autopilot_master_on", offsetof(SimData, autopilot_master_on), SimDataField::UInt64},
+    {"ap_fd_1_active", offsetof(SimData, ap_fd_1_active), SimDataField::UInt64},
+    {"ap_fd_2_active", offsetof(SimData, ap_fd_2_active), SimDataField::UInt64},
+    {"ap_V_c_kn", offsetof(SimData, ap_V_c_kn), SimDataField::Double},
+    {"ap_H_c_ft", offsetof(SimData, ap_H_c_ft), SimDataField::Double},
+    {"simulationTime", offsetof(SimData, simulationTime), SimDataField::Double},
+    {"simulation_rate", offsetof(SimData, simulation_rate), SimDataField::Double},
+    {"ice_structure_percent", offsetof(SimData, ice_structure_percent), SimDataField::Double},
+    {"linear_cl_alpha_per_deg", offsetof(SimData, linear_cl_alpha_per_deg), SimDataField::Double},
+    {"alpha_stall_deg", offsetof(SimData, alpha_stall_deg), SimDataField::Double},
+    {"alpha_zero_lift_deg", offsetof(SimData, alpha_zero_lift_deg), SimDataField::Double},
+    {"ambient_density_kg_per_m3", offsetof(SimData, ambient_density_kg_per_m3), SimDataField::Double},
+    {"ambient_pressure_mbar", offsetof(SimData, ambient_pressure_mbar), SimDataField::Double},
+    {"ambient_temperature_celsius", offsetof(SimData, ambient_temperature_celsius), SimDataField::Double},
+    {"ambient_wind_x_kn", offsetof(SimData, ambient_wind_x_kn), SimDataField::Double},
+    {"ambient_wind_y_kn", offsetof(SimData, ambient_wind_y_kn), SimDataField::Double},
+    {"ambient_wind_z_kn", offsetof(SimData, ambient_wind_z_kn), SimDataField::Double},
+    {"ambient_wind_velocity_kn", offsetof(SimData, ambient_wind_velocity_kn), SimDataField::Double},
+    {"ambient_wind_direction_deg", offsetof(SimData, ambient_wind_direction_deg), SimDataField::Double},
+    {"total_air_temperature_celsius", offsetof(SimData, total_air_temperature_celsius), SimDataField::Double},
+    {"latitude_deg", offsetof(SimData, latitude_deg), SimDataField::Double},
+    {"longitude_deg", offsetof(SimData, longitude_deg), SimDataField::Double},
+    {"throttle_lever_1_pos", offsetof(SimData, throttle_lever_1_pos), SimDataField::Double},
+    {"throttle_lever_2_pos", offsetof(SimData, throttle_lever_2_pos), SimDataField::Double},
+    {"engine_1_thrust_lbf", offsetof(SimData, engine_1_thrust_lbf), SimDataField::Double},
+    {"engine_2_thrust_lbf", offsetof(SimData, engine_2_thrust_lbf), SimDataField::Double},
+    {"nav_valid", offsetof(SimData, nav_valid), SimDataField::UInt64},
+    {"nav_loc_deg", offsetof(SimData, nav_loc_deg), SimDataField::Double},
+    {"nav_gs_deg", offsetof(SimData, nav_gs_deg), SimDataField::Double},
+    {"nav_dme_valid", offsetof(SimData, nav_dme_valid), SimDataField::UInt64},
+    {"nav_dme_nmi", offsetof(SimData, nav_dme_nmi), SimDataField::Double},
+    {"nav_loc_valid", offsetof(SimData, nav_loc_valid), SimDataField::UInt64},
+    {"nav_loc_error_deg", offsetof(SimData, nav_loc_error_deg), SimDataField::Double},
+    {"nav_gs_valid", offsetof(SimData, nav_gs_valid), SimDataField::UInt64},
+    {"nav_gs_error_deg", offsetof(SimData, nav_gs_error_deg), SimDataField::Double},
+    {"isAutoThrottleActive", offsetof(SimData, isAutoThrottleActive), SimDataField::UInt64},
+    {"engine_n1_1", offsetof(SimData, engine_n1_1), SimDataField::Double},
+    {"engine_n1_2", offsetof(SimData, engine_n1_2), SimDataField::Double},
+    {"gpsIsFlightPlanActive", offsetof(SimData, gpsIsFlightPlanActive), SimDataField::UInt64},
+    {"gpsWpCrossTrack", offsetof(SimData, gpsWpCrossTrack), SimDataField::Double},
+    {"gpsWpTrackAngleError", offsetof(SimData, gpsWpTrackAngleError), SimDataField::Double},
+    {"gpsCourseToSteer", offsetof(SimData, gpsCourseToSteer), SimDataField::Double},
+    {"commanded_engine_N1_1_percent", offsetof(SimData, commanded_engine_N1_1_percent), SimDataField::Double},
+    {"commanded_engine_N1_2_percent", offsetof(SimData, commanded_engine_N1_2_percent), SimDataField::Double},
+    {"engine_N1_1_percent", offsetof(SimData, engine_N1_1_percent), SimDataField::Double},
+    {"engine_N1_2_percent", offsetof(SimData, engine_N1_2_percent), SimDataField::Double},
+    {"corrected_engine_N1_1_percent", offsetof(SimData, corrected_engine_N1_1_percent), SimDataField::Double},
+    {"corrected_engine_N1_2_percent", offsetof(SimData, corrected_engine_N1_2_percent), SimDataField::Double},
+    {"engineEngineOilTemperature_1", offsetof(SimData, engineEngineOilTemperature_1), SimDataField::Double},
+    {"engineEngineOilTemperature_2", offsetof(SimData, engineEngineOilTemperature_2), SimDataField::Double},
+    {"engineEngineOilPressure_1", offsetof(SimData, engineEngineOilPressure_1), SimDataField::Double},
+    {"engineEngineOilPressure_2", offsetof(SimData, engineEngineOilPressure_2), SimDataField::Double},
+    {"engine_combustion_1", offsetof(SimData, engine_combustion_1), SimDataField::UInt64},
+    {"engine_combustion_2", offsetof(SimData, engine_combustion_2), SimDataField::UInt64},
+    {"is_mach_mode_active", offsetof(SimData, is_mach_mode_active), SimDataField::UInt64},
+    {"speed_slot_index", offsetof(SimData, speed_slot_index), SimDataField::UInt64},
+    {"engineAntiIce_1", offsetof(SimData, engineAntiIce_1), SimDataField::UInt64},
+    {"engineAntiIce_2", offsetof(SimData, engineAntiIce_2), SimDataField::UInt64},
+    {"simOnGround", offsetof(SimData, simOnGround), SimDataField::UInt64},
+    {"kohlsmanSetting_0", offsetof(SimData, kohlsmanSetting_0), SimDataField::Double},
+    {"kohlsmanSetting_1", offsetof(SimData, kohlsmanSetting_1), SimDataField::Double},
+    {"kohlsmanSettingStd_3", offsetof(SimData, kohlsmanSettingStd_3), SimDataField::UInt64},
+    {"cameraState", offsetof(SimData, cameraState), SimDataField::Double},
+    {"altitude_m", offsetof(SimData, altitude_m), SimDataField::Double},
+    {"nav_loc_magvar_deg", offsetof(SimData, nav_loc_magvar_deg), SimDataField::Double},
+    {"nav_loc_pos.Latitude", offsetof(SimData, nav_loc_pos) + offsetof(SIMCONNECT_DATA_LATLONALT, Latitude), SimDataField::Double},
+    {"nav_loc_pos.Longitude", offsetof(SimData, nav_loc_pos) + offsetof(SIMCONNECT_DATA_LATLONALT, Longitude), SimDataField::Double},
+    {"nav_loc_pos.Altitude", offsetof(SimData, nav_loc_pos) + offsetof(SIMCONNECT_DATA_LATLONALT, Altitude), SimDataField::Double},
+    {"nav_gs_pos.Latitude", offsetof(SimData, nav_gs_pos) + offsetof(SIMCONNECT_DATA_LATLONALT, Latitude), SimDataField::Double},
+    {"nav_gs_pos.Longitude", offsetof(SimData, nav_gs_pos) + offsetof(SIMCONNECT_DATA_LATLONALT, Longitude), SimDataField::Double},
+    {"nav_gs_pos.Altitude", offsetof(SimData, nav_gs_pos) + offsetof(SIMCONNECT_DATA_LATLONALT, Altitude), SimDataField::Double},
+    {"brakeLeftPosition", offsetof(SimData, brakeLeftPosition), SimDataField::Double},
+    {"brakeRightPosition", offsetof(SimData, brakeRightPosition), SimDataField::Double},
+    {"flapsHandleIndex", offsetof(SimData, flapsHandleIndex), SimDataField::Double},
+    {"gearHandlePosition", offsetof(SimData, gearHandlePosition), SimDataField::Double},
+    {"assistanceTakeoffEnabled", offsetof(SimData, assistanceTakeoffEnabled), SimDataField::UInt64},
+    {"assistanceLandingEnabled", offsetof(SimData, assistanceLandingEnabled), SimDataField::UInt64},
+    {"aiAutoTrimActive", offsetof(SimData, aiAutoTrimActive), SimDataField::UInt64},
+    {"aiControlsActive", offsetof(SimData, aiControlsActive), SimDataField::UInt64},
+    {"wheelRpmLeft", offsetof(SimData, wheelRpmLeft), SimDataField::Double},
+    {"wheelRpmRight", offsetof(SimData, wheelRpmRight), SimDataField::Double},
+    {"seaLevelPressure", offsetof(SimData, seaLevelPressure), SimDataField::Double},
+};
+// clang-format on
+
+inline const SimDataField* findSimDataField(const std::string& name) {
+  for (const auto& field : SIM_DATA_FIELDS) {
+    if (name == field.name) {
+      return &field;
+    }
+  }
+  return nullptr;
+}
+
+inline double getSimDataField(const SimData& simData, const SimDataField& field) {
+  const char* base = reinterpret_cast<const char*>(&simData) + field.offset;
+  if (field.type == SimDataField::Double) {
+    double value;
+    std::memcpy(&value, base, sizeof(value));
+    return value;
+  }
+  unsigned long long value;
+  std::memcpy(&value, base, sizeof(value));
+  return static_cast<double>(value);
+}
+
+inline void setSimDataField(SimData& simData, const SimDataField& field, double value) {
+  char* base = reinterpret_cast<char*>(&simData) + field.offset;
+  if (field.type == SimDataField::Double) {
+    std::memcpy(base, &value, sizeof(value));
+    return;
+  }
+  unsigned long long integerValue = static_cast<unsigned long long>(value);
+  std::memcpy(base, &integerValue, sizeof(integerValue));
+}
@@ -0,0 +1,245 @@
+#include <MSFS/MSFS.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "FrameScript.h"
+#include "FrameStatistics.h"
+#include "HostGauge.h"
+#include "HostSimConnect.h"
+#include "PointMassPlant.h"
+#include "SimConnectData.h"
+
+// gauge entry point of the module, see src/main.cpp
+extern "C" bool fbw_gauge_callback(FsContext ctx, int service_id, void* pData);
+
+namespace {
+// the module uses the MSFS work folder path verbatim, on the host this is a file name relative to the working directory
+const char* const FLIGHT_DATA_RECORDER_CONFIGURATION_FILEPATH = "\\work\\FlightDataRecorder.ini";
+
+// used when no script is given: powered aircraft in steady cruise
+const char* const DEFAULT_FRAME_SCRIPT = R"(
+lvar A32NX_IS_READY 1
+lvar A32NX_ELEC_DC_2_BUS_IS_POWERED 1
+lvar A32NX_ELEC_DC_ESS_BUS_IS_POWERED 1
+lvar A32NX_ELEC_DC_ESS_SHED_BUS_IS_POWERED 1
+lvar A32NX_ELEC_DC_HOT_1_BUS_IS_POWERED 1
+lvar A32NX_ELEC_DC_HOT_2_BUS_IS_POWERED 1
+set simulation_rate 1
+set nz_g 1
+set Theta_deg 2.5
+set alpha_deg 2.5
+set V_ias_kn 280
+set V_tas_kn 460
+set V_mach 0.8
+set V_gnd_kn 460
+set H_ft 35000
+set H_ind_ft 35000
+set H_radio_ft 35000
+set total_weight_kg 200000
+set CG_percent_MAC 30
+set ambient_pressure_mbar 238.4
+set ambient_temperature_celsius -54.3
+set ambient_density_kg_per_m3 0.38
+set seaLevelPressure 1013.25
+set kohlsmanSetting_0 1013.25
+set kohlsmanSetting_1 1013.25
+set engine_combustion_1 1
+set engine_combustion_2 1
+set engine_N1_1_percent 85
+set engine_N1_2_percent 85
+run 18000
+)";
+
+struct Options {
+  std::string scriptPath;
+  std::size_t repeat = 1;
+  std::size_t warmupFrames = 60;
+  bool quiet = false;
+  bool flightDataRecorder = false;
+  bool modelReplay = false;
+  bool plant = false;
+  std::int64_t maximumP99 = 0;
+};
+
+// envelope of the closed loop runs, leaving it means the laws or the plant diverged
+constexpr double PLANT_MAXIMUM_BANK_DEG = 70.0;
+constexpr double PLANT_MAXIMUM_PITCH_DEG = 35.0;
+constexpr double PLANT_MAXIMUM_ALPHA_DEG = 20.0;
+
+void printUsage(const char* name) {
+  std::cout << "Usage: " << name
+            << " [--script <file>] [--repeat <n>] [--warmup <frames>] [--quiet] [--fdr] [--model-replay] [--plant] [--max-p99 <ns>]"
+            << std::endl;
+  std::cout << "  --script <file>    frame script to replay, see FrameScript.h (default: steady cruise)" << std::endl;
+  std::cout << "  --repeat <n>       replay the script n times within one connection (default: 1)" << std::endl;
+  std::cout << "  --warmup <frames>  frames excluded from the statistics (default: 60)" << std::endl;
+  std::cout << "  --quiet            suppress the module output while frames are running" << std::endl;
+  std::cout << "  --fdr              keep the flight data recorder enabled" << std::endl;
+  std::cout << "  --model-replay     enable the flight data recorder including the model replay files (.rpl)" << std::endl;
+  std::cout << "  --plant            fly closed loop with the point mass plant, the script only sets up and sends inputs" << std::endl;
+  std::cout << "  --max-p99 <ns>     fail when the 99th percentile of the frame time exceeds the budget" << std::endl;
+}
+
+bool parseOptions(int argc, char** argv, Options& options) {
+  for (int i = 1; i < argc; i++) {
+    std::string argument = argv[i];
+    bool hasValue = i + 1 < argc;
+    if (argument == "--script" && hasValue) {
+      options.scriptPath = argv[++i];
+    } else if (argument == "--repeat" && hasValue) {
+      options.repeat = std::max(1UL, std::strtoul(argv[++i], nullptr, 10));
+    } else if (argument == "--warmup" && hasValue) {
+      options.warmupFrames = std::strtoul(argv[++i], nullptr, 10);
+    } else if (argument == "--quiet") {
+      options.quiet = true;
+    } else if (argument == "--fdr") {
+      options.flightDataRecorder = true;
+    } else if (argument == "--model-replay") {
+      options.modelReplay = true;
+    } else if (argument == "--plant") {
+      options.plant = true;
+    } else if (argument == "--max-p99" && hasValue) {
+      options.maximumP99 = std::strtoll(argv[++i], nullptr, 10);
+    } else {
+      return false;
+    }
+  }
+  return true;
+}
+
+void writeFlightDataRecorderConfiguration(bool enabled, bool modelReplay) {
+  std::ofstream file(FLIGHT_DATA_RECORDER_CONFIGURATION_FILEPATH);
+  file << "[FLIGHT_DATA_RECORDER]" << std::endl;
+  file << "ENABLED = " << (enabled ? "true" : "false") << std::endl;
+  file << "MODEL_REPLAY_ENABLED = " << (modelReplay ? "true" : "false") << std::endl;
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+  Options options;
+  if (!parseOptions(argc, argv, options)) {
+    printUsage(argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  FrameScript script;
+  bool loaded = options.scriptPath.empty() ? script.parse(DEFAULT_FRAME_SCRIPT, "default") : script.load(options.scriptPath);
+  if (!loaded) {
+    return EXIT_FAILURE;
+  }
+
+  // with --fdr alone an existing configuration is kept
+  if (options.modelReplay) {
+    writeFlightDataRecorderConfiguration(true, true);
+  } else if (!options.flightDataRecorder) {
+    writeFlightDataRecorderConfiguration(false, false);
+  }
+
+  if (!fbw_gauge_callback(0, PANEL_SERVICE_PRE_INSTALL, nullptr)) {
+    std::cout << "HOST: Module failed to connect" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::streambuf* coutBuffer = std::cout.rdbuf();
+  if (options.quiet) {
+    std::cout.rdbuf(nullptr);
+  }
+
+  std::vector<std::int64_t> frameTimes;
+  frameTimes.reserve(script.getFrameCount() * options.repeat);
+  std::size_t frameCount = 0;
+  bool frameResult = true;
+
+  PointMassPlant plant;
+  bool plantDiverged = false;
+  double minimumAltitude = 0.0;
+  double maximumAltitude = 0.0;
+  double maximumBank = 0.0;
+  auto runStart = std::chrono::steady_clock::now();
+
+  SimData simData = {};
+  sGaugeDrawData drawData = {};
+  for (std::size_t run = 0; run < options.repeat && !plantDiverged; run++) {
+    script.restart();
+    double dt = 0.0;
+    while (!plantDiverged && script.nextFrame(simData, dt)) {
+      // the plant keeps flying across repetitions, the first frame of the script only provides the trim conditions
+      if (options.plant) {
+        if (frameCount == 0) {
+          plant.reset(simData);
+          plant.publishLocalVariables();
+          minimumAltitude = maximumAltitude = plant.getAltitudeFeet();
+        }
+        plant.writeSimData(simData);
+      }
+
+      // data arrives through SimConnect before the gauge is drawn, like in the sim
+      HostSimConnect::instance().publishSimObjectData(0, &simData, sizeof(simData));
+      drawData.dt = dt;
+      drawData.t += dt;
+
+      auto start = std::chrono::steady_clock::now();
+      frameResult &= fbw_gauge_callback(0, PANEL_SERVICE_PRE_DRAW, &drawData);
+      auto end = std::chrono::steady_clock::now();
+
+      if (frameCount++ >= options.warmupFrames) {
+        frameTimes.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+      }
+
+      if (options.plant) {
+        plant.step(dt);
+        minimumAltitude = std::min(minimumAltitude, plant.getAltitudeFeet());
+        maximumAltitude = std::max(maximumAltitude, plant.getAltitudeFeet());
+        maximumBank = std::max(maximumBank, std::abs(plant.getRollDegrees()));
+        plantDiverged = !plant.isFinite() || std::abs(plant.getRollDegrees()) > PLANT_MAXIMUM_BANK_DEG ||
+                        std::abs(plant.getPitchDegrees()) > PLANT_MAXIMUM_PITCH_DEG ||
+                        std::abs(plant.getAngleOfAttackDegrees()) > PLANT_MAXIMUM_ALPHA_DEG;
+      }
+    }
+  }
+
+  double wallTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - runStart).count();
+
+  std::cout.rdbuf(coutBuffer);
+  std::cout.clear();
+
+  std::cout << "HOST: named variables = " << HostGauge::instance().getNamedVariableCount()
+            << ", dispatched messages = " << HostSimConnect::instance().getDispatchedMessageCount() << std::endl;
+  printFrameStatistics("update", frameTimes);
+
+  if (options.plant) {
+    std::cout << std::setprecision(1) << "HOST: plant: simulated = " << drawData.t << " s, speed-up = " << drawData.t / wallTime
+              << "x, altitude = " << plant.getAltitudeFeet() << " ft (" << minimumAltitude << " to " << maximumAltitude
+              << "), airspeed = " << plant.getTrueAirspeedKnots() << " kn TAS, pitch = " << plant.getPitchDegrees()
+              << " deg, bank = " << plant.getRollDegrees() << " deg (max " << maximumBank << "), nz = " << std::setprecision(3)
+              << plant.getLoadFactor() << std::endl;
+  }
+
+  fbw_gauge_callback(0, PANEL_SERVICE_PRE_KILL, nullptr);
+
+  if (!frameResult) {
+    std::cout << "HOST: At least one frame reported a failed update" << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (plantDiverged) {
+    std::cout << "HOST: Plant left the envelope after " << frameCount << " frames" << std::endl;
+    return EXIT_FAILURE;
+  }
+  // the statistics sorted the frame times
+  if (options.maximumP99 > 0 && !frameTimes.empty() &&
+      frameTimes[std::min(frameTimes.size() - 1, frameTimes.size() * 99 / 100)] > options.maximumP99) {
+    std::cout << "HOST: 99th percentile of the frame time exceeds " << options.maximumP99 << " ns" << std::endl;
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
@@ -1,5 +1,6 @@
 #include <ini.h>
 #include <ini_type_conversion.h>
+#include <algorithm>
 #include <cmath>
 #include <iomanip>
 #include <iostream>
@@ -12,11 +13,82 @@
 
 using namespace mINI;
 
+namespace {
+
+double interpolate(double from, double to, double fraction) {
+  return from + fraction * (to - from);
+}
+
+// words are only interpolated when their status does not change, the discrete words are never interpolated
+void interpolateWord(base_arinc_429& word, const base_arinc_429& from, const base_arinc_429& to, double fraction) {
+  word = to;
+  if (from.SSM == to.SSM) {
+    word.Data = static_cast<float>(interpolate(from.Data, to.Data, fraction));
+  }
+}
+
+void interpolateAnalogInputs(base_elac_analog_inputs& inputs,
+                             const base_elac_analog_inputs& from,
+                             const base_elac_analog_inputs& to,
+                             double fraction) {
+  static constexpr double base_elac_analog_inputs::*VALUES[] = {
+      &base_elac_analog_inputs::capt_pitch_stick_pos,   &base_elac_analog_inputs::fo_pitch_stick_pos,
+      &base_elac_analog_inputs::capt_roll_stick_pos,    &base_elac_analog_inputs::fo_roll_stick_pos,
+      &base_elac_analog_inputs::left_elevator_pos_deg,  &base_elac_analog_inputs::right_elevator_pos_deg,
+      &base_elac_analog_inputs::ths_pos_deg,            &base_elac_analog_inputs::left_aileron_pos_deg,
+      &base_elac_analog_inputs::right_aileron_pos_deg,  &base_elac_analog_inputs::rudder_pedal_pos,
+      &base_elac_analog_inputs::load_factor_acc_1_g,    &base_elac_analog_inputs::load_factor_acc_2_g,
+      &base_elac_analog_inputs::blue_hyd_pressure_psi,  &base_elac_analog_inputs::green_hyd_pressure_psi,
+      &base_elac_analog_inputs::yellow_hyd_pressure_psi};
+  static_assert(sizeof(VALUES) / sizeof(VALUES[0]) * sizeof(double) == sizeof(base_elac_analog_inputs), "analog input missing");
+
+  for (auto value : VALUES) {
+    inputs.*value = interpolate(from.*value, to.*value, fraction);
+  }
+}
+
+void interpolateAdrBus(base_adr_bus& bus, const base_adr_bus& from, const base_adr_bus& to, double fraction) {
+  static constexpr base_arinc_429 base_adr_bus::*WORDS[] = {
+      &base_adr_bus::altitude_standard_ft,  &base_adr_bus::altitude_corrected_ft, &base_adr_bus::mach,
+      &base_adr_bus::airspeed_computed_kn,  &base_adr_bus::airspeed_true_kn,      &base_adr_bus::vertical_speed_ft_min,
+      &base_adr_bus::aoa_corrected_deg,     &base_adr_bus::corrected_average_static_pressure};
+
+  for (auto word : WORDS) {
+    interpolateWord(bus.*word, from.*word, to.*word, fraction);
+  }
+}
+
+void interpolateIrBus(base_ir_bus& bus, const base_ir_bus& from, const base_ir_bus& to, double fraction) {
+  // attitude, rates and accelerations used by the laws, the headings and tracks wrap around and are held
+  static constexpr base_arinc_429 base_ir_bus::*WORDS[] = {
+      &base_ir_bus::flight_path_angle_deg, &base_ir_bus::pitch_angle_deg,       &base_ir_bus::roll_angle_deg,
+      &base_ir_bus::body_pitch_rate_deg_s, &base_ir_bus::body_roll_rate_deg_s,  &base_ir_bus::body_yaw_rate_deg_s,
+      &base_ir_bus::body_long_accel_g,     &base_ir_bus::body_lat_accel_g,      &base_ir_bus::body_normal_accel_g,
+      &base_ir_bus::pitch_att_rate_deg_s,  &base_ir_bus::roll_att_rate_deg_s,   &base_ir_bus::inertial_vertical_speed_ft_s};
+
+  bus = to;
+  for (auto word : WORDS) {
+    interpolateWord(bus.*word, from.*word, to.*word, fraction);
+  }
+}
+
+}  // namespace
+
 bool FlyByWireInterface::connect() {
   // setup local variables
   setupLocalVariables();
 
-  // load configuration
+  // initialize stage timings and scheduler, the names need to match the Stage enum
+  std::vector<std::string> stageNames = {"UPDATE",         "READ_DATA",  "SIMULATION_RATE",      "RADIO_RECEIVER", "ALTIMETER_SETTING",
+                                         "FLY_BY_WIRE",    "SENSORS",    "FADEC_BUS",            "TCAS",           "FCU",
+                                         "FCU_SHIM",       "FMGC_1",     "FMGC_2",               "FMGC_SHIM",      "ELAC_1",
+                                         "ELAC_2",         "SEC_1",      "SEC_2",                "SEC_3",          "FAC_1",
+                                         "FAC_2",          "FCDC_1",     "FCDC_2",               "FADEC_1",        "FADEC_2",
+                                         "RECORDING_DATA", "SPOILERS",   "FLIGHT_DATA_RECORDER", "MODEL_REPLAY",   "LVAR_FLUSH"};
+  stageTimings.initialize(stageNames);
+  stageScheduler.initialize(stageNames);
+
+  // load configuration, sets the rates of the scheduled stages
   loadConfiguration();
 
   // setup handlers
@@ -28,13 +100,19 @@ bool FlyByWireInterface::connect() {
   // initialize flight data recorder
   flightDataRecorder.initialize();
 
+  // wire the bus outputs of the computers, depends on the disabled computers of the configuration
+  wireBusOutputs();
+
   // connect to sim connect
   bool success =
-      simConnectInterface.connect(clientDataEnabled, elacDisabled, secDisabled, facDisabled, fmgcDisabled, fcuDisabled, throttleAxis,
+      simConnectInterface.connect(clientDataEnabled, clientDataBulkTransferEnabled, elacDisabled, secDisabled, facDisabled, fmgcDisabled, fcuDisabled, throttleAxis,
                                   spoilersHandler, flightControlsKeyChangeAileron, flightControlsKeyChangeElevator,
                                   flightControlsKeyChangeRudder, disableXboxCompatibilityRudderAxisPlusMinus, enableRudder2AxisMode,
                                   idMinimumSimulationRate->get(), idMaximumSimulationRate->get(), limitSimulationRateByPerformance);
 
+  // write the initial values of the local variables
+  localVariables.flush();
+
   // request data
   if (!simConnectInterface.requestData()) {
     std::cout << "WASM: Request data failed!" << std::endl;
@@ -54,30 +132,70 @@ void FlyByWireInterface::disconnect() {
   // delete throttle axis mapping -> due to usage of shared_ptr no delete call is needed
   throttleAxis.clear();
 
-  // unregister local variables
+  // write pending values and unregister local variables
+  localVariables.flush();
   unregister_all_named_vars();
 }
 
+void FlyByWireInterface::wireBusOutputs() {
+  for (int i = 0; i < 2; i++) {
+    elacsBusOutputs[i] = i == elacDisabled ? &elacsClientDataBusOutputs[i] : &elacs[i].getBusOutputs();
+    fcdcsBusOutputs[i] = reinterpret_cast<const base_fcdc_bus*>(&fcdcs[i].getBusOutputs());
+    fmgcsBusOutputs[i] = i == fmgcDisabled ? &fmgcsClientDataBusOutputs[i] : &fmgcs[i].getBusOutputs();
+    facsBusOutputs[i] = i == facDisabled ? &facsClientDataBusOutputs[i] : &facs[i].getBusOutputs();
+  }
+  for (int i = 0; i < 3; i++) {
+    secsBusOutputs[i] = i == secDisabled ? &secsClientDataBusOutputs[i] : &secs[i].getBusOutputs();
+  }
+  fcuBusOutputs = fcuDisabled ? &fcuClientDataBusOutputs : &fcu.getBusOutputs();
+
+  for (int i = 0; i < 2; i++) {
+    fcdcs[i].busInputs.elac1 = elacsBusOutputs[0];
+    fcdcs[i].busInputs.elac2 = elacsBusOutputs[1];
+    fcdcs[i].busInputs.sec1 = secsBusOutputs[0];
+    fcdcs[i].busInputs.sec2 = secsBusOutputs[1];
+    fcdcs[i].busInputs.sec3 = secsBusOutputs[2];
+    fcdcs[i].busInputs.fcdcOpp = fcdcsBusOutputs[i == 0 ? 1 : 0];
+  }
+}
+
 bool FlyByWireInterface::update(double sampleTime) {
   bool result = true;
 
+  // start a new frame of the local variables, the changed values are written at the end of the measured update, the
+  // scoped flush only writes the values of exits before the update is measured
+  localVariables.beginFrame();
+  LocalVariableTable::ScopedFlush localVariablesFlush(localVariables);
+
+  // apply changes of the configuration file between frames
+  result &= updateConfiguration(sampleTime);
+
+  // publish and write stage timings, done before the frame is measured
+  result &= updateStageTimings();
+
+  // measure the complete update
+  StageTimings::ScopedTimer updateTimer(stageTimings, STAGE_UPDATE);
+
+  // measure the compute time of the frame for the simulation rate governor
+  SimulationRateGovernor::ScopedTimer governorTimer(simulationRateGovernor);
+
   // update failures handler
   failuresConsumer.update();
 
   // get data & inputs
-  result &= readDataAndLocalVariables(sampleTime);
+  result &= stageTimings.measure(STAGE_READ_DATA, [&] { return readDataAndLocalVariables(sampleTime); });
 
   // get sim data
-  SimData simData = simConnectInterface.getSimData();
+  const SimData& simData = simConnectInterface.getSimData();
 
   // update performance monitoring
   result &= updatePerformanceMonitoring(sampleTime);
 
   // handle simulation rate reduction
-  result &= handleSimulationRate(sampleTime);
+  result &= stageTimings.measure(STAGE_SIMULATION_RATE, [&] { return handleSimulationRate(sampleTime); });
 
   // update radio receivers
-  result &= updateRadioReceiver(sampleTime);
+  result &= runStage(STAGE_RADIO_RECEIVER, sampleTime, [&](double stageSampleTime) { return updateRadioReceiver(stageSampleTime); });
 
   // handle initialization
   result &= handleFcuInitialization(calculatedSampleTime);
@@ -85,89 +203,135 @@ bool FlyByWireInterface::update(double sampleTime) {
   // do not process laws in pause or slew
   if (simData.slew_on) {
     wasInSlew = true;
+    flushLocalVariables();
     return result;
   } else if (pauseDetected || simData.cameraState >= 10.0 || !idIsReady->get() || simData.simulationTime < 2) {
+    flushLocalVariables();
     return result;
   }
 
   // update altimeter setting
-  result &= updateAltimeterSetting(calculatedSampleTime);
+  result &= runStage(STAGE_ALTIMETER_SETTING, calculatedSampleTime,
+                     [&](double stageSampleTime) { return updateAltimeterSetting(stageSampleTime); });
 
   // update fly-by-wire
-  result &= updateFlyByWire(calculatedSampleTime);
+  result &= stageTimings.measure(STAGE_FLY_BY_WIRE, [&] { return updateFlyByWire(calculatedSampleTime); });
 
-  for (int i = 0; i < 2; i++) {
-    result &= updateRa(i);
-  }
+  // update sensors and busses of the systems that are not modelled
+  result &= stageTimings.measure(STAGE_SENSORS, [&] {
+    bool sensorResult = true;
 
-  for (int i = 0; i < 2; i++) {
-    result &= updateLgciu(i);
-  }
+    for (int i = 0; i < 2; i++) {
+      sensorResult &= updateRa(i);
+    }
 
-  for (int i = 0; i < 2; i++) {
-    result &= updateSfcc(i);
-  }
+    for (int i = 0; i < 2; i++) {
+      sensorResult &= updateLgciu(i);
+    }
 
-  for (int i = 0; i < 2; i++) {
-    result &= updateFadec(i);
-  }
+    for (int i = 0; i < 2; i++) {
+      sensorResult &= updateSfcc(i);
+    }
 
-  for (int i = 0; i < 2; i++) {
-    result &= updateIls(i);
-  }
+    for (int i = 0; i < 2; i++) {
+      sensorResult &= updateIls(i);
+    }
 
-  for (int i = 0; i < 3; i++) {
-    result &= updateAdirs(i);
-  }
+    for (int i = 0; i < 3; i++) {
+      sensorResult &= updateAdirs(i);
+    }
+
+    return sensorResult;
+  });
+
+  result &= runStage(STAGE_FADEC_BUS, calculatedSampleTime, [&](double) {
+    bool fadecBusResult = true;
+    for (int i = 0; i < 2; i++) {
+      fadecBusResult &= updateFadec(i);
+    }
+    return fadecBusResult;
+  });
 
-  result &= updateTcas();
+  result &= runStage(STAGE_TCAS, calculatedSampleTime, [&](double) { return updateTcas(); });
 
-  result &= updateFcu(calculatedSampleTime);
+  result &= stageTimings.measure(STAGE_FCU, [&] { return updateFcu(calculatedSampleTime); });
 
-  result &= updateFcuShim();
+  result &= runStage(STAGE_FCU_SHIM, calculatedSampleTime, [&](double) { return updateFcuShim(); });
 
   for (int i = 0; i < 2; i++) {
-    result &= updateFmgc(calculatedSampleTime, i);
+    result &= runStage(STAGE_FMGC_1 + i, calculatedSampleTime, [&](double stageSampleTime) { return updateFmgc(stageSampleTime, i); });
   }
 
-  result &= updateFmgcShim(calculatedSampleTime);
+  result &= runStage(STAGE_FMGC_SHIM, calculatedSampleTime, [&](double stageSampleTime) { return updateFmgcShim(stageSampleTime); });
+
+  // split the frame into the sub-steps of the ELACs
+  bool elacFixedStepActive = elacFixedStep.isEnabled() && !simConnectInterface.isSimInActivePause();
+  if (elacFixedStepActive) {
+    elacFixedStep.beginFrame(calculatedSampleTime);
+    elacFixedStepExecutionTime = std::chrono::steady_clock::duration::zero();
+    if (elacFixedStep.isLimited() && !elacFixedStepLimitLogged) {
+      elacFixedStepLimitLogged = true;
+      std::cout << "WASM: WARNING ELAC fixed step limited to " << elacFixedStep.getSubSteps() << " sub-steps of ";
+      std::cout << elacFixedStep.getSubStepTime() * 1000 << " ms!" << std::endl;
+    }
+  }
 
   for (int i = 0; i < 2; i++) {
-    result &= updateElac(calculatedSampleTime, i);
+    result &= stageTimings.measure(STAGE_ELAC_1 + i, [&] { return updateElac(calculatedSampleTime, i); });
+  }
+
+  // the budget applies to the sub-steps of both ELACs together
+  if (elacFixedStepActive) {
+    elacFixedStep.recordExecutionTime(elacFixedStepExecutionTime);
   }
 
   for (int i = 0; i < 3; i++) {
-    result &= updateSec(calculatedSampleTime, i);
+    result &= stageTimings.measure(STAGE_SEC_1 + i, [&] { return updateSec(calculatedSampleTime, i); });
   }
 
   for (int i = 0; i < 2; i++) {
-    result &= updateFac(calculatedSampleTime, i);
+    result &= stageTimings.measure(STAGE_FAC_1 + i, [&] { return updateFac(calculatedSampleTime, i); });
   }
 
   for (int i = 0; i < 2; i++) {
-    result &= updateFcdc(calculatedSampleTime, i);
+    result &= stageTimings.measure(STAGE_FCDC_1 + i, [&] { return updateFcdc(calculatedSampleTime, i); });
   }
 
   for (int i = 0; i < 2; i++) {
-    result &= updateFadec(calculatedSampleTime, i);
+    result &= stageTimings.measure(STAGE_FADEC_1 + i, [&] { return updateFadec(calculatedSampleTime, i); });
   }
 
+  // send the client data of all computers as one block when the bulk transfer is enabled
+  result &= simConnectInterface.sendClientDataInputBlock();
+
   result &= updateServoSolenoidStatus();
 
   // update recording data
-  result &= updateBaseData(calculatedSampleTime);
-  result &= updateAircraftSpecificData(calculatedSampleTime);
+  result &= stageTimings.measure(STAGE_RECORDING_DATA, [&] {
+    bool recordingResult = updateBaseData(calculatedSampleTime);
+    recordingResult &= updateAircraftSpecificData(calculatedSampleTime);
+    return recordingResult;
+  });
 
   // update spoilers
-  result &= updateSpoilers(calculatedSampleTime);
+  result &= stageTimings.measure(STAGE_SPOILERS, [&] { return updateSpoilers(calculatedSampleTime); });
 
   // do not further process when active pause is on
   if (!simConnectInterface.isSimInActivePause()) {
     // update flight data recorder
-    flightDataRecorder.update(baseData, aircraftSpecificData, elacs, secs, facs, fmgcs[0].getDebugOutputs(), fmgcs[1].getDebugOutputs(),
-                              fadecs);
+    stageTimings.measure(STAGE_FLIGHT_DATA_RECORDER, [&] {
+      flightDataRecorder.update(baseData, aircraftSpecificData, elacs, secs, facs, fmgcs[0].getDebugOutputs(),
+                                fmgcs[1].getDebugOutputs(), fadecs);
+      return true;
+    });
   }
 
+  // update model replay recording, written whenever a computer was stepped
+  stageTimings.measure(STAGE_MODEL_REPLAY, [&] {
+    flightDataRecorder.updateModelReplay(elacs, secs, facs, fmgcs, fadecs);
+    return true;
+  });
+
   // if default AP is on -> disconnect it
   if (simData.autopilot_master_on) {
     simConnectInterface.sendEvent(SimConnectInterface::Events::AUTOPILOT_OFF);
@@ -176,6 +340,9 @@ bool FlyByWireInterface::update(double sampleTime) {
   // reset was in slew flag
   wasInSlew = false;
 
+  // write local variables
+  flushLocalVariables();
+
   // return result
   return result;
 }
@@ -187,14 +354,14 @@ void FlyByWireInterface::loadConfiguration() {
   iniFile.read(iniStructure);
 
   // --------------------------------------------------------------------------
-  // load values - model
+  // load values - model, these need a restart of the flight to change
   elacDisabled = INITypeConversion::getInteger(iniStructure, "MODEL", "ELAC_DISABLED", -1);
   secDisabled = INITypeConversion::getInteger(iniStructure, "MODEL", "SEC_DISABLED", -1);
   facDisabled = INITypeConversion::getInteger(iniStructure, "MODEL", "FAC_DISABLED", -1);
   fcuDisabled = INITypeConversion::getBoolean(iniStructure, "MODEL", "FCU_DISABLED", false);
   fmgcDisabled = INITypeConversion::getInteger(iniStructure, "MODEL", "FMGC_DISABLED", -1);
   fadecDisabled = INITypeConversion::getInteger(iniStructure, "MODEL", "FADEC_DISABLED", -1);
-  tailstrikeProtectionEnabled = INITypeConversion::getBoolean(iniStructure, "MODEL", "TAILSTRIKE_PROTECTION_ENABLED", false);
+  clientDataBulkTransferEnabled = INITypeConversion::getBoolean(iniStructure, "MODEL", "CLIENT_DATA_BULK_TRANSFER_ENABLED", false);
 
   // if any model is deactivated we need to enable client data
   clientDataEnabled =
@@ -202,63 +369,20 @@ void FlyByWireInterface::loadConfiguration() {
 
   // print configuration into console
   std::cout << "WASM: MODEL     : CLIENT_DATA_ENABLED (auto)           = " << clientDataEnabled << std::endl;
+  std::cout << "WASM: MODEL     : CLIENT_DATA_BULK_TRANSFER_ENABLED    = " << clientDataBulkTransferEnabled << std::endl;
   std::cout << "WASM: MODEL     : ELAC_DISABLED                        = " << elacDisabled << std::endl;
   std::cout << "WASM: MODEL     : SEC_DISABLED                         = " << secDisabled << std::endl;
   std::cout << "WASM: MODEL     : FAC_DISABLED                         = " << facDisabled << std::endl;
   std::cout << "WASM: MODEL     : FCU_DISABLED                         = " << fcuDisabled << std::endl;
   std::cout << "WASM: MODEL     : FMGC_DISABLED                        = " << fmgcDisabled << std::endl;
   std::cout << "WASM: MODEL     : FADEC_DISABLED                       = " << fadecDisabled << std::endl;
-  std::cout << "WASM: MODEL     : TAILSTRIKE_PROTECTION_ENABLED        = " << tailstrikeProtectionEnabled << std::endl;
-
-  // --------------------------------------------------------------------------
-  // load values - autopilot
-  idMinimumSimulationRate->set(INITypeConversion::getDouble(iniStructure, "AUTOPILOT", "MINIMUM_SIMULATION_RATE", 1));
-  idMaximumSimulationRate->set(INITypeConversion::getDouble(iniStructure, "AUTOPILOT", "MAXIMUM_SIMULATION_RATE", 8));
-  limitSimulationRateByPerformance = INITypeConversion::getBoolean(iniStructure, "AUTOPILOT", "LIMIT_SIMULATION_RATE_BY_PERFORMANCE", true);
-  simulationRateReductionEnabled = INITypeConversion::getBoolean(iniStructure, "AUTOPILOT", "SIMULATION_RATE_REDUCTION_ENABLED", true);
-
-  // print configuration into console
-  std::cout << "WASM: AUTOPILOT : MINIMUM_SIMULATION_RATE                     = " << idMinimumSimulationRate->get() << std::endl;
-  std::cout << "WASM: AUTOPILOT : MAXIMUM_SIMULATION_RATE                     = " << idMaximumSimulationRate->get() << std::endl;
-  std::cout << "WASM: AUTOPILOT : LIMIT_SIMULATION_RATE_BY_PERFORMANCE        = " << limitSimulationRateByPerformance << std::endl;
-  std::cout << "WASM: AUTOPILOT : SIMULATION_RATE_REDUCTION_ENABLED           = " << simulationRateReductionEnabled << std::endl;
-
-  // --------------------------------------------------------------------------
-  // load values - autothrust
-  autothrustThrustLimitReversePercentageToga =
-      INITypeConversion::getDouble(iniStructure, "AUTOTHRUST", "THRUST_LIMIT_REVERSE_PERCENTAGE_TOGA", 0.813);
-
-  // print configuration into console
-  std::cout << "WASM: AUTOTHRUST : THRUST_LIMIT_REVERSE_PERCENTAGE_TOGA    = " << autothrustThrustLimitReversePercentageToga << std::endl;
-
-  // --------------------------------------------------------------------------
-  // load values - flight controls
-  flightControlsKeyChangeAileron = INITypeConversion::getDouble(iniStructure, "FLIGHT_CONTROLS", "KEY_CHANGE_AILERON", 0.02);
-  flightControlsKeyChangeAileron = abs(flightControlsKeyChangeAileron);
-  flightControlsKeyChangeElevator = INITypeConversion::getDouble(iniStructure, "FLIGHT_CONTROLS", "KEY_CHANGE_ELEVATOR", 0.02);
-  flightControlsKeyChangeElevator = abs(flightControlsKeyChangeElevator);
-  flightControlsKeyChangeRudder = INITypeConversion::getDouble(iniStructure, "FLIGHT_CONTROLS", "KEY_CHANGE_RUDDER", 0.02);
-  flightControlsKeyChangeRudder = abs(flightControlsKeyChangeRudder);
-  disableXboxCompatibilityRudderAxisPlusMinus =
-      INITypeConversion::getBoolean(iniStructure, "FLIGHT_CONTROLS", "DISABLE_XBOX_COMPATIBILITY_RUDDER_AXIS_PLUS_MINUS", false);
-  enableRudder2AxisMode = INITypeConversion::getBoolean(iniStructure, "FLIGHT_CONTROLS", "ENABLE_RUDDER_2_AXIS", false);
-
-  // print configuration into console
-  std::cout << "WASM: FLIGHT_CONTROLS : KEY_CHANGE_AILERON = " << flightControlsKeyChangeAileron << std::endl;
-  std::cout << "WASM: FLIGHT_CONTROLS : KEY_CHANGE_ELEVATOR = " << flightControlsKeyChangeElevator << std::endl;
-  std::cout << "WASM: FLIGHT_CONTROLS : KEY_CHANGE_RUDDER = " << flightControlsKeyChangeRudder << std::endl;
-  std::cout << "WASM: FLIGHT_CONTROLS : DISABLE_XBOX_COMPATIBILITY_RUDDER_AXIS_PLUS_MINUS = " << disableXboxCompatibilityRudderAxisPlusMinus
-            << std::endl;
-  std::cout << "WASM: FLIGHT_CONTROLS : ENABLE_RUDDER_2_AXIS = " << enableRudder2AxisMode << std::endl;
 
-  // --------------------------------------------------------------------------
-  // load values - logging
-  idLoggingFlightControlsEnabled->set(INITypeConversion::getBoolean(iniStructure, "LOGGING", "FLIGHT_CONTROLS_ENABLED", false));
-  idLoggingThrottlesEnabled->set(INITypeConversion::getBoolean(iniStructure, "LOGGING", "THROTTLES_ENABLED", false));
+  // load the values that can be reloaded while the flight is running
+  applyConfiguration(iniStructure, false);
 
-  // print configuration into console
-  std::cout << "WASM: LOGGING : FLIGHT_CONTROLS_ENABLED = " << idLoggingFlightControlsEnabled->get() << std::endl;
-  std::cout << "WASM: LOGGING : THROTTLES_ENABLED = " << idLoggingThrottlesEnabled->get() << std::endl;
+  // remember the applied configuration and start watching the file for changes
+  configuration = iniStructure;
+  configurationWatcher.reset();
 
   // --------------------------------------------------------------------------
   // create axis and load configuration
@@ -281,307 +405,505 @@ void FlyByWireInterface::loadConfiguration() {
   idThrottlePositionLookupTable3d.initialize(mappingTable3d, 0, 100);
 }
 
+void FlyByWireInterface::applyConfiguration(const INIStructure& iniStructure, bool reload) {
+  // on a reload only the keys whose value changed are applied, so values modified at runtime through the local
+  // variables are kept
+  auto changed = [&](const std::string& section, const std::string& key) {
+    return !reload || iniStructure.get(section).get(key) != configuration.get(section).get(key);
+  };
+
+  // --------------------------------------------------------------------------
+  // load values - model
+  if (changed("MODEL", "TAILSTRIKE_PROTECTION_ENABLED")) {
+    tailstrikeProtectionEnabled = INITypeConversion::getBoolean(iniStructure, "MODEL", "TAILSTRIKE_PROTECTION_ENABLED", false);
+  }
+  if (changed("MODEL", "ELAC_FIXED_STEP_RATE")) {
+    elacFixedStep.setRate(INITypeConversion::getDouble(iniStructure, "MODEL", "ELAC_FIXED_STEP_RATE", 0));
+  }
+  if (changed("MODEL", "ELAC_FIXED_STEP_MAX_SUB_STEPS")) {
+    elacFixedStep.setMaximumSubSteps(INITypeConversion::getInteger(iniStructure, "MODEL", "ELAC_FIXED_STEP_MAX_SUB_STEPS", 16));
+  }
+  if (changed("MODEL", "ELAC_FIXED_STEP_BUDGET_US")) {
+    elacFixedStep.setBudget(INITypeConversion::getDouble(iniStructure, "MODEL", "ELAC_FIXED_STEP_BUDGET_US", 2000));
+  }
+
+  // --------------------------------------------------------------------------
+  // load values - autopilot
+  if (changed("AUTOPILOT", "MINIMUM_SIMULATION_RATE")) {
+    idMinimumSimulationRate->set(INITypeConversion::getDouble(iniStructure, "AUTOPILOT", "MINIMUM_SIMULATION_RATE", 1));
+  }
+  if (changed("AUTOPILOT", "MAXIMUM_SIMULATION_RATE")) {
+    idMaximumSimulationRate->set(INITypeConversion::getDouble(iniStructure, "AUTOPILOT", "MAXIMUM_SIMULATION_RATE", 8));
+  }
+  if (changed("AUTOPILOT", "LIMIT_SIMULATION_RATE_BY_PERFORMANCE")) {
+    limitSimulationRateByPerformance =
+        INITypeConversion::getBoolean(iniStructure, "AUTOPILOT", "LIMIT_SIMULATION_RATE_BY_PERFORMANCE", true);
+    simConnectInterface.setLimitSimulationRateByPerformance(limitSimulationRateByPerformance);
+  }
+  if (changed("AUTOPILOT", "SIMULATION_RATE_REDUCTION_ENABLED")) {
+    simulationRateReductionEnabled = INITypeConversion::getBoolean(iniStructure, "AUTOPILOT", "SIMULATION_RATE_REDUCTION_ENABLED", true);
+  }
+  if (changed("AUTOPILOT", "SIMULATION_RATE_RECOVERY_ENABLED")) {
+    simulationRateRecoveryEnabled = INITypeConversion::getBoolean(iniStructure, "AUTOPILOT", "SIMULATION_RATE_RECOVERY_ENABLED", true);
+    simulationRateGovernor.setRecoveryEnabled(simulationRateRecoveryEnabled);
+  }
+  if (changed("AUTOPILOT", "SIMULATION_RATE_RECOVERY_DELAY")) {
+    simulationRateRecoveryDelay = INITypeConversion::getDouble(iniStructure, "AUTOPILOT", "SIMULATION_RATE_RECOVERY_DELAY", 10);
+    simulationRateGovernor.setRecoveryDelay(simulationRateRecoveryDelay);
+  }
+
+  // --------------------------------------------------------------------------
+  // load values - autothrust
+  if (changed("AUTOTHRUST", "THRUST_LIMIT_REVERSE_PERCENTAGE_TOGA")) {
+    autothrustThrustLimitReversePercentageToga =
+        INITypeConversion::getDouble(iniStructure, "AUTOTHRUST", "THRUST_LIMIT_REVERSE_PERCENTAGE_TOGA", 0.813);
+  }
+
+  // --------------------------------------------------------------------------
+  // load values - flight controls
+  if (changed("FLIGHT_CONTROLS", "KEY_CHANGE_AILERON")) {
+    flightControlsKeyChangeAileron = abs(INITypeConversion::getDouble(iniStructure, "FLIGHT_CONTROLS", "KEY_CHANGE_AILERON", 0.02));
+  }
+  if (changed("FLIGHT_CONTROLS", "KEY_CHANGE_ELEVATOR")) {
+    flightControlsKeyChangeElevator = abs(INITypeConversion::getDouble(iniStructure, "FLIGHT_CONTROLS", "KEY_CHANGE_ELEVATOR", 0.02));
+  }
+  if (changed("FLIGHT_CONTROLS", "KEY_CHANGE_RUDDER")) {
+    flightControlsKeyChangeRudder = abs(INITypeConversion::getDouble(iniStructure, "FLIGHT_CONTROLS", "KEY_CHANGE_RUDDER", 0.02));
+  }
+  if (changed("FLIGHT_CONTROLS", "DISABLE_XBOX_COMPATIBILITY_RUDDER_AXIS_PLUS_MINUS")) {
+    disableXboxCompatibilityRudderAxisPlusMinus =
+        INITypeConversion::getBoolean(iniStructure, "FLIGHT_CONTROLS", "DISABLE_XBOX_COMPATIBILITY_RUDDER_AXIS_PLUS_MINUS", false);
+  }
+  if (changed("FLIGHT_CONTROLS", "ENABLE_RUDDER_2_AXIS")) {
+    enableRudder2AxisMode = INITypeConversion::getBoolean(iniStructure, "FLIGHT_CONTROLS", "ENABLE_RUDDER_2_AXIS", false);
+  }
+  if (reload) {
+    simConnectInterface.updateFlightControlsConfiguration(flightControlsKeyChangeAileron, flightControlsKeyChangeElevator,
+                                                          flightControlsKeyChangeRudder, disableXboxCompatibilityRudderAxisPlusMinus,
+                                                          enableRudder2AxisMode);
+  }
+
+  // --------------------------------------------------------------------------
+  // load values - logging
+  if (changed("LOGGING", "FLIGHT_CONTROLS_ENABLED")) {
+    idLoggingFlightControlsEnabled->set(INITypeConversion::getBoolean(iniStructure, "LOGGING", "FLIGHT_CONTROLS_ENABLED", false));
+  }
+  if (changed("LOGGING", "THROTTLES_ENABLED")) {
+    idLoggingThrottlesEnabled->set(INITypeConversion::getBoolean(iniStructure, "LOGGING", "THROTTLES_ENABLED", false));
+  }
+
+  // --------------------------------------------------------------------------
+  // load values - performance
+  if (changed("PERFORMANCE", "STAGE_TIMING_ENABLED")) {
+    idStageTimingEnabled->set(INITypeConversion::getBoolean(iniStructure, "PERFORMANCE", "STAGE_TIMING_ENABLED", false));
+  }
+  // rates of the scheduled stages in Hz, 0 runs the stage every frame
+  for (auto stage : SCHEDULED_STAGES) {
+    std::string key = "RATE_" + stageTimings.getStageName(stage);
+    if (changed("PERFORMANCE", key)) {
+      stageScheduler.setRate(stage, INITypeConversion::getDouble(iniStructure, "PERFORMANCE", key, 0));
+    }
+  }
+
+  // the changed keys are printed by the reload
+  if (reload) {
+    return;
+  }
+
+  // print configuration into console
+  std::cout << "WASM: MODEL     : TAILSTRIKE_PROTECTION_ENABLED        = " << tailstrikeProtectionEnabled << std::endl;
+  std::cout << "WASM: MODEL     : ELAC_FIXED_STEP_RATE                 = " << elacFixedStep.getRate() << std::endl;
+  std::cout << "WASM: MODEL     : ELAC_FIXED_STEP_MAX_SUB_STEPS        = " << elacFixedStep.getMaximumSubSteps() << std::endl;
+  std::cout << "WASM: MODEL     : ELAC_FIXED_STEP_BUDGET_US            = " << elacFixedStep.getBudget() << std::endl;
+  std::cout << "WASM: AUTOPILOT : MINIMUM_SIMULATION_RATE                     = " << idMinimumSimulationRate->get() << std::endl;
+  std::cout << "WASM: AUTOPILOT : MAXIMUM_SIMULATION_RATE                     = " << idMaximumSimulationRate->get() << std::endl;
+  std::cout << "WASM: AUTOPILOT : LIMIT_SIMULATION_RATE_BY_PERFORMANCE        = " << limitSimulationRateByPerformance << std::endl;
+  std::cout << "WASM: AUTOPILOT : SIMULATION_RATE_REDUCTION_ENABLED           = " << simulationRateReductionEnabled << std::endl;
+  std::cout << "WASM: AUTOPILOT : SIMULATION_RATE_RECOVERY_ENABLED            = " << simulationRateRecoveryEnabled << std::endl;
+  std::cout << "WASM: AUTOPILOT : SIMULATION_RATE_RECOVERY_DELAY              = " << simulationRateRecoveryDelay << std::endl;
+  std::cout << "WASM: AUTOTHRUST : THRUST_LIMIT_REVERSE_PERCENTAGE_TOGA    = " << autothrustThrustLimitReversePercentageToga << std::endl;
+  std::cout << "WASM: FLIGHT_CONTROLS : KEY_CHANGE_AILERON = " << flightControlsKeyChangeAileron << std::endl;
+  std::cout << "WASM: FLIGHT_CONTROLS : KEY_CHANGE_ELEVATOR = " << flightControlsKeyChangeElevator << std::endl;
+  std::cout << "WASM: FLIGHT_CONTROLS : KEY_CHANGE_RUDDER = " << flightControlsKeyChangeRudder << std::endl;
+  std::cout << "WASM: FLIGHT_CONTROLS : DISABLE_XBOX_COMPATIBILITY_RUDDER_AXIS_PLUS_MINUS = " << disableXboxCompatibilityRudderAxisPlusMinus
+            << std::endl;
+  std::cout << "WASM: FLIGHT_CONTROLS : ENABLE_RUDDER_2_AXIS = " << enableRudder2AxisMode << std::endl;
+  std::cout << "WASM: LOGGING : FLIGHT_CONTROLS_ENABLED = " << idLoggingFlightControlsEnabled->get() << std::endl;
+  std::cout << "WASM: LOGGING : THROTTLES_ENABLED = " << idLoggingThrottlesEnabled->get() << std::endl;
+  std::cout << "WASM: PERFORMANCE : STAGE_TIMING_ENABLED = " << idStageTimingEnabled->get() << std::endl;
+  for (auto stage : SCHEDULED_STAGES) {
+    std::cout << "WASM: PERFORMANCE : RATE_" << stageTimings.getStageName(stage) << " = " << stageScheduler.getRate(stage) << std::endl;
+  }
+}
+
+bool FlyByWireInterface::updateConfiguration(double sampleTime) {
+  if (!configurationWatcher.hasChanged(sampleTime)) {
+    return true;
+  }
+
+  // parse the complete file before anything is applied
+  INIStructure iniStructure;
+  INIFile iniFile(CONFIGURATION_FILEPATH);
+  if (!iniFile.read(iniStructure)) {
+    std::cout << "WASM: Failed to reload configuration from " << CONFIGURATION_FILEPATH << std::endl;
+    return true;
+  }
+
+  std::cout << "WASM: Reloading configuration from " << CONFIGURATION_FILEPATH << std::endl;
+  printConfigurationChanges(iniStructure);
+
+  applyConfiguration(iniStructure, true);
+  configuration = iniStructure;
+
+  return true;
+}
+
+void FlyByWireInterface::printConfigurationChanges(const INIStructure& iniStructure) const {
+  auto print = [](const std::string& section, const std::string& key, const std::string& value) {
+    std::string name = section + " : " + key;
+    std::transform(name.begin(), name.end(), name.begin(), ::toupper);
+    // the model keys are only read when connecting
+    bool restartRequired = section == "model" && (key.find("_disabled") != std::string::npos || key == "client_data_bulk_transfer_enabled");
+    std::cout << "WASM: " << name << " = " << value << (restartRequired ? " (requires a restart of the flight)" : "") << std::endl;
+  };
+
+  // changed and added keys
+  for (const auto& section : iniStructure) {
+    auto previousSection = configuration.get(section.first);
+    for (const auto& entry : section.second) {
+      if (!previousSection.has(entry.first) || previousSection.get(entry.first) != entry.second) {
+        print(section.first, entry.first, entry.second);
+      }
+    }
+  }
+
+  // removed keys fall back to their default
+  for (const auto& section : configuration) {
+    auto currentSection = iniStructure.get(section.first);
+    for (const auto& entry : section.second) {
+      if (!currentSection.has(entry.first)) {
+        print(section.first, entry.first, "(default)");
+      }
+    }
+  }
+}
+
 void FlyByWireInterface::setupLocalVariables() {
   // regsiter L variable for init state and ready signal
-  idIsReady = std::make_unique<LocalVariable>("A32NX_IS_READY");
-  idStartState = std::make_unique<LocalVariable>("A32NX_START_STATE");
+  idIsReady = localVariables.create("A32NX_IS_READY");
+  idStartState = localVariables.create("A32NX_START_STATE");
 
   // regsiter L variable for logging
-  idLoggingFlightControlsEnabled = std::make_unique<LocalVariable>("A32NX_LOGGING_FLIGHT_CONTROLS_ENABLED");
-  idLoggingThrottlesEnabled = std::make_unique<LocalVariable>("A32NX_LOGGING_THROTTLES_ENABLED");
+  idLoggingFlightControlsEnabled = localVariables.create("A32NX_LOGGING_FLIGHT_CONTROLS_ENABLED");
+  idLoggingThrottlesEnabled = localVariables.create("A32NX_LOGGING_THROTTLES_ENABLED");
 
   // register L variables for Autoland
-  idDevelopmentAutoland_condition_Flare = std::make_unique<LocalVariable>("A32NX_DEV_FLARE_CONDITION");
-  idDevelopmentAutoland_H_dot_fpm = std::make_unique<LocalVariable>("A32NX_DEV_FLARE_H_DOT");
-  idDevelopmentAutoland_H_dot_c_fpm = std::make_unique<LocalVariable>("A32NX_DEV_FLARE_H_DOT_C");
-  idDevelopmentAutoland_delta_Theta_H_dot_deg = std::make_unique<LocalVariable>("A32NX_DEV_FLARE_DELTA_THETA_H_DOT");
-  idDevelopmentAutoland_delta_Theta_bz_deg = std::make_unique<LocalVariable>("A32NX_DEV_FLARE_DELTA_THETA_BZ");
-  idDevelopmentAutoland_delta_Theta_bx_deg = std::make_unique<LocalVariable>("A32NX_DEV_FLARE_DELTA_THETA_BX");
-  idDevelopmentAutoland_delta_Theta_beta_c_deg = std::make_unique<LocalVariable>("A32NX_DEV_FLARE_DELTA_THETA_BETA_C");
+  idDevelopmentAutoland_condition_Flare = localVariables.create("A32NX_DEV_FLARE_CONDITION");
+  idDevelopmentAutoland_H_dot_fpm = localVariables.create("A32NX_DEV_FLARE_H_DOT");
+  idDevelopmentAutoland_H_dot_c_fpm = localVariables.create("A32NX_DEV_FLARE_H_DOT_C");
+  idDevelopmentAutoland_delta_Theta_H_dot_deg = localVariables.create("A32NX_DEV_FLARE_DELTA_THETA_H_DOT");
+  idDevelopmentAutoland_delta_Theta_bz_deg = localVariables.create("A32NX_DEV_FLARE_DELTA_THETA_BZ");
+  idDevelopmentAutoland_delta_Theta_bx_deg = localVariables.create("A32NX_DEV_FLARE_DELTA_THETA_BX");
+  idDevelopmentAutoland_delta_Theta_beta_c_deg = localVariables.create("A32NX_DEV_FLARE_DELTA_THETA_BETA_C");
 
   // register L variable for simulation rate limits
-  idMinimumSimulationRate = std::make_unique<LocalVariable>("A32NX_SIMULATION_RATE_LIMIT_MINIMUM");
-  idMaximumSimulationRate = std::make_unique<LocalVariable>("A32NX_SIMULATION_RATE_LIMIT_MAXIMUM");
+  idMinimumSimulationRate = localVariables.create("A32NX_SIMULATION_RATE_LIMIT_MINIMUM");
+  idMaximumSimulationRate = localVariables.create("A32NX_SIMULATION_RATE_LIMIT_MAXIMUM");
 
   // register L variable for performance warning
-  idPerformanceWarningActive = std::make_unique<LocalVariable>("A32NX_PERFORMANCE_WARNING_ACTIVE");
+  idPerformanceWarningActive = localVariables.create("A32NX_PERFORMANCE_WARNING_ACTIVE");
+
+  // register L variables for the simulation rate governor, only written by this module so unchanged values are skipped
+  idSimulationRateGovernorDecision = localVariables.create("A32NX_SIMULATION_RATE_GOVERNOR_DECISION", true);
+  idSimulationRateGovernorReason = localVariables.create("A32NX_SIMULATION_RATE_GOVERNOR_REASON", true);
+  idSimulationRateGovernorRequestedRate = localVariables.create("A32NX_SIMULATION_RATE_GOVERNOR_REQUESTED_RATE", true);
+  idSimulationRateGovernorSafeRate = localVariables.create("A32NX_SIMULATION_RATE_GOVERNOR_SAFE_RATE", true);
+
+  // register L variables for stage timings, the statistics are only written by this module so unchanged values are
+  // skipped
+  idStageTimingEnabled = localVariables.create("A32NX_FBW_STAGE_TIMING_ENABLED");
+  idStageTimingSelectedStage = localVariables.create("A32NX_FBW_STAGE_TIMING_SELECTED_STAGE");
+  idStageTimingMinimum = localVariables.create("A32NX_FBW_STAGE_TIMING_MIN_US", true);
+  idStageTimingMean = localVariables.create("A32NX_FBW_STAGE_TIMING_MEAN_US", true);
+  idStageTimingP99 = localVariables.create("A32NX_FBW_STAGE_TIMING_P99_US", true);
+  idStageTimingMaximum = localVariables.create("A32NX_FBW_STAGE_TIMING_MAX_US", true);
+  idStageTimingWriteToFile = localVariables.create("A32NX_FBW_STAGE_TIMING_WRITE_TO_FILE");
+  idStageTimingRate = localVariables.create("A32NX_FBW_STAGE_TIMING_RATE_HZ", true);
+  idStageTimingMeanInterval = localVariables.create("A32NX_FBW_STAGE_TIMING_MEAN_INTERVAL_MS", true);
+  idStageTimingRmsJitter = localVariables.create("A32NX_FBW_STAGE_TIMING_RMS_JITTER_MS", true);
+  idStageTimingMaximumJitter = localVariables.create("A32NX_FBW_STAGE_TIMING_MAX_JITTER_MS", true);
 
   // register L variable for external override
-  idTrackingMode = std::make_unique<LocalVariable>("A32NX_FLIGHT_CONTROLS_TRACKING_MODE");
-  idExternalOverride = std::make_unique<LocalVariable>("A32NX_EXTERNAL_OVERRIDE");
+  idTrackingMode = localVariables.create("A32NX_FLIGHT_CONTROLS_TRACKING_MODE");
+  idExternalOverride = localVariables.create("A32NX_EXTERNAL_OVERRIDE");
 
   // register L variable for FDR event
-  idFdrEvent = std::make_unique<LocalVariable>("A32NX_DFDR_EVENT_ON");
+  idFdrEvent = localVariables.create("A32NX_DFDR_EVENT_ON");
 
   // register L variables for the sidestick
-  idSideStickPositionX = std::make_unique<LocalVariable>("A32NX_SIDESTICK_POSITION_X");
-  idSideStickPositionY = std::make_unique<LocalVariable>("A32NX_SIDESTICK_POSITION_Y");
-  idRudderPedalPosition = std::make_unique<LocalVariable>("A32NX_RUDDER_PEDAL_POSITION");
+  idSideStickPositionX = localVariables.create("A32NX_SIDESTICK_POSITION_X");
+  idSideStickPositionY = localVariables.create("A32NX_SIDESTICK_POSITION_Y");
+  idRudderPedalPosition = localVariables.create("A32NX_RUDDER_PEDAL_POSITION");
 
   // register L variables for flight guidance
-  idFwcFlightPhase = std::make_unique<LocalVariable>("A32NX_FWC_FLIGHT_PHASE");
-  idFmgcFlightPhase = std::make_unique<LocalVariable>("A32NX_FMGC_FLIGHT_PHASE");
-  idFmgcV2 = std::make_unique<LocalVariable>("AIRLINER_V2_SPEED");
-  idFmgcV_APP = std::make_unique<LocalVariable>("AIRLINER_VAPP_SPEED");
-  idFmsManagedSpeedTarget = std::make_unique<LocalVariable>("A32NX_SPEEDS_MANAGED_PFD");
-  idFmsPresetMach = std::make_unique<LocalVariable>("A32NX_MachPreselVal");
-  idFmsPresetSpeed = std::make_unique<LocalVariable>("A32NX_SpeedPreselVal");
-
-  idFmgcAltitudeConstraint = std::make_unique<LocalVariable>("A32NX_FG_ALTITUDE_CONSTRAINT");
+  idFwcFlightPhase = localVariables.create("A32NX_FWC_FLIGHT_PHASE");
+  idFmgcFlightPhase = localVariables.create("A32NX_FMGC_FLIGHT_PHASE");
+  idFmgcV2 = localVariables.create("AIRLINER_V2_SPEED");
+  idFmgcV_APP = localVariables.create("AIRLINER_VAPP_SPEED");
+  idFmsManagedSpeedTarget = localVariables.create("A32NX_SPEEDS_MANAGED_PFD");
+  idFmsPresetMach = localVariables.create("A32NX_MachPreselVal");
+  idFmsPresetSpeed = localVariables.create("A32NX_SpeedPreselVal");
+
+  idFmgcAltitudeConstraint = localVariables.create("A32NX_FG_ALTITUDE_CONSTRAINT");
   // FIXME consider FM1/FM2
   // thrust reduction/acceleration ARINC vars
-  idFmgcThrustReductionAltitude = std::make_unique<LocalVariable>("A32NX_FM1_THR_RED_ALT");
-  idFmgcThrustReductionAltitudeGoAround = std::make_unique<LocalVariable>("A32NX_FM1_MISSED_THR_RED_ALT");
-  idFmgcAccelerationAltitude = std::make_unique<LocalVariable>("A32NX_FM1_ACC_ALT");
-  idFmgcAccelerationAltitudeEngineOut = std::make_unique<LocalVariable>("A32NX_FM1_EO_ACC_ALT");
-  idFmgcAccelerationAltitudeGoAround = std::make_unique<LocalVariable>("A32NX_FM1_MISSED_ACC_ALT");
-  idFmgcAccelerationAltitudeGoAroundEngineOut = std::make_unique<LocalVariable>("A32NX_FM1_MISSED_EO_ACC_ALT");
-
-  idFmgcCruiseAltitude = std::make_unique<LocalVariable>("A32NX_AIRLINER_CRUISE_ALTITUDE");
-  idFmgcFlexTemperature = std::make_unique<LocalVariable>("A32NX_AIRLINER_TO_FLEX_TEMP");
-  idFmsLsCourse = std::make_unique<LocalVariable>("A32NX_FM_LS_COURSE");
-
-  idFmsSpeedMarginHigh = std::make_unique<LocalVariable>("A32NX_PFD_UPPER_SPEED_MARGIN");
-  idFmsSpeedMarginLow = std::make_unique<LocalVariable>("A32NX_PFD_LOWER_SPEED_MARGIN");
-  idFmsSpeedMarginVisible = std::make_unique<LocalVariable>("A32NX_PFD_SHOW_SPEED_MARGINS");
-
-  idFlightGuidanceAvailable = std::make_unique<LocalVariable>("A32NX_FG_AVAIL");
-  idFlightGuidanceCrossTrackError = std::make_unique<LocalVariable>("A32NX_FG_CROSS_TRACK_ERROR");
-  idFlightGuidanceTrackAngleError = std::make_unique<LocalVariable>("A32NX_FG_TRACK_ANGLE_ERROR");
-  idFlightGuidancePhiCommand = std::make_unique<LocalVariable>("A32NX_FG_PHI_COMMAND");
-  idFlightGuidancePhiLimit = std::make_unique<LocalVariable>("A32NX_FG_PHI_LIMIT");
-  idFlightGuidanceRequestedVerticalMode = std::make_unique<LocalVariable>("A32NX_FG_REQUESTED_VERTICAL_MODE");
-  idFlightGuidanceTargetAltitude = std::make_unique<LocalVariable>("A32NX_FG_TARGET_ALTITUDE");
-  idFlightGuidanceTargetVerticalSpeed = std::make_unique<LocalVariable>("A32NX_FG_TARGET_VERTICAL_SPEED");
-  idFmRnavAppSelected = std::make_unique<LocalVariable>("A32NX_FG_RNAV_APP_SELECTED");
-  idFmFinalCanEngage = std::make_unique<LocalVariable>("A32NX_FG_FINAL_CAN_ENGAGE");
-
-  idTcasFault = std::make_unique<LocalVariable>("A32NX_TCAS_FAULT");
-  idTcasMode = std::make_unique<LocalVariable>("A32NX_TCAS_MODE");
-  idTcasTaOnly = std::make_unique<LocalVariable>("A32NX_TCAS_TA_ONLY");
-  idTcasState = std::make_unique<LocalVariable>("A32NX_TCAS_STATE");
-  idTcasRaCorrective = std::make_unique<LocalVariable>("A32NX_TCAS_RA_CORRECTIVE");
-  idTcasRaType = std::make_unique<LocalVariable>("A32NX_TCAS_RA_TYPE");
-  idTcasRaRateToMaintain = std::make_unique<LocalVariable>("A32NX_TCAS_RA_RATE_TO_MAINTAIN");
-  idTcasRaUpAdvStatus = std::make_unique<LocalVariable>("A32NX_TCAS_RA_UP_ADVISORY_STATUS");
-  idTcasRaDownAdvStatus = std::make_unique<LocalVariable>("A32NX_TCAS_RA_DOWN_ADVISORY_STATUS");
-  idTcasSensitivityLevel = std::make_unique<LocalVariable>("A32NX_TCAS_SENSITIVITY");
-
-  idThrottlePosition3d_1 = std::make_unique<LocalVariable>("A32NX_3D_THROTTLE_LEVER_POSITION_1");
-  idThrottlePosition3d_2 = std::make_unique<LocalVariable>("A32NX_3D_THROTTLE_LEVER_POSITION_2");
-
-  idAutothrustDisabled = std::make_unique<LocalVariable>("A32NX_AUTOTHRUST_DISABLED");
-  idAutothrustDisconnect = std::make_unique<LocalVariable>("A32NX_AUTOTHRUST_DISCONNECT");
-
-  idAirConditioningPack_1 = std::make_unique<LocalVariable>("A32NX_OVHD_COND_PACK_1_PB_IS_ON");
-  idAirConditioningPack_2 = std::make_unique<LocalVariable>("A32NX_OVHD_COND_PACK_2_PB_IS_ON");
-
-  idAutothrustThrustLimitType = std::make_unique<LocalVariable>("A32NX_AUTOTHRUST_THRUST_LIMIT_TYPE");
-  idAutothrustThrustLimit = std::make_unique<LocalVariable>("A32NX_AUTOTHRUST_THRUST_LIMIT");
-  idAutothrustThrustLimitREV = std::make_unique<LocalVariable>("A32NX_AUTOTHRUST_THRUST_LIMIT_REV");
-  idAutothrustThrustLimitIDLE = std::make_unique<LocalVariable>("A32NX_AUTOTHRUST_THRUST_LIMIT_IDLE");
-  idAutothrustThrustLimitCLB = std::make_unique<LocalVariable>("A32NX_AUTOTHRUST_THRUST_LIMIT_CLB");
-  idAutothrustThrustLimitMCT = std::make_unique<LocalVariable>("A32NX_AUTOTHRUST_THRUST_LIMIT_MCT");
-  idAutothrustThrustLimitFLX = std::make_unique<LocalVariable>("A32NX_AUTOTHRUST_THRUST_LIMIT_FLX");
-  idAutothrustThrustLimitTOGA = std::make_unique<LocalVariable>("A32NX_AUTOTHRUST_THRUST_LIMIT_TOGA");
-  thrustLeverAngle_1 = std::make_unique<LocalVariable>("A32NX_AUTOTHRUST_TLA:1");
-  thrustLeverAngle_2 = std::make_unique<LocalVariable>("A32NX_AUTOTHRUST_TLA:2");
-  idAutothrustN1_TLA_1 = std::make_unique<LocalVariable>("A32NX_AUTOTHRUST_TLA_N1:1");
-  idAutothrustN1_TLA_2 = std::make_unique<LocalVariable>("A32NX_AUTOTHRUST_TLA_N1:2");
-  idAutothrustReverse_1 = std::make_unique<LocalVariable>("A32NX_AUTOTHRUST_REVERSE:1");
-  idAutothrustReverse_2 = std::make_unique<LocalVariable>("A32NX_AUTOTHRUST_REVERSE:2");
-  idAutothrustN1_c_1 = std::make_unique<LocalVariable>("A32NX_AUTOTHRUST_N1_COMMANDED:1");
-  idAutothrustN1_c_2 = std::make_unique<LocalVariable>("A32NX_AUTOTHRUST_N1_COMMANDED:2");
-
-  idMasterWarning = std::make_unique<LocalVariable>("A32NX_MASTER_WARNING");
-  idMasterCaution = std::make_unique<LocalVariable>("A32NX_MASTER_CAUTION");
-  idParkBrakeLeverPos = std::make_unique<LocalVariable>("A32NX_PARK_BRAKE_LEVER_POS");
-  idBrakePedalLeftPos = std::make_unique<LocalVariable>("A32NX_LEFT_BRAKE_PEDAL_INPUT");
-  idBrakePedalRightPos = std::make_unique<LocalVariable>("A32NX_RIGHT_BRAKE_PEDAL_INPUT");
-  idAutobrakeArmedMode = std::make_unique<LocalVariable>("A32NX_AUTOBRAKES_ARMED_MODE");
-  idAutobrakeDecelLight = std::make_unique<LocalVariable>("A32NX_AUTOBRAKES_DECEL_LIGHT");
-  idFlapsHandlePercent = std::make_unique<LocalVariable>("A32NX_FLAPS_HANDLE_PERCENT");
-  idFlapsHandleIndex = std::make_unique<LocalVariable>("A32NX_FLAPS_HANDLE_INDEX");
-  idHydraulicGreenPressure = std::make_unique<LocalVariable>("A32NX_HYD_GREEN_SYSTEM_1_SECTION_PRESSURE");
-  idHydraulicBluePressure = std::make_unique<LocalVariable>("A32NX_HYD_BLUE_SYSTEM_1_SECTION_PRESSURE");
-  idHydraulicYellowPressure = std::make_unique<LocalVariable>("A32NX_HYD_YELLOW_SYSTEM_1_SECTION_PRESSURE");
-
-  flapsHandleIndexFlapConf = std::make_unique<LocalVariable>("A32NX_FLAPS_CONF_INDEX");
-  flapsPosition = std::make_unique<LocalVariable>("A32NX_LEFT_FLAPS_ANGLE");
-
-  idSpoilersArmed = std::make_unique<LocalVariable>("A32NX_SPOILERS_ARMED");
-  idSpoilersHandlePosition = std::make_unique<LocalVariable>("A32NX_SPOILERS_HANDLE_POSITION");
-
-  idRadioReceiverUsageEnabled = std::make_unique<LocalVariable>("A32NX_RADIO_RECEIVER_USAGE_ENABLED");
-  idRadioReceiverLocalizerValid = std::make_unique<LocalVariable>("A32NX_RADIO_RECEIVER_LOC_IS_VALID");
-  idRadioReceiverLocalizerDeviation = std::make_unique<LocalVariable>("A32NX_RADIO_RECEIVER_LOC_DEVIATION");
-  idRadioReceiverLocalizerDistance = std::make_unique<LocalVariable>("A32NX_RADIO_RECEIVER_LOC_DISTANCE");
-  idRadioReceiverGlideSlopeValid = std::make_unique<LocalVariable>("A32NX_RADIO_RECEIVER_GS_IS_VALID");
-  idRadioReceiverGlideSlopeDeviation = std::make_unique<LocalVariable>("A32NX_RADIO_RECEIVER_GS_DEVIATION");
-
-  idFm1BackbeamSelected = std::make_unique<LocalVariable>("A32NX_FM1_BACKBEAM_SELECTED");
-
-  idRealisticTillerEnabled = std::make_unique<LocalVariable>("A32NX_REALISTIC_TILLER_ENABLED");
-  idTillerHandlePosition = std::make_unique<LocalVariable>("A32NX_TILLER_HANDLE_POSITION");
-  idNoseWheelPosition = std::make_unique<LocalVariable>("A32NX_NOSE_WHEEL_POSITION");
-
-  idSyncFoEfisEnabled = std::make_unique<LocalVariable>("A32NX_FO_SYNC_EFIS_ENABLED");
-
-  idLs1Active = std::make_unique<LocalVariable>("BTN_LS_1_FILTER_ACTIVE");
-  idLs2Active = std::make_unique<LocalVariable>("BTN_LS_2_FILTER_ACTIVE");
-  idIsisLsActive = std::make_unique<LocalVariable>("A32NX_ISIS_LS_ACTIVE");
-
-  idWingAntiIce = std::make_unique<LocalVariable>("A32NX_PNEU_WING_ANTI_ICE_SYSTEM_ON");
-
-  idFmGrossWeight = std::make_unique<LocalVariable>("A32NX_FM_GROSS_WEIGHT");
+  idFmgcThrustReductionAltitude = localVariables.create("A32NX_FM1_THR_RED_ALT");
+  idFmgcThrustReductionAltitudeGoAround = localVariables.create("A32NX_FM1_MISSED_THR_RED_ALT");
+  idFmgcAccelerationAltitude = localVariables.create("A32NX_FM1_ACC_ALT");
+  idFmgcAccelerationAltitudeEngineOut = localVariables.create("A32NX_FM1_EO_ACC_ALT");
+  idFmgcAccelerationAltitudeGoAround = localVariables.create("A32NX_FM1_MISSED_ACC_ALT");
+  idFmgcAccelerationAltitudeGoAroundEngineOut = localVariables.create("A32NX_FM1_MISSED_EO_ACC_ALT");
+
+  idFmgcCruiseAltitude = localVariables.create("A32NX_AIRLINER_CRUISE_ALTITUDE");
+  idFmgcFlexTemperature = localVariables.create("A32NX_AIRLINER_TO_FLEX_TEMP");
+  idFmsLsCourse = localVariables.create("A32NX_FM_LS_COURSE");
+
+  idFmsSpeedMarginHigh = localVariables.create("A32NX_PFD_UPPER_SPEED_MARGIN");
+  idFmsSpeedMarginLow = localVariables.create("A32NX_PFD_LOWER_SPEED_MARGIN");
+  idFmsSpeedMarginVisible = localVariables.create("A32NX_PFD_SHOW_SPEED_MARGINS");
+
+  idFlightGuidanceAvailable = localVariables.create("A32NX_FG_AVAIL");
+  idFlightGuidanceCrossTrackError = localVariables.create("A32NX_FG_CROSS_TRACK_ERROR");
+  idFlightGuidanceTrackAngleError = localVariables.create("A32NX_FG_TRACK_ANGLE_ERROR");
+  idFlightGuidancePhiCommand = localVariables.create("A32NX_FG_PHI_COMMAND");
+  idFlightGuidancePhiLimit = localVariables.create("A32NX_FG_PHI_LIMIT");
+  idFlightGuidanceRequestedVerticalMode = localVariables.create("A32NX_FG_REQUESTED_VERTICAL_MODE");
+  idFlightGuidanceTargetAltitude = localVariables.create("A32NX_FG_TARGET_ALTITUDE");
+  idFlightGuidanceTargetVerticalSpeed = localVariables.create("A32NX_FG_TARGET_VERTICAL_SPEED");
+  idFmRnavAppSelected = localVariables.create("A32NX_FG_RNAV_APP_SELECTED");
+  idFmFinalCanEngage = localVariables.create("A32NX_FG_FINAL_CAN_ENGAGE");
+
+  idTcasFault = localVariables.create("A32NX_TCAS_FAULT");
+  idTcasMode = localVariables.create("A32NX_TCAS_MODE");
+  idTcasTaOnly = localVariables.create("A32NX_TCAS_TA_ONLY");
+  idTcasState = localVariables.create("A32NX_TCAS_STATE");
+  idTcasRaCorrective = localVariables.create("A32NX_TCAS_RA_CORRECTIVE");
+  idTcasRaType = localVariables.create("A32NX_TCAS_RA_TYPE");
+  idTcasRaRateToMaintain = localVariables.create("A32NX_TCAS_RA_RATE_TO_MAINTAIN");
+  idTcasRaUpAdvStatus = localVariables.create("A32NX_TCAS_RA_UP_ADVISORY_STATUS");
+  idTcasRaDownAdvStatus = localVariables.create("A32NX_TCAS_RA_DOWN_ADVISORY_STATUS");
+  idTcasSensitivityLevel = localVariables.create("A32NX_TCAS_SENSITIVITY");
+
+  idThrottlePosition3d_1 = localVariables.create("A32NX_3D_THROTTLE_LEVER_POSITION_1");
+  idThrottlePosition3d_2 = localVariables.create("A32NX_3D_THROTTLE_LEVER_POSITION_2");
+
+  idAutothrustDisabled = localVariables.create("A32NX_AUTOTHRUST_DISABLED");
+  idAutothrustDisconnect = localVariables.create("A32NX_AUTOTHRUST_DISCONNECT");
+
+  idAirConditioningPack_1 = localVariables.create("A32NX_OVHD_COND_PACK_1_PB_IS_ON");
+  idAirConditioningPack_2 = localVariables.create("A32NX_OVHD_COND_PACK_2_PB_IS_ON");
+
+  idAutothrustThrustLimitType = localVariables.create("A32NX_AUTOTHRUST_THRUST_LIMIT_TYPE");
+  idAutothrustThrustLimit = localVariables.create("A32NX_AUTOTHRUST_THRUST_LIMIT");
+  idAutothrustThrustLimitREV = localVariables.create("A32NX_AUTOTHRUST_THRUST_LIMIT_REV");
+  idAutothrustThrustLimitIDLE = localVariables.create("A32NX_AUTOTHRUST_THRUST_LIMIT_IDLE");
+  idAutothrustThrustLimitCLB = localVariables.create("A32NX_AUTOTHRUST_THRUST_LIMIT_CLB");
+  idAutothrustThrustLimitMCT = localVariables.create("A32NX_AUTOTHRUST_THRUST_LIMIT_MCT");
+  idAutothrustThrustLimitFLX = localVariables.create("A32NX_AUTOTHRUST_THRUST_LIMIT_FLX");
+  idAutothrustThrustLimitTOGA = localVariables.create("A32NX_AUTOTHRUST_THRUST_LIMIT_TOGA");
+  thrustLeverAngle_1 = localVariables.create("A32NX_AUTOTHRUST_TLA:1");
+  thrustLeverAngle_2 = localVariables.create("A32NX_AUTOTHRUST_TLA:2");
+  idAutothrustN1_TLA_1 = localVariables.create("A32NX_AUTOTHRUST_TLA_N1:1");
+  idAutothrustN1_TLA_2 = localVariables.create("A32NX_AUTOTHRUST_TLA_N1:2");
+  idAutothrustReverse_1 = localVariables.create("A32NX_AUTOTHRUST_REVERSE:1");
+  idAutothrustReverse_2 = localVariables.create("A32NX_AUTOTHRUST_REVERSE:2");
+  idAutothrustN1_c_1 = localVariables.create("A32NX_AUTOTHRUST_N1_COMMANDED:1");
+  idAutothrustN1_c_2 = localVariables.create("A32NX_AUTOTHRUST_N1_COMMANDED:2");
+
+  idMasterWarning = localVariables.create("A32NX_MASTER_WARNING");
+  idMasterCaution = localVariables.create("A32NX_MASTER_CAUTION");
+  idParkBrakeLeverPos = localVariables.create("A32NX_PARK_BRAKE_LEVER_POS");
+  idBrakePedalLeftPos = localVariables.create("A32NX_LEFT_BRAKE_PEDAL_INPUT");
+  idBrakePedalRightPos = localVariables.create("A32NX_RIGHT_BRAKE_PEDAL_INPUT");
+  idAutobrakeArmedMode = localVariables.create("A32NX_AUTOBRAKES_ARMED_MODE");
+  idAutobrakeDecelLight = localVariables.create("A32NX_AUTOBRAKES_DECEL_LIGHT");
+  idFlapsHandlePercent = localVariables.create("A32NX_FLAPS_HANDLE_PERCENT");
+  idFlapsHandleIndex = localVariables.create("A32NX_FLAPS_HANDLE_INDEX");
+
+  flapsHandleIndexFlapConf = localVariables.create("A32NX_FLAPS_CONF_INDEX");
+  flapsPosition = localVariables.create("A32NX_LEFT_FLAPS_ANGLE");
+
+  idSpoilersArmed = localVariables.create("A32NX_SPOILERS_ARMED");
+  idSpoilersHandlePosition = localVariables.create("A32NX_SPOILERS_HANDLE_POSITION");
+
+  idRadioReceiverUsageEnabled = localVariables.create("A32NX_RADIO_RECEIVER_USAGE_ENABLED");
+  idRadioReceiverLocalizerValid = localVariables.create("A32NX_RADIO_RECEIVER_LOC_IS_VALID");
+  idRadioReceiverLocalizerDeviation = localVariables.create("A32NX_RADIO_RECEIVER_LOC_DEVIATION");
+  idRadioReceiverLocalizerDistance = localVariables.create("A32NX_RADIO_RECEIVER_LOC_DISTANCE");
+  idRadioReceiverGlideSlopeValid = localVariables.create("A32NX_RADIO_RECEIVER_GS_IS_VALID");
+  idRadioReceiverGlideSlopeDeviation = localVariables.create("A32NX_RADIO_RECEIVER_GS_DEVIATION");
+
+  idFm1BackbeamSelected = localVariables.create("A32NX_FM1_BACKBEAM_SELECTED");
+
+  idRealisticTillerEnabled = localVariables.create("A32NX_REALISTIC_TILLER_ENABLED");
+  idTillerHandlePosition = localVariables.create("A32NX_TILLER_HANDLE_POSITION");
+  idNoseWheelPosition = localVariables.create("A32NX_NOSE_WHEEL_POSITION");
+
+  idSyncFoEfisEnabled = localVariables.create("A32NX_FO_SYNC_EFIS_ENABLED");
+
+  idIsisLsActive = localVariables.create("A32NX_ISIS_LS_ACTIVE");
+
+  idWingAntiIce = localVariables.create("A32NX_PNEU_WING_ANTI_ICE_SYSTEM_ON");
+
+  idFmGrossWeight = localVariables.create("A32NX_FM_GROSS_WEIGHT");
 
   for (int i = 0; i < 2; i++) {
     std::string idString = std::to_string(i + 1);
-    idRadioAltimeterHeight[i] = std::make_unique<LocalVariable>("A32NX_RA_" + idString + "_RADIO_ALTITUDE");
+    idRadioAltimeterHeight[i] = localVariables.create("A32NX_RA_" + idString + "_RADIO_ALTITUDE");
   }
 
-  idLgciu1NoseGearDownlocked = std::make_unique<LocalVariable>("A32NX_LGCIU_1_NOSE_GEAR_DOWNLOCKED");
+  idLgciu1NoseGearDownlocked = localVariables.create("A32NX_LGCIU_1_NOSE_GEAR_DOWNLOCKED");
 
   for (int i = 0; i < 2; i++) {
     std::string idString = std::to_string(i + 1);
-    idLgciuNoseGearCompressed[i] = std::make_unique<LocalVariable>("A32NX_LGCIU_" + idString + "_NOSE_GEAR_COMPRESSED");
-    idLgciuLeftMainGearCompressed[i] = std::make_unique<LocalVariable>("A32NX_LGCIU_" + idString + "_LEFT_GEAR_COMPRESSED");
-    idLgciuRightMainGearCompressed[i] = std::make_unique<LocalVariable>("A32NX_LGCIU_" + idString + "_RIGHT_GEAR_COMPRESSED");
-    idLgciuDiscreteWord1[i] = std::make_unique<LocalVariable>("A32NX_LGCIU_" + idString + "_DISCRETE_WORD_1");
-    idLgciuDiscreteWord2[i] = std::make_unique<LocalVariable>("A32NX_LGCIU_" + idString + "_DISCRETE_WORD_2");
-    idLgciuDiscreteWord3[i] = std::make_unique<LocalVariable>("A32NX_LGCIU_" + idString + "_DISCRETE_WORD_3");
+    idLgciuNoseGearCompressed[i] = localVariables.create("A32NX_LGCIU_" + idString + "_NOSE_GEAR_COMPRESSED");
+    idLgciuLeftMainGearCompressed[i] = localVariables.create("A32NX_LGCIU_" + idString + "_LEFT_GEAR_COMPRESSED");
+    idLgciuRightMainGearCompressed[i] = localVariables.create("A32NX_LGCIU_" + idString + "_RIGHT_GEAR_COMPRESSED");
+    idLgciuDiscreteWord1[i] = localVariables.create("A32NX_LGCIU_" + idString + "_DISCRETE_WORD_1");
+    idLgciuDiscreteWord2[i] = localVariables.create("A32NX_LGCIU_" + idString + "_DISCRETE_WORD_2");
+    idLgciuDiscreteWord3[i] = localVariables.create("A32NX_LGCIU_" + idString + "_DISCRETE_WORD_3");
   }
 
-  idSfccSlatFlapComponentStatusWord = std::make_unique<LocalVariable>("A32NX_SFCC_SLAT_FLAP_COMPONENT_STATUS_WORD");
-  idSfccSlatFlapSystemStatusWord = std::make_unique<LocalVariable>("A32NX_SFCC_SLAT_FLAP_SYSTEM_STATUS_WORD");
-  idSfccSlatFlapActualPositionWord = std::make_unique<LocalVariable>("A32NX_SFCC_SLAT_FLAP_ACTUAL_POSITION_WORD");
-  idSfccSlatActualPositionWord = std::make_unique<LocalVariable>("A32NX_SFCC_SLAT_ACTUAL_POSITION_WORD");
-  idSfccFlapActualPositionWord = std::make_unique<LocalVariable>("A32NX_SFCC_FLAP_ACTUAL_POSITION_WORD");
+  idSfccSlatFlapComponentStatusWord = localVariables.create("A32NX_SFCC_SLAT_FLAP_COMPONENT_STATUS_WORD");
+  idSfccSlatFlapSystemStatusWord = localVariables.create("A32NX_SFCC_SLAT_FLAP_SYSTEM_STATUS_WORD");
+  idSfccSlatFlapActualPositionWord = localVariables.create("A32NX_SFCC_SLAT_FLAP_ACTUAL_POSITION_WORD");
+  idSfccSlatActualPositionWord = localVariables.create("A32NX_SFCC_SLAT_ACTUAL_POSITION_WORD");
+  idSfccFlapActualPositionWord = localVariables.create("A32NX_SFCC_FLAP_ACTUAL_POSITION_WORD");
 
   for (int i = 0; i < 3; i++) {
     std::string idString = std::to_string(i + 1);
-    idAdrAltitudeStandard[i] = std::make_unique<LocalVariable>("A32NX_ADIRS_ADR_" + idString + "_ALTITUDE");
-    idAdrAltitudeCorrected[i] = std::make_unique<LocalVariable>("A32NX_ADIRS_ADR_" + idString + "_BARO_CORRECTED_ALTITUDE_1");
-    idAdrMach[i] = std::make_unique<LocalVariable>("A32NX_ADIRS_ADR_" + idString + "_MACH");
-    idAdrAirspeedComputed[i] = std::make_unique<LocalVariable>("A32NX_ADIRS_ADR_" + idString + "_COMPUTED_AIRSPEED");
-    idAdrAirspeedTrue[i] = std::make_unique<LocalVariable>("A32NX_ADIRS_ADR_" + idString + "_TRUE_AIRSPEED");
-    idAdrVerticalSpeed[i] = std::make_unique<LocalVariable>("A32NX_ADIRS_ADR_" + idString + "_BAROMETRIC_VERTICAL_SPEED");
-    idAdrAoaCorrected[i] = std::make_unique<LocalVariable>("A32NX_ADIRS_ADR_" + idString + "_ANGLE_OF_ATTACK");
+    idAdrAltitudeStandard[i] = localVariables.create("A32NX_ADIRS_ADR_" + idString + "_ALTITUDE");
+    idAdrAltitudeCorrected[i] = localVariables.create("A32NX_ADIRS_ADR_" + idString + "_BARO_CORRECTED_ALTITUDE_1");
+    idAdrMach[i] = localVariables.create("A32NX_ADIRS_ADR_" + idString + "_MACH");
+    idAdrAirspeedComputed[i] = localVariables.create("A32NX_ADIRS_ADR_" + idString + "_COMPUTED_AIRSPEED");
+    idAdrAirspeedTrue[i] = localVariables.create("A32NX_ADIRS_ADR_" + idString + "_TRUE_AIRSPEED");
+    idAdrVerticalSpeed[i] = localVariables.create("A32NX_ADIRS_ADR_" + idString + "_BAROMETRIC_VERTICAL_SPEED");
+    idAdrAoaCorrected[i] = localVariables.create("A32NX_ADIRS_ADR_" + idString + "_ANGLE_OF_ATTACK");
     idAdrCorrectedAverageStaticPressure[i] =
-        std::make_unique<LocalVariable>("A32NX_ADIRS_ADR_" + idString + "_CORRECTED_AVERAGE_STATIC_PRESSURE");
-
-    idIrLatitude[i] = std::make_unique<LocalVariable>("A32NX_ADIRS_IR_" + idString + "_LATITUDE");
-    idIrLongitude[i] = std::make_unique<LocalVariable>("A32NX_ADIRS_IR_" + idString + "_LONGITUDE");
-    idIrGroundSpeed[i] = std::make_unique<LocalVariable>("A32NX_ADIRS_IR_" + idString + "_GROUND_SPEED");
-    idIrWindSpeed[i] = std::make_unique<LocalVariable>("A32NX_ADIRS_IR_" + idString + "_WIND_SPEED");
-    idIrWindDirectionTrue[i] = std::make_unique<LocalVariable>("A32NX_ADIRS_IR_" + idString + "_WIND_DIRECTION");
-    idIrTrackAngleMagnetic[i] = std::make_unique<LocalVariable>("A32NX_ADIRS_IR_" + idString + "_TRACK");
-    idIrTrackAngleTrue[i] = std::make_unique<LocalVariable>("A32NX_ADIRS_IR_" + idString + "_TRUE_TRACK");
-    idIrHeadingMagnetic[i] = std::make_unique<LocalVariable>("A32NX_ADIRS_IR_" + idString + "_HEADING");
-    idIrHeadingTrue[i] = std::make_unique<LocalVariable>("A32NX_ADIRS_IR_" + idString + "_TRUE_HEADING");
-    idIrDriftAngle[i] = std::make_unique<LocalVariable>("A32NX_ADIRS_IR_" + idString + "_DRIFT_ANGLE");
-    idIrFlightPathAngle[i] = std::make_unique<LocalVariable>("A32NX_ADIRS_IR_" + idString + "_FLIGHT_PATH_ANGLE");
-    idIrPitchAngle[i] = std::make_unique<LocalVariable>("A32NX_ADIRS_IR_" + idString + "_PITCH");
-    idIrRollAngle[i] = std::make_unique<LocalVariable>("A32NX_ADIRS_IR_" + idString + "_ROLL");
-    idIrBodyPitchRate[i] = std::make_unique<LocalVariable>("A32NX_ADIRS_IR_" + idString + "_BODY_PITCH_RATE");
-    idIrBodyRollRate[i] = std::make_unique<LocalVariable>("A32NX_ADIRS_IR_" + idString + "_BODY_ROLL_RATE");
-    idIrBodyYawRate[i] = std::make_unique<LocalVariable>("A32NX_ADIRS_IR_" + idString + "_BODY_YAW_RATE");
-    idIrBodyLongAccel[i] = std::make_unique<LocalVariable>("A32NX_ADIRS_IR_" + idString + "_BODY_LONGITUDINAL_ACC");
-    idIrBodyLatAccel[i] = std::make_unique<LocalVariable>("A32NX_ADIRS_IR_" + idString + "_BODY_LATERAL_ACC");
-    idIrBodyNormalAccel[i] = std::make_unique<LocalVariable>("A32NX_ADIRS_IR_" + idString + "_BODY_NORMAL_ACC");
-    idIrTrackAngleRate[i] = std::make_unique<LocalVariable>("A32NX_ADIRS_IR_" + idString + "_HEADING_RATE");
-    idIrPitchAttRate[i] = std::make_unique<LocalVariable>("A32NX_ADIRS_IR_" + idString + "_PITCH_ATT_RATE");
-    idIrRollAttRate[i] = std::make_unique<LocalVariable>("A32NX_ADIRS_IR_" + idString + "_ROLL_ATT_RATE");
-    idIrInertialVerticalSpeed[i] = std::make_unique<LocalVariable>("A32NX_ADIRS_IR_" + idString + "_VERTICAL_SPEED");
+        localVariables.create("A32NX_ADIRS_ADR_" + idString + "_CORRECTED_AVERAGE_STATIC_PRESSURE");
+
+    idIrLatitude[i] = localVariables.create("A32NX_ADIRS_IR_" + idString + "_LATITUDE");
+    idIrLongitude[i] = localVariables.create("A32NX_ADIRS_IR_" + idString + "_LONGITUDE");
+    idIrGroundSpeed[i] = localVariables.create("A32NX_ADIRS_IR_" + idString + "_GROUND_SPEED");
+    idIrWindSpeed[i] = localVariables.create("A32NX_ADIRS_IR_" + idString + "_WIND_SPEED");
+    idIrWindDirectionTrue[i] = localVariables.create("A32NX_ADIRS_IR_" + idString + "_WIND_DIRECTION");
+    idIrTrackAngleMagnetic[i] = localVariables.create("A32NX_ADIRS_IR_" + idString + "_TRACK");
+    idIrTrackAngleTrue[i] = localVariables.create("A32NX_ADIRS_IR_" + idString + "_TRUE_TRACK");
+    idIrHeadingMagnetic[i] = localVariables.create("A32NX_ADIRS_IR_" + idString + "_HEADING");
+    idIrHeadingTrue[i] = localVariables.create("A32NX_ADIRS_IR_" + idString + "_TRUE_HEADING");
+    idIrDriftAngle[i] = localVariables.create("A32NX_ADIRS_IR_" + idString + "_DRIFT_ANGLE");
+    idIrFlightPathAngle[i] = localVariables.create("A32NX_ADIRS_IR_" + idString + "_FLIGHT_PATH_ANGLE");
+    idIrPitchAngle[i] = localVariables.create("A32NX_ADIRS_IR_" + idString + "_PITCH");
+    idIrRollAngle[i] = localVariables.create("A32NX_ADIRS_IR_" + idString + "_ROLL");
+    idIrBodyPitchRate[i] = localVariables.create("A32NX_ADIRS_IR_" + idString + "_BODY_PITCH_RATE");
+    idIrBodyRollRate[i] = localVariables.create("A32NX_ADIRS_IR_" + idString + "_BODY_ROLL_RATE");
+    idIrBodyYawRate[i] = localVariables.create("A32NX_ADIRS_IR_" + idString + "_BODY_YAW_RATE");
+    idIrBodyLongAccel[i] = localVariables.create("A32NX_ADIRS_IR_" + idString + "_BODY_LONGITUDINAL_ACC");
+    idIrBodyLatAccel[i] = localVariables.create("A32NX_ADIRS_IR_" + idString + "_BODY_LATERAL_ACC");
+    idIrBodyNormalAccel[i] = localVariables.create("A32NX_ADIRS_IR_" + idString + "_BODY_NORMAL_ACC");
+    idIrTrackAngleRate[i] = localVariables.create("A32NX_ADIRS_IR_" + idString + "_HEADING_RATE");
+    idIrPitchAttRate[i] = localVariables.create("A32NX_ADIRS_IR_" + idString + "_PITCH_ATT_RATE");
+    idIrRollAttRate[i] = localVariables.create("A32NX_ADIRS_IR_" + idString + "_ROLL_ATT_RATE");
+    idIrInertialVerticalSpeed[i] = localVariables.create("A32NX_ADIRS_IR_" + idString + "_VERTICAL_SPEED");
   }
 
   for (int i = 0; i < 2; i++) {
     std::string idString = std::to_string(i + 1);
 
-    idFcdcDiscreteWord1[i] = std::make_unique<LocalVariable>("A32NX_FCDC_" + idString + "_DISCRETE_WORD_1");
-    idFcdcDiscreteWord2[i] = std::make_unique<LocalVariable>("A32NX_FCDC_" + idString + "_DISCRETE_WORD_2");
-    idFcdcDiscreteWord3[i] = std::make_unique<LocalVariable>("A32NX_FCDC_" + idString + "_DISCRETE_WORD_3");
-    idFcdcDiscreteWord4[i] = std::make_unique<LocalVariable>("A32NX_FCDC_" + idString + "_DISCRETE_WORD_4");
-    idFcdcDiscreteWord5[i] = std::make_unique<LocalVariable>("A32NX_FCDC_" + idString + "_DISCRETE_WORD_5");
-    idFcdcCaptRollCommand[i] = std::make_unique<LocalVariable>("A32NX_FCDC_" + idString + "_CAPT_ROLL_COMMAND");
-    idFcdcFoRollCommand[i] = std::make_unique<LocalVariable>("A32NX_FCDC_" + idString + "_FO_ROLL_COMMAND");
-    idFcdcCaptPitchCommand[i] = std::make_unique<LocalVariable>("A32NX_FCDC_" + idString + "_CAPT_PITCH_COMMAND");
-    idFcdcFoPitchCommand[i] = std::make_unique<LocalVariable>("A32NX_FCDC_" + idString + "_FO_PITCH_COMMAND");
-    idFcdcRudderPedalPos[i] = std::make_unique<LocalVariable>("A32NX_FCDC_" + idString + "_RUDDER_PEDAL_POS");
-    idFcdcAileronLeftPos[i] = std::make_unique<LocalVariable>("A32NX_FCDC_" + idString + "_AILERON_LEFT_POS");
-    idFcdcElevatorLeftPos[i] = std::make_unique<LocalVariable>("A32NX_FCDC_" + idString + "_ELEVATOR_LEFT_POS");
-    idFcdcAileronRightPos[i] = std::make_unique<LocalVariable>("A32NX_FCDC_" + idString + "_AILERON_RIGHT_POS");
-    idFcdcElevatorRightPos[i] = std::make_unique<LocalVariable>("A32NX_FCDC_" + idString + "_ELEVATOR_RIGHT_POS");
-    idFcdcElevatorTrimPos[i] = std::make_unique<LocalVariable>("A32NX_FCDC_" + idString + "_ELEVATOR_TRIM_POS");
-    idFcdcSpoilerLeft1Pos[i] = std::make_unique<LocalVariable>("A32NX_FCDC_" + idString + "_SPOILER_LEFT_1_POS");
-    idFcdcSpoilerLeft2Pos[i] = std::make_unique<LocalVariable>("A32NX_FCDC_" + idString + "_SPOILER_LEFT_2_POS");
-    idFcdcSpoilerLeft3Pos[i] = std::make_unique<LocalVariable>("A32NX_FCDC_" + idString + "_SPOILER_LEFT_3_POS");
-    idFcdcSpoilerLeft4Pos[i] = std::make_unique<LocalVariable>("A32NX_FCDC_" + idString + "_SPOILER_LEFT_4_POS");
-    idFcdcSpoilerLeft5Pos[i] = std::make_unique<LocalVariable>("A32NX_FCDC_" + idString + "_SPOILER_LEFT_5_POS");
-    idFcdcSpoilerRight1Pos[i] = std::make_unique<LocalVariable>("A32NX_FCDC_" + idString + "_SPOILER_RIGHT_1_POS");
-    idFcdcSpoilerRight2Pos[i] = std::make_unique<LocalVariable>("A32NX_FCDC_" + idString + "_SPOILER_RIGHT_2_POS");
-    idFcdcSpoilerRight3Pos[i] = std::make_unique<LocalVariable>("A32NX_FCDC_" + idString + "_SPOILER_RIGHT_3_POS");
-    idFcdcSpoilerRight4Pos[i] = std::make_unique<LocalVariable>("A32NX_FCDC_" + idString + "_SPOILER_RIGHT_4_POS");
-    idFcdcSpoilerRight5Pos[i] = std::make_unique<LocalVariable>("A32NX_FCDC_" + idString + "_SPOILER_RIGHT_5_POS");
-
-    idFcdcPriorityCaptGreen[i] = std::make_unique<LocalVariable>("A32NX_FCDC_" + idString + "_PRIORITY_LIGHT_CAPT_GREEN_ON");
-    idFcdcPriorityCaptRed[i] = std::make_unique<LocalVariable>("A32NX_FCDC_" + idString + "_PRIORITY_LIGHT_CAPT_RED_ON");
-    idFcdcPriorityFoGreen[i] = std::make_unique<LocalVariable>("A32NX_FCDC_" + idString + "_PRIORITY_LIGHT_FO_GREEN_ON");
-    idFcdcPriorityFoRed[i] = std::make_unique<LocalVariable>("A32NX_FCDC_" + idString + "_PRIORITY_LIGHT_FO_RED_ON");
-  }
-
-  idThsOverrideActive = std::make_unique<LocalVariable>("A32NX_HYD_THS_TRIM_MANUAL_OVERRIDE");
+    idFcdcDiscreteWord1[i] = localVariables.create("A32NX_FCDC_" + idString + "_DISCRETE_WORD_1");
+    idFcdcDiscreteWord2[i] = localVariables.create("A32NX_FCDC_" + idString + "_DISCRETE_WORD_2");
+    idFcdcDiscreteWord3[i] = localVariables.create("A32NX_FCDC_" + idString + "_DISCRETE_WORD_3");
+    idFcdcDiscreteWord4[i] = localVariables.create("A32NX_FCDC_" + idString + "_DISCRETE_WORD_4");
+    idFcdcDiscreteWord5[i] = localVariables.create("A32NX_FCDC_" + idString + "_DISCRETE_WORD_5");
+    idFcdcCaptRollCommand[i] = localVariables.create("A32NX_FCDC_" + idString + "_CAPT_ROLL_COMMAND");
+    idFcdcFoRollCommand[i] = localVariables.create("A32NX_FCDC_" + idString + "_FO_ROLL_COMMAND");
+    idFcdcCaptPitchCommand[i] = localVariables.create("A32NX_FCDC_" + idString + "_CAPT_PITCH_COMMAND");
+    idFcdcFoPitchCommand[i] = localVariables.create("A32NX_FCDC_" + idString + "_FO_PITCH_COMMAND");
+    idFcdcRudderPedalPos[i] = localVariables.create("A32NX_FCDC_" + idString + "_RUDDER_PEDAL_POS");
+    idFcdcAileronLeftPos[i] = localVariables.create("A32NX_FCDC_" + idString + "_AILERON_LEFT_POS");
+    idFcdcElevatorLeftPos[i] = localVariables.create("A32NX_FCDC_" + idString + "_ELEVATOR_LEFT_POS");
+    idFcdcAileronRightPos[i] = localVariables.create("A32NX_FCDC_" + idString + "_AILERON_RIGHT_POS");
+    idFcdcElevatorRightPos[i] = localVariables.create("A32NX_FCDC_" + idString + "_ELEVATOR_RIGHT_POS");
+    idFcdcElevatorTrimPos[i] = localVariables.create("A32NX_FCDC_" + idString + "_ELEVATOR_TRIM_POS");
+    idFcdcSpoilerLeft1Pos[i] = localVariables.create("A32NX_FCDC_" + idString + "_SPOILER_LEFT_1_POS");
+    idFcdcSpoilerLeft2Pos[i] = localVariables.create("A32NX_FCDC_" + idString + "_SPOILER_LEFT_2_POS");
+    idFcdcSpoilerLeft3Pos[i] = localVariables.create("A32NX_FCDC_" + idString + "_SPOILER_LEFT_3_POS");
+    idFcdcSpoilerLeft4Pos[i] = localVariables.create("A32NX_FCDC_" + idString + "_SPOILER_LEFT_4_POS");
+    idFcdcSpoilerLeft5Pos[i] = localVariables.create("A32NX_FCDC_" + idString + "_SPOILER_LEFT_5_POS");
+    idFcdcSpoilerRight1Pos[i] = localVariables.create("A32NX_FCDC_" + idString + "_SPOILER_RIGHT_1_POS");
+    idFcdcSpoilerRight2Pos[i] = localVariables.create("A32NX_FCDC_" + idString + "_SPOILER_RIGHT_2_POS");
+    idFcdcSpoilerRight3Pos[i] = localVariables.create("A32NX_FCDC_" + idString + "_SPOILER_RIGHT_3_POS");
+    idFcdcSpoilerRight4Pos[i] = localVariables.create("A32NX_FCDC_" + idString + "_SPOILER_RIGHT_4_POS");
+    idFcdcSpoilerRight5Pos[i] = localVariables.create("A32NX_FCDC_" + idString + "_SPOILER_RIGHT_5_POS");
+
+    idFcdcPriorityCaptGreen[i] = localVariables.create("A32NX_FCDC_" + idString + "_PRIORITY_LIGHT_CAPT_GREEN_ON");
+    idFcdcPriorityCaptRed[i] = localVariables.create("A32NX_FCDC_" + idString + "_PRIORITY_LIGHT_CAPT_RED_ON");
+    idFcdcPriorityFoGreen[i] = localVariables.create("A32NX_FCDC_" + idString + "_PRIORITY_LIGHT_FO_GREEN_ON");
+    idFcdcPriorityFoRed[i] = localVariables.create("A32NX_FCDC_" + idString + "_PRIORITY_LIGHT_FO_RED_ON");
+  }
+
+  idThsOverrideActive = localVariables.create("A32NX_HYD_THS_TRIM_MANUAL_OVERRIDE");
 
   for (int i = 0; i < 2; i++) {
     std::string idString = std::to_string(i + 1);
 
-    idElacPushbuttonPressed[i] = std::make_unique<LocalVariable>("A32NX_ELAC_" + idString + "_PUSHBUTTON_PRESSED");
-    idElacDigitalOpValidated[i] = std::make_unique<LocalVariable>("A32NX_ELAC_" + idString + "_DIGITAL_OP_VALIDATED");
+    idElacPushbuttonPressed[i] = localVariables.create("A32NX_ELAC_" + idString + "_PUSHBUTTON_PRESSED");
+    idElacDigitalOpValidated[i] = localVariables.create("A32NX_ELAC_" + idString + "_DIGITAL_OP_VALIDATED");
   }
 
   for (int i = 0; i < 3; i++) {
     std::string idString = std::to_string(i + 1);
 
-    idSecPushbuttonPressed[i] = std::make_unique<LocalVariable>("A32NX_SEC_" + idString + "_PUSHBUTTON_PRESSED");
-    idSecFaultLightOn[i] = std::make_unique<LocalVariable>("A32NX_SEC_" + idString + "_FAULT_LIGHT_ON");
-    idSecGroundSpoilersOut[i] = std::make_unique<LocalVariable>("A32NX_SEC_" + idString + "_GROUND_SPOILER_OUT");
+    idSecPushbuttonPressed[i] = localVariables.create("A32NX_SEC_" + idString + "_PUSHBUTTON_PRESSED");
+    idSecFaultLightOn[i] = localVariables.create("A32NX_SEC_" + idString + "_FAULT_LIGHT_ON");
+    idSecGroundSpoilersOut[i] = localVariables.create("A32NX_SEC_" + idString + "_GROUND_SPOILER_OUT");
   }
 
   for (int i = 0; i < 2; i++) {
     std::string idString = std::to_string(i + 1);
 
-    idFacPushbuttonPressed[i] = std::make_unique<LocalVariable>("A32NX_FAC_" + idString + "_PUSHBUTTON_PRESSED");
-    idFacHealthy[i] = std::make_unique<LocalVariable>("A32NX_FAC_" + idString + "_HEALTHY");
-
-    idFacDiscreteWord1[i] = std::make_unique<LocalVariable>("A32NX_FAC_" + idString + "_DISCRETE_WORD_1");
-    idFacGammaA[i] = std::make_unique<LocalVariable>("A32NX_FAC_" + idString + "_GAMMA_A");
-    idFacGammaT[i] = std::make_unique<LocalVariable>("A32NX_FAC_" + idString + "_GAMMA_T");
-    idFacWeight[i] = std::make_unique<LocalVariable>("A32NX_FAC_" + idString + "_WEIGHT");
-    idFacCenterOfGravity[i] = std::make_unique<LocalVariable>("A32NX_FAC_" + idString + "_CENTER_OF_GRAVITY");
-    idFacSideslipTarget[i] = std::make_unique<LocalVariable>("A32NX_FAC_" + idString + "_SIDESLIP_TARGET");
-    idFacSlatAngle[i] = std::make_unique<LocalVariable>("A32NX_FAC_" + idString + "_SLATS_ANGLE");
-    idFacFlapAngle[i] = std::make_unique<LocalVariable>("A32NX_FAC_" + idString + "_FLAPS_ANGLE");
-    idFacDiscreteWord2[i] = std::make_unique<LocalVariable>("A32NX_FAC_" + idString + "_DISCRETE_WORD_2");
-    idFacRudderTravelLimitCommand[i] = std::make_unique<LocalVariable>("A32NX_FAC_" + idString + "_RUDDER_TRAVEL_LIMIT_COMMAND");
-    idFacDeltaRYawDamperVoted[i] = std::make_unique<LocalVariable>("A32NX_FAC_" + idString + "_DELTA_R_YAW_DAMPER");
-    idFacEstimatedSideslip[i] = std::make_unique<LocalVariable>("A32NX_FAC_" + idString + "_ESTIMATED_SIDESLIP");
-    idFacVAlphaLim[i] = std::make_unique<LocalVariable>("A32NX_FAC_" + idString + "_V_ALPHA_LIM");
-    idFacVLs[i] = std::make_unique<LocalVariable>("A32NX_FAC_" + idString + "_V_LS");
-    idFacVStall[i] = std::make_unique<LocalVariable>("A32NX_FAC_" + idString + "_V_STALL_1G");
-    idFacVAlphaProt[i] = std::make_unique<LocalVariable>("A32NX_FAC_" + idString + "_V_ALPHA_PROT");
-    idFacVStallWarn[i] = std::make_unique<LocalVariable>("A32NX_FAC_" + idString + "_V_STALL_WARN");
-    idFacSpeedTrend[i] = std::make_unique<LocalVariable>("A32NX_FAC_" + idString + "_SPEED_TREND");
-    idFacV3[i] = std::make_unique<LocalVariable>("A32NX_FAC_" + idString + "_V_3");
-    idFacV4[i] = std::make_unique<LocalVariable>("A32NX_FAC_" + idString + "_V_4");
-    idFacVMan[i] = std::make_unique<LocalVariable>("A32NX_FAC_" + idString + "_V_MAN");
-    idFacVMax[i] = std::make_unique<LocalVariable>("A32NX_FAC_" + idString + "_V_MAX");
-    idFacVFeNext[i] = std::make_unique<LocalVariable>("A32NX_FAC_" + idString + "_V_FE_NEXT");
-    idFacDiscreteWord3[i] = std::make_unique<LocalVariable>("A32NX_FAC_" + idString + "_DISCRETE_WORD_3");
-    idFacDiscreteWord4[i] = std::make_unique<LocalVariable>("A32NX_FAC_" + idString + "_DISCRETE_WORD_4");
-    idFacDiscreteWord5[i] = std::make_unique<LocalVariable>("A32NX_FAC_" + idString + "_DISCRETE_WORD_5");
-    idFacDeltaRRudderTrim[i] = std::make_unique<LocalVariable>("A32NX_FAC_" + idString + "_DELTA_R_RUDDER_TRIM");
-    idFacRudderTrimPos[i] = std::make_unique<LocalVariable>("A32NX_FAC_" + idString + "_RUDDER_TRIM_POS");
-    idFacRudderTravelLimitReset[i] = std::make_unique<LocalVariable>("A32NX_FAC_" + idString + "_RTL_EMER_RESET");
+    idFacPushbuttonPressed[i] = localVariables.create("A32NX_FAC_" + idString + "_PUSHBUTTON_PRESSED");
+    idFacHealthy[i] = localVariables.create("A32NX_FAC_" + idString + "_HEALTHY");
+
+    idFacDiscreteWord1[i] = localVariables.create("A32NX_FAC_" + idString + "_DISCRETE_WORD_1");
+    idFacGammaA[i] = localVariables.create("A32NX_FAC_" + idString + "_GAMMA_A");
+    idFacGammaT[i] = localVariables.create("A32NX_FAC_" + idString + "_GAMMA_T");
+    idFacWeight[i] = localVariables.create("A32NX_FAC_" + idString + "_WEIGHT");
+    idFacCenterOfGravity[i] = localVariables.create("A32NX_FAC_" + idString + "_CENTER_OF_GRAVITY");
+    idFacSideslipTarget[i] = localVariables.create("A32NX_FAC_" + idString + "_SIDESLIP_TARGET");
+    idFacSlatAngle[i] = localVariables.create("A32NX_FAC_" + idString + "_SLATS_ANGLE");
+    idFacFlapAngle[i] = localVariables.create("A32NX_FAC_" + idString + "_FLAPS_ANGLE");
+    idFacDiscreteWord2[i] = localVariables.create("A32NX_FAC_" + idString + "_DISCRETE_WORD_2");
+    idFacRudderTravelLimitCommand[i] = localVariables.create("A32NX_FAC_" + idString + "_RUDDER_TRAVEL_LIMIT_COMMAND");
+    idFacDeltaRYawDamperVoted[i] = localVariables.create("A32NX_FAC_" + idString + "_DELTA_R_YAW_DAMPER");
+    idFacEstimatedSideslip[i] = localVariables.create("A32NX_FAC_" + idString + "_ESTIMATED_SIDESLIP");
+    idFacVAlphaLim[i] = localVariables.create("A32NX_FAC_" + idString + "_V_ALPHA_LIM");
+    idFacVLs[i] = localVariables.create("A32NX_FAC_" + idString + "_V_LS");
+    idFacVStall[i] = localVariables.create("A32NX_FAC_" + idString + "_V_STALL_1G");
+    idFacVAlphaProt[i] = localVariables.create("A32NX_FAC_" + idString + "_V_ALPHA_PROT");
+    idFacVStallWarn[i] = localVariables.create("A32NX_FAC_" + idString + "_V_STALL_WARN");
+    idFacSpeedTrend[i] = localVariables.create("A32NX_FAC_" + idString + "_SPEED_TREND");
+    idFacV3[i] = localVariables.create("A32NX_FAC_" + idString + "_V_3");
+    idFacV4[i] = localVariables.create("A32NX_FAC_" + idString + "_V_4");
+    idFacVMan[i] = localVariables.create("A32NX_FAC_" + idString + "_V_MAN");
+    idFacVMax[i] = localVariables.create("A32NX_FAC_" + idString + "_V_MAX");
+    idFacVFeNext[i] = localVariables.create("A32NX_FAC_" + idString + "_V_FE_NEXT");
+    idFacDiscreteWord3[i] = localVariables.create("A32NX_FAC_" + idString + "_DISCRETE_WORD_3");
+    idFacDiscreteWord4[i] = localVariables.create("A32NX_FAC_" + idString + "_DISCRETE_WORD_4");
+    idFacDiscreteWord5[i] = localVariables.create("A32NX_FAC_" + idString + "_DISCRETE_WORD_5");
+    idFacDeltaRRudderTrim[i] = localVariables.create("A32NX_FAC_" + idString + "_DELTA_R_RUDDER_TRIM");
+    idFacRudderTrimPos[i] = localVariables.create("A32NX_FAC_" + idString + "_RUDDER_TRIM_POS");
+    idFacRudderTravelLimitReset[i] = localVariables.create("A32NX_FAC_" + idString + "_RTL_EMER_RESET");
   }
 
   for (int i = 0; i < 2; i++) {
@@ -593,241 +915,241 @@ void FlyByWireInterface::setupLocalVariables() {
     std::string idString = std::to_string(i + 1);
 
     idLeftAileronSolenoidEnergized[i] =
-        std::make_unique<LocalVariable>("A32NX_LEFT_AIL_" + aileronStringLeft + "_SERVO_SOLENOID_ENERGIZED");
-    idLeftAileronCommandedPosition[i] = std::make_unique<LocalVariable>("A32NX_LEFT_AIL_" + aileronStringLeft + "_COMMANDED_POSITION");
+        localVariables.create("A32NX_LEFT_AIL_" + aileronStringLeft + "_SERVO_SOLENOID_ENERGIZED");
+    idLeftAileronCommandedPosition[i] = localVariables.create("A32NX_LEFT_AIL_" + aileronStringLeft + "_COMMANDED_POSITION");
     idRightAileronSolenoidEnergized[i] =
-        std::make_unique<LocalVariable>("A32NX_RIGHT_AIL_" + aileronStringRight + "_SERVO_SOLENOID_ENERGIZED");
-    idRightAileronCommandedPosition[i] = std::make_unique<LocalVariable>("A32NX_RIGHT_AIL_" + aileronStringRight + "_COMMANDED_POSITION");
+        localVariables.create("A32NX_RIGHT_AIL_" + aileronStringRight + "_SERVO_SOLENOID_ENERGIZED");
+    idRightAileronCommandedPosition[i] = localVariables.create("A32NX_RIGHT_AIL_" + aileronStringRight + "_COMMANDED_POSITION");
     idLeftElevatorSolenoidEnergized[i] =
-        std::make_unique<LocalVariable>("A32NX_LEFT_ELEV_" + elevatorStringLeft + "_SERVO_SOLENOID_ENERGIZED");
-    idLeftElevatorCommandedPosition[i] = std::make_unique<LocalVariable>("A32NX_LEFT_ELEV_" + elevatorStringLeft + "_COMMANDED_POSITION");
+        localVariables.create("A32NX_LEFT_ELEV_" + elevatorStringLeft + "_SERVO_SOLENOID_ENERGIZED");
+    idLeftElevatorCommandedPosition[i] = localVariables.create("A32NX_LEFT_ELEV_" + elevatorStringLeft + "_COMMANDED_POSITION");
     idRightElevatorSolenoidEnergized[i] =
-        std::make_unique<LocalVariable>("A32NX_RIGHT_ELEV_" + elevatorStringRight + "_SERVO_SOLENOID_ENERGIZED");
+        localVariables.create("A32NX_RIGHT_ELEV_" + elevatorStringRight + "_SERVO_SOLENOID_ENERGIZED");
     idRightElevatorCommandedPosition[i] =
-        std::make_unique<LocalVariable>("A32NX_RIGHT_ELEV_" + elevatorStringRight + "_COMMANDED_POSITION");
+        localVariables.create("A32NX_RIGHT_ELEV_" + elevatorStringRight + "_COMMANDED_POSITION");
 
-    idYawDamperSolenoidEnergized[i] = std::make_unique<LocalVariable>("A32NX_YAW_DAMPER_" + yawDamperString + "_SERVO_SOLENOID_ENERGIZED");
-    idYawDamperCommandedPosition[i] = std::make_unique<LocalVariable>("A32NX_YAW_DAMPER_" + yawDamperString + "_COMMANDED_POSITION");
-    idRudderTrimActiveModeCommanded[i] = std::make_unique<LocalVariable>("A32NX_RUDDER_TRIM_" + idString + "_ACTIVE_MODE_COMMANDED");
-    idRudderTrimCommandedPosition[i] = std::make_unique<LocalVariable>("A32NX_RUDDER_TRIM_" + idString + "_COMMANDED_POSITION");
+    idYawDamperSolenoidEnergized[i] = localVariables.create("A32NX_YAW_DAMPER_" + yawDamperString + "_SERVO_SOLENOID_ENERGIZED");
+    idYawDamperCommandedPosition[i] = localVariables.create("A32NX_YAW_DAMPER_" + yawDamperString + "_COMMANDED_POSITION");
+    idRudderTrimActiveModeCommanded[i] = localVariables.create("A32NX_RUDDER_TRIM_" + idString + "_ACTIVE_MODE_COMMANDED");
+    idRudderTrimCommandedPosition[i] = localVariables.create("A32NX_RUDDER_TRIM_" + idString + "_COMMANDED_POSITION");
     idRudderTravelLimitActiveModeCommanded[i] =
-        std::make_unique<LocalVariable>("A32NX_RUDDER_TRAVEL_LIM_" + idString + "_ACTIVE_MODE_COMMANDED");
-    idRudderTravelLimCommandedPosition[i] = std::make_unique<LocalVariable>("A32NX_RUDDER_TRAVEL_LIM_" + idString + "_COMMANDED_POSITION");
+        localVariables.create("A32NX_RUDDER_TRAVEL_LIM_" + idString + "_ACTIVE_MODE_COMMANDED");
+    idRudderTravelLimCommandedPosition[i] = localVariables.create("A32NX_RUDDER_TRAVEL_LIM_" + idString + "_COMMANDED_POSITION");
   }
 
   for (int i = 0; i < 3; i++) {
     std::string idString = std::to_string(i + 1);
 
-    idTHSActiveModeCommanded[i] = std::make_unique<LocalVariable>("A32NX_THS_" + idString + "_ACTIVE_MODE_COMMANDED");
-    idTHSCommandedPosition[i] = std::make_unique<LocalVariable>("A32NX_THS_" + idString + "_COMMANDED_POSITION");
+    idTHSActiveModeCommanded[i] = localVariables.create("A32NX_THS_" + idString + "_ACTIVE_MODE_COMMANDED");
+    idTHSCommandedPosition[i] = localVariables.create("A32NX_THS_" + idString + "_COMMANDED_POSITION");
   }
 
   for (int i = 0; i < 2; i++) {
     std::string idString = std::to_string(i + 1);
-    idElevFaultLeft[i] = std::make_unique<LocalVariable>("A32NX_LEFT_ELEV_SERVO_" + idString + "_FAILED");
-    idElevFaultRight[i] = std::make_unique<LocalVariable>("A32NX_RIGHT_ELEV_SERVO_" + idString + "_FAILED");
-    idAilFaultLeft[i] = std::make_unique<LocalVariable>("A32NX_LEFT_AIL_SERVO_" + idString + "_FAILED");
-    idAilFaultRight[i] = std::make_unique<LocalVariable>("A32NX_RIGHT_AIL_SERVO_" + idString + "_FAILED");
+    idElevFaultLeft[i] = localVariables.create("A32NX_LEFT_ELEV_SERVO_" + idString + "_FAILED");
+    idElevFaultRight[i] = localVariables.create("A32NX_RIGHT_ELEV_SERVO_" + idString + "_FAILED");
+    idAilFaultLeft[i] = localVariables.create("A32NX_LEFT_AIL_SERVO_" + idString + "_FAILED");
+    idAilFaultRight[i] = localVariables.create("A32NX_RIGHT_AIL_SERVO_" + idString + "_FAILED");
   }
 
   for (int i = 0; i < 5; i++) {
     std::string idString = std::to_string(i + 1);
-    idLeftSpoilerCommandedPosition[i] = std::make_unique<LocalVariable>("A32NX_LEFT_SPOILER_" + idString + "_COMMANDED_POSITION");
-    idRightSpoilerCommandedPosition[i] = std::make_unique<LocalVariable>("A32NX_RIGHT_SPOILER_" + idString + "_COMMANDED_POSITION");
+    idLeftSpoilerCommandedPosition[i] = localVariables.create("A32NX_LEFT_SPOILER_" + idString + "_COMMANDED_POSITION");
+    idRightSpoilerCommandedPosition[i] = localVariables.create("A32NX_RIGHT_SPOILER_" + idString + "_COMMANDED_POSITION");
 
-    idLeftSpoilerPosition[i] = std::make_unique<LocalVariable>("A32NX_HYD_SPOILER_" + idString + "_LEFT_DEFLECTION");
-    idRightSpoilerPosition[i] = std::make_unique<LocalVariable>("A32NX_HYD_SPOILER_" + idString + "_RIGHT_DEFLECTION");
+    idLeftSpoilerPosition[i] = localVariables.create("A32NX_HYD_SPOILER_" + idString + "_LEFT_DEFLECTION");
+    idRightSpoilerPosition[i] = localVariables.create("A32NX_HYD_SPOILER_" + idString + "_RIGHT_DEFLECTION");
 
-    idSplrFaultLeft[i] = std::make_unique<LocalVariable>("A32NX_LEFT_SPLR_" + idString + "_SERVO_FAILED");
-    idSplrFaultRight[i] = std::make_unique<LocalVariable>("A32NX_RIGHT_SPLR_" + idString + "_SERVO_FAILED");
+    idSplrFaultLeft[i] = localVariables.create("A32NX_LEFT_SPLR_" + idString + "_SERVO_FAILED");
+    idSplrFaultRight[i] = localVariables.create("A32NX_RIGHT_SPLR_" + idString + "_SERVO_FAILED");
   }
 
-  idLeftAileronPosition = std::make_unique<LocalVariable>("A32NX_HYD_AILERON_LEFT_DEFLECTION");
-  idRightAileronPosition = std::make_unique<LocalVariable>("A32NX_HYD_AILERON_RIGHT_DEFLECTION");
-  idLeftElevatorPosition = std::make_unique<LocalVariable>("A32NX_HYD_ELEVATOR_LEFT_DEFLECTION");
-  idRightElevatorPosition = std::make_unique<LocalVariable>("A32NX_HYD_ELEVATOR_RIGHT_DEFLECTION");
+  idLeftAileronPosition = localVariables.create("A32NX_HYD_AILERON_LEFT_DEFLECTION");
+  idRightAileronPosition = localVariables.create("A32NX_HYD_AILERON_RIGHT_DEFLECTION");
+  idLeftElevatorPosition = localVariables.create("A32NX_HYD_ELEVATOR_LEFT_DEFLECTION");
+  idRightElevatorPosition = localVariables.create("A32NX_HYD_ELEVATOR_RIGHT_DEFLECTION");
 
-  idRudderTrimPosition = std::make_unique<LocalVariable>("A32NX_HYD_RUDDER_TRIM_FEEDBACK_ANGLE");
-  idRudderTravelLimiterPosition = std::make_unique<LocalVariable>("A32NX_HYD_RUDDER_LIMITER_FEEDBACK_ANGLE");
+  idRudderTrimPosition = localVariables.create("A32NX_HYD_RUDDER_TRIM_FEEDBACK_ANGLE");
+  idRudderTravelLimiterPosition = localVariables.create("A32NX_HYD_RUDDER_LIMITER_FEEDBACK_ANGLE");
 
-  idElecDcBus2Powered = std::make_unique<LocalVariable>("A32NX_ELEC_DC_2_BUS_IS_POWERED");
-  idElecDcEssShedBusPowered = std::make_unique<LocalVariable>("A32NX_ELEC_DC_ESS_SHED_BUS_IS_POWERED");
-  idElecDcEssBusPowered = std::make_unique<LocalVariable>("A32NX_ELEC_DC_ESS_BUS_IS_POWERED");
-  idElecBat1HotBusPowered = std::make_unique<LocalVariable>("A32NX_ELEC_DC_HOT_1_BUS_IS_POWERED");
-  idElecBat2HotBusPowered = std::make_unique<LocalVariable>("A32NX_ELEC_DC_HOT_2_BUS_IS_POWERED");
+  idElecDcBus2Powered = localVariables.create("A32NX_ELEC_DC_2_BUS_IS_POWERED");
+  idElecDcEssShedBusPowered = localVariables.create("A32NX_ELEC_DC_ESS_SHED_BUS_IS_POWERED");
+  idElecDcEssBusPowered = localVariables.create("A32NX_ELEC_DC_ESS_BUS_IS_POWERED");
+  idElecBat1HotBusPowered = localVariables.create("A32NX_ELEC_DC_HOT_1_BUS_IS_POWERED");
+  idElecBat2HotBusPowered = localVariables.create("A32NX_ELEC_DC_HOT_2_BUS_IS_POWERED");
 
-  idElecBtc1Closed = std::make_unique<LocalVariable>("A32NX_ELEC_CONTACTOR_11XU1_IS_CLOSED");
-  idElecBtc2Closed = std::make_unique<LocalVariable>("A32NX_ELEC_CONTACTOR_11XU2_IS_CLOSED");
-  idElecDcBatToDc2ContactorClosed = std::make_unique<LocalVariable>("A32NX_ELEC_CONTACTOR_1PC2_IS_CLOSED");
+  idElecBtc1Closed = localVariables.create("A32NX_ELEC_CONTACTOR_11XU1_IS_CLOSED");
+  idElecBtc2Closed = localVariables.create("A32NX_ELEC_CONTACTOR_11XU2_IS_CLOSED");
+  idElecDcBatToDc2ContactorClosed = localVariables.create("A32NX_ELEC_CONTACTOR_1PC2_IS_CLOSED");
 
-  idHydYellowSystemPressure = std::make_unique<LocalVariable>("A32NX_HYD_YELLOW_SYSTEM_1_SECTION_PRESSURE");
-  idHydGreenSystemPressure = std::make_unique<LocalVariable>("A32NX_HYD_GREEN_SYSTEM_1_SECTION_PRESSURE");
-  idHydBlueSystemPressure = std::make_unique<LocalVariable>("A32NX_HYD_BLUE_SYSTEM_1_SECTION_PRESSURE");
-  idHydYellowPressurised = std::make_unique<LocalVariable>("A32NX_HYD_YELLOW_SYSTEM_1_SECTION_PRESSURE_SWITCH");
-  idHydGreenPressurised = std::make_unique<LocalVariable>("A32NX_HYD_GREEN_SYSTEM_1_SECTION_PRESSURE_SWITCH");
-  idHydBluePressurised = std::make_unique<LocalVariable>("A32NX_HYD_BLUE_SYSTEM_1_SECTION_PRESSURE_SWITCH");
+  idHydYellowSystemPressure = localVariables.create("A32NX_HYD_YELLOW_SYSTEM_1_SECTION_PRESSURE");
+  idHydGreenSystemPressure = localVariables.create("A32NX_HYD_GREEN_SYSTEM_1_SECTION_PRESSURE");
+  idHydBlueSystemPressure = localVariables.create("A32NX_HYD_BLUE_SYSTEM_1_SECTION_PRESSURE");
+  idHydYellowPressurised = localVariables.create("A32NX_HYD_YELLOW_SYSTEM_1_SECTION_PRESSURE_SWITCH");
+  idHydGreenPressurised = localVariables.create("A32NX_HYD_GREEN_SYSTEM_1_SECTION_PRESSURE_SWITCH");
+  idHydBluePressurised = localVariables.create("A32NX_HYD_BLUE_SYSTEM_1_SECTION_PRESSURE_SWITCH");
 
-  idCaptPriorityButtonPressed = std::make_unique<LocalVariable>("A32NX_PRIORITY_TAKEOVER:1");
-  idFoPriorityButtonPressed = std::make_unique<LocalVariable>("A32NX_PRIORITY_TAKEOVER:2");
+  idCaptPriorityButtonPressed = localVariables.create("A32NX_PRIORITY_TAKEOVER:1");
+  idFoPriorityButtonPressed = localVariables.create("A32NX_PRIORITY_TAKEOVER:2");
 
-  idAttHdgSwtgKnob = std::make_unique<LocalVariable>("A32NX_ATT_HDG_SWITCHING_KNOB");
-  idAirDataSwtgKnob = std::make_unique<LocalVariable>("A32NX_AIR_DATA_SWITCHING_KNOB");
+  idAttHdgSwtgKnob = localVariables.create("A32NX_ATT_HDG_SWITCHING_KNOB");
+  idAirDataSwtgKnob = localVariables.create("A32NX_AIR_DATA_SWITCHING_KNOB");
 
   // AP Shim LVars
-  idAutopilotShimNosewheelDemand = std::make_unique<LocalVariable>("A32NX_AUTOPILOT_NOSEWHEEL_DEMAND");
-  idAutopilotShimFmaLateralMode = std::make_unique<LocalVariable>("A32NX_FMA_LATERAL_MODE");
-  idAutopilotShimFmaLateralArmed = std::make_unique<LocalVariable>("A32NX_FMA_LATERAL_ARMED");
-  idAutopilotShimFmaVerticalMode = std::make_unique<LocalVariable>("A32NX_FMA_VERTICAL_MODE");
-  idAutopilotShimFmaVerticalArmed = std::make_unique<LocalVariable>("A32NX_FMA_VERTICAL_ARMED");
-  idAutopilotShimFmaExpediteModeActive = std::make_unique<LocalVariable>("A32NX_FMA_EXPEDITE_MODE");
-  idAutopilotShimFmaTripleClick = std::make_unique<LocalVariable>("A32NX_FMA_TRIPLE_CLICK");
-  idAutopilotShimAutolandWarning = std::make_unique<LocalVariable>("A32NX_AUTOPILOT_AUTOLAND_WARNING");
-  idAutopilotShimActiveAny = std::make_unique<LocalVariable>("A32NX_AUTOPILOT_ACTIVE");
-  idAutopilotShimActive_1 = std::make_unique<LocalVariable>("A32NX_AUTOPILOT_1_ACTIVE");
-  idAutopilotShimActive_2 = std::make_unique<LocalVariable>("A32NX_AUTOPILOT_2_ACTIVE");
-  idAutopilotShim_H_dot_radio = std::make_unique<LocalVariable>("A32NX_AUTOPILOT_H_DOT_RADIO");
-  idAutothrustShimStatus = std::make_unique<LocalVariable>("A32NX_AUTOTHRUST_STATUS");
-  idAutothrustShimMode = std::make_unique<LocalVariable>("A32NX_AUTOTHRUST_MODE");
-  idAutothrustShimModeMessage = std::make_unique<LocalVariable>("A32NX_AUTOTHRUST_MODE_MESSAGE");
+  idAutopilotShimNosewheelDemand = localVariables.create("A32NX_AUTOPILOT_NOSEWHEEL_DEMAND");
+  idAutopilotShimFmaLateralMode = localVariables.create("A32NX_FMA_LATERAL_MODE");
+  idAutopilotShimFmaLateralArmed = localVariables.create("A32NX_FMA_LATERAL_ARMED");
+  idAutopilotShimFmaVerticalMode = localVariables.create("A32NX_FMA_VERTICAL_MODE");
+  idAutopilotShimFmaVerticalArmed = localVariables.create("A32NX_FMA_VERTICAL_ARMED");
+  idAutopilotShimFmaExpediteModeActive = localVariables.create("A32NX_FMA_EXPEDITE_MODE");
+  idAutopilotShimFmaTripleClick = localVariables.create("A32NX_FMA_TRIPLE_CLICK");
+  idAutopilotShimAutolandWarning = localVariables.create("A32NX_AUTOPILOT_AUTOLAND_WARNING");
+  idAutopilotShimActiveAny = localVariables.create("A32NX_AUTOPILOT_ACTIVE");
+  idAutopilotShimActive_1 = localVariables.create("A32NX_AUTOPILOT_1_ACTIVE");
+  idAutopilotShimActive_2 = localVariables.create("A32NX_AUTOPILOT_2_ACTIVE");
+  idAutopilotShim_H_dot_radio = localVariables.create("A32NX_AUTOPILOT_H_DOT_RADIO");
+  idAutothrustShimStatus = localVariables.create("A32NX_AUTOTHRUST_STATUS");
+  idAutothrustShimMode = localVariables.create("A32NX_AUTOTHRUST_MODE");
+  idAutothrustShimModeMessage = localVariables.create("A32NX_AUTOTHRUST_MODE_MESSAGE");
 
   for (int i = 0; i < 2; i++) {
     std::string idString = std::to_string(i + 1);
 
-    idFmgcHealthy[i] = std::make_unique<LocalVariable>("A32NX_FMGC_" + idString + "_HEALTHY");
-    idFmgcAthrEngaged[i] = std::make_unique<LocalVariable>("A32NX_FMGC_" + idString + "_ATHR_ENGAGED");
-    idFmgcFdEngaged[i] = std::make_unique<LocalVariable>("A32NX_FMGC_" + idString + "_FD_ENGAGED");
-    idFmgcApEngaged[i] = std::make_unique<LocalVariable>("A32NX_FMGC_" + idString + "_AP_ENGAGED");
-    idFmgcIlsTuneInhibit[i] = std::make_unique<LocalVariable>("A32NX_FMGC_" + idString + "_ILS_TUNE_INHIBIT");
-
-    idFmgcABusPfdSelectedSpeed[i] = std::make_unique<LocalVariable>("A32NX_FMGC_" + idString + "_PFD_SELECTED_SPEED");
-    idFmgcABusPreselMach[i] = std::make_unique<LocalVariable>("A32NX_FMGC_" + idString + "_PRESEL_MACH");
-    idFmgcABusPreselSpeed[i] = std::make_unique<LocalVariable>("A32NX_FMGC_" + idString + "_PRESEL_SPEED");
-    idFmgcABusRwyHdgMemo[i] = std::make_unique<LocalVariable>("A32NX_FMGC_" + idString + "_RWY_HDG_MEMO");
-    idFmgcABusRollFdCommand[i] = std::make_unique<LocalVariable>("A32NX_FMGC_" + idString + "_ROLL_FD_COMMAND");
-    idFmgcABusPitchFdCommand[i] = std::make_unique<LocalVariable>("A32NX_FMGC_" + idString + "_PITCH_FD_COMMAND");
-    idFmgcABusYawFdCommand[i] = std::make_unique<LocalVariable>("A32NX_FMGC_" + idString + "_YAW_FD_COMMAND");
-    idFmgcABusDiscreteWord5[i] = std::make_unique<LocalVariable>("A32NX_FMGC_" + idString + "_DISCRETE_WORD_5");
-    idFmgcABusDiscreteWord4[i] = std::make_unique<LocalVariable>("A32NX_FMGC_" + idString + "_DISCRETE_WORD_4");
-    idFmgcABusFmAltConstraint[i] = std::make_unique<LocalVariable>("A32NX_FMGC_" + idString + "_FM_ALTITUDE_CONSTRAINT");
-    idFmgcABusAtsDiscreteWord[i] = std::make_unique<LocalVariable>("A32NX_FMGC_" + idString + "_ATS_DISCRETE_WORD");
-    idFmgcABusAtsFmaDiscreteWord[i] = std::make_unique<LocalVariable>("A32NX_FMGC_" + idString + "_ATS_FMA_DISCRETE_WORD");
-    idFmgcABusDiscreteWord3[i] = std::make_unique<LocalVariable>("A32NX_FMGC_" + idString + "_DISCRETE_WORD_3");
-    idFmgcABusDiscreteWord1[i] = std::make_unique<LocalVariable>("A32NX_FMGC_" + idString + "_DISCRETE_WORD_1");
-    idFmgcABusDiscreteWord2[i] = std::make_unique<LocalVariable>("A32NX_FMGC_" + idString + "_DISCRETE_WORD_2");
-    idFmgcABusDiscreteWord6[i] = std::make_unique<LocalVariable>("A32NX_FMGC_" + idString + "_DISCRETE_WORD_6");
-    idFmgcABusDiscreteWord3[i] = std::make_unique<LocalVariable>("A32NX_FMGC_" + idString + "_DISCRETE_WORD_3");
-    idFmgcABusDiscreteWord1[i] = std::make_unique<LocalVariable>("A32NX_FMGC_" + idString + "_DISCRETE_WORD_1");
-    idFmgcABusDiscreteWord2[i] = std::make_unique<LocalVariable>("A32NX_FMGC_" + idString + "_DISCRETE_WORD_2");
-    idFmgcABusDiscreteWord6[i] = std::make_unique<LocalVariable>("A32NX_FMGC_" + idString + "_DISCRETE_WORD_6");
-    idFmgcABusDiscreteWord7[i] = std::make_unique<LocalVariable>("A32NX_FMGC_" + idString + "_DISCRETE_WORD_7");
-    idFmgcABusSpeedMarginHigh[i] = std::make_unique<LocalVariable>("A32NX_FMGC_" + idString + "_SPEED_MARGIN_HIGH");
-    idFmgcABusSpeedMarginLow[i] = std::make_unique<LocalVariable>("A32NX_FMGC_" + idString + "_SPEED_MARGIN_LOW");
-  }
-
-  idStickLockActive = std::make_unique<LocalVariable>("A32NX_STICK_LOCK_ACTIVE");
-
-  idApInstinctiveDisconnect = std::make_unique<LocalVariable>("A32NX_AP_INSTINCTIVE_DISCONNECT");
-  idAthrInstinctiveDisconnect = std::make_unique<LocalVariable>("A32NX_ATHR_INSTINCTIVE_DISCONNECT");
+    idFmgcHealthy[i] = localVariables.create("A32NX_FMGC_" + idString + "_HEALTHY");
+    idFmgcAthrEngaged[i] = localVariables.create("A32NX_FMGC_" + idString + "_ATHR_ENGAGED");
+    idFmgcFdEngaged[i] = localVariables.create("A32NX_FMGC_" + idString + "_FD_ENGAGED");
+    idFmgcApEngaged[i] = localVariables.create("A32NX_FMGC_" + idString + "_AP_ENGAGED");
+    idFmgcIlsTuneInhibit[i] = localVariables.create("A32NX_FMGC_" + idString + "_ILS_TUNE_INHIBIT");
+
+    idFmgcABusPfdSelectedSpeed[i] = localVariables.create("A32NX_FMGC_" + idString + "_PFD_SELECTED_SPEED");
+    idFmgcABusPreselMach[i] = localVariables.create("A32NX_FMGC_" + idString + "_PRESEL_MACH");
+    idFmgcABusPreselSpeed[i] = localVariables.create("A32NX_FMGC_" + idString + "_PRESEL_SPEED");
+    idFmgcABusRwyHdgMemo[i] = localVariables.create("A32NX_FMGC_" + idString + "_RWY_HDG_MEMO");
+    idFmgcABusRollFdCommand[i] = localVariables.create("A32NX_FMGC_" + idString + "_ROLL_FD_COMMAND");
+    idFmgcABusPitchFdCommand[i] = localVariables.create("A32NX_FMGC_" + idString + "_PITCH_FD_COMMAND");
+    idFmgcABusYawFdCommand[i] = localVariables.create("A32NX_FMGC_" + idString + "_YAW_FD_COMMAND");
+    idFmgcABusDiscreteWord5[i] = localVariables.create("A32NX_FMGC_" + idString + "_DISCRETE_WORD_5");
+    idFmgcABusDiscreteWord4[i] = localVariables.create("A32NX_FMGC_" + idString + "_DISCRETE_WORD_4");
+    idFmgcABusFmAltConstraint[i] = localVariables.create("A32NX_FMGC_" + idString + "_FM_ALTITUDE_CONSTRAINT");
+    idFmgcABusAtsDiscreteWord[i] = localVariables.create("A32NX_FMGC_" + idString + "_ATS_DISCRETE_WORD");
+    idFmgcABusAtsFmaDiscreteWord[i] = localVariables.create("A32NX_FMGC_" + idString + "_ATS_FMA_DISCRETE_WORD");
+    idFmgcABusDiscreteWord3[i] = localVariables.create("A32NX_FMGC_" + idString + "_DISCRETE_WORD_3");
+    idFmgcABusDiscreteWord1[i] = localVariables.create("A32NX_FMGC_" + idString + "_DISCRETE_WORD_1");
+    idFmgcABusDiscreteWord2[i] = localVariables.create("A32NX_FMGC_" + idString + "_DISCRETE_WORD_2");
+    idFmgcABusDiscreteWord6[i] = localVariables.create("A32NX_FMGC_" + idString + "_DISCRETE_WORD_6");
+    idFmgcABusDiscreteWord3[i] = localVariables.create("A32NX_FMGC_" + idString + "_DISCRETE_WORD_3");
+    idFmgcABusDiscreteWord1[i] = localVariables.create("A32NX_FMGC_" + idString + "_DISCRETE_WORD_1");
+    idFmgcABusDiscreteWord2[i] = localVariables.create("A32NX_FMGC_" + idString + "_DISCRETE_WORD_2");
+    idFmgcABusDiscreteWord6[i] = localVariables.create("A32NX_FMGC_" + idString + "_DISCRETE_WORD_6");
+    idFmgcABusDiscreteWord7[i] = localVariables.create("A32NX_FMGC_" + idString + "_DISCRETE_WORD_7");
+    idFmgcABusSpeedMarginHigh[i] = localVariables.create("A32NX_FMGC_" + idString + "_SPEED_MARGIN_HIGH");
+    idFmgcABusSpeedMarginLow[i] = localVariables.create("A32NX_FMGC_" + idString + "_SPEED_MARGIN_LOW");
+  }
+
+  idStickLockActive = localVariables.create("A32NX_STICK_LOCK_ACTIVE");
+
+  idApInstinctiveDisconnect = localVariables.create("A32NX_AP_INSTINCTIVE_DISCONNECT");
+  idAthrInstinctiveDisconnect = localVariables.create("A32NX_ATHR_INSTINCTIVE_DISCONNECT");
 
   // FCU Lvars
-  idLightsTest = std::make_unique<LocalVariable>("A32NX_OVHD_INTLT_ANN");
+  idLightsTest = localVariables.create("A32NX_OVHD_INTLT_ANN");
 
   // FCU Shim LVars
-  idFcuShimLeftNavaid1Mode = std::make_unique<LocalVariable>("A32NX_EFIS_L_NAVAID_1_MODE");
-  idFcuShimLeftNavaid2Mode = std::make_unique<LocalVariable>("A32NX_EFIS_L_NAVAID_2_MODE");
-  idFcuShimLeftNdMode = std::make_unique<LocalVariable>("A32NX_EFIS_L_ND_MODE");
-  idFcuShimLeftNdRange = std::make_unique<LocalVariable>("A32NX_EFIS_L_ND_RANGE");
-  idFcuShimLeftNdFilterOption = std::make_unique<LocalVariable>("A32NX_EFIS_L_OPTION");
-  idFcuShimLeftLsActive = std::make_unique<LocalVariable>("BTN_LS_1_FILTER_ACTIVE");
-  idFcuShimLeftBaroMode = std::make_unique<LocalVariable>("XMLVAR_Baro1_Mode");
-  idFcuShimRightNavaid1Mode = std::make_unique<LocalVariable>("A32NX_EFIS_R_NAVAID_1_MODE");
-  idFcuShimRightNavaid2Mode = std::make_unique<LocalVariable>("A32NX_EFIS_R_NAVAID_2_MODE");
-  idFcuShimRightNdMode = std::make_unique<LocalVariable>("A32NX_EFIS_R_ND_MODE");
-  idFcuShimRightNdRange = std::make_unique<LocalVariable>("A32NX_EFIS_R_ND_RANGE");
-  idFcuShimRightNdFilterOption = std::make_unique<LocalVariable>("A32NX_EFIS_R_OPTION");
-  idFcuShimRightLsActive = std::make_unique<LocalVariable>("BTN_LS_2_FILTER_ACTIVE");
-  idFcuShimRightBaroMode = std::make_unique<LocalVariable>("XMLVAR_Baro2_Mode");
-
-  idFcuShimSpdDashes = std::make_unique<LocalVariable>("A32NX_FCU_SPD_MANAGED_DASHES");
-  idFcuShimSpdDot = std::make_unique<LocalVariable>("A32NX_FCU_SPD_MANAGED_DOT");
-  idFcuShimSpdValue = std::make_unique<LocalVariable>("A32NX_AUTOPILOT_SPEED_SELECTED");
-  idFcuShimTrkFpaActive = std::make_unique<LocalVariable>("A32NX_TRK_FPA_MODE_ACTIVE");
-  idFcuShimHdgValue1 = std::make_unique<LocalVariable>("A32NX_FCU_HEADING_SELECTED");
-  idFcuShimHdgValue2 = std::make_unique<LocalVariable>("A32NX_AUTOPILOT_HEADING_SELECTED");
-  idFcuShimShowHdg = std::make_unique<LocalVariable>("A320_FCU_SHOW_SELECTED_HEADING");
-  idFcuShimHdgDashes = std::make_unique<LocalVariable>("A32NX_FCU_HDG_MANAGED_DASHES");
-  idFcuShimHdgDot = std::make_unique<LocalVariable>("A32NX_FCU_HDG_MANAGED_DOT");
-  idFcuShimAltManaged = std::make_unique<LocalVariable>("A32NX_FCU_ALT_MANAGED");
-  idFcuShimVsValue = std::make_unique<LocalVariable>("A32NX_AUTOPILOT_VS_SELECTED");
-  idFcuShimFpaValue = std::make_unique<LocalVariable>("A32NX_AUTOPILOT_FPA_SELECTED");
-  idFcuShimVsManaged = std::make_unique<LocalVariable>("A32NX_FCU_VS_MANAGED");
-
-  idFcuSelectedHeading = std::make_unique<LocalVariable>("A32NX_FCU_SELECTED_HEADING");
-  idFcuSelectedAltitude = std::make_unique<LocalVariable>("A32NX_FCU_SELECTED_ALTITUDE");
-  idFcuSelectedAirspeed = std::make_unique<LocalVariable>("A32NX_FCU_SELECTED_AIRSPEED");
-  idFcuSelectedVerticalSpeed = std::make_unique<LocalVariable>("A32NX_FCU_SELECTED_VERTICAL_SPEED");
-  idFcuSelectedTrack = std::make_unique<LocalVariable>("A32NX_FCU_SELECTED_TRACK");
-  idFcuSelectedFpa = std::make_unique<LocalVariable>("A32NX_FCU_SELECTED_FPA");
-  idFcuAtsDiscreteWord = std::make_unique<LocalVariable>("A32NX_FCU_ATS_DISCRETE_WORD");
-  idFcuAtsFmaDiscreteWord = std::make_unique<LocalVariable>("A32NX_FCU_ATS_FMA_DISCRETE_WORD");
-  idFcuEisLeftDiscreteWord1 = std::make_unique<LocalVariable>("A32NX_FCU_LEFT_EIS_DISCRETE_WORD_1");
-  idFcuEisLeftDiscreteWord2 = std::make_unique<LocalVariable>("A32NX_FCU_LEFT_EIS_DISCRETE_WORD_2");
-  idFcuEisLeftBaro = std::make_unique<LocalVariable>("A32NX_FCU_LEFT_EIS_BARO");
-  idFcuEisLeftBaroHpa = std::make_unique<LocalVariable>("A32NX_FCU_LEFT_EIS_BARO_HPA");
-  idFcuEisRightDiscreteWord1 = std::make_unique<LocalVariable>("A32NX_FCU_RIGHT_EIS_DISCRETE_WORD_1");
-  idFcuEisRightDiscreteWord2 = std::make_unique<LocalVariable>("A32NX_FCU_RIGHT_EIS_DISCRETE_WORD_2");
-  idFcuEisRightBaro = std::make_unique<LocalVariable>("A32NX_FCU_RIGHT_EIS_BARO");
-  idFcuEisRightBaroHpa = std::make_unique<LocalVariable>("A32NX_FCU_RIGHT_EIS_BARO_HPA");
-  idFcuDiscreteWord1 = std::make_unique<LocalVariable>("A32NX_FCU_DISCRETE_WORD_1");
-  idFcuDiscreteWord2 = std::make_unique<LocalVariable>("A32NX_FCU_DISCRETE_WORD_2");
+  idFcuShimLeftNavaid1Mode = localVariables.create("A32NX_EFIS_L_NAVAID_1_MODE");
+  idFcuShimLeftNavaid2Mode = localVariables.create("A32NX_EFIS_L_NAVAID_2_MODE");
+  idFcuShimLeftNdMode = localVariables.create("A32NX_EFIS_L_ND_MODE");
+  idFcuShimLeftNdRange = localVariables.create("A32NX_EFIS_L_ND_RANGE");
+  idFcuShimLeftNdFilterOption = localVariables.create("A32NX_EFIS_L_OPTION");
+  idFcuShimLeftLsActive = localVariables.create("BTN_LS_1_FILTER_ACTIVE");
+  idFcuShimLeftBaroMode = localVariables.create("XMLVAR_Baro1_Mode");
+  idFcuShimRightNavaid1Mode = localVariables.create("A32NX_EFIS_R_NAVAID_1_MODE");
+  idFcuShimRightNavaid2Mode = localVariables.create("A32NX_EFIS_R_NAVAID_2_MODE");
+  idFcuShimRightNdMode = localVariables.create("A32NX_EFIS_R_ND_MODE");
+  idFcuShimRightNdRange = localVariables.create("A32NX_EFIS_R_ND_RANGE");
+  idFcuShimRightNdFilterOption = localVariables.create("A32NX_EFIS_R_OPTION");
+  idFcuShimRightLsActive = localVariables.create("BTN_LS_2_FILTER_ACTIVE");
+  idFcuShimRightBaroMode = localVariables.create("XMLVAR_Baro2_Mode");
+
+  idFcuShimSpdDashes = localVariables.create("A32NX_FCU_SPD_MANAGED_DASHES");
+  idFcuShimSpdDot = localVariables.create("A32NX_FCU_SPD_MANAGED_DOT");
+  idFcuShimSpdValue = localVariables.create("A32NX_AUTOPILOT_SPEED_SELECTED");
+  idFcuShimTrkFpaActive = localVariables.create("A32NX_TRK_FPA_MODE_ACTIVE");
+  idFcuShimHdgValue1 = localVariables.create("A32NX_FCU_HEADING_SELECTED");
+  idFcuShimHdgValue2 = localVariables.create("A32NX_AUTOPILOT_HEADING_SELECTED");
+  idFcuShimShowHdg = localVariables.create("A320_FCU_SHOW_SELECTED_HEADING");
+  idFcuShimHdgDashes = localVariables.create("A32NX_FCU_HDG_MANAGED_DASHES");
+  idFcuShimHdgDot = localVariables.create("A32NX_FCU_HDG_MANAGED_DOT");
+  idFcuShimAltManaged = localVariables.create("A32NX_FCU_ALT_MANAGED");
+  idFcuShimVsValue = localVariables.create("A32NX_AUTOPILOT_VS_SELECTED");
+  idFcuShimFpaValue = localVariables.create("A32NX_AUTOPILOT_FPA_SELECTED");
+  idFcuShimVsManaged = localVariables.create("A32NX_FCU_VS_MANAGED");
+
+  idFcuSelectedHeading = localVariables.create("A32NX_FCU_SELECTED_HEADING");
+  idFcuSelectedAltitude = localVariables.create("A32NX_FCU_SELECTED_ALTITUDE");
+  idFcuSelectedAirspeed = localVariables.create("A32NX_FCU_SELECTED_AIRSPEED");
+  idFcuSelectedVerticalSpeed = localVariables.create("A32NX_FCU_SELECTED_VERTICAL_SPEED");
+  idFcuSelectedTrack = localVariables.create("A32NX_FCU_SELECTED_TRACK");
+  idFcuSelectedFpa = localVariables.create("A32NX_FCU_SELECTED_FPA");
+  idFcuAtsDiscreteWord = localVariables.create("A32NX_FCU_ATS_DISCRETE_WORD");
+  idFcuAtsFmaDiscreteWord = localVariables.create("A32NX_FCU_ATS_FMA_DISCRETE_WORD");
+  idFcuEisLeftDiscreteWord1 = localVariables.create("A32NX_FCU_LEFT_EIS_DISCRETE_WORD_1");
+  idFcuEisLeftDiscreteWord2 = localVariables.create("A32NX_FCU_LEFT_EIS_DISCRETE_WORD_2");
+  idFcuEisLeftBaro = localVariables.create("A32NX_FCU_LEFT_EIS_BARO");
+  idFcuEisLeftBaroHpa = localVariables.create("A32NX_FCU_LEFT_EIS_BARO_HPA");
+  idFcuEisRightDiscreteWord1 = localVariables.create("A32NX_FCU_RIGHT_EIS_DISCRETE_WORD_1");
+  idFcuEisRightDiscreteWord2 = localVariables.create("A32NX_FCU_RIGHT_EIS_DISCRETE_WORD_2");
+  idFcuEisRightBaro = localVariables.create("A32NX_FCU_RIGHT_EIS_BARO");
+  idFcuEisRightBaroHpa = localVariables.create("A32NX_FCU_RIGHT_EIS_BARO_HPA");
+  idFcuDiscreteWord1 = localVariables.create("A32NX_FCU_DISCRETE_WORD_1");
+  idFcuDiscreteWord2 = localVariables.create("A32NX_FCU_DISCRETE_WORD_2");
 
   for (int i = 0; i < 2; i++) {
     std::string idString = i == 0 ? "L" : "R";
 
-    idFcuEisPanelEfisMode[i] = std::make_unique<LocalVariable>("A32NX_FCU_EFIS_" + idString + "_EFIS_MODE");
-    idFcuEisPanelEfisRange[i] = std::make_unique<LocalVariable>("A32NX_FCU_EFIS_" + idString + "_EFIS_RANGE");
-    idFcuEisPanelNavaid1Mode[i] = std::make_unique<LocalVariable>("A32NX_FCU_EFIS_" + idString + "_NAVAID_1_MODE");
-    idFcuEisPanelNavaid2Mode[i] = std::make_unique<LocalVariable>("A32NX_FCU_EFIS_" + idString + "_NAVAID_2_MODE");
-    idFcuEisPanelBaroIsInhg[i] = std::make_unique<LocalVariable>("A32NX_FCU_EFIS_" + idString + "_BARO_IS_INHG");
-    idFcuEisDisplayBaroValueMode[i] = std::make_unique<LocalVariable>("A32NX_FCU_EFIS_" + idString + "_DISPLAY_BARO_VALUE_MODE");
-    idFcuEisDisplayBaroValue[i] = std::make_unique<LocalVariable>("A32NX_FCU_EFIS_" + idString + "_DISPLAY_BARO_VALUE");
-    idFcuEisDisplayBaroMode[i] = std::make_unique<LocalVariable>("A32NX_FCU_EFIS_" + idString + "_DISPLAY_BARO_MODE");
-
-    idFcuEisPanelFdLightOn[i] = std::make_unique<LocalVariable>("A32NX_FCU_EFIS_" + idString + "_FD_LIGHT_ON");
-    idFcuEisPanelLsLightOn[i] = std::make_unique<LocalVariable>("A32NX_FCU_EFIS_" + idString + "_LS_LIGHT_ON");
-    idFcuEisPanelCstrLightOn[i] = std::make_unique<LocalVariable>("A32NX_FCU_EFIS_" + idString + "_CSTR_LIGHT_ON");
-    idFcuEisPanelWptLightOn[i] = std::make_unique<LocalVariable>("A32NX_FCU_EFIS_" + idString + "_WPT_LIGHT_ON");
-    idFcuEisPanelVordLightOn[i] = std::make_unique<LocalVariable>("A32NX_FCU_EFIS_" + idString + "_VORD_LIGHT_ON");
-    idFcuEisPanelNdbLightOn[i] = std::make_unique<LocalVariable>("A32NX_FCU_EFIS_" + idString + "_NDB_LIGHT_ON");
-    idFcuEisPanelArptLightOn[i] = std::make_unique<LocalVariable>("A32NX_FCU_EFIS_" + idString + "_ARPT_LIGHT_ON");
-  }
-  idFcuAfsPanelAltIncrement1000 = std::make_unique<LocalVariable>("A32NX_FCU_ALT_INCREMENT_1000");
-
-  idFcuAfsPanelAp1LightOn = std::make_unique<LocalVariable>("A32NX_FCU_AP_1_LIGHT_ON");
-  idFcuAfsPanelAp2LightOn = std::make_unique<LocalVariable>("A32NX_FCU_AP_2_LIGHT_ON");
-  idFcuAfsPanelAthrLightOn = std::make_unique<LocalVariable>("A32NX_FCU_ATHR_LIGHT_ON");
-  idFcuAfsPanelLocLightOn = std::make_unique<LocalVariable>("A32NX_FCU_LOC_LIGHT_ON");
-  idFcuAfsPanelExpedLightOn = std::make_unique<LocalVariable>("A32NX_FCU_EXPED_LIGHT_ON");
-  idFcuAfsPanelApprLightOn = std::make_unique<LocalVariable>("A32NX_FCU_APPR_LIGHT_ON");
-  idFcuAfsDisplayTrkFpaMode = std::make_unique<LocalVariable>("A32NX_FCU_AFS_DISPLAY_TRK_FPA_MODE");
-  idFcuAfsDisplayMachMode = std::make_unique<LocalVariable>("A32NX_FCU_AFS_DISPLAY_MACH_MODE");
-  idFcuAfsDisplaySpdMachValue = std::make_unique<LocalVariable>("A32NX_FCU_AFS_DISPLAY_SPD_MACH_VALUE");
-  idFcuAfsDisplaySpdMachDashes = std::make_unique<LocalVariable>("A32NX_FCU_AFS_DISPLAY_SPD_MACH_DASHES");
-  idFcuAfsDisplaySpdMachManaged = std::make_unique<LocalVariable>("A32NX_FCU_AFS_DISPLAY_SPD_MACH_MANAGED");
-  idFcuAfsDisplayHdgTrkValue = std::make_unique<LocalVariable>("A32NX_FCU_AFS_DISPLAY_HDG_TRK_VALUE");
-  idFcuAfsDisplayHdgTrkDashes = std::make_unique<LocalVariable>("A32NX_FCU_AFS_DISPLAY_HDG_TRK_DASHES");
-  idFcuAfsDisplayHdgTrkManaged = std::make_unique<LocalVariable>("A32NX_FCU_AFS_DISPLAY_HDG_TRK_MANAGED");
-  idFcuAfsDisplayAltValue = std::make_unique<LocalVariable>("A32NX_FCU_AFS_DISPLAY_ALT_VALUE");
-  idFcuAfsDisplayLvlChManaged = std::make_unique<LocalVariable>("A32NX_FCU_AFS_DISPLAY_LVL_CH_MANAGED");
-  idFcuAfsDisplayVsFpaValue = std::make_unique<LocalVariable>("A32NX_FCU_AFS_DISPLAY_VS_FPA_VALUE");
-  idFcuAfsDisplayVsFpaDashes = std::make_unique<LocalVariable>("A32NX_FCU_AFS_DISPLAY_VS_FPA_DASHES");
-
-  idFcuHealthy = std::make_unique<LocalVariable>("A32NX_FCU_HEALTHY");
+    idFcuEisPanelEfisMode[i] = localVariables.create("A32NX_FCU_EFIS_" + idString + "_EFIS_MODE");
+    idFcuEisPanelEfisRange[i] = localVariables.create("A32NX_FCU_EFIS_" + idString + "_EFIS_RANGE");
+    idFcuEisPanelNavaid1Mode[i] = localVariables.create("A32NX_FCU_EFIS_" + idString + "_NAVAID_1_MODE");
+    idFcuEisPanelNavaid2Mode[i] = localVariables.create("A32NX_FCU_EFIS_" + idString + "_NAVAID_2_MODE");
+    idFcuEisPanelBaroIsInhg[i] = localVariables.create("A32NX_FCU_EFIS_" + idString + "_BARO_IS_INHG");
+    idFcuEisDisplayBaroValueMode[i] = localVariables.create("A32NX_FCU_EFIS_" + idString + "_DISPLAY_BARO_VALUE_MODE");
+    idFcuEisDisplayBaroValue[i] = localVariables.create("A32NX_FCU_EFIS_" + idString + "_DISPLAY_BARO_VALUE");
+    idFcuEisDisplayBaroMode[i] = localVariables.create("A32NX_FCU_EFIS_" + idString + "_DISPLAY_BARO_MODE");
+
+    idFcuEisPanelFdLightOn[i] = localVariables.create("A32NX_FCU_EFIS_" + idString + "_FD_LIGHT_ON");
+    idFcuEisPanelLsLightOn[i] = localVariables.create("A32NX_FCU_EFIS_" + idString + "_LS_LIGHT_ON");
+    idFcuEisPanelCstrLightOn[i] = localVariables.create("A32NX_FCU_EFIS_" + idString + "_CSTR_LIGHT_ON");
+    idFcuEisPanelWptLightOn[i] = localVariables.create("A32NX_FCU_EFIS_" + idString + "_WPT_LIGHT_ON");
+    idFcuEisPanelVordLightOn[i] = localVariables.create("A32NX_FCU_EFIS_" + idString + "_VORD_LIGHT_ON");
+    idFcuEisPanelNdbLightOn[i] = localVariables.create("A32NX_FCU_EFIS_" + idString + "_NDB_LIGHT_ON");
+    idFcuEisPanelArptLightOn[i] = localVariables.create("A32NX_FCU_EFIS_" + idString + "_ARPT_LIGHT_ON");
+  }
+  idFcuAfsPanelAltIncrement1000 = localVariables.create("A32NX_FCU_ALT_INCREMENT_1000");
+
+  idFcuAfsPanelAp1LightOn = localVariables.create("A32NX_FCU_AP_1_LIGHT_ON");
+  idFcuAfsPanelAp2LightOn = localVariables.create("A32NX_FCU_AP_2_LIGHT_ON");
+  idFcuAfsPanelAthrLightOn = localVariables.create("A32NX_FCU_ATHR_LIGHT_ON");
+  idFcuAfsPanelLocLightOn = localVariables.create("A32NX_FCU_LOC_LIGHT_ON");
+  idFcuAfsPanelExpedLightOn = localVariables.create("A32NX_FCU_EXPED_LIGHT_ON");
+  idFcuAfsPanelApprLightOn = localVariables.create("A32NX_FCU_APPR_LIGHT_ON");
+  idFcuAfsDisplayTrkFpaMode = localVariables.create("A32NX_FCU_AFS_DISPLAY_TRK_FPA_MODE");
+  idFcuAfsDisplayMachMode = localVariables.create("A32NX_FCU_AFS_DISPLAY_MACH_MODE");
+  idFcuAfsDisplaySpdMachValue = localVariables.create("A32NX_FCU_AFS_DISPLAY_SPD_MACH_VALUE");
+  idFcuAfsDisplaySpdMachDashes = localVariables.create("A32NX_FCU_AFS_DISPLAY_SPD_MACH_DASHES");
+  idFcuAfsDisplaySpdMachManaged = localVariables.create("A32NX_FCU_AFS_DISPLAY_SPD_MACH_MANAGED");
+  idFcuAfsDisplayHdgTrkValue = localVariables.create("A32NX_FCU_AFS_DISPLAY_HDG_TRK_VALUE");
+  idFcuAfsDisplayHdgTrkDashes = localVariables.create("A32NX_FCU_AFS_DISPLAY_HDG_TRK_DASHES");
+  idFcuAfsDisplayHdgTrkManaged = localVariables.create("A32NX_FCU_AFS_DISPLAY_HDG_TRK_MANAGED");
+  idFcuAfsDisplayAltValue = localVariables.create("A32NX_FCU_AFS_DISPLAY_ALT_VALUE");
+  idFcuAfsDisplayLvlChManaged = localVariables.create("A32NX_FCU_AFS_DISPLAY_LVL_CH_MANAGED");
+  idFcuAfsDisplayVsFpaValue = localVariables.create("A32NX_FCU_AFS_DISPLAY_VS_FPA_VALUE");
+  idFcuAfsDisplayVsFpaDashes = localVariables.create("A32NX_FCU_AFS_DISPLAY_VS_FPA_DASHES");
+
+  idFcuHealthy = localVariables.create("A32NX_FCU_HEALTHY");
 
   for (int i = 0; i < 2; i++) {
     std::string idString = std::to_string(i + 1);
 
-    idEcuMaintenanceWord6[i] = std::make_unique<LocalVariable>("A32NX_ECU_" + idString + "_MAINTENANCE_WORD_6");
+    idEcuMaintenanceWord6[i] = localVariables.create("A32NX_ECU_" + idString + "_MAINTENANCE_WORD_6");
   }
 }
 
@@ -838,7 +1160,7 @@ bool FlyByWireInterface::handleFcuInitialization(double sampleTime) {
   }
 
   // get sim data
-  auto simData = simConnectInterface.getSimData();
+  const SimData& simData = simConnectInterface.getSimData();
 
   // remember simulation of ready signal
   if (simulationTimeReady == 0.0) {
@@ -894,7 +1216,7 @@ bool FlyByWireInterface::readDataAndLocalVariables(double sampleTime) {
   }
 
   // get sim data
-  SimData simData = simConnectInterface.getSimData();
+  const SimData& simData = simConnectInterface.getSimData();
 
   // update all local variables
   LocalVariable::readAll();
@@ -928,6 +1250,7 @@ bool FlyByWireInterface::readDataAndLocalVariables(double sampleTime) {
   calculatedSampleTime = std::max(0.002, simData.simulationTime - previousSimulationTime);
 
   monotonicTime += calculatedSampleTime;
+  frameCount++;
 
   // store previous simulation time
   previousSimulationTime = simData.simulationTime;
@@ -936,12 +1259,73 @@ bool FlyByWireInterface::readDataAndLocalVariables(double sampleTime) {
   return true;
 }
 
+bool FlyByWireInterface::updateStageTimings() {
+  stageTimings.setEnabled(idStageTimingEnabled->get());
+  if (!stageTimings.isEnabled()) {
+    return true;
+  }
+
+  // publish statistics of the selected stage
+  if (++stageTimingPublishCounter >= STAGE_TIMING_PUBLISH_INTERVAL) {
+    stageTimingPublishCounter = 0;
+
+    int stage = static_cast<int>(idStageTimingSelectedStage->get());
+    if (stage >= 0 && stage < STAGE_COUNT) {
+      StageTimings::Statistics statistics = stageTimings.getStatistics(stage);
+      idStageTimingMinimum->set(statistics.min_us);
+      idStageTimingMean->set(statistics.mean_us);
+      idStageTimingP99->set(statistics.p99_us);
+      idStageTimingMaximum->set(statistics.max_us);
+
+      StageScheduler::Statistics scheduleStatistics = stageScheduler.getStatistics(stage);
+      idStageTimingRate->set(scheduleStatistics.rate_hz);
+      idStageTimingMeanInterval->set(scheduleStatistics.meanInterval_ms);
+      idStageTimingRmsJitter->set(scheduleStatistics.rmsJitter_ms);
+      idStageTimingMaximumJitter->set(scheduleStatistics.maxJitter_ms);
+    }
+  }
+
+  // write all stages on request
+  if (idStageTimingWriteToFile->get() == 1) {
+    idStageTimingWriteToFile->set(0);
+    if (stageTimings.writeToFile(STAGE_TIMINGS_FILEPATH)) {
+      std::cout << "WASM: Stage timings written to " << STAGE_TIMINGS_FILEPATH << std::endl;
+    } else {
+      std::cout << "WASM: Failed to write stage timings to " << STAGE_TIMINGS_FILEPATH << std::endl;
+    }
+    if (stageScheduler.writeToFile(STAGE_SCHEDULE_FILEPATH)) {
+      std::cout << "WASM: Stage schedule written to " << STAGE_SCHEDULE_FILEPATH << std::endl;
+    } else {
+      std::cout << "WASM: Failed to write stage schedule to " << STAGE_SCHEDULE_FILEPATH << std::endl;
+    }
+  }
+
+  return true;
+}
+
+void FlyByWireInterface::flushLocalVariables() {
+  stageTimings.measure(STAGE_LVAR_FLUSH, [&] {
+    localVariables.flush();
+    return true;
+  });
+}
+
+double FlyByWireInterface::getMaximumAcceptableSampleTime() const {
+  // with the fixed step the laws stay stable as long as the frame fits into the sub-steps
+  if (elacFixedStep.isEnabled()) {
+    return std::max(MAX_ACCEPTABLE_SAMPLE_TIME, elacFixedStep.getMaximumSubSteps() * elacFixedStep.getStepTime());
+  }
+  return MAX_ACCEPTABLE_SAMPLE_TIME;
+}
+
 bool FlyByWireInterface::updatePerformanceMonitoring(double sampleTime) {
+  double maximumAcceptableSampleTime = getMaximumAcceptableSampleTime();
+
   // check calculated delta time for performance issues (to also take sim rate into account)
-  if (calculatedSampleTime > MAX_ACCEPTABLE_SAMPLE_TIME && lowPerformanceTimer < LOW_PERFORMANCE_TIMER_THRESHOLD) {
+  if (calculatedSampleTime > maximumAcceptableSampleTime && lowPerformanceTimer < LOW_PERFORMANCE_TIMER_THRESHOLD) {
     // performance is low -> increase counter
     lowPerformanceTimer++;
-  } else if (calculatedSampleTime < MAX_ACCEPTABLE_SAMPLE_TIME) {
+  } else if (calculatedSampleTime < maximumAcceptableSampleTime) {
     // performance is ok -> reset counter
     lowPerformanceTimer = 0;
   }
@@ -951,7 +1335,7 @@ bool FlyByWireInterface::updatePerformanceMonitoring(double sampleTime) {
     if (idPerformanceWarningActive->get() <= 0) {
       idPerformanceWarningActive->set(1);
       std::cout << "WASM: WARNING Performance issues detected, at least stable ";
-      std::cout << std::round(simConnectInterface.getSimData().simulation_rate / MAX_ACCEPTABLE_SAMPLE_TIME);
+      std::cout << std::round(simConnectInterface.getSimData().simulation_rate / maximumAcceptableSampleTime);
       std::cout << " fps or more are needed at this simrate!";
       std::cout << std::endl;
     }
@@ -965,7 +1349,7 @@ bool FlyByWireInterface::updatePerformanceMonitoring(double sampleTime) {
 
 bool FlyByWireInterface::handleSimulationRate(double sampleTime) {
   // get sim data
-  auto simData = simConnectInterface.getSimData();
+  const SimData& simData = simConnectInterface.getSimData();
 
   // check if target simulation rate was modified and there is a mismatch
   if (targetSimulationRateModified && simData.simulation_rate != targetSimulationRate) {
@@ -977,48 +1361,58 @@ bool FlyByWireInterface::handleSimulationRate(double sampleTime) {
   targetSimulationRate = simData.simulation_rate;
   targetSimulationRateModified = false;
 
-  // nothing to do if simulation rate is '1x'
-  if (simData.simulation_rate == 1) {
-    return true;
-  }
-
-  // check if allowed simulation rate is exceeded
-  if (simData.simulation_rate > idMaximumSimulationRate->get()) {
-    // set target simulation rate
-    targetSimulationRateModified = true;
-    targetSimulationRate = std::max(1., simData.simulation_rate / 2);
-    // sed event to reduce simulation rate
-    simConnectInterface.sendEvent(SimConnectInterface::Events::SIM_RATE_DECR, 0, SIMCONNECT_GROUP_PRIORITY_DEFAULT);
-    // log event of reduction
-    std::cout << "WASM: WARNING Reducing simulation rate to " << simData.simulation_rate / 2;
-    std::cout << " (maximum allowed is " << idMaximumSimulationRate->get() << ")!" << std::endl;
-  }
-
-  // check if simulation rate reduction is enabled
-  if (!simulationRateReductionEnabled) {
-    return true;
-  }
-
   bool elac1ProtActive = false;
   bool elac2ProtActive = false;
-  bool apSpeedProtActive = Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[0].fmgc_a_bus.discrete_word_4, 29, false) ||
-                           Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[1].fmgc_a_bus.discrete_word_4, 29, false);
-
-  // check if simulation rate should be reduced
-  if (idPerformanceWarningActive->get() == 1 || abs(simConnectInterface.getSimData().Phi_deg) > 33 ||
-      simConnectInterface.getSimData().Theta_deg < -20 || simConnectInterface.getSimData().Theta_deg > 10 || elac1ProtActive ||
-      elac2ProtActive || apSpeedProtActive) {
+  bool apSpeedProtActive = Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[0]->fmgc_a_bus.discrete_word_4, 29, false) ||
+                           Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[1]->fmgc_a_bus.discrete_word_4, 29, false);
+
+  // let the governor decide on the simulation rate
+  SimulationRateGovernor::Inputs governorInputs = {};
+  governorInputs.frameTime = sampleTime;
+  governorInputs.simulationRate = simData.simulation_rate;
+  governorInputs.maximumSimulationRate = idMaximumSimulationRate->get();
+  governorInputs.maximumAcceptableSampleTime = getMaximumAcceptableSampleTime();
+  governorInputs.reductionEnabled = simulationRateReductionEnabled;
+  governorInputs.performanceIssue = idPerformanceWarningActive->get() == 1;
+  governorInputs.abnormalSituation = abs(simData.Phi_deg) > 33 || simData.Theta_deg < -20 || simData.Theta_deg > 10 || elac1ProtActive ||
+                                     elac2ProtActive || apSpeedProtActive;
+  governorInputs.computeTimeScalesWithRate = elacFixedStep.isEnabled();
+  auto decision = simulationRateGovernor.update(governorInputs);
+  auto reason = simulationRateGovernor.getReason();
+
+  // publish the decision
+  idSimulationRateGovernorDecision->set(static_cast<int>(decision));
+  idSimulationRateGovernorReason->set(static_cast<int>(reason));
+  idSimulationRateGovernorRequestedRate->set(simulationRateGovernor.getRequestedSimulationRate());
+  idSimulationRateGovernorSafeRate->set(simulationRateGovernor.getSafeSimulationRate());
+
+  if (decision == SimulationRateGovernor::Decision::Decrease) {
     // set target simulation rate
     targetSimulationRateModified = true;
     targetSimulationRate = std::max(1., simData.simulation_rate / 2);
     // send event to reduce simulation rate
     simConnectInterface.sendEvent(SimConnectInterface::Events::SIM_RATE_DECR, 0, SIMCONNECT_GROUP_PRIORITY_DEFAULT);
-    // reset low performance timer
-    lowPerformanceTimer = 0;
     // log event of reduction
-    std::cout << "WASM: WARNING Reducing simulation rate from " << simData.simulation_rate;
-    std::cout << " to " << simData.simulation_rate / 2;
-    std::cout << " due to performance issues or abnormal situation!" << std::endl;
+    if (reason == SimulationRateGovernor::Reason::MaximumExceeded) {
+      std::cout << "WASM: WARNING Reducing simulation rate to " << simData.simulation_rate / 2;
+      std::cout << " (maximum allowed is " << idMaximumSimulationRate->get() << ")!" << std::endl;
+    } else {
+      // reset low performance timer
+      lowPerformanceTimer = 0;
+      std::cout << "WASM: WARNING Reducing simulation rate from " << simData.simulation_rate;
+      std::cout << " to " << simData.simulation_rate / 2;
+      std::cout << " due to performance issues or abnormal situation!" << std::endl;
+    }
+  } else if (decision == SimulationRateGovernor::Decision::Increase) {
+    // set target simulation rate
+    targetSimulationRateModified = true;
+    targetSimulationRate = simData.simulation_rate * 2;
+    // send event to restore simulation rate
+    simConnectInterface.sendEvent(SimConnectInterface::Events::SIM_RATE_INCR, 0, SIMCONNECT_GROUP_PRIORITY_DEFAULT);
+    // log event of recovery
+    std::cout << "WASM: Restoring simulation rate from " << simData.simulation_rate;
+    std::cout << " to " << simData.simulation_rate * 2;
+    std::cout << " (requested " << simulationRateGovernor.getRequestedSimulationRate() << ")" << std::endl;
   }
 
   // success
@@ -1027,7 +1421,7 @@ bool FlyByWireInterface::handleSimulationRate(double sampleTime) {
 
 bool FlyByWireInterface::updateRadioReceiver(double sampleTime) {
   // get sim data
-  auto simData = simConnectInterface.getSimData();
+  const SimData& simData = simConnectInterface.getSimData();
 
   // get localizer data
   auto localizer = radioReceiver.calculateLocalizerDeviation(
@@ -1059,8 +1453,8 @@ bool FlyByWireInterface::updateRadioReceiver(double sampleTime) {
 }
 
 bool FlyByWireInterface::updateBaseData(double sampleTime) {
-  auto simData = simConnectInterface.getSimData();
-  auto simInputs = simConnectInterface.getSimInput();
+  const SimData& simData = simConnectInterface.getSimData();
+  const SimInput& simInputs = simConnectInterface.getSimInput();
 
   // constants
   double g = 9.81;
@@ -1145,7 +1539,7 @@ bool FlyByWireInterface::updateBaseData(double sampleTime) {
 }
 
 bool FlyByWireInterface::updateAircraftSpecificData(double sampleTime) {
-  auto simData = simConnectInterface.getSimData();
+  const SimData& simData = simConnectInterface.getSimData();
 
   aircraftSpecificData.simulation_input_throttle_lever_1_pos = simData.throttle_lever_1_pos;
   aircraftSpecificData.simulation_input_throttle_lever_2_pos = simData.throttle_lever_1_pos;
@@ -1153,9 +1547,9 @@ bool FlyByWireInterface::updateAircraftSpecificData(double sampleTime) {
   aircraftSpecificData.simulation_input_throttle_lever_2_angle = thrustLeverAngle_2->get();
   aircraftSpecificData.aircraft_engine_1_N1_percent = simData.corrected_engine_N1_1_percent;
   aircraftSpecificData.aircraft_engine_2_N1_percent = simData.corrected_engine_N1_2_percent;
-  aircraftSpecificData.aircraft_hydraulic_system_green_pressure_psi = idHydraulicGreenPressure->get();
-  aircraftSpecificData.aircraft_hydraulic_system_blue_pressure_psi = idHydraulicBluePressure->get();
-  aircraftSpecificData.aircraft_hydraulic_system_yellow_pressure_psi = idHydraulicYellowPressure->get();
+  aircraftSpecificData.aircraft_hydraulic_system_green_pressure_psi = idHydGreenSystemPressure->get();
+  aircraftSpecificData.aircraft_hydraulic_system_blue_pressure_psi = idHydBlueSystemPressure->get();
+  aircraftSpecificData.aircraft_hydraulic_system_yellow_pressure_psi = idHydYellowSystemPressure->get();
   aircraftSpecificData.aircraft_autobrake_system_armed_mode = idAutobrakeArmedMode->get();
   aircraftSpecificData.aircraft_autobrake_system_is_decel_light_on = idAutobrakeDecelLight->get();
   aircraftSpecificData.aircraft_gear_nosewheel_pos = idNoseWheelPosition->get();
@@ -1166,11 +1560,11 @@ bool FlyByWireInterface::updateAircraftSpecificData(double sampleTime) {
   aircraftSpecificData.aircraft_is_master_caution_active = idMasterCaution->get();
   aircraftSpecificData.aircraft_is_wing_anti_ice_active = idWingAntiIce->get();
   aircraftSpecificData.aircraft_is_alpha_floor_condition_active =
-      reinterpret_cast<Arinc429DiscreteWord*>(&facsBusOutputs[0].discrete_word_5)->bitFromValueOr(29, false) ||
-      reinterpret_cast<Arinc429DiscreteWord*>(&facsBusOutputs[1].discrete_word_5)->bitFromValueOr(29, false);
+      reinterpret_cast<const Arinc429DiscreteWord*>(&facsBusOutputs[0]->discrete_word_5)->bitFromValueOr(29, false) ||
+      reinterpret_cast<const Arinc429DiscreteWord*>(&facsBusOutputs[1]->discrete_word_5)->bitFromValueOr(29, false);
   aircraftSpecificData.aircraft_is_high_aoa_protection_active =
-      reinterpret_cast<Arinc429DiscreteWord*>(&elacsBusOutputs[0].discrete_status_word_2)->bitFromValueOr(23, false) ||
-      reinterpret_cast<Arinc429DiscreteWord*>(&elacsBusOutputs[1].discrete_status_word_2)->bitFromValueOr(23, false);
+      reinterpret_cast<const Arinc429DiscreteWord*>(&elacsBusOutputs[0]->discrete_status_word_2)->bitFromValueOr(23, false) ||
+      reinterpret_cast<const Arinc429DiscreteWord*>(&elacsBusOutputs[1]->discrete_status_word_2)->bitFromValueOr(23, false);
   aircraftSpecificData.aircraft_settings_is_realistic_tiller_enabled = idRealisticTillerEnabled->get() == 1;
   aircraftSpecificData.aircraft_settings_any_failures_active = failuresConsumer.isAnyActive() ? 1.0 : 0.0;
 
@@ -1232,7 +1626,7 @@ bool FlyByWireInterface::updateFadec(int fadecIndex) {
 }
 
 bool FlyByWireInterface::updateIls(int ilsIndex) {
-  SimData simData = simConnectInterface.getSimData();
+  const SimData& simData = simConnectInterface.getSimData();
 
   bool nav_loc_valid;
   double nav_loc_error_deg;
@@ -1359,8 +1753,8 @@ bool FlyByWireInterface::updateElac(double sampleTime, int elacIndex) {
   }
 
   const int oppElacIndex = elacIndex == 0 ? 1 : 0;
-  SimData simData = simConnectInterface.getSimData();
-  SimInput simInput = simConnectInterface.getSimInput();
+  const SimData& simData = simConnectInterface.getSimData();
+  const SimInput& simInput = simConnectInterface.getSimInput();
 
   elacs[elacIndex].modelInputs.in.time.dt = sampleTime;
   elacs[elacIndex].modelInputs.in.time.simulation_time = simData.simulationTime;
@@ -1429,17 +1823,17 @@ bool FlyByWireInterface::updateElac(double sampleTime, int elacIndex) {
   elacs[elacIndex].modelInputs.in.bus_inputs.ir_1_bus = irBusOutputs[0];
   elacs[elacIndex].modelInputs.in.bus_inputs.ir_2_bus = irBusOutputs[1];
   elacs[elacIndex].modelInputs.in.bus_inputs.ir_3_bus = irBusOutputs[2];
-  elacs[elacIndex].modelInputs.in.bus_inputs.fmgc_1_bus = fmgcsBusOutputs[0].fmgc_b_bus;
-  elacs[elacIndex].modelInputs.in.bus_inputs.fmgc_2_bus = fmgcsBusOutputs[1].fmgc_b_bus;
+  elacs[elacIndex].modelInputs.in.bus_inputs.fmgc_1_bus = fmgcsBusOutputs[0]->fmgc_b_bus;
+  elacs[elacIndex].modelInputs.in.bus_inputs.fmgc_2_bus = fmgcsBusOutputs[1]->fmgc_b_bus;
   elacs[elacIndex].modelInputs.in.bus_inputs.ra_1_bus = raBusOutputs[0];
   elacs[elacIndex].modelInputs.in.bus_inputs.ra_2_bus = raBusOutputs[1];
   elacs[elacIndex].modelInputs.in.bus_inputs.sfcc_1_bus = sfccBusOutputs[0];
   elacs[elacIndex].modelInputs.in.bus_inputs.sfcc_2_bus = sfccBusOutputs[1];
-  elacs[elacIndex].modelInputs.in.bus_inputs.fcdc_1_bus = fcdcsBusOutputs[0];
-  elacs[elacIndex].modelInputs.in.bus_inputs.fcdc_2_bus = fcdcsBusOutputs[1];
-  elacs[elacIndex].modelInputs.in.bus_inputs.sec_1_bus = secsBusOutputs[0];
-  elacs[elacIndex].modelInputs.in.bus_inputs.sec_2_bus = secsBusOutputs[1];
-  elacs[elacIndex].modelInputs.in.bus_inputs.elac_opp_bus = elacsBusOutputs[oppElacIndex];
+  elacs[elacIndex].modelInputs.in.bus_inputs.fcdc_1_bus = *fcdcsBusOutputs[0];
+  elacs[elacIndex].modelInputs.in.bus_inputs.fcdc_2_bus = *fcdcsBusOutputs[1];
+  elacs[elacIndex].modelInputs.in.bus_inputs.sec_1_bus = *secsBusOutputs[0];
+  elacs[elacIndex].modelInputs.in.bus_inputs.sec_2_bus = *secsBusOutputs[1];
+  elacs[elacIndex].modelInputs.in.bus_inputs.elac_opp_bus = *elacsBusOutputs[oppElacIndex];
 
   if (elacIndex == elacDisabled) {
     simConnectInterface.setClientDataElacDiscretes(elacs[elacIndex].modelInputs.in.discrete_inputs);
@@ -1447,7 +1841,7 @@ bool FlyByWireInterface::updateElac(double sampleTime, int elacIndex) {
 
     elacsDiscreteOutputs[elacIndex] = simConnectInterface.getClientDataElacDiscretesOutput();
     elacsAnalogOutputs[elacIndex] = simConnectInterface.getClientDataElacAnalogsOutput();
-    elacsBusOutputs[elacIndex] = simConnectInterface.getClientDataElacBusOutput();
+    elacsClientDataBusOutputs[elacIndex] = simConnectInterface.getClientDataElacBusOutput();
   } else {
     bool powerSupplyAvailable = false;
     if (elacIndex == 0) {
@@ -1477,16 +1871,21 @@ bool FlyByWireInterface::updateElac(double sampleTime, int elacIndex) {
       powerSupplyAvailable = elac2EmerPowersupplyActive ? idElecBat2HotBusPowered->get() : idElecDcBus2Powered->get();
     }
 
-    elacs[elacIndex].update(sampleTime, simData.simulationTime,
-                            failuresConsumer.isActive(elacIndex == 0 ? Failures::Elac1 : Failures::Elac2), powerSupplyAvailable);
+    bool faultActive = failuresConsumer.isActive(elacIndex == 0 ? Failures::Elac1 : Failures::Elac2);
+    if (elacFixedStep.isEnabled()) {
+      updateElacFixedStep(elacIndex, faultActive, powerSupplyAvailable);
+    } else {
+      flightDataRecorder.recordElacInputs(elacIndex, elacs[elacIndex].modelInputs, sampleTime, simData.simulationTime, faultActive,
+                                          powerSupplyAvailable);
+      elacs[elacIndex].update(sampleTime, simData.simulationTime, faultActive, powerSupplyAvailable);
+    }
 
     elacsDiscreteOutputs[elacIndex] = elacs[elacIndex].getDiscreteOutputs();
     elacsAnalogOutputs[elacIndex] = elacs[elacIndex].getAnalogOutputs();
-    elacsBusOutputs[elacIndex] = elacs[elacIndex].getBusOutputs();
   }
 
   if (oppElacIndex == elacDisabled || secDisabled != -1 || facDisabled != -1) {
-    simConnectInterface.setClientDataElacBusInput(elacsBusOutputs[elacIndex], elacIndex);
+    simConnectInterface.setClientDataElacBusInput(*elacsBusOutputs[elacIndex], elacIndex);
   }
 
   idElacDigitalOpValidated[elacIndex]->set(elacsDiscreteOutputs[elacIndex].digital_output_validated);
@@ -1494,6 +1893,51 @@ bool FlyByWireInterface::updateElac(double sampleTime, int elacIndex) {
   return true;
 }
 
+void FlyByWireInterface::updateElacFixedStep(int elacIndex, bool faultActive, bool isPowered) {
+  ElacComputer::ExternalInputs_ElacComputer_T& modelInputs = elacs[elacIndex].modelInputs;
+
+  ElacFrameInputs current = {};
+  current.frameCount = frameCount;
+  current.monotonicTime = monotonicTime;
+  current.simulationTime = modelInputs.in.time.simulation_time;
+  current.analogInputs = modelInputs.in.analog_inputs;
+  current.adrBusses[0] = modelInputs.in.bus_inputs.adr_1_bus;
+  current.adrBusses[1] = modelInputs.in.bus_inputs.adr_2_bus;
+  current.adrBusses[2] = modelInputs.in.bus_inputs.adr_3_bus;
+  current.irBusses[0] = modelInputs.in.bus_inputs.ir_1_bus;
+  current.irBusses[1] = modelInputs.in.bus_inputs.ir_2_bus;
+  current.irBusses[2] = modelInputs.in.bus_inputs.ir_3_bus;
+
+  // only interpolate from the directly preceding frame, after a frame without the ELAC (pause, slew, unpowered or the
+  // first frame) the inputs of the frame are held
+  ElacFrameInputs& previous = elacPreviousFrameInputs[elacIndex];
+  const ElacFrameInputs& from = previous.frameCount > 0 && previous.frameCount + 1 == frameCount ? previous : current;
+
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < elacFixedStep.getSubSteps(); i++) {
+    double fraction = elacFixedStep.getSubStepFraction(i);
+    double subStepTime = elacFixedStep.getSubStepTime();
+
+    modelInputs.in.time.dt = subStepTime;
+    modelInputs.in.time.simulation_time = interpolate(from.simulationTime, current.simulationTime, fraction);
+    modelInputs.in.time.monotonic_time = interpolate(from.monotonicTime, current.monotonicTime, fraction);
+    interpolateAnalogInputs(modelInputs.in.analog_inputs, from.analogInputs, current.analogInputs, fraction);
+    interpolateAdrBus(modelInputs.in.bus_inputs.adr_1_bus, from.adrBusses[0], current.adrBusses[0], fraction);
+    interpolateAdrBus(modelInputs.in.bus_inputs.adr_2_bus, from.adrBusses[1], current.adrBusses[1], fraction);
+    interpolateAdrBus(modelInputs.in.bus_inputs.adr_3_bus, from.adrBusses[2], current.adrBusses[2], fraction);
+    interpolateIrBus(modelInputs.in.bus_inputs.ir_1_bus, from.irBusses[0], current.irBusses[0], fraction);
+    interpolateIrBus(modelInputs.in.bus_inputs.ir_2_bus, from.irBusses[1], current.irBusses[1], fraction);
+    interpolateIrBus(modelInputs.in.bus_inputs.ir_3_bus, from.irBusses[2], current.irBusses[2], fraction);
+
+    // the model replay keeps the last sub-step of the frame
+    flightDataRecorder.recordElacInputs(elacIndex, modelInputs, subStepTime, modelInputs.in.time.simulation_time, faultActive, isPowered);
+    elacs[elacIndex].update(subStepTime, modelInputs.in.time.simulation_time, faultActive, isPowered);
+  }
+  elacFixedStepExecutionTime += std::chrono::steady_clock::now() - start;
+
+  previous = current;
+}
+
 bool FlyByWireInterface::updateSec(double sampleTime, int secIndex) {
   // do not further process when active pause is on
   if (simConnectInterface.isSimInActivePause()) {
@@ -1501,8 +1945,8 @@ bool FlyByWireInterface::updateSec(double sampleTime, int secIndex) {
   }
 
   const int oppSecIndex = secIndex == 0 ? 1 : 0;
-  SimData simData = simConnectInterface.getSimData();
-  SimInput simInput = simConnectInterface.getSimInput();
+  const SimData& simData = simConnectInterface.getSimData();
+  const SimInput& simInput = simConnectInterface.getSimInput();
 
   secs[secIndex].modelInputs.in.time.dt = sampleTime;
   secs[secIndex].modelInputs.in.time.simulation_time = simData.simulationTime;
@@ -1610,10 +2054,10 @@ bool FlyByWireInterface::updateSec(double sampleTime, int secIndex) {
     secs[secIndex].modelInputs.in.bus_inputs.ir_2_bus = irBusOutputs[2];
   }
 
-  secs[secIndex].modelInputs.in.bus_inputs.fcdc_1_bus = fcdcsBusOutputs[0];
-  secs[secIndex].modelInputs.in.bus_inputs.fcdc_2_bus = fcdcsBusOutputs[1];
-  secs[secIndex].modelInputs.in.bus_inputs.elac_1_bus = elacsBusOutputs[0];
-  secs[secIndex].modelInputs.in.bus_inputs.elac_2_bus = elacsBusOutputs[1];
+  secs[secIndex].modelInputs.in.bus_inputs.fcdc_1_bus = *fcdcsBusOutputs[0];
+  secs[secIndex].modelInputs.in.bus_inputs.fcdc_2_bus = *fcdcsBusOutputs[1];
+  secs[secIndex].modelInputs.in.bus_inputs.elac_1_bus = *elacsBusOutputs[0];
+  secs[secIndex].modelInputs.in.bus_inputs.elac_2_bus = *elacsBusOutputs[1];
   secs[secIndex].modelInputs.in.bus_inputs.sfcc_1_bus = sfccBusOutputs[0];
   secs[secIndex].modelInputs.in.bus_inputs.sfcc_2_bus = sfccBusOutputs[1];
   secs[secIndex].modelInputs.in.bus_inputs.lgciu_1_bus = lgciuBusOutputs[0];
@@ -1625,7 +2069,7 @@ bool FlyByWireInterface::updateSec(double sampleTime, int secIndex) {
 
     secsDiscreteOutputs[secIndex] = simConnectInterface.getClientDataSecDiscretesOutput();
     secsAnalogOutputs[secIndex] = simConnectInterface.getClientDataSecAnalogsOutput();
-    secsBusOutputs[secIndex] = simConnectInterface.getClientDataSecBusOutput();
+    secsClientDataBusOutputs[secIndex] = simConnectInterface.getClientDataSecBusOutput();
   } else {
     bool powerSupplyAvailable = false;
     if (secIndex == 0) {
@@ -1638,15 +2082,17 @@ bool FlyByWireInterface::updateSec(double sampleTime, int secIndex) {
     }
 
     Failures failureIndex = secIndex == 0 ? Failures::Sec1 : (secIndex == 1 ? Failures::Sec2 : Failures::Sec3);
-    secs[secIndex].update(sampleTime, simData.simulationTime, failuresConsumer.isActive(failureIndex), powerSupplyAvailable);
+    bool faultActive = failuresConsumer.isActive(failureIndex);
+    flightDataRecorder.recordSecInputs(secIndex, secs[secIndex].modelInputs, sampleTime, simData.simulationTime, faultActive,
+                                       powerSupplyAvailable);
+    secs[secIndex].update(sampleTime, simData.simulationTime, faultActive, powerSupplyAvailable);
 
     secsDiscreteOutputs[secIndex] = secs[secIndex].getDiscreteOutputs();
     secsAnalogOutputs[secIndex] = secs[secIndex].getAnalogOutputs();
-    secsBusOutputs[secIndex] = secs[secIndex].getBusOutputs();
   }
 
   if (elacDisabled != -1 && secIndex < 2) {
-    simConnectInterface.setClientDataSecBus(secsBusOutputs[secIndex], secIndex);
+    simConnectInterface.setClientDataSecBus(*secsBusOutputs[secIndex], secIndex);
   }
 
   idSecFaultLightOn[secIndex]->set(secsDiscreteOutputs[secIndex].sec_failed);
@@ -1673,45 +2119,37 @@ bool FlyByWireInterface::updateFcdc(double sampleTime, int fcdcIndex) {
   fcdcs[fcdcIndex].discreteInputs.elac2Off = !idElacPushbuttonPressed[1]->get();
   fcdcs[fcdcIndex].discreteInputs.sec2Off = !idSecPushbuttonPressed[1]->get();
 
-  fcdcs[fcdcIndex].busInputs.elac1 = elacsBusOutputs[0];
-  fcdcs[fcdcIndex].busInputs.sec1 = secsBusOutputs[0];
-  fcdcs[fcdcIndex].busInputs.fcdcOpp = fcdcsBusOutputs[oppFcdcIndex];
-  fcdcs[fcdcIndex].busInputs.elac2 = elacsBusOutputs[1];
-  fcdcs[fcdcIndex].busInputs.sec2 = secsBusOutputs[1];
-  fcdcs[fcdcIndex].busInputs.sec3 = secsBusOutputs[2];
 
   fcdcs[fcdcIndex].update(sampleTime, failuresConsumer.isActive(fcdcIndex == 0 ? Failures::Fcdc1 : Failures::Fcdc2),
                           fcdcIndex == 0 ? idElecDcEssShedBusPowered->get() : idElecDcBus2Powered->get());
 
   fcdcsDiscreteOutputs[fcdcIndex] = fcdcs[fcdcIndex].getDiscreteOutputs();
-  FcdcBus bus = fcdcs[fcdcIndex].getBusOutputs();
-  fcdcsBusOutputs[fcdcIndex] = *reinterpret_cast<base_fcdc_bus*>(&bus);
-
-  idFcdcDiscreteWord1[fcdcIndex]->set(Arinc429Utils::toSimVar(fcdcsBusOutputs[fcdcIndex].efcs_status_word_1));
-  idFcdcDiscreteWord2[fcdcIndex]->set(Arinc429Utils::toSimVar(fcdcsBusOutputs[fcdcIndex].efcs_status_word_2));
-  idFcdcDiscreteWord3[fcdcIndex]->set(Arinc429Utils::toSimVar(fcdcsBusOutputs[fcdcIndex].efcs_status_word_3));
-  idFcdcDiscreteWord4[fcdcIndex]->set(Arinc429Utils::toSimVar(fcdcsBusOutputs[fcdcIndex].efcs_status_word_4));
-  idFcdcDiscreteWord5[fcdcIndex]->set(Arinc429Utils::toSimVar(fcdcsBusOutputs[fcdcIndex].efcs_status_word_5));
-  idFcdcCaptRollCommand[fcdcIndex]->set(Arinc429Utils::toSimVar(fcdcsBusOutputs[fcdcIndex].capt_roll_command_deg));
-  idFcdcFoRollCommand[fcdcIndex]->set(Arinc429Utils::toSimVar(fcdcsBusOutputs[fcdcIndex].fo_roll_command_deg));
-  idFcdcCaptPitchCommand[fcdcIndex]->set(Arinc429Utils::toSimVar(fcdcsBusOutputs[fcdcIndex].capt_pitch_command_deg));
-  idFcdcFoPitchCommand[fcdcIndex]->set(Arinc429Utils::toSimVar(fcdcsBusOutputs[fcdcIndex].fo_pitch_command_deg));
-  idFcdcRudderPedalPos[fcdcIndex]->set(Arinc429Utils::toSimVar(fcdcsBusOutputs[fcdcIndex].rudder_pedal_position_deg));
-  idFcdcAileronLeftPos[fcdcIndex]->set(Arinc429Utils::toSimVar(fcdcsBusOutputs[fcdcIndex].aileron_left_pos_deg));
-  idFcdcElevatorLeftPos[fcdcIndex]->set(Arinc429Utils::toSimVar(fcdcsBusOutputs[fcdcIndex].elevator_left_pos_deg));
-  idFcdcAileronRightPos[fcdcIndex]->set(Arinc429Utils::toSimVar(fcdcsBusOutputs[fcdcIndex].aileron_right_pos_deg));
-  idFcdcElevatorRightPos[fcdcIndex]->set(Arinc429Utils::toSimVar(fcdcsBusOutputs[fcdcIndex].elevator_right_pos_deg));
-  idFcdcElevatorTrimPos[fcdcIndex]->set(Arinc429Utils::toSimVar(fcdcsBusOutputs[fcdcIndex].horiz_stab_trim_pos_deg));
-  idFcdcSpoilerLeft1Pos[fcdcIndex]->set(Arinc429Utils::toSimVar(fcdcsBusOutputs[fcdcIndex].spoiler_1_left_pos_deg));
-  idFcdcSpoilerLeft2Pos[fcdcIndex]->set(Arinc429Utils::toSimVar(fcdcsBusOutputs[fcdcIndex].spoiler_2_left_pos_deg));
-  idFcdcSpoilerLeft3Pos[fcdcIndex]->set(Arinc429Utils::toSimVar(fcdcsBusOutputs[fcdcIndex].spoiler_3_left_pos_deg));
-  idFcdcSpoilerLeft4Pos[fcdcIndex]->set(Arinc429Utils::toSimVar(fcdcsBusOutputs[fcdcIndex].spoiler_4_left_pos_deg));
-  idFcdcSpoilerLeft5Pos[fcdcIndex]->set(Arinc429Utils::toSimVar(fcdcsBusOutputs[fcdcIndex].spoiler_5_left_pos_deg));
-  idFcdcSpoilerRight1Pos[fcdcIndex]->set(Arinc429Utils::toSimVar(fcdcsBusOutputs[fcdcIndex].spoiler_1_right_pos_deg));
-  idFcdcSpoilerRight2Pos[fcdcIndex]->set(Arinc429Utils::toSimVar(fcdcsBusOutputs[fcdcIndex].spoiler_2_right_pos_deg));
-  idFcdcSpoilerRight3Pos[fcdcIndex]->set(Arinc429Utils::toSimVar(fcdcsBusOutputs[fcdcIndex].spoiler_3_right_pos_deg));
-  idFcdcSpoilerRight4Pos[fcdcIndex]->set(Arinc429Utils::toSimVar(fcdcsBusOutputs[fcdcIndex].spoiler_4_right_pos_deg));
-  idFcdcSpoilerRight5Pos[fcdcIndex]->set(Arinc429Utils::toSimVar(fcdcsBusOutputs[fcdcIndex].spoiler_5_right_pos_deg));
+
+  idFcdcDiscreteWord1[fcdcIndex]->set(Arinc429Utils::toSimVar(fcdcsBusOutputs[fcdcIndex]->efcs_status_word_1));
+  idFcdcDiscreteWord2[fcdcIndex]->set(Arinc429Utils::toSimVar(fcdcsBusOutputs[fcdcIndex]->efcs_status_word_2));
+  idFcdcDiscreteWord3[fcdcIndex]->set(Arinc429Utils::toSimVar(fcdcsBusOutputs[fcdcIndex]->efcs_status_word_3));
+  idFcdcDiscreteWord4[fcdcIndex]->set(Arinc429Utils::toSimVar(fcdcsBusOutputs[fcdcIndex]->efcs_status_word_4));
+  idFcdcDiscreteWord5[fcdcIndex]->set(Arinc429Utils::toSimVar(fcdcsBusOutputs[fcdcIndex]->efcs_status_word_5));
+  idFcdcCaptRollCommand[fcdcIndex]->set(Arinc429Utils::toSimVar(fcdcsBusOutputs[fcdcIndex]->capt_roll_command_deg));
+  idFcdcFoRollCommand[fcdcIndex]->set(Arinc429Utils::toSimVar(fcdcsBusOutputs[fcdcIndex]->fo_roll_command_deg));
+  idFcdcCaptPitchCommand[fcdcIndex]->set(Arinc429Utils::toSimVar(fcdcsBusOutputs[fcdcIndex]->capt_pitch_command_deg));
+  idFcdcFoPitchCommand[fcdcIndex]->set(Arinc429Utils::toSimVar(fcdcsBusOutputs[fcdcIndex]->fo_pitch_command_deg));
+  idFcdcRudderPedalPos[fcdcIndex]->set(Arinc429Utils::toSimVar(fcdcsBusOutputs[fcdcIndex]->rudder_pedal_position_deg));
+  idFcdcAileronLeftPos[fcdcIndex]->set(Arinc429Utils::toSimVar(fcdcsBusOutputs[fcdcIndex]->aileron_left_pos_deg));
+  idFcdcElevatorLeftPos[fcdcIndex]->set(Arinc429Utils::toSimVar(fcdcsBusOutputs[fcdcIndex]->elevator_left_pos_deg));
+  idFcdcAileronRightPos[fcdcIndex]->set(Arinc429Utils::toSimVar(fcdcsBusOutputs[fcdcIndex]->aileron_right_pos_deg));
+  idFcdcElevatorRightPos[fcdcIndex]->set(Arinc429Utils::toSimVar(fcdcsBusOutputs[fcdcIndex]->elevator_right_pos_deg));
+  idFcdcElevatorTrimPos[fcdcIndex]->set(Arinc429Utils::toSimVar(fcdcsBusOutputs[fcdcIndex]->horiz_stab_trim_pos_deg));
+  idFcdcSpoilerLeft1Pos[fcdcIndex]->set(Arinc429Utils::toSimVar(fcdcsBusOutputs[fcdcIndex]->spoiler_1_left_pos_deg));
+  idFcdcSpoilerLeft2Pos[fcdcIndex]->set(Arinc429Utils::toSimVar(fcdcsBusOutputs[fcdcIndex]->spoiler_2_left_pos_deg));
+  idFcdcSpoilerLeft3Pos[fcdcIndex]->set(Arinc429Utils::toSimVar(fcdcsBusOutputs[fcdcIndex]->spoiler_3_left_pos_deg));
+  idFcdcSpoilerLeft4Pos[fcdcIndex]->set(Arinc429Utils::toSimVar(fcdcsBusOutputs[fcdcIndex]->spoiler_4_left_pos_deg));
+  idFcdcSpoilerLeft5Pos[fcdcIndex]->set(Arinc429Utils::toSimVar(fcdcsBusOutputs[fcdcIndex]->spoiler_5_left_pos_deg));
+  idFcdcSpoilerRight1Pos[fcdcIndex]->set(Arinc429Utils::toSimVar(fcdcsBusOutputs[fcdcIndex]->spoiler_1_right_pos_deg));
+  idFcdcSpoilerRight2Pos[fcdcIndex]->set(Arinc429Utils::toSimVar(fcdcsBusOutputs[fcdcIndex]->spoiler_2_right_pos_deg));
+  idFcdcSpoilerRight3Pos[fcdcIndex]->set(Arinc429Utils::toSimVar(fcdcsBusOutputs[fcdcIndex]->spoiler_3_right_pos_deg));
+  idFcdcSpoilerRight4Pos[fcdcIndex]->set(Arinc429Utils::toSimVar(fcdcsBusOutputs[fcdcIndex]->spoiler_4_right_pos_deg));
+  idFcdcSpoilerRight5Pos[fcdcIndex]->set(Arinc429Utils::toSimVar(fcdcsBusOutputs[fcdcIndex]->spoiler_5_right_pos_deg));
 
   idFcdcPriorityCaptGreen[fcdcIndex]->set(fcdcsDiscreteOutputs[fcdcIndex].captGreenPriorityLightOn);
   idFcdcPriorityCaptRed[fcdcIndex]->set(fcdcsDiscreteOutputs[fcdcIndex].captRedPriorityLightOn);
@@ -1723,8 +2161,8 @@ bool FlyByWireInterface::updateFcdc(double sampleTime, int fcdcIndex) {
 
 bool FlyByWireInterface::updateFmgc(double sampleTime, int fmgcIndex) {
   const int oppFmgcIndex = fmgcIndex == 0 ? 1 : 0;
-  SimData simData = simConnectInterface.getSimData();
-  SimInputAutopilot simInputAutopilot = simConnectInterface.getSimInputAutopilot();
+  const SimData& simData = simConnectInterface.getSimData();
+  const SimInputAutopilot& simInputAutopilot = simConnectInterface.getSimInputAutopilot();
 
   fmgcs[fmgcIndex].modelInputs.in.time.dt = sampleTime;
   fmgcs[fmgcIndex].modelInputs.in.time.simulation_time = simData.simulationTime;
@@ -1819,8 +2257,8 @@ bool FlyByWireInterface::updateFmgc(double sampleTime, int fmgcIndex) {
   fmgcs[fmgcIndex].modelInputs.in.fms_inputs.thrust_reduction_alt_ft = fmThrustReductionAltitude->valueOr(0);
   fmgcs[fmgcIndex].modelInputs.in.fms_inputs.cruise_alt_ft = idFmgcCruiseAltitude->get();
 
-  fmgcs[fmgcIndex].modelInputs.in.bus_inputs.fac_opp_bus = facsBusOutputs[oppFmgcIndex];
-  fmgcs[fmgcIndex].modelInputs.in.bus_inputs.fac_own_bus = facsBusOutputs[fmgcIndex];
+  fmgcs[fmgcIndex].modelInputs.in.bus_inputs.fac_opp_bus = *facsBusOutputs[oppFmgcIndex];
+  fmgcs[fmgcIndex].modelInputs.in.bus_inputs.fac_own_bus = *facsBusOutputs[fmgcIndex];
   fmgcs[fmgcIndex].modelInputs.in.bus_inputs.adr_3_bus = adrBusOutputs[2];
   fmgcs[fmgcIndex].modelInputs.in.bus_inputs.ir_3_bus = irBusOutputs[2];
   fmgcs[fmgcIndex].modelInputs.in.bus_inputs.adr_opp_bus = fmgcIndex == 0 ? adrBusOutputs[1] : adrBusOutputs[0];
@@ -1833,8 +2271,8 @@ bool FlyByWireInterface::updateFmgc(double sampleTime, int fmgcIndex) {
   fmgcs[fmgcIndex].modelInputs.in.bus_inputs.ra_own_bus = raBusOutputs[fmgcIndex];
   fmgcs[fmgcIndex].modelInputs.in.bus_inputs.ils_opp_bus = ilsBusOutputs[oppFmgcIndex];
   fmgcs[fmgcIndex].modelInputs.in.bus_inputs.ils_own_bus = ilsBusOutputs[fmgcIndex];
-  fmgcs[fmgcIndex].modelInputs.in.bus_inputs.fmgc_opp_bus = fmgcsBusOutputs[oppFmgcIndex].fmgc_a_bus;
-  fmgcs[fmgcIndex].modelInputs.in.bus_inputs.fcu_bus = fcuBusOutputs;
+  fmgcs[fmgcIndex].modelInputs.in.bus_inputs.fmgc_opp_bus = fmgcsBusOutputs[oppFmgcIndex]->fmgc_a_bus;
+  fmgcs[fmgcIndex].modelInputs.in.bus_inputs.fcu_bus = *fcuBusOutputs;
   fmgcs[fmgcIndex].modelInputs.in.bus_inputs.tcas_bus = tcasBusOutputs;
 
   if (fmgcIndex == fmgcDisabled) {
@@ -1842,23 +2280,24 @@ bool FlyByWireInterface::updateFmgc(double sampleTime, int fmgcIndex) {
     simConnectInterface.setClientDataFmgcFmsData(fmgcs[fmgcIndex].modelInputs.in.fms_inputs);
 
     fmgcsDiscreteOutputs[fmgcIndex] = simConnectInterface.getClientDataFmgcDiscretesOutput();
-    fmgcsBusOutputs[fmgcIndex].fmgc_a_bus = simConnectInterface.getClientDataFmgcABusOutput();
-    fmgcsBusOutputs[fmgcIndex].fmgc_b_bus = simConnectInterface.getClientDataFmgcBBusOutput();
+    fmgcsClientDataBusOutputs[fmgcIndex].fmgc_a_bus = simConnectInterface.getClientDataFmgcABusOutput();
+    fmgcsClientDataBusOutputs[fmgcIndex].fmgc_b_bus = simConnectInterface.getClientDataFmgcBBusOutput();
   } else {
-    fmgcs[fmgcIndex].update(sampleTime, simData.simulationTime,
-                            failuresConsumer.isActive(fmgcIndex == 0 ? Failures::Fmgc1 : Failures::Fmgc2),
-                            fmgcIndex == 0 ? idElecDcEssShedBusPowered->get() : idElecDcBus2Powered->get());
+    bool faultActive = failuresConsumer.isActive(fmgcIndex == 0 ? Failures::Fmgc1 : Failures::Fmgc2);
+    bool powerSupplyAvailable = fmgcIndex == 0 ? idElecDcEssShedBusPowered->get() : idElecDcBus2Powered->get();
+    flightDataRecorder.recordFmgcInputs(fmgcIndex, fmgcs[fmgcIndex].modelInputs, sampleTime, simData.simulationTime, faultActive,
+                                        powerSupplyAvailable);
+    fmgcs[fmgcIndex].update(sampleTime, simData.simulationTime, faultActive, powerSupplyAvailable);
 
     fmgcsDiscreteOutputs[fmgcIndex] = fmgcs[fmgcIndex].getDiscreteOutputs();
-    fmgcsBusOutputs[fmgcIndex] = fmgcs[fmgcIndex].getBusOutputs();
   }
 
   if (oppFmgcIndex == fmgcDisabled || fcuDisabled) {
-    simConnectInterface.setClientDataFmgcABus(fmgcsBusOutputs[fmgcIndex].fmgc_a_bus, fmgcIndex);
+    simConnectInterface.setClientDataFmgcABus(fmgcsBusOutputs[fmgcIndex]->fmgc_a_bus, fmgcIndex);
   }
 
   if (facDisabled != -1 || elacDisabled != -1) {
-    simConnectInterface.setClientDataFmgcBBus(fmgcsBusOutputs[fmgcIndex].fmgc_b_bus, fmgcIndex);
+    simConnectInterface.setClientDataFmgcBBus(fmgcsBusOutputs[fmgcIndex]->fmgc_b_bus, fmgcIndex);
   }
 
   idFmgcHealthy[fmgcIndex]->set(fmgcsDiscreteOutputs[fmgcIndex].fmgc_healthy);
@@ -1867,25 +2306,25 @@ bool FlyByWireInterface::updateFmgc(double sampleTime, int fmgcIndex) {
   idFmgcApEngaged[fmgcIndex]->set(fmgcsDiscreteOutputs[fmgcIndex].ap_own_engaged);
   idFmgcIlsTuneInhibit[fmgcIndex]->set(fmgcsDiscreteOutputs[fmgcIndex].ils_test_inhibit);
 
-  idFmgcABusPfdSelectedSpeed[fmgcIndex]->set(Arinc429Utils::toSimVar(fmgcsBusOutputs[fmgcIndex].fmgc_a_bus.pfd_sel_spd_kts));
-  idFmgcABusPreselMach[fmgcIndex]->set(Arinc429Utils::toSimVar(fmgcsBusOutputs[fmgcIndex].fmgc_a_bus.preset_mach_from_mcdu));
-  idFmgcABusPreselSpeed[fmgcIndex]->set(Arinc429Utils::toSimVar(fmgcsBusOutputs[fmgcIndex].fmgc_a_bus.preset_speed_from_mcdu_kts));
-  idFmgcABusRwyHdgMemo[fmgcIndex]->set(Arinc429Utils::toSimVar(fmgcsBusOutputs[fmgcIndex].fmgc_a_bus.runway_hdg_memorized_deg));
-  idFmgcABusRollFdCommand[fmgcIndex]->set(Arinc429Utils::toSimVar(fmgcsBusOutputs[fmgcIndex].fmgc_a_bus.roll_fd_command));
-  idFmgcABusPitchFdCommand[fmgcIndex]->set(Arinc429Utils::toSimVar(fmgcsBusOutputs[fmgcIndex].fmgc_a_bus.pitch_fd_command));
-  idFmgcABusYawFdCommand[fmgcIndex]->set(Arinc429Utils::toSimVar(fmgcsBusOutputs[fmgcIndex].fmgc_a_bus.yaw_fd_command));
-  idFmgcABusDiscreteWord5[fmgcIndex]->set(Arinc429Utils::toSimVar(fmgcsBusOutputs[fmgcIndex].fmgc_a_bus.discrete_word_5));
-  idFmgcABusDiscreteWord4[fmgcIndex]->set(Arinc429Utils::toSimVar(fmgcsBusOutputs[fmgcIndex].fmgc_a_bus.discrete_word_4));
-  idFmgcABusFmAltConstraint[fmgcIndex]->set(Arinc429Utils::toSimVar(fmgcsBusOutputs[fmgcIndex].fmgc_a_bus.fm_alt_constraint_ft));
-  idFmgcABusAtsDiscreteWord[fmgcIndex]->set(Arinc429Utils::toSimVar(fmgcsBusOutputs[fmgcIndex].fmgc_a_bus.ats_discrete_word));
-  idFmgcABusAtsFmaDiscreteWord[fmgcIndex]->set(Arinc429Utils::toSimVar(fmgcsBusOutputs[fmgcIndex].fmgc_a_bus.ats_fma_discrete_word));
-  idFmgcABusDiscreteWord3[fmgcIndex]->set(Arinc429Utils::toSimVar(fmgcsBusOutputs[fmgcIndex].fmgc_a_bus.discrete_word_3));
-  idFmgcABusDiscreteWord1[fmgcIndex]->set(Arinc429Utils::toSimVar(fmgcsBusOutputs[fmgcIndex].fmgc_a_bus.discrete_word_1));
-  idFmgcABusDiscreteWord2[fmgcIndex]->set(Arinc429Utils::toSimVar(fmgcsBusOutputs[fmgcIndex].fmgc_a_bus.discrete_word_2));
-  idFmgcABusDiscreteWord6[fmgcIndex]->set(Arinc429Utils::toSimVar(fmgcsBusOutputs[fmgcIndex].fmgc_a_bus.discrete_word_6));
-  idFmgcABusDiscreteWord7[fmgcIndex]->set(Arinc429Utils::toSimVar(fmgcsBusOutputs[fmgcIndex].fmgc_a_bus.discrete_word_7));
-  idFmgcABusSpeedMarginHigh[fmgcIndex]->set(Arinc429Utils::toSimVar(fmgcsBusOutputs[fmgcIndex].fmgc_a_bus.high_target_speed_margin_kts));
-  idFmgcABusSpeedMarginLow[fmgcIndex]->set(Arinc429Utils::toSimVar(fmgcsBusOutputs[fmgcIndex].fmgc_a_bus.low_target_speed_margin_kts));
+  idFmgcABusPfdSelectedSpeed[fmgcIndex]->set(Arinc429Utils::toSimVar(fmgcsBusOutputs[fmgcIndex]->fmgc_a_bus.pfd_sel_spd_kts));
+  idFmgcABusPreselMach[fmgcIndex]->set(Arinc429Utils::toSimVar(fmgcsBusOutputs[fmgcIndex]->fmgc_a_bus.preset_mach_from_mcdu));
+  idFmgcABusPreselSpeed[fmgcIndex]->set(Arinc429Utils::toSimVar(fmgcsBusOutputs[fmgcIndex]->fmgc_a_bus.preset_speed_from_mcdu_kts));
+  idFmgcABusRwyHdgMemo[fmgcIndex]->set(Arinc429Utils::toSimVar(fmgcsBusOutputs[fmgcIndex]->fmgc_a_bus.runway_hdg_memorized_deg));
+  idFmgcABusRollFdCommand[fmgcIndex]->set(Arinc429Utils::toSimVar(fmgcsBusOutputs[fmgcIndex]->fmgc_a_bus.roll_fd_command));
+  idFmgcABusPitchFdCommand[fmgcIndex]->set(Arinc429Utils::toSimVar(fmgcsBusOutputs[fmgcIndex]->fmgc_a_bus.pitch_fd_command));
+  idFmgcABusYawFdCommand[fmgcIndex]->set(Arinc429Utils::toSimVar(fmgcsBusOutputs[fmgcIndex]->fmgc_a_bus.yaw_fd_command));
+  idFmgcABusDiscreteWord5[fmgcIndex]->set(Arinc429Utils::toSimVar(fmgcsBusOutputs[fmgcIndex]->fmgc_a_bus.discrete_word_5));
+  idFmgcABusDiscreteWord4[fmgcIndex]->set(Arinc429Utils::toSimVar(fmgcsBusOutputs[fmgcIndex]->fmgc_a_bus.discrete_word_4));
+  idFmgcABusFmAltConstraint[fmgcIndex]->set(Arinc429Utils::toSimVar(fmgcsBusOutputs[fmgcIndex]->fmgc_a_bus.fm_alt_constraint_ft));
+  idFmgcABusAtsDiscreteWord[fmgcIndex]->set(Arinc429Utils::toSimVar(fmgcsBusOutputs[fmgcIndex]->fmgc_a_bus.ats_discrete_word));
+  idFmgcABusAtsFmaDiscreteWord[fmgcIndex]->set(Arinc429Utils::toSimVar(fmgcsBusOutputs[fmgcIndex]->fmgc_a_bus.ats_fma_discrete_word));
+  idFmgcABusDiscreteWord3[fmgcIndex]->set(Arinc429Utils::toSimVar(fmgcsBusOutputs[fmgcIndex]->fmgc_a_bus.discrete_word_3));
+  idFmgcABusDiscreteWord1[fmgcIndex]->set(Arinc429Utils::toSimVar(fmgcsBusOutputs[fmgcIndex]->fmgc_a_bus.discrete_word_1));
+  idFmgcABusDiscreteWord2[fmgcIndex]->set(Arinc429Utils::toSimVar(fmgcsBusOutputs[fmgcIndex]->fmgc_a_bus.discrete_word_2));
+  idFmgcABusDiscreteWord6[fmgcIndex]->set(Arinc429Utils::toSimVar(fmgcsBusOutputs[fmgcIndex]->fmgc_a_bus.discrete_word_6));
+  idFmgcABusDiscreteWord7[fmgcIndex]->set(Arinc429Utils::toSimVar(fmgcsBusOutputs[fmgcIndex]->fmgc_a_bus.discrete_word_7));
+  idFmgcABusSpeedMarginHigh[fmgcIndex]->set(Arinc429Utils::toSimVar(fmgcsBusOutputs[fmgcIndex]->fmgc_a_bus.high_target_speed_margin_kts));
+  idFmgcABusSpeedMarginLow[fmgcIndex]->set(Arinc429Utils::toSimVar(fmgcsBusOutputs[fmgcIndex]->fmgc_a_bus.low_target_speed_margin_kts));
 
   // Set the stick lock var (for sounds) and inst. disc. discretes, after both FMGCs have updated
   if (fmgcIndex == 1) {
@@ -1907,59 +2346,59 @@ bool FlyByWireInterface::updateFmgcShim(double sampleTime) {
   int fmgcPriorityIndex = fmgc1Priority ? 0 : 1;
 
   int lateralMode = 0;
-  if (Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex].fmgc_a_bus.discrete_word_2, 16, false)) {
+  if (Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex]->fmgc_a_bus.discrete_word_2, 16, false)) {
     lateralMode = 10;
-  } else if (Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex].fmgc_a_bus.discrete_word_2, 17, false)) {
+  } else if (Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex]->fmgc_a_bus.discrete_word_2, 17, false)) {
     lateralMode = 11;
-  } else if (Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex].fmgc_a_bus.discrete_word_2, 12, false)) {
+  } else if (Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex]->fmgc_a_bus.discrete_word_2, 12, false)) {
     lateralMode = 20;
-  } else if (Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex].fmgc_a_bus.discrete_word_2, 13, false)) {
+  } else if (Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex]->fmgc_a_bus.discrete_word_2, 13, false)) {
     lateralMode = 30;
-  } else if (Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex].fmgc_a_bus.discrete_word_2, 14, false)) {
+  } else if (Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex]->fmgc_a_bus.discrete_word_2, 14, false)) {
     lateralMode = 31;
-  } else if (Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex].fmgc_a_bus.discrete_word_4, 14, false) &&
-             !Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex].fmgc_a_bus.discrete_word_1, 25, false) &&
-             !Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex].fmgc_a_bus.discrete_word_2, 26, false)) {
+  } else if (Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex]->fmgc_a_bus.discrete_word_4, 14, false) &&
+             !Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex]->fmgc_a_bus.discrete_word_1, 25, false) &&
+             !Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex]->fmgc_a_bus.discrete_word_2, 26, false)) {
     lateralMode = 32;
-  } else if (Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex].fmgc_a_bus.discrete_word_1, 25, false) &&
-             !Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex].fmgc_a_bus.discrete_word_2, 26, false)) {
+  } else if (Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex]->fmgc_a_bus.discrete_word_1, 25, false) &&
+             !Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex]->fmgc_a_bus.discrete_word_2, 26, false)) {
     lateralMode = 33;
-  } else if (Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex].fmgc_a_bus.discrete_word_2, 26, false)) {
+  } else if (Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex]->fmgc_a_bus.discrete_word_2, 26, false)) {
     lateralMode = 34;
-  } else if (Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex].fmgc_a_bus.discrete_word_2, 11, false) &&
-             Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex].fmgc_a_bus.discrete_word_2, 20, false)) {
+  } else if (Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex]->fmgc_a_bus.discrete_word_2, 11, false) &&
+             Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex]->fmgc_a_bus.discrete_word_2, 20, false)) {
     lateralMode = 40;
-  } else if (Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex].fmgc_a_bus.discrete_word_2, 11, false) &&
-             Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex].fmgc_a_bus.discrete_word_2, 23, false)) {
+  } else if (Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex]->fmgc_a_bus.discrete_word_2, 11, false) &&
+             Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex]->fmgc_a_bus.discrete_word_2, 23, false)) {
     lateralMode = 41;
-  } else if (Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex].fmgc_a_bus.discrete_word_2, 15, false)) {
+  } else if (Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex]->fmgc_a_bus.discrete_word_2, 15, false)) {
     lateralMode = 50;
   }
 
-  bool navArmed = Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex].fmgc_a_bus.discrete_word_3, 14, false);
-  bool locArmed = Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex].fmgc_a_bus.discrete_word_3, 16, false);
+  bool navArmed = Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex]->fmgc_a_bus.discrete_word_3, 14, false);
+  bool locArmed = Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex]->fmgc_a_bus.discrete_word_3, 16, false);
   int lateralArmed = navArmed | (locArmed << 1);
 
-  bool gsMode = Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex].fmgc_a_bus.discrete_word_1, 22, false);
-  bool gsTrackMode = Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex].fmgc_a_bus.discrete_word_1, 20, false);
-  bool gsCaptureMode = Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex].fmgc_a_bus.discrete_word_1, 21, false);
-  bool expedMode = Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex].fmgc_a_bus.discrete_word_1, 24, false);
-  bool descentMode = Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex].fmgc_a_bus.discrete_word_1, 12, false);
-  bool climbMode = Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex].fmgc_a_bus.discrete_word_1, 11, false);
-  bool pitchTakeoffMode = Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex].fmgc_a_bus.discrete_word_1, 15, false);
-  bool pitchGoaroundMode = Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex].fmgc_a_bus.discrete_word_1, 16, false);
-  bool openMode = Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex].fmgc_a_bus.discrete_word_1, 14, false);
-  bool trackMode = Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex].fmgc_a_bus.discrete_word_1, 20, false);
-  bool captureMode = Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex].fmgc_a_bus.discrete_word_1, 21, false);
-  bool altMode = Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex].fmgc_a_bus.discrete_word_1, 19, false);
-  bool dashMode = Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex].fmgc_a_bus.discrete_word_1, 26, false);
-  bool altConstraintValid = Arinc429Utils::isNo(fmgcsBusOutputs[fmgcPriorityIndex].fmgc_a_bus.fm_alt_constraint_ft);
-  bool fpaMode = Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex].fmgc_a_bus.discrete_word_1, 18, false);
-  bool vsMode = Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex].fmgc_a_bus.discrete_word_1, 17, false);
-  bool finalDesMode = Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex].fmgc_a_bus.discrete_word_1, 23, false);
-  bool tcasMode = Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex].fmgc_a_bus.discrete_word_7, 13, false);
-
-  bool navMode = Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex].fmgc_a_bus.discrete_word_2, 12, false);
+  bool gsMode = Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex]->fmgc_a_bus.discrete_word_1, 22, false);
+  bool gsTrackMode = Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex]->fmgc_a_bus.discrete_word_1, 20, false);
+  bool gsCaptureMode = Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex]->fmgc_a_bus.discrete_word_1, 21, false);
+  bool expedMode = Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex]->fmgc_a_bus.discrete_word_1, 24, false);
+  bool descentMode = Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex]->fmgc_a_bus.discrete_word_1, 12, false);
+  bool climbMode = Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex]->fmgc_a_bus.discrete_word_1, 11, false);
+  bool pitchTakeoffMode = Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex]->fmgc_a_bus.discrete_word_1, 15, false);
+  bool pitchGoaroundMode = Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex]->fmgc_a_bus.discrete_word_1, 16, false);
+  bool openMode = Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex]->fmgc_a_bus.discrete_word_1, 14, false);
+  bool trackMode = Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex]->fmgc_a_bus.discrete_word_1, 20, false);
+  bool captureMode = Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex]->fmgc_a_bus.discrete_word_1, 21, false);
+  bool altMode = Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex]->fmgc_a_bus.discrete_word_1, 19, false);
+  bool dashMode = Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex]->fmgc_a_bus.discrete_word_1, 26, false);
+  bool altConstraintValid = Arinc429Utils::isNo(fmgcsBusOutputs[fmgcPriorityIndex]->fmgc_a_bus.fm_alt_constraint_ft);
+  bool fpaMode = Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex]->fmgc_a_bus.discrete_word_1, 18, false);
+  bool vsMode = Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex]->fmgc_a_bus.discrete_word_1, 17, false);
+  bool finalDesMode = Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex]->fmgc_a_bus.discrete_word_1, 23, false);
+  bool tcasMode = Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex]->fmgc_a_bus.discrete_word_7, 13, false);
+
+  bool navMode = Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex]->fmgc_a_bus.discrete_word_2, 12, false);
 
   int verticalMode = 0;
   if (trackMode && altMode && !dashMode && !altConstraintValid) {
@@ -1988,14 +2427,14 @@ bool FlyByWireInterface::updateFmgcShim(double sampleTime) {
     verticalMode = 30;
   } else if (gsMode && gsTrackMode) {
     verticalMode = 31;
-  } else if (Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex].fmgc_a_bus.discrete_word_4, 14, false) &&
-             !Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex].fmgc_a_bus.discrete_word_1, 25, false) &&
-             !Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex].fmgc_a_bus.discrete_word_2, 26, false)) {
+  } else if (Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex]->fmgc_a_bus.discrete_word_4, 14, false) &&
+             !Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex]->fmgc_a_bus.discrete_word_1, 25, false) &&
+             !Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex]->fmgc_a_bus.discrete_word_2, 26, false)) {
     verticalMode = 32;
-  } else if (Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex].fmgc_a_bus.discrete_word_1, 25, false) &&
-             !Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex].fmgc_a_bus.discrete_word_2, 26, false)) {
+  } else if (Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex]->fmgc_a_bus.discrete_word_1, 25, false) &&
+             !Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex]->fmgc_a_bus.discrete_word_2, 26, false)) {
     verticalMode = 33;
-  } else if (Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex].fmgc_a_bus.discrete_word_2, 26, false)) {
+  } else if (Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex]->fmgc_a_bus.discrete_word_2, 26, false)) {
     verticalMode = 34;
   } else if (pitchTakeoffMode) {
     verticalMode = 40;
@@ -2005,16 +2444,16 @@ bool FlyByWireInterface::updateFmgcShim(double sampleTime) {
     verticalMode = 50;
   }
 
-  bool altArmed = Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex].fmgc_a_bus.discrete_word_3, 12, false);
-  bool clbArmed = Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex].fmgc_a_bus.discrete_word_3, 24, false);
-  bool desArmed = Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex].fmgc_a_bus.discrete_word_3, 25, false);
-  bool gsArmed = Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex].fmgc_a_bus.discrete_word_3, 22, false);
-  bool finalArmed = Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex].fmgc_a_bus.discrete_word_3, 23, false);
+  bool altArmed = Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex]->fmgc_a_bus.discrete_word_3, 12, false);
+  bool clbArmed = Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex]->fmgc_a_bus.discrete_word_3, 24, false);
+  bool desArmed = Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex]->fmgc_a_bus.discrete_word_3, 25, false);
+  bool gsArmed = Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex]->fmgc_a_bus.discrete_word_3, 22, false);
+  bool finalArmed = Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex]->fmgc_a_bus.discrete_word_3, 23, false);
   bool tcasArmed = false;
   int verticalArmed = altArmed | (clbArmed << 2) | (desArmed << 3) | (gsArmed << 4) | (finalArmed << 5) | (tcasArmed << 6);
 
-  bool atEngaged = Arinc429Utils::bitFromValueOr(fcuBusOutputs.ats_discrete_word, 13, false);
-  bool atActive = Arinc429Utils::bitFromValueOr(fcuBusOutputs.ats_discrete_word, 14, false);
+  bool atEngaged = Arinc429Utils::bitFromValueOr(fcuBusOutputs->ats_discrete_word, 13, false);
+  bool atActive = Arinc429Utils::bitFromValueOr(fcuBusOutputs->ats_discrete_word, 14, false);
   int athrStatus = 0;
   if (atEngaged && !atActive) {
     athrStatus = 1;
@@ -2023,17 +2462,17 @@ bool FlyByWireInterface::updateFmgcShim(double sampleTime) {
   }
 
   int athrMode = 0;
-  if (Arinc429Utils::bitFromValueOr(fcuBusOutputs.ats_fma_discrete_word, 17, false)) {
+  if (Arinc429Utils::bitFromValueOr(fcuBusOutputs->ats_fma_discrete_word, 17, false)) {
     athrMode = 13;
   }
 
   int athrModeMessage = 0;
-  if (Arinc429Utils::bitFromValueOr(fcuBusOutputs.ats_fma_discrete_word, 22, false)) {
+  if (Arinc429Utils::bitFromValueOr(fcuBusOutputs->ats_fma_discrete_word, 22, false)) {
     athrModeMessage = 3;
   }
 
   // Autoland warning
-  SimData simData = simConnectInterface.getSimData();
+  const SimData& simData = simConnectInterface.getSimData();
 
   // if at least one AP engaged and LAND or FLARE mode -> latch
   if (simData.H_radio_ft < 200 && (fmgcsDiscreteOutputs[0].ap_own_engaged || fmgcsDiscreteOutputs[1].ap_own_engaged) &&
@@ -2061,15 +2500,15 @@ bool FlyByWireInterface::updateFmgcShim(double sampleTime) {
   hDotFilterPrevY = hdotFilterY;
 
   idAutopilotShimNosewheelDemand->set(
-      Arinc429Utils::valueOr(fmgcsBusOutputs[fmgcPriorityIndex].fmgc_a_bus.delta_nosewheel_voted_cmd_deg, 0));
+      Arinc429Utils::valueOr(fmgcsBusOutputs[fmgcPriorityIndex]->fmgc_a_bus.delta_nosewheel_voted_cmd_deg, 0));
   idAutopilotShimFmaLateralMode->set(lateralMode);
   idAutopilotShimFmaLateralArmed->set(lateralArmed);
   idAutopilotShimFmaVerticalMode->set(verticalMode);
   idAutopilotShimFmaVerticalArmed->set(verticalArmed);
   idAutopilotShimFmaExpediteModeActive->set(
-      Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex].fmgc_a_bus.discrete_word_1, 24, false));
+      Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex]->fmgc_a_bus.discrete_word_1, 24, false));
   idAutopilotShimFmaTripleClick->set(
-      Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex].fmgc_a_bus.discrete_word_4, 28, false));
+      Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[fmgcPriorityIndex]->fmgc_a_bus.discrete_word_4, 28, false));
   idAutopilotShimActiveAny->set(fmgcsDiscreteOutputs[0].ap_own_engaged || fmgcsDiscreteOutputs[1].ap_own_engaged);
   idAutopilotShimActive_1->set(fmgcsDiscreteOutputs[0].ap_own_engaged);
   idAutopilotShimActive_2->set(fmgcsDiscreteOutputs[1].ap_own_engaged);
@@ -2091,8 +2530,8 @@ bool FlyByWireInterface::updateFmgcShim(double sampleTime) {
 }
 
 bool FlyByWireInterface::updateFcu(double sampleTime) {
-  SimData simData = simConnectInterface.getSimData();
-  SimInputAutopilot simInputAutopilot = simConnectInterface.getSimInputAutopilot();
+  const SimData& simData = simConnectInterface.getSimData();
+  const SimInputAutopilot& simInputAutopilot = simConnectInterface.getSimInputAutopilot();
 
   fcu.modelInputs.in.time.dt = sampleTime;
   fcu.modelInputs.in.time.simulation_time = simData.simulationTime;
@@ -2138,46 +2577,45 @@ bool FlyByWireInterface::updateFcu(double sampleTime) {
   fcu.modelInputs.in.discrete_inputs.afs_inputs = simConnectInterface.getFcuAfsPanelInputs();
   fcu.modelInputs.in.discrete_inputs.afs_inputs.alt_increment_1000 = idFcuAfsPanelAltIncrement1000->get();
 
-  fcu.modelInputs.in.bus_inputs.fmgc_1_bus = fmgcsBusOutputs[0].fmgc_a_bus;
-  fcu.modelInputs.in.bus_inputs.fmgc_2_bus = fmgcsBusOutputs[1].fmgc_a_bus;
+  fcu.modelInputs.in.bus_inputs.fmgc_1_bus = fmgcsBusOutputs[0]->fmgc_a_bus;
+  fcu.modelInputs.in.bus_inputs.fmgc_2_bus = fmgcsBusOutputs[1]->fmgc_a_bus;
 
   base_fcu_discrete_outputs discreteOutputs = fcu.getDiscreteOutputs();
 
   if (fcuDisabled) {
-    fcuBusOutputs = simConnectInterface.getClientDataFcuBusOutput();
+    fcuClientDataBusOutputs = simConnectInterface.getClientDataFcuBusOutput();
     discreteOutputs = simConnectInterface.getClientDataFcuDiscreteOutput();
   } else {
     fcu.update(sampleTime, simData.simulationTime, failuresConsumer.isActive(Failures::Fcu1), failuresConsumer.isActive(Failures::Fcu2),
                idElecDcEssBusPowered->get(), idElecDcBus2Powered->get());
-    fcuBusOutputs = fcu.getBusOutputs();
   }
 
   fcuHealthy = discreteOutputs.fcu_healthy;
 
   if (fmgcDisabled != -1 || fadecDisabled != -1) {
-    simConnectInterface.setClientDataFcuBus(fcuBusOutputs);
+    simConnectInterface.setClientDataFcuBus(*fcuBusOutputs);
   }
 
   idFcuHealthy->set(discreteOutputs.fcu_healthy);
 
-  idFcuSelectedHeading->set(Arinc429Utils::toSimVar(fcuBusOutputs.selected_hdg_deg));
-  idFcuSelectedAltitude->set(Arinc429Utils::toSimVar(fcuBusOutputs.selected_alt_ft));
-  idFcuSelectedAirspeed->set(Arinc429Utils::toSimVar(fcuBusOutputs.selected_spd_kts));
-  idFcuSelectedVerticalSpeed->set(Arinc429Utils::toSimVar(fcuBusOutputs.selected_vz_ft_min));
-  idFcuSelectedTrack->set(Arinc429Utils::toSimVar(fcuBusOutputs.selected_trk_deg));
-  idFcuSelectedFpa->set(Arinc429Utils::toSimVar(fcuBusOutputs.selected_fpa_deg));
-  idFcuAtsDiscreteWord->set(Arinc429Utils::toSimVar(fcuBusOutputs.ats_discrete_word));
-  idFcuAtsFmaDiscreteWord->set(Arinc429Utils::toSimVar(fcuBusOutputs.ats_fma_discrete_word));
-  idFcuEisLeftDiscreteWord1->set(Arinc429Utils::toSimVar(fcuBusOutputs.eis_discrete_word_1_left));
-  idFcuEisLeftDiscreteWord2->set(Arinc429Utils::toSimVar(fcuBusOutputs.eis_discrete_word_2_left));
-  idFcuEisLeftBaro->set(Arinc429Utils::toSimVar(fcuBusOutputs.baro_setting_left_inhg));
-  idFcuEisLeftBaroHpa->set(Arinc429Utils::toSimVar(fcuBusOutputs.baro_setting_left_hpa));
-  idFcuEisRightDiscreteWord1->set(Arinc429Utils::toSimVar(fcuBusOutputs.eis_discrete_word_1_right));
-  idFcuEisRightDiscreteWord2->set(Arinc429Utils::toSimVar(fcuBusOutputs.eis_discrete_word_2_right));
-  idFcuEisRightBaro->set(Arinc429Utils::toSimVar(fcuBusOutputs.baro_setting_right_inhg));
-  idFcuEisRightBaroHpa->set(Arinc429Utils::toSimVar(fcuBusOutputs.baro_setting_right_hpa));
-  idFcuDiscreteWord1->set(Arinc429Utils::toSimVar(fcuBusOutputs.fcu_discrete_word_1));
-  idFcuDiscreteWord2->set(Arinc429Utils::toSimVar(fcuBusOutputs.fcu_discrete_word_2));
+  idFcuSelectedHeading->set(Arinc429Utils::toSimVar(fcuBusOutputs->selected_hdg_deg));
+  idFcuSelectedAltitude->set(Arinc429Utils::toSimVar(fcuBusOutputs->selected_alt_ft));
+  idFcuSelectedAirspeed->set(Arinc429Utils::toSimVar(fcuBusOutputs->selected_spd_kts));
+  idFcuSelectedVerticalSpeed->set(Arinc429Utils::toSimVar(fcuBusOutputs->selected_vz_ft_min));
+  idFcuSelectedTrack->set(Arinc429Utils::toSimVar(fcuBusOutputs->selected_trk_deg));
+  idFcuSelectedFpa->set(Arinc429Utils::toSimVar(fcuBusOutputs->selected_fpa_deg));
+  idFcuAtsDiscreteWord->set(Arinc429Utils::toSimVar(fcuBusOutputs->ats_discrete_word));
+  idFcuAtsFmaDiscreteWord->set(Arinc429Utils::toSimVar(fcuBusOutputs->ats_fma_discrete_word));
+  idFcuEisLeftDiscreteWord1->set(Arinc429Utils::toSimVar(fcuBusOutputs->eis_discrete_word_1_left));
+  idFcuEisLeftDiscreteWord2->set(Arinc429Utils::toSimVar(fcuBusOutputs->eis_discrete_word_2_left));
+  idFcuEisLeftBaro->set(Arinc429Utils::toSimVar(fcuBusOutputs->baro_setting_left_inhg));
+  idFcuEisLeftBaroHpa->set(Arinc429Utils::toSimVar(fcuBusOutputs->baro_setting_left_hpa));
+  idFcuEisRightDiscreteWord1->set(Arinc429Utils::toSimVar(fcuBusOutputs->eis_discrete_word_1_right));
+  idFcuEisRightDiscreteWord2->set(Arinc429Utils::toSimVar(fcuBusOutputs->eis_discrete_word_2_right));
+  idFcuEisRightBaro->set(Arinc429Utils::toSimVar(fcuBusOutputs->baro_setting_right_inhg));
+  idFcuEisRightBaroHpa->set(Arinc429Utils::toSimVar(fcuBusOutputs->baro_setting_right_hpa));
+  idFcuDiscreteWord1->set(Arinc429Utils::toSimVar(fcuBusOutputs->fcu_discrete_word_1));
+  idFcuDiscreteWord2->set(Arinc429Utils::toSimVar(fcuBusOutputs->fcu_discrete_word_2));
 
   for (int i = 0; i < 2; i++) {
     std::string idString = std::to_string(i + 1);
@@ -2220,7 +2658,7 @@ bool FlyByWireInterface::updateFcu(double sampleTime) {
   // Update AFS CP variables (Sim AP vars and legacy Lvars)
   // The speed var comes from the FMGC, do a simple check of FMGC health to select the FMGC to use
   simConnectInterface.sendEventEx1(SimConnectInterface::Events::AP_SPD_VAR_SET, SIMCONNECT_GROUP_PRIORITY_STANDARD,
-                                   fmgcsBusOutputs[fmgcsDiscreteOutputs[0].fmgc_healthy ? 0 : 1].fmgc_a_bus.pfd_sel_spd_kts.Data, 0);
+                                   fmgcsBusOutputs[fmgcsDiscreteOutputs[0].fmgc_healthy ? 0 : 1]->fmgc_a_bus.pfd_sel_spd_kts.Data, 0);
   simConnectInterface.sendEvent(SimConnectInterface::Events::AP_SPEED_SLOT_INDEX_SET, discreteOutputs.afs_outputs.spd_mach_managed ? 2 : 1,
                                 SIMCONNECT_GROUP_PRIORITY_STANDARD);
   idFcuShimSpdDashes->set(discreteOutputs.afs_outputs.spd_mach_dashes || !discreteOutputs.fcu_healthy);
@@ -2256,13 +2694,13 @@ bool FlyByWireInterface::updateFcu(double sampleTime) {
   idFcuShimVsManaged->set(discreteOutputs.afs_outputs.vs_fpa_dashes);
 
   // Shim Hevents
-  if (Arinc429Utils::bitFromValueOr(fcuBusOutputs.fcu_discrete_word_1, 13, false)) {
+  if (Arinc429Utils::bitFromValueOr(fcuBusOutputs->fcu_discrete_word_1, 13, false)) {
     execute_calculator_code("(>H:A320_Neo_CDU_AP_DEC_ALT)", nullptr, nullptr, nullptr);
   }
-  if (Arinc429Utils::bitFromValueOr(fcuBusOutputs.fcu_discrete_word_1, 17, false)) {
+  if (Arinc429Utils::bitFromValueOr(fcuBusOutputs->fcu_discrete_word_1, 17, false)) {
     execute_calculator_code("(>H:A320_Neo_CDU_MODE_MANAGED_ALTITUDE)", nullptr, nullptr, nullptr);
   }
-  if (Arinc429Utils::bitFromValueOr(fcuBusOutputs.fcu_discrete_word_1, 18, false)) {
+  if (Arinc429Utils::bitFromValueOr(fcuBusOutputs->fcu_discrete_word_1, 18, false)) {
     execute_calculator_code("(>H:A320_Neo_CDU_MODE_SELECTED_ALTITUDE)", nullptr, nullptr, nullptr);
   }
 
@@ -2328,65 +2766,65 @@ bool FlyByWireInterface::updateFcuShim() {
     }
   };
 
-  SimData simData = simConnectInterface.getSimData();
-
-  idFcuShimLeftNavaid1Mode->set(getNavaidMode(Arinc429Utils::bitFromValueOr(fcuBusOutputs.eis_discrete_word_2_left, 24, false),
-                                              Arinc429Utils::bitFromValueOr(fcuBusOutputs.eis_discrete_word_2_left, 26, true)));
-  idFcuShimLeftNavaid2Mode->set(getNavaidMode(Arinc429Utils::bitFromValueOr(fcuBusOutputs.eis_discrete_word_2_left, 25, true),
-                                              Arinc429Utils::bitFromValueOr(fcuBusOutputs.eis_discrete_word_2_left, 27, false)));
-  idFcuShimLeftNdMode->set(getNdMode(Arinc429Utils::bitFromValueOr(fcuBusOutputs.eis_discrete_word_2_left, 11, false),
-                                     Arinc429Utils::bitFromValueOr(fcuBusOutputs.eis_discrete_word_2_left, 12, true),
-                                     Arinc429Utils::bitFromValueOr(fcuBusOutputs.eis_discrete_word_2_left, 13, false),
-                                     Arinc429Utils::bitFromValueOr(fcuBusOutputs.eis_discrete_word_2_left, 14, false),
-                                     Arinc429Utils::bitFromValueOr(fcuBusOutputs.eis_discrete_word_2_left, 15, false)));
-  idFcuShimLeftNdRange->set(getNdRange(Arinc429Utils::bitFromValueOr(fcuBusOutputs.eis_discrete_word_1_left, 25, false),
-                                       Arinc429Utils::bitFromValueOr(fcuBusOutputs.eis_discrete_word_1_left, 26, true),
-                                       Arinc429Utils::bitFromValueOr(fcuBusOutputs.eis_discrete_word_1_left, 27, false),
-                                       Arinc429Utils::bitFromValueOr(fcuBusOutputs.eis_discrete_word_1_left, 28, false),
-                                       Arinc429Utils::bitFromValueOr(fcuBusOutputs.eis_discrete_word_1_left, 29, false)));
-  idFcuShimLeftNdFilterOption->set(getNdFilter(Arinc429Utils::bitFromValueOr(fcuBusOutputs.eis_discrete_word_2_left, 17, false),
-                                               Arinc429Utils::bitFromValueOr(fcuBusOutputs.eis_discrete_word_2_left, 18, false),
-                                               Arinc429Utils::bitFromValueOr(fcuBusOutputs.eis_discrete_word_2_left, 19, false),
-                                               Arinc429Utils::bitFromValueOr(fcuBusOutputs.eis_discrete_word_2_left, 20, false),
-                                               Arinc429Utils::bitFromValueOr(fcuBusOutputs.eis_discrete_word_2_left, 21, false)));
-  idFcuShimLeftLsActive->set(Arinc429Utils::bitFromValueOr(fcuBusOutputs.eis_discrete_word_2_left, 22, true));
-  bool fd1Active = !Arinc429Utils::bitFromValueOr(fcuBusOutputs.fcu_discrete_word_2, 26, false);
+  const SimData& simData = simConnectInterface.getSimData();
+
+  idFcuShimLeftNavaid1Mode->set(getNavaidMode(Arinc429Utils::bitFromValueOr(fcuBusOutputs->eis_discrete_word_2_left, 24, false),
+                                              Arinc429Utils::bitFromValueOr(fcuBusOutputs->eis_discrete_word_2_left, 26, true)));
+  idFcuShimLeftNavaid2Mode->set(getNavaidMode(Arinc429Utils::bitFromValueOr(fcuBusOutputs->eis_discrete_word_2_left, 25, true),
+                                              Arinc429Utils::bitFromValueOr(fcuBusOutputs->eis_discrete_word_2_left, 27, false)));
+  idFcuShimLeftNdMode->set(getNdMode(Arinc429Utils::bitFromValueOr(fcuBusOutputs->eis_discrete_word_2_left, 11, false),
+                                     Arinc429Utils::bitFromValueOr(fcuBusOutputs->eis_discrete_word_2_left, 12, true),
+                                     Arinc429Utils::bitFromValueOr(fcuBusOutputs->eis_discrete_word_2_left, 13, false),
+                                     Arinc429Utils::bitFromValueOr(fcuBusOutputs->eis_discrete_word_2_left, 14, false),
+                                     Arinc429Utils::bitFromValueOr(fcuBusOutputs->eis_discrete_word_2_left, 15, false)));
+  idFcuShimLeftNdRange->set(getNdRange(Arinc429Utils::bitFromValueOr(fcuBusOutputs->eis_discrete_word_1_left, 25, false),
+                                       Arinc429Utils::bitFromValueOr(fcuBusOutputs->eis_discrete_word_1_left, 26, true),
+                                       Arinc429Utils::bitFromValueOr(fcuBusOutputs->eis_discrete_word_1_left, 27, false),
+                                       Arinc429Utils::bitFromValueOr(fcuBusOutputs->eis_discrete_word_1_left, 28, false),
+                                       Arinc429Utils::bitFromValueOr(fcuBusOutputs->eis_discrete_word_1_left, 29, false)));
+  idFcuShimLeftNdFilterOption->set(getNdFilter(Arinc429Utils::bitFromValueOr(fcuBusOutputs->eis_discrete_word_2_left, 17, false),
+                                               Arinc429Utils::bitFromValueOr(fcuBusOutputs->eis_discrete_word_2_left, 18, false),
+                                               Arinc429Utils::bitFromValueOr(fcuBusOutputs->eis_discrete_word_2_left, 19, false),
+                                               Arinc429Utils::bitFromValueOr(fcuBusOutputs->eis_discrete_word_2_left, 20, false),
+                                               Arinc429Utils::bitFromValueOr(fcuBusOutputs->eis_discrete_word_2_left, 21, false)));
+  idFcuShimLeftLsActive->set(Arinc429Utils::bitFromValueOr(fcuBusOutputs->eis_discrete_word_2_left, 22, true));
+  bool fd1Active = !Arinc429Utils::bitFromValueOr(fcuBusOutputs->fcu_discrete_word_2, 26, false);
   if (simData.ap_fd_1_active != fd1Active) {
     simConnectInterface.sendEvent(SimConnectInterface::Events::TOGGLE_FLIGHT_DIRECTOR, 1, SIMCONNECT_GROUP_PRIORITY_STANDARD);
   }
   simConnectInterface.sendEventEx1(SimConnectInterface::Events::KOHLSMANN_SET, SIMCONNECT_GROUP_PRIORITY_STANDARD,
-                                   Arinc429Utils::valueOr(fcuBusOutputs.baro_setting_left_hpa, 1013) * 16, 1);
-  SimOutputAltimeter altiOutput = {Arinc429Utils::bitFromValueOr(fcuBusOutputs.eis_discrete_word_2_left, 28, true)};
+                                   Arinc429Utils::valueOr(fcuBusOutputs->baro_setting_left_hpa, 1013) * 16, 1);
+  SimOutputAltimeter altiOutput = {Arinc429Utils::bitFromValueOr(fcuBusOutputs->eis_discrete_word_2_left, 28, true)};
   simConnectInterface.sendData(altiOutput, false);
-  idFcuShimLeftBaroMode->set(getBaroMode(Arinc429Utils::bitFromValueOr(fcuBusOutputs.eis_discrete_word_2_left, 28, true),
-                                         Arinc429Utils::bitFromValueOr(fcuBusOutputs.eis_discrete_word_2_left, 29, false)));
-
-  idFcuShimRightNavaid1Mode->set(getNavaidMode(Arinc429Utils::bitFromValueOr(fcuBusOutputs.eis_discrete_word_2_right, 24, false),
-                                               Arinc429Utils::bitFromValueOr(fcuBusOutputs.eis_discrete_word_2_right, 26, true)));
-  idFcuShimRightNavaid2Mode->set(getNavaidMode(Arinc429Utils::bitFromValueOr(fcuBusOutputs.eis_discrete_word_2_right, 25, true),
-                                               Arinc429Utils::bitFromValueOr(fcuBusOutputs.eis_discrete_word_2_right, 27, false)));
-  idFcuShimRightNdMode->set(getNdMode(Arinc429Utils::bitFromValueOr(fcuBusOutputs.eis_discrete_word_2_right, 11, false),
-                                      Arinc429Utils::bitFromValueOr(fcuBusOutputs.eis_discrete_word_2_right, 12, true),
-                                      Arinc429Utils::bitFromValueOr(fcuBusOutputs.eis_discrete_word_2_right, 13, false),
-                                      Arinc429Utils::bitFromValueOr(fcuBusOutputs.eis_discrete_word_2_right, 14, false),
-                                      Arinc429Utils::bitFromValueOr(fcuBusOutputs.eis_discrete_word_2_right, 15, false)));
-  idFcuShimRightNdRange->set(getNdRange(Arinc429Utils::bitFromValueOr(fcuBusOutputs.eis_discrete_word_1_right, 25, false),
-                                        Arinc429Utils::bitFromValueOr(fcuBusOutputs.eis_discrete_word_1_right, 26, true),
-                                        Arinc429Utils::bitFromValueOr(fcuBusOutputs.eis_discrete_word_1_right, 27, false),
-                                        Arinc429Utils::bitFromValueOr(fcuBusOutputs.eis_discrete_word_1_right, 28, false),
-                                        Arinc429Utils::bitFromValueOr(fcuBusOutputs.eis_discrete_word_1_right, 29, false)));
-  idFcuShimRightNdFilterOption->set(getNdFilter(Arinc429Utils::bitFromValueOr(fcuBusOutputs.eis_discrete_word_2_right, 17, false),
-                                                Arinc429Utils::bitFromValueOr(fcuBusOutputs.eis_discrete_word_2_right, 18, false),
-                                                Arinc429Utils::bitFromValueOr(fcuBusOutputs.eis_discrete_word_2_right, 19, false),
-                                                Arinc429Utils::bitFromValueOr(fcuBusOutputs.eis_discrete_word_2_right, 20, false),
-                                                Arinc429Utils::bitFromValueOr(fcuBusOutputs.eis_discrete_word_2_right, 21, false)));
-  idFcuShimRightLsActive->set(Arinc429Utils::bitFromValueOr(fcuBusOutputs.eis_discrete_word_2_right, 22, true));
-  bool fd2Active = !Arinc429Utils::bitFromValueOr(fcuBusOutputs.fcu_discrete_word_2, 27, false);
+  idFcuShimLeftBaroMode->set(getBaroMode(Arinc429Utils::bitFromValueOr(fcuBusOutputs->eis_discrete_word_2_left, 28, true),
+                                         Arinc429Utils::bitFromValueOr(fcuBusOutputs->eis_discrete_word_2_left, 29, false)));
+
+  idFcuShimRightNavaid1Mode->set(getNavaidMode(Arinc429Utils::bitFromValueOr(fcuBusOutputs->eis_discrete_word_2_right, 24, false),
+                                               Arinc429Utils::bitFromValueOr(fcuBusOutputs->eis_discrete_word_2_right, 26, true)));
+  idFcuShimRightNavaid2Mode->set(getNavaidMode(Arinc429Utils::bitFromValueOr(fcuBusOutputs->eis_discrete_word_2_right, 25, true),
+                                               Arinc429Utils::bitFromValueOr(fcuBusOutputs->eis_discrete_word_2_right, 27, false)));
+  idFcuShimRightNdMode->set(getNdMode(Arinc429Utils::bitFromValueOr(fcuBusOutputs->eis_discrete_word_2_right, 11, false),
+                                      Arinc429Utils::bitFromValueOr(fcuBusOutputs->eis_discrete_word_2_right, 12, true),
+                                      Arinc429Utils::bitFromValueOr(fcuBusOutputs->eis_discrete_word_2_right, 13, false),
+                                      Arinc429Utils::bitFromValueOr(fcuBusOutputs->eis_discrete_word_2_right, 14, false),
+                                      Arinc429Utils::bitFromValueOr(fcuBusOutputs->eis_discrete_word_2_right, 15, false)));
+  idFcuShimRightNdRange->set(getNdRange(Arinc429Utils::bitFromValueOr(fcuBusOutputs->eis_discrete_word_1_right, 25, false),
+                                        Arinc429Utils::bitFromValueOr(fcuBusOutputs->eis_discrete_word_1_right, 26, true),
+                                        Arinc429Utils::bitFromValueOr(fcuBusOutputs->eis_discrete_word_1_right, 27, false),
+                                        Arinc429Utils::bitFromValueOr(fcuBusOutputs->eis_discrete_word_1_right, 28, false),
+                                        Arinc429Utils::bitFromValueOr(fcuBusOutputs->eis_discrete_word_1_right, 29, false)));
+  idFcuShimRightNdFilterOption->set(getNdFilter(Arinc429Utils::bitFromValueOr(fcuBusOutputs->eis_discrete_word_2_right, 17, false),
+                                                Arinc429Utils::bitFromValueOr(fcuBusOutputs->eis_discrete_word_2_right, 18, false),
+                                                Arinc429Utils::bitFromValueOr(fcuBusOutputs->eis_discrete_word_2_right, 19, false),
+                                                Arinc429Utils::bitFromValueOr(fcuBusOutputs->eis_discrete_word_2_right, 20, false),
+                                                Arinc429Utils::bitFromValueOr(fcuBusOutputs->eis_discrete_word_2_right, 21, false)));
+  idFcuShimRightLsActive->set(Arinc429Utils::bitFromValueOr(fcuBusOutputs->eis_discrete_word_2_right, 22, true));
+  bool fd2Active = !Arinc429Utils::bitFromValueOr(fcuBusOutputs->fcu_discrete_word_2, 27, false);
   if (simData.ap_fd_2_active != fd2Active) {
     simConnectInterface.sendEvent(SimConnectInterface::Events::TOGGLE_FLIGHT_DIRECTOR, 2, SIMCONNECT_GROUP_PRIORITY_STANDARD);
   }
-  idFcuShimRightBaroMode->set(getBaroMode(Arinc429Utils::bitFromValueOr(fcuBusOutputs.eis_discrete_word_2_right, 28, true),
-                                          Arinc429Utils::bitFromValueOr(fcuBusOutputs.eis_discrete_word_2_right, 29, false)));
+  idFcuShimRightBaroMode->set(getBaroMode(Arinc429Utils::bitFromValueOr(fcuBusOutputs->eis_discrete_word_2_right, 28, true),
+                                          Arinc429Utils::bitFromValueOr(fcuBusOutputs->eis_discrete_word_2_right, 29, false)));
 
   return true;
 }
@@ -2398,8 +2836,8 @@ bool FlyByWireInterface::updateFac(double sampleTime, int facIndex) {
   }
 
   const int oppFacIndex = facIndex == 0 ? 1 : 0;
-  SimData simData = simConnectInterface.getSimData();
-  SimInputRudderTrim trimInput = simConnectInterface.getSimInputRudderTrim();
+  const SimData& simData = simConnectInterface.getSimData();
+  const SimInputRudderTrim& trimInput = simConnectInterface.getSimInputRudderTrim();
 
   facs[facIndex].modelInputs.in.time.dt = sampleTime;
   facs[facIndex].modelInputs.in.time.simulation_time = simData.simulationTime;
@@ -2440,19 +2878,19 @@ bool FlyByWireInterface::updateFac(double sampleTime, int facIndex) {
   facs[facIndex].modelInputs.in.analog_inputs.rudder_trim_position_deg = -idRudderTrimPosition->get();
   facs[facIndex].modelInputs.in.analog_inputs.rudder_travel_lim_position_deg = idRudderTravelLimiterPosition->get();
 
-  facs[facIndex].modelInputs.in.bus_inputs.fac_opp_bus = facsBusOutputs[oppFacIndex];
+  facs[facIndex].modelInputs.in.bus_inputs.fac_opp_bus = *facsBusOutputs[oppFacIndex];
   facs[facIndex].modelInputs.in.bus_inputs.adr_own_bus = facIndex == 0 ? adrBusOutputs[0] : adrBusOutputs[1];
   facs[facIndex].modelInputs.in.bus_inputs.adr_opp_bus = facIndex == 0 ? adrBusOutputs[1] : adrBusOutputs[0];
   facs[facIndex].modelInputs.in.bus_inputs.adr_3_bus = adrBusOutputs[2];
   facs[facIndex].modelInputs.in.bus_inputs.ir_own_bus = facIndex == 0 ? irBusOutputs[0] : irBusOutputs[1];
   facs[facIndex].modelInputs.in.bus_inputs.ir_opp_bus = facIndex == 0 ? irBusOutputs[1] : irBusOutputs[0];
   facs[facIndex].modelInputs.in.bus_inputs.ir_3_bus = irBusOutputs[2];
-  facs[facIndex].modelInputs.in.bus_inputs.fmgc_own_bus = fmgcsBusOutputs[facIndex].fmgc_b_bus;
-  facs[facIndex].modelInputs.in.bus_inputs.fmgc_opp_bus = fmgcsBusOutputs[oppFacIndex].fmgc_b_bus;
+  facs[facIndex].modelInputs.in.bus_inputs.fmgc_own_bus = fmgcsBusOutputs[facIndex]->fmgc_b_bus;
+  facs[facIndex].modelInputs.in.bus_inputs.fmgc_opp_bus = fmgcsBusOutputs[oppFacIndex]->fmgc_b_bus;
   facs[facIndex].modelInputs.in.bus_inputs.sfcc_own_bus = sfccBusOutputs[facIndex];
   facs[facIndex].modelInputs.in.bus_inputs.lgciu_own_bus = lgciuBusOutputs[facIndex];
-  facs[facIndex].modelInputs.in.bus_inputs.elac_1_bus = elacsBusOutputs[0];
-  facs[facIndex].modelInputs.in.bus_inputs.elac_2_bus = elacsBusOutputs[1];
+  facs[facIndex].modelInputs.in.bus_inputs.elac_1_bus = *elacsBusOutputs[0];
+  facs[facIndex].modelInputs.in.bus_inputs.elac_2_bus = *elacsBusOutputs[1];
 
   if (facIndex == facDisabled) {
     simConnectInterface.setClientDataFacDiscretes(facs[facIndex].modelInputs.in.discrete_inputs);
@@ -2460,50 +2898,52 @@ bool FlyByWireInterface::updateFac(double sampleTime, int facIndex) {
 
     facsDiscreteOutputs[facIndex] = simConnectInterface.getClientDataFacDiscretesOutput();
     facsAnalogOutputs[facIndex] = simConnectInterface.getClientDataFacAnalogsOutput();
-    facsBusOutputs[facIndex] = simConnectInterface.getClientDataFacBusOutput();
+    facsClientDataBusOutputs[facIndex] = simConnectInterface.getClientDataFacBusOutput();
   } else {
-    facs[facIndex].update(sampleTime, simData.simulationTime, failuresConsumer.isActive(facIndex == 0 ? Failures::Fac1 : Failures::Fac2),
-                          facIndex == 0 ? idElecDcEssShedBusPowered->get() : idElecDcBus2Powered->get());
+    bool faultActive = failuresConsumer.isActive(facIndex == 0 ? Failures::Fac1 : Failures::Fac2);
+    bool powerSupplyAvailable = facIndex == 0 ? idElecDcEssShedBusPowered->get() : idElecDcBus2Powered->get();
+    flightDataRecorder.recordFacInputs(facIndex, facs[facIndex].modelInputs, sampleTime, simData.simulationTime, faultActive,
+                                       powerSupplyAvailable);
+    facs[facIndex].update(sampleTime, simData.simulationTime, faultActive, powerSupplyAvailable);
 
     facsDiscreteOutputs[facIndex] = facs[facIndex].getDiscreteOutputs();
     facsAnalogOutputs[facIndex] = facs[facIndex].getAnalogOutputs();
-    facsBusOutputs[facIndex] = facs[facIndex].getBusOutputs();
   }
 
   if (oppFacIndex == facDisabled || fmgcDisabled != -1) {
-    simConnectInterface.setClientDataFacBus(facsBusOutputs[facIndex], facIndex);
+    simConnectInterface.setClientDataFacBus(*facsBusOutputs[facIndex], facIndex);
   }
 
   idFacHealthy[facIndex]->set(facsDiscreteOutputs[facIndex].fac_healthy);
 
-  idFacDiscreteWord1[facIndex]->set(Arinc429Utils::toSimVar(facsBusOutputs[facIndex].discrete_word_1));
-  idFacGammaA[facIndex]->set(Arinc429Utils::toSimVar(facsBusOutputs[facIndex].gamma_a_deg));
-  idFacGammaT[facIndex]->set(Arinc429Utils::toSimVar(facsBusOutputs[facIndex].gamma_t_deg));
-  idFacWeight[facIndex]->set(Arinc429Utils::toSimVar(facsBusOutputs[facIndex].total_weight_lbs));
-  idFacCenterOfGravity[facIndex]->set(Arinc429Utils::toSimVar(facsBusOutputs[facIndex].center_of_gravity_pos_percent));
-  idFacSideslipTarget[facIndex]->set(Arinc429Utils::toSimVar(facsBusOutputs[facIndex].sideslip_target_deg));
-  idFacSlatAngle[facIndex]->set(Arinc429Utils::toSimVar(facsBusOutputs[facIndex].fac_slat_angle_deg));
-  idFacFlapAngle[facIndex]->set(Arinc429Utils::toSimVar(facsBusOutputs[facIndex].fac_flap_angle_deg));
-  idFacDiscreteWord2[facIndex]->set(Arinc429Utils::toSimVar(facsBusOutputs[facIndex].discrete_word_2));
-  idFacRudderTravelLimitCommand[facIndex]->set(Arinc429Utils::toSimVar(facsBusOutputs[facIndex].rudder_travel_limit_command_deg));
-  idFacDeltaRYawDamperVoted[facIndex]->set(Arinc429Utils::toSimVar(facsBusOutputs[facIndex].delta_r_yaw_damper_deg));
-  idFacEstimatedSideslip[facIndex]->set(Arinc429Utils::toSimVar(facsBusOutputs[facIndex].estimated_sideslip_deg));
-  idFacVAlphaLim[facIndex]->set(Arinc429Utils::toSimVar(facsBusOutputs[facIndex].v_alpha_lim_kn));
-  idFacVLs[facIndex]->set(Arinc429Utils::toSimVar(facsBusOutputs[facIndex].v_ls_kn));
-  idFacVStall[facIndex]->set(Arinc429Utils::toSimVar(facsBusOutputs[facIndex].v_stall_kn));
-  idFacVAlphaProt[facIndex]->set(Arinc429Utils::toSimVar(facsBusOutputs[facIndex].v_alpha_prot_kn));
-  idFacVStallWarn[facIndex]->set(Arinc429Utils::toSimVar(facsBusOutputs[facIndex].v_stall_warn_kn));
-  idFacSpeedTrend[facIndex]->set(Arinc429Utils::toSimVar(facsBusOutputs[facIndex].speed_trend_kn));
-  idFacV3[facIndex]->set(Arinc429Utils::toSimVar(facsBusOutputs[facIndex].v_3_kn));
-  idFacV4[facIndex]->set(Arinc429Utils::toSimVar(facsBusOutputs[facIndex].v_4_kn));
-  idFacVMan[facIndex]->set(Arinc429Utils::toSimVar(facsBusOutputs[facIndex].v_man_kn));
-  idFacVMax[facIndex]->set(Arinc429Utils::toSimVar(facsBusOutputs[facIndex].v_max_kn));
-  idFacVFeNext[facIndex]->set(Arinc429Utils::toSimVar(facsBusOutputs[facIndex].v_fe_next_kn));
-  idFacDiscreteWord3[facIndex]->set(Arinc429Utils::toSimVar(facsBusOutputs[facIndex].discrete_word_3));
-  idFacDiscreteWord4[facIndex]->set(Arinc429Utils::toSimVar(facsBusOutputs[facIndex].discrete_word_4));
-  idFacDiscreteWord5[facIndex]->set(Arinc429Utils::toSimVar(facsBusOutputs[facIndex].discrete_word_5));
-  idFacDeltaRRudderTrim[facIndex]->set(Arinc429Utils::toSimVar(facsBusOutputs[facIndex].delta_r_rudder_trim_deg));
-  idFacRudderTrimPos[facIndex]->set(Arinc429Utils::toSimVar(facsBusOutputs[facIndex].rudder_trim_pos_deg));
+  idFacDiscreteWord1[facIndex]->set(Arinc429Utils::toSimVar(facsBusOutputs[facIndex]->discrete_word_1));
+  idFacGammaA[facIndex]->set(Arinc429Utils::toSimVar(facsBusOutputs[facIndex]->gamma_a_deg));
+  idFacGammaT[facIndex]->set(Arinc429Utils::toSimVar(facsBusOutputs[facIndex]->gamma_t_deg));
+  idFacWeight[facIndex]->set(Arinc429Utils::toSimVar(facsBusOutputs[facIndex]->total_weight_lbs));
+  idFacCenterOfGravity[facIndex]->set(Arinc429Utils::toSimVar(facsBusOutputs[facIndex]->center_of_gravity_pos_percent));
+  idFacSideslipTarget[facIndex]->set(Arinc429Utils::toSimVar(facsBusOutputs[facIndex]->sideslip_target_deg));
+  idFacSlatAngle[facIndex]->set(Arinc429Utils::toSimVar(facsBusOutputs[facIndex]->fac_slat_angle_deg));
+  idFacFlapAngle[facIndex]->set(Arinc429Utils::toSimVar(facsBusOutputs[facIndex]->fac_flap_angle_deg));
+  idFacDiscreteWord2[facIndex]->set(Arinc429Utils::toSimVar(facsBusOutputs[facIndex]->discrete_word_2));
+  idFacRudderTravelLimitCommand[facIndex]->set(Arinc429Utils::toSimVar(facsBusOutputs[facIndex]->rudder_travel_limit_command_deg));
+  idFacDeltaRYawDamperVoted[facIndex]->set(Arinc429Utils::toSimVar(facsBusOutputs[facIndex]->delta_r_yaw_damper_deg));
+  idFacEstimatedSideslip[facIndex]->set(Arinc429Utils::toSimVar(facsBusOutputs[facIndex]->estimated_sideslip_deg));
+  idFacVAlphaLim[facIndex]->set(Arinc429Utils::toSimVar(facsBusOutputs[facIndex]->v_alpha_lim_kn));
+  idFacVLs[facIndex]->set(Arinc429Utils::toSimVar(facsBusOutputs[facIndex]->v_ls_kn));
+  idFacVStall[facIndex]->set(Arinc429Utils::toSimVar(facsBusOutputs[facIndex]->v_stall_kn));
+  idFacVAlphaProt[facIndex]->set(Arinc429Utils::toSimVar(facsBusOutputs[facIndex]->v_alpha_prot_kn));
+  idFacVStallWarn[facIndex]->set(Arinc429Utils::toSimVar(facsBusOutputs[facIndex]->v_stall_warn_kn));
+  idFacSpeedTrend[facIndex]->set(Arinc429Utils::toSimVar(facsBusOutputs[facIndex]->speed_trend_kn));
+  idFacV3[facIndex]->set(Arinc429Utils::toSimVar(facsBusOutputs[facIndex]->v_3_kn));
+  idFacV4[facIndex]->set(Arinc429Utils::toSimVar(facsBusOutputs[facIndex]->v_4_kn));
+  idFacVMan[facIndex]->set(Arinc429Utils::toSimVar(facsBusOutputs[facIndex]->v_man_kn));
+  idFacVMax[facIndex]->set(Arinc429Utils::toSimVar(facsBusOutputs[facIndex]->v_max_kn));
+  idFacVFeNext[facIndex]->set(Arinc429Utils::toSimVar(facsBusOutputs[facIndex]->v_fe_next_kn));
+  idFacDiscreteWord3[facIndex]->set(Arinc429Utils::toSimVar(facsBusOutputs[facIndex]->discrete_word_3));
+  idFacDiscreteWord4[facIndex]->set(Arinc429Utils::toSimVar(facsBusOutputs[facIndex]->discrete_word_4));
+  idFacDiscreteWord5[facIndex]->set(Arinc429Utils::toSimVar(facsBusOutputs[facIndex]->discrete_word_5));
+  idFacDeltaRRudderTrim[facIndex]->set(Arinc429Utils::toSimVar(facsBusOutputs[facIndex]->delta_r_rudder_trim_deg));
+  idFacRudderTrimPos[facIndex]->set(Arinc429Utils::toSimVar(facsBusOutputs[facIndex]->rudder_trim_pos_deg));
 
   idFacRudderTravelLimitReset[facIndex]->set(facsDiscreteOutputs[facIndex].rudder_travel_lim_emergency_reset);
 
@@ -2582,8 +3022,7 @@ bool FlyByWireInterface::updateServoSolenoidStatus() {
 
 bool FlyByWireInterface::updateFlyByWire(double sampleTime) {
   // get data from interface ------------------------------------------------------------------------------------------
-  SimData simData = simConnectInterface.getSimData();
-  SimInput simInput = simConnectInterface.getSimInput();
+  const SimInput& simInput = simConnectInterface.getSimInput();
 
   // write sidestick position
   idSideStickPositionX->set(-1.0 * simInput.inputs[1]);
@@ -2601,7 +3040,7 @@ bool FlyByWireInterface::updateFlyByWire(double sampleTime) {
 
 bool FlyByWireInterface::updateFadec(double sampleTime, int fadecIndex) {
   // get sim data
-  SimData simData = simConnectInterface.getSimData();
+  const SimData& simData = simConnectInterface.getSimData();
 
   // set ground / flight for throttle handling
   if (idLgciuLeftMainGearCompressed[0]->get() || idLgciuLeftMainGearCompressed[1]->get() || idLgciuRightMainGearCompressed[0]->get() ||
@@ -2657,7 +3096,7 @@ bool FlyByWireInterface::updateFadec(double sampleTime, int fadecIndex) {
   fadecInputs[fadecIndex].in.input.is_air_conditioning_active = idAirConditioningPack_1->get();
   fadecInputs[fadecIndex].in.input.ATHR_reset_disable = simConnectInterface.getSimInputThrottles().ATHR_reset_disable == 1;
 
-  fadecInputs[fadecIndex].in.fcu_input = fcuBusOutputs;
+  fadecInputs[fadecIndex].in.fcu_input = *fcuBusOutputs;
 
   if (fadecIndex == fadecDisabled) {
     simConnectInterface.setClientDataFadecData(fadecInputs[fadecIndex].in.data);
@@ -2666,6 +3105,7 @@ bool FlyByWireInterface::updateFadec(double sampleTime, int fadecIndex) {
     fadecOutputs[fadecIndex] = simConnectInterface.getClientDataFadecOutput();
   } else {
     // step the model -------------------------------------------------------------------------------------------------
+    flightDataRecorder.recordFadecInputs(fadecIndex, fadecInputs[fadecIndex]);
     fadecs[fadecIndex].setExternalInputs(&fadecInputs[fadecIndex]);
     fadecs[fadecIndex].step();
 
@@ -2707,7 +3147,7 @@ bool FlyByWireInterface::updateFadec(double sampleTime, int fadecIndex) {
 
 bool FlyByWireInterface::updateSpoilers(double sampleTime) {
   // get sim data
-  auto simData = simConnectInterface.getSimData();
+  const SimData& simData = simConnectInterface.getSimData();
 
   // initialize position if needed
   if (!spoilersHandler->getIsInitialized()) {
@@ -2724,7 +3164,7 @@ bool FlyByWireInterface::updateSpoilers(double sampleTime) {
 
 bool FlyByWireInterface::updateAltimeterSetting(double sampleTime) {
   // get sim data
-  auto simData = simConnectInterface.getSimData();
+  const SimData& simData = simConnectInterface.getSimData();
 
   // determine if change is needed
   if (simData.kohlsmanSettingStd_3 == 0) {
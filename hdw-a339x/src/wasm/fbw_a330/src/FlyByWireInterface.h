@@ -2,6 +2,7 @@
 
 #include <MSFS/Legacy/gauges.h>
 #include <SimConnect.h>
+#include <ini.h>
 
 #include "Arinc429.h"
 #include "CalculatedRadioReceiver.h"
@@ -10,6 +11,7 @@
 #include "LocalVariable.h"
 #include "RateLimiter.h"
 #include "SimConnectInterface.h"
+#include "SimulationRateGovernor.h"
 #include "SpoilersHandler.h"
 #include "ThrottleAxisMapping.h"
 #include "elac/Elac.h"
@@ -18,13 +20,18 @@
 #include "fcdc/Fcdc.h"
 #include "fcu/Fcu.h"
 #include "fmgc/Fmgc.h"
+#include "interface/LocalVariableTable.h"
 #include "recording/FlightDataRecorder.h"
 #include "recording/RecordingDataTypes.h"
 #include "sec/Sec.h"
 
 #include "utils/ConfirmNode.h"
+#include "utils/FileWatcher.h"
+#include "utils/FixedStep.h"
 #include "utils/HysteresisNode.h"
 #include "utils/SRFlipFlop.h"
+#include "utils/StageScheduler.h"
+#include "utils/StageTimings.h"
 
 class FlyByWireInterface {
  public:
@@ -37,21 +44,79 @@ class FlyByWireInterface {
  private:
   const std::string CONFIGURATION_FILEPATH = "\\work\\ModelConfiguration.ini";
 
+  // the configuration file is checked for changes at this interval in s
+  static constexpr double CONFIGURATION_CHECK_INTERVAL = 1.0;
+  FileWatcher configurationWatcher = FileWatcher(CONFIGURATION_FILEPATH, CONFIGURATION_CHECK_INTERVAL);
+  // configuration that was applied last
+  mINI::INIStructure configuration;
+
   static constexpr double MAX_ACCEPTABLE_SAMPLE_TIME = 0.22;
   static constexpr uint32_t LOW_PERFORMANCE_TIMER_THRESHOLD = 10;
   uint32_t lowPerformanceTimer = 0;
 
+  // stages of the update that are measured when stage timing is enabled and run at their configured rate
+  enum Stage {
+    STAGE_UPDATE,
+    STAGE_READ_DATA,
+    STAGE_SIMULATION_RATE,
+    STAGE_RADIO_RECEIVER,
+    STAGE_ALTIMETER_SETTING,
+    STAGE_FLY_BY_WIRE,
+    STAGE_SENSORS,
+    STAGE_FADEC_BUS,
+    STAGE_TCAS,
+    STAGE_FCU,
+    STAGE_FCU_SHIM,
+    STAGE_FMGC_1,
+    STAGE_FMGC_2,
+    STAGE_FMGC_SHIM,
+    STAGE_ELAC_1,
+    STAGE_ELAC_2,
+    STAGE_SEC_1,
+    STAGE_SEC_2,
+    STAGE_SEC_3,
+    STAGE_FAC_1,
+    STAGE_FAC_2,
+    STAGE_FCDC_1,
+    STAGE_FCDC_2,
+    STAGE_FADEC_1,
+    STAGE_FADEC_2,
+    STAGE_RECORDING_DATA,
+    STAGE_SPOILERS,
+    STAGE_FLIGHT_DATA_RECORDER,
+    STAGE_MODEL_REPLAY,
+    STAGE_LVAR_FLUSH,
+    STAGE_COUNT,
+  };
+
+  const std::string STAGE_TIMINGS_FILEPATH = "\\work\\StageTimings.csv";
+  static constexpr uint32_t STAGE_TIMING_PUBLISH_INTERVAL = 30;
+  uint32_t stageTimingPublishCounter = 0;
+  StageTimings stageTimings;
+
+  // stages that can run below the frame rate, the rates are read from the configuration
+  static constexpr int SCHEDULED_STAGES[] = {STAGE_RADIO_RECEIVER, STAGE_ALTIMETER_SETTING, STAGE_FADEC_BUS, STAGE_TCAS,
+                                             STAGE_FCU_SHIM,       STAGE_FMGC_1,            STAGE_FMGC_2,    STAGE_FMGC_SHIM};
+  const std::string STAGE_SCHEDULE_FILEPATH = "\\work\\StageSchedule.csv";
+  StageScheduler stageScheduler;
+
   double previousSimulationTime = 0;
   double calculatedSampleTime = 0;
 
   double monotonicTime = 0;
+  // number of frames with a calculated sample time, the laws are not run in every frame
+  std::uint64_t frameCount = 0;
 
   int currentApproachCapability = 0;
   double previousApproachCapabilityUpdateTime = 0;
 
   bool simulationRateReductionEnabled = true;
+  bool simulationRateRecoveryEnabled = true;
+  double simulationRateRecoveryDelay = 10;
   bool limitSimulationRateByPerformance = true;
 
+  SimulationRateGovernor simulationRateGovernor;
+
   double targetSimulationRate = 1;
   bool targetSimulationRateModified = false;
 
@@ -63,6 +128,23 @@ class FlyByWireInterface {
   int fadecDisabled = -1;
   bool tailstrikeProtectionEnabled = true;
 
+  // inputs of the ELACs at the end of a frame, the fixed step interpolates between the frames
+  struct ElacFrameInputs {
+    std::uint64_t frameCount;
+    double monotonicTime;
+    double simulationTime;
+    base_elac_analog_inputs analogInputs;
+    base_adr_bus adrBusses[3];
+    base_ir_bus irBusses[3];
+  };
+
+  // optional fixed step of the ELACs, which contain the pitch and lateral laws
+  FixedStep elacFixedStep;
+  bool elacFixedStepLimitLogged = false;
+  // execution time of the sub-steps of both ELACs in the current frame
+  std::chrono::steady_clock::duration elacFixedStepExecutionTime = {};
+  ElacFrameInputs elacPreviousFrameInputs[2] = {};
+
   ConfirmNode elac2EmerPowersupplyRelayTimer = ConfirmNode(true, 30);
   SRFlipFlop elac2EmerPowersupplyNoseGearConditionLatch = SRFlipFlop(true);
 
@@ -97,6 +179,7 @@ class FlyByWireInterface {
   bool enableRudder2AxisMode = false;
 
   bool clientDataEnabled = false;
+  bool clientDataBulkTransferEnabled = false;
 
   bool last_fd1_active = false;
   bool last_fd2_active = false;
@@ -113,6 +196,9 @@ class FlyByWireInterface {
 
   FlightDataRecorder flightDataRecorder;
 
+  // local variables of the interface, read on first use in a frame and written in one batch at the end of the update
+  LocalVariableTable localVariables;
+
   SimConnectInterface simConnectInterface;
 
   FailuresConsumer failuresConsumer;
@@ -133,29 +219,35 @@ class FlyByWireInterface {
   Elac elacs[2] = {Elac(true), Elac(false)};
   base_elac_discrete_outputs elacsDiscreteOutputs[2] = {};
   base_elac_analog_outputs elacsAnalogOutputs[2] = {};
-  base_elac_out_bus elacsBusOutputs[2] = {};
+  // the bus outputs of the computers live in the computers, see wireBusOutputs()
+  const base_elac_out_bus* elacsBusOutputs[2] = {};
+  base_elac_out_bus elacsClientDataBusOutputs[2] = {};
 
   Sec secs[3] = {Sec(true, false), Sec(false, false), Sec(false, true)};
   base_sec_discrete_outputs secsDiscreteOutputs[3] = {};
   base_sec_analog_outputs secsAnalogOutputs[3] = {};
-  base_sec_out_bus secsBusOutputs[3] = {};
+  const base_sec_out_bus* secsBusOutputs[3] = {};
+  base_sec_out_bus secsClientDataBusOutputs[3] = {};
 
   Fcdc fcdcs[2] = {Fcdc(true), Fcdc(false)};
   FcdcDiscreteOutputs fcdcsDiscreteOutputs[2] = {};
-  base_fcdc_bus fcdcsBusOutputs[2] = {};
+  const base_fcdc_bus* fcdcsBusOutputs[2] = {};
 
   Fmgc fmgcs[2] = {Fmgc(true), Fmgc(false)};
   base_fmgc_discrete_outputs fmgcsDiscreteOutputs[2] = {};
-  base_fmgc_bus_outputs fmgcsBusOutputs[2] = {};
+  const base_fmgc_bus_outputs* fmgcsBusOutputs[2] = {};
+  base_fmgc_bus_outputs fmgcsClientDataBusOutputs[2] = {};
 
   Fcu fcu = Fcu();
-  base_fcu_bus fcuBusOutputs = {};
+  const base_fcu_bus* fcuBusOutputs = nullptr;
+  base_fcu_bus fcuClientDataBusOutputs = {};
   bool fcuHealthy = false;
 
   Fac facs[2] = {Fac(true), Fac(false)};
   base_fac_discrete_outputs facsDiscreteOutputs[2] = {};
   base_fac_analog_outputs facsAnalogOutputs[2] = {};
-  base_fac_bus facsBusOutputs[2] = {};
+  const base_fac_bus* facsBusOutputs[2] = {};
+  base_fac_bus facsClientDataBusOutputs[2] = {};
 
   FadecComputer fadecs[2];
   FadecComputer::ExternalInputs_FadecComputer_T fadecInputs[2];
@@ -168,103 +260,120 @@ class FlyByWireInterface {
 
   bool wasFcuInitialized = false;
   double simulationTimeReady = 0.0;
-  std::unique_ptr<LocalVariable> idIsReady;
-  std::unique_ptr<LocalVariable> idStartState;
+  std::unique_ptr<CachedLocalVariable> idIsReady;
+  std::unique_ptr<CachedLocalVariable> idStartState;
 
   bool developmentLocalVariablesEnabled = false;
   bool useCalculatedLocalizerAndGlideSlope = false;
-  std::unique_ptr<LocalVariable> idDevelopmentAutoland_condition_Flare;
-  std::unique_ptr<LocalVariable> idDevelopmentAutoland_H_dot_fpm;
-  std::unique_ptr<LocalVariable> idDevelopmentAutoland_H_dot_c_fpm;
-  std::unique_ptr<LocalVariable> idDevelopmentAutoland_delta_Theta_H_dot_deg;
-  std::unique_ptr<LocalVariable> idDevelopmentAutoland_delta_Theta_bz_deg;
-  std::unique_ptr<LocalVariable> idDevelopmentAutoland_delta_Theta_bx_deg;
-  std::unique_ptr<LocalVariable> idDevelopmentAutoland_delta_Theta_beta_c_deg;
-
-  std::unique_ptr<LocalVariable> idLoggingFlightControlsEnabled;
-  std::unique_ptr<LocalVariable> idLoggingThrottlesEnabled;
-
-  std::unique_ptr<LocalVariable> idMinimumSimulationRate;
-  std::unique_ptr<LocalVariable> idMaximumSimulationRate;
-
-  std::unique_ptr<LocalVariable> idPerformanceWarningActive;
-
-  std::unique_ptr<LocalVariable> idTrackingMode;
-  std::unique_ptr<LocalVariable> idExternalOverride;
-
-  std::unique_ptr<LocalVariable> idFdrEvent;
-
-  std::unique_ptr<LocalVariable> idSideStickPositionX;
-  std::unique_ptr<LocalVariable> idSideStickPositionY;
-  std::unique_ptr<LocalVariable> idRudderPedalPosition;
-
-  std::unique_ptr<LocalVariable> idFlightGuidanceAvailable;
-  std::unique_ptr<LocalVariable> idFlightGuidanceCrossTrackError;
-  std::unique_ptr<LocalVariable> idFlightGuidanceTrackAngleError;
-  std::unique_ptr<LocalVariable> idFlightGuidancePhiCommand;
-  std::unique_ptr<LocalVariable> idFlightGuidancePhiLimit;
-  std::unique_ptr<LocalVariable> idFlightGuidanceRequestedVerticalMode;
-  std::unique_ptr<LocalVariable> idFlightGuidanceTargetAltitude;
-  std::unique_ptr<LocalVariable> idFlightGuidanceTargetVerticalSpeed;
-  std::unique_ptr<LocalVariable> idFmRnavAppSelected;
-  std::unique_ptr<LocalVariable> idFmFinalCanEngage;
-
-  std::unique_ptr<LocalVariable> idTcasFault;
-  std::unique_ptr<LocalVariable> idTcasMode;
-  std::unique_ptr<LocalVariable> idTcasTaOnly;
-  std::unique_ptr<LocalVariable> idTcasState;
-  std::unique_ptr<LocalVariable> idTcasRaCorrective;
-  std::unique_ptr<LocalVariable> idTcasRaType;
-  std::unique_ptr<LocalVariable> idTcasRaRateToMaintain;
-  std::unique_ptr<LocalVariable> idTcasRaUpAdvStatus;
-  std::unique_ptr<LocalVariable> idTcasRaDownAdvStatus;
-  std::unique_ptr<LocalVariable> idTcasSensitivityLevel;
-
-  std::unique_ptr<LocalVariable> idFwcFlightPhase;
-  std::unique_ptr<LocalVariable> idFmgcFlightPhase;
-  std::unique_ptr<LocalVariable> idFmgcV2;
-  std::unique_ptr<LocalVariable> idFmgcV_APP;
-  std::unique_ptr<LocalVariable> idFmsManagedSpeedTarget;
-  std::unique_ptr<LocalVariable> idFmsPresetMach;
-  std::unique_ptr<LocalVariable> idFmsPresetSpeed;
-  std::unique_ptr<LocalVariable> idFmgcAltitudeConstraint;
-  std::unique_ptr<LocalVariable> idFmgcThrustReductionAltitude;
-  std::unique_ptr<LocalVariable> idFmgcThrustReductionAltitudeGoAround;
-  std::unique_ptr<LocalVariable> idFmgcAccelerationAltitude;
-  std::unique_ptr<LocalVariable> idFmgcAccelerationAltitudeEngineOut;
-  std::unique_ptr<LocalVariable> idFmgcAccelerationAltitudeGoAround;
-  std::unique_ptr<LocalVariable> idFmgcAccelerationAltitudeGoAroundEngineOut;
-  std::unique_ptr<LocalVariable> idFmgcCruiseAltitude;
-  std::unique_ptr<LocalVariable> idFmgcFlexTemperature;
-  std::unique_ptr<LocalVariable> idFmgcDirToTrigger;
-  std::unique_ptr<LocalVariable> idFmsLsCourse;
-  std::unique_ptr<LocalVariable> idFmsSpeedMarginHigh;
-  std::unique_ptr<LocalVariable> idFmsSpeedMarginLow;
-  std::unique_ptr<LocalVariable> idFmsSpeedMarginVisible;
-
-  std::unique_ptr<LocalVariable> idAirConditioningPack_1;
-  std::unique_ptr<LocalVariable> idAirConditioningPack_2;
-
-  std::unique_ptr<LocalVariable> thrustLeverAngle_1;
-  std::unique_ptr<LocalVariable> thrustLeverAngle_2;
-  std::unique_ptr<LocalVariable> idAutothrustN1_TLA_1;
-  std::unique_ptr<LocalVariable> idAutothrustN1_TLA_2;
-  std::unique_ptr<LocalVariable> idAutothrustReverse_1;
-  std::unique_ptr<LocalVariable> idAutothrustReverse_2;
-  std::unique_ptr<LocalVariable> idAutothrustThrustLimitType;
-  std::unique_ptr<LocalVariable> idAutothrustThrustLimit;
-  std::unique_ptr<LocalVariable> idAutothrustThrustLimitREV;
-  std::unique_ptr<LocalVariable> idAutothrustThrustLimitIDLE;
-  std::unique_ptr<LocalVariable> idAutothrustThrustLimitCLB;
-  std::unique_ptr<LocalVariable> idAutothrustThrustLimitMCT;
-  std::unique_ptr<LocalVariable> idAutothrustThrustLimitFLX;
-  std::unique_ptr<LocalVariable> idAutothrustThrustLimitTOGA;
-  std::unique_ptr<LocalVariable> idAutothrustN1_c_1;
-  std::unique_ptr<LocalVariable> idAutothrustN1_c_2;
-  std::unique_ptr<LocalVariable> idAutothrustDisabled;
-  std::unique_ptr<LocalVariable> idAutothrustDisconnect;
-  std::unique_ptr<LocalVariable> idThrottlePosition3d_1;
-  std::unique_ptr<LocalVariable> idThrottlePosition3d_2;
+  std::unique_ptr<CachedLocalVariable> idDevelopmentAutoland_condition_Flare;
+  std::unique_ptr<CachedLocalVariable> idDevelopmentAutoland_H_dot_fpm;
+  std::unique_ptr<CachedLocalVariable> idDevelopmentAutoland_H_dot_c_fpm;
+  std::unique_ptr<CachedLocalVariable> idDevelopmentAutoland_delta_Theta_H_dot_deg;
+  std::unique_ptr<CachedLocalVariable> idDevelopmentAutoland_delta_Theta_bz_deg;
+  std::unique_ptr<CachedLocalVariable> idDevelopmentAutoland_delta_Theta_bx_deg;
+  std::unique_ptr<CachedLocalVariable> idDevelopmentAutoland_delta_Theta_beta_c_deg;
+
+  std::unique_ptr<CachedLocalVariable> idLoggingFlightControlsEnabled;
+  std::unique_ptr<CachedLocalVariable> idLoggingThrottlesEnabled;
+
+  std::unique_ptr<CachedLocalVariable> idMinimumSimulationRate;
+  std::unique_ptr<CachedLocalVariable> idMaximumSimulationRate;
+
+  std::unique_ptr<CachedLocalVariable> idPerformanceWarningActive;
+
+  std::unique_ptr<CachedLocalVariable> idSimulationRateGovernorDecision;
+  std::unique_ptr<CachedLocalVariable> idSimulationRateGovernorReason;
+  std::unique_ptr<CachedLocalVariable> idSimulationRateGovernorRequestedRate;
+  std::unique_ptr<CachedLocalVariable> idSimulationRateGovernorSafeRate;
+
+  std::unique_ptr<CachedLocalVariable> idStageTimingEnabled;
+  std::unique_ptr<CachedLocalVariable> idStageTimingSelectedStage;
+  std::unique_ptr<CachedLocalVariable> idStageTimingMinimum;
+  std::unique_ptr<CachedLocalVariable> idStageTimingMean;
+  std::unique_ptr<CachedLocalVariable> idStageTimingP99;
+  std::unique_ptr<CachedLocalVariable> idStageTimingMaximum;
+  std::unique_ptr<CachedLocalVariable> idStageTimingWriteToFile;
+  std::unique_ptr<CachedLocalVariable> idStageTimingRate;
+  std::unique_ptr<CachedLocalVariable> idStageTimingMeanInterval;
+  std::unique_ptr<CachedLocalVariable> idStageTimingRmsJitter;
+  std::unique_ptr<CachedLocalVariable> idStageTimingMaximumJitter;
+
+  std::unique_ptr<CachedLocalVariable> idTrackingMode;
+  std::unique_ptr<CachedLocalVariable> idExternalOverride;
+
+  std::unique_ptr<CachedLocalVariable> idFdrEvent;
+
+  std::unique_ptr<CachedLocalVariable> idSideStickPositionX;
+  std::unique_ptr<CachedLocalVariable> idSideStickPositionY;
+  std::unique_ptr<CachedLocalVariable> idRudderPedalPosition;
+
+  std::unique_ptr<CachedLocalVariable> idFlightGuidanceAvailable;
+  std::unique_ptr<CachedLocalVariable> idFlightGuidanceCrossTrackError;
+  std::unique_ptr<CachedLocalVariable> idFlightGuidanceTrackAngleError;
+  std::unique_ptr<CachedLocalVariable> idFlightGuidancePhiCommand;
+  std::unique_ptr<CachedLocalVariable> idFlightGuidancePhiLimit;
+  std::unique_ptr<CachedLocalVariable> idFlightGuidanceRequestedVerticalMode;
+  std::unique_ptr<CachedLocalVariable> idFlightGuidanceTargetAltitude;
+  std::unique_ptr<CachedLocalVariable> idFlightGuidanceTargetVerticalSpeed;
+  std::unique_ptr<CachedLocalVariable> idFmRnavAppSelected;
+  std::unique_ptr<CachedLocalVariable> idFmFinalCanEngage;
+
+  std::unique_ptr<CachedLocalVariable> idTcasFault;
+  std::unique_ptr<CachedLocalVariable> idTcasMode;
+  std::unique_ptr<CachedLocalVariable> idTcasTaOnly;
+  std::unique_ptr<CachedLocalVariable> idTcasState;
+  std::unique_ptr<CachedLocalVariable> idTcasRaCorrective;
+  std::unique_ptr<CachedLocalVariable> idTcasRaType;
+  std::unique_ptr<CachedLocalVariable> idTcasRaRateToMaintain;
+  std::unique_ptr<CachedLocalVariable> idTcasRaUpAdvStatus;
+  std::unique_ptr<CachedLocalVariable> idTcasRaDownAdvStatus;
+  std::unique_ptr<CachedLocalVariable> idTcasSensitivityLevel;
+
+  std::unique_ptr<CachedLocalVariable> idFwcFlightPhase;
+  std::unique_ptr<CachedLocalVariable> idFmgcFlightPhase;
+  std::unique_ptr<CachedLocalVariable> idFmgcV2;
+  std::unique_ptr<CachedLocalVariable> idFmgcV_APP;
+  std::unique_ptr<CachedLocalVariable> idFmsManagedSpeedTarget;
+  std::unique_ptr<CachedLocalVariable> idFmsPresetMach;
+  std::unique_ptr<CachedLocalVariable> idFmsPresetSpeed;
+  std::unique_ptr<CachedLocalVariable> idFmgcAltitudeConstraint;
+  std::unique_ptr<CachedLocalVariable> idFmgcThrustReductionAltitude;
+  std::unique_ptr<CachedLocalVariable> idFmgcThrustReductionAltitudeGoAround;
+  std::unique_ptr<CachedLocalVariable> idFmgcAccelerationAltitude;
+  std::unique_ptr<CachedLocalVariable> idFmgcAccelerationAltitudeEngineOut;
+  std::unique_ptr<CachedLocalVariable> idFmgcAccelerationAltitudeGoAround;
+  std::unique_ptr<CachedLocalVariable> idFmgcAccelerationAltitudeGoAroundEngineOut;
+  std::unique_ptr<CachedLocalVariable> idFmgcCruiseAltitude;
+  std::unique_ptr<CachedLocalVariable> idFmgcFlexTemperature;
+  std::unique_ptr<CachedLocalVariable> idFmgcDirToTrigger;
+  std::unique_ptr<CachedLocalVariable> idFmsLsCourse;
+  std::unique_ptr<CachedLocalVariable> idFmsSpeedMarginHigh;
+  std::unique_ptr<CachedLocalVariable> idFmsSpeedMarginLow;
+  std::unique_ptr<CachedLocalVariable> idFmsSpeedMarginVisible;
+
+  std::unique_ptr<CachedLocalVariable> idAirConditioningPack_1;
+  std::unique_ptr<CachedLocalVariable> idAirConditioningPack_2;
+
+  std::unique_ptr<CachedLocalVariable> thrustLeverAngle_1;
+  std::unique_ptr<CachedLocalVariable> thrustLeverAngle_2;
+  std::unique_ptr<CachedLocalVariable> idAutothrustN1_TLA_1;
+  std::unique_ptr<CachedLocalVariable> idAutothrustN1_TLA_2;
+  std::unique_ptr<CachedLocalVariable> idAutothrustReverse_1;
+  std::unique_ptr<CachedLocalVariable> idAutothrustReverse_2;
+  std::unique_ptr<CachedLocalVariable> idAutothrustThrustLimitType;
+  std::unique_ptr<CachedLocalVariable> idAutothrustThrustLimit;
+  std::unique_ptr<CachedLocalVariable> idAutothrustThrustLimitREV;
+  std::unique_ptr<CachedLocalVariable> idAutothrustThrustLimitIDLE;
+  std::unique_ptr<CachedLocalVariable> idAutothrustThrustLimitCLB;
+  std::unique_ptr<CachedLocalVariable> idAutothrustThrustLimitMCT;
+  std::unique_ptr<CachedLocalVariable> idAutothrustThrustLimitFLX;
+  std::unique_ptr<CachedLocalVariable> idAutothrustThrustLimitTOGA;
+  std::unique_ptr<CachedLocalVariable> idAutothrustN1_c_1;
+  std::unique_ptr<CachedLocalVariable> idAutothrustN1_c_2;
+  std::unique_ptr<CachedLocalVariable> idAutothrustDisabled;
+  std::unique_ptr<CachedLocalVariable> idAutothrustDisconnect;
+  std::unique_ptr<CachedLocalVariable> idThrottlePosition3d_1;
+  std::unique_ptr<CachedLocalVariable> idThrottlePosition3d_2;
   InterpolatingLookupTable idThrottlePositionLookupTable3d;
 
   std::vector<std::shared_ptr<ThrottleAxisMapping>> throttleAxis;
@@ -272,401 +381,435 @@ class FlyByWireInterface {
   BaseData baseData = {};
   AircraftSpecificData aircraftSpecificData = {};
 
-  std::unique_ptr<LocalVariable> idParkBrakeLeverPos;
-  std::unique_ptr<LocalVariable> idBrakePedalLeftPos;
-  std::unique_ptr<LocalVariable> idBrakePedalRightPos;
-  std::unique_ptr<LocalVariable> idAutobrakeArmedMode;
-  std::unique_ptr<LocalVariable> idAutobrakeDecelLight;
-  std::unique_ptr<LocalVariable> idHydraulicGreenPressure;
-  std::unique_ptr<LocalVariable> idHydraulicBluePressure;
-  std::unique_ptr<LocalVariable> idHydraulicYellowPressure;
-  std::unique_ptr<LocalVariable> idMasterWarning;
-  std::unique_ptr<LocalVariable> idMasterCaution;
-
-  std::unique_ptr<LocalVariable> idFlapsHandleIndex;
-  std::unique_ptr<LocalVariable> idFlapsHandlePercent;
-
-  std::unique_ptr<LocalVariable> flapsHandleIndexFlapConf;
-  std::unique_ptr<LocalVariable> flapsPosition;
-
-  std::unique_ptr<LocalVariable> idSpoilersArmed;
-  std::unique_ptr<LocalVariable> idSpoilersHandlePosition;
+  std::unique_ptr<CachedLocalVariable> idParkBrakeLeverPos;
+  std::unique_ptr<CachedLocalVariable> idBrakePedalLeftPos;
+  std::unique_ptr<CachedLocalVariable> idBrakePedalRightPos;
+  std::unique_ptr<CachedLocalVariable> idAutobrakeArmedMode;
+  std::unique_ptr<CachedLocalVariable> idAutobrakeDecelLight;
+  std::unique_ptr<CachedLocalVariable> idMasterWarning;
+  std::unique_ptr<CachedLocalVariable> idMasterCaution;
+
+  std::unique_ptr<CachedLocalVariable> idFlapsHandleIndex;
+  std::unique_ptr<CachedLocalVariable> idFlapsHandlePercent;
+
+  std::unique_ptr<CachedLocalVariable> flapsHandleIndexFlapConf;
+  std::unique_ptr<CachedLocalVariable> flapsPosition;
+
+  std::unique_ptr<CachedLocalVariable> idSpoilersArmed;
+  std::unique_ptr<CachedLocalVariable> idSpoilersHandlePosition;
   std::shared_ptr<SpoilersHandler> spoilersHandler;
 
-  std::unique_ptr<LocalVariable> idRadioReceiverUsageEnabled;
-  std::unique_ptr<LocalVariable> idRadioReceiverLocalizerValid;
-  std::unique_ptr<LocalVariable> idRadioReceiverLocalizerDeviation;
-  std::unique_ptr<LocalVariable> idRadioReceiverLocalizerDistance;
-  std::unique_ptr<LocalVariable> idRadioReceiverGlideSlopeValid;
-  std::unique_ptr<LocalVariable> idRadioReceiverGlideSlopeDeviation;
+  std::unique_ptr<CachedLocalVariable> idRadioReceiverUsageEnabled;
+  std::unique_ptr<CachedLocalVariable> idRadioReceiverLocalizerValid;
+  std::unique_ptr<CachedLocalVariable> idRadioReceiverLocalizerDeviation;
+  std::unique_ptr<CachedLocalVariable> idRadioReceiverLocalizerDistance;
+  std::unique_ptr<CachedLocalVariable> idRadioReceiverGlideSlopeValid;
+  std::unique_ptr<CachedLocalVariable> idRadioReceiverGlideSlopeDeviation;
 
-  std::unique_ptr<LocalVariable> idFm1BackbeamSelected;
+  std::unique_ptr<CachedLocalVariable> idFm1BackbeamSelected;
 
-  std::unique_ptr<LocalVariable> idRealisticTillerEnabled;
-  std::unique_ptr<LocalVariable> idTillerHandlePosition;
-  std::unique_ptr<LocalVariable> idNoseWheelPosition;
+  std::unique_ptr<CachedLocalVariable> idRealisticTillerEnabled;
+  std::unique_ptr<CachedLocalVariable> idTillerHandlePosition;
+  std::unique_ptr<CachedLocalVariable> idNoseWheelPosition;
 
-  std::unique_ptr<LocalVariable> idSyncFoEfisEnabled;
+  std::unique_ptr<CachedLocalVariable> idSyncFoEfisEnabled;
 
-  std::unique_ptr<LocalVariable> idLs1Active;
-  std::unique_ptr<LocalVariable> idLs2Active;
-  std::unique_ptr<LocalVariable> idIsisLsActive;
+  std::unique_ptr<CachedLocalVariable> idIsisLsActive;
 
-  std::unique_ptr<LocalVariable> idWingAntiIce;
+  std::unique_ptr<CachedLocalVariable> idWingAntiIce;
 
-  std::unique_ptr<LocalVariable> idFmGrossWeight;
+  std::unique_ptr<CachedLocalVariable> idFmGrossWeight;
 
   // RA bus inputs
-  std::unique_ptr<LocalVariable> idRadioAltimeterHeight[2];
+  std::unique_ptr<CachedLocalVariable> idRadioAltimeterHeight[2];
 
   // LGCIU inputs
-  std::unique_ptr<LocalVariable> idLgciu1NoseGearDownlocked;
+  std::unique_ptr<CachedLocalVariable> idLgciu1NoseGearDownlocked;
 
-  std::unique_ptr<LocalVariable> idLgciuNoseGearCompressed[2];
-  std::unique_ptr<LocalVariable> idLgciuLeftMainGearCompressed[2];
-  std::unique_ptr<LocalVariable> idLgciuRightMainGearCompressed[2];
-  std::unique_ptr<LocalVariable> idLgciuDiscreteWord1[2];
-  std::unique_ptr<LocalVariable> idLgciuDiscreteWord2[2];
-  std::unique_ptr<LocalVariable> idLgciuDiscreteWord3[2];
+  std::unique_ptr<CachedLocalVariable> idLgciuNoseGearCompressed[2];
+  std::unique_ptr<CachedLocalVariable> idLgciuLeftMainGearCompressed[2];
+  std::unique_ptr<CachedLocalVariable> idLgciuRightMainGearCompressed[2];
+  std::unique_ptr<CachedLocalVariable> idLgciuDiscreteWord1[2];
+  std::unique_ptr<CachedLocalVariable> idLgciuDiscreteWord2[2];
+  std::unique_ptr<CachedLocalVariable> idLgciuDiscreteWord3[2];
 
   // SFCC inputs
-  std::unique_ptr<LocalVariable> idSfccSlatFlapComponentStatusWord;
-  std::unique_ptr<LocalVariable> idSfccSlatFlapSystemStatusWord;
-  std::unique_ptr<LocalVariable> idSfccSlatFlapActualPositionWord;
-  std::unique_ptr<LocalVariable> idSfccSlatActualPositionWord;
-  std::unique_ptr<LocalVariable> idSfccFlapActualPositionWord;
+  std::unique_ptr<CachedLocalVariable> idSfccSlatFlapComponentStatusWord;
+  std::unique_ptr<CachedLocalVariable> idSfccSlatFlapSystemStatusWord;
+  std::unique_ptr<CachedLocalVariable> idSfccSlatFlapActualPositionWord;
+  std::unique_ptr<CachedLocalVariable> idSfccSlatActualPositionWord;
+  std::unique_ptr<CachedLocalVariable> idSfccFlapActualPositionWord;
 
   // ADR bus inputs
-  std::unique_ptr<LocalVariable> idAdrAltitudeStandard[3];
-  std::unique_ptr<LocalVariable> idAdrAltitudeCorrected[3];
-  std::unique_ptr<LocalVariable> idAdrMach[3];
-  std::unique_ptr<LocalVariable> idAdrAirspeedComputed[3];
-  std::unique_ptr<LocalVariable> idAdrAirspeedTrue[3];
-  std::unique_ptr<LocalVariable> idAdrVerticalSpeed[3];
-  std::unique_ptr<LocalVariable> idAdrAoaCorrected[3];
-  std::unique_ptr<LocalVariable> idAdrCorrectedAverageStaticPressure[3];
+  std::unique_ptr<CachedLocalVariable> idAdrAltitudeStandard[3];
+  std::unique_ptr<CachedLocalVariable> idAdrAltitudeCorrected[3];
+  std::unique_ptr<CachedLocalVariable> idAdrMach[3];
+  std::unique_ptr<CachedLocalVariable> idAdrAirspeedComputed[3];
+  std::unique_ptr<CachedLocalVariable> idAdrAirspeedTrue[3];
+  std::unique_ptr<CachedLocalVariable> idAdrVerticalSpeed[3];
+  std::unique_ptr<CachedLocalVariable> idAdrAoaCorrected[3];
+  std::unique_ptr<CachedLocalVariable> idAdrCorrectedAverageStaticPressure[3];
 
   // IR bus inputs
-  std::unique_ptr<LocalVariable> idIrLatitude[3];
-  std::unique_ptr<LocalVariable> idIrLongitude[3];
-  std::unique_ptr<LocalVariable> idIrGroundSpeed[3];
-  std::unique_ptr<LocalVariable> idIrWindSpeed[3];
-  std::unique_ptr<LocalVariable> idIrWindDirectionTrue[3];
-  std::unique_ptr<LocalVariable> idIrTrackAngleMagnetic[3];
-  std::unique_ptr<LocalVariable> idIrTrackAngleTrue[3];
-  std::unique_ptr<LocalVariable> idIrHeadingMagnetic[3];
-  std::unique_ptr<LocalVariable> idIrHeadingTrue[3];
-  std::unique_ptr<LocalVariable> idIrDriftAngle[3];
-  std::unique_ptr<LocalVariable> idIrFlightPathAngle[3];
-  std::unique_ptr<LocalVariable> idIrPitchAngle[3];
-  std::unique_ptr<LocalVariable> idIrRollAngle[3];
-  std::unique_ptr<LocalVariable> idIrBodyPitchRate[3];
-  std::unique_ptr<LocalVariable> idIrBodyRollRate[3];
-  std::unique_ptr<LocalVariable> idIrBodyYawRate[3];
-  std::unique_ptr<LocalVariable> idIrBodyLongAccel[3];
-  std::unique_ptr<LocalVariable> idIrBodyLatAccel[3];
-  std::unique_ptr<LocalVariable> idIrBodyNormalAccel[3];
-  std::unique_ptr<LocalVariable> idIrTrackAngleRate[3];
-  std::unique_ptr<LocalVariable> idIrPitchAttRate[3];
-  std::unique_ptr<LocalVariable> idIrRollAttRate[3];
-  std::unique_ptr<LocalVariable> idIrInertialVerticalSpeed[3];
+  std::unique_ptr<CachedLocalVariable> idIrLatitude[3];
+  std::unique_ptr<CachedLocalVariable> idIrLongitude[3];
+  std::unique_ptr<CachedLocalVariable> idIrGroundSpeed[3];
+  std::unique_ptr<CachedLocalVariable> idIrWindSpeed[3];
+  std::unique_ptr<CachedLocalVariable> idIrWindDirectionTrue[3];
+  std::unique_ptr<CachedLocalVariable> idIrTrackAngleMagnetic[3];
+  std::unique_ptr<CachedLocalVariable> idIrTrackAngleTrue[3];
+  std::unique_ptr<CachedLocalVariable> idIrHeadingMagnetic[3];
+  std::unique_ptr<CachedLocalVariable> idIrHeadingTrue[3];
+  std::unique_ptr<CachedLocalVariable> idIrDriftAngle[3];
+  std::unique_ptr<CachedLocalVariable> idIrFlightPathAngle[3];
+  std::unique_ptr<CachedLocalVariable> idIrPitchAngle[3];
+  std::unique_ptr<CachedLocalVariable> idIrRollAngle[3];
+  std::unique_ptr<CachedLocalVariable> idIrBodyPitchRate[3];
+  std::unique_ptr<CachedLocalVariable> idIrBodyRollRate[3];
+  std::unique_ptr<CachedLocalVariable> idIrBodyYawRate[3];
+  std::unique_ptr<CachedLocalVariable> idIrBodyLongAccel[3];
+  std::unique_ptr<CachedLocalVariable> idIrBodyLatAccel[3];
+  std::unique_ptr<CachedLocalVariable> idIrBodyNormalAccel[3];
+  std::unique_ptr<CachedLocalVariable> idIrTrackAngleRate[3];
+  std::unique_ptr<CachedLocalVariable> idIrPitchAttRate[3];
+  std::unique_ptr<CachedLocalVariable> idIrRollAttRate[3];
+  std::unique_ptr<CachedLocalVariable> idIrInertialVerticalSpeed[3];
 
   // FCDC bus label Lvars
-  std::unique_ptr<LocalVariable> idFcdcDiscreteWord1[2];
-  std::unique_ptr<LocalVariable> idFcdcDiscreteWord2[2];
-  std::unique_ptr<LocalVariable> idFcdcDiscreteWord3[2];
-  std::unique_ptr<LocalVariable> idFcdcDiscreteWord4[2];
-  std::unique_ptr<LocalVariable> idFcdcDiscreteWord5[2];
-  std::unique_ptr<LocalVariable> idFcdcCaptRollCommand[2];
-  std::unique_ptr<LocalVariable> idFcdcFoRollCommand[2];
-  std::unique_ptr<LocalVariable> idFcdcCaptPitchCommand[2];
-  std::unique_ptr<LocalVariable> idFcdcFoPitchCommand[2];
-  std::unique_ptr<LocalVariable> idFcdcRudderPedalPos[2];
-  std::unique_ptr<LocalVariable> idFcdcAileronLeftPos[2];
-  std::unique_ptr<LocalVariable> idFcdcElevatorLeftPos[2];
-  std::unique_ptr<LocalVariable> idFcdcAileronRightPos[2];
-  std::unique_ptr<LocalVariable> idFcdcElevatorRightPos[2];
-  std::unique_ptr<LocalVariable> idFcdcElevatorTrimPos[2];
-  std::unique_ptr<LocalVariable> idFcdcSpoilerLeft1Pos[2];
-  std::unique_ptr<LocalVariable> idFcdcSpoilerLeft2Pos[2];
-  std::unique_ptr<LocalVariable> idFcdcSpoilerLeft3Pos[2];
-  std::unique_ptr<LocalVariable> idFcdcSpoilerLeft4Pos[2];
-  std::unique_ptr<LocalVariable> idFcdcSpoilerLeft5Pos[2];
-  std::unique_ptr<LocalVariable> idFcdcSpoilerRight1Pos[2];
-  std::unique_ptr<LocalVariable> idFcdcSpoilerRight2Pos[2];
-  std::unique_ptr<LocalVariable> idFcdcSpoilerRight3Pos[2];
-  std::unique_ptr<LocalVariable> idFcdcSpoilerRight4Pos[2];
-  std::unique_ptr<LocalVariable> idFcdcSpoilerRight5Pos[2];
+  std::unique_ptr<CachedLocalVariable> idFcdcDiscreteWord1[2];
+  std::unique_ptr<CachedLocalVariable> idFcdcDiscreteWord2[2];
+  std::unique_ptr<CachedLocalVariable> idFcdcDiscreteWord3[2];
+  std::unique_ptr<CachedLocalVariable> idFcdcDiscreteWord4[2];
+  std::unique_ptr<CachedLocalVariable> idFcdcDiscreteWord5[2];
+  std::unique_ptr<CachedLocalVariable> idFcdcCaptRollCommand[2];
+  std::unique_ptr<CachedLocalVariable> idFcdcFoRollCommand[2];
+  std::unique_ptr<CachedLocalVariable> idFcdcCaptPitchCommand[2];
+  std::unique_ptr<CachedLocalVariable> idFcdcFoPitchCommand[2];
+  std::unique_ptr<CachedLocalVariable> idFcdcRudderPedalPos[2];
+  std::unique_ptr<CachedLocalVariable> idFcdcAileronLeftPos[2];
+  std::unique_ptr<CachedLocalVariable> idFcdcElevatorLeftPos[2];
+  std::unique_ptr<CachedLocalVariable> idFcdcAileronRightPos[2];
+  std::unique_ptr<CachedLocalVariable> idFcdcElevatorRightPos[2];
+  std::unique_ptr<CachedLocalVariable> idFcdcElevatorTrimPos[2];
+  std::unique_ptr<CachedLocalVariable> idFcdcSpoilerLeft1Pos[2];
+  std::unique_ptr<CachedLocalVariable> idFcdcSpoilerLeft2Pos[2];
+  std::unique_ptr<CachedLocalVariable> idFcdcSpoilerLeft3Pos[2];
+  std::unique_ptr<CachedLocalVariable> idFcdcSpoilerLeft4Pos[2];
+  std::unique_ptr<CachedLocalVariable> idFcdcSpoilerLeft5Pos[2];
+  std::unique_ptr<CachedLocalVariable> idFcdcSpoilerRight1Pos[2];
+  std::unique_ptr<CachedLocalVariable> idFcdcSpoilerRight2Pos[2];
+  std::unique_ptr<CachedLocalVariable> idFcdcSpoilerRight3Pos[2];
+  std::unique_ptr<CachedLocalVariable> idFcdcSpoilerRight4Pos[2];
+  std::unique_ptr<CachedLocalVariable> idFcdcSpoilerRight5Pos[2];
 
   // FCDC discrete output Lvars
-  std::unique_ptr<LocalVariable> idFcdcPriorityCaptGreen[2];
-  std::unique_ptr<LocalVariable> idFcdcPriorityCaptRed[2];
-  std::unique_ptr<LocalVariable> idFcdcPriorityFoGreen[2];
-  std::unique_ptr<LocalVariable> idFcdcPriorityFoRed[2];
+  std::unique_ptr<CachedLocalVariable> idFcdcPriorityCaptGreen[2];
+  std::unique_ptr<CachedLocalVariable> idFcdcPriorityCaptRed[2];
+  std::unique_ptr<CachedLocalVariable> idFcdcPriorityFoGreen[2];
+  std::unique_ptr<CachedLocalVariable> idFcdcPriorityFoRed[2];
 
   // fault input Lvars
-  std::unique_ptr<LocalVariable> idElevFaultLeft[2];
-  std::unique_ptr<LocalVariable> idElevFaultRight[2];
-  std::unique_ptr<LocalVariable> idAilFaultLeft[2];
-  std::unique_ptr<LocalVariable> idAilFaultRight[2];
-  std::unique_ptr<LocalVariable> idSplrFaultLeft[5];
-  std::unique_ptr<LocalVariable> idSplrFaultRight[5];
+  std::unique_ptr<CachedLocalVariable> idElevFaultLeft[2];
+  std::unique_ptr<CachedLocalVariable> idElevFaultRight[2];
+  std::unique_ptr<CachedLocalVariable> idAilFaultLeft[2];
+  std::unique_ptr<CachedLocalVariable> idAilFaultRight[2];
+  std::unique_ptr<CachedLocalVariable> idSplrFaultLeft[5];
+  std::unique_ptr<CachedLocalVariable> idSplrFaultRight[5];
 
   // THS Override Signal LVar
-  std::unique_ptr<LocalVariable> idThsOverrideActive;
+  std::unique_ptr<CachedLocalVariable> idThsOverrideActive;
 
   // ELAC discrete input Lvars
-  std::unique_ptr<LocalVariable> idElacPushbuttonPressed[2];
+  std::unique_ptr<CachedLocalVariable> idElacPushbuttonPressed[2];
 
   // ELAC discrete output Lvars
-  std::unique_ptr<LocalVariable> idElacDigitalOpValidated[2];
+  std::unique_ptr<CachedLocalVariable> idElacDigitalOpValidated[2];
 
   // SEC discrete input Lvars
-  std::unique_ptr<LocalVariable> idSecPushbuttonPressed[3];
+  std::unique_ptr<CachedLocalVariable> idSecPushbuttonPressed[3];
 
   // SEC discrete output Lvars
-  std::unique_ptr<LocalVariable> idSecFaultLightOn[3];
-  std::unique_ptr<LocalVariable> idSecGroundSpoilersOut[3];
+  std::unique_ptr<CachedLocalVariable> idSecFaultLightOn[3];
+  std::unique_ptr<CachedLocalVariable> idSecGroundSpoilersOut[3];
 
   // Flight controls solenoid valve energization Lvars
-  std::unique_ptr<LocalVariable> idLeftAileronSolenoidEnergized[2];
-  std::unique_ptr<LocalVariable> idLeftAileronCommandedPosition[2];
-  std::unique_ptr<LocalVariable> idRightAileronSolenoidEnergized[2];
-  std::unique_ptr<LocalVariable> idRightAileronCommandedPosition[2];
-  std::unique_ptr<LocalVariable> idLeftSpoilerCommandedPosition[5];
-  std::unique_ptr<LocalVariable> idRightSpoilerCommandedPosition[5];
-  std::unique_ptr<LocalVariable> idLeftElevatorSolenoidEnergized[2];
-  std::unique_ptr<LocalVariable> idLeftElevatorCommandedPosition[2];
-  std::unique_ptr<LocalVariable> idRightElevatorSolenoidEnergized[2];
-  std::unique_ptr<LocalVariable> idRightElevatorCommandedPosition[2];
-  std::unique_ptr<LocalVariable> idTHSActiveModeCommanded[3];
-  std::unique_ptr<LocalVariable> idTHSCommandedPosition[3];
-  std::unique_ptr<LocalVariable> idYawDamperSolenoidEnergized[2];
-  std::unique_ptr<LocalVariable> idYawDamperCommandedPosition[2];
-  std::unique_ptr<LocalVariable> idRudderTrimActiveModeCommanded[2];
-  std::unique_ptr<LocalVariable> idRudderTrimCommandedPosition[2];
-  std::unique_ptr<LocalVariable> idRudderTravelLimitActiveModeCommanded[2];
-  std::unique_ptr<LocalVariable> idRudderTravelLimCommandedPosition[2];
+  std::unique_ptr<CachedLocalVariable> idLeftAileronSolenoidEnergized[2];
+  std::unique_ptr<CachedLocalVariable> idLeftAileronCommandedPosition[2];
+  std::unique_ptr<CachedLocalVariable> idRightAileronSolenoidEnergized[2];
+  std::unique_ptr<CachedLocalVariable> idRightAileronCommandedPosition[2];
+  std::unique_ptr<CachedLocalVariable> idLeftSpoilerCommandedPosition[5];
+  std::unique_ptr<CachedLocalVariable> idRightSpoilerCommandedPosition[5];
+  std::unique_ptr<CachedLocalVariable> idLeftElevatorSolenoidEnergized[2];
+  std::unique_ptr<CachedLocalVariable> idLeftElevatorCommandedPosition[2];
+  std::unique_ptr<CachedLocalVariable> idRightElevatorSolenoidEnergized[2];
+  std::unique_ptr<CachedLocalVariable> idRightElevatorCommandedPosition[2];
+  std::unique_ptr<CachedLocalVariable> idTHSActiveModeCommanded[3];
+  std::unique_ptr<CachedLocalVariable> idTHSCommandedPosition[3];
+  std::unique_ptr<CachedLocalVariable> idYawDamperSolenoidEnergized[2];
+  std::unique_ptr<CachedLocalVariable> idYawDamperCommandedPosition[2];
+  std::unique_ptr<CachedLocalVariable> idRudderTrimActiveModeCommanded[2];
+  std::unique_ptr<CachedLocalVariable> idRudderTrimCommandedPosition[2];
+  std::unique_ptr<CachedLocalVariable> idRudderTravelLimitActiveModeCommanded[2];
+  std::unique_ptr<CachedLocalVariable> idRudderTravelLimCommandedPosition[2];
 
   // FAC discrete input Lvars
-  std::unique_ptr<LocalVariable> idFacPushbuttonPressed[2];
+  std::unique_ptr<CachedLocalVariable> idFacPushbuttonPressed[2];
   // FAC discrete output Lvars
-  std::unique_ptr<LocalVariable> idFacHealthy[2];
-
-  std::unique_ptr<LocalVariable> idFacDiscreteWord1[2];
-  std::unique_ptr<LocalVariable> idFacGammaA[2];
-  std::unique_ptr<LocalVariable> idFacGammaT[2];
-  std::unique_ptr<LocalVariable> idFacWeight[2];
-  std::unique_ptr<LocalVariable> idFacCenterOfGravity[2];
-  std::unique_ptr<LocalVariable> idFacSideslipTarget[2];
-  std::unique_ptr<LocalVariable> idFacSlatAngle[2];
-  std::unique_ptr<LocalVariable> idFacFlapAngle[2];
-  std::unique_ptr<LocalVariable> idFacDiscreteWord2[2];
-  std::unique_ptr<LocalVariable> idFacRudderTravelLimitCommand[2];
-  std::unique_ptr<LocalVariable> idFacDeltaRYawDamperVoted[2];
-  std::unique_ptr<LocalVariable> idFacEstimatedSideslip[2];
-  std::unique_ptr<LocalVariable> idFacVAlphaLim[2];
-  std::unique_ptr<LocalVariable> idFacVLs[2];
-  std::unique_ptr<LocalVariable> idFacVStall[2];
-  std::unique_ptr<LocalVariable> idFacVAlphaProt[2];
-  std::unique_ptr<LocalVariable> idFacVStallWarn[2];
-  std::unique_ptr<LocalVariable> idFacSpeedTrend[2];
-  std::unique_ptr<LocalVariable> idFacV3[2];
-  std::unique_ptr<LocalVariable> idFacV4[2];
-  std::unique_ptr<LocalVariable> idFacVMan[2];
-  std::unique_ptr<LocalVariable> idFacVMax[2];
-  std::unique_ptr<LocalVariable> idFacVFeNext[2];
-  std::unique_ptr<LocalVariable> idFacDiscreteWord3[2];
-  std::unique_ptr<LocalVariable> idFacDiscreteWord4[2];
-  std::unique_ptr<LocalVariable> idFacDiscreteWord5[2];
-  std::unique_ptr<LocalVariable> idFacDeltaRRudderTrim[2];
-  std::unique_ptr<LocalVariable> idFacRudderTrimPos[2];
-  std::unique_ptr<LocalVariable> idFacRudderTravelLimitReset[2];
-
-  std::unique_ptr<LocalVariable> idLeftAileronPosition;
-  std::unique_ptr<LocalVariable> idRightAileronPosition;
-  std::unique_ptr<LocalVariable> idLeftElevatorPosition;
-  std::unique_ptr<LocalVariable> idRightElevatorPosition;
-
-  std::unique_ptr<LocalVariable> idRudderTrimPosition;
-  std::unique_ptr<LocalVariable> idRudderTravelLimiterPosition;
-
-  std::unique_ptr<LocalVariable> idLeftSpoilerPosition[5];
-  std::unique_ptr<LocalVariable> idRightSpoilerPosition[5];
-
-  std::unique_ptr<LocalVariable> idElecDcBus2Powered;
-  std::unique_ptr<LocalVariable> idElecDcEssShedBusPowered;
-  std::unique_ptr<LocalVariable> idElecDcEssBusPowered;
-  std::unique_ptr<LocalVariable> idElecBat1HotBusPowered;
-  std::unique_ptr<LocalVariable> idElecBat2HotBusPowered;
-
-  std::unique_ptr<LocalVariable> idElecBtc1Closed;
-  std::unique_ptr<LocalVariable> idElecBtc2Closed;
-  std::unique_ptr<LocalVariable> idElecDcBatToDc2ContactorClosed;
-
-  std::unique_ptr<LocalVariable> idHydYellowSystemPressure;
-  std::unique_ptr<LocalVariable> idHydGreenSystemPressure;
-  std::unique_ptr<LocalVariable> idHydBlueSystemPressure;
-  std::unique_ptr<LocalVariable> idHydYellowPressurised;
-  std::unique_ptr<LocalVariable> idHydGreenPressurised;
-  std::unique_ptr<LocalVariable> idHydBluePressurised;
-
-  std::unique_ptr<LocalVariable> idCaptPriorityButtonPressed;
-  std::unique_ptr<LocalVariable> idFoPriorityButtonPressed;
-
-  std::unique_ptr<LocalVariable> idAttHdgSwtgKnob;
-  std::unique_ptr<LocalVariable> idAirDataSwtgKnob;
+  std::unique_ptr<CachedLocalVariable> idFacHealthy[2];
+
+  std::unique_ptr<CachedLocalVariable> idFacDiscreteWord1[2];
+  std::unique_ptr<CachedLocalVariable> idFacGammaA[2];
+  std::unique_ptr<CachedLocalVariable> idFacGammaT[2];
+  std::unique_ptr<CachedLocalVariable> idFacWeight[2];
+  std::unique_ptr<CachedLocalVariable> idFacCenterOfGravity[2];
+  std::unique_ptr<CachedLocalVariable> idFacSideslipTarget[2];
+  std::unique_ptr<CachedLocalVariable> idFacSlatAngle[2];
+  std::unique_ptr<CachedLocalVariable> idFacFlapAngle[2];
+  std::unique_ptr<CachedLocalVariable> idFacDiscreteWord2[2];
+  std::unique_ptr<CachedLocalVariable> idFacRudderTravelLimitCommand[2];
+  std::unique_ptr<CachedLocalVariable> idFacDeltaRYawDamperVoted[2];
+  std::unique_ptr<CachedLocalVariable> idFacEstimatedSideslip[2];
+  std::unique_ptr<CachedLocalVariable> idFacVAlphaLim[2];
+  std::unique_ptr<CachedLocalVariable> idFacVLs[2];
+  std::unique_ptr<CachedLocalVariable> idFacVStall[2];
+  std::unique_ptr<CachedLocalVariable> idFacVAlphaProt[2];
+  std::unique_ptr<CachedLocalVariable> idFacVStallWarn[2];
+  std::unique_ptr<CachedLocalVariable> idFacSpeedTrend[2];
+  std::unique_ptr<CachedLocalVariable> idFacV3[2];
+  std::unique_ptr<CachedLocalVariable> idFacV4[2];
+  std::unique_ptr<CachedLocalVariable> idFacVMan[2];
+  std::unique_ptr<CachedLocalVariable> idFacVMax[2];
+  std::unique_ptr<CachedLocalVariable> idFacVFeNext[2];
+  std::unique_ptr<CachedLocalVariable> idFacDiscreteWord3[2];
+  std::unique_ptr<CachedLocalVariable> idFacDiscreteWord4[2];
+  std::unique_ptr<CachedLocalVariable> idFacDiscreteWord5[2];
+  std::unique_ptr<CachedLocalVariable> idFacDeltaRRudderTrim[2];
+  std::unique_ptr<CachedLocalVariable> idFacRudderTrimPos[2];
+  std::unique_ptr<CachedLocalVariable> idFacRudderTravelLimitReset[2];
+
+  std::unique_ptr<CachedLocalVariable> idLeftAileronPosition;
+  std::unique_ptr<CachedLocalVariable> idRightAileronPosition;
+  std::unique_ptr<CachedLocalVariable> idLeftElevatorPosition;
+  std::unique_ptr<CachedLocalVariable> idRightElevatorPosition;
+
+  std::unique_ptr<CachedLocalVariable> idRudderTrimPosition;
+  std::unique_ptr<CachedLocalVariable> idRudderTravelLimiterPosition;
+
+  std::unique_ptr<CachedLocalVariable> idLeftSpoilerPosition[5];
+  std::unique_ptr<CachedLocalVariable> idRightSpoilerPosition[5];
+
+  std::unique_ptr<CachedLocalVariable> idElecDcBus2Powered;
+  std::unique_ptr<CachedLocalVariable> idElecDcEssShedBusPowered;
+  std::unique_ptr<CachedLocalVariable> idElecDcEssBusPowered;
+  std::unique_ptr<CachedLocalVariable> idElecBat1HotBusPowered;
+  std::unique_ptr<CachedLocalVariable> idElecBat2HotBusPowered;
+
+  std::unique_ptr<CachedLocalVariable> idElecBtc1Closed;
+  std::unique_ptr<CachedLocalVariable> idElecBtc2Closed;
+  std::unique_ptr<CachedLocalVariable> idElecDcBatToDc2ContactorClosed;
+
+  std::unique_ptr<CachedLocalVariable> idHydYellowSystemPressure;
+  std::unique_ptr<CachedLocalVariable> idHydGreenSystemPressure;
+  std::unique_ptr<CachedLocalVariable> idHydBlueSystemPressure;
+  std::unique_ptr<CachedLocalVariable> idHydYellowPressurised;
+  std::unique_ptr<CachedLocalVariable> idHydGreenPressurised;
+  std::unique_ptr<CachedLocalVariable> idHydBluePressurised;
+
+  std::unique_ptr<CachedLocalVariable> idCaptPriorityButtonPressed;
+  std::unique_ptr<CachedLocalVariable> idFoPriorityButtonPressed;
+
+  std::unique_ptr<CachedLocalVariable> idAttHdgSwtgKnob;
+  std::unique_ptr<CachedLocalVariable> idAirDataSwtgKnob;
 
   // FMGC legacy/shim Lvars
-  std::unique_ptr<LocalVariable> idAutopilotShimNosewheelDemand;
-  std::unique_ptr<LocalVariable> idAutopilotShimFmaLateralMode;
-  std::unique_ptr<LocalVariable> idAutopilotShimFmaLateralArmed;
-  std::unique_ptr<LocalVariable> idAutopilotShimFmaVerticalMode;
-  std::unique_ptr<LocalVariable> idAutopilotShimFmaVerticalArmed;
-  std::unique_ptr<LocalVariable> idAutopilotShimFmaExpediteModeActive;
-  std::unique_ptr<LocalVariable> idAutopilotShimFmaTripleClick;
-  std::unique_ptr<LocalVariable> idAutopilotShimAutolandWarning;
-  std::unique_ptr<LocalVariable> idAutopilotShimActiveAny;
-  std::unique_ptr<LocalVariable> idAutopilotShimActive_1;
-  std::unique_ptr<LocalVariable> idAutopilotShimActive_2;
-  std::unique_ptr<LocalVariable> idAutopilotShim_H_dot_radio;
-  std::unique_ptr<LocalVariable> idAutothrustShimStatus;
-  std::unique_ptr<LocalVariable> idAutothrustShimMode;
-  std::unique_ptr<LocalVariable> idAutothrustShimModeMessage;
+  std::unique_ptr<CachedLocalVariable> idAutopilotShimNosewheelDemand;
+  std::unique_ptr<CachedLocalVariable> idAutopilotShimFmaLateralMode;
+  std::unique_ptr<CachedLocalVariable> idAutopilotShimFmaLateralArmed;
+  std::unique_ptr<CachedLocalVariable> idAutopilotShimFmaVerticalMode;
+  std::unique_ptr<CachedLocalVariable> idAutopilotShimFmaVerticalArmed;
+  std::unique_ptr<CachedLocalVariable> idAutopilotShimFmaExpediteModeActive;
+  std::unique_ptr<CachedLocalVariable> idAutopilotShimFmaTripleClick;
+  std::unique_ptr<CachedLocalVariable> idAutopilotShimAutolandWarning;
+  std::unique_ptr<CachedLocalVariable> idAutopilotShimActiveAny;
+  std::unique_ptr<CachedLocalVariable> idAutopilotShimActive_1;
+  std::unique_ptr<CachedLocalVariable> idAutopilotShimActive_2;
+  std::unique_ptr<CachedLocalVariable> idAutopilotShim_H_dot_radio;
+  std::unique_ptr<CachedLocalVariable> idAutothrustShimStatus;
+  std::unique_ptr<CachedLocalVariable> idAutothrustShimMode;
+  std::unique_ptr<CachedLocalVariable> idAutothrustShimModeMessage;
 
   // FMGC discrete output Lvars
-  std::unique_ptr<LocalVariable> idFmgcHealthy[2];
-  std::unique_ptr<LocalVariable> idFmgcAthrEngaged[2];
-  std::unique_ptr<LocalVariable> idFmgcFdEngaged[2];
-  std::unique_ptr<LocalVariable> idFmgcApEngaged[2];
-  std::unique_ptr<LocalVariable> idFmgcIlsTuneInhibit[2];
+  std::unique_ptr<CachedLocalVariable> idFmgcHealthy[2];
+  std::unique_ptr<CachedLocalVariable> idFmgcAthrEngaged[2];
+  std::unique_ptr<CachedLocalVariable> idFmgcFdEngaged[2];
+  std::unique_ptr<CachedLocalVariable> idFmgcApEngaged[2];
+  std::unique_ptr<CachedLocalVariable> idFmgcIlsTuneInhibit[2];
 
   // FMGC A Bus output Lvars
-  std::unique_ptr<LocalVariable> idFmgcABusPfdSelectedSpeed[2];
-  std::unique_ptr<LocalVariable> idFmgcABusPreselMach[2];
-  std::unique_ptr<LocalVariable> idFmgcABusPreselSpeed[2];
-  std::unique_ptr<LocalVariable> idFmgcABusRwyHdgMemo[2];
-  std::unique_ptr<LocalVariable> idFmgcABusRollFdCommand[2];
-  std::unique_ptr<LocalVariable> idFmgcABusPitchFdCommand[2];
-  std::unique_ptr<LocalVariable> idFmgcABusYawFdCommand[2];
-  std::unique_ptr<LocalVariable> idFmgcABusDiscreteWord5[2];
-  std::unique_ptr<LocalVariable> idFmgcABusDiscreteWord4[2];
-  std::unique_ptr<LocalVariable> idFmgcABusFmAltConstraint[2];
-  std::unique_ptr<LocalVariable> idFmgcABusAtsDiscreteWord[2];
-  std::unique_ptr<LocalVariable> idFmgcABusAtsFmaDiscreteWord[2];
-  std::unique_ptr<LocalVariable> idFmgcABusDiscreteWord3[2];
-  std::unique_ptr<LocalVariable> idFmgcABusDiscreteWord1[2];
-  std::unique_ptr<LocalVariable> idFmgcABusDiscreteWord2[2];
-  std::unique_ptr<LocalVariable> idFmgcABusDiscreteWord6[2];
-  std::unique_ptr<LocalVariable> idFmgcABusDiscreteWord7[2];
-  std::unique_ptr<LocalVariable> idFmgcABusSpeedMarginHigh[2];
-  std::unique_ptr<LocalVariable> idFmgcABusSpeedMarginLow[2];
-
-  std::unique_ptr<LocalVariable> idStickLockActive;
-
-  std::unique_ptr<LocalVariable> idApInstinctiveDisconnect;
-  std::unique_ptr<LocalVariable> idAthrInstinctiveDisconnect;
-
-  std::unique_ptr<LocalVariable> idLightsTest;
+  std::unique_ptr<CachedLocalVariable> idFmgcABusPfdSelectedSpeed[2];
+  std::unique_ptr<CachedLocalVariable> idFmgcABusPreselMach[2];
+  std::unique_ptr<CachedLocalVariable> idFmgcABusPreselSpeed[2];
+  std::unique_ptr<CachedLocalVariable> idFmgcABusRwyHdgMemo[2];
+  std::unique_ptr<CachedLocalVariable> idFmgcABusRollFdCommand[2];
+  std::unique_ptr<CachedLocalVariable> idFmgcABusPitchFdCommand[2];
+  std::unique_ptr<CachedLocalVariable> idFmgcABusYawFdCommand[2];
+  std::unique_ptr<CachedLocalVariable> idFmgcABusDiscreteWord5[2];
+  std::unique_ptr<CachedLocalVariable> idFmgcABusDiscreteWord4[2];
+  std::unique_ptr<CachedLocalVariable> idFmgcABusFmAltConstraint[2];
+  std::unique_ptr<CachedLocalVariable> idFmgcABusAtsDiscreteWord[2];
+  std::unique_ptr<CachedLocalVariable> idFmgcABusAtsFmaDiscreteWord[2];
+  std::unique_ptr<CachedLocalVariable> idFmgcABusDiscreteWord3[2];
+  std::unique_ptr<CachedLocalVariable> idFmgcABusDiscreteWord1[2];
+  std::unique_ptr<CachedLocalVariable> idFmgcABusDiscreteWord2[2];
+  std::unique_ptr<CachedLocalVariable> idFmgcABusDiscreteWord6[2];
+  std::unique_ptr<CachedLocalVariable> idFmgcABusDiscreteWord7[2];
+  std::unique_ptr<CachedLocalVariable> idFmgcABusSpeedMarginHigh[2];
+  std::unique_ptr<CachedLocalVariable> idFmgcABusSpeedMarginLow[2];
+
+  std::unique_ptr<CachedLocalVariable> idStickLockActive;
+
+  std::unique_ptr<CachedLocalVariable> idApInstinctiveDisconnect;
+  std::unique_ptr<CachedLocalVariable> idAthrInstinctiveDisconnect;
+
+  std::unique_ptr<CachedLocalVariable> idLightsTest;
 
   // These variables are legacy variables and are driven by a shim from the new FCU to the old vars.
-  std::unique_ptr<LocalVariable> idFcuShimLeftNavaid1Mode;
-  std::unique_ptr<LocalVariable> idFcuShimLeftNavaid2Mode;
-  std::unique_ptr<LocalVariable> idFcuShimLeftNdMode;
-  std::unique_ptr<LocalVariable> idFcuShimLeftNdRange;
-  std::unique_ptr<LocalVariable> idFcuShimLeftNdFilterOption;
-  std::unique_ptr<LocalVariable> idFcuShimLeftLsActive;
-  std::unique_ptr<LocalVariable> idFcuShimLeftBaroMode;
-  std::unique_ptr<LocalVariable> idFcuShimRightNavaid1Mode;
-  std::unique_ptr<LocalVariable> idFcuShimRightNavaid2Mode;
-  std::unique_ptr<LocalVariable> idFcuShimRightNdMode;
-  std::unique_ptr<LocalVariable> idFcuShimRightNdRange;
-  std::unique_ptr<LocalVariable> idFcuShimRightNdFilterOption;
-  std::unique_ptr<LocalVariable> idFcuShimRightLsActive;
-  std::unique_ptr<LocalVariable> idFcuShimRightBaroMode;
-
-  std::unique_ptr<LocalVariable> idFcuShimSpdDashes;
-  std::unique_ptr<LocalVariable> idFcuShimSpdDot;
-  std::unique_ptr<LocalVariable> idFcuShimSpdValue;
-  std::unique_ptr<LocalVariable> idFcuShimTrkFpaActive;
-  std::unique_ptr<LocalVariable> idFcuShimHdgValue1;
-  std::unique_ptr<LocalVariable> idFcuShimHdgValue2;
-  std::unique_ptr<LocalVariable> idFcuShimShowHdg;
-  std::unique_ptr<LocalVariable> idFcuShimHdgDashes;
-  std::unique_ptr<LocalVariable> idFcuShimHdgDot;
-  std::unique_ptr<LocalVariable> idFcuShimAltManaged;
-  std::unique_ptr<LocalVariable> idFcuShimVsValue;
-  std::unique_ptr<LocalVariable> idFcuShimFpaValue;
-  std::unique_ptr<LocalVariable> idFcuShimVsManaged;
-
-  std::unique_ptr<LocalVariable> idFcuSelectedHeading;
-  std::unique_ptr<LocalVariable> idFcuSelectedAltitude;
-  std::unique_ptr<LocalVariable> idFcuSelectedAirspeed;
-  std::unique_ptr<LocalVariable> idFcuSelectedVerticalSpeed;
-  std::unique_ptr<LocalVariable> idFcuSelectedTrack;
-  std::unique_ptr<LocalVariable> idFcuSelectedFpa;
-  std::unique_ptr<LocalVariable> idFcuAtsDiscreteWord;
-  std::unique_ptr<LocalVariable> idFcuAtsFmaDiscreteWord;
-  std::unique_ptr<LocalVariable> idFcuEisLeftDiscreteWord1;
-  std::unique_ptr<LocalVariable> idFcuEisLeftDiscreteWord2;
-  std::unique_ptr<LocalVariable> idFcuEisLeftBaro;
-  std::unique_ptr<LocalVariable> idFcuEisLeftBaroHpa;
-  std::unique_ptr<LocalVariable> idFcuEisRightDiscreteWord1;
-  std::unique_ptr<LocalVariable> idFcuEisRightDiscreteWord2;
-  std::unique_ptr<LocalVariable> idFcuEisRightBaro;
-  std::unique_ptr<LocalVariable> idFcuEisRightBaroHpa;
-  std::unique_ptr<LocalVariable> idFcuDiscreteWord1;
-  std::unique_ptr<LocalVariable> idFcuDiscreteWord2;
-
-  std::unique_ptr<LocalVariable> idFcuEisPanelEfisMode[2];
-  std::unique_ptr<LocalVariable> idFcuEisPanelEfisRange[2];
-  std::unique_ptr<LocalVariable> idFcuEisPanelNavaid1Mode[2];
-  std::unique_ptr<LocalVariable> idFcuEisPanelNavaid2Mode[2];
-  std::unique_ptr<LocalVariable> idFcuEisPanelBaroIsInhg[2];
-
-  std::unique_ptr<LocalVariable> idFcuEisPanelFdLightOn[2];
-  std::unique_ptr<LocalVariable> idFcuEisPanelLsLightOn[2];
-  std::unique_ptr<LocalVariable> idFcuEisPanelCstrLightOn[2];
-  std::unique_ptr<LocalVariable> idFcuEisPanelWptLightOn[2];
-  std::unique_ptr<LocalVariable> idFcuEisPanelVordLightOn[2];
-  std::unique_ptr<LocalVariable> idFcuEisPanelNdbLightOn[2];
-  std::unique_ptr<LocalVariable> idFcuEisPanelArptLightOn[2];
-  std::unique_ptr<LocalVariable> idFcuEisDisplayBaroValueMode[2];
-  std::unique_ptr<LocalVariable> idFcuEisDisplayBaroValue[2];
-  std::unique_ptr<LocalVariable> idFcuEisDisplayBaroMode[2];
-
-  std::unique_ptr<LocalVariable> idFcuAfsPanelAltIncrement1000;
-
-  std::unique_ptr<LocalVariable> idFcuAfsPanelAp1LightOn;
-  std::unique_ptr<LocalVariable> idFcuAfsPanelAp2LightOn;
-  std::unique_ptr<LocalVariable> idFcuAfsPanelAthrLightOn;
-  std::unique_ptr<LocalVariable> idFcuAfsPanelLocLightOn;
-  std::unique_ptr<LocalVariable> idFcuAfsPanelExpedLightOn;
-  std::unique_ptr<LocalVariable> idFcuAfsPanelApprLightOn;
-  std::unique_ptr<LocalVariable> idFcuAfsDisplayTrkFpaMode;
-  std::unique_ptr<LocalVariable> idFcuAfsDisplayMachMode;
-  std::unique_ptr<LocalVariable> idFcuAfsDisplaySpdMachValue;
-  std::unique_ptr<LocalVariable> idFcuAfsDisplaySpdMachDashes;
-  std::unique_ptr<LocalVariable> idFcuAfsDisplaySpdMachManaged;
-  std::unique_ptr<LocalVariable> idFcuAfsDisplayHdgTrkValue;
-  std::unique_ptr<LocalVariable> idFcuAfsDisplayHdgTrkDashes;
-  std::unique_ptr<LocalVariable> idFcuAfsDisplayHdgTrkManaged;
-  std::unique_ptr<LocalVariable> idFcuAfsDisplayAltValue;
-  std::unique_ptr<LocalVariable> idFcuAfsDisplayLvlChManaged;
-  std::unique_ptr<LocalVariable> idFcuAfsDisplayVsFpaValue;
-  std::unique_ptr<LocalVariable> idFcuAfsDisplayVsFpaDashes;
-
-  std::unique_ptr<LocalVariable> idFcuHealthy;
-
-  std::unique_ptr<LocalVariable> idEcuMaintenanceWord6[2];
+  std::unique_ptr<CachedLocalVariable> idFcuShimLeftNavaid1Mode;
+  std::unique_ptr<CachedLocalVariable> idFcuShimLeftNavaid2Mode;
+  std::unique_ptr<CachedLocalVariable> idFcuShimLeftNdMode;
+  std::unique_ptr<CachedLocalVariable> idFcuShimLeftNdRange;
+  std::unique_ptr<CachedLocalVariable> idFcuShimLeftNdFilterOption;
+  std::unique_ptr<CachedLocalVariable> idFcuShimLeftLsActive;
+  std::unique_ptr<CachedLocalVariable> idFcuShimLeftBaroMode;
+  std::unique_ptr<CachedLocalVariable> idFcuShimRightNavaid1Mode;
+  std::unique_ptr<CachedLocalVariable> idFcuShimRightNavaid2Mode;
+  std::unique_ptr<CachedLocalVariable> idFcuShimRightNdMode;
+  std::unique_ptr<CachedLocalVariable> idFcuShimRightNdRange;
+  std::unique_ptr<CachedLocalVariable> idFcuShimRightNdFilterOption;
+  std::unique_ptr<CachedLocalVariable> idFcuShimRightLsActive;
+  std::unique_ptr<CachedLocalVariable> idFcuShimRightBaroMode;
+
+  std::unique_ptr<CachedLocalVariable> idFcuShimSpdDashes;
+  std::unique_ptr<CachedLocalVariable> idFcuShimSpdDot;
+  std::unique_ptr<CachedLocalVariable> idFcuShimSpdValue;
+  std::unique_ptr<CachedLocalVariable> idFcuShimTrkFpaActive;
+  std::unique_ptr<CachedLocalVariable> idFcuShimHdgValue1;
+  std::unique_ptr<CachedLocalVariable> idFcuShimHdgValue2;
+  std::unique_ptr<CachedLocalVariable> idFcuShimShowHdg;
+  std::unique_ptr<CachedLocalVariable> idFcuShimHdgDashes;
+  std::unique_ptr<CachedLocalVariable> idFcuShimHdgDot;
+  std::unique_ptr<CachedLocalVariable> idFcuShimAltManaged;
+  std::unique_ptr<CachedLocalVariable> idFcuShimVsValue;
+  std::unique_ptr<CachedLocalVariable> idFcuShimFpaValue;
+  std::unique_ptr<CachedLocalVariable> idFcuShimVsManaged;
+
+  std::unique_ptr<CachedLocalVariable> idFcuSelectedHeading;
+  std::unique_ptr<CachedLocalVariable> idFcuSelectedAltitude;
+  std::unique_ptr<CachedLocalVariable> idFcuSelectedAirspeed;
+  std::unique_ptr<CachedLocalVariable> idFcuSelectedVerticalSpeed;
+  std::unique_ptr<CachedLocalVariable> idFcuSelectedTrack;
+  std::unique_ptr<CachedLocalVariable> idFcuSelectedFpa;
+  std::unique_ptr<CachedLocalVariable> idFcuAtsDiscreteWord;
+  std::unique_ptr<CachedLocalVariable> idFcuAtsFmaDiscreteWord;
+  std::unique_ptr<CachedLocalVariable> idFcuEisLeftDiscreteWord1;
+  std::unique_ptr<CachedLocalVariable> idFcuEisLeftDiscreteWord2;
+  std::unique_ptr<CachedLocalVariable> idFcuEisLeftBaro;
+  std::unique_ptr<CachedLocalVariable> idFcuEisLeftBaroHpa;
+  std::unique_ptr<CachedLocalVariable> idFcuEisRightDiscreteWord1;
+  std::unique_ptr<CachedLocalVariable> idFcuEisRightDiscreteWord2;
+  std::unique_ptr<CachedLocalVariable> idFcuEisRightBaro;
+  std::unique_ptr<CachedLocalVariable> idFcuEisRightBaroHpa;
+  std::unique_ptr<CachedLocalVariable> idFcuDiscreteWord1;
+  std::unique_ptr<CachedLocalVariable> idFcuDiscreteWord2;
+
+  std::unique_ptr<CachedLocalVariable> idFcuEisPanelEfisMode[2];
+  std::unique_ptr<CachedLocalVariable> idFcuEisPanelEfisRange[2];
+  std::unique_ptr<CachedLocalVariable> idFcuEisPanelNavaid1Mode[2];
+  std::unique_ptr<CachedLocalVariable> idFcuEisPanelNavaid2Mode[2];
+  std::unique_ptr<CachedLocalVariable> idFcuEisPanelBaroIsInhg[2];
+
+  std::unique_ptr<CachedLocalVariable> idFcuEisPanelFdLightOn[2];
+  std::unique_ptr<CachedLocalVariable> idFcuEisPanelLsLightOn[2];
+  std::unique_ptr<CachedLocalVariable> idFcuEisPanelCstrLightOn[2];
+  std::unique_ptr<CachedLocalVariable> idFcuEisPanelWptLightOn[2];
+  std::unique_ptr<CachedLocalVariable> idFcuEisPanelVordLightOn[2];
+  std::unique_ptr<CachedLocalVariable> idFcuEisPanelNdbLightOn[2];
+  std::unique_ptr<CachedLocalVariable> idFcuEisPanelArptLightOn[2];
+  std::unique_ptr<CachedLocalVariable> idFcuEisDisplayBaroValueMode[2];
+  std::unique_ptr<CachedLocalVariable> idFcuEisDisplayBaroValue[2];
+  std::unique_ptr<CachedLocalVariable> idFcuEisDisplayBaroMode[2];
+
+  std::unique_ptr<CachedLocalVariable> idFcuAfsPanelAltIncrement1000;
+
+  std::unique_ptr<CachedLocalVariable> idFcuAfsPanelAp1LightOn;
+  std::unique_ptr<CachedLocalVariable> idFcuAfsPanelAp2LightOn;
+  std::unique_ptr<CachedLocalVariable> idFcuAfsPanelAthrLightOn;
+  std::unique_ptr<CachedLocalVariable> idFcuAfsPanelLocLightOn;
+  std::unique_ptr<CachedLocalVariable> idFcuAfsPanelExpedLightOn;
+  std::unique_ptr<CachedLocalVariable> idFcuAfsPanelApprLightOn;
+  std::unique_ptr<CachedLocalVariable> idFcuAfsDisplayTrkFpaMode;
+  std::unique_ptr<CachedLocalVariable> idFcuAfsDisplayMachMode;
+  std::unique_ptr<CachedLocalVariable> idFcuAfsDisplaySpdMachValue;
+  std::unique_ptr<CachedLocalVariable> idFcuAfsDisplaySpdMachDashes;
+  std::unique_ptr<CachedLocalVariable> idFcuAfsDisplaySpdMachManaged;
+  std::unique_ptr<CachedLocalVariable> idFcuAfsDisplayHdgTrkValue;
+  std::unique_ptr<CachedLocalVariable> idFcuAfsDisplayHdgTrkDashes;
+  std::unique_ptr<CachedLocalVariable> idFcuAfsDisplayHdgTrkManaged;
+  std::unique_ptr<CachedLocalVariable> idFcuAfsDisplayAltValue;
+  std::unique_ptr<CachedLocalVariable> idFcuAfsDisplayLvlChManaged;
+  std::unique_ptr<CachedLocalVariable> idFcuAfsDisplayVsFpaValue;
+  std::unique_ptr<CachedLocalVariable> idFcuAfsDisplayVsFpaDashes;
+
+  std::unique_ptr<CachedLocalVariable> idFcuHealthy;
+
+  std::unique_ptr<CachedLocalVariable> idEcuMaintenanceWord6[2];
 
   void loadConfiguration();
+
+  /**
+   * @brief Applies the values that can change while the flight is running.
+   * @param reload only applies the values that differ from the last applied configuration.
+   */
+  void applyConfiguration(const mINI::INIStructure& iniStructure, bool reload);
+
+  /**
+   * @brief Reloads the configuration when the file changed.
+   */
+  bool updateConfiguration(double sampleTime);
+
+  void printConfigurationChanges(const mINI::INIStructure& iniStructure) const;
   void setupLocalVariables();
 
+  /**
+   * @brief Points the consumers of the bus outputs to the computers, or to the client data of a disabled computer.
+   *
+   * The outputs stay in place and are only copied into the inputs of the models that consume them.
+   */
+  void wireBusOutputs();
+
   bool handleFcuInitialization(double sampleTime);
 
   bool readDataAndLocalVariables(double sampleTime);
 
+  bool updateStageTimings();
+
+  /**
+   * @brief Writes the changed local variables to the simulator, measured as a stage of the update.
+   */
+  void flushLocalVariables();
+
+  /**
+   * @brief Runs the stage when it is due at its configured rate and measures it.
+   * @param function called with the time accumulated since the last run of the stage.
+   */
+  template <typename Function>
+  bool runStage(int stage, double sampleTime, Function function) {
+    return stageScheduler.run(stage, sampleTime, [&](double stageSampleTime) {
+      return stageTimings.measure(stage, [&] { return function(stageSampleTime); });
+    });
+  }
+
+  double getMaximumAcceptableSampleTime() const;
   bool updatePerformanceMonitoring(double sampleTime);
   bool handleSimulationRate(double sampleTime);
 
@@ -694,6 +837,11 @@ class FlyByWireInterface {
 
   bool updateElac(double sampleTime, int elacIndex);
 
+  /**
+   * @brief Steps the ELAC with the sub-steps of the fixed step, the inputs are interpolated from the previous frame.
+   */
+  void updateElacFixedStep(int elacIndex, bool faultActive, bool isPowered);
+
   bool updateSec(double sampleTime, int secIndex);
 
   bool updateFcdc(double sampleTime, int fcdcIndex);
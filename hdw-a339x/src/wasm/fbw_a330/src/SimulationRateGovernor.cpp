@@ -0,0 +1,126 @@
+#include "SimulationRateGovernor.h"
+
+#include <algorithm>
+#include <cmath>
+
+SimulationRateGovernor::ScopedTimer::ScopedTimer(SimulationRateGovernor& governor)
+    : governor(governor), start(std::chrono::steady_clock::now()) {}
+
+SimulationRateGovernor::ScopedTimer::~ScopedTimer() {
+  governor.recordComputeTime(std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+}
+
+void SimulationRateGovernor::setRecoveryEnabled(bool enabled) {
+  recoveryEnabled = enabled;
+}
+
+void SimulationRateGovernor::setRecoveryDelay(double delay) {
+  recoveryDelay = std::max(0.0, delay);
+}
+
+void SimulationRateGovernor::recordComputeTime(double computeTime) {
+  lastComputeTime = computeTime;
+}
+
+SimulationRateGovernor::Decision SimulationRateGovernor::update(const Inputs& inputs) {
+  double rate = inputs.simulationRate;
+
+  // a change of the rate that was not commanded by the governor is a request of the user
+  if (!initialized || (rate != previousSimulationRate && rate != commandedSimulationRate)) {
+    initialized = true;
+    requestedSimulationRate = rate;
+    timeRecoveryPossible = 0;
+  }
+  if (rate != previousSimulationRate) {
+    timeSinceChange = 0;
+  }
+  previousSimulationRate = rate;
+  commandedSimulationRate = 0;
+  timeSinceChange += inputs.frameTime;
+
+  // peaks with fast attack and slow decay
+  double decay = std::min(1.0, inputs.frameTime / PEAK_DECAY_TIME);
+  peakFrameTime = inputs.frameTime > peakFrameTime ? inputs.frameTime : peakFrameTime + decay * (inputs.frameTime - peakFrameTime);
+  peakComputeTime =
+      lastComputeTime > peakComputeTime ? lastComputeTime : peakComputeTime + decay * (lastComputeTime - peakComputeTime);
+
+  // highest rate in steps of two that keeps the predicted sample time acceptable, higher rates than the current one
+  // need the margin
+  safeSimulationRate = std::min(std::max(rate, 1.0), inputs.maximumSimulationRate);
+  while (safeSimulationRate > 1 &&
+         predictSampleTime(safeSimulationRate, rate, inputs.computeTimeScalesWithRate) > inputs.maximumAcceptableSampleTime) {
+    safeSimulationRate = std::max(1.0, safeSimulationRate / 2);
+  }
+  while (safeSimulationRate >= rate && safeSimulationRate * 2 <= inputs.maximumSimulationRate &&
+         predictSampleTime(safeSimulationRate * 2, rate, inputs.computeTimeScalesWithRate) <=
+             RECOVERY_MARGIN * inputs.maximumAcceptableSampleTime) {
+    safeSimulationRate *= 2;
+  }
+
+  // decrease
+  Reason decreaseReason = Reason::None;
+  if (rate > inputs.maximumSimulationRate) {
+    decreaseReason = Reason::MaximumExceeded;
+  } else if (rate > 1 && inputs.reductionEnabled && inputs.performanceIssue) {
+    decreaseReason = Reason::PerformanceIssue;
+  } else if (rate > 1 && inputs.reductionEnabled && inputs.abnormalSituation) {
+    decreaseReason = Reason::AbnormalSituation;
+  } else if (rate > 1 && inputs.reductionEnabled && safeSimulationRate < rate && timeSinceChange >= PEAK_DECAY_TIME) {
+    // the peaks still contain frames of the previous rate right after a change
+    decreaseReason = Reason::SafeRateExceeded;
+  }
+  if (decreaseReason != Reason::None) {
+    reason = decreaseReason;
+    commandedSimulationRate = std::max(1.0, rate / 2);
+    timeRecoveryPossible = 0;
+    return Decision::Decrease;
+  }
+
+  // increase towards the requested rate
+  if (!recoveryEnabled || rate < 1 || rate >= requestedSimulationRate || rate * 2 > inputs.maximumSimulationRate) {
+    reason = Reason::None;
+    timeRecoveryPossible = 0;
+    return Decision::Hold;
+  }
+
+  if (inputs.performanceIssue || inputs.abnormalSituation || safeSimulationRate < rate * 2) {
+    reason = inputs.abnormalSituation ? Reason::AbnormalSituation : Reason::RecoveryLimitedByPerformance;
+    timeRecoveryPossible = 0;
+    return Decision::Hold;
+  }
+
+  timeRecoveryPossible += inputs.frameTime;
+  if (timeRecoveryPossible < recoveryDelay || timeSinceChange < recoveryDelay) {
+    reason = Reason::RecoveryPending;
+    return Decision::Hold;
+  }
+
+  reason = Reason::Recovered;
+  commandedSimulationRate = rate * 2;
+  timeRecoveryPossible = 0;
+  return Decision::Increase;
+}
+
+SimulationRateGovernor::Reason SimulationRateGovernor::getReason() const {
+  return reason;
+}
+
+double SimulationRateGovernor::getRequestedSimulationRate() const {
+  return requestedSimulationRate;
+}
+
+double SimulationRateGovernor::getSafeSimulationRate() const {
+  return safeSimulationRate;
+}
+
+double SimulationRateGovernor::predictSampleTime(double simulationRate,
+                                                 double currentSimulationRate,
+                                                 bool computeTimeScalesWithRate) const {
+  // the sample time of the laws is the real frame time scaled by the rate, the compute time of the module is part of the
+  // frame time and grows with the rate when the laws are sub-stepped
+  double frameTime = peakFrameTime;
+  if (computeTimeScalesWithRate && currentSimulationRate > 0) {
+    frameTime += peakComputeTime * (simulationRate / currentSimulationRate - 1);
+  }
+  return frameTime * simulationRate;
+}
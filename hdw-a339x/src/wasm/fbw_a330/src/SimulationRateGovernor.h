@@ -0,0 +1,113 @@
+#pragma once
+
+#include <chrono>
+
+/**
+ * @brief Chooses the simulation rate from the measured frame and compute times.
+ *
+ * The rate is halved immediately when it exceeds the maximum, on performance issues or in abnormal situations. It is
+ * also halved when the predicted sample time of the laws at the current rate exceeds the acceptable sample time, once
+ * the rate has been held long enough for the measurement to reflect it. After a reduction the rate is doubled again, up
+ * to the rate the user selected, once the predicted sample time at the doubled rate has stayed below the acceptable
+ * sample time with a margin for the recovery delay, the margin is the hysteresis between both. The frame time is tracked
+ * with a fast attack and a slow decay, so a single stutter delays the recovery instead of resetting it.
+ */
+class SimulationRateGovernor {
+ public:
+  enum class Decision {
+    Decrease = -1,
+    Hold = 0,
+    Increase = 1,
+  };
+
+  enum class Reason {
+    None = 0,
+    MaximumExceeded = 1,
+    PerformanceIssue = 2,
+    AbnormalSituation = 3,
+    Recovered = 4,
+    RecoveryPending = 5,
+    RecoveryLimitedByPerformance = 6,
+    SafeRateExceeded = 7,
+  };
+
+  struct Inputs {
+    // real time of the frame in s
+    double frameTime;
+    double simulationRate;
+    double maximumSimulationRate;
+    // largest sample time the laws accept in s
+    double maximumAcceptableSampleTime;
+    bool reductionEnabled;
+    bool performanceIssue;
+    bool abnormalSituation;
+    // the compute time grows with the simulation rate, e.g. when the laws run with a fixed step
+    bool computeTimeScalesWithRate;
+  };
+
+  /**
+   * @brief RAII timer, records the compute time of the module between construction and destruction.
+   */
+  class ScopedTimer {
+   public:
+    explicit ScopedTimer(SimulationRateGovernor& governor);
+    ~ScopedTimer();
+
+   private:
+    SimulationRateGovernor& governor;
+    std::chrono::steady_clock::time_point start;
+  };
+
+  void setRecoveryEnabled(bool enabled);
+
+  /**
+   * @brief Sets the time the conditions for an increase need to hold, and the minimum time between two changes, in s.
+   */
+  void setRecoveryDelay(double delay);
+
+  void recordComputeTime(double computeTime);
+
+  /**
+   * @brief Evaluates the rate for the current frame, a decision other than Hold is expected to be executed.
+   */
+  Decision update(const Inputs& inputs);
+
+  Reason getReason() const;
+
+  /**
+   * @brief Returns the rate the user selected, the governor does not increase the rate above it.
+   */
+  double getRequestedSimulationRate() const;
+
+  /**
+   * @brief Returns the highest rate the predicted sample time allows, limited by the maximum rate. It is below the
+   * current rate when the predicted sample time at the current rate exceeds the acceptable sample time.
+   */
+  double getSafeSimulationRate() const;
+
+ private:
+  // margin of the predicted sample time to the acceptable sample time that is required for an increase
+  static constexpr double RECOVERY_MARGIN = 0.8;
+  // time constant of the decay of the frame and compute time peaks in s
+  static constexpr double PEAK_DECAY_TIME = 5.0;
+
+  double predictSampleTime(double simulationRate, double currentSimulationRate, bool computeTimeScalesWithRate) const;
+
+  bool recoveryEnabled = true;
+  double recoveryDelay = 10.0;
+
+  bool initialized = false;
+  double requestedSimulationRate = 1;
+  double previousSimulationRate = 1;
+  double commandedSimulationRate = 0;
+  double safeSimulationRate = 1;
+
+  double peakFrameTime = 0;
+  double peakComputeTime = 0;
+  double lastComputeTime = 0;
+
+  double timeSinceChange = 0;
+  double timeRecoveryPossible = 0;
+
+  Reason reason = Reason::None;
+};
@@ -1,11 +1,13 @@
 #include "Elac.h"
 #include <iostream>
 
-Elac::Elac(bool isUnit1) : isUnit1(isUnit1) {
+Elac::Elac(bool isUnit1)
+    : modelInputs(elacComputer.getExternalInputs()), modelOutputs(elacComputer.getExternalOutputs().out), isUnit1(isUnit1) {
   elacComputer.initialize();
 }
 
-Elac::Elac(const Elac& obj) : isUnit1(obj.isUnit1) {
+Elac::Elac(const Elac& obj)
+    : modelInputs(elacComputer.getExternalInputs()), modelOutputs(elacComputer.getExternalOutputs().out), isUnit1(obj.isUnit1) {
   elacComputer.initialize();
 }
 
@@ -36,10 +38,11 @@ void Elac::update(double deltaTime, double simulationTime, bool faultActive, boo
   updateSelfTest(deltaTime);
   monitorSelf(faultActive);
 
-  elacComputer.setExternalInputs(&modelInputs);
-  modelInputs.in.sim_data.computer_running = monitoringHealthy;
+  // the model runs on the inputs in place and sees the monitoring state of the previous update
   elacComputer.step();
-  modelOutputs = elacComputer.getExternalOutputs().out;
+  modelInputs.in.sim_data.computer_running = monitoringHealthy;
+
+  writeOutputs();
 }
 
 // Perform self monitoring
@@ -90,72 +93,45 @@ void Elac::updateSelfTest(double deltaTime) {
   }
 }
 
-// Write the bus output data and return it.
-base_elac_out_bus Elac::getBusOutputs() {
-  base_elac_out_bus output = {};
-
+// Write the output data of the update, it is read by the other computers until the next update.
+void Elac::writeOutputs() {
   if (!monitoringHealthy) {
-    output.left_aileron_position_deg.SSM = Arinc429SignStatus::FailureWarning;
-    output.right_aileron_position_deg.SSM = Arinc429SignStatus::FailureWarning;
-    output.left_elevator_position_deg.SSM = Arinc429SignStatus::FailureWarning;
-    output.right_elevator_position_deg.SSM = Arinc429SignStatus::FailureWarning;
-    output.ths_position_deg.SSM = Arinc429SignStatus::FailureWarning;
-    output.left_sidestick_pitch_command_deg.SSM = Arinc429SignStatus::FailureWarning;
-    output.right_sidestick_pitch_command_deg.SSM = Arinc429SignStatus::FailureWarning;
-    output.left_sidestick_roll_command_deg.SSM = Arinc429SignStatus::FailureWarning;
-    output.right_sidestick_roll_command_deg.SSM = Arinc429SignStatus::FailureWarning;
-    output.rudder_pedal_position_deg.SSM = Arinc429SignStatus::FailureWarning;
-    output.aileron_command_deg.SSM = Arinc429SignStatus::FailureWarning;
-    output.roll_spoiler_command_deg.SSM = Arinc429SignStatus::FailureWarning;
-    output.yaw_damper_command_deg.SSM = Arinc429SignStatus::FailureWarning;
-    output.discrete_status_word_1.SSM = Arinc429SignStatus::FailureWarning;
-    output.discrete_status_word_2.SSM = Arinc429SignStatus::FailureWarning;
-
-    return output;
+    busOutputs = {};
+    busOutputs.left_aileron_position_deg.SSM = Arinc429SignStatus::FailureWarning;
+    busOutputs.right_aileron_position_deg.SSM = Arinc429SignStatus::FailureWarning;
+    busOutputs.left_elevator_position_deg.SSM = Arinc429SignStatus::FailureWarning;
+    busOutputs.right_elevator_position_deg.SSM = Arinc429SignStatus::FailureWarning;
+    busOutputs.ths_position_deg.SSM = Arinc429SignStatus::FailureWarning;
+    busOutputs.left_sidestick_pitch_command_deg.SSM = Arinc429SignStatus::FailureWarning;
+    busOutputs.right_sidestick_pitch_command_deg.SSM = Arinc429SignStatus::FailureWarning;
+    busOutputs.left_sidestick_roll_command_deg.SSM = Arinc429SignStatus::FailureWarning;
+    busOutputs.right_sidestick_roll_command_deg.SSM = Arinc429SignStatus::FailureWarning;
+    busOutputs.rudder_pedal_position_deg.SSM = Arinc429SignStatus::FailureWarning;
+    busOutputs.aileron_command_deg.SSM = Arinc429SignStatus::FailureWarning;
+    busOutputs.roll_spoiler_command_deg.SSM = Arinc429SignStatus::FailureWarning;
+    busOutputs.yaw_damper_command_deg.SSM = Arinc429SignStatus::FailureWarning;
+    busOutputs.discrete_status_word_1.SSM = Arinc429SignStatus::FailureWarning;
+    busOutputs.discrete_status_word_2.SSM = Arinc429SignStatus::FailureWarning;
+
+    // all discretes are false and all orders are zero
+    discreteOutputs = {};
+    analogOutputs = {};
+    return;
   }
 
-  output = modelOutputs.bus_outputs;
-
-  return output;
+  busOutputs = modelOutputs.bus_outputs;
+  discreteOutputs = modelOutputs.discrete_outputs;
+  analogOutputs = modelOutputs.analog_outputs;
 }
 
-// Write the discrete output data and return it.
-base_elac_discrete_outputs Elac::getDiscreteOutputs() {
-  base_elac_discrete_outputs output = {};
-
-  output.digital_output_validated = monitoringHealthy;
-  if (!monitoringHealthy) {
-    output.pitch_axis_ok = false;
-    output.left_aileron_ok = false;
-    output.right_aileron_ok = false;
-    output.ap_1_authorised = false;
-    output.ap_2_authorised = false;
-    output.left_aileron_active_mode = false;
-    output.right_aileron_active_mode = false;
-    output.left_elevator_damping_mode = false;
-    output.right_elevator_damping_mode = false;
-    output.ths_active = false;
-    output.batt_power_supply = false;
-  } else {
-    output = modelOutputs.discrete_outputs;
-  }
-
-  return output;
+const base_elac_out_bus& Elac::getBusOutputs() const {
+  return busOutputs;
 }
 
-// Write the analog outputs and return it.
-base_elac_analog_outputs Elac::getAnalogOutputs() {
-  base_elac_analog_outputs output = {};
-
-  if (!monitoringHealthy) {
-    output.left_elev_pos_order_deg = 0;
-    output.right_elev_pos_order_deg = 0;
-    output.ths_pos_order = 0;
-    output.left_aileron_pos_order = 0;
-    output.right_aileron_pos_order = 0;
-  } else {
-    output = modelOutputs.analog_outputs;
-  }
+const base_elac_discrete_outputs& Elac::getDiscreteOutputs() const {
+  return discreteOutputs;
+}
 
-  return output;
+const base_elac_analog_outputs& Elac::getAnalogOutputs() const {
+  return analogOutputs;
 }
@@ -10,6 +10,9 @@
 #include "../utils/SRFlipFlop.h"
 
 class Elac {
+  // Model, declared first as the references to its inputs and outputs are bound in the constructors
+  ElacComputer elacComputer;
+
  public:
   Elac(bool isUnit1);
 
@@ -17,13 +20,14 @@ class Elac {
 
   void update(double deltaTime, double simulationTime, bool faultActive, bool isPowered);
 
-  base_elac_out_bus getBusOutputs();
+  const base_elac_out_bus& getBusOutputs() const;
 
-  base_elac_discrete_outputs getDiscreteOutputs();
+  const base_elac_discrete_outputs& getDiscreteOutputs() const;
 
-  base_elac_analog_outputs getAnalogOutputs();
+  const base_elac_analog_outputs& getAnalogOutputs() const;
 
-  ElacComputer::ExternalInputs_ElacComputer_T modelInputs = {};
+  // inputs of the model, written in place before update()
+  ElacComputer::ExternalInputs_ElacComputer_T& modelInputs;
 
  private:
   void initSelfTests(bool viaPushButton);
@@ -38,9 +42,14 @@ class Elac {
 
   void updateSelfTest(double deltaTime);
 
-  // Model
-  ElacComputer elacComputer;
-  elac_outputs modelOutputs;
+  void writeOutputs();
+
+  const elac_outputs& modelOutputs;
+
+  // outputs of the last update, other computers are wired to them
+  base_elac_out_bus busOutputs = {};
+  base_elac_discrete_outputs discreteOutputs = {};
+  base_elac_analog_outputs analogOutputs = {};
 
   // Computer Self-monitoring vars
   bool monitoringHealthy;
@@ -1,10 +1,12 @@
 #include "Fac.h"
 
-Fac::Fac(bool isUnit1) : isUnit1(isUnit1) {
+Fac::Fac(bool isUnit1)
+    : modelInputs(facComputer.getExternalInputs()), modelOutputs(facComputer.getExternalOutputs().out), isUnit1(isUnit1) {
   facComputer.initialize();
 }
 
-Fac::Fac(const Fac& obj) : isUnit1(obj.isUnit1) {
+Fac::Fac(const Fac& obj)
+    : modelInputs(facComputer.getExternalInputs()), modelOutputs(facComputer.getExternalOutputs().out), isUnit1(obj.isUnit1) {
   facComputer.initialize();
 }
 
@@ -19,10 +21,10 @@ void Fac::update(double deltaTime, double simulationTime, bool faultActive, bool
   monitorSelf(faultActive);
 
   if (!shortPowerFailure) {
-    facComputer.setExternalInputs(&modelInputs);
     facComputer.step();
-    modelOutputs = facComputer.getExternalOutputs().out;
   }
+
+  writeOutputs();
 }
 
 // Software reset logic. After a reset, start self-test if on ground and engines off, and reset RAM.
@@ -82,74 +84,58 @@ void Fac::updateSelfTest(double deltaTime) {
   }
 }
 
-base_fac_bus Fac::getBusOutputs() {
-  base_fac_bus output = {};
-
+// Write the output data of the update, it stays valid until the next update.
+void Fac::writeOutputs() {
   if (!facHealthy) {
-    output.discrete_word_1.SSM = Arinc429SignStatus::FailureWarning;
-    output.discrete_word_2.SSM = Arinc429SignStatus::FailureWarning;
-    output.discrete_word_3.SSM = Arinc429SignStatus::FailureWarning;
-    output.discrete_word_4.SSM = Arinc429SignStatus::FailureWarning;
-    output.discrete_word_5.SSM = Arinc429SignStatus::FailureWarning;
-    output.gamma_a_deg.SSM = Arinc429SignStatus::FailureWarning;
-    output.gamma_t_deg.SSM = Arinc429SignStatus::FailureWarning;
-    output.total_weight_lbs.SSM = Arinc429SignStatus::FailureWarning;
-    output.center_of_gravity_pos_percent.SSM = Arinc429SignStatus::FailureWarning;
-    output.sideslip_target_deg.SSM = Arinc429SignStatus::FailureWarning;
-    output.fac_slat_angle_deg.SSM = Arinc429SignStatus::FailureWarning;
-    output.fac_flap_angle_deg.SSM = Arinc429SignStatus::FailureWarning;
-    output.rudder_travel_limit_command_deg.SSM = Arinc429SignStatus::FailureWarning;
-    output.delta_r_yaw_damper_deg.SSM = Arinc429SignStatus::FailureWarning;
-    output.estimated_sideslip_deg.SSM = Arinc429SignStatus::FailureWarning;
-    output.v_alpha_lim_kn.SSM = Arinc429SignStatus::FailureWarning;
-    output.v_ls_kn.SSM = Arinc429SignStatus::FailureWarning;
-    output.v_stall_kn.SSM = Arinc429SignStatus::FailureWarning;
-    output.v_alpha_prot_kn.SSM = Arinc429SignStatus::FailureWarning;
-    output.v_stall_warn_kn.SSM = Arinc429SignStatus::FailureWarning;
-    output.speed_trend_kn.SSM = Arinc429SignStatus::FailureWarning;
-    output.v_3_kn.SSM = Arinc429SignStatus::FailureWarning;
-    output.v_4_kn.SSM = Arinc429SignStatus::FailureWarning;
-    output.v_man_kn.SSM = Arinc429SignStatus::FailureWarning;
-    output.v_max_kn.SSM = Arinc429SignStatus::FailureWarning;
-    output.v_fe_next_kn.SSM = Arinc429SignStatus::FailureWarning;
-    output.delta_r_rudder_trim_deg.SSM = Arinc429SignStatus::FailureWarning;
-    output.rudder_trim_pos_deg.SSM = Arinc429SignStatus::FailureWarning;
-
-    return output;
+    busOutputs = {};
+    busOutputs.discrete_word_1.SSM = Arinc429SignStatus::FailureWarning;
+    busOutputs.discrete_word_2.SSM = Arinc429SignStatus::FailureWarning;
+    busOutputs.discrete_word_3.SSM = Arinc429SignStatus::FailureWarning;
+    busOutputs.discrete_word_4.SSM = Arinc429SignStatus::FailureWarning;
+    busOutputs.discrete_word_5.SSM = Arinc429SignStatus::FailureWarning;
+    busOutputs.gamma_a_deg.SSM = Arinc429SignStatus::FailureWarning;
+    busOutputs.gamma_t_deg.SSM = Arinc429SignStatus::FailureWarning;
+    busOutputs.total_weight_lbs.SSM = Arinc429SignStatus::FailureWarning;
+    busOutputs.center_of_gravity_pos_percent.SSM = Arinc429SignStatus::FailureWarning;
+    busOutputs.sideslip_target_deg.SSM = Arinc429SignStatus::FailureWarning;
+    busOutputs.fac_slat_angle_deg.SSM = Arinc429SignStatus::FailureWarning;
+    busOutputs.fac_flap_angle_deg.SSM = Arinc429SignStatus::FailureWarning;
+    busOutputs.rudder_travel_limit_command_deg.SSM = Arinc429SignStatus::FailureWarning;
+    busOutputs.delta_r_yaw_damper_deg.SSM = Arinc429SignStatus::FailureWarning;
+    busOutputs.estimated_sideslip_deg.SSM = Arinc429SignStatus::FailureWarning;
+    busOutputs.v_alpha_lim_kn.SSM = Arinc429SignStatus::FailureWarning;
+    busOutputs.v_ls_kn.SSM = Arinc429SignStatus::FailureWarning;
+    busOutputs.v_stall_kn.SSM = Arinc429SignStatus::FailureWarning;
+    busOutputs.v_alpha_prot_kn.SSM = Arinc429SignStatus::FailureWarning;
+    busOutputs.v_stall_warn_kn.SSM = Arinc429SignStatus::FailureWarning;
+    busOutputs.speed_trend_kn.SSM = Arinc429SignStatus::FailureWarning;
+    busOutputs.v_3_kn.SSM = Arinc429SignStatus::FailureWarning;
+    busOutputs.v_4_kn.SSM = Arinc429SignStatus::FailureWarning;
+    busOutputs.v_man_kn.SSM = Arinc429SignStatus::FailureWarning;
+    busOutputs.v_max_kn.SSM = Arinc429SignStatus::FailureWarning;
+    busOutputs.v_fe_next_kn.SSM = Arinc429SignStatus::FailureWarning;
+    busOutputs.delta_r_rudder_trim_deg.SSM = Arinc429SignStatus::FailureWarning;
+    busOutputs.rudder_trim_pos_deg.SSM = Arinc429SignStatus::FailureWarning;
+
+    // all discretes are false, including fac_healthy, and all orders are zero
+    discreteOutputs = {};
+    analogOutputs = {};
+    return;
   }
 
-  output = modelOutputs.bus_outputs;
-
-  return output;
+  busOutputs = modelOutputs.bus_outputs;
+  discreteOutputs = modelOutputs.discrete_outputs;
+  analogOutputs = modelOutputs.analog_outputs;
 }
 
-base_fac_discrete_outputs Fac::getDiscreteOutputs() {
-  base_fac_discrete_outputs output = {};
-
-  output.fac_healthy = facHealthy;
-
-  if (!facHealthy) {
-    output.yaw_damper_engaged = false;
-    output.rudder_trim_engaged = false;
-    output.rudder_travel_lim_engaged = false;
-    output.yaw_damper_avail_for_norm_law = false;
-  } else {
-    output = modelOutputs.discrete_outputs;
-  }
-
-  return output;
+const base_fac_bus& Fac::getBusOutputs() const {
+  return busOutputs;
 }
 
-base_fac_analog_outputs Fac::getAnalogOutputs() {
-  base_fac_analog_outputs output = {};
-
-  if (!facHealthy) {
-    output.yaw_damper_order_deg = 0;
-    output.rudder_trim_order_deg = 0;
-    output.rudder_travel_limit_order_deg = 0;
-  } else {
-    output = modelOutputs.analog_outputs;
-  }
+const base_fac_discrete_outputs& Fac::getDiscreteOutputs() const {
+  return discreteOutputs;
+}
 
-  return output;
+const base_fac_analog_outputs& Fac::getAnalogOutputs() const {
+  return analogOutputs;
 }
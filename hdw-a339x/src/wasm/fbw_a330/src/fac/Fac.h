@@ -7,6 +7,9 @@
 #include "FacIO.h"
 
 class Fac {
+  // Model, declared first so that it is constructed before the references to its inputs and outputs
+  FacComputer facComputer;
+
  public:
   Fac(bool isUnit1);
 
@@ -14,13 +17,14 @@ class Fac {
 
   void update(double deltaTime, double simulationTime, bool faultActive, bool isPowered);
 
-  base_fac_bus getBusOutputs();
+  const base_fac_bus& getBusOutputs() const;
 
-  base_fac_discrete_outputs getDiscreteOutputs();
+  const base_fac_discrete_outputs& getDiscreteOutputs() const;
 
-  base_fac_analog_outputs getAnalogOutputs();
+  const base_fac_analog_outputs& getAnalogOutputs() const;
 
-  FacComputer::ExternalInputs_FacComputer_T modelInputs = {};
+  // inputs of the model, written in place before update()
+  FacComputer::ExternalInputs_FacComputer_T& modelInputs;
 
  private:
   void initSelfTests();
@@ -33,9 +37,14 @@ class Fac {
 
   void updateSelfTest(double deltaTime);
 
-  // Model
-  FacComputer facComputer;
-  fac_outputs modelOutputs;
+  void writeOutputs();
+
+  const fac_outputs& modelOutputs;
+
+  // outputs of the last update
+  base_fac_bus busOutputs = {};
+  base_fac_discrete_outputs discreteOutputs = {};
+  base_fac_analog_outputs analogOutputs = {};
 
   // Computer Self-monitoring vars
   bool facHealthy;
@@ -33,6 +33,9 @@ void Fcdc::update(double deltaTime, bool faultActive, bool isPowered) {
     consolidatePositionData();
     computeSidestickPriorityLights(deltaTime);
   }
+
+  writeBusOutputs();
+  writeDiscreteOutputs();
 }
 
 // Perform self monitoring
@@ -98,16 +101,16 @@ PitchLaw Fcdc::getPitchLawStatusFromBits(bool bit1, bool bit2, bool bit3) {
 }
 
 void Fcdc::computeComputerEngagements() {
-  elac1EngagedInRoll = bitFromValueOr(busInputs.elac1.discrete_status_word_1, 20, false);
-  elac2EngagedInRoll = bitFromValueOr(busInputs.elac2.discrete_status_word_1, 20, false);
-  sec1EngagedInRoll = bitFromValueOr(busInputs.sec1.discrete_status_word_1, 22, false);
-  sec2EngagedInRoll = bitFromValueOr(busInputs.sec2.discrete_status_word_1, 22, false);
-  sec3EngagedInRoll = bitFromValueOr(busInputs.sec3.discrete_status_word_1, 22, false);
-
-  elac1EngagedInPitch = bitFromValueOr(busInputs.elac1.discrete_status_word_1, 19, false);
-  elac2EngagedInPitch = bitFromValueOr(busInputs.elac2.discrete_status_word_1, 19, false);
-  sec1EngagedInPitch = bitFromValueOr(busInputs.sec1.discrete_status_word_1, 23, false);
-  sec2EngagedInPitch = bitFromValueOr(busInputs.sec2.discrete_status_word_1, 23, false);
+  elac1EngagedInRoll = bitFromValueOr(busInputs.elac1->discrete_status_word_1, 20, false);
+  elac2EngagedInRoll = bitFromValueOr(busInputs.elac2->discrete_status_word_1, 20, false);
+  sec1EngagedInRoll = bitFromValueOr(busInputs.sec1->discrete_status_word_1, 22, false);
+  sec2EngagedInRoll = bitFromValueOr(busInputs.sec2->discrete_status_word_1, 22, false);
+  sec3EngagedInRoll = bitFromValueOr(busInputs.sec3->discrete_status_word_1, 22, false);
+
+  elac1EngagedInPitch = bitFromValueOr(busInputs.elac1->discrete_status_word_1, 19, false);
+  elac2EngagedInPitch = bitFromValueOr(busInputs.elac2->discrete_status_word_1, 19, false);
+  sec1EngagedInPitch = bitFromValueOr(busInputs.sec1->discrete_status_word_1, 23, false);
+  sec2EngagedInPitch = bitFromValueOr(busInputs.sec2->discrete_status_word_1, 23, false);
 }
 
 void Fcdc::consolidatePositionData() {
@@ -115,28 +118,28 @@ void Fcdc::consolidatePositionData() {
   // engaged in roll is valid, use that data. If not, take the data from the other ELAC.
   // If neither are valid, set the respective aileron position as invalid.
   leftAileronPosValid = true;
-  if (elac1EngagedInRoll && isNo(busInputs.elac1.left_aileron_position_deg)) {
-    leftAileronPos = busInputs.elac1.left_aileron_position_deg.Data;
-  } else if (elac2EngagedInRoll && isNo(busInputs.elac2.left_aileron_position_deg)) {
-    leftAileronPos = busInputs.elac2.left_aileron_position_deg.Data;
-  } else if (isNo(busInputs.elac1.left_aileron_position_deg)) {
-    leftAileronPos = busInputs.elac1.left_aileron_position_deg.Data;
-  } else if (isNo(busInputs.elac2.left_aileron_position_deg)) {
-    leftAileronPos = busInputs.elac2.left_aileron_position_deg.Data;
+  if (elac1EngagedInRoll && isNo(busInputs.elac1->left_aileron_position_deg)) {
+    leftAileronPos = busInputs.elac1->left_aileron_position_deg.Data;
+  } else if (elac2EngagedInRoll && isNo(busInputs.elac2->left_aileron_position_deg)) {
+    leftAileronPos = busInputs.elac2->left_aileron_position_deg.Data;
+  } else if (isNo(busInputs.elac1->left_aileron_position_deg)) {
+    leftAileronPos = busInputs.elac1->left_aileron_position_deg.Data;
+  } else if (isNo(busInputs.elac2->left_aileron_position_deg)) {
+    leftAileronPos = busInputs.elac2->left_aileron_position_deg.Data;
   } else {
     leftAileronPos = 0;
     leftAileronPosValid = false;
   }
 
   rightAileronPosValid = true;
-  if (elac1EngagedInRoll && isNo(busInputs.elac1.right_aileron_position_deg)) {
-    rightAileronPos = busInputs.elac1.right_aileron_position_deg.Data;
-  } else if (elac2EngagedInRoll && isNo(busInputs.elac2.right_aileron_position_deg)) {
-    rightAileronPos = busInputs.elac2.right_aileron_position_deg.Data;
-  } else if (isNo(busInputs.elac1.right_aileron_position_deg)) {
-    rightAileronPos = busInputs.elac1.right_aileron_position_deg.Data;
-  } else if (isNo(busInputs.elac2.right_aileron_position_deg)) {
-    rightAileronPos = busInputs.elac2.right_aileron_position_deg.Data;
+  if (elac1EngagedInRoll && isNo(busInputs.elac1->right_aileron_position_deg)) {
+    rightAileronPos = busInputs.elac1->right_aileron_position_deg.Data;
+  } else if (elac2EngagedInRoll && isNo(busInputs.elac2->right_aileron_position_deg)) {
+    rightAileronPos = busInputs.elac2->right_aileron_position_deg.Data;
+  } else if (isNo(busInputs.elac1->right_aileron_position_deg)) {
+    rightAileronPos = busInputs.elac1->right_aileron_position_deg.Data;
+  } else if (isNo(busInputs.elac2->right_aileron_position_deg)) {
+    rightAileronPos = busInputs.elac2->right_aileron_position_deg.Data;
   } else {
     rightAileronPos = 0;
     rightAileronPosValid = false;
@@ -149,58 +152,58 @@ void Fcdc::consolidatePositionData() {
   // If no computer is engaged in roll, choose the first computer that outputs valid stick positions.
   // If no computer output valid stick positions, set them as invalid.
   if (elac1EngagedInRoll) {
-    rollSidestickPosCapt = busInputs.elac1.left_sidestick_roll_command_deg.Data;
-    rollSidestickPosCaptValid = isNo(busInputs.elac1.left_sidestick_roll_command_deg);
-    rollSidestickPosFo = busInputs.elac1.right_sidestick_roll_command_deg.Data;
-    rollSidestickPosFoValid = isNo(busInputs.elac1.right_sidestick_roll_command_deg);
+    rollSidestickPosCapt = busInputs.elac1->left_sidestick_roll_command_deg.Data;
+    rollSidestickPosCaptValid = isNo(busInputs.elac1->left_sidestick_roll_command_deg);
+    rollSidestickPosFo = busInputs.elac1->right_sidestick_roll_command_deg.Data;
+    rollSidestickPosFoValid = isNo(busInputs.elac1->right_sidestick_roll_command_deg);
   } else if (elac2EngagedInRoll) {
-    rollSidestickPosCapt = busInputs.elac2.left_sidestick_roll_command_deg.Data;
-    rollSidestickPosCaptValid = isNo(busInputs.elac2.left_sidestick_roll_command_deg);
-    rollSidestickPosFo = busInputs.elac2.right_sidestick_roll_command_deg.Data;
-    rollSidestickPosFoValid = isNo(busInputs.elac2.right_sidestick_roll_command_deg);
+    rollSidestickPosCapt = busInputs.elac2->left_sidestick_roll_command_deg.Data;
+    rollSidestickPosCaptValid = isNo(busInputs.elac2->left_sidestick_roll_command_deg);
+    rollSidestickPosFo = busInputs.elac2->right_sidestick_roll_command_deg.Data;
+    rollSidestickPosFoValid = isNo(busInputs.elac2->right_sidestick_roll_command_deg);
   } else if (sec1EngagedInRoll &&
-             (isNo(busInputs.sec1.left_sidestick_roll_command_deg) || isNo(busInputs.sec1.right_sidestick_roll_command_deg))) {
-    rollSidestickPosCapt = busInputs.sec1.left_sidestick_roll_command_deg.Data;
-    rollSidestickPosCaptValid = isNo(busInputs.sec1.left_sidestick_roll_command_deg);
-    rollSidestickPosFo = busInputs.sec1.right_sidestick_roll_command_deg.Data;
-    rollSidestickPosFoValid = isNo(busInputs.sec1.right_sidestick_roll_command_deg);
+             (isNo(busInputs.sec1->left_sidestick_roll_command_deg) || isNo(busInputs.sec1->right_sidestick_roll_command_deg))) {
+    rollSidestickPosCapt = busInputs.sec1->left_sidestick_roll_command_deg.Data;
+    rollSidestickPosCaptValid = isNo(busInputs.sec1->left_sidestick_roll_command_deg);
+    rollSidestickPosFo = busInputs.sec1->right_sidestick_roll_command_deg.Data;
+    rollSidestickPosFoValid = isNo(busInputs.sec1->right_sidestick_roll_command_deg);
   } else if (sec2EngagedInRoll &&
-             (isNo(busInputs.sec2.left_sidestick_roll_command_deg) || isNo(busInputs.sec2.right_sidestick_roll_command_deg))) {
-    rollSidestickPosCapt = busInputs.sec2.left_sidestick_roll_command_deg.Data;
-    rollSidestickPosCaptValid = isNo(busInputs.sec2.left_sidestick_roll_command_deg);
-    rollSidestickPosFo = busInputs.sec2.right_sidestick_roll_command_deg.Data;
-    rollSidestickPosFoValid = isNo(busInputs.sec2.right_sidestick_roll_command_deg);
+             (isNo(busInputs.sec2->left_sidestick_roll_command_deg) || isNo(busInputs.sec2->right_sidestick_roll_command_deg))) {
+    rollSidestickPosCapt = busInputs.sec2->left_sidestick_roll_command_deg.Data;
+    rollSidestickPosCaptValid = isNo(busInputs.sec2->left_sidestick_roll_command_deg);
+    rollSidestickPosFo = busInputs.sec2->right_sidestick_roll_command_deg.Data;
+    rollSidestickPosFoValid = isNo(busInputs.sec2->right_sidestick_roll_command_deg);
   } else if (sec3EngagedInRoll &&
-             (isNo(busInputs.sec3.left_sidestick_roll_command_deg) || isNo(busInputs.sec3.right_sidestick_roll_command_deg))) {
-    rollSidestickPosCapt = busInputs.sec3.left_sidestick_roll_command_deg.Data;
-    rollSidestickPosCaptValid = isNo(busInputs.sec3.left_sidestick_roll_command_deg);
-    rollSidestickPosFo = busInputs.sec3.right_sidestick_roll_command_deg.Data;
-    rollSidestickPosFoValid = isNo(busInputs.sec3.right_sidestick_roll_command_deg);
-  } else if (isNo(busInputs.elac1.left_sidestick_roll_command_deg) || isNo(busInputs.elac1.right_sidestick_roll_command_deg)) {
-    rollSidestickPosCapt = busInputs.elac1.left_sidestick_roll_command_deg.Data;
-    rollSidestickPosCaptValid = isNo(busInputs.elac1.left_sidestick_roll_command_deg);
-    rollSidestickPosFo = busInputs.elac1.right_sidestick_roll_command_deg.Data;
-    rollSidestickPosFoValid = isNo(busInputs.elac1.right_sidestick_roll_command_deg);
-  } else if (isNo(busInputs.elac2.left_sidestick_roll_command_deg) || isNo(busInputs.elac2.right_sidestick_roll_command_deg)) {
-    rollSidestickPosCapt = busInputs.elac2.left_sidestick_roll_command_deg.Data;
-    rollSidestickPosCaptValid = isNo(busInputs.elac2.left_sidestick_roll_command_deg);
-    rollSidestickPosFo = busInputs.elac2.right_sidestick_roll_command_deg.Data;
-    rollSidestickPosFoValid = isNo(busInputs.elac2.right_sidestick_roll_command_deg);
-  } else if (isNo(busInputs.sec1.left_sidestick_roll_command_deg) || isNo(busInputs.sec1.right_sidestick_roll_command_deg)) {
-    rollSidestickPosCapt = busInputs.sec1.left_sidestick_roll_command_deg.Data;
-    rollSidestickPosCaptValid = isNo(busInputs.sec1.left_sidestick_roll_command_deg);
-    rollSidestickPosFo = busInputs.sec1.right_sidestick_roll_command_deg.Data;
-    rollSidestickPosFoValid = isNo(busInputs.sec1.right_sidestick_roll_command_deg);
-  } else if (isNo(busInputs.sec2.left_sidestick_roll_command_deg) || isNo(busInputs.sec2.right_sidestick_roll_command_deg)) {
-    rollSidestickPosCapt = busInputs.sec2.left_sidestick_roll_command_deg.Data;
-    rollSidestickPosCaptValid = isNo(busInputs.sec2.left_sidestick_roll_command_deg);
-    rollSidestickPosFo = busInputs.sec2.right_sidestick_roll_command_deg.Data;
-    rollSidestickPosFoValid = isNo(busInputs.sec2.right_sidestick_roll_command_deg);
-  } else if (isNo(busInputs.sec3.left_sidestick_roll_command_deg) || isNo(busInputs.sec3.right_sidestick_roll_command_deg)) {
-    rollSidestickPosCapt = busInputs.sec3.left_sidestick_roll_command_deg.Data;
-    rollSidestickPosCaptValid = isNo(busInputs.sec3.left_sidestick_roll_command_deg);
-    rollSidestickPosFo = busInputs.sec3.right_sidestick_roll_command_deg.Data;
-    rollSidestickPosFoValid = isNo(busInputs.sec3.right_sidestick_roll_command_deg);
+             (isNo(busInputs.sec3->left_sidestick_roll_command_deg) || isNo(busInputs.sec3->right_sidestick_roll_command_deg))) {
+    rollSidestickPosCapt = busInputs.sec3->left_sidestick_roll_command_deg.Data;
+    rollSidestickPosCaptValid = isNo(busInputs.sec3->left_sidestick_roll_command_deg);
+    rollSidestickPosFo = busInputs.sec3->right_sidestick_roll_command_deg.Data;
+    rollSidestickPosFoValid = isNo(busInputs.sec3->right_sidestick_roll_command_deg);
+  } else if (isNo(busInputs.elac1->left_sidestick_roll_command_deg) || isNo(busInputs.elac1->right_sidestick_roll_command_deg)) {
+    rollSidestickPosCapt = busInputs.elac1->left_sidestick_roll_command_deg.Data;
+    rollSidestickPosCaptValid = isNo(busInputs.elac1->left_sidestick_roll_command_deg);
+    rollSidestickPosFo = busInputs.elac1->right_sidestick_roll_command_deg.Data;
+    rollSidestickPosFoValid = isNo(busInputs.elac1->right_sidestick_roll_command_deg);
+  } else if (isNo(busInputs.elac2->left_sidestick_roll_command_deg) || isNo(busInputs.elac2->right_sidestick_roll_command_deg)) {
+    rollSidestickPosCapt = busInputs.elac2->left_sidestick_roll_command_deg.Data;
+    rollSidestickPosCaptValid = isNo(busInputs.elac2->left_sidestick_roll_command_deg);
+    rollSidestickPosFo = busInputs.elac2->right_sidestick_roll_command_deg.Data;
+    rollSidestickPosFoValid = isNo(busInputs.elac2->right_sidestick_roll_command_deg);
+  } else if (isNo(busInputs.sec1->left_sidestick_roll_command_deg) || isNo(busInputs.sec1->right_sidestick_roll_command_deg)) {
+    rollSidestickPosCapt = busInputs.sec1->left_sidestick_roll_command_deg.Data;
+    rollSidestickPosCaptValid = isNo(busInputs.sec1->left_sidestick_roll_command_deg);
+    rollSidestickPosFo = busInputs.sec1->right_sidestick_roll_command_deg.Data;
+    rollSidestickPosFoValid = isNo(busInputs.sec1->right_sidestick_roll_command_deg);
+  } else if (isNo(busInputs.sec2->left_sidestick_roll_command_deg) || isNo(busInputs.sec2->right_sidestick_roll_command_deg)) {
+    rollSidestickPosCapt = busInputs.sec2->left_sidestick_roll_command_deg.Data;
+    rollSidestickPosCaptValid = isNo(busInputs.sec2->left_sidestick_roll_command_deg);
+    rollSidestickPosFo = busInputs.sec2->right_sidestick_roll_command_deg.Data;
+    rollSidestickPosFoValid = isNo(busInputs.sec2->right_sidestick_roll_command_deg);
+  } else if (isNo(busInputs.sec3->left_sidestick_roll_command_deg) || isNo(busInputs.sec3->right_sidestick_roll_command_deg)) {
+    rollSidestickPosCapt = busInputs.sec3->left_sidestick_roll_command_deg.Data;
+    rollSidestickPosCaptValid = isNo(busInputs.sec3->left_sidestick_roll_command_deg);
+    rollSidestickPosFo = busInputs.sec3->right_sidestick_roll_command_deg.Data;
+    rollSidestickPosFoValid = isNo(busInputs.sec3->right_sidestick_roll_command_deg);
   } else {
     rollSidestickPosCapt = 0;
     rollSidestickPosCaptValid = false;
@@ -212,17 +215,17 @@ void Fcdc::consolidatePositionData() {
   // If one is, take that data. If none is engaged in roll, take the first valid data.
   // If none is valid, set data as invalid.
   if (elac1EngagedInRoll) {
-    rudderPedalPos = busInputs.elac1.rudder_pedal_position_deg.Data;
-    rudderPedalPosValid = isNo(busInputs.elac1.rudder_pedal_position_deg);
+    rudderPedalPos = busInputs.elac1->rudder_pedal_position_deg.Data;
+    rudderPedalPosValid = isNo(busInputs.elac1->rudder_pedal_position_deg);
   } else if (elac2EngagedInRoll) {
-    rudderPedalPos = busInputs.elac2.rudder_pedal_position_deg.Data;
-    rudderPedalPosValid = isNo(busInputs.elac2.rudder_pedal_position_deg);
-  } else if (isNo(busInputs.elac1.rudder_pedal_position_deg)) {
-    rudderPedalPos = busInputs.elac1.rudder_pedal_position_deg.Data;
-    rudderPedalPosValid = isNo(busInputs.elac1.rudder_pedal_position_deg);
-  } else if (isNo(busInputs.elac2.rudder_pedal_position_deg)) {
-    rudderPedalPos = busInputs.elac2.rudder_pedal_position_deg.Data;
-    rudderPedalPosValid = isNo(busInputs.elac2.rudder_pedal_position_deg);
+    rudderPedalPos = busInputs.elac2->rudder_pedal_position_deg.Data;
+    rudderPedalPosValid = isNo(busInputs.elac2->rudder_pedal_position_deg);
+  } else if (isNo(busInputs.elac1->rudder_pedal_position_deg)) {
+    rudderPedalPos = busInputs.elac1->rudder_pedal_position_deg.Data;
+    rudderPedalPosValid = isNo(busInputs.elac1->rudder_pedal_position_deg);
+  } else if (isNo(busInputs.elac2->rudder_pedal_position_deg)) {
+    rudderPedalPos = busInputs.elac2->rudder_pedal_position_deg.Data;
+    rudderPedalPosValid = isNo(busInputs.elac2->rudder_pedal_position_deg);
   } else {
     rudderPedalPos = 0;
     rudderPedalPosValid = false;
@@ -232,66 +235,66 @@ void Fcdc::consolidatePositionData() {
   // engaged in roll is valid, use that data. If not, take the data from the other computers.
   // If neither are valid, set the respective position as invalid.
   leftElevatorPosValid = true;
-  if (elac2EngagedInPitch && isNo(busInputs.elac2.left_elevator_position_deg)) {
-    leftElevatorPos = busInputs.elac2.left_elevator_position_deg.Data;
-  } else if (elac1EngagedInPitch && isNo(busInputs.elac1.left_elevator_position_deg)) {
-    leftElevatorPos = busInputs.elac1.left_elevator_position_deg.Data;
-  } else if (sec2EngagedInPitch && isNo(busInputs.sec2.left_elevator_position_deg)) {
-    leftElevatorPos = busInputs.sec2.left_elevator_position_deg.Data;
-  } else if (sec1EngagedInPitch && isNo(busInputs.sec1.left_elevator_position_deg)) {
-    leftElevatorPos = busInputs.sec1.left_elevator_position_deg.Data;
-  } else if (isNo(busInputs.elac2.left_elevator_position_deg)) {
-    leftElevatorPos = busInputs.elac2.left_elevator_position_deg.Data;
-  } else if (isNo(busInputs.elac1.left_elevator_position_deg)) {
-    leftElevatorPos = busInputs.elac1.left_elevator_position_deg.Data;
-  } else if (isNo(busInputs.sec2.left_elevator_position_deg)) {
-    leftElevatorPos = busInputs.sec2.left_elevator_position_deg.Data;
-  } else if (isNo(busInputs.sec1.left_elevator_position_deg)) {
-    leftElevatorPos = busInputs.sec1.left_elevator_position_deg.Data;
+  if (elac2EngagedInPitch && isNo(busInputs.elac2->left_elevator_position_deg)) {
+    leftElevatorPos = busInputs.elac2->left_elevator_position_deg.Data;
+  } else if (elac1EngagedInPitch && isNo(busInputs.elac1->left_elevator_position_deg)) {
+    leftElevatorPos = busInputs.elac1->left_elevator_position_deg.Data;
+  } else if (sec2EngagedInPitch && isNo(busInputs.sec2->left_elevator_position_deg)) {
+    leftElevatorPos = busInputs.sec2->left_elevator_position_deg.Data;
+  } else if (sec1EngagedInPitch && isNo(busInputs.sec1->left_elevator_position_deg)) {
+    leftElevatorPos = busInputs.sec1->left_elevator_position_deg.Data;
+  } else if (isNo(busInputs.elac2->left_elevator_position_deg)) {
+    leftElevatorPos = busInputs.elac2->left_elevator_position_deg.Data;
+  } else if (isNo(busInputs.elac1->left_elevator_position_deg)) {
+    leftElevatorPos = busInputs.elac1->left_elevator_position_deg.Data;
+  } else if (isNo(busInputs.sec2->left_elevator_position_deg)) {
+    leftElevatorPos = busInputs.sec2->left_elevator_position_deg.Data;
+  } else if (isNo(busInputs.sec1->left_elevator_position_deg)) {
+    leftElevatorPos = busInputs.sec1->left_elevator_position_deg.Data;
   } else {
     leftElevatorPos = 0;
     leftElevatorPosValid = false;
   }
 
   rightElevatorPosValid = true;
-  if (elac2EngagedInPitch && isNo(busInputs.elac2.right_elevator_position_deg)) {
-    rightElevatorPos = busInputs.elac2.right_elevator_position_deg.Data;
-  } else if (elac1EngagedInPitch && isNo(busInputs.elac1.right_elevator_position_deg)) {
-    rightElevatorPos = busInputs.elac1.right_elevator_position_deg.Data;
-  } else if (sec2EngagedInPitch && isNo(busInputs.sec2.right_elevator_position_deg)) {
-    rightElevatorPos = busInputs.sec2.right_elevator_position_deg.Data;
-  } else if (sec1EngagedInPitch && isNo(busInputs.sec1.right_elevator_position_deg)) {
-    rightElevatorPos = busInputs.sec1.right_elevator_position_deg.Data;
-  } else if (isNo(busInputs.elac2.right_elevator_position_deg)) {
-    rightElevatorPos = busInputs.elac2.right_elevator_position_deg.Data;
-  } else if (isNo(busInputs.elac1.right_elevator_position_deg)) {
-    rightElevatorPos = busInputs.elac1.right_elevator_position_deg.Data;
-  } else if (isNo(busInputs.sec2.right_elevator_position_deg)) {
-    rightElevatorPos = busInputs.sec2.right_elevator_position_deg.Data;
-  } else if (isNo(busInputs.sec1.right_elevator_position_deg)) {
-    rightElevatorPos = busInputs.sec1.right_elevator_position_deg.Data;
+  if (elac2EngagedInPitch && isNo(busInputs.elac2->right_elevator_position_deg)) {
+    rightElevatorPos = busInputs.elac2->right_elevator_position_deg.Data;
+  } else if (elac1EngagedInPitch && isNo(busInputs.elac1->right_elevator_position_deg)) {
+    rightElevatorPos = busInputs.elac1->right_elevator_position_deg.Data;
+  } else if (sec2EngagedInPitch && isNo(busInputs.sec2->right_elevator_position_deg)) {
+    rightElevatorPos = busInputs.sec2->right_elevator_position_deg.Data;
+  } else if (sec1EngagedInPitch && isNo(busInputs.sec1->right_elevator_position_deg)) {
+    rightElevatorPos = busInputs.sec1->right_elevator_position_deg.Data;
+  } else if (isNo(busInputs.elac2->right_elevator_position_deg)) {
+    rightElevatorPos = busInputs.elac2->right_elevator_position_deg.Data;
+  } else if (isNo(busInputs.elac1->right_elevator_position_deg)) {
+    rightElevatorPos = busInputs.elac1->right_elevator_position_deg.Data;
+  } else if (isNo(busInputs.sec2->right_elevator_position_deg)) {
+    rightElevatorPos = busInputs.sec2->right_elevator_position_deg.Data;
+  } else if (isNo(busInputs.sec1->right_elevator_position_deg)) {
+    rightElevatorPos = busInputs.sec1->right_elevator_position_deg.Data;
   } else {
     rightElevatorPos = 0;
     rightElevatorPosValid = false;
   }
 
   thsPosValid = true;
-  if (elac2EngagedInPitch && isNo(busInputs.elac2.ths_position_deg)) {
-    thsPos = busInputs.elac2.ths_position_deg.Data;
-  } else if (elac1EngagedInPitch && isNo(busInputs.elac1.ths_position_deg)) {
-    thsPos = busInputs.elac1.ths_position_deg.Data;
-  } else if (sec2EngagedInPitch && isNo(busInputs.sec2.ths_position_deg)) {
-    thsPos = busInputs.sec2.ths_position_deg.Data;
-  } else if (sec1EngagedInPitch && isNo(busInputs.sec1.ths_position_deg)) {
-    thsPos = busInputs.sec1.ths_position_deg.Data;
-  } else if (isNo(busInputs.elac2.ths_position_deg)) {
-    thsPos = busInputs.elac2.ths_position_deg.Data;
-  } else if (isNo(busInputs.elac1.ths_position_deg)) {
-    thsPos = busInputs.elac1.ths_position_deg.Data;
-  } else if (isNo(busInputs.sec2.ths_position_deg)) {
-    thsPos = busInputs.sec2.ths_position_deg.Data;
-  } else if (isNo(busInputs.sec1.ths_position_deg)) {
-    thsPos = busInputs.sec1.ths_position_deg.Data;
+  if (elac2EngagedInPitch && isNo(busInputs.elac2->ths_position_deg)) {
+    thsPos = busInputs.elac2->ths_position_deg.Data;
+  } else if (elac1EngagedInPitch && isNo(busInputs.elac1->ths_position_deg)) {
+    thsPos = busInputs.elac1->ths_position_deg.Data;
+  } else if (sec2EngagedInPitch && isNo(busInputs.sec2->ths_position_deg)) {
+    thsPos = busInputs.sec2->ths_position_deg.Data;
+  } else if (sec1EngagedInPitch && isNo(busInputs.sec1->ths_position_deg)) {
+    thsPos = busInputs.sec1->ths_position_deg.Data;
+  } else if (isNo(busInputs.elac2->ths_position_deg)) {
+    thsPos = busInputs.elac2->ths_position_deg.Data;
+  } else if (isNo(busInputs.elac1->ths_position_deg)) {
+    thsPos = busInputs.elac1->ths_position_deg.Data;
+  } else if (isNo(busInputs.sec2->ths_position_deg)) {
+    thsPos = busInputs.sec2->ths_position_deg.Data;
+  } else if (isNo(busInputs.sec1->ths_position_deg)) {
+    thsPos = busInputs.sec1->ths_position_deg.Data;
   } else {
     thsPos = 0;
     thsPosValid = false;
@@ -302,45 +305,45 @@ void Fcdc::consolidatePositionData() {
   // If none is engaged in pitch, take the first valid data.
   // If none is valid, set data as invalid.
   if (elac2EngagedInPitch) {
-    pitchSidestickPosCapt = busInputs.elac2.left_sidestick_pitch_command_deg.Data;
-    pitchSidestickPosCaptValid = isNo(busInputs.elac2.left_sidestick_pitch_command_deg);
-    pitchSidestickPosFo = busInputs.elac2.right_sidestick_pitch_command_deg.Data;
-    pitchSidestickPosFoValid = isNo(busInputs.elac2.right_sidestick_pitch_command_deg);
+    pitchSidestickPosCapt = busInputs.elac2->left_sidestick_pitch_command_deg.Data;
+    pitchSidestickPosCaptValid = isNo(busInputs.elac2->left_sidestick_pitch_command_deg);
+    pitchSidestickPosFo = busInputs.elac2->right_sidestick_pitch_command_deg.Data;
+    pitchSidestickPosFoValid = isNo(busInputs.elac2->right_sidestick_pitch_command_deg);
   } else if (elac1EngagedInPitch) {
-    pitchSidestickPosCapt = busInputs.elac1.left_sidestick_pitch_command_deg.Data;
-    pitchSidestickPosCaptValid = isNo(busInputs.elac1.left_sidestick_pitch_command_deg);
-    pitchSidestickPosFo = busInputs.elac1.right_sidestick_pitch_command_deg.Data;
-    pitchSidestickPosFoValid = isNo(busInputs.elac1.right_sidestick_pitch_command_deg);
+    pitchSidestickPosCapt = busInputs.elac1->left_sidestick_pitch_command_deg.Data;
+    pitchSidestickPosCaptValid = isNo(busInputs.elac1->left_sidestick_pitch_command_deg);
+    pitchSidestickPosFo = busInputs.elac1->right_sidestick_pitch_command_deg.Data;
+    pitchSidestickPosFoValid = isNo(busInputs.elac1->right_sidestick_pitch_command_deg);
   } else if (sec2EngagedInPitch) {
-    pitchSidestickPosCapt = busInputs.sec2.left_sidestick_pitch_command_deg.Data;
-    pitchSidestickPosCaptValid = isNo(busInputs.sec2.left_sidestick_pitch_command_deg);
-    pitchSidestickPosFo = busInputs.sec2.right_sidestick_pitch_command_deg.Data;
-    pitchSidestickPosFoValid = isNo(busInputs.sec2.right_sidestick_pitch_command_deg);
+    pitchSidestickPosCapt = busInputs.sec2->left_sidestick_pitch_command_deg.Data;
+    pitchSidestickPosCaptValid = isNo(busInputs.sec2->left_sidestick_pitch_command_deg);
+    pitchSidestickPosFo = busInputs.sec2->right_sidestick_pitch_command_deg.Data;
+    pitchSidestickPosFoValid = isNo(busInputs.sec2->right_sidestick_pitch_command_deg);
   } else if (sec1EngagedInPitch) {
-    pitchSidestickPosCapt = busInputs.sec1.left_sidestick_pitch_command_deg.Data;
-    pitchSidestickPosCaptValid = isNo(busInputs.sec1.left_sidestick_pitch_command_deg);
-    pitchSidestickPosFo = busInputs.sec1.right_sidestick_pitch_command_deg.Data;
-    pitchSidestickPosFoValid = isNo(busInputs.sec1.right_sidestick_pitch_command_deg);
-  } else if (isNo(busInputs.elac2.left_sidestick_pitch_command_deg) || isNo(busInputs.elac2.right_sidestick_pitch_command_deg)) {
-    pitchSidestickPosCapt = busInputs.elac2.left_sidestick_pitch_command_deg.Data;
-    pitchSidestickPosCaptValid = isNo(busInputs.elac2.left_sidestick_pitch_command_deg);
-    pitchSidestickPosFo = busInputs.elac2.right_sidestick_pitch_command_deg.Data;
-    pitchSidestickPosFoValid = isNo(busInputs.elac2.right_sidestick_pitch_command_deg);
-  } else if (isNo(busInputs.elac1.left_sidestick_pitch_command_deg) || isNo(busInputs.elac1.right_sidestick_pitch_command_deg)) {
-    pitchSidestickPosCapt = busInputs.elac1.left_sidestick_pitch_command_deg.Data;
-    pitchSidestickPosCaptValid = isNo(busInputs.elac1.left_sidestick_pitch_command_deg);
-    pitchSidestickPosFo = busInputs.elac1.right_sidestick_pitch_command_deg.Data;
-    pitchSidestickPosFoValid = isNo(busInputs.elac1.right_sidestick_pitch_command_deg);
-  } else if (isNo(busInputs.sec2.left_sidestick_pitch_command_deg) || isNo(busInputs.sec2.right_sidestick_pitch_command_deg)) {
-    pitchSidestickPosCapt = busInputs.sec2.left_sidestick_pitch_command_deg.Data;
-    pitchSidestickPosCaptValid = isNo(busInputs.sec2.left_sidestick_pitch_command_deg);
-    pitchSidestickPosFo = busInputs.sec2.right_sidestick_pitch_command_deg.Data;
-    pitchSidestickPosFoValid = isNo(busInputs.sec2.right_sidestick_pitch_command_deg);
-  } else if (isNo(busInputs.sec1.left_sidestick_pitch_command_deg) || isNo(busInputs.sec1.right_sidestick_pitch_command_deg)) {
-    pitchSidestickPosCapt = busInputs.sec1.left_sidestick_pitch_command_deg.Data;
-    pitchSidestickPosCaptValid = isNo(busInputs.sec1.left_sidestick_pitch_command_deg);
-    pitchSidestickPosFo = busInputs.sec1.right_sidestick_pitch_command_deg.Data;
-    pitchSidestickPosFoValid = isNo(busInputs.sec1.right_sidestick_pitch_command_deg);
+    pitchSidestickPosCapt = busInputs.sec1->left_sidestick_pitch_command_deg.Data;
+    pitchSidestickPosCaptValid = isNo(busInputs.sec1->left_sidestick_pitch_command_deg);
+    pitchSidestickPosFo = busInputs.sec1->right_sidestick_pitch_command_deg.Data;
+    pitchSidestickPosFoValid = isNo(busInputs.sec1->right_sidestick_pitch_command_deg);
+  } else if (isNo(busInputs.elac2->left_sidestick_pitch_command_deg) || isNo(busInputs.elac2->right_sidestick_pitch_command_deg)) {
+    pitchSidestickPosCapt = busInputs.elac2->left_sidestick_pitch_command_deg.Data;
+    pitchSidestickPosCaptValid = isNo(busInputs.elac2->left_sidestick_pitch_command_deg);
+    pitchSidestickPosFo = busInputs.elac2->right_sidestick_pitch_command_deg.Data;
+    pitchSidestickPosFoValid = isNo(busInputs.elac2->right_sidestick_pitch_command_deg);
+  } else if (isNo(busInputs.elac1->left_sidestick_pitch_command_deg) || isNo(busInputs.elac1->right_sidestick_pitch_command_deg)) {
+    pitchSidestickPosCapt = busInputs.elac1->left_sidestick_pitch_command_deg.Data;
+    pitchSidestickPosCaptValid = isNo(busInputs.elac1->left_sidestick_pitch_command_deg);
+    pitchSidestickPosFo = busInputs.elac1->right_sidestick_pitch_command_deg.Data;
+    pitchSidestickPosFoValid = isNo(busInputs.elac1->right_sidestick_pitch_command_deg);
+  } else if (isNo(busInputs.sec2->left_sidestick_pitch_command_deg) || isNo(busInputs.sec2->right_sidestick_pitch_command_deg)) {
+    pitchSidestickPosCapt = busInputs.sec2->left_sidestick_pitch_command_deg.Data;
+    pitchSidestickPosCaptValid = isNo(busInputs.sec2->left_sidestick_pitch_command_deg);
+    pitchSidestickPosFo = busInputs.sec2->right_sidestick_pitch_command_deg.Data;
+    pitchSidestickPosFoValid = isNo(busInputs.sec2->right_sidestick_pitch_command_deg);
+  } else if (isNo(busInputs.sec1->left_sidestick_pitch_command_deg) || isNo(busInputs.sec1->right_sidestick_pitch_command_deg)) {
+    pitchSidestickPosCapt = busInputs.sec1->left_sidestick_pitch_command_deg.Data;
+    pitchSidestickPosCaptValid = isNo(busInputs.sec1->left_sidestick_pitch_command_deg);
+    pitchSidestickPosFo = busInputs.sec1->right_sidestick_pitch_command_deg.Data;
+    pitchSidestickPosFoValid = isNo(busInputs.sec1->right_sidestick_pitch_command_deg);
   } else {
     pitchSidestickPosCapt = 0;
     pitchSidestickPosCaptValid = false;
@@ -354,13 +357,13 @@ void Fcdc::consolidatePositionData() {
 // respective axes.
 void Fcdc::computeActiveSystemLaws() {
   if (elac1EngagedInRoll) {
-    systemLateralLaw = getLateralLawStatusFromBits(bitFromValue(busInputs.elac1.discrete_status_word_1, 26),
-                                                   bitFromValue(busInputs.elac1.discrete_status_word_1, 27),
-                                                   bitFromValue(busInputs.elac1.discrete_status_word_1, 28));
+    systemLateralLaw = getLateralLawStatusFromBits(bitFromValue(busInputs.elac1->discrete_status_word_1, 26),
+                                                   bitFromValue(busInputs.elac1->discrete_status_word_1, 27),
+                                                   bitFromValue(busInputs.elac1->discrete_status_word_1, 28));
   } else if (elac2EngagedInRoll) {
-    systemLateralLaw = getLateralLawStatusFromBits(bitFromValue(busInputs.elac2.discrete_status_word_1, 26),
-                                                   bitFromValue(busInputs.elac2.discrete_status_word_1, 27),
-                                                   bitFromValue(busInputs.elac2.discrete_status_word_1, 28));
+    systemLateralLaw = getLateralLawStatusFromBits(bitFromValue(busInputs.elac2->discrete_status_word_1, 26),
+                                                   bitFromValue(busInputs.elac2->discrete_status_word_1, 27),
+                                                   bitFromValue(busInputs.elac2->discrete_status_word_1, 28));
   } else if (sec1EngagedInRoll || sec2EngagedInRoll || sec3EngagedInRoll) {
     systemLateralLaw = LateralLaw::DirectLaw;
   } else {
@@ -368,21 +371,21 @@ void Fcdc::computeActiveSystemLaws() {
   }
 
   if (elac1EngagedInPitch) {
-    systemPitchLaw = getPitchLawStatusFromBits(bitFromValue(busInputs.elac1.discrete_status_word_1, 23),
-                                               bitFromValue(busInputs.elac1.discrete_status_word_1, 24),
-                                               bitFromValue(busInputs.elac1.discrete_status_word_1, 25));
+    systemPitchLaw = getPitchLawStatusFromBits(bitFromValue(busInputs.elac1->discrete_status_word_1, 23),
+                                               bitFromValue(busInputs.elac1->discrete_status_word_1, 24),
+                                               bitFromValue(busInputs.elac1->discrete_status_word_1, 25));
   } else if (elac2EngagedInPitch) {
-    systemPitchLaw = getPitchLawStatusFromBits(bitFromValue(busInputs.elac2.discrete_status_word_1, 23),
-                                               bitFromValue(busInputs.elac2.discrete_status_word_1, 24),
-                                               bitFromValue(busInputs.elac2.discrete_status_word_1, 25));
+    systemPitchLaw = getPitchLawStatusFromBits(bitFromValue(busInputs.elac2->discrete_status_word_1, 23),
+                                               bitFromValue(busInputs.elac2->discrete_status_word_1, 24),
+                                               bitFromValue(busInputs.elac2->discrete_status_word_1, 25));
   } else if (sec1EngagedInPitch) {
-    systemPitchLaw = getPitchLawStatusFromBits(bitFromValue(busInputs.sec1.discrete_status_word_1, 19),
-                                               bitFromValue(busInputs.sec1.discrete_status_word_1, 20),
-                                               bitFromValue(busInputs.sec1.discrete_status_word_1, 21));
+    systemPitchLaw = getPitchLawStatusFromBits(bitFromValue(busInputs.sec1->discrete_status_word_1, 19),
+                                               bitFromValue(busInputs.sec1->discrete_status_word_1, 20),
+                                               bitFromValue(busInputs.sec1->discrete_status_word_1, 21));
   } else if (sec2EngagedInPitch) {
-    systemPitchLaw = getPitchLawStatusFromBits(bitFromValue(busInputs.sec2.discrete_status_word_1, 19),
-                                               bitFromValue(busInputs.sec2.discrete_status_word_1, 20),
-                                               bitFromValue(busInputs.sec2.discrete_status_word_1, 21));
+    systemPitchLaw = getPitchLawStatusFromBits(bitFromValue(busInputs.sec2->discrete_status_word_1, 19),
+                                               bitFromValue(busInputs.sec2->discrete_status_word_1, 20),
+                                               bitFromValue(busInputs.sec2->discrete_status_word_1, 21));
   } else {
     systemPitchLaw = PitchLaw::None;
   }
@@ -400,50 +403,50 @@ void Fcdc::computeSidestickPriorityLights(double deltaTime) {
 
   // Compute if a sidestick has lost priority (per computer). Use the computer that is engaged in the respective axis.
   if (elac1EngagedInRoll) {
-    leftSidestickDisabledRoll = bitFromValue(busInputs.elac1.discrete_status_word_2, 17);
-    rightSidestickDisabledRoll = bitFromValue(busInputs.elac1.discrete_status_word_2, 18);
-    leftSidestickPriorityLockedRoll = bitFromValue(busInputs.elac1.discrete_status_word_2, 19);
-    rightSidestickPriorityLockedRoll = bitFromValue(busInputs.elac1.discrete_status_word_2, 20);
+    leftSidestickDisabledRoll = bitFromValue(busInputs.elac1->discrete_status_word_2, 17);
+    rightSidestickDisabledRoll = bitFromValue(busInputs.elac1->discrete_status_word_2, 18);
+    leftSidestickPriorityLockedRoll = bitFromValue(busInputs.elac1->discrete_status_word_2, 19);
+    rightSidestickPriorityLockedRoll = bitFromValue(busInputs.elac1->discrete_status_word_2, 20);
   } else if (elac2EngagedInRoll) {
-    leftSidestickDisabledRoll = bitFromValue(busInputs.elac2.discrete_status_word_2, 17);
-    rightSidestickDisabledRoll = bitFromValue(busInputs.elac2.discrete_status_word_2, 18);
-    leftSidestickPriorityLockedRoll = bitFromValue(busInputs.elac2.discrete_status_word_2, 19);
-    rightSidestickPriorityLockedRoll = bitFromValue(busInputs.elac2.discrete_status_word_2, 20);
+    leftSidestickDisabledRoll = bitFromValue(busInputs.elac2->discrete_status_word_2, 17);
+    rightSidestickDisabledRoll = bitFromValue(busInputs.elac2->discrete_status_word_2, 18);
+    leftSidestickPriorityLockedRoll = bitFromValue(busInputs.elac2->discrete_status_word_2, 19);
+    rightSidestickPriorityLockedRoll = bitFromValue(busInputs.elac2->discrete_status_word_2, 20);
   } else if (sec1EngagedInRoll || sec2EngagedInRoll || sec3EngagedInRoll) {
-    leftSidestickDisabledRoll = bitFromValue(busInputs.sec1.discrete_status_word_2, 13) ||
-                                bitFromValue(busInputs.sec2.discrete_status_word_2, 13) ||
-                                bitFromValue(busInputs.sec3.discrete_status_word_2, 13);
-    rightSidestickDisabledRoll = bitFromValue(busInputs.sec1.discrete_status_word_2, 14) ||
-                                 bitFromValue(busInputs.sec2.discrete_status_word_2, 14) ||
-                                 bitFromValue(busInputs.sec3.discrete_status_word_2, 14);
-    leftSidestickPriorityLockedRoll = bitFromValue(busInputs.sec1.discrete_status_word_2, 15) ||
-                                      bitFromValue(busInputs.sec2.discrete_status_word_2, 15) ||
-                                      bitFromValue(busInputs.sec3.discrete_status_word_2, 15);
-    rightSidestickPriorityLockedRoll = bitFromValue(busInputs.sec1.discrete_status_word_2, 16) ||
-                                       bitFromValue(busInputs.sec2.discrete_status_word_2, 16) ||
-                                       bitFromValue(busInputs.sec3.discrete_status_word_2, 16);
+    leftSidestickDisabledRoll = bitFromValue(busInputs.sec1->discrete_status_word_2, 13) ||
+                                bitFromValue(busInputs.sec2->discrete_status_word_2, 13) ||
+                                bitFromValue(busInputs.sec3->discrete_status_word_2, 13);
+    rightSidestickDisabledRoll = bitFromValue(busInputs.sec1->discrete_status_word_2, 14) ||
+                                 bitFromValue(busInputs.sec2->discrete_status_word_2, 14) ||
+                                 bitFromValue(busInputs.sec3->discrete_status_word_2, 14);
+    leftSidestickPriorityLockedRoll = bitFromValue(busInputs.sec1->discrete_status_word_2, 15) ||
+                                      bitFromValue(busInputs.sec2->discrete_status_word_2, 15) ||
+                                      bitFromValue(busInputs.sec3->discrete_status_word_2, 15);
+    rightSidestickPriorityLockedRoll = bitFromValue(busInputs.sec1->discrete_status_word_2, 16) ||
+                                       bitFromValue(busInputs.sec2->discrete_status_word_2, 16) ||
+                                       bitFromValue(busInputs.sec3->discrete_status_word_2, 16);
   }
 
   if (elac2EngagedInPitch) {
-    leftSidestickDisabledPitch = bitFromValue(busInputs.elac2.discrete_status_word_2, 17);
-    rightSidestickDisabledPitch = bitFromValue(busInputs.elac2.discrete_status_word_2, 18);
-    leftSidestickPriorityLockedPitch = bitFromValue(busInputs.elac2.discrete_status_word_2, 19);
-    rightSidestickPriorityLockedPitch = bitFromValue(busInputs.elac2.discrete_status_word_2, 20);
+    leftSidestickDisabledPitch = bitFromValue(busInputs.elac2->discrete_status_word_2, 17);
+    rightSidestickDisabledPitch = bitFromValue(busInputs.elac2->discrete_status_word_2, 18);
+    leftSidestickPriorityLockedPitch = bitFromValue(busInputs.elac2->discrete_status_word_2, 19);
+    rightSidestickPriorityLockedPitch = bitFromValue(busInputs.elac2->discrete_status_word_2, 20);
   } else if (elac1EngagedInPitch) {
-    leftSidestickDisabledPitch = bitFromValue(busInputs.elac1.discrete_status_word_2, 17);
-    rightSidestickDisabledPitch = bitFromValue(busInputs.elac1.discrete_status_word_2, 18);
-    leftSidestickPriorityLockedPitch = bitFromValue(busInputs.elac1.discrete_status_word_2, 19);
-    rightSidestickPriorityLockedPitch = bitFromValue(busInputs.elac1.discrete_status_word_2, 20);
+    leftSidestickDisabledPitch = bitFromValue(busInputs.elac1->discrete_status_word_2, 17);
+    rightSidestickDisabledPitch = bitFromValue(busInputs.elac1->discrete_status_word_2, 18);
+    leftSidestickPriorityLockedPitch = bitFromValue(busInputs.elac1->discrete_status_word_2, 19);
+    rightSidestickPriorityLockedPitch = bitFromValue(busInputs.elac1->discrete_status_word_2, 20);
   } else if (sec2EngagedInPitch) {
-    leftSidestickDisabledPitch = bitFromValue(busInputs.sec2.discrete_status_word_2, 13);
-    rightSidestickDisabledPitch = bitFromValue(busInputs.sec2.discrete_status_word_2, 14);
-    leftSidestickPriorityLockedPitch = bitFromValue(busInputs.sec2.discrete_status_word_2, 15);
-    rightSidestickPriorityLockedPitch = bitFromValue(busInputs.sec2.discrete_status_word_2, 16);
+    leftSidestickDisabledPitch = bitFromValue(busInputs.sec2->discrete_status_word_2, 13);
+    rightSidestickDisabledPitch = bitFromValue(busInputs.sec2->discrete_status_word_2, 14);
+    leftSidestickPriorityLockedPitch = bitFromValue(busInputs.sec2->discrete_status_word_2, 15);
+    rightSidestickPriorityLockedPitch = bitFromValue(busInputs.sec2->discrete_status_word_2, 16);
   } else if (sec1EngagedInPitch) {
-    leftSidestickDisabledPitch = bitFromValue(busInputs.sec1.discrete_status_word_2, 13);
-    rightSidestickDisabledPitch = bitFromValue(busInputs.sec1.discrete_status_word_2, 14);
-    leftSidestickPriorityLockedPitch = bitFromValue(busInputs.sec1.discrete_status_word_2, 15);
-    rightSidestickPriorityLockedPitch = bitFromValue(busInputs.sec1.discrete_status_word_2, 16);
+    leftSidestickDisabledPitch = bitFromValue(busInputs.sec1->discrete_status_word_2, 13);
+    rightSidestickDisabledPitch = bitFromValue(busInputs.sec1->discrete_status_word_2, 14);
+    leftSidestickPriorityLockedPitch = bitFromValue(busInputs.sec1->discrete_status_word_2, 15);
+    rightSidestickPriorityLockedPitch = bitFromValue(busInputs.sec1->discrete_status_word_2, 16);
   }
 
   // Compute the overall sidestick priority status. A sidestick has lost priority,
@@ -497,9 +500,10 @@ void Fcdc::computeSidestickPriorityLights(double deltaTime) {
   }
 }
 
-// Write the bus output data and return it.
-FcdcBus Fcdc::getBusOutputs() {
-  FcdcBus output = {};
+// Write the bus output data, it stays valid until the next update.
+void Fcdc::writeBusOutputs() {
+  FcdcBus& output = busOutputs;
+  output = {};
 
   if (!monitoringHealthy) {
     output.efcsStatus1.setSsm(Arinc429SignStatus::FailureWarning);
@@ -528,7 +532,7 @@ FcdcBus Fcdc::getBusOutputs() {
     output.spoilerRight4Pos.setSsm(Arinc429SignStatus::FailureWarning);
     output.spoilerRight5Pos.setSsm(Arinc429SignStatus::FailureWarning);
 
-    return output;
+    return;
   }
 
   output.efcsStatus1.setSsm(Arinc429SignStatus::NormalOperation);
@@ -539,10 +543,10 @@ FcdcBus Fcdc::getBusOutputs() {
   output.efcsStatus1.setBit(16, systemLateralLaw == LateralLaw::NormalLaw);
   output.efcsStatus1.setBit(17, systemLateralLaw == LateralLaw::DirectLaw);
   output.efcsStatus1.setBit(18, false);  // No idea what this bit is supposed to mean
-  output.efcsStatus1.setBit(19, bitFromValueOr(busInputs.elac1.discrete_status_word_1, 21, true));
-  output.efcsStatus1.setBit(20, bitFromValueOr(busInputs.elac1.discrete_status_word_1, 22, true));
-  output.efcsStatus1.setBit(21, bitFromValueOr(busInputs.elac2.discrete_status_word_1, 21, true));
-  output.efcsStatus1.setBit(22, bitFromValueOr(busInputs.elac2.discrete_status_word_1, 22, true));
+  output.efcsStatus1.setBit(19, bitFromValueOr(busInputs.elac1->discrete_status_word_1, 21, true));
+  output.efcsStatus1.setBit(20, bitFromValueOr(busInputs.elac1->discrete_status_word_1, 22, true));
+  output.efcsStatus1.setBit(21, bitFromValueOr(busInputs.elac2->discrete_status_word_1, 21, true));
+  output.efcsStatus1.setBit(22, bitFromValueOr(busInputs.elac2->discrete_status_word_1, 22, true));
   output.efcsStatus1.setBit(23, !discreteInputs.elac1Valid);
   output.efcsStatus1.setBit(24, !discreteInputs.elac2Valid);
   output.efcsStatus1.setBit(25, !discreteInputs.sec1Valid);
@@ -551,20 +555,20 @@ FcdcBus Fcdc::getBusOutputs() {
   output.efcsStatus1.setBit(28, discreteInputs.oppFcdcFailed);
   output.efcsStatus1.setBit(29, !discreteInputs.sec3Valid);
 
-  bool leftElev1Fault = (!discreteInputs.elac1Valid || bitFromValueOr(busInputs.elac1.discrete_status_word_1, 21, false)) &&
-                        (!discreteInputs.sec1Valid || bitFromValueOr(busInputs.sec1.discrete_status_word_1, 13, false));
-  bool leftElev2Fault = (!discreteInputs.elac2Valid || bitFromValueOr(busInputs.elac2.discrete_status_word_1, 21, false)) &&
-                        (!discreteInputs.sec2Valid || bitFromValueOr(busInputs.sec2.discrete_status_word_1, 13, false));
-  bool rightElev1Fault = (!discreteInputs.elac1Valid || bitFromValueOr(busInputs.elac1.discrete_status_word_1, 21, false)) &&
-                         (!discreteInputs.sec1Valid || bitFromValueOr(busInputs.sec1.discrete_status_word_1, 14, false));
-  bool rightElev2Fault = (!discreteInputs.elac2Valid || bitFromValueOr(busInputs.elac2.discrete_status_word_1, 21, false)) &&
-                         (!discreteInputs.sec2Valid || bitFromValueOr(busInputs.sec2.discrete_status_word_1, 14, false));
+  bool leftElev1Fault = (!discreteInputs.elac1Valid || bitFromValueOr(busInputs.elac1->discrete_status_word_1, 21, false)) &&
+                        (!discreteInputs.sec1Valid || bitFromValueOr(busInputs.sec1->discrete_status_word_1, 13, false));
+  bool leftElev2Fault = (!discreteInputs.elac2Valid || bitFromValueOr(busInputs.elac2->discrete_status_word_1, 21, false)) &&
+                        (!discreteInputs.sec2Valid || bitFromValueOr(busInputs.sec2->discrete_status_word_1, 13, false));
+  bool rightElev1Fault = (!discreteInputs.elac1Valid || bitFromValueOr(busInputs.elac1->discrete_status_word_1, 21, false)) &&
+                         (!discreteInputs.sec1Valid || bitFromValueOr(busInputs.sec1->discrete_status_word_1, 14, false));
+  bool rightElev2Fault = (!discreteInputs.elac2Valid || bitFromValueOr(busInputs.elac2->discrete_status_word_1, 21, false)) &&
+                         (!discreteInputs.sec2Valid || bitFromValueOr(busInputs.sec2->discrete_status_word_1, 14, false));
 
   output.efcsStatus2.setSsm(Arinc429SignStatus::NormalOperation);
-  output.efcsStatus2.setBit(11, bitFromValueOr(busInputs.elac1.discrete_status_word_1, 11, true));
-  output.efcsStatus2.setBit(12, bitFromValueOr(busInputs.elac2.discrete_status_word_1, 11, true));
-  output.efcsStatus2.setBit(13, bitFromValueOr(busInputs.elac1.discrete_status_word_1, 12, true));
-  output.efcsStatus2.setBit(14, bitFromValueOr(busInputs.elac2.discrete_status_word_1, 12, true));
+  output.efcsStatus2.setBit(11, bitFromValueOr(busInputs.elac1->discrete_status_word_1, 11, true));
+  output.efcsStatus2.setBit(12, bitFromValueOr(busInputs.elac2->discrete_status_word_1, 11, true));
+  output.efcsStatus2.setBit(13, bitFromValueOr(busInputs.elac1->discrete_status_word_1, 12, true));
+  output.efcsStatus2.setBit(14, bitFromValueOr(busInputs.elac2->discrete_status_word_1, 12, true));
   output.efcsStatus2.setBit(15, leftElev1Fault);
   output.efcsStatus2.setBit(16, leftElev2Fault);
   output.efcsStatus2.setBit(17, rightElev1Fault);
@@ -582,74 +586,74 @@ FcdcBus Fcdc::getBusOutputs() {
   output.efcsStatus2.setBit(29, rightSidestickDisabled);
 
   output.efcsStatus3.setSsm(Arinc429SignStatus::NormalOperation);
-  output.efcsStatus3.setBit(11, bitFromValueOr(busInputs.elac1.discrete_status_word_1, 15, false));
-  output.efcsStatus3.setBit(12, bitFromValueOr(busInputs.elac2.discrete_status_word_1, 15, false));
-  output.efcsStatus3.setBit(13, bitFromValueOr(busInputs.elac1.discrete_status_word_1, 16, false));
-  output.efcsStatus3.setBit(14, bitFromValueOr(busInputs.elac2.discrete_status_word_1, 16, false));
-  output.efcsStatus3.setBit(15, bitFromValueOr(busInputs.elac1.discrete_status_word_1, 17, false) ||
-                                    bitFromValueOr(busInputs.sec1.discrete_status_word_1, 17, false));
-  output.efcsStatus3.setBit(16, bitFromValueOr(busInputs.elac2.discrete_status_word_1, 17, false) ||
-                                    bitFromValueOr(busInputs.sec2.discrete_status_word_1, 17, false));
-  output.efcsStatus3.setBit(17, bitFromValueOr(busInputs.elac1.discrete_status_word_1, 18, false) ||
-                                    bitFromValueOr(busInputs.sec1.discrete_status_word_1, 18, false));
-  output.efcsStatus3.setBit(18, bitFromValueOr(busInputs.elac2.discrete_status_word_1, 18, false) ||
-                                    bitFromValueOr(busInputs.sec2.discrete_status_word_1, 18, false));
+  output.efcsStatus3.setBit(11, bitFromValueOr(busInputs.elac1->discrete_status_word_1, 15, false));
+  output.efcsStatus3.setBit(12, bitFromValueOr(busInputs.elac2->discrete_status_word_1, 15, false));
+  output.efcsStatus3.setBit(13, bitFromValueOr(busInputs.elac1->discrete_status_word_1, 16, false));
+  output.efcsStatus3.setBit(14, bitFromValueOr(busInputs.elac2->discrete_status_word_1, 16, false));
+  output.efcsStatus3.setBit(15, bitFromValueOr(busInputs.elac1->discrete_status_word_1, 17, false) ||
+                                    bitFromValueOr(busInputs.sec1->discrete_status_word_1, 17, false));
+  output.efcsStatus3.setBit(16, bitFromValueOr(busInputs.elac2->discrete_status_word_1, 17, false) ||
+                                    bitFromValueOr(busInputs.sec2->discrete_status_word_1, 17, false));
+  output.efcsStatus3.setBit(17, bitFromValueOr(busInputs.elac1->discrete_status_word_1, 18, false) ||
+                                    bitFromValueOr(busInputs.sec1->discrete_status_word_1, 18, false));
+  output.efcsStatus3.setBit(18, bitFromValueOr(busInputs.elac2->discrete_status_word_1, 18, false) ||
+                                    bitFromValueOr(busInputs.sec2->discrete_status_word_1, 18, false));
   output.efcsStatus3.setBit(19, discreteInputs.elac1Off);
   output.efcsStatus3.setBit(20, discreteInputs.elac2Off);
-  output.efcsStatus3.setBit(21, bitFromValueOr(busInputs.sec3.discrete_status_word_1, 15, false));
-  output.efcsStatus3.setBit(22, bitFromValueOr(busInputs.sec3.discrete_status_word_1, 16, false));
-  output.efcsStatus3.setBit(23, bitFromValueOr(busInputs.sec1.discrete_status_word_1, 15, false));
-  output.efcsStatus3.setBit(24, bitFromValueOr(busInputs.sec1.discrete_status_word_1, 16, false));
-  output.efcsStatus3.setBit(25, bitFromValueOr(busInputs.sec2.discrete_status_word_1, 15, false));
+  output.efcsStatus3.setBit(21, bitFromValueOr(busInputs.sec3->discrete_status_word_1, 15, false));
+  output.efcsStatus3.setBit(22, bitFromValueOr(busInputs.sec3->discrete_status_word_1, 16, false));
+  output.efcsStatus3.setBit(23, bitFromValueOr(busInputs.sec1->discrete_status_word_1, 15, false));
+  output.efcsStatus3.setBit(24, bitFromValueOr(busInputs.sec1->discrete_status_word_1, 16, false));
+  output.efcsStatus3.setBit(25, bitFromValueOr(busInputs.sec2->discrete_status_word_1, 15, false));
   output.efcsStatus3.setBit(26, false);
   output.efcsStatus3.setBit(27, discreteInputs.sec1Off);
   output.efcsStatus3.setBit(28, discreteInputs.sec2Off);
   output.efcsStatus3.setBit(29, discreteInputs.sec3Off);
 
   output.efcsStatus4.setSsm(Arinc429SignStatus::NormalOperation);
-  output.efcsStatus4.setBit(11, valueOr(busInputs.sec3.left_spoiler_1_position_deg, 0) < -2.5);
-  output.efcsStatus4.setBit(12, valueOr(busInputs.sec3.right_spoiler_1_position_deg, 0) < -2.5);
-  output.efcsStatus4.setBit(13, valueOr(busInputs.sec3.left_spoiler_2_position_deg, 0) < -2.5);
-  output.efcsStatus4.setBit(14, valueOr(busInputs.sec3.right_spoiler_2_position_deg, 0) < -2.5);
-  output.efcsStatus4.setBit(15, valueOr(busInputs.sec1.left_spoiler_1_position_deg, 0) < -2.5);
-  output.efcsStatus4.setBit(16, valueOr(busInputs.sec1.right_spoiler_1_position_deg, 0) < -2.5);
-  output.efcsStatus4.setBit(17, valueOr(busInputs.sec1.left_spoiler_2_position_deg, 0) < -2.5);
-  output.efcsStatus4.setBit(18, valueOr(busInputs.sec1.right_spoiler_2_position_deg, 0) < -2.5);
-  output.efcsStatus4.setBit(19, valueOr(busInputs.sec2.left_spoiler_1_position_deg, 0) < -2.5);
-  output.efcsStatus4.setBit(20, valueOr(busInputs.sec2.right_spoiler_1_position_deg, 0) < -2.5);
-  output.efcsStatus4.setBit(21, isNo(busInputs.sec3.left_spoiler_1_position_deg) && isNo(busInputs.sec3.right_spoiler_1_position_deg));
-  output.efcsStatus4.setBit(22, isNo(busInputs.sec3.left_spoiler_2_position_deg) && isNo(busInputs.sec3.right_spoiler_2_position_deg));
-  output.efcsStatus4.setBit(23, isNo(busInputs.sec1.left_spoiler_1_position_deg) && isNo(busInputs.sec1.right_spoiler_1_position_deg));
-  output.efcsStatus4.setBit(24, isNo(busInputs.sec1.left_spoiler_2_position_deg) && isNo(busInputs.sec1.right_spoiler_2_position_deg));
-  output.efcsStatus4.setBit(25, isNo(busInputs.sec2.left_spoiler_1_position_deg) && isNo(busInputs.sec2.right_spoiler_1_position_deg));
-  output.efcsStatus4.setBit(26, bitFromValueOr(busInputs.sec1.discrete_status_word_1, 25, false) ||
-                                    bitFromValueOr(busInputs.sec2.discrete_status_word_1, 25, false) ||
-                                    bitFromValueOr(busInputs.sec3.discrete_status_word_1, 25, false));
-  output.efcsStatus4.setBit(27, bitFromValueOr(busInputs.sec1.discrete_status_word_1, 26, false) ||
-                                    bitFromValueOr(busInputs.sec2.discrete_status_word_1, 26, false) ||
-                                    bitFromValueOr(busInputs.sec3.discrete_status_word_1, 26, false));
-  output.efcsStatus4.setBit(28, valueOr(busInputs.sec1.speed_brake_lever_command_deg, 0) > 1.5 ||
-                                    valueOr(busInputs.sec2.speed_brake_lever_command_deg, 0) > 1.5 ||
-                                    valueOr(busInputs.sec3.speed_brake_lever_command_deg, 0) > 1.5);
-  output.efcsStatus4.setBit(29, bitFromValueOr(busInputs.elac1.discrete_status_word_2, 21, false) ||
-                                    bitFromValueOr(busInputs.elac2.discrete_status_word_2, 21, false));
+  output.efcsStatus4.setBit(11, valueOr(busInputs.sec3->left_spoiler_1_position_deg, 0) < -2.5);
+  output.efcsStatus4.setBit(12, valueOr(busInputs.sec3->right_spoiler_1_position_deg, 0) < -2.5);
+  output.efcsStatus4.setBit(13, valueOr(busInputs.sec3->left_spoiler_2_position_deg, 0) < -2.5);
+  output.efcsStatus4.setBit(14, valueOr(busInputs.sec3->right_spoiler_2_position_deg, 0) < -2.5);
+  output.efcsStatus4.setBit(15, valueOr(busInputs.sec1->left_spoiler_1_position_deg, 0) < -2.5);
+  output.efcsStatus4.setBit(16, valueOr(busInputs.sec1->right_spoiler_1_position_deg, 0) < -2.5);
+  output.efcsStatus4.setBit(17, valueOr(busInputs.sec1->left_spoiler_2_position_deg, 0) < -2.5);
+  output.efcsStatus4.setBit(18, valueOr(busInputs.sec1->right_spoiler_2_position_deg, 0) < -2.5);
+  output.efcsStatus4.setBit(19, valueOr(busInputs.sec2->left_spoiler_1_position_deg, 0) < -2.5);
+  output.efcsStatus4.setBit(20, valueOr(busInputs.sec2->right_spoiler_1_position_deg, 0) < -2.5);
+  output.efcsStatus4.setBit(21, isNo(busInputs.sec3->left_spoiler_1_position_deg) && isNo(busInputs.sec3->right_spoiler_1_position_deg));
+  output.efcsStatus4.setBit(22, isNo(busInputs.sec3->left_spoiler_2_position_deg) && isNo(busInputs.sec3->right_spoiler_2_position_deg));
+  output.efcsStatus4.setBit(23, isNo(busInputs.sec1->left_spoiler_1_position_deg) && isNo(busInputs.sec1->right_spoiler_1_position_deg));
+  output.efcsStatus4.setBit(24, isNo(busInputs.sec1->left_spoiler_2_position_deg) && isNo(busInputs.sec1->right_spoiler_2_position_deg));
+  output.efcsStatus4.setBit(25, isNo(busInputs.sec2->left_spoiler_1_position_deg) && isNo(busInputs.sec2->right_spoiler_1_position_deg));
+  output.efcsStatus4.setBit(26, bitFromValueOr(busInputs.sec1->discrete_status_word_1, 25, false) ||
+                                    bitFromValueOr(busInputs.sec2->discrete_status_word_1, 25, false) ||
+                                    bitFromValueOr(busInputs.sec3->discrete_status_word_1, 25, false));
+  output.efcsStatus4.setBit(27, bitFromValueOr(busInputs.sec1->discrete_status_word_1, 26, false) ||
+                                    bitFromValueOr(busInputs.sec2->discrete_status_word_1, 26, false) ||
+                                    bitFromValueOr(busInputs.sec3->discrete_status_word_1, 26, false));
+  output.efcsStatus4.setBit(28, valueOr(busInputs.sec1->speed_brake_lever_command_deg, 0) > 1.5 ||
+                                    valueOr(busInputs.sec2->speed_brake_lever_command_deg, 0) > 1.5 ||
+                                    valueOr(busInputs.sec3->speed_brake_lever_command_deg, 0) > 1.5);
+  output.efcsStatus4.setBit(29, bitFromValueOr(busInputs.elac1->discrete_status_word_2, 21, false) ||
+                                    bitFromValueOr(busInputs.elac2->discrete_status_word_2, 21, false));
 
   output.efcsStatus5.setSsm(Arinc429SignStatus::NormalOperation);
-  output.efcsStatus5.setBit(11, !isNo(busInputs.sec1.speed_brake_lever_command_deg) && discreteInputs.sec1Valid);
-  output.efcsStatus5.setBit(12, !isNo(busInputs.sec2.speed_brake_lever_command_deg) && discreteInputs.sec2Valid);
-  output.efcsStatus5.setBit(13, !isNo(busInputs.sec3.speed_brake_lever_command_deg) && discreteInputs.sec3Valid);
-  output.efcsStatus5.setBit(14, bitFromValueOr(busInputs.sec1.discrete_status_word_1, 24, false));
-  output.efcsStatus5.setBit(15, bitFromValueOr(busInputs.sec2.discrete_status_word_1, 24, false));
-  output.efcsStatus5.setBit(16, bitFromValueOr(busInputs.sec3.discrete_status_word_1, 24, false));
+  output.efcsStatus5.setBit(11, !isNo(busInputs.sec1->speed_brake_lever_command_deg) && discreteInputs.sec1Valid);
+  output.efcsStatus5.setBit(12, !isNo(busInputs.sec2->speed_brake_lever_command_deg) && discreteInputs.sec2Valid);
+  output.efcsStatus5.setBit(13, !isNo(busInputs.sec3->speed_brake_lever_command_deg) && discreteInputs.sec3Valid);
+  output.efcsStatus5.setBit(14, bitFromValueOr(busInputs.sec1->discrete_status_word_1, 24, false));
+  output.efcsStatus5.setBit(15, bitFromValueOr(busInputs.sec2->discrete_status_word_1, 24, false));
+  output.efcsStatus5.setBit(16, bitFromValueOr(busInputs.sec3->discrete_status_word_1, 24, false));
   output.efcsStatus5.setBit(17, false);
   output.efcsStatus5.setBit(18, false);
   output.efcsStatus5.setBit(19, false);
   output.efcsStatus5.setBit(20, false);
-  output.efcsStatus5.setBit(21, bitFromValueOr(busInputs.sec3.discrete_status_word_1, 11, false));
-  output.efcsStatus5.setBit(22, bitFromValueOr(busInputs.sec3.discrete_status_word_1, 12, false));
-  output.efcsStatus5.setBit(23, bitFromValueOr(busInputs.sec1.discrete_status_word_1, 11, false));
-  output.efcsStatus5.setBit(24, bitFromValueOr(busInputs.sec1.discrete_status_word_1, 12, false));
-  output.efcsStatus5.setBit(25, bitFromValueOr(busInputs.sec2.discrete_status_word_1, 11, false));
+  output.efcsStatus5.setBit(21, bitFromValueOr(busInputs.sec3->discrete_status_word_1, 11, false));
+  output.efcsStatus5.setBit(22, bitFromValueOr(busInputs.sec3->discrete_status_word_1, 12, false));
+  output.efcsStatus5.setBit(23, bitFromValueOr(busInputs.sec1->discrete_status_word_1, 11, false));
+  output.efcsStatus5.setBit(24, bitFromValueOr(busInputs.sec1->discrete_status_word_1, 12, false));
+  output.efcsStatus5.setBit(25, bitFromValueOr(busInputs.sec2->discrete_status_word_1, 11, false));
   output.efcsStatus5.setBit(26, false);
   output.efcsStatus5.setBit(27, false);
   output.efcsStatus5.setBit(28, false);
@@ -717,67 +721,66 @@ FcdcBus Fcdc::getBusOutputs() {
     output.foPitchCommand.setFromData(0, Arinc429SignStatus::FailureWarning);
   }
 
-  if (isNo(busInputs.sec3.left_spoiler_1_position_deg)) {
-    output.spoilerLeft1Pos.setFromData(busInputs.sec3.left_spoiler_1_position_deg.Data, Arinc429SignStatus::NormalOperation);
+  if (isNo(busInputs.sec3->left_spoiler_1_position_deg)) {
+    output.spoilerLeft1Pos.setFromData(busInputs.sec3->left_spoiler_1_position_deg.Data, Arinc429SignStatus::NormalOperation);
   } else {
     output.spoilerLeft1Pos.setFromData(0, Arinc429SignStatus::FailureWarning);
   }
-  if (isNo(busInputs.sec3.right_spoiler_1_position_deg)) {
-    output.spoilerRight1Pos.setFromData(busInputs.sec3.right_spoiler_1_position_deg.Data, Arinc429SignStatus::NormalOperation);
+  if (isNo(busInputs.sec3->right_spoiler_1_position_deg)) {
+    output.spoilerRight1Pos.setFromData(busInputs.sec3->right_spoiler_1_position_deg.Data, Arinc429SignStatus::NormalOperation);
   } else {
     output.spoilerRight1Pos.setFromData(0, Arinc429SignStatus::FailureWarning);
   }
 
-  if (isNo(busInputs.sec3.left_spoiler_2_position_deg)) {
-    output.spoilerLeft2Pos.setFromData(busInputs.sec3.left_spoiler_2_position_deg.Data, Arinc429SignStatus::NormalOperation);
+  if (isNo(busInputs.sec3->left_spoiler_2_position_deg)) {
+    output.spoilerLeft2Pos.setFromData(busInputs.sec3->left_spoiler_2_position_deg.Data, Arinc429SignStatus::NormalOperation);
   } else {
     output.spoilerLeft2Pos.setFromData(0, Arinc429SignStatus::FailureWarning);
   }
-  if (isNo(busInputs.sec3.right_spoiler_2_position_deg)) {
-    output.spoilerRight2Pos.setFromData(busInputs.sec3.right_spoiler_2_position_deg.Data, Arinc429SignStatus::NormalOperation);
+  if (isNo(busInputs.sec3->right_spoiler_2_position_deg)) {
+    output.spoilerRight2Pos.setFromData(busInputs.sec3->right_spoiler_2_position_deg.Data, Arinc429SignStatus::NormalOperation);
   } else {
     output.spoilerRight2Pos.setFromData(0, Arinc429SignStatus::FailureWarning);
   }
 
-  if (isNo(busInputs.sec1.left_spoiler_1_position_deg)) {
-    output.spoilerLeft3Pos.setFromData(busInputs.sec1.left_spoiler_1_position_deg.Data, Arinc429SignStatus::NormalOperation);
+  if (isNo(busInputs.sec1->left_spoiler_1_position_deg)) {
+    output.spoilerLeft3Pos.setFromData(busInputs.sec1->left_spoiler_1_position_deg.Data, Arinc429SignStatus::NormalOperation);
   } else {
     output.spoilerLeft3Pos.setFromData(0, Arinc429SignStatus::FailureWarning);
   }
-  if (isNo(busInputs.sec1.right_spoiler_1_position_deg)) {
-    output.spoilerRight3Pos.setFromData(busInputs.sec1.right_spoiler_1_position_deg.Data, Arinc429SignStatus::NormalOperation);
+  if (isNo(busInputs.sec1->right_spoiler_1_position_deg)) {
+    output.spoilerRight3Pos.setFromData(busInputs.sec1->right_spoiler_1_position_deg.Data, Arinc429SignStatus::NormalOperation);
   } else {
     output.spoilerRight3Pos.setFromData(0, Arinc429SignStatus::FailureWarning);
   }
 
-  if (isNo(busInputs.sec1.left_spoiler_2_position_deg)) {
-    output.spoilerLeft4Pos.setFromData(busInputs.sec1.left_spoiler_2_position_deg.Data, Arinc429SignStatus::NormalOperation);
+  if (isNo(busInputs.sec1->left_spoiler_2_position_deg)) {
+    output.spoilerLeft4Pos.setFromData(busInputs.sec1->left_spoiler_2_position_deg.Data, Arinc429SignStatus::NormalOperation);
   } else {
     output.spoilerLeft4Pos.setFromData(0, Arinc429SignStatus::FailureWarning);
   }
-  if (isNo(busInputs.sec1.right_spoiler_2_position_deg)) {
-    output.spoilerRight4Pos.setFromData(busInputs.sec1.right_spoiler_2_position_deg.Data, Arinc429SignStatus::NormalOperation);
+  if (isNo(busInputs.sec1->right_spoiler_2_position_deg)) {
+    output.spoilerRight4Pos.setFromData(busInputs.sec1->right_spoiler_2_position_deg.Data, Arinc429SignStatus::NormalOperation);
   } else {
     output.spoilerRight4Pos.setFromData(0, Arinc429SignStatus::FailureWarning);
   }
 
-  if (isNo(busInputs.sec2.left_spoiler_1_position_deg)) {
-    output.spoilerLeft5Pos.setFromData(busInputs.sec2.left_spoiler_1_position_deg.Data, Arinc429SignStatus::NormalOperation);
+  if (isNo(busInputs.sec2->left_spoiler_1_position_deg)) {
+    output.spoilerLeft5Pos.setFromData(busInputs.sec2->left_spoiler_1_position_deg.Data, Arinc429SignStatus::NormalOperation);
   } else {
     output.spoilerLeft5Pos.setFromData(0, Arinc429SignStatus::FailureWarning);
   }
-  if (isNo(busInputs.sec2.right_spoiler_1_position_deg)) {
-    output.spoilerRight5Pos.setFromData(busInputs.sec2.right_spoiler_1_position_deg.Data, Arinc429SignStatus::NormalOperation);
+  if (isNo(busInputs.sec2->right_spoiler_1_position_deg)) {
+    output.spoilerRight5Pos.setFromData(busInputs.sec2->right_spoiler_1_position_deg.Data, Arinc429SignStatus::NormalOperation);
   } else {
     output.spoilerRight5Pos.setFromData(0, Arinc429SignStatus::FailureWarning);
   }
-
-  return output;
 }
 
-// Write the discrete output data and return it.
-FcdcDiscreteOutputs Fcdc::getDiscreteOutputs() {
-  FcdcDiscreteOutputs output = {};
+// Write the discrete output data.
+void Fcdc::writeDiscreteOutputs() {
+  FcdcDiscreteOutputs& output = discreteOutputs;
+  output = {};
 
   if (!monitoringHealthy) {
     output.captRedPriorityLightOn = false;
@@ -792,6 +795,12 @@ FcdcDiscreteOutputs Fcdc::getDiscreteOutputs() {
     output.foRedPriorityLightOn = rightRedPriorityLightOn;
     output.foGreenPriorityLightOn = rightGreenPriorityLightOn;
   }
+}
+
+const FcdcBus& Fcdc::getBusOutputs() const {
+  return busOutputs;
+}
 
-  return output;
+const FcdcDiscreteOutputs& Fcdc::getDiscreteOutputs() const {
+  return discreteOutputs;
 }
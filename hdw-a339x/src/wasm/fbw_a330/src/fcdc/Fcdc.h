@@ -10,9 +10,9 @@ class Fcdc {
 
   void update(double deltaTime, bool faultActive, bool isPowered);
 
-  FcdcBus getBusOutputs();
+  const FcdcBus& getBusOutputs() const;
 
-  FcdcDiscreteOutputs getDiscreteOutputs();
+  const FcdcDiscreteOutputs& getDiscreteOutputs() const;
 
   FcdcDiscreteInputs discreteInputs;
 
@@ -39,6 +39,15 @@ class Fcdc {
 
   void computeSidestickPriorityLights(double deltaTime);
 
+  void writeBusOutputs();
+
+  void writeDiscreteOutputs();
+
+  // outputs of the last update
+  FcdcBus busOutputs = {};
+
+  FcdcDiscreteOutputs discreteOutputs = {};
+
   // Computer axis engagement vars
   bool elac1EngagedInRoll;
 
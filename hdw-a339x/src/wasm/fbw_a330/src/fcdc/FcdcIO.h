@@ -44,16 +44,17 @@ struct FcdcDiscreteOutputs {
   bool foGreenPriorityLightOn;
 };
 
+// outputs of the other computers, wired once when the interface connects
 struct FcdcBusInputs {
-  base_elac_out_bus elac1;
+  const base_elac_out_bus* elac1 = nullptr;
 
-  base_sec_out_bus sec1;
+  const base_sec_out_bus* sec1 = nullptr;
 
-  base_fcdc_bus fcdcOpp;
+  const base_fcdc_bus* fcdcOpp = nullptr;
 
-  base_elac_out_bus elac2;
+  const base_elac_out_bus* elac2 = nullptr;
 
-  base_sec_out_bus sec2;
+  const base_sec_out_bus* sec2 = nullptr;
 
-  base_sec_out_bus sec3;
+  const base_sec_out_bus* sec3 = nullptr;
 };
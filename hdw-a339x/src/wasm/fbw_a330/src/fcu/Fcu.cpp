@@ -1,7 +1,7 @@
 #include "Fcu.h"
 #include "../Arinc429Utils.h"
 
-Fcu::Fcu() {
+Fcu::Fcu() : modelInputs(fcuComputer.getExternalInputs()), modelOutputs(fcuComputer.getExternalOutputs().out) {
   fcuComputer.initialize();
 }
 
@@ -28,9 +28,9 @@ void Fcu::update(double deltaTime,
   fcuHealthy = monitoringHealthy[0] || monitoringHealthy[1];
   modelInputs.in.sim_data.computer_running = fcuHealthy;
 
-  fcuComputer.setExternalInputs(&modelInputs);
   fcuComputer.step();
-  modelOutputs = fcuComputer.getExternalOutputs().out;
+
+  writeOutputs();
 }
 
 void Fcu::monitorSelf(bool faultActive, int index) {
@@ -66,24 +66,24 @@ void Fcu::updateSelfTest(double deltaTime, int index) {
   }
 }
 
-base_fcu_bus Fcu::getBusOutputs() {
+void Fcu::writeOutputs() {
   if (!fcuHealthy) {
-    return {};
+    busOutputs = {};
+    discreteOutputs = {};
+    return;
   }
 
-  Arinc429Utils::setBit(modelOutputs.bus_outputs.fcu_discrete_word_2, 24, monitoringHealthy[0]);
-  Arinc429Utils::setBit(modelOutputs.bus_outputs.fcu_discrete_word_2, 25, monitoringHealthy[1]);
+  busOutputs = modelOutputs.bus_outputs;
+  Arinc429Utils::setBit(busOutputs.fcu_discrete_word_2, 24, monitoringHealthy[0]);
+  Arinc429Utils::setBit(busOutputs.fcu_discrete_word_2, 25, monitoringHealthy[1]);
 
-  return modelOutputs.bus_outputs;
+  discreteOutputs = modelOutputs.discrete_outputs;
 }
 
-base_fcu_discrete_outputs Fcu::getDiscreteOutputs() {
-  base_fcu_discrete_outputs output = {};
+const base_fcu_bus& Fcu::getBusOutputs() const {
+  return busOutputs;
+}
 
-  output.fcu_healthy = fcuHealthy;
-  if (!fcuHealthy) {
-    return output;
-  } else {
-    return modelOutputs.discrete_outputs;
-  }
+const base_fcu_discrete_outputs& Fcu::getDiscreteOutputs() const {
+  return discreteOutputs;
 }
@@ -2,16 +2,20 @@
 #include "../model/FcuComputer.h"
 
 class Fcu {
+  // Model, declared first so that it is constructed before the references to its inputs and outputs
+  FcuComputer fcuComputer;
+
  public:
   Fcu();
 
   void update(double deltaTime, double simulationTime, bool fcu1FaultActive, bool fcu2FaultActive, bool fcu1IsPowered, bool fcu2IsPowered);
 
-  base_fcu_bus getBusOutputs();
+  const base_fcu_bus& getBusOutputs() const;
 
-  base_fcu_discrete_outputs getDiscreteOutputs();
+  const base_fcu_discrete_outputs& getDiscreteOutputs() const;
 
-  FcuComputer::ExternalInputs_FcuComputer_T modelInputs = {};
+  // inputs of the model, written in place before update()
+  FcuComputer::ExternalInputs_FcuComputer_T& modelInputs;
 
  private:
   void initSelfTests(int index);
@@ -22,9 +26,13 @@ class Fcu {
 
   void updateSelfTest(double deltaTime, int index);
 
-  // Model
-  FcuComputer fcuComputer;
-  fcu_outputs modelOutputs;
+  void writeOutputs();
+
+  const fcu_outputs& modelOutputs;
+
+  // outputs of the last update
+  base_fcu_bus busOutputs = {};
+  base_fcu_discrete_outputs discreteOutputs = {};
 
   // Computer Self-monitoring vars
   bool fcuHealthy;
@@ -1,11 +1,13 @@
 #include "Fmgc.h"
 #include "../Arinc429.h"
 
-Fmgc::Fmgc(bool isUnit1) : isUnit1(isUnit1) {
+Fmgc::Fmgc(bool isUnit1)
+    : modelInputs(fmgcComputer.getExternalInputs()), modelOutputs(fmgcComputer.getExternalOutputs().out), isUnit1(isUnit1) {
   fmgcComputer.initialize();
 }
 
-Fmgc::Fmgc(const Fmgc& obj) : isUnit1(obj.isUnit1) {
+Fmgc::Fmgc(const Fmgc& obj)
+    : modelInputs(fmgcComputer.getExternalInputs()), modelOutputs(fmgcComputer.getExternalOutputs().out), isUnit1(obj.isUnit1) {
   fmgcComputer.initialize();
 }
 
@@ -33,9 +35,9 @@ void Fmgc::update(double deltaTime, double simulationTime, bool faultActive, boo
   monitorSelf(faultActive);
 
   modelInputs.in.sim_data.computer_running = monitoringHealthy;
-  fmgcComputer.setExternalInputs(&modelInputs);
   fmgcComputer.step();
-  modelOutputs = fmgcComputer.getExternalOutputs().out;
+
+  writeOutputs();
 }
 
 // Perform self monitoring
@@ -77,34 +79,27 @@ void Fmgc::updateSelfTest(double deltaTime) {
   }
 }
 
-// Write the discrete output data and return it.
-base_fmgc_discrete_outputs Fmgc::getDiscreteOutputs() {
-  base_fmgc_discrete_outputs output = {};
-
-  output.fmgc_healthy = !monitoringHealthy;
+// Write the output data of the update, it stays valid until the next update.
+void Fmgc::writeOutputs() {
   if (!monitoringHealthy) {
-    output.athr_own_engaged = false;
-    output.fd_own_engaged = false;
-    output.ap_own_engaged = false;
-    output.fcu_own_fail = false;
-    output.ils_test_inhibit = false;
-  } else {
-    output = modelOutputs.discrete_outputs;
+    busOutputs = {};
+
+    // all other discretes are false
+    discreteOutputs = {};
+    discreteOutputs.fmgc_healthy = !monitoringHealthy;
+    return;
   }
 
-  return output;
+  busOutputs = modelOutputs.bus_outputs;
+  discreteOutputs = modelOutputs.discrete_outputs;
 }
 
-base_fmgc_bus_outputs Fmgc::getBusOutputs() {
-  base_fmgc_bus_outputs output = {};
-
-  if (!monitoringHealthy) {
-    return output;
-  }
-
-  output = modelOutputs.bus_outputs;
+const base_fmgc_bus_outputs& Fmgc::getBusOutputs() const {
+  return busOutputs;
+}
 
-  return output;
+const base_fmgc_discrete_outputs& Fmgc::getDiscreteOutputs() const {
+  return discreteOutputs;
 }
 
 const fmgc_outputs& Fmgc::getDebugOutputs() const {
@@ -2,6 +2,9 @@
 #include "../model/FmgcComputer.h"
 
 class Fmgc {
+  // Model, declared first so that it is constructed before the references to its inputs and outputs
+  FmgcComputer fmgcComputer;
+
  public:
   Fmgc(bool isUnit1);
 
@@ -9,13 +12,14 @@ class Fmgc {
 
   void update(double deltaTime, double simulationTime, bool faultActive, bool isPowered);
 
-  base_fmgc_bus_outputs getBusOutputs();
+  const base_fmgc_bus_outputs& getBusOutputs() const;
 
-  base_fmgc_discrete_outputs getDiscreteOutputs();
+  const base_fmgc_discrete_outputs& getDiscreteOutputs() const;
 
   const fmgc_outputs& getDebugOutputs() const;
 
-  FmgcComputer::ExternalInputs_FmgcComputer_T modelInputs = {};
+  // inputs of the model, written in place before update()
+  FmgcComputer::ExternalInputs_FmgcComputer_T& modelInputs;
 
  private:
   void initSelfTests();
@@ -28,9 +32,13 @@ class Fmgc {
 
   void updateSelfTest(double deltaTime);
 
-  // Model
-  FmgcComputer fmgcComputer;
-  fmgc_outputs modelOutputs;
+  void writeOutputs();
+
+  const fmgc_outputs& modelOutputs;
+
+  // outputs of the last update
+  base_fmgc_bus_outputs busOutputs = {};
+  base_fmgc_discrete_outputs discreteOutputs = {};
 
   // Computer Self-monitoring vars
   bool monitoringHealthy;
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <cstdint>
+
+#include "../model/ElacComputer_types.h"
+#include "../model/FacComputer_types.h"
+#include "../model/FadecComputer_types.h"
+#include "../model/FcuComputer_types.h"
+#include "../model/FmgcComputer_types.h"
+#include "../model/SecComputer_types.h"
+
+/**
+ * @brief Header of the packed client data blocks used by the bulk transfer mode.
+ *
+ * The blocks are exchanged in the native layout of the structs below, the version needs to be increased whenever one
+ * of them changes. The sim increments the sequence number of every input block it sends, the external computers
+ * answer with an output block carrying the sequence number of the input block the outputs were computed from. Both
+ * sides can detect lost frames by gaps in the sequence and stale frames by a sequence that is not newer than the last.
+ */
+struct ClientDataBlockHeader {
+  std::uint32_t version;
+  std::uint32_t size;
+  std::uint32_t sequence;
+  std::uint32_t reserved;
+};
+
+constexpr std::uint32_t CLIENT_DATA_BLOCK_VERSION = 1;
+
+// maximum size of a client data area supported by SimConnect
+constexpr std::uint32_t CLIENT_DATA_BLOCK_MAXIMUM_SIZE = 8192;
+
+/**
+ * @brief Block sent by the sim once per frame, contains the inputs of the disabled computers and the busses they read.
+ */
+struct ClientDataInputBlock {
+  ClientDataBlockHeader header;
+
+  base_elac_discrete_inputs elacDiscreteInputs;
+  base_elac_analog_inputs elacAnalogInputs;
+  base_elac_out_bus elacBusses[2];
+
+  base_sec_discrete_inputs secDiscreteInputs;
+  base_sec_analog_inputs secAnalogInputs;
+  base_sec_out_bus secBusses[2];
+
+  base_fac_discrete_inputs facDiscreteInputs;
+  base_fac_analog_inputs facAnalogInputs;
+  base_fac_bus facBusses[2];
+
+  base_fcu_bus fcuBus;
+
+  base_fmgc_discrete_inputs fmgcDiscreteInputs;
+  base_fms_inputs fmgcFmsInputs;
+  base_fmgc_a_bus fmgcABusses[2];
+  base_fmgc_b_bus fmgcBBusses[2];
+
+  athr_data fadecData;
+  athr_input fadecInputs;
+  base_ecu_bus fadecBusses[2];
+
+  base_adr_bus adrBusses[3];
+  base_ir_bus irBusses[3];
+  base_ra_bus raBusses[2];
+  base_lgciu_bus lgciuBusses[2];
+  base_sfcc_bus sfccBusses[2];
+  base_ils_bus ilsBusses[2];
+  base_tcas_bus tcasBus;
+};
+
+/**
+ * @brief Block sent by the external computers, contains the outputs of the disabled computers.
+ */
+struct ClientDataOutputBlock {
+  ClientDataBlockHeader header;
+
+  base_elac_discrete_outputs elacDiscreteOutputs;
+  base_elac_analog_outputs elacAnalogOutputs;
+  base_elac_out_bus elacBus;
+
+  base_sec_discrete_outputs secDiscreteOutputs;
+  base_sec_analog_outputs secAnalogOutputs;
+  base_sec_out_bus secBus;
+
+  base_fac_discrete_outputs facDiscreteOutputs;
+  base_fac_analog_outputs facAnalogOutputs;
+  base_fac_bus facBus;
+
+  base_fcu_discrete_outputs fcuDiscreteOutputs;
+  base_fcu_bus fcuBus;
+
+  base_fmgc_discrete_outputs fmgcDiscreteOutputs;
+  base_fmgc_a_bus fmgcABus;
+  base_fmgc_b_bus fmgcBBus;
+
+  athr_output fadecOutputs;
+};
+
+static_assert(sizeof(ClientDataInputBlock) <= CLIENT_DATA_BLOCK_MAXIMUM_SIZE, "input block exceeds the size of a client data area");
+static_assert(sizeof(ClientDataOutputBlock) <= CLIENT_DATA_BLOCK_MAXIMUM_SIZE, "output block exceeds the size of a client data area");
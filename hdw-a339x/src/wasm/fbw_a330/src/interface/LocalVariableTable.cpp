@@ -0,0 +1,68 @@
+#include "LocalVariableTable.h"
+
+#include <limits>
+
+LocalVariableTable::ScopedFlush::ScopedFlush(LocalVariableTable& table) : table(table) {}
+
+LocalVariableTable::ScopedFlush::~ScopedFlush() {
+  table.flush();
+}
+
+std::unique_ptr<CachedLocalVariable> LocalVariableTable::create(const std::string& name, bool writeOnlyWhenChanged) {
+  auto existing = indices.find(name);
+  if (existing != indices.end()) {
+    // a variable shared by several handles only skips writes when every handle allows it
+    writeOnlyWhenChangedFlags[existing->second] &= writeOnlyWhenChanged;
+    return std::make_unique<CachedLocalVariable>(*this, existing->second);
+  }
+
+  std::size_t index = ids.size();
+  indices.emplace(name, index);
+  names.push_back(name);
+  ids.push_back(register_named_variable(name.c_str()));
+  values.push_back(0);
+  // the value in the simulator is unknown until it is read or written, so the first write always goes through
+  simulatorValues.push_back(std::numeric_limits<double>::quiet_NaN());
+  valueFrames.push_back(0);
+  writeOnlyWhenChangedFlags.push_back(writeOnlyWhenChanged);
+  dirtyFlags.push_back(0);
+  return std::make_unique<CachedLocalVariable>(*this, index);
+}
+
+double LocalVariableTable::get(std::size_t index) {
+  if (valueFrames[index] != frame) {
+    simulatorValues[index] = get_named_variable_value(ids[index]);
+    values[index] = simulatorValues[index];
+    valueFrames[index] = frame;
+  }
+  return values[index];
+}
+
+void LocalVariableTable::set(std::size_t index, double value) {
+  values[index] = value;
+  valueFrames[index] = frame;
+  if (!dirtyFlags[index]) {
+    dirtyFlags[index] = 1;
+    dirtyIndices.push_back(index);
+  }
+}
+
+const std::string& LocalVariableTable::getName(std::size_t index) const {
+  return names[index];
+}
+
+void LocalVariableTable::beginFrame() {
+  frame++;
+}
+
+void LocalVariableTable::flush() {
+  for (std::size_t index : dirtyIndices) {
+    // NaN never compares equal, so it is always written
+    if (!writeOnlyWhenChangedFlags[index] || values[index] != simulatorValues[index]) {
+      set_named_variable_value(ids[index], values[index]);
+      simulatorValues[index] = values[index];
+    }
+    dirtyFlags[index] = 0;
+  }
+  dirtyIndices.clear();
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <MSFS/Legacy/gauges.h>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class CachedLocalVariable;
+
+/**
+ * @brief Flat table of local variables that batches the accesses to the simulator.
+ *
+ * A variable is read from the simulator when it is first used in a frame, later reads within the frame use the cached
+ * value. Writes only update the table and mark the variable dirty, flush() pushes every value written in the frame, so
+ * that the value of the module wins over changes of other gauges or cockpit events. Only variables created with
+ * writeOnlyWhenChanged skip writes of the value last known to be in the simulator, this must only be used for
+ * variables no one else writes. Creating a variable again returns a handle to the same entry.
+ */
+class LocalVariableTable {
+ public:
+  /**
+   * @brief Flushes the table when it goes out of scope, so that every exit of a frame writes the dirty values.
+   */
+  class ScopedFlush {
+   public:
+    explicit ScopedFlush(LocalVariableTable& table);
+    ~ScopedFlush();
+
+   private:
+    LocalVariableTable& table;
+  };
+
+  std::unique_ptr<CachedLocalVariable> create(const std::string& name, bool writeOnlyWhenChanged = false);
+
+  double get(std::size_t index);
+
+  void set(std::size_t index, double value);
+
+  const std::string& getName(std::size_t index) const;
+
+  /**
+   * @brief Starts a new frame, the next read of every variable is taken from the simulator.
+   */
+  void beginFrame();
+
+  /**
+   * @brief Writes the values of the dirty variables to the simulator.
+   */
+  void flush();
+
+ private:
+  std::vector<std::string> names;
+  std::unordered_map<std::string, std::size_t> indices;
+  std::vector<ID> ids;
+  // value seen by the module, including pending writes
+  std::vector<double> values;
+  // last value read from or written to the simulator
+  std::vector<double> simulatorValues;
+  // frame in which the value was last read or written
+  std::vector<uint32_t> valueFrames;
+  std::vector<uint8_t> writeOnlyWhenChangedFlags;
+  std::vector<uint8_t> dirtyFlags;
+  std::vector<std::size_t> dirtyIndices;
+  // starts at 1 so that no variable counts as read before the first frame
+  uint32_t frame = 1;
+};
+
+/**
+ * @brief Handle of a variable in a LocalVariableTable with the interface of LocalVariable.
+ */
+class CachedLocalVariable {
+ public:
+  CachedLocalVariable(LocalVariableTable& table, std::size_t index) : table(table), index(index) {}
+
+  double get() const { return table.get(index); }
+
+  void set(double value) { table.set(index, value); }
+
+  const std::string& getName() const { return table.getName(index); }
+
+ private:
+  LocalVariableTable& table;
+  std::size_t index;
+};
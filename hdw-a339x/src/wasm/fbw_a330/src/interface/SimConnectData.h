@@ -3,7 +3,19 @@
 #include <MSFS/Legacy/gauges.h>
 #include <SimConnect.h>
 
-struct SimData {
+/**
+ * @brief Base of the data that is received once per frame and shared by all stages of the update.
+ *
+ * The stages only get const references to the single instance held by the SimConnectInterface, copying it is prevented
+ * by the deleted copy constructor. Assignment stays available to store the received data.
+ */
+struct FrameSnapshot {
+  FrameSnapshot() = default;
+  FrameSnapshot(const FrameSnapshot&) = delete;
+  FrameSnapshot& operator=(const FrameSnapshot&) = default;
+};
+
+struct SimData : FrameSnapshot {
   double nz_g;
   double Theta_deg;
   double Phi_deg;
@@ -120,17 +132,17 @@ struct SimData {
   double seaLevelPressure;
 };
 
-struct SimInput {
+struct SimInput : FrameSnapshot {
   double inputs[3];
 };
 
-struct SimInputRudderTrim {
+struct SimInputRudderTrim : FrameSnapshot {
   bool rudderTrimSwitchLeft;
   bool rudderTrimSwitchRight;
   bool rudderTrimReset;
 };
 
-struct SimInputAutopilot {
+struct SimInputAutopilot : FrameSnapshot {
   double AP_engage;
   double AP_1_push;
   double AP_2_push;
@@ -156,7 +168,7 @@ struct SimInputAutopilot {
   double VS_FPA_set;
 };
 
-struct SimInputThrottles {
+struct SimInputThrottles : FrameSnapshot {
   double ATHR_push;
   double ATHR_disconnect;
   double ATHR_reset_disable;
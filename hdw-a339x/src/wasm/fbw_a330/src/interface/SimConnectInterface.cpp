@@ -1,7 +1,9 @@
 #include "SimConnectInterface.h"
 #include <cmath>
+#include <cstring>
 #include <iostream>
 #include <map>
+#include <sstream>
 #include <vector>
 
 // remove when aileron events can be processed via SimConnect
@@ -12,6 +14,7 @@ SimInput SimConnectInterface::simInput = {};
 double SimConnectInterface::flightControlsKeyChangeAileron = 0.0;
 
 bool SimConnectInterface::connect(bool clientDataEnabled,
+                                  bool clientDataBulkTransferEnabled,
                                   int elacDisabled,
                                   int secDisabled,
                                   int facDisabled,
@@ -47,6 +50,7 @@ bool SimConnectInterface::connect(bool clientDataEnabled,
     this->limitSimulationRateByPerformance = limitSimulationRateByPerformance;
     // store is client data is enabled
     this->clientDataEnabled = clientDataEnabled;
+    this->clientDataBulkTransferEnabled = clientDataEnabled && clientDataBulkTransferEnabled;
     this->elacDisabled = elacDisabled;
     this->secDisabled = secDisabled;
     this->facDisabled = facDisabled;
@@ -66,7 +70,7 @@ bool SimConnectInterface::connect(bool clientDataEnabled,
     prepareResult &= prepareSimInputSimConnectDataDefinitions();
     prepareResult &= prepareSimOutputSimConnectDataDefinitions();
     if (clientDataEnabled) {
-      prepareResult &= prepareClientDataDefinitions();
+      prepareResult &= this->clientDataBulkTransferEnabled ? prepareClientDataBlockDefinitions() : prepareClientDataDefinitions();
     }
     // check result
     if (!prepareResult) {
@@ -99,6 +103,10 @@ void SimConnectInterface::disconnect() {
     SimConnect_UnsubscribeFromSystemEvent(hSimConnect, Events::SYSTEM_EVENT_PAUSE);
     // info message
     std::cout << "WASM: Disconnecting..." << std::endl;
+    if (clientDataBulkTransferEnabled) {
+      std::cout << "WASM: Client data blocks: sent = " << clientDataInputBlock.header.sequence;
+      std::cout << ", lost = " << clientDataLostFrames << ", stale = " << clientDataStaleFrames << std::endl;
+    }
     // close connection
     SimConnect_Close(hSimConnect);
     // set flag
@@ -119,6 +127,22 @@ void SimConnectInterface::updateSimulationRateLimits(double minSimulationRate, d
   this->maxSimulationRate = maxSimulationRate;
 }
 
+void SimConnectInterface::setLimitSimulationRateByPerformance(bool enabled) {
+  limitSimulationRateByPerformance = enabled;
+}
+
+void SimConnectInterface::updateFlightControlsConfiguration(double keyChangeAileron,
+                                                            double keyChangeElevator,
+                                                            double keyChangeRudder,
+                                                            bool disableXboxCompatibilityRudderPlusMinus,
+                                                            bool enableRudder2AxisMode) {
+  flightControlsKeyChangeAileron = keyChangeAileron;
+  flightControlsKeyChangeElevator = keyChangeElevator;
+  flightControlsKeyChangeRudder = keyChangeRudder;
+  this->disableXboxCompatibilityRudderPlusMinus = disableXboxCompatibilityRudderPlusMinus;
+  this->enableRudder2AxisMode = enableRudder2AxisMode;
+}
+
 bool SimConnectInterface::isSimInAnyPause() {
   return (pauseState > 0);
 }
@@ -258,6 +282,8 @@ bool SimConnectInterface::prepareSimDataSimConnectDataDefinitions() {
 bool SimConnectInterface::prepareSimInputSimConnectDataDefinitions() {
   bool result = true;
 
+  registerEventHandlers();
+
   result &= addInputDataDefinition(hSimConnect, 0, Events::AXIS_ELEVATOR_SET, "AXIS_ELEVATOR_SET", true);
   result &= addInputDataDefinition(hSimConnect, 0, Events::AXIS_AILERONS_SET, "AXIS_AILERONS_SET", true);
   result &= addInputDataDefinition(hSimConnect, 0, Events::AXIS_RUDDER_SET, "AXIS_RUDDER_SET", true);
@@ -1012,6 +1038,64 @@ bool SimConnectInterface::prepareClientDataDefinitions() {
   return SUCCEEDED(result);
 }
 
+bool SimConnectInterface::prepareClientDataBlockDefinitions() {
+  bool result = true;
+
+  // map client ids
+  result &= SimConnect_MapClientDataNameToID(hSimConnect, "A32NX_CLIENT_DATA_INPUT_BLOCK", ClientData::CLIENT_DATA_INPUT_BLOCK) == S_OK;
+  result &= SimConnect_MapClientDataNameToID(hSimConnect, "A32NX_CLIENT_DATA_OUTPUT_BLOCK", ClientData::CLIENT_DATA_OUTPUT_BLOCK) == S_OK;
+  // create client data
+  result &= SimConnect_CreateClientData(hSimConnect, ClientData::CLIENT_DATA_INPUT_BLOCK, sizeof(ClientDataInputBlock),
+                                        SIMCONNECT_CREATE_CLIENT_DATA_FLAG_DEFAULT) == S_OK;
+  result &= SimConnect_CreateClientData(hSimConnect, ClientData::CLIENT_DATA_OUTPUT_BLOCK, sizeof(ClientDataOutputBlock),
+                                        SIMCONNECT_CREATE_CLIENT_DATA_FLAG_DEFAULT) == S_OK;
+  // add data definitions, the blocks are transferred as one opaque chunk of bytes
+  result &= SimConnect_AddToClientDataDefinition(hSimConnect, ClientData::CLIENT_DATA_INPUT_BLOCK, 0, sizeof(ClientDataInputBlock)) == S_OK;
+  result &=
+      SimConnect_AddToClientDataDefinition(hSimConnect, ClientData::CLIENT_DATA_OUTPUT_BLOCK, 0, sizeof(ClientDataOutputBlock)) == S_OK;
+  // request output data to be updated when set
+  result &= SimConnect_RequestClientData(hSimConnect, ClientData::CLIENT_DATA_OUTPUT_BLOCK, ClientData::CLIENT_DATA_OUTPUT_BLOCK,
+                                         ClientData::CLIENT_DATA_OUTPUT_BLOCK, SIMCONNECT_CLIENT_DATA_PERIOD_ON_SET) == S_OK;
+
+  // location of the individual client data areas in the input block
+  auto addField = [this](int id, void* data, DWORD size) { clientDataInputBlockFields[id] = {data, size}; };
+  ClientDataInputBlock& block = clientDataInputBlock;
+  addField(ClientData::ELAC_DISCRETE_INPUTS, &block.elacDiscreteInputs, sizeof(block.elacDiscreteInputs));
+  addField(ClientData::ELAC_ANALOG_INPUTS, &block.elacAnalogInputs, sizeof(block.elacAnalogInputs));
+  addField(ClientData::SEC_DISCRETE_INPUTS, &block.secDiscreteInputs, sizeof(block.secDiscreteInputs));
+  addField(ClientData::SEC_ANALOG_INPUTS, &block.secAnalogInputs, sizeof(block.secAnalogInputs));
+  addField(ClientData::FAC_DISCRETE_INPUTS, &block.facDiscreteInputs, sizeof(block.facDiscreteInputs));
+  addField(ClientData::FAC_ANALOG_INPUTS, &block.facAnalogInputs, sizeof(block.facAnalogInputs));
+  addField(ClientData::FCU_BUS_OUTPUT, &block.fcuBus, sizeof(block.fcuBus));
+  addField(ClientData::FMGC_DISCRETE_INPUTS, &block.fmgcDiscreteInputs, sizeof(block.fmgcDiscreteInputs));
+  addField(ClientData::FMGC_FMS_INPUTS, &block.fmgcFmsInputs, sizeof(block.fmgcFmsInputs));
+  addField(ClientData::FADEC_DATA, &block.fadecData, sizeof(block.fadecData));
+  addField(ClientData::FADEC_INPUTS, &block.fadecInputs, sizeof(block.fadecInputs));
+  addField(ClientData::TCAS_BUS, &block.tcasBus, sizeof(block.tcasBus));
+  for (int i = 0; i < 2; i++) {
+    addField(ClientData::ELAC_1_BUS_OUTPUT + i, &block.elacBusses[i], sizeof(block.elacBusses[i]));
+    addField(ClientData::SEC_1_BUS_OUTPUT + i, &block.secBusses[i], sizeof(block.secBusses[i]));
+    addField(ClientData::FAC_1_BUS_OUTPUT + i, &block.facBusses[i], sizeof(block.facBusses[i]));
+    addField(ClientData::FMGC_1_BUS_A_OUTPUT + i, &block.fmgcABusses[i], sizeof(block.fmgcABusses[i]));
+    addField(ClientData::FMGC_1_BUS_B_OUTPUT + i, &block.fmgcBBusses[i], sizeof(block.fmgcBBusses[i]));
+    addField(ClientData::FADEC_1_BUS + i, &block.fadecBusses[i], sizeof(block.fadecBusses[i]));
+    addField(ClientData::RA_1_BUS + i, &block.raBusses[i], sizeof(block.raBusses[i]));
+    addField(ClientData::LGCIU_1_BUS + i, &block.lgciuBusses[i], sizeof(block.lgciuBusses[i]));
+    addField(ClientData::SFCC_1_BUS + i, &block.sfccBusses[i], sizeof(block.sfccBusses[i]));
+    addField(ClientData::ILS_1_BUS + i, &block.ilsBusses[i], sizeof(block.ilsBusses[i]));
+  }
+  for (int i = 0; i < 3; i++) {
+    addField(ClientData::ADR_1_INPUTS + i, &block.adrBusses[i], sizeof(block.adrBusses[i]));
+    addField(ClientData::IR_1_INPUTS + i, &block.irBusses[i], sizeof(block.irBusses[i]));
+  }
+
+  block.header.version = CLIENT_DATA_BLOCK_VERSION;
+  block.header.size = sizeof(ClientDataInputBlock);
+  block.header.sequence = 0;
+
+  return result;
+}
+
 bool SimConnectInterface::requestData() {
   // check if we are connected
   if (!isConnected) {
@@ -1043,6 +1127,7 @@ bool SimConnectInterface::readData() {
   while (SUCCEEDED(SimConnect_GetNextDispatch(hSimConnect, &pData, &cbData))) {
     simConnectProcessDispatchMessage(pData, &cbData);
   }
+  applyPendingAxisEvents();
 
   // success
   return true;
@@ -1120,15 +1205,15 @@ bool SimConnectInterface::sendEventEx1(Events eventId, DWORD priority, DWORD dat
   return true;
 }
 
-SimData& SimConnectInterface::getSimData() {
+const SimData& SimConnectInterface::getSimData() const {
   return simData;
 }
 
-SimInput& SimConnectInterface::getSimInput() {
+const SimInput& SimConnectInterface::getSimInput() const {
   return simInput;
 }
 
-SimInputAutopilot& SimConnectInterface::getSimInputAutopilot() {
+const SimInputAutopilot& SimConnectInterface::getSimInputAutopilot() const {
   return simInputAutopilot;
 }
 
@@ -1140,11 +1225,11 @@ base_fcu_efis_panel_inputs& SimConnectInterface::getFcuEfisPanelInputs(int side)
   return fcuEfisPanelInputs[side];
 }
 
-SimInputRudderTrim& SimConnectInterface::getSimInputRudderTrim() {
+const SimInputRudderTrim& SimConnectInterface::getSimInputRudderTrim() const {
   return simInputRudderTrim;
 }
 
-SimInputThrottles& SimConnectInterface::getSimInputThrottles() {
+const SimInputThrottles& SimConnectInterface::getSimInputThrottles() const {
   return simInputThrottles;
 }
 
@@ -1236,7 +1321,7 @@ bool SimConnectInterface::setClientDataElacAnalog(base_elac_analog_inputs& outpu
   return sendClientData(ClientData::ELAC_ANALOG_INPUTS, sizeof(output), &output);
 }
 
-bool SimConnectInterface::setClientDataElacBusInput(base_elac_out_bus& output, int elacIndex) {
+bool SimConnectInterface::setClientDataElacBusInput(const base_elac_out_bus& output, int elacIndex) {
   return sendClientData(ClientData::ELAC_1_BUS_OUTPUT + elacIndex, sizeof(output), &output);
 }
 
@@ -1248,7 +1333,7 @@ bool SimConnectInterface::setClientDataSecAnalog(base_sec_analog_inputs& output)
   return sendClientData(ClientData::SEC_ANALOG_INPUTS, sizeof(output), &output);
 }
 
-bool SimConnectInterface::setClientDataSecBus(base_sec_out_bus& output, int secIndex) {
+bool SimConnectInterface::setClientDataSecBus(const base_sec_out_bus& output, int secIndex) {
   if (secIndex < 2) {
     return sendClientData(ClientData::SEC_1_BUS_OUTPUT + secIndex, sizeof(output), &output);
   } else {
@@ -1264,11 +1349,11 @@ bool SimConnectInterface::setClientDataFacAnalog(base_fac_analog_inputs& output)
   return sendClientData(ClientData::FAC_ANALOG_INPUTS, sizeof(output), &output);
 }
 
-bool SimConnectInterface::setClientDataFacBus(base_fac_bus& output, int facIndex) {
+bool SimConnectInterface::setClientDataFacBus(const base_fac_bus& output, int facIndex) {
   return sendClientData(ClientData::FAC_1_BUS_OUTPUT + facIndex, sizeof(output), &output);
 }
 
-bool SimConnectInterface::setClientDataFcuBus(base_fcu_bus& output) {
+bool SimConnectInterface::setClientDataFcuBus(const base_fcu_bus& output) {
   return sendClientData(ClientData::FCU_BUS_OUTPUT, sizeof(output), &output);
 }
 
@@ -1280,11 +1365,11 @@ bool SimConnectInterface::setClientDataFmgcFmsData(base_fms_inputs& output) {
   return sendClientData(ClientData::FMGC_FMS_INPUTS, sizeof(output), &output);
 }
 
-bool SimConnectInterface::setClientDataFmgcABus(base_fmgc_a_bus& output, int fmgcIndex) {
+bool SimConnectInterface::setClientDataFmgcABus(const base_fmgc_a_bus& output, int fmgcIndex) {
   return sendClientData(ClientData::FMGC_1_BUS_A_OUTPUT + fmgcIndex, sizeof(output), &output);
 }
 
-bool SimConnectInterface::setClientDataFmgcBBus(base_fmgc_b_bus& output, int fmgcIndex) {
+bool SimConnectInterface::setClientDataFmgcBBus(const base_fmgc_b_bus& output, int fmgcIndex) {
   return sendClientData(ClientData::FMGC_1_BUS_B_OUTPUT + fmgcIndex, sizeof(output), &output);
 }
 
@@ -1388,6 +1473,26 @@ bool SimConnectInterface::setClientDataFadec(base_ecu_bus& output, int fadecInde
   return sendClientData(ClientData::FADEC_1_BUS + fadecIndex, sizeof(output), &output);
 }
 
+bool SimConnectInterface::sendClientDataInputBlock() {
+  // check if bulk transfer is enabled
+  if (!clientDataBulkTransferEnabled) {
+    return true;
+  }
+
+  // check if we are connected
+  if (!isConnected) {
+    return false;
+  }
+
+  // every block gets a new sequence number, the external computers use it to detect lost frames
+  clientDataInputBlock.header.sequence++;
+
+  HRESULT result = SimConnect_SetClientData(hSimConnect, ClientData::CLIENT_DATA_INPUT_BLOCK, ClientData::CLIENT_DATA_INPUT_BLOCK,
+                                            SIMCONNECT_CLIENT_DATA_SET_FLAG_DEFAULT, 0, sizeof(clientDataInputBlock), &clientDataInputBlock);
+
+  return result == S_OK;
+}
+
 void SimConnectInterface::setLoggingFlightControlsEnabled(bool enabled) {
   loggingFlightControlsEnabled = enabled;
 }
@@ -1499,1463 +1604,1677 @@ void SimConnectInterface::simConnectProcessEvent_EX1(const SIMCONNECT_RECV_EVENT
 }
 
 void SimConnectInterface::processEvent(const DWORD eventId, const DWORD data0, const DWORD data1) {
-  // process depending on event id
-  switch (eventId) {
-    case Events::SYSTEM_EVENT_PAUSE: {
-      pauseState = static_cast<long>(data0);
-      std::cout << "WASM: SYSTEM_EVENT_PAUSE: ";
-      std::cout << static_cast<long>(data0);
-      std::cout << std::endl;
-      break;
-    }
-
-    case Events::AXIS_ELEVATOR_SET: {
-      simInput.inputs[AXIS_ELEVATOR_SET] = static_cast<long>(data0) / 16384.0;
-      if (loggingFlightControlsEnabled) {
-        std::cout << "WASM: AXIS_ELEVATOR_SET: ";
-        std::cout << static_cast<long>(data0);
-        std::cout << " -> ";
-        std::cout << simInput.inputs[AXIS_ELEVATOR_SET];
-        std::cout << std::endl;
-      }
-      break;
-    }
+  // ignore events without a handler
+  if (eventId >= eventHandlers.size() || eventHandlers[eventId] == nullptr) {
+    return;
+  }
 
-    case Events::AXIS_AILERONS_SET: {
-      simInput.inputs[AXIS_AILERONS_SET] = static_cast<long>(data0) / 16384.0;
-      if (loggingFlightControlsEnabled) {
-        std::cout << "WASM: AXIS_AILERONS_SET: ";
-        std::cout << static_cast<long>(data0);
-        std::cout << " -> ";
-        std::cout << simInput.inputs[AXIS_AILERONS_SET];
-        std::cout << std::endl;
+  // axis events are only applied once per dispatch loop with their last value
+  if (coalescedEvents[eventId]) {
+    for (auto it = pendingAxisEvents.begin(); it != pendingAxisEvents.end(); ++it) {
+      if (it->eventId == eventId) {
+        pendingAxisEvents.erase(it);
+        break;
       }
-      break;
     }
+    pendingAxisEvents.push_back({eventId, data0, data1});
+    return;
+  }
 
-    case Events::AXIS_RUDDER_SET: {
-      simInput.inputs[AXIS_RUDDER_SET] = static_cast<long>(data0) / 16384.0;
-      if (loggingFlightControlsEnabled) {
-        std::cout << "WASM: AXIS_RUDDER_SET: ";
-        std::cout << static_cast<long>(data0);
-        std::cout << " -> ";
-        std::cout << simInput.inputs[AXIS_RUDDER_SET];
-        std::cout << std::endl;
-      }
-      break;
-    }
+  // apply pending axis events first to keep the order with events changing the same input
+  applyPendingAxisEvents();
+  (this->*eventHandlers[eventId])(data0, data1);
+}
 
-    case Events::RUDDER_SET: {
-      simInput.inputs[AXIS_RUDDER_SET] = static_cast<long>(data0) / 16384.0;
-      if (loggingFlightControlsEnabled) {
-        std::cout << "WASM: RUDDER_SET: ";
-        std::cout << static_cast<long>(data0);
-        std::cout << " -> ";
-        std::cout << simInput.inputs[AXIS_RUDDER_SET];
-        std::cout << std::endl;
-      }
-      break;
-    }
+void SimConnectInterface::applyPendingAxisEvents() {
+  // events are applied in the order of their last arrival, so that the last of several events driving the same axis wins
+  for (const PendingAxisEvent& event : pendingAxisEvents) {
+    (this->*eventHandlers[event.eventId])(event.data0, event.data1);
+  }
+  pendingAxisEvents.clear();
+}
+
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::SYSTEM_EVENT_PAUSE>(const DWORD data0, const DWORD data1) {
+  pauseState = static_cast<long>(data0);
+  std::cout << "WASM: SYSTEM_EVENT_PAUSE: ";
+  std::cout << static_cast<long>(data0);
+  std::cout << std::endl;
+}
+
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::AXIS_ELEVATOR_SET>(const DWORD data0, const DWORD data1) {
+  simInput.inputs[AXIS_ELEVATOR_SET] = static_cast<long>(data0) / 16384.0;
+  if (loggingFlightControlsEnabled) {
+    std::cout << "WASM: AXIS_ELEVATOR_SET: ";
+    std::cout << static_cast<long>(data0);
+    std::cout << " -> ";
+    std::cout << simInput.inputs[AXIS_ELEVATOR_SET];
+    std::cout << std::endl;
+  }
+}
 
-    case Events::RUDDER_LEFT: {
-      simInput.inputs[AXIS_RUDDER_SET] = fmin(1.0, simInput.inputs[AXIS_RUDDER_SET] + flightControlsKeyChangeRudder);
-      if (loggingFlightControlsEnabled) {
-        std::cout << "WASM: RUDDER_LEFT: ";
-        std::cout << "(no data)";
-        std::cout << " -> ";
-        std::cout << simInput.inputs[AXIS_RUDDER_SET];
-        std::cout << std::endl;
-      }
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::AXIS_AILERONS_SET>(const DWORD data0, const DWORD data1) {
+  simInput.inputs[AXIS_AILERONS_SET] = static_cast<long>(data0) / 16384.0;
+  if (loggingFlightControlsEnabled) {
+    std::cout << "WASM: AXIS_AILERONS_SET: ";
+    std::cout << static_cast<long>(data0);
+    std::cout << " -> ";
+    std::cout << simInput.inputs[AXIS_AILERONS_SET];
+    std::cout << std::endl;
+  }
+}
 
-    case Events::RUDDER_CENTER: {
-      simInput.inputs[AXIS_RUDDER_SET] = 0.0;
-      if (loggingFlightControlsEnabled) {
-        std::cout << "WASM: RUDDER_CENTER: ";
-        std::cout << "(no data)";
-        std::cout << " -> ";
-        std::cout << simInput.inputs[AXIS_RUDDER_SET];
-        std::cout << std::endl;
-      }
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::AXIS_RUDDER_SET>(const DWORD data0, const DWORD data1) {
+  simInput.inputs[AXIS_RUDDER_SET] = static_cast<long>(data0) / 16384.0;
+  if (loggingFlightControlsEnabled) {
+    std::cout << "WASM: AXIS_RUDDER_SET: ";
+    std::cout << static_cast<long>(data0);
+    std::cout << " -> ";
+    std::cout << simInput.inputs[AXIS_RUDDER_SET];
+    std::cout << std::endl;
+  }
+}
 
-    case Events::RUDDER_RIGHT: {
-      simInput.inputs[AXIS_RUDDER_SET] = fmax(-1.0, simInput.inputs[AXIS_RUDDER_SET] - flightControlsKeyChangeRudder);
-      if (loggingFlightControlsEnabled) {
-        std::cout << "WASM: RUDDER_RIGHT: ";
-        std::cout << "(no data)";
-        std::cout << " -> ";
-        std::cout << simInput.inputs[AXIS_RUDDER_SET];
-        std::cout << std::endl;
-      }
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::RUDDER_SET>(const DWORD data0, const DWORD data1) {
+  simInput.inputs[AXIS_RUDDER_SET] = static_cast<long>(data0) / 16384.0;
+  if (loggingFlightControlsEnabled) {
+    std::cout << "WASM: RUDDER_SET: ";
+    std::cout << static_cast<long>(data0);
+    std::cout << " -> ";
+    std::cout << simInput.inputs[AXIS_RUDDER_SET];
+    std::cout << std::endl;
+  }
+}
 
-    case Events::RUDDER_AXIS_MINUS: {
-      double tmpValue = 0;
-      if (disableXboxCompatibilityRudderPlusMinus) {
-        // normal axis
-        tmpValue = +1.0 * ((static_cast<long>(data0) + 16384.0) / 32768.0);
-      } else {
-        // xbox controller
-        tmpValue = +1.0 * (static_cast<long>(data0) / 16384.0);
-      }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::RUDDER_LEFT>(const DWORD data0, const DWORD data1) {
+  simInput.inputs[AXIS_RUDDER_SET] = fmin(1.0, simInput.inputs[AXIS_RUDDER_SET] + flightControlsKeyChangeRudder);
+  if (loggingFlightControlsEnabled) {
+    std::cout << "WASM: RUDDER_LEFT: ";
+    std::cout << "(no data)";
+    std::cout << " -> ";
+    std::cout << simInput.inputs[AXIS_RUDDER_SET];
+    std::cout << std::endl;
+  }
+}
 
-      // This allows using two independent axis for rudder which are mapped to RUDDER AXIS LEFT and RUDDER AXIS RIGHT
-      // As it might be incompatible with some controllers, it is configurable
-      if (enableRudder2AxisMode) {
-        rudderLeftAxis = tmpValue;
-        tmpValue = -1 * ((rudderRightAxis - rudderLeftAxis) / 2.0);
-      }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::RUDDER_CENTER>(const DWORD data0, const DWORD data1) {
+  simInput.inputs[AXIS_RUDDER_SET] = 0.0;
+  if (loggingFlightControlsEnabled) {
+    std::cout << "WASM: RUDDER_CENTER: ";
+    std::cout << "(no data)";
+    std::cout << " -> ";
+    std::cout << simInput.inputs[AXIS_RUDDER_SET];
+    std::cout << std::endl;
+  }
+}
 
-      simInput.inputs[AXIS_RUDDER_SET] = tmpValue;
-      if (loggingFlightControlsEnabled) {
-        std::cout << "WASM: RUDDER_AXIS_MINUS: ";
-        std::cout << static_cast<long>(data0);
-        std::cout << " -> ";
-        std::cout << simInput.inputs[AXIS_RUDDER_SET];
-        if (enableRudder2AxisMode) {
-          std::cout << " (left: " << rudderLeftAxis << ", right: " << rudderRightAxis << ")";
-        }
-        std::cout << std::endl;
-      }
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::RUDDER_RIGHT>(const DWORD data0, const DWORD data1) {
+  simInput.inputs[AXIS_RUDDER_SET] = fmax(-1.0, simInput.inputs[AXIS_RUDDER_SET] - flightControlsKeyChangeRudder);
+  if (loggingFlightControlsEnabled) {
+    std::cout << "WASM: RUDDER_RIGHT: ";
+    std::cout << "(no data)";
+    std::cout << " -> ";
+    std::cout << simInput.inputs[AXIS_RUDDER_SET];
+    std::cout << std::endl;
+  }
+}
 
-    case Events::RUDDER_AXIS_PLUS: {
-      double tmpValue = 0;
-      if (disableXboxCompatibilityRudderPlusMinus) {
-        // normal axis
-        tmpValue = -1.0 * ((static_cast<long>(data0) + 16384.0) / 32768.0);
-      } else {
-        // xbox controller
-        tmpValue = -1.0 * (static_cast<long>(data0) / 16384.0);
-      }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::RUDDER_AXIS_MINUS>(const DWORD data0, const DWORD data1) {
+  double tmpValue = 0;
+  if (disableXboxCompatibilityRudderPlusMinus) {
+    // normal axis
+    tmpValue = +1.0 * ((static_cast<long>(data0) + 16384.0) / 32768.0);
+  } else {
+    // xbox controller
+    tmpValue = +1.0 * (static_cast<long>(data0) / 16384.0);
+  }
 
-      // This allows using two independent axis for rudder which are mapped to RUDDER AXIS LEFT and RUDDER AXIS RIGHT
-      // As it might be incompatible with some controllers, it is configurable
-      if (enableRudder2AxisMode) {
-        rudderRightAxis = -tmpValue;
-        tmpValue = -1 * ((rudderRightAxis - rudderLeftAxis) / 2.0);
-      }
+  // This allows using two independent axis for rudder which are mapped to RUDDER AXIS LEFT and RUDDER AXIS RIGHT
+  // As it might be incompatible with some controllers, it is configurable
+  if (enableRudder2AxisMode) {
+    rudderLeftAxis = tmpValue;
+    tmpValue = -1 * ((rudderRightAxis - rudderLeftAxis) / 2.0);
+  }
 
-      simInput.inputs[AXIS_RUDDER_SET] = tmpValue;
-      if (loggingFlightControlsEnabled) {
-        std::cout << "WASM: RUDDER_AXIS_PLUS: ";
-        std::cout << static_cast<long>(data0);
-        std::cout << " -> ";
-        std::cout << simInput.inputs[AXIS_RUDDER_SET];
-        if (enableRudder2AxisMode) {
-          std::cout << " (left: " << rudderLeftAxis << ", right: " << rudderRightAxis << ")";
-        }
-        std::cout << std::endl;
-      }
-      break;
+  simInput.inputs[AXIS_RUDDER_SET] = tmpValue;
+  if (loggingFlightControlsEnabled) {
+    std::cout << "WASM: RUDDER_AXIS_MINUS: ";
+    std::cout << static_cast<long>(data0);
+    std::cout << " -> ";
+    std::cout << simInput.inputs[AXIS_RUDDER_SET];
+    if (enableRudder2AxisMode) {
+      std::cout << " (left: " << rudderLeftAxis << ", right: " << rudderRightAxis << ")";
     }
+    std::cout << std::endl;
+  }
+}
 
-    case Events::RUDDER_TRIM_LEFT: {
-      simInputRudderTrim.rudderTrimSwitchLeft = true;
-      if (loggingFlightControlsEnabled) {
-        std::cout << "WASM: RUDDER_TRIM_LEFT: ";
-        std::cout << "(no data)";
-        std::cout << std::endl;
-      }
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::RUDDER_AXIS_PLUS>(const DWORD data0, const DWORD data1) {
+  double tmpValue = 0;
+  if (disableXboxCompatibilityRudderPlusMinus) {
+    // normal axis
+    tmpValue = -1.0 * ((static_cast<long>(data0) + 16384.0) / 32768.0);
+  } else {
+    // xbox controller
+    tmpValue = -1.0 * (static_cast<long>(data0) / 16384.0);
+  }
 
-    case Events::RUDDER_TRIM_RESET: {
-      simInputRudderTrim.rudderTrimReset = true;
-      if (loggingFlightControlsEnabled) {
-        std::cout << "WASM: RUDDER_TRIM_RESET: ";
-        std::cout << "(no data)";
-        std::cout << std::endl;
-      }
-      break;
-    }
+  // This allows using two independent axis for rudder which are mapped to RUDDER AXIS LEFT and RUDDER AXIS RIGHT
+  // As it might be incompatible with some controllers, it is configurable
+  if (enableRudder2AxisMode) {
+    rudderRightAxis = -tmpValue;
+    tmpValue = -1 * ((rudderRightAxis - rudderLeftAxis) / 2.0);
+  }
 
-    case Events::RUDDER_TRIM_RIGHT: {
-      simInputRudderTrim.rudderTrimSwitchRight = true;
-      if (loggingFlightControlsEnabled) {
-        std::cout << "WASM: RUDDER_TRIM_RIGHT: ";
-        std::cout << "(no data)";
-        std::cout << std::endl;
-      }
-      break;
+  simInput.inputs[AXIS_RUDDER_SET] = tmpValue;
+  if (loggingFlightControlsEnabled) {
+    std::cout << "WASM: RUDDER_AXIS_PLUS: ";
+    std::cout << static_cast<long>(data0);
+    std::cout << " -> ";
+    std::cout << simInput.inputs[AXIS_RUDDER_SET];
+    if (enableRudder2AxisMode) {
+      std::cout << " (left: " << rudderLeftAxis << ", right: " << rudderRightAxis << ")";
     }
+    std::cout << std::endl;
+  }
+}
 
-    case Events::RUDDER_TRIM_SET: {
-      if (loggingFlightControlsEnabled) {
-        std::cout << "WASM: RUDDER_TRIM_SET: ";
-        std::cout << static_cast<long>(data0);
-        std::cout << std::endl;
-      }
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::RUDDER_TRIM_LEFT>(const DWORD data0, const DWORD data1) {
+  simInputRudderTrim.rudderTrimSwitchLeft = true;
+  if (loggingFlightControlsEnabled) {
+    std::cout << "WASM: RUDDER_TRIM_LEFT: ";
+    std::cout << "(no data)";
+    std::cout << std::endl;
+  }
+}
 
-    case Events::RUDDER_TRIM_SET_EX1: {
-      if (loggingFlightControlsEnabled) {
-        std::cout << "WASM: RUDDER_TRIM_SET_EX1: ";
-        std::cout << static_cast<long>(data0);
-        std::cout << std::endl;
-      }
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::RUDDER_TRIM_RESET>(const DWORD data0, const DWORD data1) {
+  simInputRudderTrim.rudderTrimReset = true;
+  if (loggingFlightControlsEnabled) {
+    std::cout << "WASM: RUDDER_TRIM_RESET: ";
+    std::cout << "(no data)";
+    std::cout << std::endl;
+  }
+}
 
-    case Events::AILERON_SET: {
-      simInput.inputs[AXIS_AILERONS_SET] = static_cast<long>(data0) / 16384.0;
-      if (loggingFlightControlsEnabled) {
-        std::cout << "WASM: AILERON_SET: ";
-        std::cout << static_cast<long>(data0);
-        std::cout << " -> ";
-        std::cout << simInput.inputs[AXIS_AILERONS_SET];
-        std::cout << std::endl;
-      }
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::RUDDER_TRIM_RIGHT>(const DWORD data0, const DWORD data1) {
+  simInputRudderTrim.rudderTrimSwitchRight = true;
+  if (loggingFlightControlsEnabled) {
+    std::cout << "WASM: RUDDER_TRIM_RIGHT: ";
+    std::cout << "(no data)";
+    std::cout << std::endl;
+  }
+}
 
-    case Events::AILERONS_LEFT: {
-      simInput.inputs[AXIS_AILERONS_SET] = fmin(1.0, simInput.inputs[AXIS_AILERONS_SET] + flightControlsKeyChangeAileron);
-      if (loggingFlightControlsEnabled) {
-        std::cout << "WASM: AILERONS_LEFT: ";
-        std::cout << "(no data)";
-        std::cout << " -> ";
-        std::cout << simInput.inputs[AXIS_AILERONS_SET];
-        std::cout << std::endl;
-      }
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::RUDDER_TRIM_SET>(const DWORD data0, const DWORD data1) {
+  if (loggingFlightControlsEnabled) {
+    std::cout << "WASM: RUDDER_TRIM_SET: ";
+    std::cout << static_cast<long>(data0);
+    std::cout << std::endl;
+  }
+}
 
-    case Events::AILERONS_RIGHT: {
-      simInput.inputs[AXIS_AILERONS_SET] = fmax(-1.0, simInput.inputs[AXIS_AILERONS_SET] - flightControlsKeyChangeAileron);
-      if (loggingFlightControlsEnabled) {
-        std::cout << "WASM: AILERONS_RIGHT: ";
-        std::cout << "(no data)";
-        std::cout << " -> ";
-        std::cout << simInput.inputs[AXIS_AILERONS_SET];
-        std::cout << std::endl;
-      }
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::RUDDER_TRIM_SET_EX1>(const DWORD data0, const DWORD data1) {
+  if (loggingFlightControlsEnabled) {
+    std::cout << "WASM: RUDDER_TRIM_SET_EX1: ";
+    std::cout << static_cast<long>(data0);
+    std::cout << std::endl;
+  }
+}
 
-    case Events::CENTER_AILER_RUDDER: {
-      simInput.inputs[AXIS_RUDDER_SET] = 0.0;
-      simInput.inputs[AXIS_AILERONS_SET] = 0.0;
-      if (loggingFlightControlsEnabled) {
-        std::cout << "WASM: CENTER_AILER_RUDDER: ";
-        std::cout << "(no data)";
-        std::cout << " -> ";
-        std::cout << simInput.inputs[AXIS_AILERONS_SET];
-        std::cout << " / ";
-        std::cout << simInput.inputs[AXIS_RUDDER_SET];
-        std::cout << std::endl;
-      }
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::AILERON_SET>(const DWORD data0, const DWORD data1) {
+  simInput.inputs[AXIS_AILERONS_SET] = static_cast<long>(data0) / 16384.0;
+  if (loggingFlightControlsEnabled) {
+    std::cout << "WASM: AILERON_SET: ";
+    std::cout << static_cast<long>(data0);
+    std::cout << " -> ";
+    std::cout << simInput.inputs[AXIS_AILERONS_SET];
+    std::cout << std::endl;
+  }
+}
 
-    case Events::ELEVATOR_SET: {
-      simInput.inputs[AXIS_ELEVATOR_SET] = static_cast<long>(data0) / 16384.0;
-      if (loggingFlightControlsEnabled) {
-        std::cout << "WASM: ELEVATOR_SET: ";
-        std::cout << static_cast<long>(data0);
-        std::cout << " -> ";
-        std::cout << simInput.inputs[AXIS_ELEVATOR_SET];
-        std::cout << std::endl;
-      }
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::AILERONS_LEFT>(const DWORD data0, const DWORD data1) {
+  simInput.inputs[AXIS_AILERONS_SET] = fmin(1.0, simInput.inputs[AXIS_AILERONS_SET] + flightControlsKeyChangeAileron);
+  if (loggingFlightControlsEnabled) {
+    std::cout << "WASM: AILERONS_LEFT: ";
+    std::cout << "(no data)";
+    std::cout << " -> ";
+    std::cout << simInput.inputs[AXIS_AILERONS_SET];
+    std::cout << std::endl;
+  }
+}
 
-    case Events::ELEV_DOWN: {
-      simInput.inputs[AXIS_ELEVATOR_SET] = fmin(1.0, simInput.inputs[AXIS_ELEVATOR_SET] + flightControlsKeyChangeElevator);
-      if (loggingFlightControlsEnabled) {
-        std::cout << "WASM: ELEV_DOWN: ";
-        std::cout << "(no data)";
-        std::cout << " -> ";
-        std::cout << simInput.inputs[AXIS_ELEVATOR_SET];
-        std::cout << std::endl;
-      }
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::AILERONS_RIGHT>(const DWORD data0, const DWORD data1) {
+  simInput.inputs[AXIS_AILERONS_SET] = fmax(-1.0, simInput.inputs[AXIS_AILERONS_SET] - flightControlsKeyChangeAileron);
+  if (loggingFlightControlsEnabled) {
+    std::cout << "WASM: AILERONS_RIGHT: ";
+    std::cout << "(no data)";
+    std::cout << " -> ";
+    std::cout << simInput.inputs[AXIS_AILERONS_SET];
+    std::cout << std::endl;
+  }
+}
 
-    case Events::ELEV_UP: {
-      simInput.inputs[AXIS_ELEVATOR_SET] = fmax(-1.0, simInput.inputs[AXIS_ELEVATOR_SET] - flightControlsKeyChangeElevator);
-      if (loggingFlightControlsEnabled) {
-        std::cout << "WASM: ELEV_UP: ";
-        std::cout << "(no data)";
-        std::cout << " -> ";
-        std::cout << simInput.inputs[AXIS_ELEVATOR_SET];
-        std::cout << std::endl;
-      }
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::CENTER_AILER_RUDDER>(const DWORD data0, const DWORD data1) {
+  simInput.inputs[AXIS_RUDDER_SET] = 0.0;
+  simInput.inputs[AXIS_AILERONS_SET] = 0.0;
+  if (loggingFlightControlsEnabled) {
+    std::cout << "WASM: CENTER_AILER_RUDDER: ";
+    std::cout << "(no data)";
+    std::cout << " -> ";
+    std::cout << simInput.inputs[AXIS_AILERONS_SET];
+    std::cout << " / ";
+    std::cout << simInput.inputs[AXIS_RUDDER_SET];
+    std::cout << std::endl;
+  }
+}
 
-    case Events::AUTOPILOT_OFF: {
-      simInputAutopilot.AP_disconnect = 1;
-      std::cout << "WASM: event triggered: AUTOPILOT_OFF" << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::ELEVATOR_SET>(const DWORD data0, const DWORD data1) {
+  simInput.inputs[AXIS_ELEVATOR_SET] = static_cast<long>(data0) / 16384.0;
+  if (loggingFlightControlsEnabled) {
+    std::cout << "WASM: ELEVATOR_SET: ";
+    std::cout << static_cast<long>(data0);
+    std::cout << " -> ";
+    std::cout << simInput.inputs[AXIS_ELEVATOR_SET];
+    std::cout << std::endl;
+  }
+}
 
-    case Events::AUTOPILOT_ON: {
-      simInputAutopilot.AP_engage = 1;
-      std::cout << "WASM: event triggered: AUTOPILOT_ON" << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::ELEV_DOWN>(const DWORD data0, const DWORD data1) {
+  simInput.inputs[AXIS_ELEVATOR_SET] = fmin(1.0, simInput.inputs[AXIS_ELEVATOR_SET] + flightControlsKeyChangeElevator);
+  if (loggingFlightControlsEnabled) {
+    std::cout << "WASM: ELEV_DOWN: ";
+    std::cout << "(no data)";
+    std::cout << " -> ";
+    std::cout << simInput.inputs[AXIS_ELEVATOR_SET];
+    std::cout << std::endl;
+  }
+}
 
-    case Events::AP_MASTER: {
-      simInputAutopilot.AP_1_push = 1;
-      std::cout << "WASM: event triggered: AP_MASTER" << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::ELEV_UP>(const DWORD data0, const DWORD data1) {
+  simInput.inputs[AXIS_ELEVATOR_SET] = fmax(-1.0, simInput.inputs[AXIS_ELEVATOR_SET] - flightControlsKeyChangeElevator);
+  if (loggingFlightControlsEnabled) {
+    std::cout << "WASM: ELEV_UP: ";
+    std::cout << "(no data)";
+    std::cout << " -> ";
+    std::cout << simInput.inputs[AXIS_ELEVATOR_SET];
+    std::cout << std::endl;
+  }
+}
 
-    case Events::AUTOPILOT_DISENGAGE_SET: {
-      if (static_cast<long>(data0) == 1) {
-        simInputAutopilot.AP_disconnect = 1;
-        std::cout << "WASM: event triggered: AUTOPILOT_DISENGAGE_SET" << std::endl;
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::AUTOPILOT_OFF>(const DWORD data0, const DWORD data1) {
+  simInputAutopilot.AP_disconnect = 1;
+  std::cout << "WASM: event triggered: AUTOPILOT_OFF" << std::endl;
+}
 
-        // Re emitting masked event for autopilot disconnection
-        sendEvent(SimConnectInterface::Events::A32NX_AUTOPILOT_DISENGAGE, 0, SIMCONNECT_GROUP_PRIORITY_STANDARD);
-      }
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::AUTOPILOT_ON>(const DWORD data0, const DWORD data1) {
+  simInputAutopilot.AP_engage = 1;
+  std::cout << "WASM: event triggered: AUTOPILOT_ON" << std::endl;
+}
 
-    case Events::AUTOPILOT_DISENGAGE_TOGGLE: {
-      simInputAutopilot.AP_1_push = 1;
-      std::cout << "WASM: event triggered: AUTOPILOT_DISENGAGE_TOGGLE" << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::AP_MASTER>(const DWORD data0, const DWORD data1) {
+  simInputAutopilot.AP_1_push = 1;
+  std::cout << "WASM: event triggered: AP_MASTER" << std::endl;
+}
 
-    case Events::TOGGLE_FLIGHT_DIRECTOR: {
-      fcuEfisPanelInputs[0].fd_button_pushed = 1;
-      fcuEfisPanelInputs[1].fd_button_pushed = 1;
-      std::cout << "WASM: event triggered: TOGGLE_FLIGHT_DIRECTOR:" << static_cast<long>(data0) << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::AUTOPILOT_DISENGAGE_SET>(const DWORD data0, const DWORD data1) {
+  if (static_cast<long>(data0) == 1) {
+    simInputAutopilot.AP_disconnect = 1;
+    std::cout << "WASM: event triggered: AUTOPILOT_DISENGAGE_SET" << std::endl;
 
-    case Events::A32NX_FCU_AP_1_PUSH: {
-      simInputAutopilot.AP_1_push = 1;
-      std::cout << "WASM: event triggered: A32NX_FCU_AP_1_PUSH" << std::endl;
-      break;
-    }
+    // Re emitting masked event for autopilot disconnection
+    sendEvent(SimConnectInterface::Events::A32NX_AUTOPILOT_DISENGAGE, 0, SIMCONNECT_GROUP_PRIORITY_STANDARD);
+  }
+}
 
-    case Events::A32NX_FCU_AP_2_PUSH: {
-      simInputAutopilot.AP_2_push = 1;
-      std::cout << "WASM: event triggered: A32NX_FCU_AP_2_PUSH" << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::AUTOPILOT_DISENGAGE_TOGGLE>(const DWORD data0, const DWORD data1) {
+  simInputAutopilot.AP_1_push = 1;
+  std::cout << "WASM: event triggered: AUTOPILOT_DISENGAGE_TOGGLE" << std::endl;
+}
 
-    case Events::A32NX_FCU_AP_DISCONNECT_PUSH: {
-      simInputAutopilot.AP_disconnect = 1;
-      std::cout << "WASM: event triggered: A32NX_FCU_AP_DISCONNECT_PUSH" << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::TOGGLE_FLIGHT_DIRECTOR>(const DWORD data0, const DWORD data1) {
+  fcuEfisPanelInputs[0].fd_button_pushed = 1;
+  fcuEfisPanelInputs[1].fd_button_pushed = 1;
+  std::cout << "WASM: event triggered: TOGGLE_FLIGHT_DIRECTOR:" << static_cast<long>(data0) << std::endl;
+}
 
-    case Events::A32NX_FCU_ATHR_PUSH: {
-      simInputThrottles.ATHR_push = 1;
-      std::cout << "WASM: event triggered: A32NX_FCU_ATHR_PUSH" << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::A32NX_FCU_AP_1_PUSH>(const DWORD data0, const DWORD data1) {
+  simInputAutopilot.AP_1_push = 1;
+  std::cout << "WASM: event triggered: A32NX_FCU_AP_1_PUSH" << std::endl;
+}
 
-    case Events::A32NX_FCU_ATHR_DISCONNECT_PUSH: {
-      simInputThrottles.ATHR_disconnect = 1;
-      std::cout << "WASM: event triggered: A32NX_FCU_ATHR_DISCONNECT_PUSH" << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::A32NX_FCU_AP_2_PUSH>(const DWORD data0, const DWORD data1) {
+  simInputAutopilot.AP_2_push = 1;
+  std::cout << "WASM: event triggered: A32NX_FCU_AP_2_PUSH" << std::endl;
+}
 
-    case Events::A32NX_FCU_SPD_INC: {
-      fcuAfsPanelInputs.spd_knob.turns = 1;
-      std::cout << "WASM: event triggered: A32NX_FCU_SPD_INC" << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::A32NX_FCU_AP_DISCONNECT_PUSH>(const DWORD data0, const DWORD data1) {
+  simInputAutopilot.AP_disconnect = 1;
+  std::cout << "WASM: event triggered: A32NX_FCU_AP_DISCONNECT_PUSH" << std::endl;
+}
 
-    case Events::A32NX_FCU_SPD_DEC: {
-      fcuAfsPanelInputs.spd_knob.turns = -1;
-      std::cout << "WASM: event triggered: A32NX_FCU_SPD_DEC" << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::A32NX_FCU_ATHR_PUSH>(const DWORD data0, const DWORD data1) {
+  simInputThrottles.ATHR_push = 1;
+  std::cout << "WASM: event triggered: A32NX_FCU_ATHR_PUSH" << std::endl;
+}
 
-    case Events::A32NX_FCU_SPD_SET: {
-      simInputAutopilot.SPD_MACH_set = static_cast<long>(data0);
-      std::cout << "WASM: event triggered: A32NX_FCU_SPD_SET: " << static_cast<long>(data0) << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::A32NX_FCU_ATHR_DISCONNECT_PUSH>(const DWORD data0, const DWORD data1) {
+  simInputThrottles.ATHR_disconnect = 1;
+  std::cout << "WASM: event triggered: A32NX_FCU_ATHR_DISCONNECT_PUSH" << std::endl;
+}
 
-    case Events::A32NX_FCU_SPD_PUSH:
-    case Events::AP_AIRSPEED_ON: {
-      fcuAfsPanelInputs.spd_knob.pushed = true;
-      std::cout << "WASM: event triggered: A32NX_FCU_SPD_PUSH" << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::A32NX_FCU_SPD_INC>(const DWORD data0, const DWORD data1) {
+  fcuAfsPanelInputs.spd_knob.turns = 1;
+  std::cout << "WASM: event triggered: A32NX_FCU_SPD_INC" << std::endl;
+}
 
-    case Events::A32NX_FCU_SPD_PULL:
-    case Events::AP_AIRSPEED_OFF: {
-      fcuAfsPanelInputs.spd_knob.pulled = true;
-      std::cout << "WASM: event triggered: A32NX_FCU_SPD_PULL" << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::A32NX_FCU_SPD_DEC>(const DWORD data0, const DWORD data1) {
+  fcuAfsPanelInputs.spd_knob.turns = -1;
+  std::cout << "WASM: event triggered: A32NX_FCU_SPD_DEC" << std::endl;
+}
 
-    case Events::A32NX_FCU_SPD_MACH_TOGGLE_PUSH:
-    case Events::AP_MACH_HOLD: {
-      fcuAfsPanelInputs.spd_mach_button_pressed = true;
-      std::cout << "WASM: event triggered: A32NX_FCU_SPD_MACH_TOGGLE_PUSH" << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::A32NX_FCU_SPD_SET>(const DWORD data0, const DWORD data1) {
+  simInputAutopilot.SPD_MACH_set = static_cast<long>(data0);
+  std::cout << "WASM: event triggered: A32NX_FCU_SPD_SET: " << static_cast<long>(data0) << std::endl;
+}
 
-    case Events::A32NX_FCU_HDG_INC: {
-      fcuAfsPanelInputs.hdg_trk_knob.turns = 1;
-      std::cout << "WASM: event triggered: A32NX_FCU_HDG_INC" << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::A32NX_FCU_SPD_PUSH>(const DWORD data0, const DWORD data1) {
+  fcuAfsPanelInputs.spd_knob.pushed = true;
+  std::cout << "WASM: event triggered: A32NX_FCU_SPD_PUSH" << std::endl;
+}
 
-    case Events::A32NX_FCU_HDG_DEC: {
-      fcuAfsPanelInputs.hdg_trk_knob.turns = -1;
-      std::cout << "WASM: event triggered: A32NX_FCU_HDG_DEC" << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::A32NX_FCU_SPD_PULL>(const DWORD data0, const DWORD data1) {
+  fcuAfsPanelInputs.spd_knob.pulled = true;
+  std::cout << "WASM: event triggered: A32NX_FCU_SPD_PULL" << std::endl;
+}
 
-    case Events::A32NX_FCU_HDG_SET: {
-      simInputAutopilot.HDG_TRK_set = static_cast<long>(data0);
-      std::cout << "WASM: event triggered: A32NX_FCU_HDG_SET: " << static_cast<long>(data0) << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::A32NX_FCU_SPD_MACH_TOGGLE_PUSH>(const DWORD data0, const DWORD data1) {
+  fcuAfsPanelInputs.spd_mach_button_pressed = true;
+  std::cout << "WASM: event triggered: A32NX_FCU_SPD_MACH_TOGGLE_PUSH" << std::endl;
+}
 
-    case Events::A32NX_FCU_HDG_PUSH:
-    case Events::AP_HDG_HOLD_ON: {
-      fcuAfsPanelInputs.hdg_trk_knob.pushed = true;
-      std::cout << "WASM: event triggered: A32NX_FCU_HDG_PUSH" << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::A32NX_FCU_HDG_INC>(const DWORD data0, const DWORD data1) {
+  fcuAfsPanelInputs.hdg_trk_knob.turns = 1;
+  std::cout << "WASM: event triggered: A32NX_FCU_HDG_INC" << std::endl;
+}
 
-    case Events::A32NX_FCU_HDG_PULL:
-    case Events::AP_HDG_HOLD_OFF: {
-      fcuAfsPanelInputs.hdg_trk_knob.pulled = true;
-      std::cout << "WASM: event triggered: A32NX_FCU_HDG_PULL" << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::A32NX_FCU_HDG_DEC>(const DWORD data0, const DWORD data1) {
+  fcuAfsPanelInputs.hdg_trk_knob.turns = -1;
+  std::cout << "WASM: event triggered: A32NX_FCU_HDG_DEC" << std::endl;
+}
 
-    case Events::A32NX_FCU_TRK_FPA_TOGGLE_PUSH:
-    case Events::AP_VS_HOLD: {
-      fcuAfsPanelInputs.trk_fpa_button_pressed = true;
-      std::cout << "WASM: event triggered: A32NX_FCU_TRK_FPA_TOGGLE_PUSH" << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::A32NX_FCU_HDG_SET>(const DWORD data0, const DWORD data1) {
+  simInputAutopilot.HDG_TRK_set = static_cast<long>(data0);
+  std::cout << "WASM: event triggered: A32NX_FCU_HDG_SET: " << static_cast<long>(data0) << std::endl;
+}
 
-    case Events::A32NX_FCU_ALT_INC: {
-      fcuAfsPanelInputs.alt_knob.turns = 1;
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::A32NX_FCU_HDG_PUSH>(const DWORD data0, const DWORD data1) {
+  fcuAfsPanelInputs.hdg_trk_knob.pushed = true;
+  std::cout << "WASM: event triggered: A32NX_FCU_HDG_PUSH" << std::endl;
+}
 
-      std::cout << "WASM: event triggered: A32NX_FCU_ALT_INC" << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::A32NX_FCU_HDG_PULL>(const DWORD data0, const DWORD data1) {
+  fcuAfsPanelInputs.hdg_trk_knob.pulled = true;
+  std::cout << "WASM: event triggered: A32NX_FCU_HDG_PULL" << std::endl;
+}
 
-    case Events::A32NX_FCU_ALT_DEC: {
-      fcuAfsPanelInputs.alt_knob.turns = -1;
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::A32NX_FCU_TRK_FPA_TOGGLE_PUSH>(const DWORD data0, const DWORD data1) {
+  fcuAfsPanelInputs.trk_fpa_button_pressed = true;
+  std::cout << "WASM: event triggered: A32NX_FCU_TRK_FPA_TOGGLE_PUSH" << std::endl;
+}
 
-      std::cout << "WASM: event triggered: A32NX_FCU_ALT_DEC" << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::A32NX_FCU_ALT_INC>(const DWORD data0, const DWORD data1) {
+  fcuAfsPanelInputs.alt_knob.turns = 1;
 
-    case Events::A32NX_FCU_ALT_SET: {
-      simInputAutopilot.ALT_set = static_cast<long>(data0);
-      std::cout << "WASM: event triggered: A32NX_FCU_ALT_SET: " << static_cast<long>(data0) << std::endl;
-      break;
-    }
+  std::cout << "WASM: event triggered: A32NX_FCU_ALT_INC" << std::endl;
+}
 
-    case Events::A32NX_FCU_ALT_INCREMENT_TOGGLE: {
-      execute_calculator_code("(L:A32NX_FCU_ALT_INCREMENT_1000, bool) ! (>L:A32NX_FCU_ALT_INCREMENT_1000)", nullptr, nullptr, nullptr);
-      std::cout << "WASM: event triggered: A32NX_FCU_ALT_INCREMENT_TOGGLE" << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::A32NX_FCU_ALT_DEC>(const DWORD data0, const DWORD data1) {
+  fcuAfsPanelInputs.alt_knob.turns = -1;
 
-    case Events::A32NX_FCU_ALT_INCREMENT_SET: {
-      long value = static_cast<long>(data0);
-      if (value == 100 || value == 1000) {
-        std::ostringstream stringStream;
-        stringStream << (value == 1000 ? 1 : 0);
-        stringStream << " (>L:A32NX_FCU_ALT_INCREMENT_1000)";
-        execute_calculator_code(stringStream.str().c_str(), nullptr, nullptr, nullptr);
-        std::cout << "WASM: event triggered: A32NX_FCU_ALT_INCREMENT_SET: " << value << std::endl;
-      } else {
-        std::cout << "WASM: event triggered: A32NX_FCU_ALT_INCREMENT_SET with invalid value: " << value << std::endl;
-      }
-      break;
-    }
+  std::cout << "WASM: event triggered: A32NX_FCU_ALT_DEC" << std::endl;
+}
 
-    case Events::A32NX_FCU_ALT_PUSH:
-    case Events::AP_ALT_HOLD_ON: {
-      fcuAfsPanelInputs.alt_knob.pushed = true;
-      std::cout << "WASM: event triggered: A32NX_FCU_ALT_PUSH" << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::A32NX_FCU_ALT_SET>(const DWORD data0, const DWORD data1) {
+  simInputAutopilot.ALT_set = static_cast<long>(data0);
+  std::cout << "WASM: event triggered: A32NX_FCU_ALT_SET: " << static_cast<long>(data0) << std::endl;
+}
 
-    case Events::A32NX_FCU_ALT_PULL:
-    case Events::AP_ALT_HOLD_OFF: {
-      fcuAfsPanelInputs.alt_knob.pulled = true;
-      std::cout << "WASM: event triggered: A32NX_FCU_ALT_PULL" << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::A32NX_FCU_ALT_INCREMENT_TOGGLE>(const DWORD data0, const DWORD data1) {
+  execute_calculator_code("(L:A32NX_FCU_ALT_INCREMENT_1000, bool) ! (>L:A32NX_FCU_ALT_INCREMENT_1000)", nullptr, nullptr, nullptr);
+  std::cout << "WASM: event triggered: A32NX_FCU_ALT_INCREMENT_TOGGLE" << std::endl;
+}
 
-    case Events::A32NX_FCU_METRIC_ALT_TOGGLE_PUSH: {
-      fcuAfsPanelInputs.metric_alt_button_pressed = true;
-      std::cout << "WASM: event triggered: A32NX_FCU_METRIC_ALT_TOGGLE_PUSH" << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::A32NX_FCU_ALT_INCREMENT_SET>(const DWORD data0, const DWORD data1) {
+  long value = static_cast<long>(data0);
+  if (value == 100 || value == 1000) {
+    std::ostringstream stringStream;
+    stringStream << (value == 1000 ? 1 : 0);
+    stringStream << " (>L:A32NX_FCU_ALT_INCREMENT_1000)";
+    execute_calculator_code(stringStream.str().c_str(), nullptr, nullptr, nullptr);
+    std::cout << "WASM: event triggered: A32NX_FCU_ALT_INCREMENT_SET: " << value << std::endl;
+  } else {
+    std::cout << "WASM: event triggered: A32NX_FCU_ALT_INCREMENT_SET with invalid value: " << value << std::endl;
+  }
+}
 
-    case Events::A32NX_FCU_VS_INC: {
-      fcuAfsPanelInputs.vs_fpa_knob.turns = 1;
-      std::cout << "WASM: event triggered: A32NX_FCU_VS_INC" << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::A32NX_FCU_ALT_PUSH>(const DWORD data0, const DWORD data1) {
+  fcuAfsPanelInputs.alt_knob.pushed = true;
+  std::cout << "WASM: event triggered: A32NX_FCU_ALT_PUSH" << std::endl;
+}
 
-    case Events::A32NX_FCU_VS_DEC: {
-      fcuAfsPanelInputs.vs_fpa_knob.turns = -1;
-      std::cout << "WASM: event triggered: A32NX_FCU_VS_DEC" << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::A32NX_FCU_ALT_PULL>(const DWORD data0, const DWORD data1) {
+  fcuAfsPanelInputs.alt_knob.pulled = true;
+  std::cout << "WASM: event triggered: A32NX_FCU_ALT_PULL" << std::endl;
+}
 
-    case Events::A32NX_FCU_VS_SET: {
-      simInputAutopilot.VS_FPA_set = static_cast<long>(data0);
-      std::cout << "WASM: event triggered: A32NX_FCU_VS_SET: " << static_cast<long>(data0) << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::A32NX_FCU_METRIC_ALT_TOGGLE_PUSH>(const DWORD data0, const DWORD data1) {
+  fcuAfsPanelInputs.metric_alt_button_pressed = true;
+  std::cout << "WASM: event triggered: A32NX_FCU_METRIC_ALT_TOGGLE_PUSH" << std::endl;
+}
 
-    case Events::A32NX_FCU_VS_PUSH:
-    case Events::AP_VS_ON: {
-      fcuAfsPanelInputs.vs_fpa_knob.pushed = true;
-      std::cout << "WASM: event triggered: A32NX_FCU_VS_PUSH" << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::A32NX_FCU_VS_INC>(const DWORD data0, const DWORD data1) {
+  fcuAfsPanelInputs.vs_fpa_knob.turns = 1;
+  std::cout << "WASM: event triggered: A32NX_FCU_VS_INC" << std::endl;
+}
 
-    case Events::A32NX_FCU_VS_PULL:
-    case Events::AP_VS_OFF: {
-      fcuAfsPanelInputs.vs_fpa_knob.pulled = true;
-      std::cout << "WASM: event triggered: A32NX_FCU_VS_PULL" << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::A32NX_FCU_VS_DEC>(const DWORD data0, const DWORD data1) {
+  fcuAfsPanelInputs.vs_fpa_knob.turns = -1;
+  std::cout << "WASM: event triggered: A32NX_FCU_VS_DEC" << std::endl;
+}
 
-    case Events::A32NX_FCU_LOC_PUSH: {
-      fcuAfsPanelInputs.loc_button_pressed = true;
-      std::cout << "WASM: event triggered: A32NX_FCU_LOC_PUSH" << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::A32NX_FCU_VS_SET>(const DWORD data0, const DWORD data1) {
+  simInputAutopilot.VS_FPA_set = static_cast<long>(data0);
+  std::cout << "WASM: event triggered: A32NX_FCU_VS_SET: " << static_cast<long>(data0) << std::endl;
+}
 
-    case Events::A32NX_FCU_APPR_PUSH: {
-      fcuAfsPanelInputs.appr_button_pressed = true;
-      std::cout << "WASM: event triggered: A32NX_FCU_APPR_PUSH" << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::A32NX_FCU_VS_PUSH>(const DWORD data0, const DWORD data1) {
+  fcuAfsPanelInputs.vs_fpa_knob.pushed = true;
+  std::cout << "WASM: event triggered: A32NX_FCU_VS_PUSH" << std::endl;
+}
 
-    case Events::A32NX_FCU_EXPED_PUSH:
-    case Events::AP_ATT_HOLD: {
-      fcuAfsPanelInputs.exped_button_pressed = true;
-      std::cout << "WASM: event triggered: A32NX_FCU_EXPED_PUSH" << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::A32NX_FCU_VS_PULL>(const DWORD data0, const DWORD data1) {
+  fcuAfsPanelInputs.vs_fpa_knob.pulled = true;
+  std::cout << "WASM: event triggered: A32NX_FCU_VS_PULL" << std::endl;
+}
 
-    case Events::A32NX_FCU_EFIS_L_FD_PUSH: {
-      fcuEfisPanelInputs[0].fd_button_pushed = true;
-      if (idSyncFoEfisEnabled->get()) {
-        fcuEfisPanelInputs[1].fd_button_pushed = true;
-      }
-      std::cout << "WASM: event triggered: A32NX_FCU_EFIS_L_FD_PUSH" << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::A32NX_FCU_LOC_PUSH>(const DWORD data0, const DWORD data1) {
+  fcuAfsPanelInputs.loc_button_pressed = true;
+  std::cout << "WASM: event triggered: A32NX_FCU_LOC_PUSH" << std::endl;
+}
 
-    case Events::A32NX_FCU_EFIS_L_LS_PUSH: {
-      fcuEfisPanelInputs[0].ls_button_pushed = true;
-      if (idSyncFoEfisEnabled->get()) {
-        fcuEfisPanelInputs[1].ls_button_pushed = true;
-      }
-      std::cout << "WASM: event triggered: A32NX_FCU_EFIS_L_LS_PUSH" << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::A32NX_FCU_APPR_PUSH>(const DWORD data0, const DWORD data1) {
+  fcuAfsPanelInputs.appr_button_pressed = true;
+  std::cout << "WASM: event triggered: A32NX_FCU_APPR_PUSH" << std::endl;
+}
 
-    // TODO Unsync EFIS baro
-    case Events::KOHLSMANN_INC: {
-      if (data1 == 0 || data1 == 1) {
-        fcuEfisPanelInputs[0].baro_knob.turns = 1;
-        fcuEfisPanelInputs[1].baro_knob.turns = 1;
-      }
-      if (data1 != 1) {
-        sendEventEx1(KOHLSMANN_INC, SIMCONNECT_GROUP_PRIORITY_STANDARD, data0, data1);
-      }
-      std::cout << "WASM: event triggered: KOHLSMANN_INC, index " << data1 << std::endl;
-      break;
-    }
-    case Events::A32NX_FCU_EFIS_L_BARO_INC: {
-      fcuEfisPanelInputs[0].baro_knob.turns = 1;
-      fcuEfisPanelInputs[1].baro_knob.turns = 1;
-      std::cout << "WASM: event triggered: A32NX_FCU_EFIS_L_BARO_INC" << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::A32NX_FCU_EXPED_PUSH>(const DWORD data0, const DWORD data1) {
+  fcuAfsPanelInputs.exped_button_pressed = true;
+  std::cout << "WASM: event triggered: A32NX_FCU_EXPED_PUSH" << std::endl;
+}
 
-    case Events::KOHLSMANN_DEC: {
-      if (data1 == 0 || data1 == 1) {
-        fcuEfisPanelInputs[0].baro_knob.turns = -1;
-        fcuEfisPanelInputs[1].baro_knob.turns = -1;
-      }
-      if (data1 != 1) {
-        sendEventEx1(KOHLSMANN_DEC, SIMCONNECT_GROUP_PRIORITY_STANDARD, data0, data1);
-      }
-      std::cout << "WASM: event triggered: KOHLSMANN_DEC, index " << data1 << std::endl;
-      break;
-    }
-    case Events::A32NX_FCU_EFIS_L_BARO_DEC: {
-      fcuEfisPanelInputs[0].baro_knob.turns = -1;
-      fcuEfisPanelInputs[1].baro_knob.turns = -1;
-      std::cout << "WASM: event triggered: A32NX_FCU_EFIS_L_BARO_DEC" << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::A32NX_FCU_EFIS_L_FD_PUSH>(const DWORD data0, const DWORD data1) {
+  fcuEfisPanelInputs[0].fd_button_pushed = true;
+  if (idSyncFoEfisEnabled->get()) {
+    fcuEfisPanelInputs[1].fd_button_pushed = true;
+  }
+  std::cout << "WASM: event triggered: A32NX_FCU_EFIS_L_FD_PUSH" << std::endl;
+}
 
-    case Events::KOHLSMANN_SET: {
-      if (data1 == 0 || data1 == 1) {
-        simInputAutopilot.baro_left_set = data0 / 16.;
-        simInputAutopilot.baro_right_set = data0 / 16.;
-      }
-      if (data1 != 1) {
-        sendEventEx1(KOHLSMANN_SET, SIMCONNECT_GROUP_PRIORITY_STANDARD, data0, data1);
-      }
-      std::cout << "WASM: event triggered: KOHLSMANN_SET, index " << data1 << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::A32NX_FCU_EFIS_L_LS_PUSH>(const DWORD data0, const DWORD data1) {
+  fcuEfisPanelInputs[0].ls_button_pushed = true;
+  if (idSyncFoEfisEnabled->get()) {
+    fcuEfisPanelInputs[1].ls_button_pushed = true;
+  }
+  std::cout << "WASM: event triggered: A32NX_FCU_EFIS_L_LS_PUSH" << std::endl;
+}
 
-    case Events::A32NX_FCU_EFIS_L_BARO_SET: {
-      simInputAutopilot.baro_left_set = static_cast<long>(data0) / 16.;
-      simInputAutopilot.baro_right_set = static_cast<long>(data0) / 16.;
-      std::cout << "WASM: event triggered: A32NX_FCU_EFIS_L_BARO_SET: " << static_cast<long>(data0) << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::KOHLSMANN_INC>(const DWORD data0, const DWORD data1) {
+  if (data1 == 0 || data1 == 1) {
+    fcuEfisPanelInputs[0].baro_knob.turns = 1;
+    fcuEfisPanelInputs[1].baro_knob.turns = 1;
+  }
+  if (data1 != 1) {
+    sendEventEx1(KOHLSMANN_INC, SIMCONNECT_GROUP_PRIORITY_STANDARD, data0, data1);
+  }
+  std::cout << "WASM: event triggered: KOHLSMANN_INC, index " << data1 << std::endl;
+}
 
-    case Events::BAROMETRIC_STD_PRESSURE: {
-      if (data0 == 0 || data0 == 1) {
-        simInputAutopilot.baro_left_set = 1013;
-        simInputAutopilot.baro_right_set = 1013;
-      }
-      if (data0 != 1) {
-        sendEvent(BAROMETRIC_STD_PRESSURE, 0, SIMCONNECT_GROUP_PRIORITY_STANDARD);
-      }
-      std::cout << "WASM: event triggered: BAROMETRIC_STD_PRESSURE, index " << data0 << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::A32NX_FCU_EFIS_L_BARO_INC>(const DWORD data0, const DWORD data1) {
+  fcuEfisPanelInputs[0].baro_knob.turns = 1;
+  fcuEfisPanelInputs[1].baro_knob.turns = 1;
+  std::cout << "WASM: event triggered: A32NX_FCU_EFIS_L_BARO_INC" << std::endl;
+}
 
-    case Events::A32NX_FCU_EFIS_L_BARO_PUSH: {
-      fcuEfisPanelInputs[0].baro_knob.pushed = true;
-      fcuEfisPanelInputs[1].baro_knob.pushed = true;
-      std::cout << "WASM: event triggered: A32NX_FCU_EFIS_L_BARO_PUSH" << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::KOHLSMANN_DEC>(const DWORD data0, const DWORD data1) {
+  if (data1 == 0 || data1 == 1) {
+    fcuEfisPanelInputs[0].baro_knob.turns = -1;
+    fcuEfisPanelInputs[1].baro_knob.turns = -1;
+  }
+  if (data1 != 1) {
+    sendEventEx1(KOHLSMANN_DEC, SIMCONNECT_GROUP_PRIORITY_STANDARD, data0, data1);
+  }
+  std::cout << "WASM: event triggered: KOHLSMANN_DEC, index " << data1 << std::endl;
+}
 
-    case Events::A32NX_FCU_EFIS_L_BARO_PULL: {
-      fcuEfisPanelInputs[0].baro_knob.pulled = true;
-      fcuEfisPanelInputs[1].baro_knob.pulled = true;
-      std::cout << "WASM: event triggered: A32NX_FCU_EFIS_L_BARO_PULL" << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::A32NX_FCU_EFIS_L_BARO_DEC>(const DWORD data0, const DWORD data1) {
+  fcuEfisPanelInputs[0].baro_knob.turns = -1;
+  fcuEfisPanelInputs[1].baro_knob.turns = -1;
+  std::cout << "WASM: event triggered: A32NX_FCU_EFIS_L_BARO_DEC" << std::endl;
+}
 
-    case Events::A32NX_FCU_EFIS_L_CSTR_PUSH: {
-      fcuEfisPanelInputs[0].cstr_button_pushed = true;
-      std::cout << "WASM: event triggered: A32NX_FCU_EFIS_L_CSTR_PUSH" << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::KOHLSMANN_SET>(const DWORD data0, const DWORD data1) {
+  if (data1 == 0 || data1 == 1) {
+    simInputAutopilot.baro_left_set = data0 / 16.;
+    simInputAutopilot.baro_right_set = data0 / 16.;
+  }
+  if (data1 != 1) {
+    sendEventEx1(KOHLSMANN_SET, SIMCONNECT_GROUP_PRIORITY_STANDARD, data0, data1);
+  }
+  std::cout << "WASM: event triggered: KOHLSMANN_SET, index " << data1 << std::endl;
+}
 
-    case Events::A32NX_FCU_EFIS_L_WPT_PUSH: {
-      fcuEfisPanelInputs[0].wpt_button_pushed = true;
-      std::cout << "WASM: event triggered: A32NX_FCU_EFIS_L_WPT_PUSH" << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::A32NX_FCU_EFIS_L_BARO_SET>(const DWORD data0, const DWORD data1) {
+  simInputAutopilot.baro_left_set = static_cast<long>(data0) / 16.;
+  simInputAutopilot.baro_right_set = static_cast<long>(data0) / 16.;
+  std::cout << "WASM: event triggered: A32NX_FCU_EFIS_L_BARO_SET: " << static_cast<long>(data0) << std::endl;
+}
 
-    case Events::A32NX_FCU_EFIS_L_VORD_PUSH: {
-      fcuEfisPanelInputs[0].vord_button_pushed = true;
-      std::cout << "WASM: event triggered: A32NX_FCU_EFIS_L_VORD_PUSH" << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::BAROMETRIC_STD_PRESSURE>(const DWORD data0, const DWORD data1) {
+  if (data0 == 0 || data0 == 1) {
+    simInputAutopilot.baro_left_set = 1013;
+    simInputAutopilot.baro_right_set = 1013;
+  }
+  if (data0 != 1) {
+    sendEvent(BAROMETRIC_STD_PRESSURE, 0, SIMCONNECT_GROUP_PRIORITY_STANDARD);
+  }
+  std::cout << "WASM: event triggered: BAROMETRIC_STD_PRESSURE, index " << data0 << std::endl;
+}
 
-    case Events::A32NX_FCU_EFIS_L_NDB_PUSH: {
-      fcuEfisPanelInputs[0].ndb_button_pushed = true;
-      std::cout << "WASM: event triggered: A32NX_FCU_EFIS_L_NDB_PUSH" << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::A32NX_FCU_EFIS_L_BARO_PUSH>(const DWORD data0, const DWORD data1) {
+  fcuEfisPanelInputs[0].baro_knob.pushed = true;
+  fcuEfisPanelInputs[1].baro_knob.pushed = true;
+  std::cout << "WASM: event triggered: A32NX_FCU_EFIS_L_BARO_PUSH" << std::endl;
+}
 
-    case Events::A32NX_FCU_EFIS_L_ARPT_PUSH: {
-      fcuEfisPanelInputs[0].arpt_button_pushed = true;
-      std::cout << "WASM: event triggered: A32NX_FCU_EFIS_L_ARPT_PUSH" << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::A32NX_FCU_EFIS_L_BARO_PULL>(const DWORD data0, const DWORD data1) {
+  fcuEfisPanelInputs[0].baro_knob.pulled = true;
+  fcuEfisPanelInputs[1].baro_knob.pulled = true;
+  std::cout << "WASM: event triggered: A32NX_FCU_EFIS_L_BARO_PULL" << std::endl;
+}
 
-    case Events::A32NX_FCU_EFIS_R_FD_PUSH: {
-      fcuEfisPanelInputs[1].fd_button_pushed = true;
-      if (idSyncFoEfisEnabled->get()) {
-        fcuEfisPanelInputs[0].fd_button_pushed = true;
-      }
-      std::cout << "WASM: event triggered: A32NX_FCU_EFIS_R_FD_PUSH" << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::A32NX_FCU_EFIS_L_CSTR_PUSH>(const DWORD data0, const DWORD data1) {
+  fcuEfisPanelInputs[0].cstr_button_pushed = true;
+  std::cout << "WASM: event triggered: A32NX_FCU_EFIS_L_CSTR_PUSH" << std::endl;
+}
 
-    case Events::A32NX_FCU_EFIS_R_LS_PUSH: {
-      fcuEfisPanelInputs[1].ls_button_pushed = true;
-      if (idSyncFoEfisEnabled->get()) {
-        fcuEfisPanelInputs[0].ls_button_pushed = true;
-      }
-      std::cout << "WASM: event triggered: A32NX_FCU_EFIS_R_LS_PUSH" << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::A32NX_FCU_EFIS_L_WPT_PUSH>(const DWORD data0, const DWORD data1) {
+  fcuEfisPanelInputs[0].wpt_button_pushed = true;
+  std::cout << "WASM: event triggered: A32NX_FCU_EFIS_L_WPT_PUSH" << std::endl;
+}
 
-    // TODO Unsync EFIS baro
-    case Events::A32NX_FCU_EFIS_R_BARO_INC: {
-      fcuEfisPanelInputs[1].baro_knob.turns = 1;
-      fcuEfisPanelInputs[0].baro_knob.turns = 1;
-      std::cout << "WASM: event triggered: A32NX_FCU_EFIS_R_BARO_INC" << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::A32NX_FCU_EFIS_L_VORD_PUSH>(const DWORD data0, const DWORD data1) {
+  fcuEfisPanelInputs[0].vord_button_pushed = true;
+  std::cout << "WASM: event triggered: A32NX_FCU_EFIS_L_VORD_PUSH" << std::endl;
+}
 
-    case Events::A32NX_FCU_EFIS_R_BARO_DEC: {
-      fcuEfisPanelInputs[1].baro_knob.turns = -1;
-      fcuEfisPanelInputs[0].baro_knob.turns = -1;
-      std::cout << "WASM: event triggered: A32NX_FCU_EFIS_R_BARO_DEC" << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::A32NX_FCU_EFIS_L_NDB_PUSH>(const DWORD data0, const DWORD data1) {
+  fcuEfisPanelInputs[0].ndb_button_pushed = true;
+  std::cout << "WASM: event triggered: A32NX_FCU_EFIS_L_NDB_PUSH" << std::endl;
+}
 
-    case Events::A32NX_FCU_EFIS_R_BARO_SET: {
-      simInputAutopilot.baro_left_set = static_cast<long>(data0) / 16.;
-      simInputAutopilot.baro_right_set = static_cast<long>(data0) / 16.;
-      std::cout << "WASM: event triggered: A32NX_FCU_EFIS_R_BARO_SET: " << static_cast<long>(data0) << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::A32NX_FCU_EFIS_L_ARPT_PUSH>(const DWORD data0, const DWORD data1) {
+  fcuEfisPanelInputs[0].arpt_button_pushed = true;
+  std::cout << "WASM: event triggered: A32NX_FCU_EFIS_L_ARPT_PUSH" << std::endl;
+}
 
-    case Events::A32NX_FCU_EFIS_R_BARO_PUSH: {
-      fcuEfisPanelInputs[1].baro_knob.pushed = true;
-      fcuEfisPanelInputs[0].baro_knob.pushed = true;
-      std::cout << "WASM: event triggered: A32NX_FCU_EFIS_R_BARO_PUSH" << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::A32NX_FCU_EFIS_R_FD_PUSH>(const DWORD data0, const DWORD data1) {
+  fcuEfisPanelInputs[1].fd_button_pushed = true;
+  if (idSyncFoEfisEnabled->get()) {
+    fcuEfisPanelInputs[0].fd_button_pushed = true;
+  }
+  std::cout << "WASM: event triggered: A32NX_FCU_EFIS_R_FD_PUSH" << std::endl;
+}
 
-    case Events::A32NX_FCU_EFIS_R_BARO_PULL: {
-      fcuEfisPanelInputs[1].baro_knob.pulled = true;
-      fcuEfisPanelInputs[0].baro_knob.pulled = true;
-      std::cout << "WASM: event triggered: A32NX_FCU_EFIS_R_BARO_PULL" << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::A32NX_FCU_EFIS_R_LS_PUSH>(const DWORD data0, const DWORD data1) {
+  fcuEfisPanelInputs[1].ls_button_pushed = true;
+  if (idSyncFoEfisEnabled->get()) {
+    fcuEfisPanelInputs[0].ls_button_pushed = true;
+  }
+  std::cout << "WASM: event triggered: A32NX_FCU_EFIS_R_LS_PUSH" << std::endl;
+}
 
-    case Events::A32NX_FCU_EFIS_R_CSTR_PUSH: {
-      fcuEfisPanelInputs[1].cstr_button_pushed = true;
-      std::cout << "WASM: event triggered: A32NX_FCU_EFIS_R_CSTR_PUSH" << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::A32NX_FCU_EFIS_R_BARO_INC>(const DWORD data0, const DWORD data1) {
+  fcuEfisPanelInputs[1].baro_knob.turns = 1;
+  fcuEfisPanelInputs[0].baro_knob.turns = 1;
+  std::cout << "WASM: event triggered: A32NX_FCU_EFIS_R_BARO_INC" << std::endl;
+}
 
-    case Events::A32NX_FCU_EFIS_R_WPT_PUSH: {
-      fcuEfisPanelInputs[1].wpt_button_pushed = true;
-      std::cout << "WASM: event triggered: A32NX_FCU_EFIS_R_WPT_PUSH" << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::A32NX_FCU_EFIS_R_BARO_DEC>(const DWORD data0, const DWORD data1) {
+  fcuEfisPanelInputs[1].baro_knob.turns = -1;
+  fcuEfisPanelInputs[0].baro_knob.turns = -1;
+  std::cout << "WASM: event triggered: A32NX_FCU_EFIS_R_BARO_DEC" << std::endl;
+}
 
-    case Events::A32NX_FCU_EFIS_R_VORD_PUSH: {
-      fcuEfisPanelInputs[1].vord_button_pushed = true;
-      std::cout << "WASM: event triggered: A32NX_FCU_EFIS_R_VORD_PUSH" << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::A32NX_FCU_EFIS_R_BARO_SET>(const DWORD data0, const DWORD data1) {
+  simInputAutopilot.baro_left_set = static_cast<long>(data0) / 16.;
+  simInputAutopilot.baro_right_set = static_cast<long>(data0) / 16.;
+  std::cout << "WASM: event triggered: A32NX_FCU_EFIS_R_BARO_SET: " << static_cast<long>(data0) << std::endl;
+}
 
-    case Events::A32NX_FCU_EFIS_R_NDB_PUSH: {
-      fcuEfisPanelInputs[1].ndb_button_pushed = true;
-      std::cout << "WASM: event triggered: A32NX_FCU_EFIS_R_NDB_PUSH" << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::A32NX_FCU_EFIS_R_BARO_PUSH>(const DWORD data0, const DWORD data1) {
+  fcuEfisPanelInputs[1].baro_knob.pushed = true;
+  fcuEfisPanelInputs[0].baro_knob.pushed = true;
+  std::cout << "WASM: event triggered: A32NX_FCU_EFIS_R_BARO_PUSH" << std::endl;
+}
 
-    case Events::A32NX_FCU_EFIS_R_ARPT_PUSH: {
-      fcuEfisPanelInputs[1].arpt_button_pushed = true;
-      std::cout << "WASM: event triggered: A32NX_FCU_EFIS_R_ARPT_PUSH" << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::A32NX_FCU_EFIS_R_BARO_PULL>(const DWORD data0, const DWORD data1) {
+  fcuEfisPanelInputs[1].baro_knob.pulled = true;
+  fcuEfisPanelInputs[0].baro_knob.pulled = true;
+  std::cout << "WASM: event triggered: A32NX_FCU_EFIS_R_BARO_PULL" << std::endl;
+}
 
-    case Events::A32NX_FMGC_DIR_TO_TRIGGER: {
-      simInputAutopilot.DIR_TO_trigger = 1;
-      std::cout << "WASM: event triggered: A32NX_FMGC_DIR_TO_TRIGGER" << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::A32NX_FCU_EFIS_R_CSTR_PUSH>(const DWORD data0, const DWORD data1) {
+  fcuEfisPanelInputs[1].cstr_button_pushed = true;
+  std::cout << "WASM: event triggered: A32NX_FCU_EFIS_R_CSTR_PUSH" << std::endl;
+}
 
-    case Events::A32NX_FMGC_MACH_MODE_ACTIVATE: {
-      simInputAutopilot.mach_mode_activate = 1;
-      std::cout << "WASM: event triggered: A32NX_FMGC_MACH_MODE_ACTIVATE" << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::A32NX_FCU_EFIS_R_WPT_PUSH>(const DWORD data0, const DWORD data1) {
+  fcuEfisPanelInputs[1].wpt_button_pushed = true;
+  std::cout << "WASM: event triggered: A32NX_FCU_EFIS_R_WPT_PUSH" << std::endl;
+}
 
-    case Events::A32NX_FMGC_SPD_MODE_ACTIVATE: {
-      simInputAutopilot.spd_mode_activate = 1;
-      std::cout << "WASM: event triggered: A32NX_FMGC_SPD_MODE_ACTIVATE" << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::A32NX_FCU_EFIS_R_VORD_PUSH>(const DWORD data0, const DWORD data1) {
+  fcuEfisPanelInputs[1].vord_button_pushed = true;
+  std::cout << "WASM: event triggered: A32NX_FCU_EFIS_R_VORD_PUSH" << std::endl;
+}
 
-    case Events::A32NX_FMGC_PRESET_SPD_ACTIVATE: {
-      simInputAutopilot.preset_spd_activate = 1;
-      std::cout << "WASM: event triggered: A32NX_FMGC_PRESET_SPD_ACTIVATE" << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::A32NX_FCU_EFIS_R_NDB_PUSH>(const DWORD data0, const DWORD data1) {
+  fcuEfisPanelInputs[1].ndb_button_pushed = true;
+  std::cout << "WASM: event triggered: A32NX_FCU_EFIS_R_NDB_PUSH" << std::endl;
+}
 
-    case Events::A32NX_EFIS_L_CHRONO_PUSHED: {
-      execute_calculator_code("(>H:A32NX_EFIS_L_CHRONO_PUSHED)", nullptr, nullptr, nullptr);
-      std::cout << "WASM: event triggered: A32NX_EFIS_L_CHRONO_PUSHED" << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::A32NX_FCU_EFIS_R_ARPT_PUSH>(const DWORD data0, const DWORD data1) {
+  fcuEfisPanelInputs[1].arpt_button_pushed = true;
+  std::cout << "WASM: event triggered: A32NX_FCU_EFIS_R_ARPT_PUSH" << std::endl;
+}
 
-    case Events::A32NX_EFIS_R_CHRONO_PUSHED: {
-      execute_calculator_code("(>H:A32NX_EFIS_R_CHRONO_PUSHED)", nullptr, nullptr, nullptr);
-      std::cout << "WASM: event triggered: A32NX_EFIS_R_CHRONO_PUSHED" << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::A32NX_FMGC_DIR_TO_TRIGGER>(const DWORD data0, const DWORD data1) {
+  simInputAutopilot.DIR_TO_trigger = 1;
+  std::cout << "WASM: event triggered: A32NX_FMGC_DIR_TO_TRIGGER" << std::endl;
+}
 
-    case Events::AP_SPEED_SLOT_INDEX_SET: {
-      // for the time being do not activate, it ends in a loop. more work has to be done to support this
-      // if (static_cast<long>(event->data0) == 2) {
-      //   execute_calculator_code("(>H:A320_Neo_FCU_SPEED_PUSH)", nullptr, nullptr, nullptr);
-      // } else {
-      //   execute_calculator_code("(>H:A320_Neo_FCU_SPEED_PULL)", nullptr, nullptr, nullptr);
-      // }
-      std::cout << "WASM: event triggered: SPEED_SLOT_INDEX_SET: " << static_cast<long>(data0) << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::A32NX_FMGC_MACH_MODE_ACTIVATE>(const DWORD data0, const DWORD data1) {
+  simInputAutopilot.mach_mode_activate = 1;
+  std::cout << "WASM: event triggered: A32NX_FMGC_MACH_MODE_ACTIVATE" << std::endl;
+}
 
-    case Events::AP_SPD_VAR_INC: {
-      fcuAfsPanelInputs.spd_knob.turns = 1;
-      std::cout << "WASM: event triggered: AP_SPD_VAR_INC" << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::A32NX_FMGC_SPD_MODE_ACTIVATE>(const DWORD data0, const DWORD data1) {
+  simInputAutopilot.spd_mode_activate = 1;
+  std::cout << "WASM: event triggered: A32NX_FMGC_SPD_MODE_ACTIVATE" << std::endl;
+}
 
-    case Events::AP_SPD_VAR_DEC: {
-      fcuAfsPanelInputs.spd_knob.turns = -1;
-      std::cout << "WASM: event triggered: AP_SPD_VAR_DEC" << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::A32NX_FMGC_PRESET_SPD_ACTIVATE>(const DWORD data0, const DWORD data1) {
+  simInputAutopilot.preset_spd_activate = 1;
+  std::cout << "WASM: event triggered: A32NX_FMGC_PRESET_SPD_ACTIVATE" << std::endl;
+}
 
-    case Events::AP_MACH_VAR_INC: {
-      fcuAfsPanelInputs.spd_knob.turns = 1;
-      std::cout << "WASM: event triggered: AP_MACH_VAR_INC" << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::A32NX_EFIS_L_CHRONO_PUSHED>(const DWORD data0, const DWORD data1) {
+  execute_calculator_code("(>H:A32NX_EFIS_L_CHRONO_PUSHED)", nullptr, nullptr, nullptr);
+  std::cout << "WASM: event triggered: A32NX_EFIS_L_CHRONO_PUSHED" << std::endl;
+}
 
-    case Events::AP_MACH_VAR_DEC: {
-      fcuAfsPanelInputs.spd_knob.turns = -1;
-      std::cout << "WASM: event triggered: AP_MACH_VAR_DEC" << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::A32NX_EFIS_R_CHRONO_PUSHED>(const DWORD data0, const DWORD data1) {
+  execute_calculator_code("(>H:A32NX_EFIS_R_CHRONO_PUSHED)", nullptr, nullptr, nullptr);
+  std::cout << "WASM: event triggered: A32NX_EFIS_R_CHRONO_PUSHED" << std::endl;
+}
 
-    case Events::AP_HEADING_SLOT_INDEX_SET: {
-      // for the time being do not activate, it ends in a loop. more work has to be done to support this
-      // if (static_cast<long>(event->data0) == 2) {
-      //   execute_calculator_code("(>H:A320_Neo_FCU_VS_PUSH)", nullptr, nullptr, nullptr);
-      // } else {
-      //   execute_calculator_code("(>H:A320_Neo_FCU_VS_PULL)", nullptr, nullptr, nullptr);
-      // }
-      std::cout << "WASM: event triggered: HEADING_SLOT_INDEX_SET: " << static_cast<long>(data0) << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::AP_SPEED_SLOT_INDEX_SET>(const DWORD data0, const DWORD data1) {
+  // for the time being do not activate, it ends in a loop. more work has to be done to support this
+  // if (static_cast<long>(event->data0) == 2) {
+  //   execute_calculator_code("(>H:A320_Neo_FCU_SPEED_PUSH)", nullptr, nullptr, nullptr);
+  // } else {
+  //   execute_calculator_code("(>H:A320_Neo_FCU_SPEED_PULL)", nullptr, nullptr, nullptr);
+  // }
+  std::cout << "WASM: event triggered: SPEED_SLOT_INDEX_SET: " << static_cast<long>(data0) << std::endl;
+}
 
-    case Events::HEADING_BUG_INC: {
-      fcuAfsPanelInputs.hdg_trk_knob.turns = 1;
-      std::cout << "WASM: event triggered: HEADING_BUG_INC" << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::AP_SPD_VAR_INC>(const DWORD data0, const DWORD data1) {
+  fcuAfsPanelInputs.spd_knob.turns = 1;
+  std::cout << "WASM: event triggered: AP_SPD_VAR_INC" << std::endl;
+}
 
-    case Events::HEADING_BUG_DEC: {
-      fcuAfsPanelInputs.hdg_trk_knob.turns = -1;
-      std::cout << "WASM: event triggered: HEADING_BUG_DEC" << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::AP_SPD_VAR_DEC>(const DWORD data0, const DWORD data1) {
+  fcuAfsPanelInputs.spd_knob.turns = -1;
+  std::cout << "WASM: event triggered: AP_SPD_VAR_DEC" << std::endl;
+}
 
-    case Events::AP_ALTITUDE_SLOT_INDEX_SET: {
-      // for the time being do not activate, it ends in a loop. more work has to be done to support this
-      // if (static_cast<long>(event->data0) == 2) {
-      //   execute_calculator_code("(>H:A320_Neo_FCU_ALT_PUSH) (>H:A320_Neo_CDU_MODE_MANAGED_ALTITUDE)", nullptr, nullptr, nullptr);
-      // } else {
-      //   execute_calculator_code("(>H:A320_Neo_FCU_ALT_PULL) (>H:A320_Neo_CDU_MODE_SELECTED_ALTITUDE)", nullptr, nullptr, nullptr);
-      // }
-      std::cout << "WASM: event triggered: ALTITUDE_SLOT_INDEX_SET: " << static_cast<long>(data0) << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::AP_MACH_VAR_INC>(const DWORD data0, const DWORD data1) {
+  fcuAfsPanelInputs.spd_knob.turns = 1;
+  std::cout << "WASM: event triggered: AP_MACH_VAR_INC" << std::endl;
+}
 
-    case Events::AP_ALT_VAR_INC: {
-      fcuAfsPanelInputs.alt_knob.turns = 1;
-      std::cout << "WASM: event triggered: AP_ALT_VAR_INC" << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::AP_MACH_VAR_DEC>(const DWORD data0, const DWORD data1) {
+  fcuAfsPanelInputs.spd_knob.turns = -1;
+  std::cout << "WASM: event triggered: AP_MACH_VAR_DEC" << std::endl;
+}
 
-    case Events::AP_ALT_VAR_DEC: {
-      fcuAfsPanelInputs.alt_knob.turns = -1;
-      std::cout << "WASM: event triggered: AP_ALT_VAR_DEC" << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::AP_HEADING_SLOT_INDEX_SET>(const DWORD data0, const DWORD data1) {
+  // for the time being do not activate, it ends in a loop. more work has to be done to support this
+  // if (static_cast<long>(event->data0) == 2) {
+  //   execute_calculator_code("(>H:A320_Neo_FCU_VS_PUSH)", nullptr, nullptr, nullptr);
+  // } else {
+  //   execute_calculator_code("(>H:A320_Neo_FCU_VS_PULL)", nullptr, nullptr, nullptr);
+  // }
+  std::cout << "WASM: event triggered: HEADING_SLOT_INDEX_SET: " << static_cast<long>(data0) << std::endl;
+}
 
-    case Events::AP_ALT_VAR_SET: {
-      simInputAutopilot.ALT_set = static_cast<long>(data0);
-      std::cout << "WASM: event triggered: AP_ALT_VAR_SET: " << static_cast<long>(data0) << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::HEADING_BUG_INC>(const DWORD data0, const DWORD data1) {
+  fcuAfsPanelInputs.hdg_trk_knob.turns = 1;
+  std::cout << "WASM: event triggered: HEADING_BUG_INC" << std::endl;
+}
 
-    case Events::AP_VS_SLOT_INDEX_SET: {
-      // for the time being do not activate, it ends in a loop. more work has to be done to support this
-      // if (static_cast<long>(event->data0) == 2) {
-      //   execute_calculator_code("(>H:A320_Neo_FCU_VS_PUSH)", nullptr, nullptr, nullptr);
-      // } else {
-      //   execute_calculator_code("(>H:A320_Neo_FCU_VS_PULL)", nullptr, nullptr, nullptr);
-      // }
-      std::cout << "WASM: event triggered: VS_SLOT_INDEX_SET: " << static_cast<long>(data0) << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::HEADING_BUG_DEC>(const DWORD data0, const DWORD data1) {
+  fcuAfsPanelInputs.hdg_trk_knob.turns = -1;
+  std::cout << "WASM: event triggered: HEADING_BUG_DEC" << std::endl;
+}
 
-    case Events::AP_VS_VAR_INC: {
-      fcuAfsPanelInputs.vs_fpa_knob.turns = 1;
-      std::cout << "WASM: event triggered: AP_VS_VAR_INC" << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::AP_ALTITUDE_SLOT_INDEX_SET>(const DWORD data0, const DWORD data1) {
+  // for the time being do not activate, it ends in a loop. more work has to be done to support this
+  // if (static_cast<long>(event->data0) == 2) {
+  //   execute_calculator_code("(>H:A320_Neo_FCU_ALT_PUSH) (>H:A320_Neo_CDU_MODE_MANAGED_ALTITUDE)", nullptr, nullptr, nullptr);
+  // } else {
+  //   execute_calculator_code("(>H:A320_Neo_FCU_ALT_PULL) (>H:A320_Neo_CDU_MODE_SELECTED_ALTITUDE)", nullptr, nullptr, nullptr);
+  // }
+  std::cout << "WASM: event triggered: ALTITUDE_SLOT_INDEX_SET: " << static_cast<long>(data0) << std::endl;
+}
 
-    case Events::AP_VS_VAR_DEC: {
-      fcuAfsPanelInputs.vs_fpa_knob.turns = -1;
-      std::cout << "WASM: event triggered: AP_VS_VAR_DEC" << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::AP_ALT_VAR_INC>(const DWORD data0, const DWORD data1) {
+  fcuAfsPanelInputs.alt_knob.turns = 1;
+  std::cout << "WASM: event triggered: AP_ALT_VAR_INC" << std::endl;
+}
 
-    case Events::AP_APR_HOLD: {
-      fcuAfsPanelInputs.appr_button_pressed = true;
-      std::cout << "WASM: event triggered: AP_APR_HOLD" << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::AP_ALT_VAR_DEC>(const DWORD data0, const DWORD data1) {
+  fcuAfsPanelInputs.alt_knob.turns = -1;
+  std::cout << "WASM: event triggered: AP_ALT_VAR_DEC" << std::endl;
+}
 
-    case Events::AP_LOC_HOLD: {
-      fcuAfsPanelInputs.loc_button_pressed = true;
-      std::cout << "WASM: event triggered: AP_LOC_HOLD" << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::AP_ALT_VAR_SET>(const DWORD data0, const DWORD data1) {
+  simInputAutopilot.ALT_set = static_cast<long>(data0);
+  std::cout << "WASM: event triggered: AP_ALT_VAR_SET: " << static_cast<long>(data0) << std::endl;
+}
 
-    case Events::BAROMETRIC: {
-      simInputAutopilot.baro_left_set = simData.seaLevelPressure;
-      simInputAutopilot.baro_right_set = simData.seaLevelPressure;
-      sendEvent(Events::BAROMETRIC, 0, SIMCONNECT_GROUP_PRIORITY_STANDARD);
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::AP_VS_SLOT_INDEX_SET>(const DWORD data0, const DWORD data1) {
+  // for the time being do not activate, it ends in a loop. more work has to be done to support this
+  // if (static_cast<long>(event->data0) == 2) {
+  //   execute_calculator_code("(>H:A320_Neo_FCU_VS_PUSH)", nullptr, nullptr, nullptr);
+  // } else {
+  //   execute_calculator_code("(>H:A320_Neo_FCU_VS_PULL)", nullptr, nullptr, nullptr);
+  // }
+  std::cout << "WASM: event triggered: VS_SLOT_INDEX_SET: " << static_cast<long>(data0) << std::endl;
+}
 
-      std::cout << "WASM: event triggered: BAROMETRIC" << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::AP_VS_VAR_INC>(const DWORD data0, const DWORD data1) {
+  fcuAfsPanelInputs.vs_fpa_knob.turns = 1;
+  std::cout << "WASM: event triggered: AP_VS_VAR_INC" << std::endl;
+}
 
-    case Events::AUTO_THROTTLE_ARM: {
-      simInputThrottles.ATHR_push = 1;
-      std::cout << "WASM: event triggered: AUTO_THROTTLE_ARM" << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::AP_VS_VAR_DEC>(const DWORD data0, const DWORD data1) {
+  fcuAfsPanelInputs.vs_fpa_knob.turns = -1;
+  std::cout << "WASM: event triggered: AP_VS_VAR_DEC" << std::endl;
+}
 
-    case Events::AUTO_THROTTLE_DISCONNECT: {
-      simInputThrottles.ATHR_disconnect = 1;
-      std::cout << "WASM: event triggered: AUTO_THROTTLE_DISCONNECT" << std::endl;
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::AP_APR_HOLD>(const DWORD data0, const DWORD data1) {
+  fcuAfsPanelInputs.appr_button_pressed = true;
+  std::cout << "WASM: event triggered: AP_APR_HOLD" << std::endl;
+}
 
-      // Re emitting masked event
-      sendEvent(Events::A32NX_AUTO_THROTTLE_DISCONNECT, 0, SIMCONNECT_GROUP_PRIORITY_STANDARD);
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::AP_LOC_HOLD>(const DWORD data0, const DWORD data1) {
+  fcuAfsPanelInputs.loc_button_pressed = true;
+  std::cout << "WASM: event triggered: AP_LOC_HOLD" << std::endl;
+}
 
-    case Events::A32NX_ATHR_RESET_DISABLE: {
-      simInputThrottles.ATHR_reset_disable = 1;
-      std::cout << "WASM: event triggered: ATHR_RESET_DISABLE" << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::BAROMETRIC>(const DWORD data0, const DWORD data1) {
+  simInputAutopilot.baro_left_set = simData.seaLevelPressure;
+  simInputAutopilot.baro_right_set = simData.seaLevelPressure;
+  sendEvent(Events::BAROMETRIC, 0, SIMCONNECT_GROUP_PRIORITY_STANDARD);
 
-    case Events::AUTO_THROTTLE_TO_GA: {
-      throttleAxis[0]->onEventThrottleFull();
-      throttleAxis[1]->onEventThrottleFull();
-      std::cout << "WASM: event triggered: AUTO_THROTTLE_TO_GA (treated like THROTTLE_FULL)" << std::endl;
-      break;
-    }
+  std::cout << "WASM: event triggered: BAROMETRIC" << std::endl;
+}
 
-    case Events::A32NX_THROTTLE_MAPPING_SET_DEFAULTS: {
-      std::cout << "WASM: event triggered: THROTTLE_MAPPING_SET_DEFAULTS" << std::endl;
-      throttleAxis[0]->applyDefaults();
-      throttleAxis[1]->applyDefaults();
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::AUTO_THROTTLE_ARM>(const DWORD data0, const DWORD data1) {
+  simInputThrottles.ATHR_push = 1;
+  std::cout << "WASM: event triggered: AUTO_THROTTLE_ARM" << std::endl;
+}
 
-    case Events::A32NX_THROTTLE_MAPPING_LOAD_FROM_FILE: {
-      std::cout << "WASM: event triggered: THROTTLE_MAPPING_LOAD_FROM_FILE" << std::endl;
-      throttleAxis[0]->loadFromFile();
-      throttleAxis[1]->loadFromFile();
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::AUTO_THROTTLE_DISCONNECT>(const DWORD data0, const DWORD data1) {
+  simInputThrottles.ATHR_disconnect = 1;
+  std::cout << "WASM: event triggered: AUTO_THROTTLE_DISCONNECT" << std::endl;
 
-    case Events::A32NX_THROTTLE_MAPPING_LOAD_FROM_LOCAL_VARIABLES: {
-      std::cout << "WASM: event triggered: THROTTLE_MAPPING_LOAD_FROM_LOCAL_VARIABLES" << std::endl;
-      throttleAxis[0]->loadFromLocalVariables();
-      throttleAxis[1]->loadFromLocalVariables();
-      break;
-    }
+  // Re emitting masked event
+  sendEvent(Events::A32NX_AUTO_THROTTLE_DISCONNECT, 0, SIMCONNECT_GROUP_PRIORITY_STANDARD);
+}
 
-    case Events::A32NX_THROTTLE_MAPPING_SAVE_TO_FILE: {
-      std::cout << "WASM: event triggered: THROTTLE_MAPPING_SAVE_TO_FILE" << std::endl;
-      throttleAxis[0]->saveToFile();
-      throttleAxis[1]->saveToFile();
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::A32NX_ATHR_RESET_DISABLE>(const DWORD data0, const DWORD data1) {
+  simInputThrottles.ATHR_reset_disable = 1;
+  std::cout << "WASM: event triggered: ATHR_RESET_DISABLE" << std::endl;
+}
 
-    case Events::THROTTLE_SET: {
-      throttleAxis[0]->onEventThrottleSet(static_cast<long>(data0));
-      throttleAxis[1]->onEventThrottleSet(static_cast<long>(data0));
-      if (loggingThrottlesEnabled) {
-        std::cout << "WASM: THROTTLE_SET: " << static_cast<long>(data0) << std::endl;
-      }
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::AUTO_THROTTLE_TO_GA>(const DWORD data0, const DWORD data1) {
+  throttleAxis[0]->onEventThrottleFull();
+  throttleAxis[1]->onEventThrottleFull();
+  std::cout << "WASM: event triggered: AUTO_THROTTLE_TO_GA (treated like THROTTLE_FULL)" << std::endl;
+}
 
-    case Events::THROTTLE1_SET: {
-      throttleAxis[0]->onEventThrottleSet(static_cast<long>(data0));
-      if (loggingThrottlesEnabled) {
-        std::cout << "WASM: THROTTLE1_SET: " << static_cast<long>(data0) << std::endl;
-      }
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::A32NX_THROTTLE_MAPPING_SET_DEFAULTS>(const DWORD data0, const DWORD data1) {
+  std::cout << "WASM: event triggered: THROTTLE_MAPPING_SET_DEFAULTS" << std::endl;
+  throttleAxis[0]->applyDefaults();
+  throttleAxis[1]->applyDefaults();
+}
 
-    case Events::THROTTLE2_SET: {
-      throttleAxis[1]->onEventThrottleSet(static_cast<long>(data0));
-      if (loggingThrottlesEnabled) {
-        std::cout << "WASM: THROTTLE2_SET: " << static_cast<long>(data0) << std::endl;
-      }
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::A32NX_THROTTLE_MAPPING_LOAD_FROM_FILE>(const DWORD data0, const DWORD data1) {
+  std::cout << "WASM: event triggered: THROTTLE_MAPPING_LOAD_FROM_FILE" << std::endl;
+  throttleAxis[0]->loadFromFile();
+  throttleAxis[1]->loadFromFile();
+}
 
-    case Events::THROTTLE_AXIS_SET_EX1: {
-      throttleAxis[0]->onEventThrottleSet(static_cast<long>(data0));
-      throttleAxis[1]->onEventThrottleSet(static_cast<long>(data0));
-      if (loggingThrottlesEnabled) {
-        std::cout << "WASM: THROTTLE_AXIS_SET_EX1: " << static_cast<long>(data0) << std::endl;
-      }
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::A32NX_THROTTLE_MAPPING_LOAD_FROM_LOCAL_VARIABLES>(const DWORD data0,
+                                                                                                          const DWORD data1) {
+  std::cout << "WASM: event triggered: THROTTLE_MAPPING_LOAD_FROM_LOCAL_VARIABLES" << std::endl;
+  throttleAxis[0]->loadFromLocalVariables();
+  throttleAxis[1]->loadFromLocalVariables();
+}
 
-    case Events::THROTTLE1_AXIS_SET_EX1: {
-      throttleAxis[0]->onEventThrottleSet(static_cast<long>(data0));
-      if (loggingThrottlesEnabled) {
-        std::cout << "WASM: THROTTLE1_AXIS_SET_EX1: " << static_cast<long>(data0) << std::endl;
-      }
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::A32NX_THROTTLE_MAPPING_SAVE_TO_FILE>(const DWORD data0, const DWORD data1) {
+  std::cout << "WASM: event triggered: THROTTLE_MAPPING_SAVE_TO_FILE" << std::endl;
+  throttleAxis[0]->saveToFile();
+  throttleAxis[1]->saveToFile();
+}
 
-    case Events::THROTTLE2_AXIS_SET_EX1: {
-      throttleAxis[1]->onEventThrottleSet(static_cast<long>(data0));
-      if (loggingThrottlesEnabled) {
-        std::cout << "WASM: THROTTLE2_AXIS_SET_EX1: " << static_cast<long>(data0) << std::endl;
-      }
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::THROTTLE_SET>(const DWORD data0, const DWORD data1) {
+  throttleAxis[0]->onEventThrottleSet(static_cast<long>(data0));
+  throttleAxis[1]->onEventThrottleSet(static_cast<long>(data0));
+  if (loggingThrottlesEnabled) {
+    std::cout << "WASM: THROTTLE_SET: " << static_cast<long>(data0) << std::endl;
+  }
+}
+
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::THROTTLE1_SET>(const DWORD data0, const DWORD data1) {
+  throttleAxis[0]->onEventThrottleSet(static_cast<long>(data0));
+  if (loggingThrottlesEnabled) {
+    std::cout << "WASM: THROTTLE1_SET: " << static_cast<long>(data0) << std::endl;
+  }
+}
+
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::THROTTLE2_SET>(const DWORD data0, const DWORD data1) {
+  throttleAxis[1]->onEventThrottleSet(static_cast<long>(data0));
+  if (loggingThrottlesEnabled) {
+    std::cout << "WASM: THROTTLE2_SET: " << static_cast<long>(data0) << std::endl;
+  }
+}
+
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::THROTTLE_AXIS_SET_EX1>(const DWORD data0, const DWORD data1) {
+  throttleAxis[0]->onEventThrottleSet(static_cast<long>(data0));
+  throttleAxis[1]->onEventThrottleSet(static_cast<long>(data0));
+  if (loggingThrottlesEnabled) {
+    std::cout << "WASM: THROTTLE_AXIS_SET_EX1: " << static_cast<long>(data0) << std::endl;
+  }
+}
+
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::THROTTLE1_AXIS_SET_EX1>(const DWORD data0, const DWORD data1) {
+  throttleAxis[0]->onEventThrottleSet(static_cast<long>(data0));
+  if (loggingThrottlesEnabled) {
+    std::cout << "WASM: THROTTLE1_AXIS_SET_EX1: " << static_cast<long>(data0) << std::endl;
+  }
+}
 
-    case Events::THROTTLE_FULL: {
-      throttleAxis[0]->onEventThrottleFull();
-      throttleAxis[1]->onEventThrottleFull();
-      if (loggingThrottlesEnabled) {
-        std::cout << "WASM: THROTTLE_FULL" << std::endl;
-      }
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::THROTTLE2_AXIS_SET_EX1>(const DWORD data0, const DWORD data1) {
+  throttleAxis[1]->onEventThrottleSet(static_cast<long>(data0));
+  if (loggingThrottlesEnabled) {
+    std::cout << "WASM: THROTTLE2_AXIS_SET_EX1: " << static_cast<long>(data0) << std::endl;
+  }
+}
 
-    case Events::THROTTLE_CUT: {
-      throttleAxis[0]->onEventThrottleCut();
-      throttleAxis[1]->onEventThrottleCut();
-      if (loggingThrottlesEnabled) {
-        std::cout << "WASM: THROTTLE_CUT" << std::endl;
-      }
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::THROTTLE_FULL>(const DWORD data0, const DWORD data1) {
+  throttleAxis[0]->onEventThrottleFull();
+  throttleAxis[1]->onEventThrottleFull();
+  if (loggingThrottlesEnabled) {
+    std::cout << "WASM: THROTTLE_FULL" << std::endl;
+  }
+}
 
-    case Events::THROTTLE_INCR: {
-      throttleAxis[0]->onEventThrottleIncrease();
-      throttleAxis[1]->onEventThrottleIncrease();
-      if (loggingThrottlesEnabled) {
-        std::cout << "WASM: THROTTLE_INCR" << std::endl;
-      }
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::THROTTLE_CUT>(const DWORD data0, const DWORD data1) {
+  throttleAxis[0]->onEventThrottleCut();
+  throttleAxis[1]->onEventThrottleCut();
+  if (loggingThrottlesEnabled) {
+    std::cout << "WASM: THROTTLE_CUT" << std::endl;
+  }
+}
 
-    case Events::THROTTLE_DECR: {
-      throttleAxis[0]->onEventThrottleDecrease();
-      throttleAxis[1]->onEventThrottleDecrease();
-      if (loggingThrottlesEnabled) {
-        std::cout << "WASM: THROTTLE_DECR" << std::endl;
-      }
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::THROTTLE_INCR>(const DWORD data0, const DWORD data1) {
+  throttleAxis[0]->onEventThrottleIncrease();
+  throttleAxis[1]->onEventThrottleIncrease();
+  if (loggingThrottlesEnabled) {
+    std::cout << "WASM: THROTTLE_INCR" << std::endl;
+  }
+}
 
-    case Events::THROTTLE_INCR_SMALL: {
-      throttleAxis[0]->onEventThrottleIncreaseSmall();
-      throttleAxis[1]->onEventThrottleIncreaseSmall();
-      if (loggingThrottlesEnabled) {
-        std::cout << "WASM: THROTTLE_INCR_SMALL" << std::endl;
-      }
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::THROTTLE_DECR>(const DWORD data0, const DWORD data1) {
+  throttleAxis[0]->onEventThrottleDecrease();
+  throttleAxis[1]->onEventThrottleDecrease();
+  if (loggingThrottlesEnabled) {
+    std::cout << "WASM: THROTTLE_DECR" << std::endl;
+  }
+}
 
-    case Events::THROTTLE_DECR_SMALL: {
-      throttleAxis[0]->onEventThrottleDecreaseSmall();
-      throttleAxis[1]->onEventThrottleDecreaseSmall();
-      if (loggingThrottlesEnabled) {
-        std::cout << "WASM: THROTTLE_DECR_SMALL" << std::endl;
-      }
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::THROTTLE_INCR_SMALL>(const DWORD data0, const DWORD data1) {
+  throttleAxis[0]->onEventThrottleIncreaseSmall();
+  throttleAxis[1]->onEventThrottleIncreaseSmall();
+  if (loggingThrottlesEnabled) {
+    std::cout << "WASM: THROTTLE_INCR_SMALL" << std::endl;
+  }
+}
 
-    case Events::THROTTLE_10: {
-      throttleAxis[0]->onEventThrottleSet_10();
-      throttleAxis[1]->onEventThrottleSet_10();
-      if (loggingThrottlesEnabled) {
-        std::cout << "WASM: THROTTLE_10" << std::endl;
-      }
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::THROTTLE_DECR_SMALL>(const DWORD data0, const DWORD data1) {
+  throttleAxis[0]->onEventThrottleDecreaseSmall();
+  throttleAxis[1]->onEventThrottleDecreaseSmall();
+  if (loggingThrottlesEnabled) {
+    std::cout << "WASM: THROTTLE_DECR_SMALL" << std::endl;
+  }
+}
 
-    case Events::THROTTLE_20: {
-      throttleAxis[0]->onEventThrottleSet_20();
-      throttleAxis[1]->onEventThrottleSet_20();
-      if (loggingThrottlesEnabled) {
-        std::cout << "WASM: THROTTLE_20" << std::endl;
-      }
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::THROTTLE_10>(const DWORD data0, const DWORD data1) {
+  throttleAxis[0]->onEventThrottleSet_10();
+  throttleAxis[1]->onEventThrottleSet_10();
+  if (loggingThrottlesEnabled) {
+    std::cout << "WASM: THROTTLE_10" << std::endl;
+  }
+}
 
-    case Events::THROTTLE_30: {
-      throttleAxis[0]->onEventThrottleSet_30();
-      throttleAxis[1]->onEventThrottleSet_30();
-      if (loggingThrottlesEnabled) {
-        std::cout << "WASM: THROTTLE_30" << std::endl;
-      }
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::THROTTLE_20>(const DWORD data0, const DWORD data1) {
+  throttleAxis[0]->onEventThrottleSet_20();
+  throttleAxis[1]->onEventThrottleSet_20();
+  if (loggingThrottlesEnabled) {
+    std::cout << "WASM: THROTTLE_20" << std::endl;
+  }
+}
 
-    case Events::THROTTLE_40: {
-      throttleAxis[0]->onEventThrottleSet_40();
-      throttleAxis[1]->onEventThrottleSet_40();
-      if (loggingThrottlesEnabled) {
-        std::cout << "WASM: THROTTLE_40" << std::endl;
-      }
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::THROTTLE_30>(const DWORD data0, const DWORD data1) {
+  throttleAxis[0]->onEventThrottleSet_30();
+  throttleAxis[1]->onEventThrottleSet_30();
+  if (loggingThrottlesEnabled) {
+    std::cout << "WASM: THROTTLE_30" << std::endl;
+  }
+}
 
-    case Events::THROTTLE_50: {
-      throttleAxis[0]->onEventThrottleSet_50();
-      throttleAxis[1]->onEventThrottleSet_50();
-      if (loggingThrottlesEnabled) {
-        std::cout << "WASM: THROTTLE_50" << std::endl;
-      }
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::THROTTLE_40>(const DWORD data0, const DWORD data1) {
+  throttleAxis[0]->onEventThrottleSet_40();
+  throttleAxis[1]->onEventThrottleSet_40();
+  if (loggingThrottlesEnabled) {
+    std::cout << "WASM: THROTTLE_40" << std::endl;
+  }
+}
 
-    case Events::THROTTLE_60: {
-      throttleAxis[0]->onEventThrottleSet_60();
-      throttleAxis[1]->onEventThrottleSet_60();
-      if (loggingThrottlesEnabled) {
-        std::cout << "WASM: THROTTLE_60" << std::endl;
-      }
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::THROTTLE_50>(const DWORD data0, const DWORD data1) {
+  throttleAxis[0]->onEventThrottleSet_50();
+  throttleAxis[1]->onEventThrottleSet_50();
+  if (loggingThrottlesEnabled) {
+    std::cout << "WASM: THROTTLE_50" << std::endl;
+  }
+}
 
-    case Events::THROTTLE_70: {
-      throttleAxis[0]->onEventThrottleSet_70();
-      throttleAxis[1]->onEventThrottleSet_70();
-      if (loggingThrottlesEnabled) {
-        std::cout << "WASM: THROTTLE_70" << std::endl;
-      }
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::THROTTLE_60>(const DWORD data0, const DWORD data1) {
+  throttleAxis[0]->onEventThrottleSet_60();
+  throttleAxis[1]->onEventThrottleSet_60();
+  if (loggingThrottlesEnabled) {
+    std::cout << "WASM: THROTTLE_60" << std::endl;
+  }
+}
 
-    case Events::THROTTLE_80: {
-      throttleAxis[0]->onEventThrottleSet_80();
-      throttleAxis[1]->onEventThrottleSet_80();
-      if (loggingThrottlesEnabled) {
-        std::cout << "WASM: THROTTLE_80" << std::endl;
-      }
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::THROTTLE_70>(const DWORD data0, const DWORD data1) {
+  throttleAxis[0]->onEventThrottleSet_70();
+  throttleAxis[1]->onEventThrottleSet_70();
+  if (loggingThrottlesEnabled) {
+    std::cout << "WASM: THROTTLE_70" << std::endl;
+  }
+}
 
-    case Events::THROTTLE_90: {
-      throttleAxis[0]->onEventThrottleSet_90();
-      throttleAxis[1]->onEventThrottleSet_90();
-      if (loggingThrottlesEnabled) {
-        std::cout << "WASM: THROTTLE_90" << std::endl;
-      }
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::THROTTLE_80>(const DWORD data0, const DWORD data1) {
+  throttleAxis[0]->onEventThrottleSet_80();
+  throttleAxis[1]->onEventThrottleSet_80();
+  if (loggingThrottlesEnabled) {
+    std::cout << "WASM: THROTTLE_80" << std::endl;
+  }
+}
 
-    case Events::THROTTLE1_FULL: {
-      throttleAxis[0]->onEventThrottleFull();
-      if (loggingThrottlesEnabled) {
-        std::cout << "WASM: THROTTLE1_FULL" << std::endl;
-      }
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::THROTTLE_90>(const DWORD data0, const DWORD data1) {
+  throttleAxis[0]->onEventThrottleSet_90();
+  throttleAxis[1]->onEventThrottleSet_90();
+  if (loggingThrottlesEnabled) {
+    std::cout << "WASM: THROTTLE_90" << std::endl;
+  }
+}
 
-    case Events::THROTTLE1_CUT: {
-      throttleAxis[0]->onEventThrottleCut();
-      if (loggingThrottlesEnabled) {
-        std::cout << "WASM: THROTTLE1_CUT" << std::endl;
-      }
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::THROTTLE1_FULL>(const DWORD data0, const DWORD data1) {
+  throttleAxis[0]->onEventThrottleFull();
+  if (loggingThrottlesEnabled) {
+    std::cout << "WASM: THROTTLE1_FULL" << std::endl;
+  }
+}
 
-    case Events::THROTTLE1_INCR: {
-      throttleAxis[0]->onEventThrottleIncrease();
-      if (loggingThrottlesEnabled) {
-        std::cout << "WASM: THROTTLE1_INCR" << std::endl;
-      }
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::THROTTLE1_CUT>(const DWORD data0, const DWORD data1) {
+  throttleAxis[0]->onEventThrottleCut();
+  if (loggingThrottlesEnabled) {
+    std::cout << "WASM: THROTTLE1_CUT" << std::endl;
+  }
+}
 
-    case Events::THROTTLE1_DECR: {
-      throttleAxis[0]->onEventThrottleDecrease();
-      if (loggingThrottlesEnabled) {
-        std::cout << "WASM: THROTTLE1_DECR" << std::endl;
-      }
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::THROTTLE1_INCR>(const DWORD data0, const DWORD data1) {
+  throttleAxis[0]->onEventThrottleIncrease();
+  if (loggingThrottlesEnabled) {
+    std::cout << "WASM: THROTTLE1_INCR" << std::endl;
+  }
+}
 
-    case Events::THROTTLE1_INCR_SMALL: {
-      throttleAxis[0]->onEventThrottleIncreaseSmall();
-      if (loggingThrottlesEnabled) {
-        std::cout << "WASM: THROTTLE1_INCR_SMALL" << std::endl;
-      }
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::THROTTLE1_DECR>(const DWORD data0, const DWORD data1) {
+  throttleAxis[0]->onEventThrottleDecrease();
+  if (loggingThrottlesEnabled) {
+    std::cout << "WASM: THROTTLE1_DECR" << std::endl;
+  }
+}
 
-    case Events::THROTTLE1_DECR_SMALL: {
-      throttleAxis[0]->onEventThrottleDecreaseSmall();
-      if (loggingThrottlesEnabled) {
-        std::cout << "WASM: THROTTLE1_DECR_SMALL" << std::endl;
-      }
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::THROTTLE1_INCR_SMALL>(const DWORD data0, const DWORD data1) {
+  throttleAxis[0]->onEventThrottleIncreaseSmall();
+  if (loggingThrottlesEnabled) {
+    std::cout << "WASM: THROTTLE1_INCR_SMALL" << std::endl;
+  }
+}
 
-    case Events::THROTTLE2_FULL: {
-      throttleAxis[1]->onEventThrottleFull();
-      if (loggingThrottlesEnabled) {
-        std::cout << "WASM: THROTTLE2_FULL" << std::endl;
-      }
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::THROTTLE1_DECR_SMALL>(const DWORD data0, const DWORD data1) {
+  throttleAxis[0]->onEventThrottleDecreaseSmall();
+  if (loggingThrottlesEnabled) {
+    std::cout << "WASM: THROTTLE1_DECR_SMALL" << std::endl;
+  }
+}
 
-    case Events::THROTTLE2_CUT: {
-      throttleAxis[1]->onEventThrottleCut();
-      if (loggingThrottlesEnabled) {
-        std::cout << "WASM: THROTTLE2_CUT" << std::endl;
-      }
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::THROTTLE2_FULL>(const DWORD data0, const DWORD data1) {
+  throttleAxis[1]->onEventThrottleFull();
+  if (loggingThrottlesEnabled) {
+    std::cout << "WASM: THROTTLE2_FULL" << std::endl;
+  }
+}
 
-    case Events::THROTTLE2_INCR: {
-      throttleAxis[1]->onEventThrottleIncrease();
-      if (loggingThrottlesEnabled) {
-        std::cout << "WASM: THROTTLE2_INCR" << std::endl;
-      }
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::THROTTLE2_CUT>(const DWORD data0, const DWORD data1) {
+  throttleAxis[1]->onEventThrottleCut();
+  if (loggingThrottlesEnabled) {
+    std::cout << "WASM: THROTTLE2_CUT" << std::endl;
+  }
+}
 
-    case Events::THROTTLE2_DECR: {
-      throttleAxis[1]->onEventThrottleDecrease();
-      if (loggingThrottlesEnabled) {
-        std::cout << "WASM: THROTTLE2_DECR" << std::endl;
-      }
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::THROTTLE2_INCR>(const DWORD data0, const DWORD data1) {
+  throttleAxis[1]->onEventThrottleIncrease();
+  if (loggingThrottlesEnabled) {
+    std::cout << "WASM: THROTTLE2_INCR" << std::endl;
+  }
+}
 
-    case Events::THROTTLE2_INCR_SMALL: {
-      throttleAxis[1]->onEventThrottleIncreaseSmall();
-      if (loggingThrottlesEnabled) {
-        std::cout << "WASM: THROTTLE2_INCR_SMALL" << std::endl;
-      }
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::THROTTLE2_DECR>(const DWORD data0, const DWORD data1) {
+  throttleAxis[1]->onEventThrottleDecrease();
+  if (loggingThrottlesEnabled) {
+    std::cout << "WASM: THROTTLE2_DECR" << std::endl;
+  }
+}
 
-    case Events::THROTTLE2_DECR_SMALL: {
-      throttleAxis[1]->onEventThrottleDecreaseSmall();
-      if (loggingThrottlesEnabled) {
-        std::cout << "WASM: THROTTLE2_DECR_SMALL" << std::endl;
-      }
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::THROTTLE2_INCR_SMALL>(const DWORD data0, const DWORD data1) {
+  throttleAxis[1]->onEventThrottleIncreaseSmall();
+  if (loggingThrottlesEnabled) {
+    std::cout << "WASM: THROTTLE2_INCR_SMALL" << std::endl;
+  }
+}
 
-    case Events::THROTTLE_REVERSE_THRUST_TOGGLE: {
-      throttleAxis[0]->onEventReverseToggle();
-      throttleAxis[1]->onEventReverseToggle();
-      if (loggingThrottlesEnabled) {
-        std::cout << "WASM: THROTTLE_REVERSE_THRUST_TOGGLE" << std::endl;
-      }
-      break;
-    }
-    case Events::THROTTLE_REVERSE_THRUST_HOLD: {
-      throttleAxis[0]->onEventReverseHold(static_cast<bool>(data0));
-      throttleAxis[1]->onEventReverseHold(static_cast<bool>(data0));
-      if (loggingThrottlesEnabled) {
-        std::cout << "WASM: THROTTLE_REVERSE_THRUST_HOLD: " << static_cast<long>(data0) << std::endl;
-      }
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::THROTTLE2_DECR_SMALL>(const DWORD data0, const DWORD data1) {
+  throttleAxis[1]->onEventThrottleDecreaseSmall();
+  if (loggingThrottlesEnabled) {
+    std::cout << "WASM: THROTTLE2_DECR_SMALL" << std::endl;
+  }
+}
 
-    case Events::SPOILERS_ON: {
-      spoilersHandler->onEventSpoilersOn();
-      if (loggingFlightControlsEnabled) {
-        std::cout << "WASM: SPOILERS_ON: ";
-        std::cout << "(no data)";
-        std::cout << " -> ";
-        std::cout << spoilersHandler->getHandlePosition();
-        std::cout << " / ";
-        std::cout << spoilersHandler->getIsArmed();
-        std::cout << std::endl;
-      }
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::THROTTLE_REVERSE_THRUST_TOGGLE>(const DWORD data0, const DWORD data1) {
+  throttleAxis[0]->onEventReverseToggle();
+  throttleAxis[1]->onEventReverseToggle();
+  if (loggingThrottlesEnabled) {
+    std::cout << "WASM: THROTTLE_REVERSE_THRUST_TOGGLE" << std::endl;
+  }
+}
 
-    case Events::SPOILERS_OFF: {
-      spoilersHandler->onEventSpoilersOff();
-      if (loggingFlightControlsEnabled) {
-        std::cout << "WASM: SPOILERS_OFF: ";
-        std::cout << "(no data)";
-        std::cout << " -> ";
-        std::cout << spoilersHandler->getHandlePosition();
-        std::cout << " / ";
-        std::cout << spoilersHandler->getIsArmed();
-        std::cout << std::endl;
-      }
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::THROTTLE_REVERSE_THRUST_HOLD>(const DWORD data0, const DWORD data1) {
+  throttleAxis[0]->onEventReverseHold(static_cast<bool>(data0));
+  throttleAxis[1]->onEventReverseHold(static_cast<bool>(data0));
+  if (loggingThrottlesEnabled) {
+    std::cout << "WASM: THROTTLE_REVERSE_THRUST_HOLD: " << static_cast<long>(data0) << std::endl;
+  }
+}
 
-    case Events::SPOILERS_TOGGLE: {
-      spoilersHandler->onEventSpoilersToggle();
-      if (loggingFlightControlsEnabled) {
-        std::cout << "WASM: SPOILERS_TOGGLE: ";
-        std::cout << "(no data)";
-        std::cout << " -> ";
-        std::cout << spoilersHandler->getHandlePosition();
-        std::cout << " / ";
-        std::cout << spoilersHandler->getIsArmed();
-        std::cout << std::endl;
-      }
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::SPOILERS_ON>(const DWORD data0, const DWORD data1) {
+  spoilersHandler->onEventSpoilersOn();
+  if (loggingFlightControlsEnabled) {
+    std::cout << "WASM: SPOILERS_ON: ";
+    std::cout << "(no data)";
+    std::cout << " -> ";
+    std::cout << spoilersHandler->getHandlePosition();
+    std::cout << " / ";
+    std::cout << spoilersHandler->getIsArmed();
+    std::cout << std::endl;
+  }
+}
 
-    case Events::SPOILERS_SET: {
-      spoilersHandler->onEventSpoilersSet(static_cast<long>(data0));
-      if (loggingFlightControlsEnabled) {
-        std::cout << "WASM: SPOILERS_SET: ";
-        std::cout << static_cast<long>(data0);
-        std::cout << " -> ";
-        std::cout << spoilersHandler->getHandlePosition();
-        std::cout << " / ";
-        std::cout << spoilersHandler->getIsArmed();
-        std::cout << std::endl;
-      }
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::SPOILERS_OFF>(const DWORD data0, const DWORD data1) {
+  spoilersHandler->onEventSpoilersOff();
+  if (loggingFlightControlsEnabled) {
+    std::cout << "WASM: SPOILERS_OFF: ";
+    std::cout << "(no data)";
+    std::cout << " -> ";
+    std::cout << spoilersHandler->getHandlePosition();
+    std::cout << " / ";
+    std::cout << spoilersHandler->getIsArmed();
+    std::cout << std::endl;
+  }
+}
 
-    case Events::AXIS_SPOILER_SET: {
-      spoilersHandler->onEventSpoilersAxisSet(static_cast<long>(data0));
-      if (loggingFlightControlsEnabled) {
-        std::cout << "WASM: AXIS_SPOILER_SET: ";
-        std::cout << static_cast<long>(data0);
-        std::cout << " -> ";
-        std::cout << spoilersHandler->getHandlePosition();
-        std::cout << " / ";
-        std::cout << spoilersHandler->getIsArmed();
-        std::cout << std::endl;
-      }
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::SPOILERS_TOGGLE>(const DWORD data0, const DWORD data1) {
+  spoilersHandler->onEventSpoilersToggle();
+  if (loggingFlightControlsEnabled) {
+    std::cout << "WASM: SPOILERS_TOGGLE: ";
+    std::cout << "(no data)";
+    std::cout << " -> ";
+    std::cout << spoilersHandler->getHandlePosition();
+    std::cout << " / ";
+    std::cout << spoilersHandler->getIsArmed();
+    std::cout << std::endl;
+  }
+}
 
-    case Events::SPOILERS_ARM_ON: {
-      spoilersHandler->onEventSpoilersArmOn();
-      if (loggingFlightControlsEnabled) {
-        std::cout << "WASM: SPOILERS_ARM_ON: ";
-        std::cout << "(no data)";
-        std::cout << " -> ";
-        std::cout << spoilersHandler->getHandlePosition();
-        std::cout << " / ";
-        std::cout << spoilersHandler->getIsArmed();
-        std::cout << std::endl;
-      }
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::SPOILERS_SET>(const DWORD data0, const DWORD data1) {
+  spoilersHandler->onEventSpoilersSet(static_cast<long>(data0));
+  if (loggingFlightControlsEnabled) {
+    std::cout << "WASM: SPOILERS_SET: ";
+    std::cout << static_cast<long>(data0);
+    std::cout << " -> ";
+    std::cout << spoilersHandler->getHandlePosition();
+    std::cout << " / ";
+    std::cout << spoilersHandler->getIsArmed();
+    std::cout << std::endl;
+  }
+}
 
-    case Events::SPOILERS_ARM_OFF: {
-      spoilersHandler->onEventSpoilersArmOff();
-      if (loggingFlightControlsEnabled) {
-        std::cout << "WASM: SPOILERS_ARM_OFF: ";
-        std::cout << "(no data)";
-        std::cout << " -> ";
-        std::cout << spoilersHandler->getHandlePosition();
-        std::cout << " / ";
-        std::cout << spoilersHandler->getIsArmed();
-        std::cout << std::endl;
-      }
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::AXIS_SPOILER_SET>(const DWORD data0, const DWORD data1) {
+  spoilersHandler->onEventSpoilersAxisSet(static_cast<long>(data0));
+  if (loggingFlightControlsEnabled) {
+    std::cout << "WASM: AXIS_SPOILER_SET: ";
+    std::cout << static_cast<long>(data0);
+    std::cout << " -> ";
+    std::cout << spoilersHandler->getHandlePosition();
+    std::cout << " / ";
+    std::cout << spoilersHandler->getIsArmed();
+    std::cout << std::endl;
+  }
+}
 
-    case Events::SPOILERS_ARM_TOGGLE: {
-      spoilersHandler->onEventSpoilersArmToggle();
-      if (loggingFlightControlsEnabled) {
-        std::cout << "WASM: SPOILERS_ARM_TOGGLE: ";
-        std::cout << "(no data)";
-        std::cout << " -> ";
-        std::cout << spoilersHandler->getHandlePosition();
-        std::cout << " / ";
-        std::cout << spoilersHandler->getIsArmed();
-        std::cout << std::endl;
-      }
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::SPOILERS_ARM_ON>(const DWORD data0, const DWORD data1) {
+  spoilersHandler->onEventSpoilersArmOn();
+  if (loggingFlightControlsEnabled) {
+    std::cout << "WASM: SPOILERS_ARM_ON: ";
+    std::cout << "(no data)";
+    std::cout << " -> ";
+    std::cout << spoilersHandler->getHandlePosition();
+    std::cout << " / ";
+    std::cout << spoilersHandler->getIsArmed();
+    std::cout << std::endl;
+  }
+}
 
-    case Events::SPOILERS_ARM_SET: {
-      spoilersHandler->onEventSpoilersArmSet(static_cast<long>(data0) == 1);
-      if (loggingFlightControlsEnabled) {
-        std::cout << "WASM: SPOILERS_ARM_SET: ";
-        std::cout << static_cast<long>(data0);
-        std::cout << " -> ";
-        std::cout << spoilersHandler->getHandlePosition();
-        std::cout << " / ";
-        std::cout << spoilersHandler->getIsArmed();
-        std::cout << std::endl;
-      }
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::SPOILERS_ARM_OFF>(const DWORD data0, const DWORD data1) {
+  spoilersHandler->onEventSpoilersArmOff();
+  if (loggingFlightControlsEnabled) {
+    std::cout << "WASM: SPOILERS_ARM_OFF: ";
+    std::cout << "(no data)";
+    std::cout << " -> ";
+    std::cout << spoilersHandler->getHandlePosition();
+    std::cout << " / ";
+    std::cout << spoilersHandler->getIsArmed();
+    std::cout << std::endl;
+  }
+}
 
-    case Events::SIM_RATE_INCR: {
-      // calculate frame rate that will be seen by FBW / AP
-      double theoreticalFrameRate = (1 / sampleTime) / (simData.simulation_rate * 2);
-      // determine if an increase of simulation rate can be allowed
-      if ((simData.simulation_rate < maxSimulationRate && theoreticalFrameRate >= 5) || simData.simulation_rate < 1 ||
-          !limitSimulationRateByPerformance) {
-        sendEvent(SIM_RATE_INCR, 0, SIMCONNECT_GROUP_PRIORITY_DEFAULT);
-        std::cout << "WASM: Simulation rate " << simData.simulation_rate;
-        std::cout << " -> " << simData.simulation_rate * 2;
-        std::cout << " (theoretical fps " << theoreticalFrameRate << ")" << std::endl;
-      } else {
-        std::cout << "WASM: Simulation rate " << simData.simulation_rate;
-        std::cout << " -> " << simData.simulation_rate;
-        std::cout << " (limited by max sim rate or theoretical fps " << theoreticalFrameRate << ")" << std::endl;
-      }
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::SPOILERS_ARM_TOGGLE>(const DWORD data0, const DWORD data1) {
+  spoilersHandler->onEventSpoilersArmToggle();
+  if (loggingFlightControlsEnabled) {
+    std::cout << "WASM: SPOILERS_ARM_TOGGLE: ";
+    std::cout << "(no data)";
+    std::cout << " -> ";
+    std::cout << spoilersHandler->getHandlePosition();
+    std::cout << " / ";
+    std::cout << spoilersHandler->getIsArmed();
+    std::cout << std::endl;
+  }
+}
 
-    case Events::SIM_RATE_DECR: {
-      if (simData.simulation_rate > minSimulationRate) {
-        sendEvent(SIM_RATE_DECR, 0, SIMCONNECT_GROUP_PRIORITY_DEFAULT);
-        std::cout << "WASM: Simulation rate " << simData.simulation_rate;
-        std::cout << " -> " << simData.simulation_rate / 2;
-        std::cout << std::endl;
-      } else {
-        std::cout << "WASM: Simulation rate " << simData.simulation_rate;
-        std::cout << " -> " << simData.simulation_rate;
-        std::cout << " (limited by min sim rate)" << std::endl;
-      }
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::SPOILERS_ARM_SET>(const DWORD data0, const DWORD data1) {
+  spoilersHandler->onEventSpoilersArmSet(static_cast<long>(data0) == 1);
+  if (loggingFlightControlsEnabled) {
+    std::cout << "WASM: SPOILERS_ARM_SET: ";
+    std::cout << static_cast<long>(data0);
+    std::cout << " -> ";
+    std::cout << spoilersHandler->getHandlePosition();
+    std::cout << " / ";
+    std::cout << spoilersHandler->getIsArmed();
+    std::cout << std::endl;
+  }
+}
 
-    case Events::SIM_RATE_SET: {
-      long targetSimulationRate = std::min(static_cast<long>(maxSimulationRate), std::max(1l, static_cast<long>(data0)));
-      sendEvent(SIM_RATE_SET, targetSimulationRate, SIMCONNECT_GROUP_PRIORITY_DEFAULT);
-      std::cout << "WASM: Simulation Rate set to " << targetSimulationRate << std::endl;
-      break;
-    }
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::SIM_RATE_INCR>(const DWORD data0, const DWORD data1) {
+  // calculate frame rate that will be seen by FBW / AP
+  double theoreticalFrameRate = (1 / sampleTime) / (simData.simulation_rate * 2);
+  // determine if an increase of simulation rate can be allowed
+  if ((simData.simulation_rate < maxSimulationRate && theoreticalFrameRate >= 5) || simData.simulation_rate < 1 ||
+      !limitSimulationRateByPerformance) {
+    sendEvent(SIM_RATE_INCR, 0, SIMCONNECT_GROUP_PRIORITY_DEFAULT);
+    std::cout << "WASM: Simulation rate " << simData.simulation_rate;
+    std::cout << " -> " << simData.simulation_rate * 2;
+    std::cout << " (theoretical fps " << theoreticalFrameRate << ")" << std::endl;
+  } else {
+    std::cout << "WASM: Simulation rate " << simData.simulation_rate;
+    std::cout << " -> " << simData.simulation_rate;
+    std::cout << " (limited by max sim rate or theoretical fps " << theoreticalFrameRate << ")" << std::endl;
+  }
+}
 
-    default:
-      break;
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::SIM_RATE_DECR>(const DWORD data0, const DWORD data1) {
+  if (simData.simulation_rate > minSimulationRate) {
+    sendEvent(SIM_RATE_DECR, 0, SIMCONNECT_GROUP_PRIORITY_DEFAULT);
+    std::cout << "WASM: Simulation rate " << simData.simulation_rate;
+    std::cout << " -> " << simData.simulation_rate / 2;
+    std::cout << std::endl;
+  } else {
+    std::cout << "WASM: Simulation rate " << simData.simulation_rate;
+    std::cout << " -> " << simData.simulation_rate;
+    std::cout << " (limited by min sim rate)" << std::endl;
   }
 }
 
+template <>
+void SimConnectInterface::handleEvent<SimConnectInterface::SIM_RATE_SET>(const DWORD data0, const DWORD data1) {
+  long targetSimulationRate = std::min(static_cast<long>(maxSimulationRate), std::max(1l, static_cast<long>(data0)));
+  sendEvent(SIM_RATE_SET, targetSimulationRate, SIMCONNECT_GROUP_PRIORITY_DEFAULT);
+  std::cout << "WASM: Simulation Rate set to " << targetSimulationRate << std::endl;
+}
+
+void SimConnectInterface::registerEventHandlers() {
+  eventHandlers.fill(nullptr);
+  coalescedEvents.fill(false);
+
+  eventHandlers[SYSTEM_EVENT_PAUSE] = &SimConnectInterface::handleEvent<SYSTEM_EVENT_PAUSE>;
+  eventHandlers[AXIS_ELEVATOR_SET] = &SimConnectInterface::handleEvent<AXIS_ELEVATOR_SET>;
+  eventHandlers[AXIS_AILERONS_SET] = &SimConnectInterface::handleEvent<AXIS_AILERONS_SET>;
+  eventHandlers[AXIS_RUDDER_SET] = &SimConnectInterface::handleEvent<AXIS_RUDDER_SET>;
+  eventHandlers[RUDDER_SET] = &SimConnectInterface::handleEvent<RUDDER_SET>;
+  eventHandlers[RUDDER_LEFT] = &SimConnectInterface::handleEvent<RUDDER_LEFT>;
+  eventHandlers[RUDDER_CENTER] = &SimConnectInterface::handleEvent<RUDDER_CENTER>;
+  eventHandlers[RUDDER_RIGHT] = &SimConnectInterface::handleEvent<RUDDER_RIGHT>;
+  eventHandlers[RUDDER_AXIS_MINUS] = &SimConnectInterface::handleEvent<RUDDER_AXIS_MINUS>;
+  eventHandlers[RUDDER_AXIS_PLUS] = &SimConnectInterface::handleEvent<RUDDER_AXIS_PLUS>;
+  eventHandlers[RUDDER_TRIM_LEFT] = &SimConnectInterface::handleEvent<RUDDER_TRIM_LEFT>;
+  eventHandlers[RUDDER_TRIM_RESET] = &SimConnectInterface::handleEvent<RUDDER_TRIM_RESET>;
+  eventHandlers[RUDDER_TRIM_RIGHT] = &SimConnectInterface::handleEvent<RUDDER_TRIM_RIGHT>;
+  eventHandlers[RUDDER_TRIM_SET] = &SimConnectInterface::handleEvent<RUDDER_TRIM_SET>;
+  eventHandlers[RUDDER_TRIM_SET_EX1] = &SimConnectInterface::handleEvent<RUDDER_TRIM_SET_EX1>;
+  eventHandlers[AILERON_SET] = &SimConnectInterface::handleEvent<AILERON_SET>;
+  eventHandlers[AILERONS_LEFT] = &SimConnectInterface::handleEvent<AILERONS_LEFT>;
+  eventHandlers[AILERONS_RIGHT] = &SimConnectInterface::handleEvent<AILERONS_RIGHT>;
+  eventHandlers[CENTER_AILER_RUDDER] = &SimConnectInterface::handleEvent<CENTER_AILER_RUDDER>;
+  eventHandlers[ELEVATOR_SET] = &SimConnectInterface::handleEvent<ELEVATOR_SET>;
+  eventHandlers[ELEV_DOWN] = &SimConnectInterface::handleEvent<ELEV_DOWN>;
+  eventHandlers[ELEV_UP] = &SimConnectInterface::handleEvent<ELEV_UP>;
+  eventHandlers[AUTOPILOT_OFF] = &SimConnectInterface::handleEvent<AUTOPILOT_OFF>;
+  eventHandlers[AUTOPILOT_ON] = &SimConnectInterface::handleEvent<AUTOPILOT_ON>;
+  eventHandlers[AP_MASTER] = &SimConnectInterface::handleEvent<AP_MASTER>;
+  eventHandlers[AUTOPILOT_DISENGAGE_SET] = &SimConnectInterface::handleEvent<AUTOPILOT_DISENGAGE_SET>;
+  eventHandlers[AUTOPILOT_DISENGAGE_TOGGLE] = &SimConnectInterface::handleEvent<AUTOPILOT_DISENGAGE_TOGGLE>;
+  eventHandlers[TOGGLE_FLIGHT_DIRECTOR] = &SimConnectInterface::handleEvent<TOGGLE_FLIGHT_DIRECTOR>;
+  eventHandlers[A32NX_FCU_AP_1_PUSH] = &SimConnectInterface::handleEvent<A32NX_FCU_AP_1_PUSH>;
+  eventHandlers[A32NX_FCU_AP_2_PUSH] = &SimConnectInterface::handleEvent<A32NX_FCU_AP_2_PUSH>;
+  eventHandlers[A32NX_FCU_AP_DISCONNECT_PUSH] = &SimConnectInterface::handleEvent<A32NX_FCU_AP_DISCONNECT_PUSH>;
+  eventHandlers[A32NX_FCU_ATHR_PUSH] = &SimConnectInterface::handleEvent<A32NX_FCU_ATHR_PUSH>;
+  eventHandlers[A32NX_FCU_ATHR_DISCONNECT_PUSH] = &SimConnectInterface::handleEvent<A32NX_FCU_ATHR_DISCONNECT_PUSH>;
+  eventHandlers[A32NX_FCU_SPD_INC] = &SimConnectInterface::handleEvent<A32NX_FCU_SPD_INC>;
+  eventHandlers[A32NX_FCU_SPD_DEC] = &SimConnectInterface::handleEvent<A32NX_FCU_SPD_DEC>;
+  eventHandlers[A32NX_FCU_SPD_SET] = &SimConnectInterface::handleEvent<A32NX_FCU_SPD_SET>;
+  eventHandlers[A32NX_FCU_SPD_PUSH] = &SimConnectInterface::handleEvent<A32NX_FCU_SPD_PUSH>;
+  eventHandlers[AP_AIRSPEED_ON] = &SimConnectInterface::handleEvent<A32NX_FCU_SPD_PUSH>;
+  eventHandlers[A32NX_FCU_SPD_PULL] = &SimConnectInterface::handleEvent<A32NX_FCU_SPD_PULL>;
+  eventHandlers[AP_AIRSPEED_OFF] = &SimConnectInterface::handleEvent<A32NX_FCU_SPD_PULL>;
+  eventHandlers[A32NX_FCU_SPD_MACH_TOGGLE_PUSH] = &SimConnectInterface::handleEvent<A32NX_FCU_SPD_MACH_TOGGLE_PUSH>;
+  eventHandlers[AP_MACH_HOLD] = &SimConnectInterface::handleEvent<A32NX_FCU_SPD_MACH_TOGGLE_PUSH>;
+  eventHandlers[A32NX_FCU_HDG_INC] = &SimConnectInterface::handleEvent<A32NX_FCU_HDG_INC>;
+  eventHandlers[A32NX_FCU_HDG_DEC] = &SimConnectInterface::handleEvent<A32NX_FCU_HDG_DEC>;
+  eventHandlers[A32NX_FCU_HDG_SET] = &SimConnectInterface::handleEvent<A32NX_FCU_HDG_SET>;
+  eventHandlers[A32NX_FCU_HDG_PUSH] = &SimConnectInterface::handleEvent<A32NX_FCU_HDG_PUSH>;
+  eventHandlers[AP_HDG_HOLD_ON] = &SimConnectInterface::handleEvent<A32NX_FCU_HDG_PUSH>;
+  eventHandlers[A32NX_FCU_HDG_PULL] = &SimConnectInterface::handleEvent<A32NX_FCU_HDG_PULL>;
+  eventHandlers[AP_HDG_HOLD_OFF] = &SimConnectInterface::handleEvent<A32NX_FCU_HDG_PULL>;
+  eventHandlers[A32NX_FCU_TRK_FPA_TOGGLE_PUSH] = &SimConnectInterface::handleEvent<A32NX_FCU_TRK_FPA_TOGGLE_PUSH>;
+  eventHandlers[AP_VS_HOLD] = &SimConnectInterface::handleEvent<A32NX_FCU_TRK_FPA_TOGGLE_PUSH>;
+  eventHandlers[A32NX_FCU_ALT_INC] = &SimConnectInterface::handleEvent<A32NX_FCU_ALT_INC>;
+  eventHandlers[A32NX_FCU_ALT_DEC] = &SimConnectInterface::handleEvent<A32NX_FCU_ALT_DEC>;
+  eventHandlers[A32NX_FCU_ALT_SET] = &SimConnectInterface::handleEvent<A32NX_FCU_ALT_SET>;
+  eventHandlers[A32NX_FCU_ALT_INCREMENT_TOGGLE] = &SimConnectInterface::handleEvent<A32NX_FCU_ALT_INCREMENT_TOGGLE>;
+  eventHandlers[A32NX_FCU_ALT_INCREMENT_SET] = &SimConnectInterface::handleEvent<A32NX_FCU_ALT_INCREMENT_SET>;
+  eventHandlers[A32NX_FCU_ALT_PUSH] = &SimConnectInterface::handleEvent<A32NX_FCU_ALT_PUSH>;
+  eventHandlers[AP_ALT_HOLD_ON] = &SimConnectInterface::handleEvent<A32NX_FCU_ALT_PUSH>;
+  eventHandlers[A32NX_FCU_ALT_PULL] = &SimConnectInterface::handleEvent<A32NX_FCU_ALT_PULL>;
+  eventHandlers[AP_ALT_HOLD_OFF] = &SimConnectInterface::handleEvent<A32NX_FCU_ALT_PULL>;
+  eventHandlers[A32NX_FCU_METRIC_ALT_TOGGLE_PUSH] = &SimConnectInterface::handleEvent<A32NX_FCU_METRIC_ALT_TOGGLE_PUSH>;
+  eventHandlers[A32NX_FCU_VS_INC] = &SimConnectInterface::handleEvent<A32NX_FCU_VS_INC>;
+  eventHandlers[A32NX_FCU_VS_DEC] = &SimConnectInterface::handleEvent<A32NX_FCU_VS_DEC>;
+  eventHandlers[A32NX_FCU_VS_SET] = &SimConnectInterface::handleEvent<A32NX_FCU_VS_SET>;
+  eventHandlers[A32NX_FCU_VS_PUSH] = &SimConnectInterface::handleEvent<A32NX_FCU_VS_PUSH>;
+  eventHandlers[AP_VS_ON] = &SimConnectInterface::handleEvent<A32NX_FCU_VS_PUSH>;
+  eventHandlers[A32NX_FCU_VS_PULL] = &SimConnectInterface::handleEvent<A32NX_FCU_VS_PULL>;
+  eventHandlers[AP_VS_OFF] = &SimConnectInterface::handleEvent<A32NX_FCU_VS_PULL>;
+  eventHandlers[A32NX_FCU_LOC_PUSH] = &SimConnectInterface::handleEvent<A32NX_FCU_LOC_PUSH>;
+  eventHandlers[A32NX_FCU_APPR_PUSH] = &SimConnectInterface::handleEvent<A32NX_FCU_APPR_PUSH>;
+  eventHandlers[A32NX_FCU_EXPED_PUSH] = &SimConnectInterface::handleEvent<A32NX_FCU_EXPED_PUSH>;
+  eventHandlers[AP_ATT_HOLD] = &SimConnectInterface::handleEvent<A32NX_FCU_EXPED_PUSH>;
+  eventHandlers[A32NX_FCU_EFIS_L_FD_PUSH] = &SimConnectInterface::handleEvent<A32NX_FCU_EFIS_L_FD_PUSH>;
+  eventHandlers[A32NX_FCU_EFIS_L_LS_PUSH] = &SimConnectInterface::handleEvent<A32NX_FCU_EFIS_L_LS_PUSH>;
+  eventHandlers[KOHLSMANN_INC] = &SimConnectInterface::handleEvent<KOHLSMANN_INC>;
+  eventHandlers[A32NX_FCU_EFIS_L_BARO_INC] = &SimConnectInterface::handleEvent<A32NX_FCU_EFIS_L_BARO_INC>;
+  eventHandlers[KOHLSMANN_DEC] = &SimConnectInterface::handleEvent<KOHLSMANN_DEC>;
+  eventHandlers[A32NX_FCU_EFIS_L_BARO_DEC] = &SimConnectInterface::handleEvent<A32NX_FCU_EFIS_L_BARO_DEC>;
+  eventHandlers[KOHLSMANN_SET] = &SimConnectInterface::handleEvent<KOHLSMANN_SET>;
+  eventHandlers[A32NX_FCU_EFIS_L_BARO_SET] = &SimConnectInterface::handleEvent<A32NX_FCU_EFIS_L_BARO_SET>;
+  eventHandlers[BAROMETRIC_STD_PRESSURE] = &SimConnectInterface::handleEvent<BAROMETRIC_STD_PRESSURE>;
+  eventHandlers[A32NX_FCU_EFIS_L_BARO_PUSH] = &SimConnectInterface::handleEvent<A32NX_FCU_EFIS_L_BARO_PUSH>;
+  eventHandlers[A32NX_FCU_EFIS_L_BARO_PULL] = &SimConnectInterface::handleEvent<A32NX_FCU_EFIS_L_BARO_PULL>;
+  eventHandlers[A32NX_FCU_EFIS_L_CSTR_PUSH] = &SimConnectInterface::handleEvent<A32NX_FCU_EFIS_L_CSTR_PUSH>;
+  eventHandlers[A32NX_FCU_EFIS_L_WPT_PUSH] = &SimConnectInterface::handleEvent<A32NX_FCU_EFIS_L_WPT_PUSH>;
+  eventHandlers[A32NX_FCU_EFIS_L_VORD_PUSH] = &SimConnectInterface::handleEvent<A32NX_FCU_EFIS_L_VORD_PUSH>;
+  eventHandlers[A32NX_FCU_EFIS_L_NDB_PUSH] = &SimConnectInterface::handleEvent<A32NX_FCU_EFIS_L_NDB_PUSH>;
+  eventHandlers[A32NX_FCU_EFIS_L_ARPT_PUSH] = &SimConnectInterface::handleEvent<A32NX_FCU_EFIS_L_ARPT_PUSH>;
+  eventHandlers[A32NX_FCU_EFIS_R_FD_PUSH] = &SimConnectInterface::handleEvent<A32NX_FCU_EFIS_R_FD_PUSH>;
+  eventHandlers[A32NX_FCU_EFIS_R_LS_PUSH] = &SimConnectInterface::handleEvent<A32NX_FCU_EFIS_R_LS_PUSH>;
+  eventHandlers[A32NX_FCU_EFIS_R_BARO_INC] = &SimConnectInterface::handleEvent<A32NX_FCU_EFIS_R_BARO_INC>;
+  eventHandlers[A32NX_FCU_EFIS_R_BARO_DEC] = &SimConnectInterface::handleEvent<A32NX_FCU_EFIS_R_BARO_DEC>;
+  eventHandlers[A32NX_FCU_EFIS_R_BARO_SET] = &SimConnectInterface::handleEvent<A32NX_FCU_EFIS_R_BARO_SET>;
+  eventHandlers[A32NX_FCU_EFIS_R_BARO_PUSH] = &SimConnectInterface::handleEvent<A32NX_FCU_EFIS_R_BARO_PUSH>;
+  eventHandlers[A32NX_FCU_EFIS_R_BARO_PULL] = &SimConnectInterface::handleEvent<A32NX_FCU_EFIS_R_BARO_PULL>;
+  eventHandlers[A32NX_FCU_EFIS_R_CSTR_PUSH] = &SimConnectInterface::handleEvent<A32NX_FCU_EFIS_R_CSTR_PUSH>;
+  eventHandlers[A32NX_FCU_EFIS_R_WPT_PUSH] = &SimConnectInterface::handleEvent<A32NX_FCU_EFIS_R_WPT_PUSH>;
+  eventHandlers[A32NX_FCU_EFIS_R_VORD_PUSH] = &SimConnectInterface::handleEvent<A32NX_FCU_EFIS_R_VORD_PUSH>;
+  eventHandlers[A32NX_FCU_EFIS_R_NDB_PUSH] = &SimConnectInterface::handleEvent<A32NX_FCU_EFIS_R_NDB_PUSH>;
+  eventHandlers[A32NX_FCU_EFIS_R_ARPT_PUSH] = &SimConnectInterface::handleEvent<A32NX_FCU_EFIS_R_ARPT_PUSH>;
+  eventHandlers[A32NX_FMGC_DIR_TO_TRIGGER] = &SimConnectInterface::handleEvent<A32NX_FMGC_DIR_TO_TRIGGER>;
+  eventHandlers[A32NX_FMGC_MACH_MODE_ACTIVATE] = &SimConnectInterface::handleEvent<A32NX_FMGC_MACH_MODE_ACTIVATE>;
+  eventHandlers[A32NX_FMGC_SPD_MODE_ACTIVATE] = &SimConnectInterface::handleEvent<A32NX_FMGC_SPD_MODE_ACTIVATE>;
+  eventHandlers[A32NX_FMGC_PRESET_SPD_ACTIVATE] = &SimConnectInterface::handleEvent<A32NX_FMGC_PRESET_SPD_ACTIVATE>;
+  eventHandlers[A32NX_EFIS_L_CHRONO_PUSHED] = &SimConnectInterface::handleEvent<A32NX_EFIS_L_CHRONO_PUSHED>;
+  eventHandlers[A32NX_EFIS_R_CHRONO_PUSHED] = &SimConnectInterface::handleEvent<A32NX_EFIS_R_CHRONO_PUSHED>;
+  eventHandlers[AP_SPEED_SLOT_INDEX_SET] = &SimConnectInterface::handleEvent<AP_SPEED_SLOT_INDEX_SET>;
+  eventHandlers[AP_SPD_VAR_INC] = &SimConnectInterface::handleEvent<AP_SPD_VAR_INC>;
+  eventHandlers[AP_SPD_VAR_DEC] = &SimConnectInterface::handleEvent<AP_SPD_VAR_DEC>;
+  eventHandlers[AP_MACH_VAR_INC] = &SimConnectInterface::handleEvent<AP_MACH_VAR_INC>;
+  eventHandlers[AP_MACH_VAR_DEC] = &SimConnectInterface::handleEvent<AP_MACH_VAR_DEC>;
+  eventHandlers[AP_HEADING_SLOT_INDEX_SET] = &SimConnectInterface::handleEvent<AP_HEADING_SLOT_INDEX_SET>;
+  eventHandlers[HEADING_BUG_INC] = &SimConnectInterface::handleEvent<HEADING_BUG_INC>;
+  eventHandlers[HEADING_BUG_DEC] = &SimConnectInterface::handleEvent<HEADING_BUG_DEC>;
+  eventHandlers[AP_ALTITUDE_SLOT_INDEX_SET] = &SimConnectInterface::handleEvent<AP_ALTITUDE_SLOT_INDEX_SET>;
+  eventHandlers[AP_ALT_VAR_INC] = &SimConnectInterface::handleEvent<AP_ALT_VAR_INC>;
+  eventHandlers[AP_ALT_VAR_DEC] = &SimConnectInterface::handleEvent<AP_ALT_VAR_DEC>;
+  eventHandlers[AP_ALT_VAR_SET] = &SimConnectInterface::handleEvent<AP_ALT_VAR_SET>;
+  eventHandlers[AP_VS_SLOT_INDEX_SET] = &SimConnectInterface::handleEvent<AP_VS_SLOT_INDEX_SET>;
+  eventHandlers[AP_VS_VAR_INC] = &SimConnectInterface::handleEvent<AP_VS_VAR_INC>;
+  eventHandlers[AP_VS_VAR_DEC] = &SimConnectInterface::handleEvent<AP_VS_VAR_DEC>;
+  eventHandlers[AP_APR_HOLD] = &SimConnectInterface::handleEvent<AP_APR_HOLD>;
+  eventHandlers[AP_LOC_HOLD] = &SimConnectInterface::handleEvent<AP_LOC_HOLD>;
+  eventHandlers[BAROMETRIC] = &SimConnectInterface::handleEvent<BAROMETRIC>;
+  eventHandlers[AUTO_THROTTLE_ARM] = &SimConnectInterface::handleEvent<AUTO_THROTTLE_ARM>;
+  eventHandlers[AUTO_THROTTLE_DISCONNECT] = &SimConnectInterface::handleEvent<AUTO_THROTTLE_DISCONNECT>;
+  eventHandlers[A32NX_ATHR_RESET_DISABLE] = &SimConnectInterface::handleEvent<A32NX_ATHR_RESET_DISABLE>;
+  eventHandlers[AUTO_THROTTLE_TO_GA] = &SimConnectInterface::handleEvent<AUTO_THROTTLE_TO_GA>;
+  eventHandlers[A32NX_THROTTLE_MAPPING_SET_DEFAULTS] = &SimConnectInterface::handleEvent<A32NX_THROTTLE_MAPPING_SET_DEFAULTS>;
+  eventHandlers[A32NX_THROTTLE_MAPPING_LOAD_FROM_FILE] = &SimConnectInterface::handleEvent<A32NX_THROTTLE_MAPPING_LOAD_FROM_FILE>;
+  eventHandlers[A32NX_THROTTLE_MAPPING_LOAD_FROM_LOCAL_VARIABLES] =
+      &SimConnectInterface::handleEvent<A32NX_THROTTLE_MAPPING_LOAD_FROM_LOCAL_VARIABLES>;
+  eventHandlers[A32NX_THROTTLE_MAPPING_SAVE_TO_FILE] = &SimConnectInterface::handleEvent<A32NX_THROTTLE_MAPPING_SAVE_TO_FILE>;
+  eventHandlers[THROTTLE_SET] = &SimConnectInterface::handleEvent<THROTTLE_SET>;
+  eventHandlers[THROTTLE1_SET] = &SimConnectInterface::handleEvent<THROTTLE1_SET>;
+  eventHandlers[THROTTLE2_SET] = &SimConnectInterface::handleEvent<THROTTLE2_SET>;
+  eventHandlers[THROTTLE_AXIS_SET_EX1] = &SimConnectInterface::handleEvent<THROTTLE_AXIS_SET_EX1>;
+  eventHandlers[THROTTLE1_AXIS_SET_EX1] = &SimConnectInterface::handleEvent<THROTTLE1_AXIS_SET_EX1>;
+  eventHandlers[THROTTLE2_AXIS_SET_EX1] = &SimConnectInterface::handleEvent<THROTTLE2_AXIS_SET_EX1>;
+  eventHandlers[THROTTLE_FULL] = &SimConnectInterface::handleEvent<THROTTLE_FULL>;
+  eventHandlers[THROTTLE_CUT] = &SimConnectInterface::handleEvent<THROTTLE_CUT>;
+  eventHandlers[THROTTLE_INCR] = &SimConnectInterface::handleEvent<THROTTLE_INCR>;
+  eventHandlers[THROTTLE_DECR] = &SimConnectInterface::handleEvent<THROTTLE_DECR>;
+  eventHandlers[THROTTLE_INCR_SMALL] = &SimConnectInterface::handleEvent<THROTTLE_INCR_SMALL>;
+  eventHandlers[THROTTLE_DECR_SMALL] = &SimConnectInterface::handleEvent<THROTTLE_DECR_SMALL>;
+  eventHandlers[THROTTLE_10] = &SimConnectInterface::handleEvent<THROTTLE_10>;
+  eventHandlers[THROTTLE_20] = &SimConnectInterface::handleEvent<THROTTLE_20>;
+  eventHandlers[THROTTLE_30] = &SimConnectInterface::handleEvent<THROTTLE_30>;
+  eventHandlers[THROTTLE_40] = &SimConnectInterface::handleEvent<THROTTLE_40>;
+  eventHandlers[THROTTLE_50] = &SimConnectInterface::handleEvent<THROTTLE_50>;
+  eventHandlers[THROTTLE_60] = &SimConnectInterface::handleEvent<THROTTLE_60>;
+  eventHandlers[THROTTLE_70] = &SimConnectInterface::handleEvent<THROTTLE_70>;
+  eventHandlers[THROTTLE_80] = &SimConnectInterface::handleEvent<THROTTLE_80>;
+  eventHandlers[THROTTLE_90] = &SimConnectInterface::handleEvent<THROTTLE_90>;
+  eventHandlers[THROTTLE1_FULL] = &SimConnectInterface::handleEvent<THROTTLE1_FULL>;
+  eventHandlers[THROTTLE1_CUT] = &SimConnectInterface::handleEvent<THROTTLE1_CUT>;
+  eventHandlers[THROTTLE1_INCR] = &SimConnectInterface::handleEvent<THROTTLE1_INCR>;
+  eventHandlers[THROTTLE1_DECR] = &SimConnectInterface::handleEvent<THROTTLE1_DECR>;
+  eventHandlers[THROTTLE1_INCR_SMALL] = &SimConnectInterface::handleEvent<THROTTLE1_INCR_SMALL>;
+  eventHandlers[THROTTLE1_DECR_SMALL] = &SimConnectInterface::handleEvent<THROTTLE1_DECR_SMALL>;
+  eventHandlers[THROTTLE2_FULL] = &SimConnectInterface::handleEvent<THROTTLE2_FULL>;
+  eventHandlers[THROTTLE2_CUT] = &SimConnectInterface::handleEvent<THROTTLE2_CUT>;
+  eventHandlers[THROTTLE2_INCR] = &SimConnectInterface::handleEvent<THROTTLE2_INCR>;
+  eventHandlers[THROTTLE2_DECR] = &SimConnectInterface::handleEvent<THROTTLE2_DECR>;
+  eventHandlers[THROTTLE2_INCR_SMALL] = &SimConnectInterface::handleEvent<THROTTLE2_INCR_SMALL>;
+  eventHandlers[THROTTLE2_DECR_SMALL] = &SimConnectInterface::handleEvent<THROTTLE2_DECR_SMALL>;
+  eventHandlers[THROTTLE_REVERSE_THRUST_TOGGLE] = &SimConnectInterface::handleEvent<THROTTLE_REVERSE_THRUST_TOGGLE>;
+  eventHandlers[THROTTLE_REVERSE_THRUST_HOLD] = &SimConnectInterface::handleEvent<THROTTLE_REVERSE_THRUST_HOLD>;
+  eventHandlers[SPOILERS_ON] = &SimConnectInterface::handleEvent<SPOILERS_ON>;
+  eventHandlers[SPOILERS_OFF] = &SimConnectInterface::handleEvent<SPOILERS_OFF>;
+  eventHandlers[SPOILERS_TOGGLE] = &SimConnectInterface::handleEvent<SPOILERS_TOGGLE>;
+  eventHandlers[SPOILERS_SET] = &SimConnectInterface::handleEvent<SPOILERS_SET>;
+  eventHandlers[AXIS_SPOILER_SET] = &SimConnectInterface::handleEvent<AXIS_SPOILER_SET>;
+  eventHandlers[SPOILERS_ARM_ON] = &SimConnectInterface::handleEvent<SPOILERS_ARM_ON>;
+  eventHandlers[SPOILERS_ARM_OFF] = &SimConnectInterface::handleEvent<SPOILERS_ARM_OFF>;
+  eventHandlers[SPOILERS_ARM_TOGGLE] = &SimConnectInterface::handleEvent<SPOILERS_ARM_TOGGLE>;
+  eventHandlers[SPOILERS_ARM_SET] = &SimConnectInterface::handleEvent<SPOILERS_ARM_SET>;
+  eventHandlers[SIM_RATE_INCR] = &SimConnectInterface::handleEvent<SIM_RATE_INCR>;
+  eventHandlers[SIM_RATE_DECR] = &SimConnectInterface::handleEvent<SIM_RATE_DECR>;
+  eventHandlers[SIM_RATE_SET] = &SimConnectInterface::handleEvent<SIM_RATE_SET>;
+
+  // high-rate axis events which only set an input are coalesced, the throttle and spoiler axis are processed
+  // per event as their handlers keep a state of their own
+  coalescedEvents[AXIS_ELEVATOR_SET] = true;
+  coalescedEvents[AXIS_AILERONS_SET] = true;
+  coalescedEvents[AXIS_RUDDER_SET] = true;
+  coalescedEvents[RUDDER_SET] = true;
+  coalescedEvents[RUDDER_AXIS_MINUS] = true;
+  coalescedEvents[RUDDER_AXIS_PLUS] = true;
+  coalescedEvents[AILERON_SET] = true;
+  coalescedEvents[ELEVATOR_SET] = true;
+
+  pendingAxisEvents.clear();
+  pendingAxisEvents.reserve(EVENT_COUNT);
+}
+
 void SimConnectInterface::simConnectProcessSimObjectData(const SIMCONNECT_RECV_SIMOBJECT_DATA* data) {
   // process depending on request id
   switch (data->dwRequestID) {
@@ -2975,6 +3294,10 @@ void SimConnectInterface::simConnectProcessSimObjectData(const SIMCONNECT_RECV_S
 void SimConnectInterface::simConnectProcessClientData(const SIMCONNECT_RECV_CLIENT_DATA* data) {
   // process depending on request id
   switch (data->dwRequestID) {
+    case ClientData::CLIENT_DATA_OUTPUT_BLOCK:
+      processClientDataOutputBlock(*((ClientDataOutputBlock*)&data->dwData));
+      return;
+
     case ClientData::ELAC_DISCRETE_OUTPUTS:
       // store aircraft data
       clientDataElacDiscreteOutputs = *((base_elac_discrete_outputs*)&data->dwData);
@@ -3083,7 +3406,47 @@ void SimConnectInterface::simConnectProcessClientData(const SIMCONNECT_RECV_CLIE
   }
 }
 
-bool SimConnectInterface::sendClientData(SIMCONNECT_DATA_DEFINITION_ID id, DWORD size, void* data) {
+void SimConnectInterface::processClientDataOutputBlock(const ClientDataOutputBlock& block) {
+  // blocks of a different layout cannot be used
+  if (block.header.version != CLIENT_DATA_BLOCK_VERSION || block.header.size != sizeof(ClientDataOutputBlock)) {
+    if (!clientDataOutputBlockRejected) {
+      std::cout << "WASM: Client data output block rejected, version " << block.header.version << " with size " << block.header.size;
+      std::cout << " does not match version " << CLIENT_DATA_BLOCK_VERSION << " with size " << sizeof(ClientDataOutputBlock);
+      std::cout << std::endl;
+      clientDataOutputBlockRejected = true;
+    }
+    return;
+  }
+
+  // outputs that are not newer than the last ones are stale and dropped
+  if (block.header.sequence <= clientDataOutputSequence) {
+    clientDataStaleFrames++;
+    return;
+  }
+
+  // a gap in the sequence means the outputs of these frames never arrived
+  clientDataLostFrames += block.header.sequence - clientDataOutputSequence - 1;
+  clientDataOutputSequence = block.header.sequence;
+
+  // store aircraft data
+  clientDataElacDiscreteOutputs = block.elacDiscreteOutputs;
+  clientDataElacAnalogOutputs = block.elacAnalogOutputs;
+  clientDataElacBusOutputs = block.elacBus;
+  clientDataSecDiscreteOutputs = block.secDiscreteOutputs;
+  clientDataSecAnalogOutputs = block.secAnalogOutputs;
+  clientDataSecBusOutputs = block.secBus;
+  clientDataFacDiscreteOutputs = block.facDiscreteOutputs;
+  clientDataFacAnalogOutputs = block.facAnalogOutputs;
+  clientDataFacBusOutputs = block.facBus;
+  clientDataFcuDiscreteOutputs = block.fcuDiscreteOutputs;
+  clientDataFcuBusOutputs = block.fcuBus;
+  clientDataFmgcDiscreteOutputs = block.fmgcDiscreteOutputs;
+  clientDataFmgcABusOutputs = block.fmgcABus;
+  clientDataFmgcBBusOutputs = block.fmgcBBus;
+  clientDataFadecOutputs = block.fadecOutputs;
+}
+
+bool SimConnectInterface::sendClientData(SIMCONNECT_DATA_DEFINITION_ID id, DWORD size, const void* data) {
   // check if we are connected
   if (!isConnected) {
     return false;
@@ -3095,8 +3458,17 @@ bool SimConnectInterface::sendClientData(SIMCONNECT_DATA_DEFINITION_ID id, DWORD
     return true;
   }
 
-  // set output data
-  HRESULT result = SimConnect_SetClientData(hSimConnect, id, id, SIMCONNECT_CLIENT_DATA_SET_FLAG_DEFAULT, 0, size, data);
+  // in bulk transfer mode the data is only collected, the block is sent once per frame
+  if (clientDataBulkTransferEnabled) {
+    if (id >= clientDataInputBlockFields.size() || clientDataInputBlockFields[id].size != size) {
+      return false;
+    }
+    std::memcpy(clientDataInputBlockFields[id].data, data, size);
+    return true;
+  }
+
+  // set output data, the data is only read
+  HRESULT result = SimConnect_SetClientData(hSimConnect, id, id, SIMCONNECT_CLIENT_DATA_SET_FLAG_DEFAULT, 0, size, const_cast<void*>(data));
 
   // check result of data request
   if (result != S_OK) {
@@ -2,12 +2,14 @@
 
 #include <MSFS/Legacy/gauges.h>
 #include <SimConnect.h>
+#include <array>
 #include <string>
 #include <vector>
 
 #include "../LocalVariable.h"
 #include "../SpoilersHandler.h"
 #include "../ThrottleAxisMapping.h"
+#include "ClientDataBlock.h"
 #include "SimConnectData.h"
 
 #include "../model/ElacComputer_types.h"
@@ -213,6 +215,7 @@ class SimConnectInterface {
     SIM_RATE_DECR,
     SIM_RATE_SET,
     SYSTEM_EVENT_PAUSE,
+    EVENT_COUNT,
   };
 
   SimConnectInterface() = default;
@@ -220,6 +223,7 @@ class SimConnectInterface {
   ~SimConnectInterface() = default;
 
   bool connect(bool clientDataEnabled,
+               bool clientDataBulkTransferEnabled,
                int elacDisabled,
                int secDisabled,
                int facDisabled,
@@ -272,23 +276,23 @@ class SimConnectInterface {
 
   void resetSimInputThrottles();
 
-  SimData& getSimData();
+  const SimData& getSimData() const;
 
-  SimInput& getSimInput();
+  const SimInput& getSimInput() const;
 
-  SimInputAutopilot& getSimInputAutopilot();
+  const SimInputAutopilot& getSimInputAutopilot() const;
 
   base_fcu_afs_panel_inputs& getFcuAfsPanelInputs();
 
   base_fcu_efis_panel_inputs& getFcuEfisPanelInputs(int side);
 
-  SimInputRudderTrim& getSimInputRudderTrim();
+  const SimInputRudderTrim& getSimInputRudderTrim() const;
 
-  SimInputThrottles& getSimInputThrottles();
+  const SimInputThrottles& getSimInputThrottles() const;
 
   bool setClientDataElacDiscretes(base_elac_discrete_inputs& output);
   bool setClientDataElacAnalog(base_elac_analog_inputs& output);
-  bool setClientDataElacBusInput(base_elac_out_bus& output, int elacIndex);
+  bool setClientDataElacBusInput(const base_elac_out_bus& output, int elacIndex);
 
   base_elac_discrete_outputs& getClientDataElacDiscretesOutput();
   base_elac_analog_outputs& getClientDataElacAnalogsOutput();
@@ -296,7 +300,7 @@ class SimConnectInterface {
 
   bool setClientDataSecDiscretes(base_sec_discrete_inputs& output);
   bool setClientDataSecAnalog(base_sec_analog_inputs& output);
-  bool setClientDataSecBus(base_sec_out_bus& output, int secIndex);
+  bool setClientDataSecBus(const base_sec_out_bus& output, int secIndex);
 
   base_sec_discrete_outputs& getClientDataSecDiscretesOutput();
   base_sec_analog_outputs& getClientDataSecAnalogsOutput();
@@ -304,21 +308,21 @@ class SimConnectInterface {
 
   bool setClientDataFacDiscretes(base_fac_discrete_inputs& output);
   bool setClientDataFacAnalog(base_fac_analog_inputs& output);
-  bool setClientDataFacBus(base_fac_bus& output, int facIndex);
+  bool setClientDataFacBus(const base_fac_bus& output, int facIndex);
 
   base_fac_discrete_outputs& getClientDataFacDiscretesOutput();
   base_fac_analog_outputs& getClientDataFacAnalogsOutput();
   base_fac_bus& getClientDataFacBusOutput();
 
-  bool setClientDataFcuBus(base_fcu_bus& output);
+  bool setClientDataFcuBus(const base_fcu_bus& output);
 
   base_fcu_discrete_outputs& getClientDataFcuDiscreteOutput();
   base_fcu_bus& getClientDataFcuBusOutput();
 
   bool setClientDataFmgcDiscretes(base_fmgc_discrete_inputs& output);
   bool setClientDataFmgcFmsData(base_fms_inputs& output);
-  bool setClientDataFmgcABus(base_fmgc_a_bus& output, int fmgcIndex);
-  bool setClientDataFmgcBBus(base_fmgc_b_bus& output, int fmgcIndex);
+  bool setClientDataFmgcABus(const base_fmgc_a_bus& output, int fmgcIndex);
+  bool setClientDataFmgcBBus(const base_fmgc_b_bus& output, int fmgcIndex);
 
   base_fmgc_discrete_outputs& getClientDataFmgcDiscretesOutput();
   base_fmgc_a_bus& getClientDataFmgcABusOutput();
@@ -338,6 +342,12 @@ class SimConnectInterface {
   bool setClientDataTcas(base_tcas_bus& output);
   bool setClientDataFadec(base_ecu_bus& output, int fadecIndex);
 
+  /**
+   * @brief Sends the client data collected during the frame as one block, only used in bulk transfer mode.
+   * @return true if the block was sent or the bulk transfer mode is disabled.
+   */
+  bool sendClientDataInputBlock();
+
   void setLoggingFlightControlsEnabled(bool enabled);
   bool getLoggingFlightControlsEnabled();
 
@@ -349,6 +359,14 @@ class SimConnectInterface {
 
   void updateSimulationRateLimits(double minSimulationRate, double maxSimulationRate);
 
+  void setLimitSimulationRateByPerformance(bool enabled);
+
+  void updateFlightControlsConfiguration(double keyChangeAileron,
+                                         double keyChangeElevator,
+                                         double keyChangeRudder,
+                                         bool disableXboxCompatibilityRudderPlusMinus,
+                                         bool enableRudder2AxisMode);
+
   bool isSimInAnyPause();
   bool isSimInActivePause();
   bool isSimInPause();
@@ -402,6 +420,8 @@ class SimConnectInterface {
     ILS_1_BUS,
     ILS_2_BUS,
     TCAS_BUS,
+    CLIENT_DATA_INPUT_BLOCK,
+    CLIENT_DATA_OUTPUT_BLOCK,
   };
 
   bool isConnected = false;
@@ -413,6 +433,7 @@ class SimConnectInterface {
   double maxSimulationRate = 0;
   bool limitSimulationRateByPerformance = true;
   bool clientDataEnabled = false;
+  bool clientDataBulkTransferEnabled = false;
 
   int elacDisabled = -1;
   int secDisabled = -1;
@@ -460,6 +481,18 @@ class SimConnectInterface {
 
   athr_output clientDataFadecOutputs = {};
 
+  // bulk transfer mode, the client data written during a frame is collected in the input block and sent at once
+  struct ClientDataBlockField {
+    void* data;
+    DWORD size;
+  };
+  std::array<ClientDataBlockField, CLIENT_DATA_INPUT_BLOCK> clientDataInputBlockFields = {};
+  ClientDataInputBlock clientDataInputBlock = {};
+  std::uint32_t clientDataOutputSequence = 0;
+  std::uint64_t clientDataLostFrames = 0;
+  std::uint64_t clientDataStaleFrames = 0;
+  bool clientDataOutputBlockRejected = false;
+
   // change to non-static when aileron events can be processed via SimConnect
   static double flightControlsKeyChangeAileron;
   double flightControlsKeyChangeElevator = 0.0;
@@ -474,6 +507,19 @@ class SimConnectInterface {
 
   std::unique_ptr<LocalVariable> idSyncFoEfisEnabled;
 
+  // handlers of the events, indexed by event id and filled when the events are mapped
+  using EventHandler = void (SimConnectInterface::*)(const DWORD data0, const DWORD data1);
+  std::array<EventHandler, EVENT_COUNT> eventHandlers = {};
+
+  // axis events received in the current dispatch loop of which only the last value is applied
+  struct PendingAxisEvent {
+    DWORD eventId;
+    DWORD data0;
+    DWORD data1;
+  };
+  std::array<bool, EVENT_COUNT> coalescedEvents = {};
+  std::vector<PendingAxisEvent> pendingAxisEvents;
+
   bool prepareSimDataSimConnectDataDefinitions();
 
   bool prepareSimInputSimConnectDataDefinitions();
@@ -482,6 +528,8 @@ class SimConnectInterface {
 
   bool prepareClientDataDefinitions();
 
+  bool prepareClientDataBlockDefinitions();
+
   void simConnectProcessDispatchMessage(SIMCONNECT_RECV* pData, DWORD* cbData);
 
   /**
@@ -519,7 +567,9 @@ class SimConnectInterface {
 
   void simConnectProcessClientData(const SIMCONNECT_RECV_CLIENT_DATA* data);
 
-  bool sendClientData(SIMCONNECT_DATA_DEFINITION_ID id, DWORD size, void* data);
+  void processClientDataOutputBlock(const ClientDataOutputBlock& block);
+
+  bool sendClientData(SIMCONNECT_DATA_DEFINITION_ID id, DWORD size, const void* data);
   bool sendData(SIMCONNECT_DATA_DEFINITION_ID id, DWORD size, void* data);
 
   static bool addDataDefinition(const HANDLE connectionHandle,
@@ -547,4 +597,22 @@ class SimConnectInterface {
    *                If called by non-EX1 Event Handler, default to 0.
    */
   void processEvent(const DWORD eventId, const DWORD data0, const DWORD data1 = 0);
+
+  /**
+   * @brief Handler of a single event, specialized for every event in SimConnectInterface.cpp.
+   * @param data0 Double word containing any additional number required by the event.
+   * @param data1 Double word containing any additional number required by the event.
+   */
+  template <Events Event>
+  void handleEvent(const DWORD data0, const DWORD data1);
+
+  /**
+   * @brief Fills the handler table, events sharing a behaviour are registered with the same handler.
+   */
+  void registerEventHandlers();
+
+  /**
+   * @brief Applies the axis events coalesced during the last dispatch loop.
+   */
+  void applyPendingAxisEvents();
 };
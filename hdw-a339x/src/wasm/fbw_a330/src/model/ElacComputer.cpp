@@ -1,9 +1,9 @@
 #include "ElacComputer.h"
 #include "ElacComputer_types.h"
+#include "look1_pbinlxpw.h"
+#include "look2_pbinlxpw.h"
 #include "rtwtypes.h"
 #include <cmath>
-#include "look2_binlxpw.h"
-#include "look1_binlxpw.h"
 #include "LateralNormalLaw.h"
 #include "LateralDirectLaw.h"
 #include "PitchNormalLaw.h"
@@ -1102,11 +1102,11 @@ void ElacComputer::step()
       ElacComputer_P.BitfromLabel5_bit_a, &rtb_y_aw);
     ElacComputer_MATLABFunction_o(rtb_OR1_i, rtb_OR_eo, rtb_AND2_j, rtb_AND3_j, rtb_DataTypeConversion_e, (rtb_y_aw !=
       0U), &rtb_handleIndex);
-    ElacComputer_RateLimiter_n(look2_binlxpw(static_cast<real_T>(rtb_mach), rtb_handleIndex,
+    ElacComputer_RateLimiter_n(look2_pbinlxpw(static_cast<real_T>(rtb_mach), rtb_handleIndex,
       ElacComputer_P.alphamax_bp01Data, ElacComputer_P.alphamax_bp02Data, ElacComputer_P.alphamax_tableData,
-      ElacComputer_P.alphamax_maxIndex, 4U), ElacComputer_P.RateLimiterGenericVariableTs_up,
-      ElacComputer_P.RateLimiterGenericVariableTs_lo, ElacComputer_U.in.time.dt, ElacComputer_P.reset_Value,
-      &rtb_Switch3_p, &ElacComputer_DWork.sf_RateLimiter_n);
+      ElacComputer_DWork.alphamax_m_bpIndex, ElacComputer_P.alphamax_maxIndex, 4U),
+      ElacComputer_P.RateLimiterGenericVariableTs_up, ElacComputer_P.RateLimiterGenericVariableTs_lo,
+      ElacComputer_U.in.time.dt, ElacComputer_P.reset_Value, &rtb_Switch3_p, &ElacComputer_DWork.sf_RateLimiter_n);
     if (!ElacComputer_DWork.eventTime_not_empty_i) {
       ElacComputer_DWork.eventTime_p = ElacComputer_U.in.time.simulation_time;
       ElacComputer_DWork.eventTime_not_empty_i = true;
@@ -1116,9 +1116,10 @@ void ElacComputer::step()
       ElacComputer_DWork.eventTime_p = ElacComputer_U.in.time.simulation_time;
     }
 
-    ElacComputer_RateLimiter_n(look2_binlxpw(static_cast<real_T>(rtb_mach), rtb_handleIndex,
+    ElacComputer_RateLimiter_n(look2_pbinlxpw(static_cast<real_T>(rtb_mach), rtb_handleIndex,
       ElacComputer_P.alphaprotection_bp01Data, ElacComputer_P.alphaprotection_bp02Data,
-      ElacComputer_P.alphaprotection_tableData, ElacComputer_P.alphaprotection_maxIndex, 4U),
+      ElacComputer_P.alphaprotection_tableData, ElacComputer_DWork.alphaprotection_m_bpIndex,
+      ElacComputer_P.alphaprotection_maxIndex, 4U),
       ElacComputer_P.RateLimiterGenericVariableTs1_up, ElacComputer_P.RateLimiterGenericVariableTs1_lo,
       ElacComputer_U.in.time.dt, ElacComputer_P.reset_Value_j, &rtb_Y_o, &ElacComputer_DWork.sf_RateLimiter_m);
     if (ElacComputer_U.in.time.simulation_time - ElacComputer_DWork.eventTime_p <=
@@ -1140,9 +1141,10 @@ void ElacComputer::step()
     rtb_OR_eo = ((priorityPitchPitchLawCap == pitch_efcs_law::NormalLaw) || (rtb_activeLateralLaw == lateral_efcs_law::
       NormalLaw));
     if (ElacComputer_U.in.discrete_inputs.ap_1_disengaged && ElacComputer_U.in.discrete_inputs.ap_2_disengaged &&
-        (rtb_V_ias > std::fmin(look1_binlxpw(rtb_Y_o, ElacComputer_P.uDLookupTable1_bp01Data,
-           ElacComputer_P.uDLookupTable1_tableData, 3U), static_cast<real_T>(rtb_V_ias) / rtb_mach * look1_binlxpw
-          (rtb_Y_o, ElacComputer_P.uDLookupTable2_bp01Data, ElacComputer_P.uDLookupTable2_tableData, 3U)))) {
+        (rtb_V_ias > std::fmin(look1_pbinlxpw(rtb_Y_o, ElacComputer_P.uDLookupTable1_bp01Data,
+           ElacComputer_P.uDLookupTable1_tableData, &ElacComputer_DWork.uDLookupTable1_m_bpIndex, 3U),
+          static_cast<real_T>(rtb_V_ias) / rtb_mach * look1_pbinlxpw(rtb_Y_o, ElacComputer_P.uDLookupTable2_bp01Data,
+           ElacComputer_P.uDLookupTable2_tableData, &ElacComputer_DWork.uDLookupTable2_m_bpIndex, 3U)))) {
       ElacComputer_DWork.sProtActive = (rtb_OR_eo || ElacComputer_DWork.sProtActive);
     }
 
@@ -1221,8 +1223,9 @@ void ElacComputer::step()
       ElacComputer_DWork.eventTime_not_empty = true;
     }
 
-    if ((rtb_V_ias <= std::fmin(365.0, static_cast<real_T>(rtb_V_ias) / rtb_mach * (look1_binlxpw(rtb_Y_o,
-            ElacComputer_P.uDLookupTable_bp01Data, ElacComputer_P.uDLookupTable_tableData, 3U) + 0.01))) ||
+    if ((rtb_V_ias <= std::fmin(365.0, static_cast<real_T>(rtb_V_ias) / rtb_mach * (look1_pbinlxpw(rtb_Y_o,
+            ElacComputer_P.uDLookupTable_bp01Data, ElacComputer_P.uDLookupTable_tableData,
+            &ElacComputer_DWork.uDLookupTable_m_bpIndex, 3U) + 0.01))) ||
         ((priorityPitchPitchLawCap != pitch_efcs_law::NormalLaw) && (rtb_activeLateralLaw != lateral_efcs_law::NormalLaw))
         || (ElacComputer_DWork.eventTime == 0.0)) {
       ElacComputer_DWork.eventTime = ElacComputer_U.in.time.simulation_time;
@@ -1577,8 +1580,9 @@ void ElacComputer::step()
       }
     }
 
-    rtb_NOT_ac = ((look1_binlxpw(static_cast<real_T>(rtb_V_ias), ElacComputer_P.uDLookupTable_bp01Data_h,
-      ElacComputer_P.uDLookupTable_tableData_j, 6U) < std::abs(rtb_Y_o)) && rtb_isEngagedInPitch);
+    rtb_NOT_ac = ((look1_pbinlxpw(static_cast<real_T>(rtb_V_ias), ElacComputer_P.uDLookupTable_bp01Data_h,
+      ElacComputer_P.uDLookupTable_tableData_j, &ElacComputer_DWork.uDLookupTable_m_bpIndex_j, 6U) < std::abs(rtb_Y_o))
+                  && rtb_isEngagedInPitch);
     rtb_eta_trim_limit_lo_d = rtb_Y_o;
     ElacComputer_MATLABFunction(&ElacComputer_U.in.bus_inputs.elac_opp_bus.elevator_double_pressurization_command_deg,
       &rtb_y_f);
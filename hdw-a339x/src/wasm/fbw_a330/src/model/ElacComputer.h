@@ -9,9 +9,6 @@
 #include "PitchDirectLaw.h"
 
 extern const real_T ElacComputer_RGND;
-extern base_elac_logic_outputs rtP_elac_logic_output_MATLABStruct;
-extern base_elac_analog_outputs rtP_elac_analog_output_MATLABStruct;
-extern base_elac_discrete_outputs rtP_elac_discrete_output_MATLABStruct;
 class ElacComputer final
 {
  public:
@@ -64,6 +61,12 @@ class ElacComputer final
     real_T resetEventTime;
     real_T eventTime_p;
     real_T on_ground_time;
+    uint32_T alphamax_m_bpIndex[2];
+    uint32_T alphaprotection_m_bpIndex[2];
+    uint32_T uDLookupTable1_m_bpIndex;
+    uint32_T uDLookupTable2_m_bpIndex;
+    uint32_T uDLookupTable_m_bpIndex;
+    uint32_T uDLookupTable_m_bpIndex_j;
     boolean_T Delay_DSTATE_cc;
     boolean_T Delay1_DSTATE;
     uint8_T is_active_c28_ElacComputer;
@@ -181,8 +184,6 @@ class ElacComputer final
     real_T CompareToConstant_const_f;
     real_T CompareToConstant2_const;
     real_T CompareToConstant3_const;
-    real_T CompareToConstant1_const;
-    real_T CompareToConstant1_const_d;
     real_T HysteresisNode2_highTrigger;
     real_T HysteresisNode1_highTrigger;
     real_T HysteresisNode3_highTrigger;
@@ -232,8 +233,6 @@ class ElacComputer final
     boolean_T PulseNode_isRisingEdge_g;
     boolean_T ConfirmNode_isRisingEdge_f;
     elac_outputs out_Y0;
-    base_elac_out_bus Constant4_Value;
-    base_elac_laws_outputs Constant_Value;
     real_T Bias_Bias;
     real_T Saturation_UpperSat;
     real_T Saturation_LowerSat;
@@ -322,6 +321,11 @@ class ElacComputer final
     ElacComputer_U = *pExternalInputs_ElacComputer_T;
   }
 
+  ExternalInputs_ElacComputer_T &getExternalInputs()
+  {
+    return ElacComputer_U;
+  }
+
   const ExternalOutputs_ElacComputer_T &getExternalOutputs() const
   {
     return ElacComputer_Y;
@@ -337,7 +341,7 @@ class ElacComputer final
   ExternalOutputs_ElacComputer_T ElacComputer_Y;
   BlockIO_ElacComputer_T ElacComputer_B;
   D_Work_ElacComputer_T ElacComputer_DWork;
-  static Parameters_ElacComputer_T ElacComputer_P;
+  static const Parameters_ElacComputer_T ElacComputer_P;
   static void ElacComputer_MATLABFunction(const base_arinc_429 *rtu_u, boolean_T *rty_y);
   static void ElacComputer_MATLABFunction_j(const base_arinc_429 *rtu_u, real_T rtu_bit, uint32_T *rty_y);
   static void ElacComputer_RateLimiter_Reset(rtDW_RateLimiter_ElacComputer_T *localDW);
@@ -1,104 +1,6 @@
 #include "ElacComputer.h"
 
-base_elac_logic_outputs rtP_elac_logic_output_MATLABStruct{
-  false,
-  false,
-  false,
-  lateral_efcs_law::None,
-  lateral_efcs_law::None,
-  pitch_efcs_law::None,
-  pitch_efcs_law::None,
-  false,
-  false,
-  false,
-  false,
-  false,
-  false,
-  false,
-  false,
-  false,
-  false,
-  false,
-  false,
-  false,
-  false,
-  false,
-  false,
-  false,
-  false,
-  false,
-  false,
-  false,
-  false,
-  false,
-  false,
-  false,
-  0.0,
-  0.0,
-  false,
-  false,
-  false,
-  false,
-  false,
-  0.0,
-  0.0,
-  false,
-  0.0,
-  0.0,
-  false,
-  false,
-  false,
-  false,
-  false,
-  false,
-  false,
-
-  {
-    0.0,
-    0.0,
-    0.0,
-    0.0
-  },
-
-  {
-    0.0,
-    0.0,
-    0.0,
-    0.0,
-    0.0,
-    0.0,
-    0.0,
-    0.0,
-    0.0
-  },
-  0.0,
-  false
-} ;
-
-base_elac_analog_outputs rtP_elac_analog_output_MATLABStruct{
-  0.0,
-  0.0,
-  0.0,
-  0.0,
-  0.0
-} ;
-
-base_elac_discrete_outputs rtP_elac_discrete_output_MATLABStruct{
-  false,
-  false,
-  false,
-  false,
-  false,
-  false,
-  false,
-  false,
-  false,
-  false,
-  false,
-  false
-} ;
-
-ElacComputer::Parameters_ElacComputer_T ElacComputer::ElacComputer_P{
+const ElacComputer::Parameters_ElacComputer_T ElacComputer::ElacComputer_P{
 
   0.5,
 
@@ -224,10 +126,6 @@ ElacComputer::Parameters_ElacComputer_T ElacComputer::ElacComputer_P{
 
   2.0,
 
-  3.0,
-
-  1.0,
-
   1750.0,
 
   1750.0,
@@ -1962,110 +1860,6 @@ ElacComputer::Parameters_ElacComputer_T ElacComputer::ElacComputer_P{
     }
   },
 
-
-  {
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    }
-  },
-
-
-  {
-    {
-      0.0,
-      0.0,
-      0.0,
-      0.0
-    },
-
-    {
-      0.0,
-      0.0,
-      false
-    }
-  },
-
   -5.0,
 
   20.0,
@@ -1,11 +1,15 @@
 #include "FacComputer.h"
 #include "FacComputer_types.h"
+#include "look1_pbinlxpw.h"
+#include "plook_binxp.h"
+#include "plook_evenx.h"
 #include "rtwtypes.h"
 #include <cmath>
-#include "look2_binlxpw.h"
 #include "look1_binlxpw.h"
 #include "plook_binx.h"
 #include "intrp3d_l_pw.h"
+#include "intrp1d_l_pw.h"
+#include "intrp2d_l_pw.h"
 
 const uint8_T FacComputer_IN_Flying{ 1U };
 
@@ -224,8 +228,11 @@ void FacComputer::FacComputer_MATLABFunction_g3(const boolean_T rtu_u[19], real3
 void FacComputer::step()
 {
   real_T fractions[3];
+  real_T rtb_PrelookupMachConfig_o2[2];
   real_T Vcas;
   real_T rtb_BusAssignment_d_flight_envelope_alpha_filtered_deg;
+  real_T rtb_PrelookupConstant1_o2;
+  real_T rtb_PrelookupConstant_o2;
   real_T rtb_BusAssignment_dj_flight_envelope_v_stall_warn_kn;
   real_T rtb_BusAssignment_f_flight_envelope_v_alpha_max_kn;
   real_T rtb_BusAssignment_f_flight_envelope_v_fe_next_kn;
@@ -276,6 +283,9 @@ void FacComputer::step()
   real32_T rtb_y_a;
   real32_T rtb_y_mb;
   uint32_T bpIndices[3];
+  uint32_T rtb_PrelookupMachConfig_o1[2];
+  uint32_T rtb_PrelookupConstant1_o1;
+  uint32_T rtb_PrelookupConstant_o1;
   uint32_T rtb_y_ep;
   uint32_T rtb_y_ig;
   uint32_T rtb_y_k;
@@ -628,9 +638,12 @@ void FacComputer::step()
       FacComputer_P.BitfromLabel7_bit_i, &rtb_y_ep);
     rtb_DataTypeConversion_kr = (rtb_y_ep != 0U);
     rtb_y_ool = (rtb_y_ool || (rtb_y_ep != 0U));
-    FacComputer_RateLimiter(look2_binlxpw(static_cast<real_T>(rtb_mach), static_cast<real_T>(rtb_Switch_i_idx_0),
-      FacComputer_P.alphafloor_bp01Data, FacComputer_P.alphafloor_bp02Data, FacComputer_P.alphafloor_tableData,
-      FacComputer_P.alphafloor_maxIndex, 4U), FacComputer_P.RateLimiterGenericVariableTs1_up,
+    rtb_PrelookupMachConfig_o1[0U] = plook_binxp(static_cast<real_T>(rtb_mach), FacComputer_P.alphafloor_bp01Data, 3U,
+      &rtb_PrelookupMachConfig_o2[0U], &FacComputer_DWork.PrelookupMachConfig_m_bpIndex);
+    rtb_PrelookupMachConfig_o1[1U] = plook_evenx(static_cast<real_T>(rtb_Switch_i_idx_0), FacComputer_P.alpha0_bp01Data,
+      1.0, 5U, &rtb_PrelookupMachConfig_o2[1U]);
+    FacComputer_RateLimiter(intrp2d_l_pw(rtb_PrelookupMachConfig_o1, rtb_PrelookupMachConfig_o2,
+      FacComputer_P.alphafloor_tableData, 4U), FacComputer_P.RateLimiterGenericVariableTs1_up,
       FacComputer_P.RateLimiterGenericVariableTs1_lo, FacComputer_U.in.time.dt, FacComputer_P.reset_Value, &rtb_Switch1,
       &FacComputer_DWork.sf_RateLimiter);
     rtb_Gain = FacComputer_P.DiscreteDerivativeVariableTs_Gain * rtb_V_ias;
@@ -733,28 +746,25 @@ void FacComputer::step()
 
     rtb_y_ool = (FacComputer_DWork.sAlphaFloor != 0.0);
     rtb_Y_g4 = rtb_Switch_i_idx_0;
-    FacComputer_RateLimiter(look1_binlxpw(static_cast<real_T>(rtb_Switch_i_idx_0), FacComputer_P.alpha0_bp01Data,
-      FacComputer_P.alpha0_tableData, 5U), FacComputer_P.RateLimiterGenericVariableTs1_up_g,
+    FacComputer_RateLimiter(intrp1d_l_pw(rtb_PrelookupMachConfig_o1[1U], rtb_PrelookupMachConfig_o2[1U],
+      FacComputer_P.alpha0_tableData), FacComputer_P.RateLimiterGenericVariableTs1_up_g,
       FacComputer_P.RateLimiterGenericVariableTs1_lo_n, FacComputer_U.in.time.dt, FacComputer_P.reset_Value_k,
       &rtb_Switch4_f, &FacComputer_DWork.sf_RateLimiter_c);
-    FacComputer_RateLimiter(look2_binlxpw(static_cast<real_T>(rtb_mach), static_cast<real_T>(rtb_Switch_i_idx_0),
-      FacComputer_P.alphamax_bp01Data, FacComputer_P.alphamax_bp02Data, FacComputer_P.alphamax_tableData,
-      FacComputer_P.alphamax_maxIndex, 4U), FacComputer_P.RateLimiterGenericVariableTs4_up,
+    FacComputer_RateLimiter(intrp2d_l_pw(rtb_PrelookupMachConfig_o1, rtb_PrelookupMachConfig_o2,
+      FacComputer_P.alphamax_tableData, 4U), FacComputer_P.RateLimiterGenericVariableTs4_up,
       FacComputer_P.RateLimiterGenericVariableTs4_lo, FacComputer_U.in.time.dt, FacComputer_P.reset_Value_o,
       &rtb_Switch1, &FacComputer_DWork.sf_RateLimiter_a);
     FacComputer_CalculateV_alpha_max(static_cast<real_T>(rtb_V_ias),
       rtb_BusAssignment_d_flight_envelope_alpha_filtered_deg, rtb_Switch4_f, rtb_Switch1,
       &rtb_BusAssignment_f_flight_envelope_v_alpha_max_kn);
-    FacComputer_RateLimiter(look2_binlxpw(static_cast<real_T>(rtb_mach), static_cast<real_T>(rtb_Switch_i_idx_0),
-      FacComputer_P.alphaprotection_bp01Data, FacComputer_P.alphaprotection_bp02Data,
-      FacComputer_P.alphaprotection_tableData, FacComputer_P.alphaprotection_maxIndex, 4U),
+    FacComputer_RateLimiter(intrp2d_l_pw(rtb_PrelookupMachConfig_o1, rtb_PrelookupMachConfig_o2,
+      FacComputer_P.alphaprotection_tableData, 4U),
       FacComputer_P.RateLimiterGenericVariableTs3_up, FacComputer_P.RateLimiterGenericVariableTs3_lo,
       FacComputer_U.in.time.dt, FacComputer_P.reset_Value_a, &rtb_Switch1, &FacComputer_DWork.sf_RateLimiter_n);
     FacComputer_CalculateV_alpha_max(static_cast<real_T>(rtb_V_ias),
       rtb_BusAssignment_d_flight_envelope_alpha_filtered_deg, rtb_Switch4_f, rtb_Switch1, &rtb_Switch);
-    FacComputer_RateLimiter(look2_binlxpw(static_cast<real_T>(rtb_mach), static_cast<real_T>(rtb_Switch_i_idx_0),
-      FacComputer_P.alphastallwarn_bp01Data, FacComputer_P.alphastallwarn_bp02Data,
-      FacComputer_P.alphastallwarn_tableData, FacComputer_P.alphastallwarn_maxIndex, 4U),
+    FacComputer_RateLimiter(intrp2d_l_pw(rtb_PrelookupMachConfig_o1, rtb_PrelookupMachConfig_o2,
+      FacComputer_P.alphastallwarn_tableData, 4U),
       FacComputer_P.RateLimiterGenericVariableTs2_up, FacComputer_P.RateLimiterGenericVariableTs2_lo,
       FacComputer_U.in.time.dt, FacComputer_P.reset_Value_i, &rtb_Y_g4, &FacComputer_DWork.sf_RateLimiter_j);
     FacComputer_CalculateV_alpha_max(static_cast<real_T>(rtb_V_ias),
@@ -769,10 +779,10 @@ void FacComputer::step()
       rtb_Y_g4 = FacComputer_U.in.bus_inputs.fmgc_own_bus.fac_weight_lbs.Data;
     }
 
-    FacComputer_MATLABFunction2(look1_binlxpw(static_cast<real_T>(rtb_Switch_i_idx_0),
-      FacComputer_P.uDLookupTable3_bp01Data, FacComputer_P.uDLookupTable3_tableData, 5U), look1_binlxpw
-      (static_cast<real_T>(rtb_Switch_i_idx_0), FacComputer_P.uDLookupTable2_bp01Data,
-       FacComputer_P.uDLookupTable2_tableData, 5U), static_cast<real_T>(rtb_DataTypeConversion2), &rtb_Y_g4);
+    FacComputer_MATLABFunction2(intrp1d_l_pw(rtb_PrelookupMachConfig_o1[1U], rtb_PrelookupMachConfig_o2[1U],
+      FacComputer_P.uDLookupTable3_tableData), intrp1d_l_pw(rtb_PrelookupMachConfig_o1[1U],
+      rtb_PrelookupMachConfig_o2[1U], FacComputer_P.uDLookupTable2_tableData),
+      static_cast<real_T>(rtb_DataTypeConversion2), &rtb_Y_g4);
     FacComputer_RateLimiter_f(rtb_Y_g4, FacComputer_P.RateLimiterGenericVariableTs1_up_d,
       FacComputer_P.RateLimiterGenericVariableTs1_lo_f, FacComputer_U.in.time.dt,
       FacComputer_P.RateLimiterGenericVariableTs1_InitialCondition, FacComputer_P.reset_Value_k5, &rtb_Y_br,
@@ -791,8 +801,8 @@ void FacComputer::step()
     }
 
     if (rtb_alt >= FacComputer_P.CompareToConstant_const) {
-      bpIndices[0U] = plook_binx(static_cast<real_T>(rtb_DataTypeConversion2), FacComputer_P.uDLookupTable_bp01Data, 5U,
-        &rtb_Switch1);
+      bpIndices[0U] = plook_binxp(static_cast<real_T>(rtb_DataTypeConversion2), FacComputer_P.uDLookupTable_bp01Data,
+        5U, &rtb_Switch1, &FacComputer_DWork.uDLookupTable_m_bpIndex[0U]);
       fractions[0U] = rtb_Switch1;
       u0 = FacComputer_P.Gain_Gain * rtb_alt;
       if (u0 > FacComputer_P.Saturation2_UpperSat) {
@@ -801,7 +811,8 @@ void FacComputer::step()
         u0 = FacComputer_P.Saturation2_LowerSat;
       }
 
-      bpIndices[1U] = plook_binx(u0, FacComputer_P.uDLookupTable_bp02Data, 7U, &rtb_Switch1);
+      bpIndices[1U] = plook_binxp(u0, FacComputer_P.uDLookupTable_bp02Data, 7U, &rtb_Switch1,
+        &FacComputer_DWork.uDLookupTable_m_bpIndex[1U]);
       fractions[1U] = rtb_Switch1;
       if (FacComputer_P.Saturation3_UpperSat < 1.0) {
         u0 = FacComputer_P.Saturation3_UpperSat;
@@ -847,15 +858,17 @@ void FacComputer::step()
 
     rtb_Switch_b = look1_binlxpw(rtb_Y_g4, FacComputer_P.uDLookupTable_bp01Data_b,
       FacComputer_P.uDLookupTable_tableData_g, 1U) + rtb_Switch1;
-    FacComputer_MATLABFunction2(look1_binlxpw(FacComputer_P.Constant_Value_k, FacComputer_P.uDLookupTable6_bp01Data,
-      FacComputer_P.uDLookupTable6_tableData, 5U), look1_binlxpw(FacComputer_P.Constant_Value_k,
-      FacComputer_P.uDLookupTable5_bp01Data, FacComputer_P.uDLookupTable5_tableData, 5U), static_cast<real_T>
-      (rtb_DataTypeConversion2), &rtb_Switch1);
+    rtb_PrelookupConstant_o1 = plook_evenx(FacComputer_P.Constant_Value_k, FacComputer_P.uDLookupTable6_bp01Data, 1.0,
+      5U, &rtb_PrelookupConstant_o2);
+    FacComputer_MATLABFunction2(intrp1d_l_pw(rtb_PrelookupConstant_o1, rtb_PrelookupConstant_o2,
+      FacComputer_P.uDLookupTable6_tableData), intrp1d_l_pw(rtb_PrelookupConstant_o1, rtb_PrelookupConstant_o2,
+      FacComputer_P.uDLookupTable5_tableData), static_cast<real_T>(rtb_DataTypeConversion2), &rtb_Switch1);
     rtb_Switch1 = std::fmax(FacComputer_P.Gain1_Gain * rtb_Switch1, FacComputer_P.Vmcl_Value_a + FacComputer_P.Bias_Bias);
-    FacComputer_MATLABFunction2(look1_binlxpw(FacComputer_P.Constant1_Value_h, FacComputer_P.uDLookupTable8_bp01Data,
-      FacComputer_P.uDLookupTable8_tableData, 5U), look1_binlxpw(FacComputer_P.Constant1_Value_h,
-      FacComputer_P.uDLookupTable7_bp01Data, FacComputer_P.uDLookupTable7_tableData, 5U), static_cast<real_T>
-      (rtb_DataTypeConversion2), &rtb_Switch4_f);
+    rtb_PrelookupConstant1_o1 = plook_evenx(FacComputer_P.Constant1_Value_h, FacComputer_P.uDLookupTable8_bp01Data,
+      1.0, 5U, &rtb_PrelookupConstant1_o2);
+    FacComputer_MATLABFunction2(intrp1d_l_pw(rtb_PrelookupConstant1_o1, rtb_PrelookupConstant1_o2,
+      FacComputer_P.uDLookupTable8_tableData), intrp1d_l_pw(rtb_PrelookupConstant1_o1, rtb_PrelookupConstant1_o2,
+      FacComputer_P.uDLookupTable7_tableData), static_cast<real_T>(rtb_DataTypeConversion2), &rtb_Switch4_f);
     rtb_Switch4_f = std::fmax(FacComputer_P.Gain_Gain_o * rtb_Switch4_f, FacComputer_P.Vmcl_Value_a +
       FacComputer_P.Bias2_Bias);
     rtb_v_gd = (rtb_DataTypeConversion2 / 2205.0 * 0.6 + 106.0) + std::fmax(rtb_alt - 20000.0, 0.0) / 1000.0;
@@ -872,8 +885,8 @@ void FacComputer::step()
 
     rtb_Switch4_j = std::fmin(std::fmin(u0, std::sqrt(std::pow((std::pow(FacComputer_P.Constant1_Value_p *
       FacComputer_P.Constant1_Value_p * 0.2 + 1.0, 3.5) - 1.0) * (rtb_p_s_c / 1013.25) + 1.0, 0.2857142857142857) - 1.0)
-      * 1479.1), look1_binlxpw(static_cast<real_T>(rtb_Switch_i_idx_0), FacComputer_P.uDLookupTable_bp01Data_a,
-      FacComputer_P.uDLookupTable_tableData_a, 5U));
+      * 1479.1), intrp1d_l_pw(rtb_PrelookupMachConfig_o1[1U], rtb_PrelookupMachConfig_o2[1U],
+      FacComputer_P.uDLookupTable_tableData_a));
     if (rtb_V_ias > FacComputer_P.Saturation_UpperSat_j) {
       u0 = FacComputer_P.Saturation_UpperSat_j;
     } else if (rtb_V_ias < FacComputer_P.Saturation_LowerSat_c) {
@@ -893,8 +906,8 @@ void FacComputer::step()
     rtb_Switch_o = FacComputer_P.Gain_Gain_j * rtb_Y_g4;
     rtb_BusAssignment_f_flight_envelope_v_4_visible = ((rtb_Switch_i_idx_0 == FacComputer_P.CompareToConstant3_const) ||
       (rtb_Switch_i_idx_0 == FacComputer_P.CompareToConstant1_const));
-    rtb_BusAssignment_f_flight_envelope_v_fe_next_kn = look1_binlxpw(static_cast<real_T>(rtb_Switch_i_idx_0),
-      FacComputer_P.uDLookupTable1_bp01Data, FacComputer_P.uDLookupTable1_tableData, 5U);
+    rtb_BusAssignment_f_flight_envelope_v_fe_next_kn = intrp1d_l_pw(rtb_PrelookupMachConfig_o1[1U],
+      rtb_PrelookupMachConfig_o2[1U], FacComputer_P.uDLookupTable1_tableData);
     rtb_y_ool = (FacComputer_U.in.discrete_inputs.ap_own_engaged || FacComputer_U.in.discrete_inputs.ap_opp_engaged);
     rtb_AND = (FacComputer_U.in.discrete_inputs.rudder_trim_reset_button && (!rtb_y_ool));
     if (!FacComputer_DWork.previousInput_not_empty) {
@@ -1016,8 +1029,8 @@ void FacComputer::step()
       FacComputer_P.RateLimiterGenericVariableTs_lo_f, FacComputer_U.in.time.dt,
       FacComputer_U.in.analog_inputs.yaw_damper_position_deg, !rtb_yawDamperEngaged, &rtb_Y_br,
       &FacComputer_DWork.sf_RateLimiter_fu);
-    u0 = look1_binlxpw(static_cast<real_T>(rtb_V_ias), FacComputer_P.uDLookupTable_bp01Data_i,
-                       FacComputer_P.uDLookupTable_tableData_j, 6U);
+    u0 = look1_pbinlxpw(static_cast<real_T>(rtb_V_ias), FacComputer_P.uDLookupTable_bp01Data_i,
+      FacComputer_P.uDLookupTable_tableData_j, &FacComputer_DWork.uDLookupTable_m_bpIndex_j, 6U);
     if (u0 > FacComputer_P.Saturation_UpperSat_g) {
       u0 = FacComputer_P.Saturation_UpperSat_g;
     } else if (u0 < FacComputer_P.Saturation_LowerSat_f) {
@@ -1379,11 +1392,4 @@ void FacComputer::terminate()
 {
 }
 
-FacComputer::FacComputer():
-  FacComputer_U(),
-  FacComputer_Y(),
-  FacComputer_DWork()
-{
-}
-
 FacComputer::~FacComputer() = default;
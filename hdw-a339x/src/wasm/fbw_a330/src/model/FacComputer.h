@@ -48,6 +48,9 @@ class FacComputer final
     real_T pU;
     real_T takeoff_config;
     real_T sAlphaFloor;
+    uint32_T PrelookupMachConfig_m_bpIndex;
+    uint32_T uDLookupTable_m_bpIndex[2];
+    uint32_T uDLookupTable_m_bpIndex_j;
     uint8_T is_active_c15_FacComputer;
     uint8_T is_c15_FacComputer;
     boolean_T Memory_PreviousInput;
@@ -89,9 +92,6 @@ class FacComputer final
   };
 
   struct Parameters_FacComputer_T {
-    base_fac_analog_outputs fac_analog_output_MATLABStruct;
-    base_fac_laws_outputs fac_laws_output_MATLABStruct;
-    base_fac_discrete_outputs fac_discrete_output_MATLABStruct;
     real_T LagFilter1_C1;
     real_T LagFilter1_C1_d;
     real_T LagFilter2_C1;
@@ -178,18 +178,12 @@ class FacComputer final
     SignStatusMatrix EnumeratedConstant1_Value;
     SignStatusMatrix EnumeratedConstant_Value;
     SignStatusMatrix EnumeratedConstant2_Value;
-    real32_T CompareToConstant_const_f;
-    real32_T CompareToConstant1_const_l;
-    real32_T CompareToConstant2_const_i;
     boolean_T SRFlipFlop_initial_condition;
     boolean_T ConfirmNode_isRisingEdge;
     boolean_T ConfirmNode_isRisingEdge_a;
     boolean_T ConfirmNode_isRisingEdge_o;
     boolean_T PulseNode_isRisingEdge;
     fac_outputs out_Y0;
-    base_fac_bus Constant4_Value;
-    base_fac_flight_envelope_outputs Constant5_Value;
-    base_fac_logic_outputs Constant1_Value;
     real_T Constant_Value;
     real_T Constant2_Value;
     real_T Constant3_Value;
@@ -221,22 +215,13 @@ class FacComputer final
     real_T Gain_Gain_k;
     real_T alphafloor_tableData[24];
     real_T alphafloor_bp01Data[4];
-    real_T alphafloor_bp02Data[6];
     real_T alpha0_tableData[6];
     real_T alpha0_bp01Data[6];
     real_T alphamax_tableData[24];
-    real_T alphamax_bp01Data[4];
-    real_T alphamax_bp02Data[6];
     real_T alphaprotection_tableData[24];
-    real_T alphaprotection_bp01Data[4];
-    real_T alphaprotection_bp02Data[6];
     real_T alphastallwarn_tableData[24];
-    real_T alphastallwarn_bp01Data[4];
-    real_T alphastallwarn_bp02Data[6];
     real_T uDLookupTable3_tableData[6];
-    real_T uDLookupTable3_bp01Data[6];
     real_T uDLookupTable2_tableData[6];
-    real_T uDLookupTable2_bp01Data[6];
     real_T Saturation_UpperSat_o;
     real_T Saturation_LowerSat_b;
     real_T uDLookupTable_tableData_g[2];
@@ -246,21 +231,17 @@ class FacComputer final
     real_T Bias_Bias;
     real_T Constant_Value_k;
     real_T uDLookupTable5_tableData[6];
-    real_T uDLookupTable5_bp01Data[6];
     real_T uDLookupTable6_tableData[6];
     real_T uDLookupTable6_bp01Data[6];
     real_T Gain1_Gain;
     real_T Bias2_Bias;
     real_T Constant1_Value_h;
     real_T uDLookupTable7_tableData[6];
-    real_T uDLookupTable7_bp01Data[6];
     real_T uDLookupTable8_tableData[6];
     real_T uDLookupTable8_bp01Data[6];
     real_T Gain_Gain_o;
     real_T uDLookupTable1_tableData[6];
-    real_T uDLookupTable1_bp01Data[6];
     real_T uDLookupTable_tableData_a[6];
-    real_T uDLookupTable_bp01Data_a[6];
     real_T Constant1_Value_p;
     real_T Saturation_UpperSat_j;
     real_T Saturation_LowerSat_c;
@@ -286,12 +267,7 @@ class FacComputer final
     real32_T Constant21_Value;
     real32_T Constant4_Value_b;
     real32_T Constant26_Value;
-    uint32_T uDLookupTable_maxIndex[3];
     uint32_T uDLookupTable_dimSizes[3];
-    uint32_T alphafloor_maxIndex[2];
-    uint32_T alphamax_maxIndex[2];
-    uint32_T alphaprotection_maxIndex[2];
-    uint32_T alphastallwarn_maxIndex[2];
     boolean_T Constant_Value_c;
     boolean_T Constant_Value_h;
     boolean_T Constant_Value_b5;
@@ -321,6 +297,11 @@ class FacComputer final
     FacComputer_U = *pExternalInputs_FacComputer_T;
   }
 
+  ExternalInputs_FacComputer_T &getExternalInputs()
+  {
+    return FacComputer_U;
+  }
+
   const ExternalOutputs_FacComputer_T &getExternalOutputs() const
   {
     return FacComputer_Y;
@@ -335,7 +316,7 @@ class FacComputer final
   ExternalInputs_FacComputer_T FacComputer_U;
   ExternalOutputs_FacComputer_T FacComputer_Y;
   D_Work_FacComputer_T FacComputer_DWork;
-  static Parameters_FacComputer_T FacComputer_P;
+  static const Parameters_FacComputer_T FacComputer_P;
   static void FacComputer_MATLABFunction(const base_arinc_429 *rtu_u, boolean_T *rty_y);
   static void FacComputer_MATLABFunction_g(const base_arinc_429 *rtu_u, real_T rtu_bit, uint32_T *rty_y);
   static void FacComputer_LagFilter_Reset(rtDW_LagFilter_FacComputer_T *localDW);
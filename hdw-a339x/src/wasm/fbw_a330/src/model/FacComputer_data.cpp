@@ -1,26 +1,7 @@
 #include "FacComputer.h"
+#include "plook_evenx.h"
 
-FacComputer::Parameters_FacComputer_T FacComputer::FacComputer_P{
-  {
-    0.0,
-    0.0,
-    0.0
-  },
-
-  {
-    0.0,
-    0.0,
-    0.0
-  },
-
-  {
-    false,
-    false,
-    false,
-    false,
-    false,
-    false
-  },
+constexpr FacComputer::Parameters_FacComputer_T FacComputer::FacComputer_P{
   4.0,
   0.5,
   0.5,
@@ -107,9 +88,6 @@ FacComputer::Parameters_FacComputer_T FacComputer::FacComputer_P{
   SignStatusMatrix::NormalOperation,
   SignStatusMatrix::NoComputedData,
   SignStatusMatrix::FailureWarning,
-  35.0F,
-  80.0F,
-  80.0F,
   false,
   false,
   false,
@@ -1552,225 +1530,6 @@ FacComputer::Parameters_FacComputer_T FacComputer::FacComputer_P{
       }
     }
   },
-
-  {
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    }
-  },
-
-  {
-    0.0,
-    0.0,
-    false,
-    false,
-    0.0,
-    0.0,
-    0.0,
-    0.0,
-    0.0,
-    0.0,
-    0.0,
-    0.0,
-    0.0,
-    false,
-    0.0,
-    false,
-    0.0,
-    false,
-    0.0,
-    0.0,
-    false,
-    0.0
-  },
-
-  {
-    false,
-    false,
-    false,
-    false,
-    false,
-    false,
-    false,
-    0.0F,
-    0.0F,
-    0.0F,
-    0.0F,
-    false,
-    false,
-    false,
-    false,
-    false,
-    false,
-
-    {
-      0.0,
-      0.0,
-      0.0,
-      0.0,
-      0.0,
-      0.0
-    },
-
-    {
-      0.0,
-      0.0,
-      0.0,
-      0.0,
-      0.0,
-      0.0,
-      0.0,
-      0.0,
-      0.0
-    },
-    false,
-    false,
-    false,
-    false,
-    false,
-    false,
-    false,
-    false,
-    false,
-    false,
-    false
-  },
   200.0,
   250.0,
   330.0,
@@ -1827,8 +1586,6 @@ FacComputer::Parameters_FacComputer_T FacComputer::FacComputer_P{
 
   { 0.0, 0.5, 0.9, 1.0 },
 
-  { 0.0, 1.0, 2.0, 3.0, 4.0, 5.0 },
-
   { -1.84, -1.84, -2.18, -4.72, -4.27, -6.94 },
 
   { 0.0, 1.0, 2.0, 3.0, 4.0, 5.0 },
@@ -1836,31 +1593,15 @@ FacComputer::Parameters_FacComputer_T FacComputer::FacComputer_P{
   { 8.7, 8.7, 6.4, 6.4, 13.6, 13.6, 13.6, 13.6, 13.6, 13.6, 13.6, 13.6, 14.2, 14.2, 14.2, 14.2, 13.1, 13.1, 13.1, 13.1,
     13.0, 13.0, 13.0, 13.0 },
 
-  { 0.0, 0.5, 0.9, 1.0 },
-
-  { 0.0, 1.0, 2.0, 3.0, 4.0, 5.0 },
-
   { 6.5, 6.5, 4.6, 4.6, 11.7, 11.7, 11.7, 11.7, 11.7, 11.7, 11.7, 11.7, 11.9, 11.9, 11.9, 11.9, 11.0, 11.0, 11.0, 11.0,
     10.6, 10.6, 10.6, 10.6 },
 
-  { 0.0, 0.5, 0.9, 1.0 },
-
-  { 0.0, 1.0, 2.0, 3.0, 4.0, 5.0 },
-
   { 6.5, 6.5, 4.6, 4.6, 11.7, 11.7, 11.7, 11.7, 11.7, 11.7, 11.7, 11.7, 11.9, 11.9, 11.9, 11.9, 11.0, 11.0, 11.0, 11.0,
     10.6, 10.6, 10.6, 10.6 },
 
-  { 0.0, 0.5, 0.9, 1.0 },
-
-  { 0.0, 1.0, 2.0, 3.0, 4.0, 5.0 },
-
   { 118.2, 111.65, 103.18, 105.53, 104.15, 94.96 },
 
-  { 0.0, 1.0, 2.0, 3.0, 4.0, 5.0 },
-
   { 0.362, 0.344, 0.285, 0.281, 0.243, 0.228 },
-
-  { 0.0, 1.0, 2.0, 3.0, 4.0, 5.0 },
   0.0,
   -40.0,
 
@@ -1877,8 +1618,6 @@ FacComputer::Parameters_FacComputer_T FacComputer::FacComputer_P{
 
   { 0.362, 0.344, 0.285, 0.281, 0.243, 0.228 },
 
-  { 0.0, 1.0, 2.0, 3.0, 4.0, 5.0 },
-
   { 118.2, 111.65, 103.18, 105.53, 104.15, 94.96 },
 
   { 0.0, 1.0, 2.0, 3.0, 4.0, 5.0 },
@@ -1888,8 +1627,6 @@ FacComputer::Parameters_FacComputer_T FacComputer::FacComputer_P{
 
   { 0.362, 0.344, 0.285, 0.281, 0.243, 0.228 },
 
-  { 0.0, 1.0, 2.0, 3.0, 4.0, 5.0 },
-
   { 118.2, 111.65, 103.18, 105.53, 104.15, 94.96 },
 
   { 0.0, 1.0, 2.0, 3.0, 4.0, 5.0 },
@@ -1897,11 +1634,7 @@ FacComputer::Parameters_FacComputer_T FacComputer::FacComputer_P{
 
   { 240.0, 196.0, 196.0, 186.0, 180.0, 180.0 },
 
-  { 0.0, 1.0, 2.0, 3.0, 4.0, 5.0 },
-
   { 330.0, 240.0, 215.0, 196.0, 186.0, 180.0 },
-
-  { 0.0, 1.0, 2.0, 3.0, 4.0, 5.0 },
   0.86,
   660.0,
   30.0,
@@ -1929,16 +1662,7 @@ FacComputer::Parameters_FacComputer_T FacComputer::FacComputer_P{
   0.0F,
   0.0F,
   0.0F,
-
-  { 5U, 7U, 2U },
   { 1U, 6U, 48U },
-  { 3U, 5U },
-
-  { 3U, 5U },
-
-  { 3U, 5U },
-
-  { 3U, 5U },
 
   false,
   false,
@@ -1960,3 +1684,13 @@ FacComputer::Parameters_FacComputer_T FacComputer::FacComputer_P{
   false,
   false
 };
+
+FacComputer::FacComputer():
+  FacComputer_U(),
+  FacComputer_Y(),
+  FacComputer_DWork()
+{
+  static_assert(plook_evenx_bpSpaceInv_matches(FacComputer_P.alpha0_bp01Data, 1.0, 5U));
+  static_assert(plook_evenx_bpSpaceInv_matches(FacComputer_P.uDLookupTable6_bp01Data, 1.0, 5U));
+  static_assert(plook_evenx_bpSpaceInv_matches(FacComputer_P.uDLookupTable8_bp01Data, 1.0, 5U));
+}
@@ -41,8 +41,6 @@ class FadecComputer final
   };
 
   struct Parameters_FadecComputer_T {
-    athr_output athr_output_MATLABStruct;
-    athr_data_computed athr_data_computed_MATLABStruct;
     real_T DiscreteTimeIntegratorVariableTs_Gain;
     real_T DiscreteTimeIntegratorVariableTs_Gain_l;
     real_T DiscreteTimeIntegratorVariableTs1_Gain;
@@ -76,7 +74,6 @@ class FadecComputer final
     boolean_T SRFlipFlop1_initial_condition;
     boolean_T PulseNode_isRisingEdge;
     boolean_T PulseNode1_isRisingEdge;
-    base_ecu_bus Constant2_Value;
     real_T Gain_Gain;
     real_T Gain_Gain_d;
     real_T Gain1_Gain;
@@ -112,7 +109,7 @@ class FadecComputer final
   ExternalInputs_FadecComputer_T FadecComputer_U;
   ExternalOutputs_FadecComputer_T FadecComputer_Y;
   D_Work_FadecComputer_T FadecComputer_DWork;
-  static Parameters_FadecComputer_T FadecComputer_P;
+  static const Parameters_FadecComputer_T FadecComputer_P;
   static void FadecComputer_MATLABFunction(const base_arinc_429 *rtu_u, boolean_T *rty_y);
   static void FadecComputer_MATLABFunction_p(const base_arinc_429 *rtu_u, real32_T rtu_default, real32_T *rty_y);
   static void FadecComputer_TimeSinceCondition(real_T rtu_time, boolean_T rtu_condition, real_T *rty_y,
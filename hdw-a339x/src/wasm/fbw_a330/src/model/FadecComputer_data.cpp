@@ -1,26 +1,6 @@
 #include "FadecComputer.h"
 
-FadecComputer::Parameters_FadecComputer_T FadecComputer::FadecComputer_P{
-
-  {
-    0.0,
-    0.0,
-    0.0,
-    false,
-    athr_thrust_limit_type::NONE,
-    0.0,
-    0.0,
-    false,
-    false
-  },
-
-
-  {
-    false,
-    false,
-    false,
-    0.0
-  },
+const FadecComputer::Parameters_FadecComputer_T FadecComputer::FadecComputer_P{
 
   1.0,
 
@@ -88,69 +68,6 @@ FadecComputer::Parameters_FadecComputer_T FadecComputer::FadecComputer_P{
 
   true,
 
-
-  {
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    }
-  },
-
   0.3,
 
   5.0,
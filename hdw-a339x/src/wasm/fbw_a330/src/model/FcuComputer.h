@@ -364,6 +364,11 @@ class FcuComputer final
     FcuComputer_U = *pExternalInputs_FcuComputer_T;
   }
 
+  ExternalInputs_FcuComputer_T &getExternalInputs()
+  {
+    return FcuComputer_U;
+  }
+
   const ExternalOutputs_FcuComputer_T &getExternalOutputs() const
   {
     return FcuComputer_Y;
@@ -378,7 +383,7 @@ class FcuComputer final
   ExternalInputs_FcuComputer_T FcuComputer_U;
   ExternalOutputs_FcuComputer_T FcuComputer_Y;
   D_Work_FcuComputer_T FcuComputer_DWork;
-  static Parameters_FcuComputer_T FcuComputer_P;
+  static const Parameters_FcuComputer_T FcuComputer_P;
   static void FcuComputer_MATLABFunction_Reset(rtDW_MATLABFunction_FcuComputer_T *localDW);
   static void FcuComputer_MATLABFunction(boolean_T rtu_u, real_T rtu_Ts, boolean_T *rty_y, real_T rtp_isRisingEdge,
     real_T rtp_retriggerable, real_T rtp_triggerDuration, rtDW_MATLABFunction_FcuComputer_T *localDW);
@@ -1,6 +1,6 @@
 #include "FcuComputer.h"
 
-FcuComputer::Parameters_FcuComputer_T FcuComputer::FcuComputer_P{
+const FcuComputer::Parameters_FcuComputer_T FcuComputer::FcuComputer_P{
 
   15.0,
 
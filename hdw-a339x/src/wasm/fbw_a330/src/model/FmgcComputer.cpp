@@ -1,5 +1,6 @@
 #include "FmgcComputer.h"
 #include "FmgcComputer_types.h"
+#include "look1_pbinlxpw.h"
 #include "rtwtypes.h"
 #include <cmath>
 #include "look1_iflf_binlxpw.h"
@@ -4060,9 +4061,10 @@ void FmgcComputer::step()
     } else if (FmgcComputer_DWork.Memory_PreviousInput_cm) {
       rtb_Switch1_a = ((FmgcComputer_P.Gain_Gain * rtb_DataTypeConversion8 + FmgcComputer_DWork.pY_n) +
                        (FmgcComputer_P.Gain1_Gain_g * rtb_Cos_h + FmgcComputer_P.Gain3_Gain_k * FmgcComputer_DWork.pY_e))
-        * look1_binlxpw(FmgcComputer_DWork.Delay_DSTATE_l, FmgcComputer_P.ScheduledGain2_BreakpointsForDimension1,
-                        FmgcComputer_P.ScheduledGain2_Table, 3U) * look1_binlxpw(FmgcComputer_DWork.pY,
-        FmgcComputer_P.ScheduledGain4_BreakpointsForDimension1, FmgcComputer_P.ScheduledGain4_Table, 1U);
+        * look1_pbinlxpw(FmgcComputer_DWork.Delay_DSTATE_l, FmgcComputer_P.ScheduledGain2_BreakpointsForDimension1,
+                         FmgcComputer_P.ScheduledGain2_Table, &FmgcComputer_DWork.ScheduledGain2_m_bpIndex, 3U) *
+        look1_binlxpw(FmgcComputer_DWork.pY, FmgcComputer_P.ScheduledGain4_BreakpointsForDimension1,
+                      FmgcComputer_P.ScheduledGain4_Table, 1U);
       if (rtb_Switch1_a > FmgcComputer_P.Saturation1_UpperSat) {
         rtb_Switch1_a = FmgcComputer_P.Saturation1_UpperSat;
       } else if (rtb_Switch1_a < FmgcComputer_P.Saturation1_LowerSat) {
@@ -4,10 +4,7 @@
 #include "FmgcComputer_types.h"
 #include "FmgcOuterLoops.h"
 
-extern base_fmgc_ap_fd_logic_outputs rtP_fmgc_ap_fd_logic_output_MATLABStruct;
-extern ap_raw_output rtP_fmgc_ap_fd_outer_loops_output_MATLABStruct;
-extern base_fmgc_athr_outputs rtP_fmgc_athr_output_MATLABStruct;
-extern base_fmgc_discrete_outputs rtP_fmgc_discrete_output_MATLABStruct;
+extern const base_fmgc_ap_fd_logic_outputs rtP_fmgc_ap_fd_logic_output_MATLABStruct;
 class FmgcComputer final
 {
  public:
@@ -69,6 +66,7 @@ class FmgcComputer final
     real32_T DelayInput1_DSTATE_b;
     real32_T pY_e;
     real32_T pU_e;
+    uint32_T ScheduledGain2_m_bpIndex;
     boolean_T Delay_DSTATE_p;
     boolean_T Delay_DSTATE_k;
     boolean_T Delay_DSTATE_o;
@@ -1014,7 +1012,6 @@ class FmgcComputer final
     int8_T CompareToConstant_const_ja;
     fmgc_outputs out_Y0;
     base_fmgc_logic_outputs Constant1_Value;
-    base_fmgc_bus_outputs Constant4_Value;
     base_fmgc_ap_fd_logic_outputs Delay_InitialCondition;
     ap_raw_output Delay2_InitialCondition;
     base_fmgc_athr_outputs Delay1_InitialCondition;
@@ -1172,6 +1169,11 @@ class FmgcComputer final
     FmgcComputer_U = *pExternalInputs_FmgcComputer_T;
   }
 
+  ExternalInputs_FmgcComputer_T &getExternalInputs()
+  {
+    return FmgcComputer_U;
+  }
+
   const ExternalOutputs_FmgcComputer_T &getExternalOutputs() const
   {
     return FmgcComputer_Y;
@@ -1187,7 +1189,7 @@ class FmgcComputer final
   ExternalOutputs_FmgcComputer_T FmgcComputer_Y;
   BlockIO_FmgcComputer_T FmgcComputer_B;
   D_Work_FmgcComputer_T FmgcComputer_DWork;
-  static Parameters_FmgcComputer_T FmgcComputer_P;
+  static const Parameters_FmgcComputer_T FmgcComputer_P;
   static void FmgcComputer_MATLABFunction(const base_arinc_429 *rtu_u, real32_T rtu_default, real32_T *rty_y);
   static void FmgcComputer_MATLABFunction_j_Reset(rtDW_MATLABFunction_FmgcComputer_k_T *localDW);
   static void FmgcComputer_MATLABFunction_a(boolean_T rtu_u, real_T rtu_Ts, boolean_T rtu_isRisingEdge, real_T
@@ -1,4 +1,5 @@
 #include "FmgcOuterLoops.h"
+#include "look1_pbinlxpw.h"
 #include "rtwtypes.h"
 #include "FmgcOuterLoops_types.h"
 #include <cmath>
@@ -21,7 +22,7 @@ const uint8_T FmgcOuterLoops_IN_left_n{ 2U };
 
 const uint8_T FmgcOuterLoops_IN_right_n{ 3U };
 
-FmgcOuterLoops::Parameters_FmgcOuterLoops_T FmgcOuterLoops::FmgcOuterLoops_rtP{
+const FmgcOuterLoops::Parameters_FmgcOuterLoops_T FmgcOuterLoops::FmgcOuterLoops_rtP{
 
   { 100.0, 150.0, 200.0, 250.0, 300.0, 400.0, 500.0 },
 
@@ -2327,8 +2328,8 @@ void FmgcOuterLoops::step(const real_T *rtu_in_time_dt, const real_T *rtu_in_tim
     rtb_Sum1, FmgcOuterLoops_rtP.Constant3_Value_l), (rtb_Compare_ny != rtb_Delay_d), &rtb_out_ex,
                        &FmgcOuterLoops_DWork.sf_Chart);
   rtb_Sum1 = FmgcOuterLoops_rtP.Gain_Gain_k * *rtu_in_data_rk_deg_s;
-  rtb_MaxH_dot_RA = look1_binlxpw(*rtu_in_data_V_tas_kn, FmgcOuterLoops_rtP.ScheduledGain_BreakpointsForDimension1,
-    FmgcOuterLoops_rtP.ScheduledGain_Table, 6U);
+  rtb_MaxH_dot_RA = look1_pbinlxpw(*rtu_in_data_V_tas_kn, FmgcOuterLoops_rtP.ScheduledGain_BreakpointsForDimension1,
+    FmgcOuterLoops_rtP.ScheduledGain_Table, &FmgcOuterLoops_DWork.ScheduledGain_m_bpIndex, 6U);
   rtb_Sum_iv = rtb_out_ex * rtb_MaxH_dot_RA * FmgcOuterLoops_rtP.Gain1_Gain_m + rtb_Sum1;
   FmgcOuterLoops_MATLABFunction_g(rtu_in_input_Psi_c_deg, rtb_out_ex, rtb_Sum_iv, &rtb_Y_f2, &rtb_lo_d,
     &FmgcOuterLoops_DWork.sf_MATLABFunction_g);
@@ -2400,12 +2401,13 @@ void FmgcOuterLoops::step(const real_T *rtu_in_time_dt, const real_T *rtu_in_tim
   external_limit = (FmgcOuterLoops_DWork.Delay_DSTATE - rtb_Mod1_ds) / *rtu_in_time_dt;
   FmgcOuterLoops_LagFilter(rtb_Sum1 + FmgcOuterLoops_rtP.Gain3_Gain_o * external_limit,
     FmgcOuterLoops_rtP.LagFilter_C1_o, rtu_in_time_dt, &rtb_Y_o, &FmgcOuterLoops_DWork.sf_LagFilter_m);
-  rtb_Mod2 = look1_binlxpw(*rtu_in_data_V_tas_kn, FmgcOuterLoops_rtP.ScheduledGain2_BreakpointsForDimension1,
-    FmgcOuterLoops_rtP.ScheduledGain2_Table, 6U);
-  rtb_Mod2_e = look1_binlxpw(*rtu_in_data_H_radio_ft, FmgcOuterLoops_rtP.ScheduledGain_BreakpointsForDimension1_f,
-    FmgcOuterLoops_rtP.ScheduledGain_Table_e, 5U);
-  rtb_uDLookupTable_a = look1_binlxpw(*rtu_in_data_H_radio_ft,
-    FmgcOuterLoops_rtP.ScheduledGain1_BreakpointsForDimension1, FmgcOuterLoops_rtP.ScheduledGain1_Table, 4U);
+  rtb_Mod2 = look1_pbinlxpw(*rtu_in_data_V_tas_kn, FmgcOuterLoops_rtP.ScheduledGain2_BreakpointsForDimension1,
+    FmgcOuterLoops_rtP.ScheduledGain2_Table, &FmgcOuterLoops_DWork.ScheduledGain2_m_bpIndex, 6U);
+  rtb_Mod2_e = look1_pbinlxpw(*rtu_in_data_H_radio_ft, FmgcOuterLoops_rtP.ScheduledGain_BreakpointsForDimension1_f,
+    FmgcOuterLoops_rtP.ScheduledGain_Table_e, &FmgcOuterLoops_DWork.ScheduledGain_m_bpIndex_e, 5U);
+  rtb_uDLookupTable_a = look1_pbinlxpw(*rtu_in_data_H_radio_ft,
+    FmgcOuterLoops_rtP.ScheduledGain1_BreakpointsForDimension1, FmgcOuterLoops_rtP.ScheduledGain1_Table,
+    &FmgcOuterLoops_DWork.ScheduledGain1_m_bpIndex, 4U);
   rtb_Delay_d = (*rtu_in_data_H_radio_ft <= FmgcOuterLoops_rtP.CompareToConstant_const);
   rtb_Sum1 = *rtu_in_data_Psi_true_deg + FmgcOuterLoops_rtP.Constant3_Value_m;
   rtb_Sum1 = rt_modd((rtb_Mod2_l - rtb_Sum1) + FmgcOuterLoops_rtP.Constant3_Value_m,
@@ -2428,8 +2430,9 @@ void FmgcOuterLoops::step(const real_T *rtu_in_time_dt, const real_T *rtu_in_tim
     rtb_Sum1 = FmgcOuterLoops_rtP.Saturation_LowerSat_o;
   }
 
-  rtb_uDLookupTable_e = look1_binlxpw(*rtu_in_data_H_radio_ft,
-    FmgcOuterLoops_rtP.ScheduledGain3_BreakpointsForDimension1, FmgcOuterLoops_rtP.ScheduledGain3_Table, 5U);
+  rtb_uDLookupTable_e = look1_pbinlxpw(*rtu_in_data_H_radio_ft,
+    FmgcOuterLoops_rtP.ScheduledGain3_BreakpointsForDimension1, FmgcOuterLoops_rtP.ScheduledGain3_Table,
+    &FmgcOuterLoops_DWork.ScheduledGain3_m_bpIndex, 5U);
   FmgcOuterLoops_RateLimiter((rtb_ManualSwitch == FmgcOuterLoops_rtP.CompareToConstant1_const),
     FmgcOuterLoops_rtP.RateLimiterVariableTs_up_m, FmgcOuterLoops_rtP.RateLimiterVariableTs_lo_f, rtu_in_time_dt,
     FmgcOuterLoops_rtP.RateLimiterVariableTs_InitialCondition_j, &rtb_Y_j, &FmgcOuterLoops_DWork.sf_RateLimiter_e);
@@ -2460,8 +2463,8 @@ void FmgcOuterLoops::step(const real_T *rtu_in_time_dt, const real_T *rtu_in_tim
   FmgcOuterLoops_Chart(external_limit, FmgcOuterLoops_rtP.Gain_Gain_o0 * rt_modd(FmgcOuterLoops_rtP.Constant3_Value_d -
     external_limit, FmgcOuterLoops_rtP.Constant3_Value_d), (rtb_Delay_d != rtb_Delay_l), &rtb_out,
                        &FmgcOuterLoops_DWork.sf_Chart_b);
-  rtb_Mod1_ds = look1_binlxpw(*rtu_in_data_V_tas_kn, FmgcOuterLoops_rtP.ScheduledGain_BreakpointsForDimension1_k,
-    FmgcOuterLoops_rtP.ScheduledGain_Table_a, 6U);
+  rtb_Mod1_ds = look1_pbinlxpw(*rtu_in_data_V_tas_kn, FmgcOuterLoops_rtP.ScheduledGain_BreakpointsForDimension1_k,
+    FmgcOuterLoops_rtP.ScheduledGain_Table_a, &FmgcOuterLoops_DWork.ScheduledGain_m_bpIndex_a, 6U);
   external_limit = FmgcOuterLoops_rtP.Gain_Gain_c * *rtu_in_data_rk_deg_s;
   rtb_Mod1_ds = rtb_out * rtb_Mod1_ds * FmgcOuterLoops_rtP.Gain1_Gain_or + external_limit;
   FmgcOuterLoops_MATLABFunction_g(rtu_in_input_Chi_c_deg, rtb_out, rtb_Mod1_ds, &external_limit, &rtb_lo,
@@ -3166,8 +3169,8 @@ void FmgcOuterLoops::step(const real_T *rtu_in_time_dt, const real_T *rtu_in_tim
   FmgcOuterLoops_WashoutFilter_b(rtu_in_data_bx_m_s2, FmgcOuterLoops_rtP.WashoutFilter_C1_e, rtu_in_time_dt, &rtb_Sum1,
     &FmgcOuterLoops_DWork.sf_WashoutFilter_b);
   *rty_out_flare_law_delta_Theta_bz_deg = FmgcOuterLoops_rtP.Gain5_Gain_m * *rtu_in_data_bz_m_s2;
-  rtb_Sum_iv = look1_binlxpw(*rtu_in_data_total_weight_kg, FmgcOuterLoops_rtP.uDLookupTable_bp01Data,
-    FmgcOuterLoops_rtP.uDLookupTable_tableData, 3U);
+  rtb_Sum_iv = look1_pbinlxpw(*rtu_in_data_total_weight_kg, FmgcOuterLoops_rtP.uDLookupTable_bp01Data,
+    FmgcOuterLoops_rtP.uDLookupTable_tableData, &FmgcOuterLoops_DWork.uDLookupTable_m_bpIndex, 3U);
   rtb_Compare_ck = (rtb_ManualSwitch == FmgcOuterLoops_rtP.CompareToConstant7_const);
   FmgcOuterLoops_LagFilter_i(rtu_in_data_H_dot_ft_min, FmgcOuterLoops_rtP.LagFilterH_C1, rtu_in_time_dt, &external_limit,
     &FmgcOuterLoops_DWork.sf_LagFilter_or);
@@ -3550,8 +3553,8 @@ void FmgcOuterLoops::step(const real_T *rtu_in_time_dt, const real_T *rtu_in_tim
      FmgcOuterLoops_rtP.Constant_Value_ah, &rtb_lo, &rtb_uDLookupTable_e);
   FmgcOuterLoops_LagFilter_i(rtu_in_data_nav_gs_error_deg, FmgcOuterLoops_rtP.LagFilter1_C1_l, rtu_in_time_dt, &rtb_Y_f2,
     &FmgcOuterLoops_DWork.sf_LagFilter_f5);
-  rtb_Sum1_pc = look1_binlxpw(*rtu_in_data_H_radio_ft, FmgcOuterLoops_rtP.ScheduledGain_BreakpointsForDimension1_h,
-    FmgcOuterLoops_rtP.ScheduledGain_Table_j, 7U);
+  rtb_Sum1_pc = look1_pbinlxpw(*rtu_in_data_H_radio_ft, FmgcOuterLoops_rtP.ScheduledGain_BreakpointsForDimension1_h,
+    FmgcOuterLoops_rtP.ScheduledGain_Table_j, &FmgcOuterLoops_DWork.ScheduledGain_m_bpIndex_j, 7U);
   rtb_Product_or = rtb_Y_f2 * rtb_Sum1_pc;
   rtb_Sum1_pc = FmgcOuterLoops_rtP.Gain2_Gain_p * *rtu_in_data_H_dot_ft_min;
   rtb_Mod2_l = FmgcOuterLoops_rtP.DiscreteDerivativeVariableTs1_Gain * rtb_Sum1_pc;
@@ -3584,12 +3587,12 @@ void FmgcOuterLoops::step(const real_T *rtu_in_time_dt, const real_T *rtu_in_tim
   rtb_Mod1_ds = FmgcOuterLoops_DWork.Delay_DSTATE_l;
   FmgcOuterLoops_DWork.Delay_DSTATE_l = FmgcOuterLoops_rtP.DiscreteDerivativeVariableTs_Gain_k * rtb_Y_o;
   rtb_Gain1_c4 = (FmgcOuterLoops_DWork.Delay_DSTATE_l - rtb_Mod1_ds) / *rtu_in_time_dt;
-  rtb_Mod1_ds = look1_binlxpw(*rtu_in_data_H_radio_ft, FmgcOuterLoops_rtP.ScheduledGain3_BreakpointsForDimension1_j,
-    FmgcOuterLoops_rtP.ScheduledGain3_Table_b, 4U);
+  rtb_Mod1_ds = look1_pbinlxpw(*rtu_in_data_H_radio_ft, FmgcOuterLoops_rtP.ScheduledGain3_BreakpointsForDimension1_j,
+    FmgcOuterLoops_rtP.ScheduledGain3_Table_b, &FmgcOuterLoops_DWork.ScheduledGain3_m_bpIndex_b, 4U);
   FmgcOuterLoops_LagFilter(rtb_Y_o + rtb_Gain1_c4 * rtb_Mod1_ds, FmgcOuterLoops_rtP.LagFilter_C1_b, rtu_in_time_dt,
     &rtb_Y_f2, &FmgcOuterLoops_DWork.sf_LagFilter_k);
-  rtb_Mod1_ds = look1_binlxpw(*rtu_in_data_H_radio_ft, FmgcOuterLoops_rtP.ScheduledGain2_BreakpointsForDimension1_f,
-    FmgcOuterLoops_rtP.ScheduledGain2_Table_j, 7U);
+  rtb_Mod1_ds = look1_pbinlxpw(*rtu_in_data_H_radio_ft, FmgcOuterLoops_rtP.ScheduledGain2_BreakpointsForDimension1_f,
+    FmgcOuterLoops_rtP.ScheduledGain2_Table_j, &FmgcOuterLoops_DWork.ScheduledGain2_m_bpIndex_j, 7U);
   if (rtb_MaxH_dot_RA > FmgcOuterLoops_rtP.Saturation_UpperSat_g0) {
     rtb_MaxH_dot_RA = FmgcOuterLoops_rtP.Saturation_UpperSat_g0;
   } else if (rtb_MaxH_dot_RA < FmgcOuterLoops_rtP.Saturation_LowerSat_j) {
@@ -3637,8 +3640,8 @@ void FmgcOuterLoops::step(const real_T *rtu_in_time_dt, const real_T *rtu_in_tim
   FmgcOuterLoops_Voter1(rtb_MaxH_dot_RA + rtb_Y_o, FmgcOuterLoops_rtP.Gain1_Gain_eg * ((rtb_Sum1_pc +
     FmgcOuterLoops_rtP.Bias_Bias) - rtb_Mod1_ds), FmgcOuterLoops_rtP.Gain_Gain_dv * ((rtb_Sum1_pc +
     FmgcOuterLoops_rtP.Bias1_Bias) - rtb_Mod1_ds), &rtb_Y_f2);
-  rtb_Sum1_pc = look1_binlxpw(*rtu_in_data_V_tas_kn, FmgcOuterLoops_rtP.ScheduledGain1_BreakpointsForDimension1_m,
-    FmgcOuterLoops_rtP.ScheduledGain1_Table_g, 6U);
+  rtb_Sum1_pc = look1_pbinlxpw(*rtu_in_data_V_tas_kn, FmgcOuterLoops_rtP.ScheduledGain1_BreakpointsForDimension1_m,
+    FmgcOuterLoops_rtP.ScheduledGain1_Table_g, &FmgcOuterLoops_DWork.ScheduledGain1_m_bpIndex_g, 6U);
   rtb_Y_o = rtb_Y_f2 * rtb_Sum1_pc;
   rtb_Mod1_ds = FmgcOuterLoops_rtP.fpmtoms_Gain_fo * *rtu_in_data_H_dot_ft_min;
   rtb_Sum1_pc = FmgcOuterLoops_rtP.kntoms_Gain_o * *rtu_in_data_V_gnd_kn;
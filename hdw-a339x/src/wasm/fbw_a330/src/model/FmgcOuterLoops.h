@@ -99,6 +99,17 @@ class FmgcOuterLoops final
     real_T storage_l;
     real_T limit;
     real_T pY_f;
+    uint32_T ScheduledGain_m_bpIndex;
+    uint32_T ScheduledGain2_m_bpIndex;
+    uint32_T ScheduledGain_m_bpIndex_e;
+    uint32_T ScheduledGain1_m_bpIndex;
+    uint32_T ScheduledGain3_m_bpIndex;
+    uint32_T ScheduledGain_m_bpIndex_a;
+    uint32_T uDLookupTable_m_bpIndex;
+    uint32_T ScheduledGain_m_bpIndex_j;
+    uint32_T ScheduledGain3_m_bpIndex_b;
+    uint32_T ScheduledGain2_m_bpIndex_j;
+    uint32_T ScheduledGain1_m_bpIndex_g;
     boolean_T Delay_DSTATE_l4[100];
     boolean_T Delay_DSTATE_n[100];
     boolean_T icLoad;
@@ -969,7 +980,7 @@ class FmgcOuterLoops final
  private:
   BlockIO_FmgcOuterLoops_T FmgcOuterLoops_B;
   D_Work_FmgcOuterLoops_T FmgcOuterLoops_DWork;
-  static Parameters_FmgcOuterLoops_T FmgcOuterLoops_rtP;
+  static const Parameters_FmgcOuterLoops_T FmgcOuterLoops_rtP;
   static void FmgcOuterLoops_MATLABFunction(real_T rtu_tau, real_T rtu_zeta, real_T *rty_k2, real_T *rty_k1);
   static void FmgcOuterLoops_LagFilter_Reset(rtDW_LagFilter_FmgcOuterLoops_T *localDW);
   static void FmgcOuterLoops_LagFilter(real_T rtu_U, real_T rtu_C1, const real_T *rtu_dt, real_T *rty_Y,
@@ -1012,7 +1023,7 @@ class FmgcOuterLoops final
   static void FmgcOuterLoops_Voter1(real_T rtu_u1, real_T rtu_u2, real_T rtu_u3, real_T *rty_Y);
 };
 
-extern FmgcOuterLoops::Parameters_FmgcOuterLoops_T FmgcOuterLoops_rtP;
+extern const FmgcOuterLoops::Parameters_FmgcOuterLoops_T FmgcOuterLoops_rtP;
 
 #endif
 
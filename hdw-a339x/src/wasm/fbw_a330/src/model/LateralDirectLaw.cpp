@@ -2,7 +2,7 @@
 #include "rtwtypes.h"
 #include <cmath>
 
-LateralDirectLaw::Parameters_LateralDirectLaw_T LateralDirectLaw::LateralDirectLaw_rtP{
+const LateralDirectLaw::Parameters_LateralDirectLaw_T LateralDirectLaw::LateralDirectLaw_rtP{
 
   0.0,
 
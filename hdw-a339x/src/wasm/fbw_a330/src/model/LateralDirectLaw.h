@@ -31,10 +31,10 @@ class LateralDirectLaw final
   ~LateralDirectLaw();
  private:
   D_Work_LateralDirectLaw_T LateralDirectLaw_DWork;
-  static Parameters_LateralDirectLaw_T LateralDirectLaw_rtP;
+  static const Parameters_LateralDirectLaw_T LateralDirectLaw_rtP;
 };
 
-extern LateralDirectLaw::Parameters_LateralDirectLaw_T LateralDirectLaw_rtP;
+extern const LateralDirectLaw::Parameters_LateralDirectLaw_T LateralDirectLaw_rtP;
 
 #endif
 
@@ -1,7 +1,7 @@
 #include "LateralNormalLaw.h"
+#include "look1_pbinlxpw.h"
 #include "rtwtypes.h"
 #include <cmath>
-#include "look1_binlxpw.h"
 
 const uint8_T LateralNormalLaw_IN_FlightMode{ 1U };
 
@@ -9,7 +9,7 @@ const uint8_T LateralNormalLaw_IN_GroundMode{ 2U };
 
 const uint8_T LateralNormalLaw_IN_NO_ACTIVE_CHILD{ 0U };
 
-LateralNormalLaw::Parameters_LateralNormalLaw_T LateralNormalLaw::LateralNormalLaw_rtP{
+const LateralNormalLaw::Parameters_LateralNormalLaw_T LateralNormalLaw::LateralNormalLaw_rtP{
 
   { 0.0, 0.06, 0.1, 0.2, 1.0 },
 
@@ -88,10 +88,6 @@ LateralNormalLaw::Parameters_LateralNormalLaw_T LateralNormalLaw::LateralNormalL
 
   -25.0,
 
-  0.0,
-
-  0.0,
-
   1.0,
 
   0.0,
@@ -357,14 +353,17 @@ void LateralNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In_T
   r = LateralNormalLaw_rtP.DiscreteDerivativeVariableTs_Gain * rtb_Limiterxi;
   rtb_Divide = (r - LateralNormalLaw_DWork.Delay_DSTATE_o) / *rtu_In_time_dt;
   if (*rtu_In_high_speed_prot_active) {
-    LateralNormalLaw_DWork.Delay_DSTATE_o = look1_binlxpw(*rtu_In_Phi_deg,
-      LateralNormalLaw_rtP.BankAngleProtection2_bp01Data, LateralNormalLaw_rtP.BankAngleProtection2_tableData, 4U);
+    LateralNormalLaw_DWork.Delay_DSTATE_o = look1_pbinlxpw(*rtu_In_Phi_deg,
+      LateralNormalLaw_rtP.BankAngleProtection2_bp01Data, LateralNormalLaw_rtP.BankAngleProtection2_tableData,
+      &LateralNormalLaw_DWork.BankAngleProtection2_m_bpIndex, 4U);
   } else if (*rtu_In_high_aoa_prot_active) {
-    LateralNormalLaw_DWork.Delay_DSTATE_o = look1_binlxpw(*rtu_In_Phi_deg,
-      LateralNormalLaw_rtP.BankAngleProtection_bp01Data, LateralNormalLaw_rtP.BankAngleProtection_tableData, 8U);
+    LateralNormalLaw_DWork.Delay_DSTATE_o = look1_pbinlxpw(*rtu_In_Phi_deg,
+      LateralNormalLaw_rtP.BankAngleProtection_bp01Data, LateralNormalLaw_rtP.BankAngleProtection_tableData,
+      &LateralNormalLaw_DWork.BankAngleProtection_m_bpIndex, 8U);
   } else {
-    LateralNormalLaw_DWork.Delay_DSTATE_o = look1_binlxpw(*rtu_In_Phi_deg,
-      LateralNormalLaw_rtP.BankAngleProtection1_bp01Data, LateralNormalLaw_rtP.BankAngleProtection1_tableData, 8U);
+    LateralNormalLaw_DWork.Delay_DSTATE_o = look1_pbinlxpw(*rtu_In_Phi_deg,
+      LateralNormalLaw_rtP.BankAngleProtection1_bp01Data, LateralNormalLaw_rtP.BankAngleProtection1_tableData,
+      &LateralNormalLaw_DWork.BankAngleProtection1_m_bpIndex, 8U);
   }
 
   LateralNormalLaw_DWork.Delay_DSTATE_o += 1.0 / omega_0 * rtb_Divide + rtb_Limiterxi;
@@ -413,8 +412,8 @@ void LateralNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In_T
 
   rtb_Divide = LateralNormalLaw_rtP.Gain1_Gain_b * *rtu_In_Phi_deg;
   rtb_Gain1_f = LateralNormalLaw_rtP.Gain1_Gain_c * *rtu_In_pk_deg_s;
-  rtb_Limiterxi = look1_binlxpw(*rtu_In_time_dt, LateralNormalLaw_rtP.ScheduledGain_BreakpointsForDimension1,
-    LateralNormalLaw_rtP.ScheduledGain_Table, 4U);
+  rtb_Limiterxi = look1_pbinlxpw(*rtu_In_time_dt, LateralNormalLaw_rtP.ScheduledGain_BreakpointsForDimension1,
+    LateralNormalLaw_rtP.ScheduledGain_Table, &LateralNormalLaw_DWork.ScheduledGain_m_bpIndex, 4U);
   rtb_Y_du = dynamic_pressure_tmp / v_cas_ms_tmp * 372.0 * 1024.0;
   LateralNormalLaw_DWork.Delay_DSTATE = ((-(rtb_Y_du * -0.75 / 1.446E+7 + 1.414 * omega_0) / L_xi * rtb_Gain1_f + k_phi *
     rtb_Divide) + LateralNormalLaw_rtP.Gain1_Gain_n * LateralNormalLaw_DWork.Delay_DSTATE_o * -k_phi) * rtb_Limiterxi *
@@ -469,8 +468,9 @@ void LateralNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In_T
   }
 
   rtb_Product_f = LateralNormalLaw_DWork.Delay_DSTATE_o * Vias;
-  LateralNormalLaw_DWork.Delay_DSTATE_o = look1_binlxpw(*rtu_In_V_ias_kn,
-    LateralNormalLaw_rtP.ScheduledGain1_BreakpointsForDimension1, LateralNormalLaw_rtP.ScheduledGain1_Table, 3U);
+  LateralNormalLaw_DWork.Delay_DSTATE_o = look1_pbinlxpw(*rtu_In_V_ias_kn,
+    LateralNormalLaw_rtP.ScheduledGain1_BreakpointsForDimension1, LateralNormalLaw_rtP.ScheduledGain1_Table,
+    &LateralNormalLaw_DWork.ScheduledGain1_m_bpIndex, 3U);
   LateralNormalLaw_DWork.Delay_DSTATE_o *= *rtu_In_r_deg_s;
   if (LateralNormalLaw_DWork.Delay_DSTATE_o > LateralNormalLaw_rtP.Saturation2_UpperSat) {
     LateralNormalLaw_DWork.Delay_DSTATE_o = LateralNormalLaw_rtP.Saturation2_UpperSat;
@@ -18,6 +18,11 @@ class LateralNormalLaw final
     real_T Delay_DSTATE_d;
     real_T pY;
     real_T pY_b;
+    uint32_T BankAngleProtection2_m_bpIndex;
+    uint32_T BankAngleProtection_m_bpIndex;
+    uint32_T BankAngleProtection1_m_bpIndex;
+    uint32_T ScheduledGain_m_bpIndex;
+    uint32_T ScheduledGain1_m_bpIndex;
     uint8_T is_active_c5_LateralNormalLaw;
     uint8_T is_c5_LateralNormalLaw;
     boolean_T icLoad;
@@ -63,8 +68,6 @@ class LateralNormalLaw final
     real_T Saturation_UpperSat;
     real_T Saturation_LowerSat;
     real_T Gain_Gain;
-    real_T Constant_Value_l;
-    real_T Constant_Value_m;
     real_T Saturation1_UpperSat;
     real_T Saturation1_LowerSat;
     real_T Saturation_UpperSat_l;
@@ -115,13 +118,13 @@ class LateralNormalLaw final
   ~LateralNormalLaw();
  private:
   D_Work_LateralNormalLaw_T LateralNormalLaw_DWork;
-  static Parameters_LateralNormalLaw_T LateralNormalLaw_rtP;
+  static const Parameters_LateralNormalLaw_T LateralNormalLaw_rtP;
   static void LateralNormalLaw_RateLimiter_Reset(rtDW_RateLimiter_LateralNormalLaw_T *localDW);
   static void LateralNormalLaw_RateLimiter(real_T rtu_u, real_T rtu_up, real_T rtu_lo, const real_T *rtu_Ts, real_T
     rtu_init, real_T *rty_Y, rtDW_RateLimiter_LateralNormalLaw_T *localDW);
 };
 
-extern LateralNormalLaw::Parameters_LateralNormalLaw_T LateralNormalLaw_rtP;
+extern const LateralNormalLaw::Parameters_LateralNormalLaw_T LateralNormalLaw_rtP;
 
 #endif
 
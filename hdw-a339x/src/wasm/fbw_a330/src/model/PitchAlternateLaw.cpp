@@ -1,4 +1,7 @@
 #include "PitchAlternateLaw.h"
+#include "look1_evenlxpw.h"
+#include "look1_pbinlxpw.h"
+#include "plook_evenx.h"
 #include "rtwtypes.h"
 #include <cmath>
 #include "look1_binlxpw.h"
@@ -23,7 +26,7 @@ const uint8_T PitchAlternateLaw_IN_flight_flaps{ 2U };
 
 const uint8_T PitchAlternateLaw_IN_ground{ 3U };
 
-PitchAlternateLaw::Parameters_PitchAlternateLaw_T PitchAlternateLaw::PitchAlternateLaw_rtP{
+constexpr PitchAlternateLaw::Parameters_PitchAlternateLaw_T PitchAlternateLaw::PitchAlternateLaw_rtP{
 
   { 0.0, 1.0, 2.0, 3.0, 4.0, 5.0 },
 
@@ -502,8 +505,8 @@ void PitchAlternateLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In_
   rtb_Divide1_e = rtb_Cos / std::cos(rtb_Gain1);
   rtb_Gain1 = PitchAlternateLaw_rtP.Gain1_Gain_o * *rtu_In_qk_deg_s;
   rtb_Gain_m = *rtu_In_nz_g - rtb_Divide1_e;
-  rtb_Switch_i = look1_binlxpw(*rtu_In_V_tas_kn, PitchAlternateLaw_rtP.uDLookupTable_bp01Data_o,
-    PitchAlternateLaw_rtP.uDLookupTable_tableData_e, 6U);
+  rtb_Switch_i = look1_evenlxpw(*rtu_In_V_tas_kn, PitchAlternateLaw_rtP.uDLookupTable_bp01Data_o,
+    PitchAlternateLaw_rtP.uDLookupTable_tableData_e, 0.02, 6U);
   rtb_Switch_c = *rtu_In_V_tas_kn;
   if (rtb_Switch_c > PitchAlternateLaw_rtP.Saturation3_UpperSat) {
     rtb_Switch_c = PitchAlternateLaw_rtP.Saturation3_UpperSat;
@@ -626,8 +629,8 @@ void PitchAlternateLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In_
   rtb_Divide = PitchAlternateLaw_rtP.DiscreteDerivativeVariableTs1_Gain_m * *rtu_In_qk_deg_s;
   rtb_Divide_n = (rtb_Divide - PitchAlternateLaw_DWork.Delay_DSTATE_kd) / *rtu_In_time_dt;
   rtb_Product1_f = PitchAlternateLaw_rtP.Gain1_Gain_e * *rtu_In_qk_deg_s;
-  rtb_Switch_c = look1_binlxpw(*rtu_In_V_tas_kn, PitchAlternateLaw_rtP.uDLookupTable_bp01Data_b,
-    PitchAlternateLaw_rtP.uDLookupTable_tableData_h, 6U);
+  rtb_Switch_c = look1_evenlxpw(*rtu_In_V_tas_kn, PitchAlternateLaw_rtP.uDLookupTable_bp01Data_b,
+    PitchAlternateLaw_rtP.uDLookupTable_tableData_h, 0.02, 6U);
   rtb_Product1_d = *rtu_In_V_tas_kn;
   if (rtb_Product1_d > PitchAlternateLaw_rtP.Saturation3_UpperSat_b) {
     rtb_Product1_d = PitchAlternateLaw_rtP.Saturation3_UpperSat_b;
@@ -645,8 +648,8 @@ void PitchAlternateLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In_
     (PitchAlternateLaw_rtP.RateLimiterVariableTs_up) * *rtu_In_time_dt), -std::abs
     (PitchAlternateLaw_rtP.RateLimiterVariableTs_lo) * *rtu_In_time_dt);
   if (*rtu_In_stabilities_available) {
-    rtb_Switch_c = look1_binlxpw(*rtu_In_flaps_handle_index, PitchAlternateLaw_rtP.uDLookupTable_bp01Data,
-      PitchAlternateLaw_rtP.uDLookupTable_tableData, 5U);
+    rtb_Switch_c = look1_evenlxpw(*rtu_In_flaps_handle_index, PitchAlternateLaw_rtP.uDLookupTable_bp01Data,
+      PitchAlternateLaw_rtP.uDLookupTable_tableData, 1.0, 5U);
     rtb_Switch_c -= *rtu_In_V_ias_kn;
     rtb_Switch_i = PitchAlternateLaw_rtP.Gain1_Gain * rtb_Switch_c;
   } else {
@@ -717,8 +720,8 @@ void PitchAlternateLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In_
   rtb_Divide_n = PitchAlternateLaw_rtP.DiscreteDerivativeVariableTs1_Gain_c * *rtu_In_qk_deg_s;
   rtb_Divide_i = (rtb_Divide_n - PitchAlternateLaw_DWork.Delay_DSTATE_e) / *rtu_In_time_dt;
   rtb_Switch_i = PitchAlternateLaw_rtP.Gain1_Gain_b * *rtu_In_qk_deg_s;
-  rtb_Switch_c = look1_binlxpw(*rtu_In_V_tas_kn, PitchAlternateLaw_rtP.uDLookupTable_bp01Data_a,
-    PitchAlternateLaw_rtP.uDLookupTable_tableData_p, 6U);
+  rtb_Switch_c = look1_evenlxpw(*rtu_In_V_tas_kn, PitchAlternateLaw_rtP.uDLookupTable_bp01Data_a,
+    PitchAlternateLaw_rtP.uDLookupTable_tableData_p, 0.02, 6U);
   rtb_Product1_d = *rtu_In_V_tas_kn;
   if (rtb_Product1_d > PitchAlternateLaw_rtP.Saturation3_UpperSat_n) {
     rtb_Product1_d = PitchAlternateLaw_rtP.Saturation3_UpperSat_n;
@@ -789,8 +792,8 @@ void PitchAlternateLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In_
     rtb_TmpSignalConversionAtSFunctionInport1[2] = rtb_Product1_d;
   }
 
-  rtb_Switch_c = look1_binlxpw(*rtu_In_flaps_handle_index, PitchAlternateLaw_rtP.ScheduledGain_BreakpointsForDimension1,
-    PitchAlternateLaw_rtP.ScheduledGain_Table, 5U);
+  rtb_Switch_c = look1_evenlxpw(*rtu_In_flaps_handle_index,
+    PitchAlternateLaw_rtP.ScheduledGain_BreakpointsForDimension1, PitchAlternateLaw_rtP.ScheduledGain_Table, 1.0, 5U);
   if (rtb_TmpSignalConversionAtSFunctionInport1[0] < rtb_TmpSignalConversionAtSFunctionInport1[1]) {
     if (rtb_TmpSignalConversionAtSFunctionInport1[1] < rtb_TmpSignalConversionAtSFunctionInport1[2]) {
       tmp = 1;
@@ -808,8 +811,8 @@ void PitchAlternateLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In_
   }
 
   rtb_Divide_c = rtb_TmpSignalConversionAtSFunctionInport1[tmp] * rtb_Switch_c;
-  rtb_Switch_c = look1_binlxpw(*rtu_In_time_dt, PitchAlternateLaw_rtP.ScheduledGain_BreakpointsForDimension1_d,
-    PitchAlternateLaw_rtP.ScheduledGain_Table_h, 4U);
+  rtb_Switch_c = look1_pbinlxpw(*rtu_In_time_dt, PitchAlternateLaw_rtP.ScheduledGain_BreakpointsForDimension1_d,
+    PitchAlternateLaw_rtP.ScheduledGain_Table_h, &PitchAlternateLaw_DWork.ScheduledGain_m_bpIndex_h, 4U);
   rtb_Switch_c = rtb_Divide_c * rtb_Switch_c * PitchAlternateLaw_rtP.DiscreteTimeIntegratorVariableTs_Gain *
     *rtu_In_time_dt;
   rtb_NOT = (*rtu_In_in_flight == 0.0);
@@ -901,6 +904,11 @@ void PitchAlternateLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In_
 PitchAlternateLaw::PitchAlternateLaw():
   PitchAlternateLaw_DWork()
 {
+  static_assert(plook_evenx_bpSpaceInv_matches(PitchAlternateLaw_rtP.uDLookupTable_bp01Data_o, 0.02, 6U));
+  static_assert(plook_evenx_bpSpaceInv_matches(PitchAlternateLaw_rtP.uDLookupTable_bp01Data_b, 0.02, 6U));
+  static_assert(plook_evenx_bpSpaceInv_matches(PitchAlternateLaw_rtP.uDLookupTable_bp01Data_a, 0.02, 6U));
+  static_assert(plook_evenx_bpSpaceInv_matches(PitchAlternateLaw_rtP.uDLookupTable_bp01Data, 1.0, 5U));
+  static_assert(plook_evenx_bpSpaceInv_matches(PitchAlternateLaw_rtP.ScheduledGain_BreakpointsForDimension1, 1.0, 5U));
 }
 
 PitchAlternateLaw::~PitchAlternateLaw() = default;
@@ -38,6 +38,7 @@ class PitchAlternateLaw final
     real_T Delay_DSTATE_l;
     real_T Delay_DSTATE_o;
     real_T pY;
+    uint32_T ScheduledGain_m_bpIndex_h;
     uint8_T is_active_c7_PitchAlternateLaw;
     uint8_T is_c7_PitchAlternateLaw;
     uint8_T is_active_c8_PitchAlternateLaw;
@@ -213,7 +214,7 @@ class PitchAlternateLaw final
   ~PitchAlternateLaw();
  private:
   D_Work_PitchAlternateLaw_T PitchAlternateLaw_DWork;
-  static Parameters_PitchAlternateLaw_T PitchAlternateLaw_rtP;
+  static const Parameters_PitchAlternateLaw_T PitchAlternateLaw_rtP;
   static void PitchAlternateLaw_RateLimiter_Reset(rtDW_RateLimiter_PitchAlternateLaw_T *localDW);
   static void PitchAlternateLaw_RateLimiter(real_T rtu_u, real_T rtu_up, real_T rtu_lo, const real_T *rtu_Ts, real_T
     rtu_init, real_T *rty_Y, rtDW_RateLimiter_PitchAlternateLaw_T *localDW);
@@ -225,7 +226,7 @@ class PitchAlternateLaw final
     rtDW_WashoutFilter_PitchAlternateLaw_T *localDW);
 };
 
-extern PitchAlternateLaw::Parameters_PitchAlternateLaw_T PitchAlternateLaw_rtP;
+extern const PitchAlternateLaw::Parameters_PitchAlternateLaw_T PitchAlternateLaw_rtP;
 
 #endif
 
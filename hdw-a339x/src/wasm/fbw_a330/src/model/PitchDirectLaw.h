@@ -35,10 +35,10 @@ class PitchDirectLaw final
   ~PitchDirectLaw();
  private:
   D_Work_PitchDirectLaw_T PitchDirectLaw_DWork;
-  static Parameters_PitchDirectLaw_T PitchDirectLaw_rtP;
+  static const Parameters_PitchDirectLaw_T PitchDirectLaw_rtP;
 };
 
-extern PitchDirectLaw::Parameters_PitchDirectLaw_T PitchDirectLaw_rtP;
+extern const PitchDirectLaw::Parameters_PitchDirectLaw_T PitchDirectLaw_rtP;
 
 #endif
 
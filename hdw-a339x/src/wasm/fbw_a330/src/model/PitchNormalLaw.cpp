@@ -1,8 +1,13 @@
 #include "PitchNormalLaw.h"
+#include "look1_pbinlxpw.h"
+#include "look2_pbinlxpw.h"
+#include "plook_binxp.h"
+#include "plook_evenx.h"
 #include "rtwtypes.h"
 #include <cmath>
 #include "look1_binlxpw.h"
-#include "look2_binlxpw.h"
+#include "plook_binx.h"
+#include "intrp1d_l_pw.h"
 
 const uint8_T PitchNormalLaw_IN_Flare_Active_Armed{ 1U };
 
@@ -38,16 +43,7 @@ const uint8_T PitchNormalLaw_IN_OFF{ 1U };
 
 const uint8_T PitchNormalLaw_IN_ON{ 2U };
 
-PitchNormalLaw::Parameters_PitchNormalLaw_T PitchNormalLaw::PitchNormalLaw_rtP{
-
-  { 0.0, 50.0, 100.0, 200.0 },
-
-
-  { 0.0, 50.0, 100.0, 200.0 },
-
-
-  { 0.0, 100.0, 150.0, 200.0, 250.0, 300.0, 400.0 },
-
+constexpr PitchNormalLaw::Parameters_PitchNormalLaw_T PitchNormalLaw::PitchNormalLaw_rtP{
 
   { 0.0, 50.0, 100.0, 200.0 },
 
@@ -55,26 +51,11 @@ PitchNormalLaw::Parameters_PitchNormalLaw_T PitchNormalLaw::PitchNormalLaw_rtP{
   { 0.0, 100.0, 150.0, 200.0, 250.0, 300.0, 400.0 },
 
 
-  { 0.0, 50.0, 100.0, 200.0 },
-
-
-  { 0.0, 50.0, 100.0, 200.0 },
-
-
-  { 0.0, 50.0, 100.0, 200.0 },
-
-
-  { 0.0, 50.0, 100.0, 200.0 },
-
-
   { 0.0, 163.0, 243.0, 344.0, 400.0 },
 
 
   { 0.0, 0.06, 0.1, 0.2, 1.0 },
 
-
-  { 0.0, 163.0, 243.0, 344.0, 400.0 },
-
   0.05,
 
   0.3,
@@ -489,16 +470,6 @@ PitchNormalLaw::Parameters_PitchNormalLaw_T PitchNormalLaw::PitchNormalLaw_rtP{
 
   0.0,
 
-  0.0,
-
-  0.0,
-
-  0.0,
-
-  0.0,
-
-  0.0,
-
   0.2,
 
   0.2,
@@ -522,9 +493,6 @@ PitchNormalLaw::Parameters_PitchNormalLaw_T PitchNormalLaw::PitchNormalLaw_rtP{
 
   { 0.5, 0.5 },
 
-
-  { 0.0, 350.0 },
-
   1.0,
 
   -1.0,
@@ -550,9 +518,6 @@ PitchNormalLaw::Parameters_PitchNormalLaw_T PitchNormalLaw::PitchNormalLaw_rtP{
 
   { 100.0, 100.0, 100.0, 100.0, 100.0, 100.0, 100.0 },
 
-
-  { 100.0, 150.0, 200.0, 250.0, 300.0, 350.0, 400.0 },
-
   2000.0,
 
   100.0,
@@ -565,14 +530,8 @@ PitchNormalLaw::Parameters_PitchNormalLaw_T PitchNormalLaw::PitchNormalLaw_rtP{
   { 13.5, 13.5 },
 
 
-  { 0.0, 350.0 },
-
-
   { 0.5, 0.5 },
 
-
-  { 0.0, 350.0 },
-
   1.0,
 
   -1.0,
@@ -598,9 +557,6 @@ PitchNormalLaw::Parameters_PitchNormalLaw_T PitchNormalLaw::PitchNormalLaw_rtP{
 
   { 100.0, 100.0, 100.0, 100.0, 100.0, 100.0, 100.0 },
 
-
-  { 100.0, 150.0, 200.0, 250.0, 300.0, 350.0, 400.0 },
-
   2000.0,
 
   100.0,
@@ -619,14 +575,8 @@ PitchNormalLaw::Parameters_PitchNormalLaw_T PitchNormalLaw::PitchNormalLaw_rtP{
   { 13.5, 13.5 },
 
 
-  { 0.0, 350.0 },
-
-
   { 0.5, 0.5 },
 
-
-  { 0.0, 350.0 },
-
   1.0,
 
   -1.0,
@@ -696,9 +646,6 @@ PitchNormalLaw::Parameters_PitchNormalLaw_T PitchNormalLaw::PitchNormalLaw_rtP{
 
   { 100.0, 100.0, 100.0, 100.0, 100.0, 100.0, 100.0 },
 
-
-  { 100.0, 150.0, 200.0, 250.0, 300.0, 350.0, 400.0 },
-
   2000.0,
 
   100.0,
@@ -719,14 +666,8 @@ PitchNormalLaw::Parameters_PitchNormalLaw_T PitchNormalLaw::PitchNormalLaw_rtP{
   { 13.5, 13.5 },
 
 
-  { 0.0, 350.0 },
-
-
   { 0.5, 0.5 },
 
-
-  { 0.0, 350.0 },
-
   1.0,
 
   -1.0,
@@ -760,9 +701,6 @@ PitchNormalLaw::Parameters_PitchNormalLaw_T PitchNormalLaw::PitchNormalLaw_rtP{
 
   { 100.0, 100.0, 100.0, 100.0, 100.0, 100.0, 100.0 },
 
-
-  { 100.0, 150.0, 200.0, 250.0, 300.0, 350.0, 400.0 },
-
   2000.0,
 
   100.0,
@@ -801,14 +739,8 @@ PitchNormalLaw::Parameters_PitchNormalLaw_T PitchNormalLaw::PitchNormalLaw_rtP{
   { 13.5, 13.5 },
 
 
-  { 0.0, 350.0 },
-
-
   { 0.5, 0.5 },
 
-
-  { 0.0, 350.0 },
-
   1.0,
 
   -1.0,
@@ -834,9 +766,6 @@ PitchNormalLaw::Parameters_PitchNormalLaw_T PitchNormalLaw::PitchNormalLaw_rtP{
 
   { 100.0, 100.0, 100.0, 100.0, 100.0, 100.0, 100.0 },
 
-
-  { 100.0, 150.0, 200.0, 250.0, 300.0, 350.0, 400.0 },
-
   2000.0,
 
   100.0,
@@ -849,14 +778,8 @@ PitchNormalLaw::Parameters_PitchNormalLaw_T PitchNormalLaw::PitchNormalLaw_rtP{
   { 13.5, 13.5 },
 
 
-  { 0.0, 350.0 },
-
-
   { 0.5, 0.5 },
 
-
-  { 0.0, 350.0 },
-
   1.0,
 
   -1.0,
@@ -882,9 +805,6 @@ PitchNormalLaw::Parameters_PitchNormalLaw_T PitchNormalLaw::PitchNormalLaw_rtP{
 
   { 100.0, 100.0, 100.0, 100.0, 100.0, 100.0, 100.0 },
 
-
-  { 100.0, 150.0, 200.0, 250.0, 300.0, 350.0, 400.0 },
-
   2000.0,
 
   100.0,
@@ -911,14 +831,8 @@ PitchNormalLaw::Parameters_PitchNormalLaw_T PitchNormalLaw::PitchNormalLaw_rtP{
   { 13.5, 13.5 },
 
 
-  { 0.0, 350.0 },
-
-
   { 0.5, 0.5 },
 
-
-  { 0.0, 350.0 },
-
   1.0,
 
   -1.0,
@@ -1353,6 +1267,11 @@ void PitchNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In_nz_
   real_T rtb_Gain_ot;
   real_T rtb_Loaddemand;
   real_T rtb_ManualSwitch;
+  real_T rtb_PrelookupHradio_o2;
+  real_T rtb_PrelookupVias_o2;
+  real_T rtb_PrelookupVtasGain_o2;
+  real_T rtb_PrelookupVtasInput_o2;
+  real_T rtb_PrelookupVtas_o2;
   real_T rtb_Product1_ck;
   real_T rtb_Product1_d;
   real_T rtb_Product1_dm;
@@ -1383,6 +1302,11 @@ void PitchNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In_nz_
   int32_T rtb_in_flare;
   int32_T rtb_in_rotation;
   int32_T rtb_theta_lim;
+  uint32_T rtb_PrelookupHradio_o1;
+  uint32_T rtb_PrelookupVias_o1;
+  uint32_T rtb_PrelookupVtasGain_o1;
+  uint32_T rtb_PrelookupVtasInput_o1;
+  uint32_T rtb_PrelookupVtas_o1;
   boolean_T rtb_OR;
   boolean_T rtb_eta_trim_deg_should_freeze;
   PitchNormalLaw_LagFilter(rtu_In_Theta_deg, PitchNormalLaw_rtP.LagFilter_C1, rtu_In_time_dt, &rtb_Y_j,
@@ -1503,8 +1427,9 @@ void PitchNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In_nz_
   rtb_Divide1_e = rtb_Divide_g4 / std::cos(rtb_Gain1);
   rtb_Gain1_h = PitchNormalLaw_rtP.Gain1_Gain_e * *rtu_In_qk_deg_s;
   rtb_Gain_bu = *rtu_In_nz_g - rtb_Divide1_e;
-  rtb_Tsxlo = look1_binlxpw(*rtu_In_V_tas_kn, PitchNormalLaw_rtP.uDLookupTable_bp01Data,
-    PitchNormalLaw_rtP.uDLookupTable_tableData, 6U);
+  rtb_PrelookupVtas_o1 = plook_evenx(*rtu_In_V_tas_kn, PitchNormalLaw_rtP.uDLookupTable_bp01Data, 0.02, 6U,
+    &rtb_PrelookupVtas_o2);
+  rtb_Tsxlo = intrp1d_l_pw(rtb_PrelookupVtas_o1, rtb_PrelookupVtas_o2, PitchNormalLaw_rtP.uDLookupTable_tableData);
   rtb_v_target = *rtu_In_V_tas_kn;
   rtb_Gain_ot = *rtu_In_V_ias_kn;
   rtb_Gain1_g = *rtu_In_flaps_handle_index;
@@ -1712,9 +1637,11 @@ void PitchNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In_nz_
     (rtb_Tsxlo / (PitchNormalLaw_rtP.Gain5_Gain * rtb_v_target) + PitchNormalLaw_rtP.Bias_Bias) * ((rtb_Divide1_e +
     look1_binlxpw(rtb_Product1_ck, PitchNormalLaw_rtP.Loaddemand1_bp01Data, PitchNormalLaw_rtP.Loaddemand1_tableData, 2U))
     - rtb_Divide1_e);
-  rtb_Tsxlo = look1_binlxpw(*rtu_In_V_tas_kn, PitchNormalLaw_rtP.PLUT_bp01Data, PitchNormalLaw_rtP.PLUT_tableData, 1U);
+  rtb_PrelookupVtasGain_o1 = plook_binx(*rtu_In_V_tas_kn, PitchNormalLaw_rtP.PLUT_bp01Data, 1U,
+    &rtb_PrelookupVtasGain_o2);
+  rtb_Tsxlo = intrp1d_l_pw(rtb_PrelookupVtasGain_o1, rtb_PrelookupVtasGain_o2, PitchNormalLaw_rtP.PLUT_tableData);
   rtb_Product1_dm = rtb_Y_l * rtb_Tsxlo;
-  rtb_Tsxlo = look1_binlxpw(*rtu_In_V_tas_kn, PitchNormalLaw_rtP.DLUT_bp01Data, PitchNormalLaw_rtP.DLUT_tableData, 1U);
+  rtb_Tsxlo = intrp1d_l_pw(rtb_PrelookupVtasGain_o1, rtb_PrelookupVtasGain_o2, PitchNormalLaw_rtP.DLUT_tableData);
   rtb_Gain1_h = rtb_Y_l * rtb_Tsxlo * PitchNormalLaw_rtP.DiscreteDerivativeVariableTs_Gain;
   rtb_Divide_o = (rtb_Gain1_h - PitchNormalLaw_DWork.Delay_DSTATE_n) / *rtu_In_time_dt;
   rtb_Gain_ot = PitchNormalLaw_rtP.DiscreteDerivativeVariableTs2_Gain * *rtu_In_V_tas_kn;
@@ -1732,8 +1659,9 @@ void PitchNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In_nz_
   rtb_Gain_mj = std::fmin(*rtu_In_spoilers_left_pos, *rtu_In_spoilers_right_pos);
   PitchNormalLaw_WashoutFilter(rtb_Gain_mj, PitchNormalLaw_rtP.WashoutFilter_C1, rtu_In_time_dt, &rtb_Y_g,
     &PitchNormalLaw_DWork.sf_WashoutFilter_k);
-  rtb_Tsxlo = look1_binlxpw(*rtu_In_H_radio_ft, PitchNormalLaw_rtP.ScheduledGain_BreakpointsForDimension1,
-    PitchNormalLaw_rtP.ScheduledGain_Table, 3U);
+  rtb_PrelookupHradio_o1 = plook_binxp(*rtu_In_H_radio_ft, PitchNormalLaw_rtP.ScheduledGain_BreakpointsForDimension1,
+    3U, &rtb_PrelookupHradio_o2, &PitchNormalLaw_DWork.PrelookupHradio_m_bpIndex);
+  rtb_Tsxlo = intrp1d_l_pw(rtb_PrelookupHradio_o1, rtb_PrelookupHradio_o2, PitchNormalLaw_rtP.ScheduledGain_Table);
   if (rtb_Y_g > PitchNormalLaw_rtP.SaturationSpoilers_UpperSat) {
     rtb_Y_g = PitchNormalLaw_rtP.SaturationSpoilers_UpperSat;
   } else if (rtb_Y_g < PitchNormalLaw_rtP.SaturationSpoilers_LowerSat) {
@@ -1744,8 +1672,7 @@ void PitchNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In_nz_
   rtb_Divide_an = PitchNormalLaw_rtP.DiscreteDerivativeVariableTs1_Gain_i * *rtu_In_qk_deg_s;
   rtb_Divide_cq = (rtb_Divide_an - PitchNormalLaw_DWork.Delay_DSTATE_l) / *rtu_In_time_dt;
   rtb_Gain1_g = PitchNormalLaw_rtP.Gain1_Gain_o * *rtu_In_qk_deg_s;
-  rtb_Y_l = look1_binlxpw(*rtu_In_V_tas_kn, PitchNormalLaw_rtP.uDLookupTable_bp01Data_o,
-    PitchNormalLaw_rtP.uDLookupTable_tableData_e, 6U);
+  rtb_Y_l = intrp1d_l_pw(rtb_PrelookupVtas_o1, rtb_PrelookupVtas_o2, PitchNormalLaw_rtP.uDLookupTable_tableData_e);
   rtb_v_target = *rtu_In_V_tas_kn;
   if (rtb_v_target > PitchNormalLaw_rtP.Saturation3_UpperSat_a) {
     rtb_v_target = PitchNormalLaw_rtP.Saturation3_UpperSat_a;
@@ -1756,11 +1683,9 @@ void PitchNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In_nz_
   rtb_Y_l = (PitchNormalLaw_rtP.Gain_Gain_al * PitchNormalLaw_rtP.Vm_currentms_Value_e * rtb_Gain1_g + rtb_Gain_bu) -
     (rtb_Y_l / (PitchNormalLaw_rtP.Gain5_Gain_d * rtb_v_target) + PitchNormalLaw_rtP.Bias_Bias_a) * (rtb_Sum6 -
     rtb_Divide1_e);
-  rtb_Tsxlo = look1_binlxpw(*rtu_In_V_tas_kn, PitchNormalLaw_rtP.PLUT_bp01Data_b, PitchNormalLaw_rtP.PLUT_tableData_b,
-    1U);
+  rtb_Tsxlo = intrp1d_l_pw(rtb_PrelookupVtasGain_o1, rtb_PrelookupVtasGain_o2, PitchNormalLaw_rtP.PLUT_tableData_b);
   rtb_Product1_ck = rtb_Y_l * rtb_Tsxlo;
-  rtb_Tsxlo = look1_binlxpw(*rtu_In_V_tas_kn, PitchNormalLaw_rtP.DLUT_bp01Data_h, PitchNormalLaw_rtP.DLUT_tableData_p,
-    1U);
+  rtb_Tsxlo = intrp1d_l_pw(rtb_PrelookupVtasGain_o1, rtb_PrelookupVtasGain_o2, PitchNormalLaw_rtP.DLUT_tableData_p);
   rtb_Gain1_g = rtb_Y_l * rtb_Tsxlo * PitchNormalLaw_rtP.DiscreteDerivativeVariableTs_Gain_j;
   rtb_Divide_l = (rtb_Gain1_g - PitchNormalLaw_DWork.Delay_DSTATE_k) / *rtu_In_time_dt;
   rtb_Saturation3_i = PitchNormalLaw_rtP.DiscreteDerivativeVariableTs2_Gain_e * *rtu_In_V_tas_kn;
@@ -1777,8 +1702,7 @@ void PitchNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In_nz_
 
   PitchNormalLaw_WashoutFilter(rtb_Gain_mj, PitchNormalLaw_rtP.WashoutFilter_C1_n, rtu_In_time_dt, &rtb_Y_g,
     &PitchNormalLaw_DWork.sf_WashoutFilter_c);
-  rtb_Tsxlo = look1_binlxpw(*rtu_In_H_radio_ft, PitchNormalLaw_rtP.ScheduledGain_BreakpointsForDimension1_n,
-    PitchNormalLaw_rtP.ScheduledGain_Table_b, 3U);
+  rtb_Tsxlo = intrp1d_l_pw(rtb_PrelookupHradio_o1, rtb_PrelookupHradio_o2, PitchNormalLaw_rtP.ScheduledGain_Table_b);
   if (rtb_Y_g > PitchNormalLaw_rtP.SaturationSpoilers_UpperSat_g) {
     rtb_Y_g = PitchNormalLaw_rtP.SaturationSpoilers_UpperSat_g;
   } else if (rtb_Y_g < PitchNormalLaw_rtP.SaturationSpoilers_LowerSat_j) {
@@ -1789,8 +1713,7 @@ void PitchNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In_nz_
   rtb_Divide_m = PitchNormalLaw_rtP.DiscreteDerivativeVariableTs1_Gain_h * *rtu_In_qk_deg_s;
   rtb_Divide_c = (rtb_Divide_m - PitchNormalLaw_DWork.Delay_DSTATE_b) / *rtu_In_time_dt;
   rtb_Gain1_nj = PitchNormalLaw_rtP.Gain1_Gain_or * *rtu_In_qk_deg_s;
-  rtb_Y_l = look1_binlxpw(*rtu_In_V_tas_kn, PitchNormalLaw_rtP.uDLookupTable_bp01Data_h,
-    PitchNormalLaw_rtP.uDLookupTable_tableData_i, 6U);
+  rtb_Y_l = intrp1d_l_pw(rtb_PrelookupVtas_o1, rtb_PrelookupVtas_o2, PitchNormalLaw_rtP.uDLookupTable_tableData_i);
   rtb_v_target = *rtu_In_V_tas_kn;
   if (rtb_v_target > PitchNormalLaw_rtP.Saturation3_UpperSat_e) {
     rtb_v_target = PitchNormalLaw_rtP.Saturation3_UpperSat_e;
@@ -1803,8 +1726,11 @@ void PitchNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In_nz_
     PitchNormalLaw_rtP.RateLimiterVariableTs1_lo_e, rtu_In_time_dt,
     PitchNormalLaw_rtP.RateLimiterVariableTs1_InitialCondition_b, &rtb_Sum6, &PitchNormalLaw_DWork.sf_RateLimiter_i);
   rtb_Sum6 -= *rtu_In_Theta_deg;
-  rtb_Y_l = look1_binlxpw(*rtu_In_V_tas_kn, PitchNormalLaw_rtP.ScheduledGainAutopilotInput_BreakpointsForDimension1,
-    PitchNormalLaw_rtP.ScheduledGainAutopilotInput_Table, 6U);
+  rtb_PrelookupVtasInput_o1 = plook_binxp(*rtu_In_V_tas_kn,
+    PitchNormalLaw_rtP.ScheduledGainAutopilotInput_BreakpointsForDimension1, 6U, &rtb_PrelookupVtasInput_o2,
+    &PitchNormalLaw_DWork.PrelookupVtasInput_m_bpIndex);
+  rtb_Y_l = intrp1d_l_pw(rtb_PrelookupVtasInput_o1, rtb_PrelookupVtasInput_o2,
+    PitchNormalLaw_rtP.ScheduledGainAutopilotInput_Table);
   rtb_v_target = *rtu_In_Phi_deg;
   if (rtb_v_target > PitchNormalLaw_rtP.Saturation_UpperSat_f) {
     rtb_v_target = PitchNormalLaw_rtP.Saturation_UpperSat_f;
@@ -1815,11 +1741,9 @@ void PitchNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In_nz_
   rtb_Divide_g4 /= std::cos(PitchNormalLaw_rtP.Gain1_Gain_lm * rtb_v_target);
   rtb_Y_l = (PitchNormalLaw_rtP.Gain_Gain_h * PitchNormalLaw_rtP.Vm_currentms_Value_p * rtb_Gain1_nj + rtb_Gain_bu) -
     ((rtb_Sum6 * rtb_Y_l + rtb_Divide_g4) - rtb_Divide1_e) * rtb_Bias_f;
-  rtb_Tsxlo = look1_binlxpw(*rtu_In_V_tas_kn, PitchNormalLaw_rtP.PLUT_bp01Data_d, PitchNormalLaw_rtP.PLUT_tableData_a,
-    1U);
+  rtb_Tsxlo = intrp1d_l_pw(rtb_PrelookupVtasGain_o1, rtb_PrelookupVtasGain_o2, PitchNormalLaw_rtP.PLUT_tableData_a);
   rtb_Product1_d = rtb_Y_l * rtb_Tsxlo;
-  rtb_Tsxlo = look1_binlxpw(*rtu_In_V_tas_kn, PitchNormalLaw_rtP.DLUT_bp01Data_g, PitchNormalLaw_rtP.DLUT_tableData_b,
-    1U);
+  rtb_Tsxlo = intrp1d_l_pw(rtb_PrelookupVtasGain_o1, rtb_PrelookupVtasGain_o2, PitchNormalLaw_rtP.DLUT_tableData_b);
   rtb_Gain1_nj = rtb_Y_l * rtb_Tsxlo * PitchNormalLaw_rtP.DiscreteDerivativeVariableTs_Gain_o;
   rtb_Divide_o4 = (rtb_Gain1_nj - PitchNormalLaw_DWork.Delay_DSTATE_en) / *rtu_In_time_dt;
   rtb_Bias_f = PitchNormalLaw_rtP.DiscreteDerivativeVariableTs2_Gain_g * *rtu_In_V_tas_kn;
@@ -1836,8 +1760,7 @@ void PitchNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In_nz_
 
   PitchNormalLaw_WashoutFilter(rtb_Gain_mj, PitchNormalLaw_rtP.WashoutFilter_C1_e, rtu_In_time_dt, &rtb_Y_g,
     &PitchNormalLaw_DWork.sf_WashoutFilter_k4);
-  rtb_Tsxlo = look1_binlxpw(*rtu_In_H_radio_ft, PitchNormalLaw_rtP.ScheduledGain_BreakpointsForDimension1_c,
-    PitchNormalLaw_rtP.ScheduledGain_Table_h, 3U);
+  rtb_Tsxlo = intrp1d_l_pw(rtb_PrelookupHradio_o1, rtb_PrelookupHradio_o2, PitchNormalLaw_rtP.ScheduledGain_Table_h);
   rtb_Y_i = *rtu_In_any_ap_engaged;
   rtb_Sum6 = PitchNormalLaw_rtP.RateLimiterVariableTs8_up * *rtu_In_time_dt;
   rtb_Y_i = std::fmin(rtb_Y_i - PitchNormalLaw_DWork.Delay_DSTATE_g, rtb_Sum6);
@@ -1921,8 +1844,9 @@ void PitchNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In_nz_
   rtb_Abs = std::abs(PitchNormalLaw_rtP.Constant_Value_e);
   rtb_in_rotation = *rtu_In_on_ground;
   if (rtb_in_rotation > PitchNormalLaw_rtP.LimitSwitchUp_Threshold) {
-    rtb_Sum6 = look2_binlxpw(*rtu_In_qk_deg_s, *rtu_In_eta_deg, PitchNormalLaw_rtP.LimitUp_bp01Data,
-      PitchNormalLaw_rtP.LimitUp_bp02Data, PitchNormalLaw_rtP.LimitUp_tableData, PitchNormalLaw_rtP.LimitUp_maxIndex, 7U);
+    rtb_Sum6 = look2_pbinlxpw(*rtu_In_qk_deg_s, *rtu_In_eta_deg, PitchNormalLaw_rtP.LimitUp_bp01Data,
+      PitchNormalLaw_rtP.LimitUp_bp02Data, PitchNormalLaw_rtP.LimitUp_tableData,
+      PitchNormalLaw_DWork.LimitUp_m_bpIndex, PitchNormalLaw_rtP.LimitUp_maxIndex, 7U);
     rtb_Sum6 *= PitchNormalLaw_rtP.GainUp_Gain * rtb_Abs;
     if (rtb_Sum6 > rtb_Abs) {
       rtb_Sum6 = rtb_Abs;
@@ -1936,8 +1860,7 @@ void PitchNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In_nz_
   rtb_alpha_err_gain = PitchNormalLaw_rtP.DiscreteDerivativeVariableTs1_Gain_j * *rtu_In_qk_deg_s;
   rtb_Divide_n = (rtb_alpha_err_gain - PitchNormalLaw_DWork.Delay_DSTATE_bg) / *rtu_In_time_dt;
   rtb_Gain1_n = PitchNormalLaw_rtP.Gain1_Gain_i * *rtu_In_qk_deg_s;
-  rtb_Y_i = look1_binlxpw(*rtu_In_V_tas_kn, PitchNormalLaw_rtP.uDLookupTable_bp01Data_c,
-    PitchNormalLaw_rtP.uDLookupTable_tableData_a, 6U);
+  rtb_Y_i = intrp1d_l_pw(rtb_PrelookupVtas_o1, rtb_PrelookupVtas_o2, PitchNormalLaw_rtP.uDLookupTable_tableData_a);
   rtb_v_target = *rtu_In_V_tas_kn;
   if (rtb_v_target > PitchNormalLaw_rtP.Saturation3_UpperSat_l) {
     rtb_v_target = PitchNormalLaw_rtP.Saturation3_UpperSat_l;
@@ -1973,13 +1896,13 @@ void PitchNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In_nz_
     PitchNormalLaw_rtP.RateLimiterVariableTs_lo_j, rtu_In_time_dt,
     PitchNormalLaw_rtP.RateLimiterVariableTs_InitialCondition_b, &rtb_Y_j, &PitchNormalLaw_DWork.sf_RateLimiter_e);
   rtb_Y_g = rtb_Y_j - *rtu_In_Theta_deg;
-  rtb_Y_i = look1_binlxpw(*rtu_In_V_tas_kn, PitchNormalLaw_rtP.ScheduledGainFlareLawInput_BreakpointsForDimension1,
-    PitchNormalLaw_rtP.ScheduledGainFlareLawInput_Table, 6U);
+  rtb_Y_i = intrp1d_l_pw(rtb_PrelookupVtasInput_o1, rtb_PrelookupVtasInput_o2,
+    PitchNormalLaw_rtP.ScheduledGainFlareLawInput_Table);
   rtb_Y_i = (PitchNormalLaw_rtP.Gain_Gain_i * PitchNormalLaw_rtP.Vm_currentms_Value_j * rtb_Gain1_n + rtb_Gain_bu) -
     ((rtb_Y_g * rtb_Y_i + rtb_Divide_g4) - rtb_Divide1_e) * rtb_Bias_fd;
-  rtb_Y_l = look1_binlxpw(*rtu_In_V_tas_kn, PitchNormalLaw_rtP.PLUT_bp01Data_k, PitchNormalLaw_rtP.PLUT_tableData_bb, 1U);
+  rtb_Y_l = intrp1d_l_pw(rtb_PrelookupVtasGain_o1, rtb_PrelookupVtasGain_o2, PitchNormalLaw_rtP.PLUT_tableData_bb);
   rtb_Bias_fd = rtb_Y_i * rtb_Y_l;
-  rtb_Y_l = look1_binlxpw(*rtu_In_V_tas_kn, PitchNormalLaw_rtP.DLUT_bp01Data_f, PitchNormalLaw_rtP.DLUT_tableData_bf, 1U);
+  rtb_Y_l = intrp1d_l_pw(rtb_PrelookupVtasGain_o1, rtb_PrelookupVtasGain_o2, PitchNormalLaw_rtP.DLUT_tableData_bf);
   rtb_Y_g = rtb_Y_i * rtb_Y_l * PitchNormalLaw_rtP.DiscreteDerivativeVariableTs_Gain_ol;
   rtb_Divide_py = (rtb_Y_g - PitchNormalLaw_DWork.Delay_DSTATE_jv) / *rtu_In_time_dt;
   rtb_Gain1_n = PitchNormalLaw_rtP.DiscreteDerivativeVariableTs2_Gain_m * *rtu_In_V_tas_kn;
@@ -1996,8 +1919,7 @@ void PitchNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In_nz_
 
   PitchNormalLaw_WashoutFilter(rtb_Gain_mj, PitchNormalLaw_rtP.WashoutFilter_C1_p, rtu_In_time_dt, &rtb_Y_j,
     &PitchNormalLaw_DWork.sf_WashoutFilter_ca);
-  rtb_Y_l = look1_binlxpw(*rtu_In_H_radio_ft, PitchNormalLaw_rtP.ScheduledGain_BreakpointsForDimension1_p,
-    PitchNormalLaw_rtP.ScheduledGain_Table_i, 3U);
+  rtb_Y_l = intrp1d_l_pw(rtb_PrelookupHradio_o1, rtb_PrelookupHradio_o2, PitchNormalLaw_rtP.ScheduledGain_Table_i);
   if (rtb_Y_j > PitchNormalLaw_rtP.SaturationSpoilers_UpperSat_m) {
     rtb_Y_j = PitchNormalLaw_rtP.SaturationSpoilers_UpperSat_m;
   } else if (rtb_Y_j < PitchNormalLaw_rtP.SaturationSpoilers_LowerSat_b) {
@@ -2015,9 +1937,9 @@ void PitchNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In_nz_
   rtb_Abs *= PitchNormalLaw_rtP.GainLo_Gain;
   if (rtb_Y_j <= rtb_Sum6) {
     if (rtb_in_rotation > PitchNormalLaw_rtP.LimitSwitchLo_Threshold) {
-      rtb_Sum6 = look2_binlxpw(*rtu_In_qk_deg_s, *rtu_In_eta_deg, PitchNormalLaw_rtP.LimitLo_bp01Data,
-        PitchNormalLaw_rtP.LimitLo_bp02Data, PitchNormalLaw_rtP.LimitLo_tableData, PitchNormalLaw_rtP.LimitLo_maxIndex,
-        7U);
+      rtb_Sum6 = look2_pbinlxpw(*rtu_In_qk_deg_s, *rtu_In_eta_deg, PitchNormalLaw_rtP.LimitLo_bp01Data,
+        PitchNormalLaw_rtP.LimitLo_bp02Data, PitchNormalLaw_rtP.LimitLo_tableData,
+        PitchNormalLaw_DWork.LimitLo_m_bpIndex, PitchNormalLaw_rtP.LimitLo_maxIndex, 7U);
       rtb_Sum6 *= rtb_Abs;
       if (rtb_Sum6 > PitchNormalLaw_rtP.ConstantLo_Value) {
         rtb_Abs = PitchNormalLaw_rtP.ConstantLo_Value;
@@ -2050,8 +1972,7 @@ void PitchNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In_nz_
   rtb_Abs = PitchNormalLaw_rtP.DiscreteDerivativeVariableTs1_Gain_m * *rtu_In_qk_deg_s;
   rtb_Divide_e = (rtb_Abs - PitchNormalLaw_DWork.Delay_DSTATE_kd) / *rtu_In_time_dt;
   rtb_Gain1_e = PitchNormalLaw_rtP.Gain1_Gain_en * *rtu_In_qk_deg_s;
-  rtb_Sum6 = look1_binlxpw(*rtu_In_V_tas_kn, PitchNormalLaw_rtP.uDLookupTable_bp01Data_b,
-    PitchNormalLaw_rtP.uDLookupTable_tableData_h, 6U);
+  rtb_Sum6 = intrp1d_l_pw(rtb_PrelookupVtas_o1, rtb_PrelookupVtas_o2, PitchNormalLaw_rtP.uDLookupTable_tableData_h);
   rtb_v_target = *rtu_In_V_tas_kn;
   if (rtb_v_target > PitchNormalLaw_rtP.Saturation3_UpperSat_b) {
     rtb_v_target = PitchNormalLaw_rtP.Saturation3_UpperSat_b;
@@ -2126,9 +2047,9 @@ void PitchNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In_nz_
   rtb_Sum6 = (PitchNormalLaw_rtP.Gain_Gain_b * PitchNormalLaw_rtP.Vm_currentms_Value_h * rtb_Gain1_e + rtb_Gain_bu) -
     ((((PitchNormalLaw_rtP.Constant_Value_mr - rtb_Sum6) * rtb_Loaddemand + rtb_Y_i * rtb_Sum6) + rtb_Divide_g4) -
      rtb_Divide1_e) * rtb_Bias_p;
-  rtb_Y_i = look1_binlxpw(*rtu_In_V_tas_kn, PitchNormalLaw_rtP.PLUT_bp01Data_f, PitchNormalLaw_rtP.PLUT_tableData_k, 1U);
+  rtb_Y_i = intrp1d_l_pw(rtb_PrelookupVtasGain_o1, rtb_PrelookupVtasGain_o2, PitchNormalLaw_rtP.PLUT_tableData_k);
   rtb_v_target = rtb_Sum6 * rtb_Y_i;
-  rtb_Y_i = look1_binlxpw(*rtu_In_V_tas_kn, PitchNormalLaw_rtP.DLUT_bp01Data_m, PitchNormalLaw_rtP.DLUT_tableData_a, 1U);
+  rtb_Y_i = intrp1d_l_pw(rtb_PrelookupVtasGain_o1, rtb_PrelookupVtasGain_o2, PitchNormalLaw_rtP.DLUT_tableData_a);
   rtb_Divide_g4 = rtb_Sum6 * rtb_Y_i * PitchNormalLaw_rtP.DiscreteDerivativeVariableTs_Gain_b;
   rtb_Y_l = (rtb_Divide_g4 - PitchNormalLaw_DWork.Delay_DSTATE_jh) / *rtu_In_time_dt;
   rtb_Tsxlo = PitchNormalLaw_rtP.DiscreteDerivativeVariableTs2_Gain_c * *rtu_In_V_tas_kn;
@@ -2145,8 +2066,7 @@ void PitchNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In_nz_
   rtb_Gain1_e = PitchNormalLaw_rtP.Gain_Gain_f * rtb_Sum6;
   PitchNormalLaw_WashoutFilter(rtb_Gain_mj, PitchNormalLaw_rtP.WashoutFilter_C1_l, rtu_In_time_dt, &rtb_Sum6,
     &PitchNormalLaw_DWork.sf_WashoutFilter_l);
-  rtb_Y_i = look1_binlxpw(*rtu_In_H_radio_ft, PitchNormalLaw_rtP.ScheduledGain_BreakpointsForDimension1_cx,
-    PitchNormalLaw_rtP.ScheduledGain_Table_g, 3U);
+  rtb_Y_i = intrp1d_l_pw(rtb_PrelookupHradio_o1, rtb_PrelookupHradio_o2, PitchNormalLaw_rtP.ScheduledGain_Table_g);
   if (rtb_Sum6 > PitchNormalLaw_rtP.SaturationSpoilers_UpperSat_o) {
     rtb_Sum6 = PitchNormalLaw_rtP.SaturationSpoilers_UpperSat_o;
   } else if (rtb_Sum6 < PitchNormalLaw_rtP.SaturationSpoilers_LowerSat_jl) {
@@ -2158,8 +2078,7 @@ void PitchNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In_nz_
   rtb_Divide_e = PitchNormalLaw_rtP.DiscreteDerivativeVariableTs1_Gain_c * *rtu_In_qk_deg_s;
   rtb_Y_l = (rtb_Divide_e - PitchNormalLaw_DWork.Delay_DSTATE_e5) / *rtu_In_time_dt;
   rtb_Y_i = PitchNormalLaw_rtP.Gain1_Gain_b * *rtu_In_qk_deg_s;
-  rtb_Sum6 = look1_binlxpw(*rtu_In_V_tas_kn, PitchNormalLaw_rtP.uDLookupTable_bp01Data_a,
-    PitchNormalLaw_rtP.uDLookupTable_tableData_p, 6U);
+  rtb_Sum6 = intrp1d_l_pw(rtb_PrelookupVtas_o1, rtb_PrelookupVtas_o2, PitchNormalLaw_rtP.uDLookupTable_tableData_p);
   rtb_v_target = *rtu_In_V_tas_kn;
   if (rtb_v_target > PitchNormalLaw_rtP.Saturation3_UpperSat_n) {
     rtb_v_target = PitchNormalLaw_rtP.Saturation3_UpperSat_n;
@@ -2170,9 +2089,9 @@ void PitchNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In_nz_
   rtb_Sum6 = (PitchNormalLaw_rtP.Gain_Gain_p * PitchNormalLaw_rtP.Vm_currentms_Value_pb * rtb_Y_i + rtb_Gain_bu) -
     (rtb_Sum6 / (PitchNormalLaw_rtP.Gain5_Gain_n * rtb_v_target) + PitchNormalLaw_rtP.Bias_Bias_ai) * (rtb_Y_b -
     rtb_Divide1_e);
-  rtb_Y_i = look1_binlxpw(*rtu_In_V_tas_kn, PitchNormalLaw_rtP.PLUT_bp01Data_a, PitchNormalLaw_rtP.PLUT_tableData_o, 1U);
+  rtb_Y_i = intrp1d_l_pw(rtb_PrelookupVtasGain_o1, rtb_PrelookupVtasGain_o2, PitchNormalLaw_rtP.PLUT_tableData_o);
   rtb_Bias_p = rtb_Sum6 * rtb_Y_i;
-  rtb_Y_i = look1_binlxpw(*rtu_In_V_tas_kn, PitchNormalLaw_rtP.DLUT_bp01Data_k, PitchNormalLaw_rtP.DLUT_tableData_e, 1U);
+  rtb_Y_i = intrp1d_l_pw(rtb_PrelookupVtasGain_o1, rtb_PrelookupVtasGain_o2, PitchNormalLaw_rtP.DLUT_tableData_e);
   rtb_Y_b = rtb_Sum6 * rtb_Y_i * PitchNormalLaw_rtP.DiscreteDerivativeVariableTs_Gain_p;
   rtb_Loaddemand = (rtb_Y_b - PitchNormalLaw_DWork.Delay_DSTATE_gz) / *rtu_In_time_dt;
   rtb_Gain1_e = PitchNormalLaw_rtP.DiscreteDerivativeVariableTs2_Gain_a * *rtu_In_V_tas_kn;
@@ -2189,8 +2108,7 @@ void PitchNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In_nz_
   rtb_Gain_ny = PitchNormalLaw_rtP.Gain_Gain_k * rtb_Sum6;
   PitchNormalLaw_WashoutFilter(rtb_Gain_mj, PitchNormalLaw_rtP.WashoutFilter_C1_h, rtu_In_time_dt, &rtb_Sum6,
     &PitchNormalLaw_DWork.sf_WashoutFilter_d);
-  rtb_Y_i = look1_binlxpw(*rtu_In_H_radio_ft, PitchNormalLaw_rtP.ScheduledGain_BreakpointsForDimension1_f,
-    PitchNormalLaw_rtP.ScheduledGain_Table_ha, 3U);
+  rtb_Y_i = intrp1d_l_pw(rtb_PrelookupHradio_o1, rtb_PrelookupHradio_o2, PitchNormalLaw_rtP.ScheduledGain_Table_ha);
   rtb_v_target = (((PitchNormalLaw_rtP.Gain3_Gain_m * rtb_Divide_cq + rtb_Product1_ck) + rtb_Divide_l) +
                   PitchNormalLaw_rtP.Gain_Gain_j * rtb_Gain1_b) + rtb_Product_n3;
   if (rtb_Sum6 > PitchNormalLaw_rtP.SaturationSpoilers_UpperSat_h) {
@@ -2224,8 +2142,7 @@ void PitchNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In_nz_
   rtb_Divide_cq = PitchNormalLaw_rtP.DiscreteDerivativeVariableTs1_Gain_k * *rtu_In_qk_deg_s;
   rtb_Divide_l = (rtb_Divide_cq - PitchNormalLaw_DWork.Delay_DSTATE_h) / *rtu_In_time_dt;
   rtb_Gain1_b = PitchNormalLaw_rtP.Gain1_Gain_lk * *rtu_In_qk_deg_s;
-  rtb_Sum6 = look1_binlxpw(*rtu_In_V_tas_kn, PitchNormalLaw_rtP.uDLookupTable_bp01Data_m,
-    PitchNormalLaw_rtP.uDLookupTable_tableData_ax, 6U);
+  rtb_Sum6 = intrp1d_l_pw(rtb_PrelookupVtas_o1, rtb_PrelookupVtas_o2, PitchNormalLaw_rtP.uDLookupTable_tableData_ax);
   rtb_v_target = *rtu_In_V_tas_kn;
   rtb_Product1_ck = PitchNormalLaw_rtP.Gain3_Gain_g2 * PitchNormalLaw_rtP.Theta_max3_Value - rtb_Saturation3;
   if (rtb_v_target > PitchNormalLaw_rtP.Saturation3_UpperSat_ev) {
@@ -2244,9 +2161,9 @@ void PitchNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In_nz_
     (rtb_Sum6 / (PitchNormalLaw_rtP.Gain5_Gain_mu * rtb_v_target) + PitchNormalLaw_rtP.Bias_Bias_m) * ((rtb_Divide1_e +
     look1_binlxpw(rtb_Product1_ck, PitchNormalLaw_rtP.Loaddemand2_bp01Data, PitchNormalLaw_rtP.Loaddemand2_tableData, 2U))
     - rtb_Divide1_e);
-  rtb_Y_i = look1_binlxpw(*rtu_In_V_tas_kn, PitchNormalLaw_rtP.PLUT_bp01Data_e, PitchNormalLaw_rtP.PLUT_tableData_g, 1U);
+  rtb_Y_i = intrp1d_l_pw(rtb_PrelookupVtasGain_o1, rtb_PrelookupVtasGain_o2, PitchNormalLaw_rtP.PLUT_tableData_g);
   rtb_Saturation3 = rtb_Sum6 * rtb_Y_i;
-  rtb_Y_i = look1_binlxpw(*rtu_In_V_tas_kn, PitchNormalLaw_rtP.DLUT_bp01Data_hw, PitchNormalLaw_rtP.DLUT_tableData_l, 1U);
+  rtb_Y_i = intrp1d_l_pw(rtb_PrelookupVtasGain_o1, rtb_PrelookupVtasGain_o2, PitchNormalLaw_rtP.DLUT_tableData_l);
   rtb_Divide1_e = rtb_Sum6 * rtb_Y_i * PitchNormalLaw_rtP.DiscreteDerivativeVariableTs_Gain_c;
   rtb_Product1_ck = (rtb_Divide1_e - PitchNormalLaw_DWork.Delay_DSTATE_ds) / *rtu_In_time_dt;
   rtb_Gain_bu = PitchNormalLaw_rtP.DiscreteDerivativeVariableTs2_Gain_p * *rtu_In_V_tas_kn;
@@ -2263,8 +2180,7 @@ void PitchNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In_nz_
   rtb_Gain1_b = PitchNormalLaw_rtP.Gain_Gain_l0 * rtb_Sum6;
   PitchNormalLaw_WashoutFilter(rtb_Gain_mj, PitchNormalLaw_rtP.WashoutFilter_C1_j, rtu_In_time_dt, &rtb_Sum6,
     &PitchNormalLaw_DWork.sf_WashoutFilter);
-  rtb_Y_i = look1_binlxpw(*rtu_In_H_radio_ft, PitchNormalLaw_rtP.ScheduledGain_BreakpointsForDimension1_b,
-    PitchNormalLaw_rtP.ScheduledGain_Table_e, 3U);
+  rtb_Y_i = intrp1d_l_pw(rtb_PrelookupHradio_o1, rtb_PrelookupHradio_o2, PitchNormalLaw_rtP.ScheduledGain_Table_e);
   rtb_v_target = (((PitchNormalLaw_rtP.Gain3_Gain * rtb_Divide + rtb_Product1_dm) + rtb_Divide_o) +
                   PitchNormalLaw_rtP.Gain_Gain_l * rtb_Divide_c4) + rtb_Product_kz;
   if (rtb_Sum6 > PitchNormalLaw_rtP.SaturationSpoilers_UpperSat_mf) {
@@ -2288,11 +2204,12 @@ void PitchNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In_nz_
   }
 
   PitchNormalLaw_VoterAttitudeProtection(rtb_v_target, rtb_Y_l, rtb_Product1_ck, &rtb_Y_i);
-  rtb_Sum6 = look1_binlxpw(*rtu_In_V_ias_kn, PitchNormalLaw_rtP.ScheduledGain1_BreakpointsForDimension1,
-    PitchNormalLaw_rtP.ScheduledGain1_Table, 4U);
+  rtb_PrelookupVias_o1 = plook_binxp(*rtu_In_V_ias_kn, PitchNormalLaw_rtP.ScheduledGain1_BreakpointsForDimension1, 4U,
+    &rtb_PrelookupVias_o2, &PitchNormalLaw_DWork.PrelookupVias_m_bpIndex);
+  rtb_Sum6 = intrp1d_l_pw(rtb_PrelookupVias_o1, rtb_PrelookupVias_o2, PitchNormalLaw_rtP.ScheduledGain1_Table);
   rtb_Divide = rtb_Y_i * rtb_Sum6;
-  rtb_Sum6 = look1_binlxpw(*rtu_In_time_dt, PitchNormalLaw_rtP.ScheduledGain_BreakpointsForDimension1_d,
-    PitchNormalLaw_rtP.ScheduledGain_Table_hh, 4U);
+  rtb_Sum6 = look1_pbinlxpw(*rtu_In_time_dt, PitchNormalLaw_rtP.ScheduledGain_BreakpointsForDimension1_d,
+    PitchNormalLaw_rtP.ScheduledGain_Table_hh, &PitchNormalLaw_DWork.ScheduledGain_m_bpIndex_hh, 4U);
   rtb_Sum6 = rtb_Divide * rtb_Sum6 * PitchNormalLaw_rtP.DiscreteTimeIntegratorVariableTs_Gain * *rtu_In_time_dt;
   rtb_OR = ((rtb_Y_i1 == 0.0) || (*rtu_In_tracking_mode_on));
   if (*rtu_In_in_flight > PitchNormalLaw_rtP.Switch_Threshold) {
@@ -2327,9 +2244,9 @@ void PitchNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In_nz_
     PitchNormalLaw_rtP.RateLimiterVariableTs_lo_i, rtu_In_time_dt,
     PitchNormalLaw_rtP.RateLimiterVariableTs_InitialCondition_m, &rtb_Y_l, &PitchNormalLaw_DWork.sf_RateLimiter_ct);
   rtb_Sum6 = *rtu_In_tailstrike_protection_on;
-  rtb_Y_i = look2_binlxpw(*rtu_In_Theta_deg, *rtu_In_H_radio_ft, PitchNormalLaw_rtP.uDLookupTable_bp01Data_l,
+  rtb_Y_i = look2_pbinlxpw(*rtu_In_Theta_deg, *rtu_In_H_radio_ft, PitchNormalLaw_rtP.uDLookupTable_bp01Data_l,
     PitchNormalLaw_rtP.uDLookupTable_bp02Data, PitchNormalLaw_rtP.uDLookupTable_tableData_e5,
-    PitchNormalLaw_rtP.uDLookupTable_maxIndex, 5U);
+    PitchNormalLaw_DWork.uDLookupTable_m_bpIndex_e5, PitchNormalLaw_rtP.uDLookupTable_maxIndex, 5U);
   if (rtb_Y_l > PitchNormalLaw_rtP.Saturation3_UpperSat_lt) {
     rtb_Switch_f = PitchNormalLaw_rtP.Saturation3_UpperSat_lt;
   } else if (rtb_Y_l < PitchNormalLaw_rtP.Saturation3_LowerSat_h) {
@@ -2354,8 +2271,7 @@ void PitchNormalLaw::step(const real_T *rtu_In_time_dt, const real_T *rtu_In_nz_
   rtb_Product1_ck = PitchNormalLaw_rtP.Gain6_Gain_g * *rtu_In_qk_dot_deg_s2;
   rtb_Divide_c4 = (((rtb_Gain_mj + rtb_Product_kz) * PitchNormalLaw_rtP.Gain1_Gain_a + PitchNormalLaw_rtP.Gain3_Gain_e *
                     rtb_Divide_c4) + (rtb_Y_i - rtb_Sum6) * PitchNormalLaw_rtP.Gain4_Gain) + rtb_Product1_ck;
-  rtb_Sum6 = look1_binlxpw(*rtu_In_V_ias_kn, PitchNormalLaw_rtP.ScheduledGain1_BreakpointsForDimension1_h,
-    PitchNormalLaw_rtP.ScheduledGain1_Table_c, 4U);
+  rtb_Sum6 = intrp1d_l_pw(rtb_PrelookupVias_o1, rtb_PrelookupVias_o2, PitchNormalLaw_rtP.ScheduledGain1_Table_c);
   rtb_Sum6 = (PitchNormalLaw_rtP.Constant2_Value_k - rtb_Y_i1) * (rtb_Divide_c4 * rtb_Sum6) *
     PitchNormalLaw_rtP.DiscreteTimeIntegratorVariableTs_Gain_j * *rtu_In_time_dt;
   rtb_OR = (*rtu_In_delta_eta_pos <= PitchNormalLaw_rtP.Constant_Value_o);
@@ -2460,6 +2376,7 @@ PitchNormalLaw::PitchNormalLaw():
   PitchNormalLaw_B(),
   PitchNormalLaw_DWork()
 {
+  static_assert(plook_evenx_bpSpaceInv_matches(PitchNormalLaw_rtP.uDLookupTable_bp01Data, 0.02, 6U));
 }
 
 PitchNormalLaw::~PitchNormalLaw() = default;
@@ -94,6 +94,13 @@ class PitchNormalLaw final
     real_T Delay_DSTATE_ej;
     real_T Delay_DSTATE_e4;
     real_T Delay_DSTATE_cl;
+    uint32_T PrelookupHradio_m_bpIndex;
+    uint32_T PrelookupVtasInput_m_bpIndex;
+    uint32_T LimitUp_m_bpIndex[2];
+    uint32_T LimitLo_m_bpIndex[2];
+    uint32_T PrelookupVias_m_bpIndex;
+    uint32_T ScheduledGain_m_bpIndex_hh;
+    uint32_T uDLookupTable_m_bpIndex_e5[2];
     uint8_T is_active_c6_PitchNormalLaw;
     uint8_T is_c6_PitchNormalLaw;
     uint8_T is_active_c7_PitchNormalLaw;
@@ -142,17 +149,9 @@ class PitchNormalLaw final
 
   struct Parameters_PitchNormalLaw_T {
     real_T ScheduledGain_BreakpointsForDimension1[4];
-    real_T ScheduledGain_BreakpointsForDimension1_n[4];
     real_T ScheduledGainAutopilotInput_BreakpointsForDimension1[7];
-    real_T ScheduledGain_BreakpointsForDimension1_c[4];
-    real_T ScheduledGainFlareLawInput_BreakpointsForDimension1[7];
-    real_T ScheduledGain_BreakpointsForDimension1_p[4];
-    real_T ScheduledGain_BreakpointsForDimension1_cx[4];
-    real_T ScheduledGain_BreakpointsForDimension1_f[4];
-    real_T ScheduledGain_BreakpointsForDimension1_b[4];
     real_T ScheduledGain1_BreakpointsForDimension1[5];
     real_T ScheduledGain_BreakpointsForDimension1_d[5];
-    real_T ScheduledGain1_BreakpointsForDimension1_h[5];
     real_T LagFilter_C1;
     real_T LagFilter_C1_i;
     real_T WashoutFilter_C1;
@@ -349,11 +348,6 @@ class PitchNormalLaw final
     real_T Saturation_LowerSat_n;
     real_T Saturation1_UpperSat;
     real_T Saturation1_LowerSat;
-    real_T Constant_Value_j;
-    real_T Constant_Value_c;
-    real_T Constant_Value_a;
-    real_T Constant_Value_m;
-    real_T Constant_Value_mo;
     real_T Gain2_Gain;
     real_T Gain1_Gain_m;
     real_T Saturation1_UpperSat_i;
@@ -363,7 +357,6 @@ class PitchNormalLaw final
     real_T PLUT_tableData[2];
     real_T PLUT_bp01Data[2];
     real_T DLUT_tableData[2];
-    real_T DLUT_bp01Data[2];
     real_T SaturationV_dot_UpperSat;
     real_T SaturationV_dot_LowerSat;
     real_T Gain_Gain_l;
@@ -376,15 +369,12 @@ class PitchNormalLaw final
     real_T Vm_currentms_Value_e;
     real_T Gain_Gain_al;
     real_T uDLookupTable_tableData_e[7];
-    real_T uDLookupTable_bp01Data_o[7];
     real_T Saturation3_UpperSat_a;
     real_T Saturation3_LowerSat_l;
     real_T Gain5_Gain_d;
     real_T Bias_Bias_a;
     real_T PLUT_tableData_b[2];
-    real_T PLUT_bp01Data_b[2];
     real_T DLUT_tableData_p[2];
-    real_T DLUT_bp01Data_h[2];
     real_T SaturationV_dot_UpperSat_j;
     real_T SaturationV_dot_LowerSat_e;
     real_T Gain_Gain_j;
@@ -397,7 +387,6 @@ class PitchNormalLaw final
     real_T Vm_currentms_Value_p;
     real_T Gain_Gain_h;
     real_T uDLookupTable_tableData_i[7];
-    real_T uDLookupTable_bp01Data_h[7];
     real_T Saturation3_UpperSat_e;
     real_T Saturation3_LowerSat_f;
     real_T Gain5_Gain_m;
@@ -406,9 +395,7 @@ class PitchNormalLaw final
     real_T Saturation_LowerSat_o1;
     real_T Gain1_Gain_lm;
     real_T PLUT_tableData_a[2];
-    real_T PLUT_bp01Data_d[2];
     real_T DLUT_tableData_b[2];
-    real_T DLUT_bp01Data_g[2];
     real_T SaturationV_dot_UpperSat_b;
     real_T SaturationV_dot_LowerSat_l;
     real_T Gain_Gain_ae;
@@ -443,7 +430,6 @@ class PitchNormalLaw final
     real_T Vm_currentms_Value_j;
     real_T Gain_Gain_i;
     real_T uDLookupTable_tableData_a[7];
-    real_T uDLookupTable_bp01Data_c[7];
     real_T Saturation3_UpperSat_l;
     real_T Saturation3_LowerSat_lu;
     real_T Gain5_Gain_g;
@@ -453,9 +439,7 @@ class PitchNormalLaw final
     real_T Constant_Value_fu;
     real_T Delay1_InitialCondition_d;
     real_T PLUT_tableData_bb[2];
-    real_T PLUT_bp01Data_k[2];
     real_T DLUT_tableData_bf[2];
-    real_T DLUT_bp01Data_f[2];
     real_T SaturationV_dot_UpperSat_d;
     real_T SaturationV_dot_LowerSat_g;
     real_T Gain_Gain_m;
@@ -472,7 +456,6 @@ class PitchNormalLaw final
     real_T Vm_currentms_Value_h;
     real_T Gain_Gain_b;
     real_T uDLookupTable_tableData_h[7];
-    real_T uDLookupTable_bp01Data_b[7];
     real_T Saturation3_UpperSat_b;
     real_T Saturation3_LowerSat_e;
     real_T Gain5_Gain_e;
@@ -490,9 +473,7 @@ class PitchNormalLaw final
     real_T Saturation_LowerSat_m;
     real_T Constant_Value_mr;
     real_T PLUT_tableData_k[2];
-    real_T PLUT_bp01Data_f[2];
     real_T DLUT_tableData_a[2];
-    real_T DLUT_bp01Data_m[2];
     real_T SaturationV_dot_UpperSat_bx;
     real_T SaturationV_dot_LowerSat_m;
     real_T Gain_Gain_f;
@@ -505,15 +486,12 @@ class PitchNormalLaw final
     real_T Vm_currentms_Value_pb;
     real_T Gain_Gain_p;
     real_T uDLookupTable_tableData_p[7];
-    real_T uDLookupTable_bp01Data_a[7];
     real_T Saturation3_UpperSat_n;
     real_T Saturation3_LowerSat_a;
     real_T Gain5_Gain_n;
     real_T Bias_Bias_ai;
     real_T PLUT_tableData_o[2];
-    real_T PLUT_bp01Data_a[2];
     real_T DLUT_tableData_e[2];
-    real_T DLUT_bp01Data_k[2];
     real_T SaturationV_dot_UpperSat_m;
     real_T SaturationV_dot_LowerSat_ek;
     real_T Gain_Gain_k;
@@ -526,7 +504,6 @@ class PitchNormalLaw final
     real_T Vm_currentms_Value_b;
     real_T Gain_Gain_jq;
     real_T uDLookupTable_tableData_ax[7];
-    real_T uDLookupTable_bp01Data_m[7];
     real_T Saturation3_UpperSat_ev;
     real_T Saturation3_LowerSat_k;
     real_T Gain5_Gain_mu;
@@ -538,9 +515,7 @@ class PitchNormalLaw final
     real_T Loaddemand2_tableData[3];
     real_T Loaddemand2_bp01Data[3];
     real_T PLUT_tableData_g[2];
-    real_T PLUT_bp01Data_e[2];
     real_T DLUT_tableData_l[2];
-    real_T DLUT_bp01Data_hw[2];
     real_T SaturationV_dot_UpperSat_j2;
     real_T SaturationV_dot_LowerSat_n;
     real_T Gain_Gain_l0;
@@ -606,7 +581,7 @@ class PitchNormalLaw final
  private:
   BlockIO_PitchNormalLaw_T PitchNormalLaw_B;
   D_Work_PitchNormalLaw_T PitchNormalLaw_DWork;
-  static Parameters_PitchNormalLaw_T PitchNormalLaw_rtP;
+  static const Parameters_PitchNormalLaw_T PitchNormalLaw_rtP;
   static void PitchNormalLaw_LagFilter_Reset(rtDW_LagFilter_PitchNormalLaw_T *localDW);
   static void PitchNormalLaw_LagFilter(const real_T *rtu_U, real_T rtu_C1, const real_T *rtu_dt, real_T *rty_Y,
     rtDW_LagFilter_PitchNormalLaw_T *localDW);
@@ -629,7 +604,7 @@ class PitchNormalLaw final
     *rty_vote);
 };
 
-extern PitchNormalLaw::Parameters_PitchNormalLaw_T PitchNormalLaw_rtP;
+extern const PitchNormalLaw::Parameters_PitchNormalLaw_T PitchNormalLaw_rtP;
 
 #endif
 
@@ -1,8 +1,8 @@
 #include "SecComputer.h"
 #include "SecComputer_types.h"
+#include "look1_pbinlxpw.h"
 #include "rtwtypes.h"
 #include <cmath>
-#include "look1_binlxpw.h"
 #include "LateralDirectLaw.h"
 #include "PitchAlternateLaw.h"
 #include "PitchDirectLaw.h"
@@ -848,8 +848,8 @@ void SecComputer::step()
         }
       }
 
-      rtb_Switch3 = look1_binlxpw(rtb_Switch5, SecComputer_P.uDLookupTable_bp01Data,
-        SecComputer_P.uDLookupTable_tableData, 4U);
+      rtb_Switch3 = look1_pbinlxpw(rtb_Switch5, SecComputer_P.uDLookupTable_bp01Data,
+        SecComputer_P.uDLookupTable_tableData, &SecComputer_DWork.uDLookupTable_m_bpIndex, 4U);
     }
 
     SecComputer_RateLimiter(rtb_Switch3, SecComputer_P.RateLimiterVariableTs1_up,
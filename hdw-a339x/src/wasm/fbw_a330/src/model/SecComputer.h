@@ -7,10 +7,6 @@
 #include "PitchDirectLaw.h"
 
 extern const real_T SecComputer_RGND;
-extern base_sec_logic_outputs rtP_sec_logic_output_MATLABStruct;
-extern base_sec_analog_outputs rtP_sec_analog_output_MATLABStruct;
-extern base_sec_laws_outputs rtP_sec_laws_output_MATLABStruct;
-extern base_sec_discrete_outputs rtP_sec_discrete_output_MATLABStruct;
 class SecComputer final
 {
  public:
@@ -42,6 +38,7 @@ class SecComputer final
     real_T Delay_DSTATE;
     real_T Delay_DSTATE_l;
     real_T on_ground_time;
+    uint32_T uDLookupTable_m_bpIndex;
     boolean_T Delay_DSTATE_c;
     boolean_T Delay1_DSTATE;
     boolean_T Delay1_DSTATE_i;
@@ -168,7 +165,6 @@ class SecComputer final
     real_T CompareToConstant8_const;
     real_T CompareToConstant2_const_f;
     real_T CompareToConstant3_const_o;
-    real_T CompareToConstant1_const_p;
     real_T RateLimiterVariableTs6_lo;
     real_T RateLimiterVariableTs1_lo;
     real_T RateLimiterGenericVariableTs_lo;
@@ -216,7 +212,6 @@ class SecComputer final
     boolean_T PulseNode_isRisingEdge_hj;
     boolean_T ConfirmNode_isRisingEdge_c;
     sec_outputs out_Y0;
-    base_sec_out_bus Constant4_Value;
     real_T Constant_Value;
     real_T Constant1_Value;
     real_T Constant2_Value;
@@ -290,6 +285,11 @@ class SecComputer final
     SecComputer_U = *pExternalInputs_SecComputer_T;
   }
 
+  ExternalInputs_SecComputer_T &getExternalInputs()
+  {
+    return SecComputer_U;
+  }
+
   const ExternalOutputs_SecComputer_T &getExternalOutputs() const
   {
     return SecComputer_Y;
@@ -305,7 +305,7 @@ class SecComputer final
   ExternalOutputs_SecComputer_T SecComputer_Y;
   BlockIO_SecComputer_T SecComputer_B;
   D_Work_SecComputer_T SecComputer_DWork;
-  static Parameters_SecComputer_T SecComputer_P;
+  static const Parameters_SecComputer_T SecComputer_P;
   static void SecComputer_MATLABFunction(const base_arinc_429 *rtu_u, real_T rtu_bit, uint32_T *rty_y);
   static void SecComputer_RateLimiter_Reset(rtDW_RateLimiter_SecComputer_T *localDW);
   static void SecComputer_RateLimiter(real_T rtu_u, real_T rtu_up, real_T rtu_lo, real_T rtu_Ts, real_T rtu_init, real_T
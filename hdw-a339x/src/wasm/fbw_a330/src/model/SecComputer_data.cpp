@@ -1,104 +1,6 @@
 #include "SecComputer.h"
 
-base_sec_logic_outputs rtP_sec_logic_output_MATLABStruct{
-  false,
-  false,
-  false,
-  pitch_efcs_law::None,
-  pitch_efcs_law::None,
-  false,
-  false,
-  false,
-  false,
-  false,
-  false,
-  false,
-  false,
-  false,
-  false,
-  false,
-  false,
-  false,
-  false,
-  false,
-  false,
-  false,
-  false,
-  false,
-  0.0,
-  0.0,
-  false,
-  false,
-  false,
-  false,
-  false,
-  false,
-  false,
-  false,
-  false,
-  false,
-  false,
-
-  {
-    0.0,
-    0.0,
-    0.0,
-    0.0
-  },
-
-  {
-    0.0,
-    0.0,
-    0.0,
-    0.0,
-    0.0,
-    0.0,
-    0.0,
-    0.0,
-    0.0
-  },
-  false,
-  false
-} ;
-
-base_sec_analog_outputs rtP_sec_analog_output_MATLABStruct{
-  0.0,
-  0.0,
-  0.0,
-  0.0,
-  0.0,
-  0.0,
-  0.0
-} ;
-
-base_sec_laws_outputs rtP_sec_laws_output_MATLABStruct{
-  {
-    0.0,
-    0.0,
-    0.0,
-    0.0,
-    0.0
-  },
-
-  {
-    0.0,
-    0.0
-  }
-} ;
-
-base_sec_discrete_outputs rtP_sec_discrete_output_MATLABStruct{
-  false,
-  false,
-  false,
-  false,
-  false,
-  false,
-  false,
-  false,
-  false
-} ;
-
-SecComputer::Parameters_SecComputer_T SecComputer::SecComputer_P{
+const SecComputer::Parameters_SecComputer_T SecComputer::SecComputer_P{
 
   1.0,
 
@@ -250,8 +152,6 @@ SecComputer::Parameters_SecComputer_T SecComputer::SecComputer_P{
 
   2.0,
 
-  3.0,
-
   -20.0,
 
   -5.0,
@@ -1524,94 +1424,6 @@ SecComputer::Parameters_SecComputer_T SecComputer::SecComputer_P{
     }
   },
 
-
-  {
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    },
-
-    {
-      0U,
-      0.0F
-    }
-  },
-
   -50.0,
 
   -10.0,
@@ -0,0 +1,35 @@
+#include "binsearch_u32d_prevIdx.h"
+#include "rtwtypes.h"
+
+uint32_T binsearch_u32d_prevIdx(real_T u, const real_T bp[], uint32_T startIndex, uint32_T maxIndex)
+{
+  uint32_T bpIdx;
+  uint32_T iLeft;
+  uint32_T iRght;
+  if (u < bp[startIndex]) {
+    if (u >= bp[startIndex - 1U]) {
+      return startIndex - 1U;
+    }
+
+    iLeft = 0U;
+    iRght = startIndex - 1U;
+  } else if (u < bp[startIndex + 1U]) {
+    return startIndex;
+  } else if (u < bp[startIndex + 2U]) {
+    return startIndex + 1U;
+  } else {
+    iLeft = startIndex + 2U;
+    iRght = maxIndex;
+  }
+
+  while (iRght - iLeft > 1U) {
+    bpIdx = (iRght + iLeft) >> 1U;
+    if (u < bp[bpIdx]) {
+      iRght = bpIdx;
+    } else {
+      iLeft = bpIdx;
+    }
+  }
+
+  return iLeft;
+}
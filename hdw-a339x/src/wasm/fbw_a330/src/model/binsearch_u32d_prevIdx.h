@@ -0,0 +1,8 @@
+#ifndef binsearch_u32d_prevIdx_h_
+#define binsearch_u32d_prevIdx_h_
+#include "rtwtypes.h"
+
+extern uint32_T binsearch_u32d_prevIdx(real_T u, const real_T bp[], uint32_T startIndex, uint32_T maxIndex);
+
+#endif
+
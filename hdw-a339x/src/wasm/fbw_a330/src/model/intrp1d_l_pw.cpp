@@ -0,0 +1,9 @@
+#include "intrp1d_l_pw.h"
+#include "rtwtypes.h"
+
+real_T intrp1d_l_pw(uint32_T bpIndex, real_T frac, const real_T table[])
+{
+  real_T yL_0d0;
+  yL_0d0 = table[bpIndex];
+  return (table[bpIndex + 1U] - yL_0d0) * frac + yL_0d0;
+}
@@ -0,0 +1,8 @@
+#ifndef intrp1d_l_pw_h_
+#define intrp1d_l_pw_h_
+#include "rtwtypes.h"
+
+extern real_T intrp1d_l_pw(uint32_T bpIndex, real_T frac, const real_T table[]);
+
+#endif
+
@@ -0,0 +1,8 @@
+#ifndef intrp2d_l_pw_h_
+#define intrp2d_l_pw_h_
+#include "rtwtypes.h"
+
+extern real_T intrp2d_l_pw(const uint32_T bpIndex[], const real_T frac[], const real_T table[], const uint32_T stride);
+
+#endif
+
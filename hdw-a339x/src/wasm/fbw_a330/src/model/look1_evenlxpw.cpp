@@ -0,0 +1,37 @@
+#include "look1_evenlxpw.h"
+#include "rtwtypes.h"
+
+real_T look1_evenlxpw(real_T u0, const real_T bp0[], const real_T table[], real_T bpSpaceInv, uint32_T maxIndex)
+{
+  real_T fbpIndex;
+  real_T frac;
+  real_T yL_0d0;
+  uint32_T iLeft;
+  if (u0 <= bp0[0U]) {
+    iLeft = 0U;
+    frac = (u0 - bp0[0U]) / (bp0[1U] - bp0[0U]);
+  } else if (u0 < bp0[maxIndex]) {
+    fbpIndex = (u0 - bp0[0U]) * bpSpaceInv;
+    if (fbpIndex < maxIndex) {
+      iLeft = static_cast<uint32_T>(fbpIndex);
+    } else {
+      iLeft = maxIndex - 1U;
+    }
+
+    while (u0 < bp0[iLeft]) {
+      iLeft--;
+    }
+
+    while (u0 >= bp0[iLeft + 1U]) {
+      iLeft++;
+    }
+
+    frac = (u0 - bp0[iLeft]) / (bp0[iLeft + 1U] - bp0[iLeft]);
+  } else {
+    iLeft = maxIndex - 1U;
+    frac = (u0 - bp0[maxIndex - 1U]) / (bp0[maxIndex] - bp0[maxIndex - 1U]);
+  }
+
+  yL_0d0 = table[iLeft];
+  return (table[iLeft + 1U] - yL_0d0) * frac + yL_0d0;
+}
@@ -0,0 +1,8 @@
+#ifndef look1_evenlxpw_h_
+#define look1_evenlxpw_h_
+#include "rtwtypes.h"
+
+extern real_T look1_evenlxpw(real_T u0, const real_T bp0[], const real_T table[], real_T bpSpaceInv, uint32_T maxIndex);
+
+#endif
+
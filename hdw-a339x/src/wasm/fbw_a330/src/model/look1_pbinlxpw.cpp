@@ -0,0 +1,24 @@
+#include "look1_pbinlxpw.h"
+#include "binsearch_u32d_prevIdx.h"
+#include "rtwtypes.h"
+
+real_T look1_pbinlxpw(real_T u0, const real_T bp0[], const real_T table[], uint32_T *prevIndex, uint32_T maxIndex)
+{
+  real_T frac;
+  real_T yL_0d0;
+  uint32_T iLeft;
+  if (u0 <= bp0[0U]) {
+    iLeft = 0U;
+    frac = (u0 - bp0[0U]) / (bp0[1U] - bp0[0U]);
+  } else if (u0 < bp0[maxIndex]) {
+    iLeft = binsearch_u32d_prevIdx(u0, bp0, *prevIndex, maxIndex);
+    frac = (u0 - bp0[iLeft]) / (bp0[iLeft + 1U] - bp0[iLeft]);
+  } else {
+    iLeft = maxIndex - 1U;
+    frac = (u0 - bp0[maxIndex - 1U]) / (bp0[maxIndex] - bp0[maxIndex - 1U]);
+  }
+
+  *prevIndex = iLeft;
+  yL_0d0 = table[iLeft];
+  return (table[iLeft + 1U] - yL_0d0) * frac + yL_0d0;
+}
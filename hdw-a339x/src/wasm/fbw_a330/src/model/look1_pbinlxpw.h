@@ -0,0 +1,9 @@
+#ifndef look1_pbinlxpw_h_
+#define look1_pbinlxpw_h_
+#include "rtwtypes.h"
+
+extern real_T look1_pbinlxpw(real_T u0, const real_T bp0[], const real_T table[], uint32_T *prevIndex, uint32_T
+  maxIndex);
+
+#endif
+
@@ -1,4 +1,5 @@
 #include "look2_pbinlxpw.h"
+#include "binsearch_u32d_prevIdx.h"
 #include "rtwtypes.h"
 
 real_T look2_pbinlxpw(real_T u0, real_T u1, const real_T bp0[], const real_T bp1[], const real_T table[], uint32_T
@@ -10,29 +11,12 @@ real_T look2_pbinlxpw(real_T u0, real_T u1, const real_T bp0[], const real_T bp1
   real_T yL_0d1;
   uint32_T bpIndices[2];
   uint32_T bpIdx;
-  uint32_T found;
   uint32_T iLeft;
-  uint32_T iRght;
   if (u0 <= bp0[0U]) {
     bpIdx = 0U;
     frac = (u0 - bp0[0U]) / (bp0[1U] - bp0[0U]);
   } else if (u0 < bp0[maxIndex[0U]]) {
-    bpIdx = prevIndex[0U];
-    iLeft = 0U;
-    iRght = maxIndex[0U];
-    found = 0U;
-    while (found == 0U) {
-      if (u0 < bp0[bpIdx]) {
-        iRght = bpIdx - 1U;
-        bpIdx = ((bpIdx + iLeft) - 1U) >> 1U;
-      } else if (u0 < bp0[bpIdx + 1U]) {
-        found = 1U;
-      } else {
-        iLeft = bpIdx + 1U;
-        bpIdx = ((bpIdx + iRght) + 1U) >> 1U;
-      }
-    }
-
+    bpIdx = binsearch_u32d_prevIdx(u0, bp0, prevIndex[0U], maxIndex[0U]);
     frac = (u0 - bp0[bpIdx]) / (bp0[bpIdx + 1U] - bp0[bpIdx]);
   } else {
     bpIdx = maxIndex[0U] - 1U;
@@ -46,22 +30,7 @@ real_T look2_pbinlxpw(real_T u0, real_T u1, const real_T bp0[], const real_T bp1
     bpIdx = 0U;
     frac = (u1 - bp1[0U]) / (bp1[1U] - bp1[0U]);
   } else if (u1 < bp1[maxIndex[1U]]) {
-    bpIdx = prevIndex[1U];
-    iLeft = 0U;
-    iRght = maxIndex[1U];
-    found = 0U;
-    while (found == 0U) {
-      if (u1 < bp1[bpIdx]) {
-        iRght = bpIdx - 1U;
-        bpIdx = ((bpIdx + iLeft) - 1U) >> 1U;
-      } else if (u1 < bp1[bpIdx + 1U]) {
-        found = 1U;
-      } else {
-        iLeft = bpIdx + 1U;
-        bpIdx = ((bpIdx + iRght) + 1U) >> 1U;
-      }
-    }
-
+    bpIdx = binsearch_u32d_prevIdx(u1, bp1, prevIndex[1U], maxIndex[1U]);
     frac = (u1 - bp1[bpIdx]) / (bp1[bpIdx + 1U] - bp1[bpIdx]);
   } else {
     bpIdx = maxIndex[1U] - 1U;
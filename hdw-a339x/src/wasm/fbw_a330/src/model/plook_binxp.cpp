@@ -0,0 +1,21 @@
+#include "plook_binxp.h"
+#include "binsearch_u32d_prevIdx.h"
+#include "rtwtypes.h"
+
+uint32_T plook_binxp(real_T u, const real_T bp[], uint32_T maxIndex, real_T *fraction, uint32_T *prevIndex)
+{
+  uint32_T bpIndex;
+  if (u <= bp[0U]) {
+    bpIndex = 0U;
+    *fraction = (u - bp[0U]) / (bp[1U] - bp[0U]);
+  } else if (u < bp[maxIndex]) {
+    bpIndex = binsearch_u32d_prevIdx(u, bp, *prevIndex, maxIndex);
+    *fraction = (u - bp[bpIndex]) / (bp[bpIndex + 1U] - bp[bpIndex]);
+  } else {
+    bpIndex = maxIndex - 1U;
+    *fraction = (u - bp[maxIndex - 1U]) / (bp[maxIndex] - bp[maxIndex - 1U]);
+  }
+
+  *prevIndex = bpIndex;
+  return bpIndex;
+}
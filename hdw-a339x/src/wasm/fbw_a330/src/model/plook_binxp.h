@@ -0,0 +1,8 @@
+#ifndef plook_binxp_h_
+#define plook_binxp_h_
+#include "rtwtypes.h"
+
+extern uint32_T plook_binxp(real_T u, const real_T bp[], uint32_T maxIndex, real_T *fraction, uint32_T *prevIndex);
+
+#endif
+
@@ -0,0 +1,34 @@
+#include "plook_evenx.h"
+#include "rtwtypes.h"
+
+uint32_T plook_evenx(real_T u, const real_T bp[], real_T bpSpaceInv, uint32_T maxIndex, real_T *fraction)
+{
+  real_T fbpIndex;
+  uint32_T bpIndex;
+  if (u <= bp[0U]) {
+    bpIndex = 0U;
+    *fraction = (u - bp[0U]) / (bp[1U] - bp[0U]);
+  } else if (u < bp[maxIndex]) {
+    fbpIndex = (u - bp[0U]) * bpSpaceInv;
+    if (fbpIndex < maxIndex) {
+      bpIndex = static_cast<uint32_T>(fbpIndex);
+    } else {
+      bpIndex = maxIndex - 1U;
+    }
+
+    while (u < bp[bpIndex]) {
+      bpIndex--;
+    }
+
+    while (u >= bp[bpIndex + 1U]) {
+      bpIndex++;
+    }
+
+    *fraction = (u - bp[bpIndex]) / (bp[bpIndex + 1U] - bp[bpIndex]);
+  } else {
+    bpIndex = maxIndex - 1U;
+    *fraction = (u - bp[maxIndex - 1U]) / (bp[maxIndex] - bp[maxIndex - 1U]);
+  }
+
+  return bpIndex;
+}
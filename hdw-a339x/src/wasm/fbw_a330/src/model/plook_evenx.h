@@ -0,0 +1,21 @@
+#ifndef plook_evenx_h_
+#define plook_evenx_h_
+#include "rtwtypes.h"
+
+extern uint32_T plook_evenx(real_T u, const real_T bp[], real_T bpSpaceInv, uint32_T maxIndex, real_T *fraction);
+
+// the models pass bpSpaceInv of plook_evenx and look1_evenlxpw as a literal, this checks it against the breakpoints
+constexpr bool plook_evenx_bpSpaceInv_matches(const real_T bp[], real_T bpSpaceInv, uint32_T maxIndex)
+{
+  for (uint32_T i = 0U; i < maxIndex; i++) {
+    real_T error = (bp[i + 1U] - bp[i]) * bpSpaceInv - 1.0;
+    if (error > 1.0E-9 || error < -1.0E-9) {
+      return false;
+    }
+  }
+
+  return maxIndex > 0U;
+}
+
+#endif
+
@@ -1,8 +1,9 @@
-#include <dirent.h>
 #include <ini.h>
 #include <ini_type_conversion.h>
 #include <stdio.h>
+#include <algorithm>
 #include <chrono>
+#include <cstring>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
@@ -18,15 +19,39 @@ void FlightDataRecorder::initialize() {
   idIsEnabled = std::make_unique<LocalVariable>("A32NX_FDR_ENABLED");
   idMaximumFileCount = std::make_unique<LocalVariable>("A32NX_FDR_MAXIMUM_NUMBER_OF_FILES");
   idMaximumSampleCounter = std::make_unique<LocalVariable>("A32NX_FDR_MAXIMUM_NUMBER_OF_ENTRIES_PER_FILE");
+  idIsModelReplayEnabled = std::make_unique<LocalVariable>("A32NX_FDR_MODEL_REPLAY_ENABLED");
+
+  // headers written at the beginning of every file, the model replay files also carry the frame size to guard against
+  // layout differences between builds
+  uint64_t modelReplayFrameSize = sizeof(modelReplayFrame);
+  std::vector<char> modelReplayHeader(sizeof(MODEL_REPLAY_INTERFACE_VERSION) + sizeof(modelReplayFrameSize));
+  std::memcpy(modelReplayHeader.data(), &MODEL_REPLAY_INTERFACE_VERSION, sizeof(MODEL_REPLAY_INTERFACE_VERSION));
+  std::memcpy(modelReplayHeader.data() + sizeof(MODEL_REPLAY_INTERFACE_VERSION), &modelReplayFrameSize, sizeof(modelReplayFrameSize));
+  modelReplayWriter.setHeader(modelReplayHeader.data(), modelReplayHeader.size());
 
   // load configuration
   loadConfiguration();
+  fileWriter.setBlockFrameCount(chunkedContainerEnabled ? framesPerBlock : 0);
 
   // print configuration
   std::cout << "WASM: Flight Data Recorder Configuration : Enabled                        = " << idIsEnabled->get() << std::endl;
   std::cout << "WASM: Flight Data Recorder Configuration : MaximumNumberOfFiles           = " << idMaximumFileCount->get() << std::endl;
   std::cout << "WASM: Flight Data Recorder Configuration : MaximumNumberOfEntriesPerFile  = " << idMaximumSampleCounter->get() << std::endl;
   std::cout << "WASM: Flight Data Recorder Configuration : Interface Version              = " << INTERFACE_VERSION << std::endl;
+  std::cout << "WASM: Flight Data Recorder Configuration : DeltaEncodingEnabled           = " << deltaEncodingEnabled
+            << (deltaEncoding == DELTA_ENCODING_AUTO ? " (auto)" : "") << std::endl;
+  std::cout << "WASM: Flight Data Recorder Configuration : KeyframeInterval               = " << keyframeInterval << std::endl;
+  std::cout << "WASM: Flight Data Recorder Configuration : ChunkedContainerEnabled        = " << chunkedContainerEnabled << std::endl;
+  std::cout << "WASM: Flight Data Recorder Configuration : FramesPerBlock                 = " << framesPerBlock << std::endl;
+  std::cout << "WASM: Flight Data Recorder Configuration : Profile                        = " << profile.getProfileName() << std::endl;
+  for (int i = 0; i < RecordingProfile::CHANNEL_COUNT; i++) {
+    auto channel = static_cast<RecordingProfile::Channel>(i);
+    std::cout << "WASM: Flight Data Recorder Configuration : Channel " << std::left << std::setw(23)
+              << RecordingProfile::CHANNEL_NAMES[i] << std::right << " = " << profile.getDescription(channel) << std::endl;
+  }
+  std::cout << "WASM: Flight Data Recorder Configuration : ModelReplayEnabled             = " << idIsModelReplayEnabled->get() << std::endl;
+  std::cout << "WASM: Flight Data Recorder Configuration : Model Replay Interface Version = " << MODEL_REPLAY_INTERFACE_VERSION
+            << std::endl;
 }
 
 void FlightDataRecorder::update(const BaseData& baseData,
@@ -42,88 +67,355 @@ void FlightDataRecorder::update(const BaseData& baseData,
     return;
   }
 
-  manageFlightDataRecorderFiles();
+  // start a new frame
+  frameOffset = 0;
+  double simulationTime = baseData.simulation_time_s;
 
   // write base data
-  fileStream->write((char*)(&baseData), sizeof(baseData));
+  sampleChannel = true;
+  appendToFrame(baseData, "base");
 
   // write aircraft specific data
-  fileStream->write((char*)(&aircraftSpecificData), sizeof(aircraftSpecificData));
+  if (beginChannel(RecordingProfile::SPECIFIC, simulationTime)) {
+    appendToFrame(aircraftSpecificData, "specific");
+  }
 
   // write ELAC data
-  for (int i = 0; i < NUMBER_OF_ELAC_TO_WRITE; ++i) {
-    writeElac(elacs[i]);
+  if (beginChannel(RecordingProfile::ELAC, simulationTime)) {
+    for (int i = 0; i < NUMBER_OF_ELAC_TO_WRITE; ++i) {
+      writeElac(i, elacs[i]);
+    }
   }
 
   // write SEC data
-  for (int i = 0; i < NUMBER_OF_SEC_TO_WRITE; ++i) {
-    writeSec(secs[i]);
+  if (beginChannel(RecordingProfile::SEC, simulationTime)) {
+    for (int i = 0; i < NUMBER_OF_SEC_TO_WRITE; ++i) {
+      writeSec(i, secs[i]);
+    }
   }
 
   // write FAC data
-  for (int i = 0; i < NUMBER_OF_FAC_TO_WRITE; ++i) {
-    writeFac(facs[i]);
+  if (beginChannel(RecordingProfile::FAC, simulationTime)) {
+    for (int i = 0; i < NUMBER_OF_FAC_TO_WRITE; ++i) {
+      writeFac(i, facs[i]);
+    }
   }
 
   // write FMGC data
-  writeFmgc(fmgc1);
-  // writeFmgc(fmgc2);
+  if (beginChannel(RecordingProfile::FMGC, simulationTime)) {
+    writeFmgc(0, fmgc1);
+    // writeFmgc(1, fmgc2);
+  }
+  if (beginChannel(RecordingProfile::FMGC_INPUTS, simulationTime)) {
+    writeFmgcInputs(0, fmgc1);
+    // writeFmgcInputs(1, fmgc2);
+  }
 
   // write FADEC data
-  for (int i = 0; i < NUMBER_OF_FADEC_TO_WRITE; ++i) {
-    writeFadec(fadecs[i]);
+  if (beginChannel(RecordingProfile::FADEC, simulationTime)) {
+    for (int i = 0; i < NUMBER_OF_FADEC_TO_WRITE; ++i) {
+      writeFadec(i, fadecs[i]);
+    }
+  }
+
+  // write the channels sampled in this frame
+  static_assert(sizeof(SampledChannels) == sizeof(channelSampled), "SampledChannels needs a member per channel");
+  std::memcpy(&sampledChannels, channelSampled, sizeof(sampledChannels));
+  sampleChannel = true;
+  appendToFrame(sampledChannels, "sampled");
+
+  std::string newFilepath = getNextFilepath(sampleCounter, "fdr");
+
+  if (fileHeaderPending) {
+    setFileHeader();
+  }
+
+  // encode frame
+  const std::vector<char>* frame = &frameBuffer;
+  if (deltaEncodingEnabled) {
+    encodeDeltaFrame(!newFilepath.empty());
+    frame = &deltaFrameBuffer;
+  }
+
+  // write queued frames first, so frames that did not fit into the budget of previous updates go first, then queue
+  // this frame, compression and file I/O are done by the writer
+  fileWriter.drain(WRITER_TIME_BUDGET);
+  fileWriter.push(frame->data(), frame->size(), newFilepath, static_cast<int>(idMaximumFileCount->get()), simulationTime);
+}
+
+void FlightDataRecorder::setFileHeader() {
+  uint64_t frameSize = frameBuffer.size();
+  uint64_t deltaKeyframeInterval = deltaEncodingEnabled ? keyframeInterval : 0;
+  std::vector<uint64_t> values;
+  if (chunkedContainerEnabled) {
+    values = {CHUNKED_CONTAINER_MARKER, INTERFACE_VERSION, frameSize, static_cast<uint64_t>(framesPerBlock), deltaKeyframeInterval};
+  } else if (deltaEncodingEnabled) {
+    values = {DELTA_ENCODING_MARKER, INTERFACE_VERSION, frameSize, deltaKeyframeInterval};
+  } else {
+    values = {INTERFACE_VERSION};
+  }
+
+  // the schema follows the header and is never delta encoded or split into blocks
+  std::vector<char> header(reinterpret_cast<const char*>(values.data()),
+                           reinterpret_cast<const char*>(values.data() + values.size()));
+  schema.serialize(header);
+  fileWriter.setHeader(header.data(), header.size());
+
+  previousFrameBuffer.resize(frameSize);
+  deltaFrameBuffer.resize(frameSize);
+  fileHeaderPending = false;
+}
+
+bool FlightDataRecorder::beginChannel(RecordingProfile::Channel channel, double simulationTime) {
+  if (!profile.isRecorded(channel)) {
+    channelSampled[channel] = false;
+    return false;
+  }
+
+  // the first frame defines the layout of the file, so all recorded channels are sampled
+  sampleChannel = profile.isDue(channel, simulationTime) || fileHeaderPending;
+  channelSampled[channel] = sampleChannel;
+  return true;
+}
+
+void FlightDataRecorder::encodeDeltaFrame(bool startsNewFile) {
+  // every file and block starts with a keyframe so it can be decoded on its own
+  if (startsNewFile || (chunkedContainerEnabled && deltaFrameIndex == framesPerBlock)) {
+    deltaFrameIndex = 0;
+  }
+  bool isKeyframe = deltaFrameIndex % keyframeInterval == 0;
+  deltaFrameIndex++;
+
+  // unchanged bytes become zero, which is cheap to deflate, the frame itself is kept for the next update
+  const uint8_t* frame = reinterpret_cast<const uint8_t*>(frameBuffer.data());
+  uint8_t* previousFrame = reinterpret_cast<uint8_t*>(previousFrameBuffer.data());
+  uint8_t* deltaFrame = reinterpret_cast<uint8_t*>(deltaFrameBuffer.data());
+  std::size_t size = frameBuffer.size();
+  if (isKeyframe) {
+    std::memcpy(previousFrame, frame, size);
+    std::memcpy(deltaFrame, frame, size);
+  } else {
+    for (std::size_t i = 0; i < size; ++i) {
+      uint8_t value = frame[i];
+      deltaFrame[i] = value ^ previousFrame[i];
+      previousFrame[i] = value;
+    }
   }
 }
 
-void FlightDataRecorder::writeElac(Elac& elac) {
-  auto bus_outputs = elac.getBusOutputs();
-  fileStream->write((char*)(&bus_outputs), sizeof(bus_outputs));
-  auto discrete_outputs = elac.getDiscreteOutputs();
-  fileStream->write((char*)(&discrete_outputs), sizeof(discrete_outputs));
-  auto analog_outputs = elac.getAnalogOutputs();
-  fileStream->write((char*)(&analog_outputs), sizeof(analog_outputs));
+void FlightDataRecorder::writeElac(int index, Elac& elac) {
+  appendToFrame(elac.getBusOutputs(), "elac", index, "bus_outputs");
+  appendToFrame(elac.getDiscreteOutputs(), "elac", index, "discrete_outputs");
+  appendToFrame(elac.getAnalogOutputs(), "elac", index, "analog_outputs");
+}
+
+void FlightDataRecorder::writeSec(int index, Sec& sec) {
+  appendToFrame(sec.getBusOutputs(), "sec", index, "bus_outputs");
+  appendToFrame(sec.getDiscreteOutputs(), "sec", index, "discrete_outputs");
+  appendToFrame(sec.getAnalogOutputs(), "sec", index, "analog_outputs");
+}
+
+void FlightDataRecorder::writeFac(int index, Fac& fac) {
+  appendToFrame(fac.getBusOutputs(), "fac", index, "bus_outputs");
+  appendToFrame(fac.getDiscreteOutputs(), "fac", index, "discrete_outputs");
+  appendToFrame(fac.getAnalogOutputs(), "fac", index, "analog_outputs");
+}
+
+void FlightDataRecorder::writeFmgc(int index, const fmgc_outputs& fmgc) {
+  appendToFrame(fmgc.logic, "fmgc", index, "logic");
+  appendToFrame(fmgc.ap_fd_logic, "fmgc", index, "ap_fd_logic");
+  appendToFrame(fmgc.ap_fd_outer_loops, "fmgc", index, "ap_fd_outer_loops");
+  appendToFrame(fmgc.athr, "fmgc", index, "athr");
+  appendToFrame(fmgc.discrete_outputs, "fmgc", index, "discrete_outputs");
+  appendToFrame(fmgc.bus_outputs, "fmgc", index, "bus_outputs");
+}
+
+void FlightDataRecorder::writeFmgcInputs(int index, const fmgc_outputs& fmgc) {
+  appendToFrame(fmgc.data.bus_inputs, "fmgc", index, "bus_inputs");
+  appendToFrame(fmgc.data.discrete_inputs, "fmgc", index, "discrete_inputs");
+  appendToFrame(fmgc.data.fms_inputs, "fmgc", index, "fms_inputs");
+}
+
+void FlightDataRecorder::writeFadec(int index, FadecComputer& fadec) {
+  const auto& outputs = fadec.getExternalOutputs().out;
+  appendToFrame(outputs.fadec_bus_output, "fadec", index, "fadec_bus_output");
+  appendToFrame(outputs.output, "fadec", index, "output");
+}
+
+void FlightDataRecorder::recordElacInputs(int index,
+                                          const ElacComputer::ExternalInputs_ElacComputer_T& inputs,
+                                          double deltaTime,
+                                          double simulationTime,
+                                          bool faultActive,
+                                          bool isPowered) {
+  if (!isModelReplayActive()) {
+    return;
+  }
+
+  modelReplayFrame.elacs[index].update = {deltaTime, simulationTime, true, faultActive, isPowered};
+  modelReplayFrame.elacs[index].inputs = inputs;
+}
+
+void FlightDataRecorder::recordSecInputs(int index,
+                                         const SecComputer::ExternalInputs_SecComputer_T& inputs,
+                                         double deltaTime,
+                                         double simulationTime,
+                                         bool faultActive,
+                                         bool isPowered) {
+  if (!isModelReplayActive()) {
+    return;
+  }
+
+  modelReplayFrame.secs[index].update = {deltaTime, simulationTime, true, faultActive, isPowered};
+  modelReplayFrame.secs[index].inputs = inputs;
+}
+
+void FlightDataRecorder::recordFacInputs(int index,
+                                         const FacComputer::ExternalInputs_FacComputer_T& inputs,
+                                         double deltaTime,
+                                         double simulationTime,
+                                         bool faultActive,
+                                         bool isPowered) {
+  if (!isModelReplayActive()) {
+    return;
+  }
+
+  modelReplayFrame.facs[index].update = {deltaTime, simulationTime, true, faultActive, isPowered};
+  modelReplayFrame.facs[index].inputs = inputs;
+}
+
+void FlightDataRecorder::recordFmgcInputs(int index,
+                                          const FmgcComputer::ExternalInputs_FmgcComputer_T& inputs,
+                                          double deltaTime,
+                                          double simulationTime,
+                                          bool faultActive,
+                                          bool isPowered) {
+  if (!isModelReplayActive()) {
+    return;
+  }
+
+  modelReplayFrame.fmgcs[index].update = {deltaTime, simulationTime, true, faultActive, isPowered};
+  modelReplayFrame.fmgcs[index].inputs = inputs;
 }
 
-void FlightDataRecorder::writeSec(Sec& sec) {
-  auto bus_outputs = sec.getBusOutputs();
-  fileStream->write((char*)(&bus_outputs), sizeof(bus_outputs));
-  auto discrete_outputs = sec.getDiscreteOutputs();
-  fileStream->write((char*)(&discrete_outputs), sizeof(discrete_outputs));
-  auto analog_outputs = sec.getAnalogOutputs();
-  fileStream->write((char*)(&analog_outputs), sizeof(analog_outputs));
+void FlightDataRecorder::recordFadecInputs(int index, const FadecComputer::ExternalInputs_FadecComputer_T& inputs) {
+  if (!isModelReplayActive()) {
+    return;
+  }
+
+  modelReplayFrame.fadecs[index].update = {inputs.in.time.dt, inputs.in.time.simulation_time, true, false, true};
+  modelReplayFrame.fadecs[index].inputs = inputs;
 }
 
-void FlightDataRecorder::writeFac(Fac& fac) {
-  auto bus_outputs = fac.getBusOutputs();
-  fileStream->write((char*)(&bus_outputs), sizeof(bus_outputs));
-  auto discrete_outputs = fac.getDiscreteOutputs();
-  fileStream->write((char*)(&discrete_outputs), sizeof(discrete_outputs));
-  auto analog_outputs = fac.getAnalogOutputs();
-  fileStream->write((char*)(&analog_outputs), sizeof(analog_outputs));
+void FlightDataRecorder::updateModelReplay(Elac (&elacs)[2],
+                                           Sec (&secs)[3],
+                                           Fac (&facs)[2],
+                                           Fmgc (&fmgcs)[2],
+                                           FadecComputer (&fadecs)[2]) {
+  // only write frames in which at least one computer was stepped, otherwise there is nothing to replay
+  if (!isModelReplayActive() || !hasModelReplayUpdates()) {
+    return;
+  }
+
+  // collect outputs of the computers that were stepped
+  for (int i = 0; i < 2; ++i) {
+    if (modelReplayFrame.elacs[i].update.updated) {
+      modelReplayFrame.elacs[i].busOutputs = elacs[i].getBusOutputs();
+      modelReplayFrame.elacs[i].discreteOutputs = elacs[i].getDiscreteOutputs();
+      modelReplayFrame.elacs[i].analogOutputs = elacs[i].getAnalogOutputs();
+    }
+  }
+  for (int i = 0; i < 3; ++i) {
+    if (modelReplayFrame.secs[i].update.updated) {
+      modelReplayFrame.secs[i].busOutputs = secs[i].getBusOutputs();
+      modelReplayFrame.secs[i].discreteOutputs = secs[i].getDiscreteOutputs();
+      modelReplayFrame.secs[i].analogOutputs = secs[i].getAnalogOutputs();
+    }
+  }
+  for (int i = 0; i < 2; ++i) {
+    if (modelReplayFrame.facs[i].update.updated) {
+      modelReplayFrame.facs[i].busOutputs = facs[i].getBusOutputs();
+      modelReplayFrame.facs[i].discreteOutputs = facs[i].getDiscreteOutputs();
+      modelReplayFrame.facs[i].analogOutputs = facs[i].getAnalogOutputs();
+    }
+  }
+  for (int i = 0; i < 2; ++i) {
+    if (modelReplayFrame.fmgcs[i].update.updated) {
+      modelReplayFrame.fmgcs[i].outputs = fmgcs[i].getDebugOutputs();
+    }
+  }
+  for (int i = 0; i < 2; ++i) {
+    if (modelReplayFrame.fadecs[i].update.updated) {
+      modelReplayFrame.fadecs[i].outputs = fadecs[i].getExternalOutputs().out;
+    }
+  }
+
+  // write queued frames first, then queue this frame, compression and file I/O are done by the writer
+  modelReplayWriter.drain(WRITER_TIME_BUDGET);
+  modelReplayWriter.push(&modelReplayFrame, sizeof(modelReplayFrame), getNextFilepath(modelReplaySampleCounter, "rpl"),
+                         static_cast<int>(idMaximumFileCount->get()));
+
+  // reset update flags for the next frame
+  for (auto& elac : modelReplayFrame.elacs) {
+    elac.update.updated = false;
+  }
+  for (auto& sec : modelReplayFrame.secs) {
+    sec.update.updated = false;
+  }
+  for (auto& fac : modelReplayFrame.facs) {
+    fac.update.updated = false;
+  }
+  for (auto& fmgc : modelReplayFrame.fmgcs) {
+    fmgc.update.updated = false;
+  }
+  for (auto& fadec : modelReplayFrame.fadecs) {
+    fadec.update.updated = false;
+  }
 }
 
-void FlightDataRecorder::writeFmgc(const fmgc_outputs& fmgc) {
-  fileStream->write((char*)(&fmgc.logic), sizeof(fmgc.logic));
-  fileStream->write((char*)(&fmgc.ap_fd_logic), sizeof(fmgc.ap_fd_logic));
-  fileStream->write((char*)(&fmgc.ap_fd_outer_loops), sizeof(fmgc.ap_fd_outer_loops));
-  fileStream->write((char*)(&fmgc.athr), sizeof(fmgc.athr));
-  fileStream->write((char*)(&fmgc.discrete_outputs), sizeof(fmgc.discrete_outputs));
-  fileStream->write((char*)(&fmgc.bus_outputs), sizeof(fmgc.bus_outputs));
-  fileStream->write((char*)(&fmgc.data.bus_inputs), sizeof(fmgc.data.bus_inputs));
-  fileStream->write((char*)(&fmgc.data.discrete_inputs), sizeof(fmgc.data.discrete_inputs));
-  fileStream->write((char*)(&fmgc.data.fms_inputs), sizeof(fmgc.data.fms_inputs));
+bool FlightDataRecorder::isModelReplayActive() {
+  return idIsEnabled->get() && idIsModelReplayEnabled->get();
 }
 
-void FlightDataRecorder::writeFadec(FadecComputer& fadec) {
-  auto outputs = fadec.getExternalOutputs().out;
-  fileStream->write((char*)(&outputs.fadec_bus_output), sizeof(outputs.fadec_bus_output));
-  fileStream->write((char*)(&outputs.output), sizeof(outputs.output));
+bool FlightDataRecorder::hasModelReplayUpdates() {
+  for (const auto& elac : modelReplayFrame.elacs) {
+    if (elac.update.updated) {
+      return true;
+    }
+  }
+  for (const auto& sec : modelReplayFrame.secs) {
+    if (sec.update.updated) {
+      return true;
+    }
+  }
+  for (const auto& fac : modelReplayFrame.facs) {
+    if (fac.update.updated) {
+      return true;
+    }
+  }
+  for (const auto& fmgc : modelReplayFrame.fmgcs) {
+    if (fmgc.update.updated) {
+      return true;
+    }
+  }
+  for (const auto& fadec : modelReplayFrame.fadecs) {
+    if (fadec.update.updated) {
+      return true;
+    }
+  }
+  return false;
 }
 
 void FlightDataRecorder::terminate() {
-  if (fileStream) {
-    fileStream->close();
-    fileStream.reset();
+  // write remaining frames, the next frame starts new files
+  fileWriter.close();
+  modelReplayWriter.close();
+  sampleCounter = 0;
+  modelReplaySampleCounter = 0;
+
+  if (fileWriter.getOverrunCount() > 0 || modelReplayWriter.getOverrunCount() > 0) {
+    std::cout << "WASM: Flight Data Recorder writer overruns: fdr = " << fileWriter.getOverrunCount()
+              << ", rpl = " << modelReplayWriter.getOverrunCount() << std::endl;
   }
   writeConfiguration();
 }
@@ -137,6 +429,12 @@ void FlightDataRecorder::loadConfiguration() {
     iniStructure["FLIGHT_DATA_RECORDER"]["ENABLED"] = "true";
     iniStructure["FLIGHT_DATA_RECORDER"]["MAXIMUM_NUMBER_OF_FILES"] = "15";
     iniStructure["FLIGHT_DATA_RECORDER"]["MAXIMUM_NUMBER_OF_ENTRIES_PER_FILE"] = "864000";
+    iniStructure["FLIGHT_DATA_RECORDER"]["MODEL_REPLAY_ENABLED"] = "false";
+    iniStructure["FLIGHT_DATA_RECORDER"]["DELTA_ENCODING_ENABLED"] = DELTA_ENCODING_AUTO;
+    iniStructure["FLIGHT_DATA_RECORDER"]["KEYFRAME_INTERVAL"] = "300";
+    iniStructure["FLIGHT_DATA_RECORDER"]["CHUNKED_CONTAINER_ENABLED"] = "false";
+    iniStructure["FLIGHT_DATA_RECORDER"]["FRAMES_PER_BLOCK"] = "600";
+    iniStructure["FLIGHT_DATA_RECORDER"]["PROFILE"] = RecordingProfile::DEFAULT_PROFILE;
     iniFile.write(iniStructure, true);
   }
 
@@ -145,6 +443,38 @@ void FlightDataRecorder::loadConfiguration() {
   idMaximumFileCount->set(INITypeConversion::getInteger(iniStructure, "FLIGHT_DATA_RECORDER", "MAXIMUM_NUMBER_OF_FILES", 15));
   idMaximumSampleCounter->set(
       INITypeConversion::getInteger(iniStructure, "FLIGHT_DATA_RECORDER", "MAXIMUM_NUMBER_OF_ENTRIES_PER_FILE", 864000));
+  idIsModelReplayEnabled->set(INITypeConversion::getBoolean(iniStructure, "FLIGHT_DATA_RECORDER", "MODEL_REPLAY_ENABLED", false));
+  deltaEncoding = DELTA_ENCODING_AUTO;
+  if (iniStructure.get("FLIGHT_DATA_RECORDER").has("DELTA_ENCODING_ENABLED")) {
+    deltaEncoding = iniStructure.get("FLIGHT_DATA_RECORDER").get("DELTA_ENCODING_ENABLED");
+  }
+  keyframeInterval = std::max(1, INITypeConversion::getInteger(iniStructure, "FLIGHT_DATA_RECORDER", "KEYFRAME_INTERVAL", 300));
+  chunkedContainerEnabled = INITypeConversion::getBoolean(iniStructure, "FLIGHT_DATA_RECORDER", "CHUNKED_CONTAINER_ENABLED", false);
+  framesPerBlock = std::max(1, INITypeConversion::getInteger(iniStructure, "FLIGHT_DATA_RECORDER", "FRAMES_PER_BLOCK", 600));
+
+  // read recording profile, single channels can be overridden in their own section
+  std::string profileName = RecordingProfile::DEFAULT_PROFILE;
+  if (iniStructure.get("FLIGHT_DATA_RECORDER").has("PROFILE")) {
+    profileName = iniStructure.get("FLIGHT_DATA_RECORDER").get("PROFILE");
+  }
+  if (!profile.setProfile(profileName)) {
+    std::cout << "WASM: Flight Data Recorder: unknown profile '" << profileName << "', using '" << profile.getProfileName()
+              << "'" << std::endl;
+  }
+  auto channels = iniStructure.get("FLIGHT_DATA_RECORDER_CHANNELS");
+  for (int i = 0; i < RecordingProfile::CHANNEL_COUNT; i++) {
+    const char* name = RecordingProfile::CHANNEL_NAMES[i];
+    if (channels.has(name) && !profile.setOverride(static_cast<RecordingProfile::Channel>(i), channels.get(name))) {
+      std::cout << "WASM: Flight Data Recorder: invalid sampling '" << channels.get(name) << "' of channel " << name << std::endl;
+    }
+  }
+
+  // decimated channels hold their last sample in the frame, delta encoding turns the held bytes into zeros
+  if (deltaEncoding == DELTA_ENCODING_AUTO) {
+    deltaEncodingEnabled = profile.isDecimated();
+  } else {
+    deltaEncodingEnabled = INITypeConversion::getBoolean(iniStructure, "FLIGHT_DATA_RECORDER", "DELTA_ENCODING_ENABLED", false);
+  }
 }
 
 void FlightDataRecorder::writeConfiguration() {
@@ -157,81 +487,43 @@ void FlightDataRecorder::writeConfiguration() {
   iniStructure["FLIGHT_DATA_RECORDER"]["MAXIMUM_NUMBER_OF_FILES"] = std::to_string(static_cast<int>(idMaximumFileCount->get()));
   iniStructure["FLIGHT_DATA_RECORDER"]["MAXIMUM_NUMBER_OF_ENTRIES_PER_FILE"] =
       std::to_string(static_cast<int>(idMaximumSampleCounter->get()));
+  iniStructure["FLIGHT_DATA_RECORDER"]["MODEL_REPLAY_ENABLED"] = idIsModelReplayEnabled->get() == 1 ? "true" : "false";
+  iniStructure["FLIGHT_DATA_RECORDER"]["DELTA_ENCODING_ENABLED"] =
+      deltaEncoding == DELTA_ENCODING_AUTO ? DELTA_ENCODING_AUTO : (deltaEncodingEnabled ? "true" : "false");
+  iniStructure["FLIGHT_DATA_RECORDER"]["KEYFRAME_INTERVAL"] = std::to_string(keyframeInterval);
+  iniStructure["FLIGHT_DATA_RECORDER"]["CHUNKED_CONTAINER_ENABLED"] = chunkedContainerEnabled ? "true" : "false";
+  iniStructure["FLIGHT_DATA_RECORDER"]["FRAMES_PER_BLOCK"] = std::to_string(framesPerBlock);
+  iniStructure["FLIGHT_DATA_RECORDER"]["PROFILE"] = profile.getProfileName();
+  for (int i = 0; i < RecordingProfile::CHANNEL_COUNT; i++) {
+    const auto& value = profile.getOverride(static_cast<RecordingProfile::Channel>(i));
+    if (!value.empty()) {
+      iniStructure["FLIGHT_DATA_RECORDER_CHANNELS"][RecordingProfile::CHANNEL_NAMES[i]] = value;
+    }
+  }
 
   // write file
   iniFile.write(iniStructure, true);
 }
 
-void FlightDataRecorder::manageFlightDataRecorderFiles() {
-  // increase sample counter
-  sampleCounter++;
-
-  // check if file is considered full
-  if (sampleCounter >= idMaximumSampleCounter->get()) {
-    // close file and delete
-    if (fileStream) {
-      fileStream->close();
-      fileStream.reset();
-    }
-    // reset counter
-    sampleCounter = 0;
+std::string FlightDataRecorder::getNextFilepath(int& counter, const std::string& extension) {
+  // start a new file with the first frame and whenever the current file is considered full
+  bool startNewFile = counter == 0 || counter >= idMaximumSampleCounter->get();
+  if (counter >= idMaximumSampleCounter->get()) {
+    counter = 0;
   }
+  counter++;
 
-  if (!fileStream) {
-    // create new file
-    fileStream = std::make_shared<gzofstream>(getFlightDataRecorderFilename().c_str());
-    // write version to file
-    fileStream->write((char*)&INTERFACE_VERSION, sizeof(INTERFACE_VERSION));
-    // clean up directory
-    cleanUpFlightDataRecorderFiles();
-  }
+  return startNewFile ? getFlightDataRecorderFilename(extension) : std::string();
 }
 
-std::string FlightDataRecorder::getFlightDataRecorderFilename() {
+std::string FlightDataRecorder::getFlightDataRecorderFilename(const std::string& extension) {
   // get time
   auto in_time_t = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
 
   // get filepath based on time
   std::stringstream result;
-  result << std::put_time(std::gmtime(&in_time_t), "\\work\\%Y-%m-%d-%H-%M-%S.fdr");
+  result << std::put_time(std::gmtime(&in_time_t), "\\work\\%Y-%m-%d-%H-%M-%S.") << extension;
 
   // return result
   return result.str();
 }
-
-void FlightDataRecorder::cleanUpFlightDataRecorderFiles() {
-  // std::vector for directory entries
-  std::vector<std::string> files;
-
-  // extension
-  std::string extension = "fdr";
-
-  // structure representing an directory entry
-  struct dirent* directoryEntry;
-
-  // open directory
-  DIR* directory = opendir("\\work");
-
-  // read directory until end
-  while ((directoryEntry = readdir(directory)) != NULL) {
-    // get filename as std::string
-    std::string filename = directoryEntry->d_name;
-
-    // check if file has right extension
-    if (filename.find(extension, (filename.length() - extension.length())) != std::string::npos) {
-      files.push_back(std::move(filename));
-    }
-  }
-
-  // close directory
-  closedir(directory);
-
-  // sort std::vector
-  std::sort(files.begin(), files.end(), std::greater<>());
-
-  // remove older files
-  while (files.size() > idMaximumFileCount->get()) {
-    bool result = remove(("\\work\\" + files.back()).c_str());
-    files.pop_back();
-  }
-}
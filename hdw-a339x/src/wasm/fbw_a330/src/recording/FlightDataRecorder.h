@@ -1,20 +1,39 @@
 #pragma once
 
+#include <chrono>
+#include <cstring>
 #include <fstream>
 
 #include "../elac/Elac.h"
 #include "../fac/Fac.h"
+#include "../fmgc/Fmgc.h"
 #include "../model/FadecComputer.h"
 #include "../model/FmgcComputer_types.h"
 #include "../sec/Sec.h"
+#include "FlightDataRecorderSchema.h"
 #include "LocalVariable.h"
+#include "ModelReplayDataTypes.h"
 #include "RecordingDataTypes.h"
-#include "zfstream.h"
+#include "RecordingFileWriter.h"
+#include "RecordingProfile.h"
+#include "RecordingSchema.h"
 
 class FlightDataRecorder {
  public:
   // IMPORTANT: this constant needs to increased with every interface change
-  const uint64_t INTERFACE_VERSION = 3300003;
+  // files carry a schema of the recorded types after the header, readers using it do not depend on this version
+  const uint64_t INTERFACE_VERSION = 3300005;
+
+  // delta encoded files start with this marker ("FDRDELTA"), followed by the interface version, the frame size and the
+  // keyframe interval
+  const uint64_t DELTA_ENCODING_MARKER = 0x41544c4544524446;
+
+  // chunked containers start with this uncompressed marker ("FDRCHUNK"), followed by the interface version, the frame
+  // size, the number of frames per block and the keyframe interval (0 when delta encoding is disabled)
+  const uint64_t CHUNKED_CONTAINER_MARKER = 0x4b4e554843524446;
+
+  // IMPORTANT: this constant needs to increased with every change of the model replay data or of the models interface
+  const uint64_t MODEL_REPLAY_INTERFACE_VERSION = 1;
 
   const uint32_t NUMBER_OF_ELAC_TO_WRITE = 2;
   const uint32_t NUMBER_OF_SEC_TO_WRITE = 3;
@@ -32,6 +51,38 @@ class FlightDataRecorder {
               const fmgc_outputs& fmgc2,
               FadecComputer (&fadecs)[2]);
 
+  void recordElacInputs(int index,
+                        const ElacComputer::ExternalInputs_ElacComputer_T& inputs,
+                        double deltaTime,
+                        double simulationTime,
+                        bool faultActive,
+                        bool isPowered);
+
+  void recordSecInputs(int index,
+                       const SecComputer::ExternalInputs_SecComputer_T& inputs,
+                       double deltaTime,
+                       double simulationTime,
+                       bool faultActive,
+                       bool isPowered);
+
+  void recordFacInputs(int index,
+                       const FacComputer::ExternalInputs_FacComputer_T& inputs,
+                       double deltaTime,
+                       double simulationTime,
+                       bool faultActive,
+                       bool isPowered);
+
+  void recordFmgcInputs(int index,
+                        const FmgcComputer::ExternalInputs_FmgcComputer_T& inputs,
+                        double deltaTime,
+                        double simulationTime,
+                        bool faultActive,
+                        bool isPowered);
+
+  void recordFadecInputs(int index, const FadecComputer::ExternalInputs_FadecComputer_T& inputs);
+
+  void updateModelReplay(Elac (&elacs)[2], Sec (&secs)[3], Fac (&facs)[2], Fmgc (&fmgcs)[2], FadecComputer (&fadecs)[2]);
+
   void terminate();
 
  private:
@@ -40,26 +91,104 @@ class FlightDataRecorder {
   std::unique_ptr<LocalVariable> idIsEnabled;
   std::unique_ptr<LocalVariable> idMaximumSampleCounter;
   std::unique_ptr<LocalVariable> idMaximumFileCount;
-  int sampleCounter = 0;
-  std::shared_ptr<gzofstream> fileStream;
-
-  void manageFlightDataRecorderFiles();
+  std::unique_ptr<LocalVariable> idIsModelReplayEnabled;
+  // time per frame the writers may spend on compression and file I/O when they are drained from the gauge thread
+  static constexpr std::chrono::microseconds WRITER_TIME_BUDGET = std::chrono::microseconds(500);
+  // frames queued per writer, a file rotation spreads over up to four updates (close, open, clean up, first frame), the
+  // rest covers frames whose write alone exceeds the budget, about 0.4 s at 30 updates per second
+  static constexpr std::size_t WRITER_SLOT_COUNT = 16;
 
-  std::string getFlightDataRecorderFilename();
+  int sampleCounter = 0;
 
-  void cleanUpFlightDataRecorderFiles();
+  // the frame keeps the last sample of channels that are not due, so it is only rebuilt for the file header
+  std::vector<char> frameBuffer;
+  std::size_t frameOffset = 0;
+  bool sampleChannel = true;
+  RecordingProfile profile;
+  // written at the end of every frame, so readers can tell new samples from held ones
+  bool channelSampled[RecordingProfile::CHANNEL_COUNT] = {};
+  SampledChannels sampledChannels = {};
+
+  // the file header contains the frame size and the schema, so it can only be created with the first frame
+  bool fileHeaderPending = true;
+  RecordingSchema schema = RecordingSchema(fdr_schema::TYPES, std::size(fdr_schema::TYPES));
+
+  // frames are stored as XOR against the previous frame, except for every n-th frame of a file or block (keyframe),
+  // "auto" enables it when the profile decimates a channel, the held samples of such channels then become zero bytes
+  static constexpr const char* DELTA_ENCODING_AUTO = "auto";
+  std::string deltaEncoding = DELTA_ENCODING_AUTO;
+  bool deltaEncodingEnabled = false;
+  int keyframeInterval = 300;
+  int deltaFrameIndex = 0;
+  std::vector<char> previousFrameBuffer;
+  std::vector<char> deltaFrameBuffer;
+
+  // files are split into independently compressed blocks with an index for random access
+  bool chunkedContainerEnabled = false;
+  int framesPerBlock = 600;
+
+  RecordingFileWriter fileWriter = RecordingFileWriter("fdr", WRITER_SLOT_COUNT);
+
+  int modelReplaySampleCounter = 0;
+  ModelReplayFrame modelReplayFrame = {};
+  RecordingFileWriter modelReplayWriter = RecordingFileWriter("rpl", WRITER_SLOT_COUNT);
+
+  /**
+   * @brief Writes the value at the next position of the frame if the current channel is sampled, while the file header
+   * is pending it is also added to the schema.
+   * @param index unit of the channel starting with 0, the segment is named <channel>_<index + 1> when not negative.
+   */
+  template <typename T>
+  void appendToFrame(const T& value, const char* channel, int index = -1, const char* member = nullptr) {
+    if (fileHeaderPending) {
+      std::string name = channel;
+      if (index >= 0) {
+        name += "_" + std::to_string(index + 1);
+      }
+      if (member != nullptr) {
+        name += std::string(".") + member;
+      }
+      schema.addSegment<T>(name);
+      frameBuffer.resize(frameOffset + sizeof(value));
+    }
+
+    if (sampleChannel) {
+      std::memcpy(frameBuffer.data() + frameOffset, &value, sizeof(value));
+    }
+    frameOffset += sizeof(value);
+  }
+
+  /**
+   * @brief Starts writing a channel of the profile.
+   * @return false if the channel is not recorded.
+   */
+  bool beginChannel(RecordingProfile::Channel channel, double simulationTime);
+
+  void setFileHeader();
+
+  void encodeDeltaFrame(bool startsNewFile);
+
+  bool isModelReplayActive();
+
+  bool hasModelReplayUpdates();
+
+  std::string getNextFilepath(int& counter, const std::string& extension);
+
+  std::string getFlightDataRecorderFilename(const std::string& extension);
 
   void loadConfiguration();
 
   void writeConfiguration();
 
-  void writeElac(Elac& elac);
+  void writeElac(int index, Elac& elac);
+
+  void writeSec(int index, Sec& sec);
 
-  void writeSec(Sec& sec);
+  void writeFac(int index, Fac& fac);
 
-  void writeFac(Fac& fac);
+  void writeFmgc(int index, const fmgc_outputs& fmgc);
 
-  void writeFmgc(const fmgc_outputs& fmgc);
+  void writeFmgcInputs(int index, const fmgc_outputs& fmgc);
 
-  void writeFadec(FadecComputer& fadec);
+  void writeFadec(int index, FadecComputer& fadec);
 };
@@ -0,0 +1,1584 @@
+// generated by scripts/generate-fdr-schema.js (npm run build-a339x:fdr-schema), do not edit
+#pragma once
+
+#include <cstddef>
+
+#include "RecordingDataTypes.h"
+#include "../model/ElacComputer_types.h"
+#include "../model/SecComputer_types.h"
+#include "../model/FacComputer_types.h"
+#include "../model/FmgcComputer_types.h"
+#include "../model/FadecComputer_types.h"
+#include "RecordingSchema.h"
+
+template <>
+struct SchemaTypeIndex<BaseData> {
+  static constexpr int32_t value = 0;
+};
+
+template <>
+struct SchemaTypeIndex<AircraftSpecificData> {
+  static constexpr int32_t value = 1;
+};
+
+template <>
+struct SchemaTypeIndex<SampledChannels> {
+  static constexpr int32_t value = 2;
+};
+
+template <>
+struct SchemaTypeIndex<base_arinc_429> {
+  static constexpr int32_t value = 3;
+};
+
+template <>
+struct SchemaTypeIndex<base_elac_out_bus> {
+  static constexpr int32_t value = 4;
+};
+
+template <>
+struct SchemaTypeIndex<base_elac_discrete_outputs> {
+  static constexpr int32_t value = 5;
+};
+
+template <>
+struct SchemaTypeIndex<base_elac_analog_outputs> {
+  static constexpr int32_t value = 6;
+};
+
+template <>
+struct SchemaTypeIndex<base_sec_out_bus> {
+  static constexpr int32_t value = 7;
+};
+
+template <>
+struct SchemaTypeIndex<base_sec_discrete_outputs> {
+  static constexpr int32_t value = 8;
+};
+
+template <>
+struct SchemaTypeIndex<base_sec_analog_outputs> {
+  static constexpr int32_t value = 9;
+};
+
+template <>
+struct SchemaTypeIndex<base_fac_bus> {
+  static constexpr int32_t value = 10;
+};
+
+template <>
+struct SchemaTypeIndex<base_fac_discrete_outputs> {
+  static constexpr int32_t value = 11;
+};
+
+template <>
+struct SchemaTypeIndex<base_fac_analog_outputs> {
+  static constexpr int32_t value = 12;
+};
+
+template <>
+struct SchemaTypeIndex<base_adr_bus> {
+  static constexpr int32_t value = 13;
+};
+
+template <>
+struct SchemaTypeIndex<base_ir_bus> {
+  static constexpr int32_t value = 14;
+};
+
+template <>
+struct SchemaTypeIndex<base_ra_bus> {
+  static constexpr int32_t value = 15;
+};
+
+template <>
+struct SchemaTypeIndex<base_ils_bus> {
+  static constexpr int32_t value = 16;
+};
+
+template <>
+struct SchemaTypeIndex<base_fmgc_logic_outputs> {
+  static constexpr int32_t value = 17;
+};
+
+template <>
+struct SchemaTypeIndex<base_fmgc_lateral_modes> {
+  static constexpr int32_t value = 18;
+};
+
+template <>
+struct SchemaTypeIndex<base_fmgc_longitudinal_modes> {
+  static constexpr int32_t value = 19;
+};
+
+template <>
+struct SchemaTypeIndex<base_fmgc_armed_modes> {
+  static constexpr int32_t value = 20;
+};
+
+template <>
+struct SchemaTypeIndex<base_fmgc_ap_fd_logic_outputs> {
+  static constexpr int32_t value = 21;
+};
+
+template <>
+struct SchemaTypeIndex<ap_raw_output_command> {
+  static constexpr int32_t value = 22;
+};
+
+template <>
+struct SchemaTypeIndex<ap_raw_laws_flare> {
+  static constexpr int32_t value = 23;
+};
+
+template <>
+struct SchemaTypeIndex<ap_raw_output> {
+  static constexpr int32_t value = 24;
+};
+
+template <>
+struct SchemaTypeIndex<base_fmgc_athr_outputs> {
+  static constexpr int32_t value = 25;
+};
+
+template <>
+struct SchemaTypeIndex<base_fmgc_discrete_outputs> {
+  static constexpr int32_t value = 26;
+};
+
+template <>
+struct SchemaTypeIndex<base_fmgc_a_bus> {
+  static constexpr int32_t value = 27;
+};
+
+template <>
+struct SchemaTypeIndex<base_fmgc_b_bus> {
+  static constexpr int32_t value = 28;
+};
+
+template <>
+struct SchemaTypeIndex<base_fmgc_bus_outputs> {
+  static constexpr int32_t value = 29;
+};
+
+template <>
+struct SchemaTypeIndex<base_ecu_bus> {
+  static constexpr int32_t value = 30;
+};
+
+template <>
+struct SchemaTypeIndex<base_fcu_bus> {
+  static constexpr int32_t value = 31;
+};
+
+template <>
+struct SchemaTypeIndex<base_tcas_bus> {
+  static constexpr int32_t value = 32;
+};
+
+template <>
+struct SchemaTypeIndex<base_fmgc_bus_inputs> {
+  static constexpr int32_t value = 33;
+};
+
+template <>
+struct SchemaTypeIndex<base_fmgc_discrete_inputs> {
+  static constexpr int32_t value = 34;
+};
+
+template <>
+struct SchemaTypeIndex<base_fms_inputs> {
+  static constexpr int32_t value = 35;
+};
+
+template <>
+struct SchemaTypeIndex<athr_output> {
+  static constexpr int32_t value = 36;
+};
+
+namespace fdr_schema {
+
+constexpr SchemaField BaseData_fields[] = {
+    SCHEMA_FIELD(BaseData, simulation_time_s),
+    SCHEMA_FIELD(BaseData, simulation_delta_time_s),
+    SCHEMA_FIELD(BaseData, simulation_rate),
+    SCHEMA_FIELD(BaseData, simulation_slew_on),
+    SCHEMA_FIELD(BaseData, simulation_was_pause_on),
+    SCHEMA_FIELD(BaseData, aircraft_position_latitude_deg),
+    SCHEMA_FIELD(BaseData, aircraft_position_longitude_deg),
+    SCHEMA_FIELD(BaseData, aircraft_Theta_deg),
+    SCHEMA_FIELD(BaseData, aircraft_Phi_deg),
+    SCHEMA_FIELD(BaseData, aircraft_Psi_magnetic_deg),
+    SCHEMA_FIELD(BaseData, aircraft_Psi_magnetic_track_deg),
+    SCHEMA_FIELD(BaseData, aircraft_Psi_true_deg),
+    SCHEMA_FIELD(BaseData, aircraft_qk_deg_s),
+    SCHEMA_FIELD(BaseData, aircraft_pk_deg_s),
+    SCHEMA_FIELD(BaseData, aircraft_rk_deg_s),
+    SCHEMA_FIELD(BaseData, aircraft_V_indicated_kn),
+    SCHEMA_FIELD(BaseData, aircraft_V_true_kn),
+    SCHEMA_FIELD(BaseData, aircraft_V_ground_kn),
+    SCHEMA_FIELD(BaseData, aircraft_Ma_mach),
+    SCHEMA_FIELD(BaseData, aircraft_alpha_deg),
+    SCHEMA_FIELD(BaseData, aircraft_beta_deg),
+    SCHEMA_FIELD(BaseData, aircraft_H_pressure_ft),
+    SCHEMA_FIELD(BaseData, aircraft_H_indicated_ft),
+    SCHEMA_FIELD(BaseData, aircraft_H_radio_ft),
+    SCHEMA_FIELD(BaseData, aircraft_nz_g),
+    SCHEMA_FIELD(BaseData, aircraft_ax_m_s2),
+    SCHEMA_FIELD(BaseData, aircraft_ay_m_s2),
+    SCHEMA_FIELD(BaseData, aircraft_az_m_s2),
+    SCHEMA_FIELD(BaseData, aircraft_bx_m_s2),
+    SCHEMA_FIELD(BaseData, aircraft_by_m_s2),
+    SCHEMA_FIELD(BaseData, aircraft_bz_m_s2),
+    SCHEMA_FIELD(BaseData, aircraft_eta_pos),
+    SCHEMA_FIELD(BaseData, aircraft_eta_trim_deg),
+    SCHEMA_FIELD(BaseData, aircraft_xi_pos),
+    SCHEMA_FIELD(BaseData, aircraft_zeta_pos),
+    SCHEMA_FIELD(BaseData, aircraft_zeta_trim_pos),
+    SCHEMA_FIELD(BaseData, aircraft_total_air_temperature_deg_celsius),
+    SCHEMA_FIELD(BaseData, aircraft_ice_structure_percent),
+    SCHEMA_FIELD(BaseData, aircraft_dfdr_event_button_pressed),
+    SCHEMA_FIELD(BaseData, atmosphere_ambient_pressure_mbar),
+    SCHEMA_FIELD(BaseData, atmosphere_ambient_wind_velocity_kn),
+    SCHEMA_FIELD(BaseData, atmosphere_ambient_wind_direction_deg),
+    SCHEMA_FIELD(BaseData, simulation_input_sidestick_pitch_pos),
+    SCHEMA_FIELD(BaseData, simulation_input_sidestick_roll_pos),
+    SCHEMA_FIELD(BaseData, simulation_input_rudder_pos),
+    SCHEMA_FIELD(BaseData, simulation_input_brake_pedal_left_pos),
+    SCHEMA_FIELD(BaseData, simulation_input_brake_pedal_right_pos),
+    SCHEMA_FIELD(BaseData, simulation_input_flaps_handle_pos),
+    SCHEMA_FIELD(BaseData, simulation_input_flaps_handle_index),
+    SCHEMA_FIELD(BaseData, simulation_input_spoilers_handle_pos),
+    SCHEMA_FIELD(BaseData, simulation_input_spoilers_are_armed),
+    SCHEMA_FIELD(BaseData, simulation_input_gear_handle_pos),
+    SCHEMA_FIELD(BaseData, simulation_input_tiller_handle_pos),
+    SCHEMA_FIELD(BaseData, simulation_input_parking_brake_switch_pos),
+    SCHEMA_FIELD(BaseData, simulation_assistant_is_assisted_takeoff_enabled),
+    SCHEMA_FIELD(BaseData, simulation_assistant_is_assisted_landing_enabled),
+    SCHEMA_FIELD(BaseData, simulation_assistant_is_ai_automatic_trim_active),
+    SCHEMA_FIELD(BaseData, simulation_assistant_is_ai_controls_active),
+};
+
+static_assert(SCHEMA_FIELD_END(BaseData, simulation_time_s, alignof(decltype(BaseData::simulation_delta_time_s))) == offsetof(BaseData, simulation_delta_time_s) &&
+              SCHEMA_FIELD_END(BaseData, simulation_delta_time_s, alignof(decltype(BaseData::simulation_rate))) == offsetof(BaseData, simulation_rate) &&
+              SCHEMA_FIELD_END(BaseData, simulation_rate, alignof(decltype(BaseData::simulation_slew_on))) == offsetof(BaseData, simulation_slew_on) &&
+              SCHEMA_FIELD_END(BaseData, simulation_slew_on, alignof(decltype(BaseData::simulation_was_pause_on))) == offsetof(BaseData, simulation_was_pause_on) &&
+              SCHEMA_FIELD_END(BaseData, simulation_was_pause_on, alignof(decltype(BaseData::aircraft_position_latitude_deg))) == offsetof(BaseData, aircraft_position_latitude_deg) &&
+              SCHEMA_FIELD_END(BaseData, aircraft_position_latitude_deg, alignof(decltype(BaseData::aircraft_position_longitude_deg))) == offsetof(BaseData, aircraft_position_longitude_deg) &&
+              SCHEMA_FIELD_END(BaseData, aircraft_position_longitude_deg, alignof(decltype(BaseData::aircraft_Theta_deg))) == offsetof(BaseData, aircraft_Theta_deg) &&
+              SCHEMA_FIELD_END(BaseData, aircraft_Theta_deg, alignof(decltype(BaseData::aircraft_Phi_deg))) == offsetof(BaseData, aircraft_Phi_deg) &&
+              SCHEMA_FIELD_END(BaseData, aircraft_Phi_deg, alignof(decltype(BaseData::aircraft_Psi_magnetic_deg))) == offsetof(BaseData, aircraft_Psi_magnetic_deg) &&
+              SCHEMA_FIELD_END(BaseData, aircraft_Psi_magnetic_deg, alignof(decltype(BaseData::aircraft_Psi_magnetic_track_deg))) == offsetof(BaseData, aircraft_Psi_magnetic_track_deg) &&
+              SCHEMA_FIELD_END(BaseData, aircraft_Psi_magnetic_track_deg, alignof(decltype(BaseData::aircraft_Psi_true_deg))) == offsetof(BaseData, aircraft_Psi_true_deg) &&
+              SCHEMA_FIELD_END(BaseData, aircraft_Psi_true_deg, alignof(decltype(BaseData::aircraft_qk_deg_s))) == offsetof(BaseData, aircraft_qk_deg_s) &&
+              SCHEMA_FIELD_END(BaseData, aircraft_qk_deg_s, alignof(decltype(BaseData::aircraft_pk_deg_s))) == offsetof(BaseData, aircraft_pk_deg_s) &&
+              SCHEMA_FIELD_END(BaseData, aircraft_pk_deg_s, alignof(decltype(BaseData::aircraft_rk_deg_s))) == offsetof(BaseData, aircraft_rk_deg_s) &&
+              SCHEMA_FIELD_END(BaseData, aircraft_rk_deg_s, alignof(decltype(BaseData::aircraft_V_indicated_kn))) == offsetof(BaseData, aircraft_V_indicated_kn) &&
+              SCHEMA_FIELD_END(BaseData, aircraft_V_indicated_kn, alignof(decltype(BaseData::aircraft_V_true_kn))) == offsetof(BaseData, aircraft_V_true_kn) &&
+              SCHEMA_FIELD_END(BaseData, aircraft_V_true_kn, alignof(decltype(BaseData::aircraft_V_ground_kn))) == offsetof(BaseData, aircraft_V_ground_kn) &&
+              SCHEMA_FIELD_END(BaseData, aircraft_V_ground_kn, alignof(decltype(BaseData::aircraft_Ma_mach))) == offsetof(BaseData, aircraft_Ma_mach) &&
+              SCHEMA_FIELD_END(BaseData, aircraft_Ma_mach, alignof(decltype(BaseData::aircraft_alpha_deg))) == offsetof(BaseData, aircraft_alpha_deg) &&
+              SCHEMA_FIELD_END(BaseData, aircraft_alpha_deg, alignof(decltype(BaseData::aircraft_beta_deg))) == offsetof(BaseData, aircraft_beta_deg) &&
+              SCHEMA_FIELD_END(BaseData, aircraft_beta_deg, alignof(decltype(BaseData::aircraft_H_pressure_ft))) == offsetof(BaseData, aircraft_H_pressure_ft) &&
+              SCHEMA_FIELD_END(BaseData, aircraft_H_pressure_ft, alignof(decltype(BaseData::aircraft_H_indicated_ft))) == offsetof(BaseData, aircraft_H_indicated_ft) &&
+              SCHEMA_FIELD_END(BaseData, aircraft_H_indicated_ft, alignof(decltype(BaseData::aircraft_H_radio_ft))) == offsetof(BaseData, aircraft_H_radio_ft) &&
+              SCHEMA_FIELD_END(BaseData, aircraft_H_radio_ft, alignof(decltype(BaseData::aircraft_nz_g))) == offsetof(BaseData, aircraft_nz_g) &&
+              SCHEMA_FIELD_END(BaseData, aircraft_nz_g, alignof(decltype(BaseData::aircraft_ax_m_s2))) == offsetof(BaseData, aircraft_ax_m_s2) &&
+              SCHEMA_FIELD_END(BaseData, aircraft_ax_m_s2, alignof(decltype(BaseData::aircraft_ay_m_s2))) == offsetof(BaseData, aircraft_ay_m_s2) &&
+              SCHEMA_FIELD_END(BaseData, aircraft_ay_m_s2, alignof(decltype(BaseData::aircraft_az_m_s2))) == offsetof(BaseData, aircraft_az_m_s2) &&
+              SCHEMA_FIELD_END(BaseData, aircraft_az_m_s2, alignof(decltype(BaseData::aircraft_bx_m_s2))) == offsetof(BaseData, aircraft_bx_m_s2) &&
+              SCHEMA_FIELD_END(BaseData, aircraft_bx_m_s2, alignof(decltype(BaseData::aircraft_by_m_s2))) == offsetof(BaseData, aircraft_by_m_s2) &&
+              SCHEMA_FIELD_END(BaseData, aircraft_by_m_s2, alignof(decltype(BaseData::aircraft_bz_m_s2))) == offsetof(BaseData, aircraft_bz_m_s2) &&
+              SCHEMA_FIELD_END(BaseData, aircraft_bz_m_s2, alignof(decltype(BaseData::aircraft_eta_pos))) == offsetof(BaseData, aircraft_eta_pos) &&
+              SCHEMA_FIELD_END(BaseData, aircraft_eta_pos, alignof(decltype(BaseData::aircraft_eta_trim_deg))) == offsetof(BaseData, aircraft_eta_trim_deg) &&
+              SCHEMA_FIELD_END(BaseData, aircraft_eta_trim_deg, alignof(decltype(BaseData::aircraft_xi_pos))) == offsetof(BaseData, aircraft_xi_pos) &&
+              SCHEMA_FIELD_END(BaseData, aircraft_xi_pos, alignof(decltype(BaseData::aircraft_zeta_pos))) == offsetof(BaseData, aircraft_zeta_pos) &&
+              SCHEMA_FIELD_END(BaseData, aircraft_zeta_pos, alignof(decltype(BaseData::aircraft_zeta_trim_pos))) == offsetof(BaseData, aircraft_zeta_trim_pos) &&
+              SCHEMA_FIELD_END(BaseData, aircraft_zeta_trim_pos, alignof(decltype(BaseData::aircraft_total_air_temperature_deg_celsius))) == offsetof(BaseData, aircraft_total_air_temperature_deg_celsius) &&
+              SCHEMA_FIELD_END(BaseData, aircraft_total_air_temperature_deg_celsius, alignof(decltype(BaseData::aircraft_ice_structure_percent))) == offsetof(BaseData, aircraft_ice_structure_percent) &&
+              SCHEMA_FIELD_END(BaseData, aircraft_ice_structure_percent, alignof(decltype(BaseData::aircraft_dfdr_event_button_pressed))) == offsetof(BaseData, aircraft_dfdr_event_button_pressed) &&
+              SCHEMA_FIELD_END(BaseData, aircraft_dfdr_event_button_pressed, alignof(decltype(BaseData::atmosphere_ambient_pressure_mbar))) == offsetof(BaseData, atmosphere_ambient_pressure_mbar) &&
+              SCHEMA_FIELD_END(BaseData, atmosphere_ambient_pressure_mbar, alignof(decltype(BaseData::atmosphere_ambient_wind_velocity_kn))) == offsetof(BaseData, atmosphere_ambient_wind_velocity_kn) &&
+              SCHEMA_FIELD_END(BaseData, atmosphere_ambient_wind_velocity_kn, alignof(decltype(BaseData::atmosphere_ambient_wind_direction_deg))) == offsetof(BaseData, atmosphere_ambient_wind_direction_deg) &&
+              SCHEMA_FIELD_END(BaseData, atmosphere_ambient_wind_direction_deg, alignof(decltype(BaseData::simulation_input_sidestick_pitch_pos))) == offsetof(BaseData, simulation_input_sidestick_pitch_pos) &&
+              SCHEMA_FIELD_END(BaseData, simulation_input_sidestick_pitch_pos, alignof(decltype(BaseData::simulation_input_sidestick_roll_pos))) == offsetof(BaseData, simulation_input_sidestick_roll_pos) &&
+              SCHEMA_FIELD_END(BaseData, simulation_input_sidestick_roll_pos, alignof(decltype(BaseData::simulation_input_rudder_pos))) == offsetof(BaseData, simulation_input_rudder_pos) &&
+              SCHEMA_FIELD_END(BaseData, simulation_input_rudder_pos, alignof(decltype(BaseData::simulation_input_brake_pedal_left_pos))) == offsetof(BaseData, simulation_input_brake_pedal_left_pos) &&
+              SCHEMA_FIELD_END(BaseData, simulation_input_brake_pedal_left_pos, alignof(decltype(BaseData::simulation_input_brake_pedal_right_pos))) == offsetof(BaseData, simulation_input_brake_pedal_right_pos) &&
+              SCHEMA_FIELD_END(BaseData, simulation_input_brake_pedal_right_pos, alignof(decltype(BaseData::simulation_input_flaps_handle_pos))) == offsetof(BaseData, simulation_input_flaps_handle_pos) &&
+              SCHEMA_FIELD_END(BaseData, simulation_input_flaps_handle_pos, alignof(decltype(BaseData::simulation_input_flaps_handle_index))) == offsetof(BaseData, simulation_input_flaps_handle_index) &&
+              SCHEMA_FIELD_END(BaseData, simulation_input_flaps_handle_index, alignof(decltype(BaseData::simulation_input_spoilers_handle_pos))) == offsetof(BaseData, simulation_input_spoilers_handle_pos) &&
+              SCHEMA_FIELD_END(BaseData, simulation_input_spoilers_handle_pos, alignof(decltype(BaseData::simulation_input_spoilers_are_armed))) == offsetof(BaseData, simulation_input_spoilers_are_armed) &&
+              SCHEMA_FIELD_END(BaseData, simulation_input_spoilers_are_armed, alignof(decltype(BaseData::simulation_input_gear_handle_pos))) == offsetof(BaseData, simulation_input_gear_handle_pos) &&
+              SCHEMA_FIELD_END(BaseData, simulation_input_gear_handle_pos, alignof(decltype(BaseData::simulation_input_tiller_handle_pos))) == offsetof(BaseData, simulation_input_tiller_handle_pos) &&
+              SCHEMA_FIELD_END(BaseData, simulation_input_tiller_handle_pos, alignof(decltype(BaseData::simulation_input_parking_brake_switch_pos))) == offsetof(BaseData, simulation_input_parking_brake_switch_pos) &&
+              SCHEMA_FIELD_END(BaseData, simulation_input_parking_brake_switch_pos, alignof(decltype(BaseData::simulation_assistant_is_assisted_takeoff_enabled))) == offsetof(BaseData, simulation_assistant_is_assisted_takeoff_enabled) &&
+              SCHEMA_FIELD_END(BaseData, simulation_assistant_is_assisted_takeoff_enabled, alignof(decltype(BaseData::simulation_assistant_is_assisted_landing_enabled))) == offsetof(BaseData, simulation_assistant_is_assisted_landing_enabled) &&
+              SCHEMA_FIELD_END(BaseData, simulation_assistant_is_assisted_landing_enabled, alignof(decltype(BaseData::simulation_assistant_is_ai_automatic_trim_active))) == offsetof(BaseData, simulation_assistant_is_ai_automatic_trim_active) &&
+              SCHEMA_FIELD_END(BaseData, simulation_assistant_is_ai_automatic_trim_active, alignof(decltype(BaseData::simulation_assistant_is_ai_controls_active))) == offsetof(BaseData, simulation_assistant_is_ai_controls_active) &&
+              SCHEMA_FIELD_END(BaseData, simulation_assistant_is_ai_controls_active, alignof(BaseData)) == sizeof(BaseData),
+              "schema of BaseData does not cover all of its members, regenerate the schema");
+
+constexpr SchemaField AircraftSpecificData_fields[] = {
+    SCHEMA_FIELD(AircraftSpecificData, simulation_input_throttle_lever_1_pos),
+    SCHEMA_FIELD(AircraftSpecificData, simulation_input_throttle_lever_2_pos),
+    SCHEMA_FIELD(AircraftSpecificData, simulation_input_throttle_lever_1_angle),
+    SCHEMA_FIELD(AircraftSpecificData, simulation_input_throttle_lever_2_angle),
+    SCHEMA_FIELD(AircraftSpecificData, aircraft_engine_1_N1_percent),
+    SCHEMA_FIELD(AircraftSpecificData, aircraft_engine_2_N1_percent),
+    SCHEMA_FIELD(AircraftSpecificData, aircraft_hydraulic_system_green_pressure_psi),
+    SCHEMA_FIELD(AircraftSpecificData, aircraft_hydraulic_system_blue_pressure_psi),
+    SCHEMA_FIELD(AircraftSpecificData, aircraft_hydraulic_system_yellow_pressure_psi),
+    SCHEMA_FIELD(AircraftSpecificData, aircraft_autobrake_system_armed_mode),
+    SCHEMA_FIELD(AircraftSpecificData, aircraft_autobrake_system_is_decel_light_on),
+    SCHEMA_FIELD(AircraftSpecificData, aircraft_gear_nosewheel_pos),
+    SCHEMA_FIELD(AircraftSpecificData, aircraft_gear_nosewheel_compression_percent),
+    SCHEMA_FIELD(AircraftSpecificData, aircraft_gear_main_left_compression_percent),
+    SCHEMA_FIELD(AircraftSpecificData, aircraft_gear_main_right_compression_percent),
+    SCHEMA_FIELD(AircraftSpecificData, aircraft_is_master_warning_active),
+    SCHEMA_FIELD(AircraftSpecificData, aircraft_is_master_caution_active),
+    SCHEMA_FIELD(AircraftSpecificData, aircraft_is_wing_anti_ice_active),
+    SCHEMA_FIELD(AircraftSpecificData, aircraft_is_alpha_floor_condition_active),
+    SCHEMA_FIELD(AircraftSpecificData, aircraft_is_high_aoa_protection_active),
+    SCHEMA_FIELD(AircraftSpecificData, aircraft_settings_is_realistic_tiller_enabled),
+    SCHEMA_FIELD(AircraftSpecificData, aircraft_settings_any_failures_active),
+};
+
+static_assert(SCHEMA_FIELD_END(AircraftSpecificData, simulation_input_throttle_lever_1_pos, alignof(decltype(AircraftSpecificData::simulation_input_throttle_lever_2_pos))) == offsetof(AircraftSpecificData, simulation_input_throttle_lever_2_pos) &&
+              SCHEMA_FIELD_END(AircraftSpecificData, simulation_input_throttle_lever_2_pos, alignof(decltype(AircraftSpecificData::simulation_input_throttle_lever_1_angle))) == offsetof(AircraftSpecificData, simulation_input_throttle_lever_1_angle) &&
+              SCHEMA_FIELD_END(AircraftSpecificData, simulation_input_throttle_lever_1_angle, alignof(decltype(AircraftSpecificData::simulation_input_throttle_lever_2_angle))) == offsetof(AircraftSpecificData, simulation_input_throttle_lever_2_angle) &&
+              SCHEMA_FIELD_END(AircraftSpecificData, simulation_input_throttle_lever_2_angle, alignof(decltype(AircraftSpecificData::aircraft_engine_1_N1_percent))) == offsetof(AircraftSpecificData, aircraft_engine_1_N1_percent) &&
+              SCHEMA_FIELD_END(AircraftSpecificData, aircraft_engine_1_N1_percent, alignof(decltype(AircraftSpecificData::aircraft_engine_2_N1_percent))) == offsetof(AircraftSpecificData, aircraft_engine_2_N1_percent) &&
+              SCHEMA_FIELD_END(AircraftSpecificData, aircraft_engine_2_N1_percent, alignof(decltype(AircraftSpecificData::aircraft_hydraulic_system_green_pressure_psi))) == offsetof(AircraftSpecificData, aircraft_hydraulic_system_green_pressure_psi) &&
+              SCHEMA_FIELD_END(AircraftSpecificData, aircraft_hydraulic_system_green_pressure_psi, alignof(decltype(AircraftSpecificData::aircraft_hydraulic_system_blue_pressure_psi))) == offsetof(AircraftSpecificData, aircraft_hydraulic_system_blue_pressure_psi) &&
+              SCHEMA_FIELD_END(AircraftSpecificData, aircraft_hydraulic_system_blue_pressure_psi, alignof(decltype(AircraftSpecificData::aircraft_hydraulic_system_yellow_pressure_psi))) == offsetof(AircraftSpecificData, aircraft_hydraulic_system_yellow_pressure_psi) &&
+              SCHEMA_FIELD_END(AircraftSpecificData, aircraft_hydraulic_system_yellow_pressure_psi, alignof(decltype(AircraftSpecificData::aircraft_autobrake_system_armed_mode))) == offsetof(AircraftSpecificData, aircraft_autobrake_system_armed_mode) &&
+              SCHEMA_FIELD_END(AircraftSpecificData, aircraft_autobrake_system_armed_mode, alignof(decltype(AircraftSpecificData::aircraft_autobrake_system_is_decel_light_on))) == offsetof(AircraftSpecificData, aircraft_autobrake_system_is_decel_light_on) &&
+              SCHEMA_FIELD_END(AircraftSpecificData, aircraft_autobrake_system_is_decel_light_on, alignof(decltype(AircraftSpecificData::aircraft_gear_nosewheel_pos))) == offsetof(AircraftSpecificData, aircraft_gear_nosewheel_pos) &&
+              SCHEMA_FIELD_END(AircraftSpecificData, aircraft_gear_nosewheel_pos, alignof(decltype(AircraftSpecificData::aircraft_gear_nosewheel_compression_percent))) == offsetof(AircraftSpecificData, aircraft_gear_nosewheel_compression_percent) &&
+              SCHEMA_FIELD_END(AircraftSpecificData, aircraft_gear_nosewheel_compression_percent, alignof(decltype(AircraftSpecificData::aircraft_gear_main_left_compression_percent))) == offsetof(AircraftSpecificData, aircraft_gear_main_left_compression_percent) &&
+              SCHEMA_FIELD_END(AircraftSpecificData, aircraft_gear_main_left_compression_percent, alignof(decltype(AircraftSpecificData::aircraft_gear_main_right_compression_percent))) == offsetof(AircraftSpecificData, aircraft_gear_main_right_compression_percent) &&
+              SCHEMA_FIELD_END(AircraftSpecificData, aircraft_gear_main_right_compression_percent, alignof(decltype(AircraftSpecificData::aircraft_is_master_warning_active))) == offsetof(AircraftSpecificData, aircraft_is_master_warning_active) &&
+              SCHEMA_FIELD_END(AircraftSpecificData, aircraft_is_master_warning_active, alignof(decltype(AircraftSpecificData::aircraft_is_master_caution_active))) == offsetof(AircraftSpecificData, aircraft_is_master_caution_active) &&
+              SCHEMA_FIELD_END(AircraftSpecificData, aircraft_is_master_caution_active, alignof(decltype(AircraftSpecificData::aircraft_is_wing_anti_ice_active))) == offsetof(AircraftSpecificData, aircraft_is_wing_anti_ice_active) &&
+              SCHEMA_FIELD_END(AircraftSpecificData, aircraft_is_wing_anti_ice_active, alignof(decltype(AircraftSpecificData::aircraft_is_alpha_floor_condition_active))) == offsetof(AircraftSpecificData, aircraft_is_alpha_floor_condition_active) &&
+              SCHEMA_FIELD_END(AircraftSpecificData, aircraft_is_alpha_floor_condition_active, alignof(decltype(AircraftSpecificData::aircraft_is_high_aoa_protection_active))) == offsetof(AircraftSpecificData, aircraft_is_high_aoa_protection_active) &&
+              SCHEMA_FIELD_END(AircraftSpecificData, aircraft_is_high_aoa_protection_active, alignof(decltype(AircraftSpecificData::aircraft_settings_is_realistic_tiller_enabled))) == offsetof(AircraftSpecificData, aircraft_settings_is_realistic_tiller_enabled) &&
+              SCHEMA_FIELD_END(AircraftSpecificData, aircraft_settings_is_realistic_tiller_enabled, alignof(decltype(AircraftSpecificData::aircraft_settings_any_failures_active))) == offsetof(AircraftSpecificData, aircraft_settings_any_failures_active) &&
+              SCHEMA_FIELD_END(AircraftSpecificData, aircraft_settings_any_failures_active, alignof(AircraftSpecificData)) == sizeof(AircraftSpecificData),
+              "schema of AircraftSpecificData does not cover all of its members, regenerate the schema");
+
+constexpr SchemaField SampledChannels_fields[] = {
+    SCHEMA_FIELD(SampledChannels, specific),
+    SCHEMA_FIELD(SampledChannels, elac),
+    SCHEMA_FIELD(SampledChannels, sec),
+    SCHEMA_FIELD(SampledChannels, fac),
+    SCHEMA_FIELD(SampledChannels, fmgc),
+    SCHEMA_FIELD(SampledChannels, fmgc_inputs),
+    SCHEMA_FIELD(SampledChannels, fadec),
+};
+
+static_assert(SCHEMA_FIELD_END(SampledChannels, specific, alignof(decltype(SampledChannels::elac))) == offsetof(SampledChannels, elac) &&
+              SCHEMA_FIELD_END(SampledChannels, elac, alignof(decltype(SampledChannels::sec))) == offsetof(SampledChannels, sec) &&
+              SCHEMA_FIELD_END(SampledChannels, sec, alignof(decltype(SampledChannels::fac))) == offsetof(SampledChannels, fac) &&
+              SCHEMA_FIELD_END(SampledChannels, fac, alignof(decltype(SampledChannels::fmgc))) == offsetof(SampledChannels, fmgc) &&
+              SCHEMA_FIELD_END(SampledChannels, fmgc, alignof(decltype(SampledChannels::fmgc_inputs))) == offsetof(SampledChannels, fmgc_inputs) &&
+              SCHEMA_FIELD_END(SampledChannels, fmgc_inputs, alignof(decltype(SampledChannels::fadec))) == offsetof(SampledChannels, fadec) &&
+              SCHEMA_FIELD_END(SampledChannels, fadec, alignof(SampledChannels)) == sizeof(SampledChannels),
+              "schema of SampledChannels does not cover all of its members, regenerate the schema");
+
+constexpr SchemaField base_arinc_429_fields[] = {
+    SCHEMA_FIELD(base_arinc_429, SSM),
+    SCHEMA_FIELD(base_arinc_429, Data),
+};
+
+static_assert(SCHEMA_FIELD_END(base_arinc_429, SSM, alignof(decltype(base_arinc_429::Data))) == offsetof(base_arinc_429, Data) &&
+              SCHEMA_FIELD_END(base_arinc_429, Data, alignof(base_arinc_429)) == sizeof(base_arinc_429),
+              "schema of base_arinc_429 does not cover all of its members, regenerate the schema");
+
+constexpr SchemaField base_elac_out_bus_fields[] = {
+    SCHEMA_FIELD(base_elac_out_bus, left_aileron_position_deg),
+    SCHEMA_FIELD(base_elac_out_bus, right_aileron_position_deg),
+    SCHEMA_FIELD(base_elac_out_bus, left_elevator_position_deg),
+    SCHEMA_FIELD(base_elac_out_bus, right_elevator_position_deg),
+    SCHEMA_FIELD(base_elac_out_bus, ths_position_deg),
+    SCHEMA_FIELD(base_elac_out_bus, left_sidestick_pitch_command_deg),
+    SCHEMA_FIELD(base_elac_out_bus, right_sidestick_pitch_command_deg),
+    SCHEMA_FIELD(base_elac_out_bus, left_sidestick_roll_command_deg),
+    SCHEMA_FIELD(base_elac_out_bus, right_sidestick_roll_command_deg),
+    SCHEMA_FIELD(base_elac_out_bus, rudder_pedal_position_deg),
+    SCHEMA_FIELD(base_elac_out_bus, aileron_command_deg),
+    SCHEMA_FIELD(base_elac_out_bus, roll_spoiler_command_deg),
+    SCHEMA_FIELD(base_elac_out_bus, yaw_damper_command_deg),
+    SCHEMA_FIELD(base_elac_out_bus, elevator_double_pressurization_command_deg),
+    SCHEMA_FIELD(base_elac_out_bus, speedbrake_extension_deg),
+    SCHEMA_FIELD(base_elac_out_bus, discrete_status_word_1),
+    SCHEMA_FIELD(base_elac_out_bus, discrete_status_word_2),
+};
+
+static_assert(SCHEMA_FIELD_END(base_elac_out_bus, left_aileron_position_deg, alignof(decltype(base_elac_out_bus::right_aileron_position_deg))) == offsetof(base_elac_out_bus, right_aileron_position_deg) &&
+              SCHEMA_FIELD_END(base_elac_out_bus, right_aileron_position_deg, alignof(decltype(base_elac_out_bus::left_elevator_position_deg))) == offsetof(base_elac_out_bus, left_elevator_position_deg) &&
+              SCHEMA_FIELD_END(base_elac_out_bus, left_elevator_position_deg, alignof(decltype(base_elac_out_bus::right_elevator_position_deg))) == offsetof(base_elac_out_bus, right_elevator_position_deg) &&
+              SCHEMA_FIELD_END(base_elac_out_bus, right_elevator_position_deg, alignof(decltype(base_elac_out_bus::ths_position_deg))) == offsetof(base_elac_out_bus, ths_position_deg) &&
+              SCHEMA_FIELD_END(base_elac_out_bus, ths_position_deg, alignof(decltype(base_elac_out_bus::left_sidestick_pitch_command_deg))) == offsetof(base_elac_out_bus, left_sidestick_pitch_command_deg) &&
+              SCHEMA_FIELD_END(base_elac_out_bus, left_sidestick_pitch_command_deg, alignof(decltype(base_elac_out_bus::right_sidestick_pitch_command_deg))) == offsetof(base_elac_out_bus, right_sidestick_pitch_command_deg) &&
+              SCHEMA_FIELD_END(base_elac_out_bus, right_sidestick_pitch_command_deg, alignof(decltype(base_elac_out_bus::left_sidestick_roll_command_deg))) == offsetof(base_elac_out_bus, left_sidestick_roll_command_deg) &&
+              SCHEMA_FIELD_END(base_elac_out_bus, left_sidestick_roll_command_deg, alignof(decltype(base_elac_out_bus::right_sidestick_roll_command_deg))) == offsetof(base_elac_out_bus, right_sidestick_roll_command_deg) &&
+              SCHEMA_FIELD_END(base_elac_out_bus, right_sidestick_roll_command_deg, alignof(decltype(base_elac_out_bus::rudder_pedal_position_deg))) == offsetof(base_elac_out_bus, rudder_pedal_position_deg) &&
+              SCHEMA_FIELD_END(base_elac_out_bus, rudder_pedal_position_deg, alignof(decltype(base_elac_out_bus::aileron_command_deg))) == offsetof(base_elac_out_bus, aileron_command_deg) &&
+              SCHEMA_FIELD_END(base_elac_out_bus, aileron_command_deg, alignof(decltype(base_elac_out_bus::roll_spoiler_command_deg))) == offsetof(base_elac_out_bus, roll_spoiler_command_deg) &&
+              SCHEMA_FIELD_END(base_elac_out_bus, roll_spoiler_command_deg, alignof(decltype(base_elac_out_bus::yaw_damper_command_deg))) == offsetof(base_elac_out_bus, yaw_damper_command_deg) &&
+              SCHEMA_FIELD_END(base_elac_out_bus, yaw_damper_command_deg, alignof(decltype(base_elac_out_bus::elevator_double_pressurization_command_deg))) == offsetof(base_elac_out_bus, elevator_double_pressurization_command_deg) &&
+              SCHEMA_FIELD_END(base_elac_out_bus, elevator_double_pressurization_command_deg, alignof(decltype(base_elac_out_bus::speedbrake_extension_deg))) == offsetof(base_elac_out_bus, speedbrake_extension_deg) &&
+              SCHEMA_FIELD_END(base_elac_out_bus, speedbrake_extension_deg, alignof(decltype(base_elac_out_bus::discrete_status_word_1))) == offsetof(base_elac_out_bus, discrete_status_word_1) &&
+              SCHEMA_FIELD_END(base_elac_out_bus, discrete_status_word_1, alignof(decltype(base_elac_out_bus::discrete_status_word_2))) == offsetof(base_elac_out_bus, discrete_status_word_2) &&
+              SCHEMA_FIELD_END(base_elac_out_bus, discrete_status_word_2, alignof(base_elac_out_bus)) == sizeof(base_elac_out_bus),
+              "schema of base_elac_out_bus does not cover all of its members, regenerate the schema");
+
+constexpr SchemaField base_elac_discrete_outputs_fields[] = {
+    SCHEMA_FIELD(base_elac_discrete_outputs, pitch_axis_ok),
+    SCHEMA_FIELD(base_elac_discrete_outputs, left_aileron_ok),
+    SCHEMA_FIELD(base_elac_discrete_outputs, right_aileron_ok),
+    SCHEMA_FIELD(base_elac_discrete_outputs, digital_output_validated),
+    SCHEMA_FIELD(base_elac_discrete_outputs, ap_1_authorised),
+    SCHEMA_FIELD(base_elac_discrete_outputs, ap_2_authorised),
+    SCHEMA_FIELD(base_elac_discrete_outputs, left_aileron_active_mode),
+    SCHEMA_FIELD(base_elac_discrete_outputs, right_aileron_active_mode),
+    SCHEMA_FIELD(base_elac_discrete_outputs, left_elevator_damping_mode),
+    SCHEMA_FIELD(base_elac_discrete_outputs, right_elevator_damping_mode),
+    SCHEMA_FIELD(base_elac_discrete_outputs, ths_active),
+    SCHEMA_FIELD(base_elac_discrete_outputs, batt_power_supply),
+};
+
+static_assert(SCHEMA_FIELD_END(base_elac_discrete_outputs, pitch_axis_ok, alignof(decltype(base_elac_discrete_outputs::left_aileron_ok))) == offsetof(base_elac_discrete_outputs, left_aileron_ok) &&
+              SCHEMA_FIELD_END(base_elac_discrete_outputs, left_aileron_ok, alignof(decltype(base_elac_discrete_outputs::right_aileron_ok))) == offsetof(base_elac_discrete_outputs, right_aileron_ok) &&
+              SCHEMA_FIELD_END(base_elac_discrete_outputs, right_aileron_ok, alignof(decltype(base_elac_discrete_outputs::digital_output_validated))) == offsetof(base_elac_discrete_outputs, digital_output_validated) &&
+              SCHEMA_FIELD_END(base_elac_discrete_outputs, digital_output_validated, alignof(decltype(base_elac_discrete_outputs::ap_1_authorised))) == offsetof(base_elac_discrete_outputs, ap_1_authorised) &&
+              SCHEMA_FIELD_END(base_elac_discrete_outputs, ap_1_authorised, alignof(decltype(base_elac_discrete_outputs::ap_2_authorised))) == offsetof(base_elac_discrete_outputs, ap_2_authorised) &&
+              SCHEMA_FIELD_END(base_elac_discrete_outputs, ap_2_authorised, alignof(decltype(base_elac_discrete_outputs::left_aileron_active_mode))) == offsetof(base_elac_discrete_outputs, left_aileron_active_mode) &&
+              SCHEMA_FIELD_END(base_elac_discrete_outputs, left_aileron_active_mode, alignof(decltype(base_elac_discrete_outputs::right_aileron_active_mode))) == offsetof(base_elac_discrete_outputs, right_aileron_active_mode) &&
+              SCHEMA_FIELD_END(base_elac_discrete_outputs, right_aileron_active_mode, alignof(decltype(base_elac_discrete_outputs::left_elevator_damping_mode))) == offsetof(base_elac_discrete_outputs, left_elevator_damping_mode) &&
+              SCHEMA_FIELD_END(base_elac_discrete_outputs, left_elevator_damping_mode, alignof(decltype(base_elac_discrete_outputs::right_elevator_damping_mode))) == offsetof(base_elac_discrete_outputs, right_elevator_damping_mode) &&
+              SCHEMA_FIELD_END(base_elac_discrete_outputs, right_elevator_damping_mode, alignof(decltype(base_elac_discrete_outputs::ths_active))) == offsetof(base_elac_discrete_outputs, ths_active) &&
+              SCHEMA_FIELD_END(base_elac_discrete_outputs, ths_active, alignof(decltype(base_elac_discrete_outputs::batt_power_supply))) == offsetof(base_elac_discrete_outputs, batt_power_supply) &&
+              SCHEMA_FIELD_END(base_elac_discrete_outputs, batt_power_supply, alignof(base_elac_discrete_outputs)) == sizeof(base_elac_discrete_outputs),
+              "schema of base_elac_discrete_outputs does not cover all of its members, regenerate the schema");
+
+constexpr SchemaField base_elac_analog_outputs_fields[] = {
+    SCHEMA_FIELD(base_elac_analog_outputs, left_elev_pos_order_deg),
+    SCHEMA_FIELD(base_elac_analog_outputs, right_elev_pos_order_deg),
+    SCHEMA_FIELD(base_elac_analog_outputs, ths_pos_order),
+    SCHEMA_FIELD(base_elac_analog_outputs, left_aileron_pos_order),
+    SCHEMA_FIELD(base_elac_analog_outputs, right_aileron_pos_order),
+};
+
+static_assert(SCHEMA_FIELD_END(base_elac_analog_outputs, left_elev_pos_order_deg, alignof(decltype(base_elac_analog_outputs::right_elev_pos_order_deg))) == offsetof(base_elac_analog_outputs, right_elev_pos_order_deg) &&
+              SCHEMA_FIELD_END(base_elac_analog_outputs, right_elev_pos_order_deg, alignof(decltype(base_elac_analog_outputs::ths_pos_order))) == offsetof(base_elac_analog_outputs, ths_pos_order) &&
+              SCHEMA_FIELD_END(base_elac_analog_outputs, ths_pos_order, alignof(decltype(base_elac_analog_outputs::left_aileron_pos_order))) == offsetof(base_elac_analog_outputs, left_aileron_pos_order) &&
+              SCHEMA_FIELD_END(base_elac_analog_outputs, left_aileron_pos_order, alignof(decltype(base_elac_analog_outputs::right_aileron_pos_order))) == offsetof(base_elac_analog_outputs, right_aileron_pos_order) &&
+              SCHEMA_FIELD_END(base_elac_analog_outputs, right_aileron_pos_order, alignof(base_elac_analog_outputs)) == sizeof(base_elac_analog_outputs),
+              "schema of base_elac_analog_outputs does not cover all of its members, regenerate the schema");
+
+constexpr SchemaField base_sec_out_bus_fields[] = {
+    SCHEMA_FIELD(base_sec_out_bus, left_spoiler_1_position_deg),
+    SCHEMA_FIELD(base_sec_out_bus, right_spoiler_1_position_deg),
+    SCHEMA_FIELD(base_sec_out_bus, left_spoiler_2_position_deg),
+    SCHEMA_FIELD(base_sec_out_bus, right_spoiler_2_position_deg),
+    SCHEMA_FIELD(base_sec_out_bus, left_elevator_position_deg),
+    SCHEMA_FIELD(base_sec_out_bus, right_elevator_position_deg),
+    SCHEMA_FIELD(base_sec_out_bus, ths_position_deg),
+    SCHEMA_FIELD(base_sec_out_bus, left_sidestick_pitch_command_deg),
+    SCHEMA_FIELD(base_sec_out_bus, right_sidestick_pitch_command_deg),
+    SCHEMA_FIELD(base_sec_out_bus, left_sidestick_roll_command_deg),
+    SCHEMA_FIELD(base_sec_out_bus, right_sidestick_roll_command_deg),
+    SCHEMA_FIELD(base_sec_out_bus, speed_brake_lever_command_deg),
+    SCHEMA_FIELD(base_sec_out_bus, speed_brake_command_deg),
+    SCHEMA_FIELD(base_sec_out_bus, thrust_lever_angle_1_deg),
+    SCHEMA_FIELD(base_sec_out_bus, thrust_lever_angle_2_deg),
+    SCHEMA_FIELD(base_sec_out_bus, discrete_status_word_1),
+    SCHEMA_FIELD(base_sec_out_bus, discrete_status_word_2),
+};
+
+static_assert(SCHEMA_FIELD_END(base_sec_out_bus, left_spoiler_1_position_deg, alignof(decltype(base_sec_out_bus::right_spoiler_1_position_deg))) == offsetof(base_sec_out_bus, right_spoiler_1_position_deg) &&
+              SCHEMA_FIELD_END(base_sec_out_bus, right_spoiler_1_position_deg, alignof(decltype(base_sec_out_bus::left_spoiler_2_position_deg))) == offsetof(base_sec_out_bus, left_spoiler_2_position_deg) &&
+              SCHEMA_FIELD_END(base_sec_out_bus, left_spoiler_2_position_deg, alignof(decltype(base_sec_out_bus::right_spoiler_2_position_deg))) == offsetof(base_sec_out_bus, right_spoiler_2_position_deg) &&
+              SCHEMA_FIELD_END(base_sec_out_bus, right_spoiler_2_position_deg, alignof(decltype(base_sec_out_bus::left_elevator_position_deg))) == offsetof(base_sec_out_bus, left_elevator_position_deg) &&
+              SCHEMA_FIELD_END(base_sec_out_bus, left_elevator_position_deg, alignof(decltype(base_sec_out_bus::right_elevator_position_deg))) == offsetof(base_sec_out_bus, right_elevator_position_deg) &&
+              SCHEMA_FIELD_END(base_sec_out_bus, right_elevator_position_deg, alignof(decltype(base_sec_out_bus::ths_position_deg))) == offsetof(base_sec_out_bus, ths_position_deg) &&
+              SCHEMA_FIELD_END(base_sec_out_bus, ths_position_deg, alignof(decltype(base_sec_out_bus::left_sidestick_pitch_command_deg))) == offsetof(base_sec_out_bus, left_sidestick_pitch_command_deg) &&
+              SCHEMA_FIELD_END(base_sec_out_bus, left_sidestick_pitch_command_deg, alignof(decltype(base_sec_out_bus::right_sidestick_pitch_command_deg))) == offsetof(base_sec_out_bus, right_sidestick_pitch_command_deg) &&
+              SCHEMA_FIELD_END(base_sec_out_bus, right_sidestick_pitch_command_deg, alignof(decltype(base_sec_out_bus::left_sidestick_roll_command_deg))) == offsetof(base_sec_out_bus, left_sidestick_roll_command_deg) &&
+              SCHEMA_FIELD_END(base_sec_out_bus, left_sidestick_roll_command_deg, alignof(decltype(base_sec_out_bus::right_sidestick_roll_command_deg))) == offsetof(base_sec_out_bus, right_sidestick_roll_command_deg) &&
+              SCHEMA_FIELD_END(base_sec_out_bus, right_sidestick_roll_command_deg, alignof(decltype(base_sec_out_bus::speed_brake_lever_command_deg))) == offsetof(base_sec_out_bus, speed_brake_lever_command_deg) &&
+              SCHEMA_FIELD_END(base_sec_out_bus, speed_brake_lever_command_deg, alignof(decltype(base_sec_out_bus::speed_brake_command_deg))) == offsetof(base_sec_out_bus, speed_brake_command_deg) &&
+              SCHEMA_FIELD_END(base_sec_out_bus, speed_brake_command_deg, alignof(decltype(base_sec_out_bus::thrust_lever_angle_1_deg))) == offsetof(base_sec_out_bus, thrust_lever_angle_1_deg) &&
+              SCHEMA_FIELD_END(base_sec_out_bus, thrust_lever_angle_1_deg, alignof(decltype(base_sec_out_bus::thrust_lever_angle_2_deg))) == offsetof(base_sec_out_bus, thrust_lever_angle_2_deg) &&
+              SCHEMA_FIELD_END(base_sec_out_bus, thrust_lever_angle_2_deg, alignof(decltype(base_sec_out_bus::discrete_status_word_1))) == offsetof(base_sec_out_bus, discrete_status_word_1) &&
+              SCHEMA_FIELD_END(base_sec_out_bus, discrete_status_word_1, alignof(decltype(base_sec_out_bus::discrete_status_word_2))) == offsetof(base_sec_out_bus, discrete_status_word_2) &&
+              SCHEMA_FIELD_END(base_sec_out_bus, discrete_status_word_2, alignof(base_sec_out_bus)) == sizeof(base_sec_out_bus),
+              "schema of base_sec_out_bus does not cover all of its members, regenerate the schema");
+
+constexpr SchemaField base_sec_discrete_outputs_fields[] = {
+    SCHEMA_FIELD(base_sec_discrete_outputs, thr_reverse_selected),
+    SCHEMA_FIELD(base_sec_discrete_outputs, left_elevator_ok),
+    SCHEMA_FIELD(base_sec_discrete_outputs, right_elevator_ok),
+    SCHEMA_FIELD(base_sec_discrete_outputs, ground_spoiler_out),
+    SCHEMA_FIELD(base_sec_discrete_outputs, sec_failed),
+    SCHEMA_FIELD(base_sec_discrete_outputs, left_elevator_damping_mode),
+    SCHEMA_FIELD(base_sec_discrete_outputs, right_elevator_damping_mode),
+    SCHEMA_FIELD(base_sec_discrete_outputs, ths_active),
+    SCHEMA_FIELD(base_sec_discrete_outputs, batt_power_supply),
+};
+
+static_assert(SCHEMA_FIELD_END(base_sec_discrete_outputs, thr_reverse_selected, alignof(decltype(base_sec_discrete_outputs::left_elevator_ok))) == offsetof(base_sec_discrete_outputs, left_elevator_ok) &&
+              SCHEMA_FIELD_END(base_sec_discrete_outputs, left_elevator_ok, alignof(decltype(base_sec_discrete_outputs::right_elevator_ok))) == offsetof(base_sec_discrete_outputs, right_elevator_ok) &&
+              SCHEMA_FIELD_END(base_sec_discrete_outputs, right_elevator_ok, alignof(decltype(base_sec_discrete_outputs::ground_spoiler_out))) == offsetof(base_sec_discrete_outputs, ground_spoiler_out) &&
+              SCHEMA_FIELD_END(base_sec_discrete_outputs, ground_spoiler_out, alignof(decltype(base_sec_discrete_outputs::sec_failed))) == offsetof(base_sec_discrete_outputs, sec_failed) &&
+              SCHEMA_FIELD_END(base_sec_discrete_outputs, sec_failed, alignof(decltype(base_sec_discrete_outputs::left_elevator_damping_mode))) == offsetof(base_sec_discrete_outputs, left_elevator_damping_mode) &&
+              SCHEMA_FIELD_END(base_sec_discrete_outputs, left_elevator_damping_mode, alignof(decltype(base_sec_discrete_outputs::right_elevator_damping_mode))) == offsetof(base_sec_discrete_outputs, right_elevator_damping_mode) &&
+              SCHEMA_FIELD_END(base_sec_discrete_outputs, right_elevator_damping_mode, alignof(decltype(base_sec_discrete_outputs::ths_active))) == offsetof(base_sec_discrete_outputs, ths_active) &&
+              SCHEMA_FIELD_END(base_sec_discrete_outputs, ths_active, alignof(decltype(base_sec_discrete_outputs::batt_power_supply))) == offsetof(base_sec_discrete_outputs, batt_power_supply) &&
+              SCHEMA_FIELD_END(base_sec_discrete_outputs, batt_power_supply, alignof(base_sec_discrete_outputs)) == sizeof(base_sec_discrete_outputs),
+              "schema of base_sec_discrete_outputs does not cover all of its members, regenerate the schema");
+
+constexpr SchemaField base_sec_analog_outputs_fields[] = {
+    SCHEMA_FIELD(base_sec_analog_outputs, left_elev_pos_order_deg),
+    SCHEMA_FIELD(base_sec_analog_outputs, right_elev_pos_order_deg),
+    SCHEMA_FIELD(base_sec_analog_outputs, ths_pos_order_deg),
+    SCHEMA_FIELD(base_sec_analog_outputs, left_spoiler_1_pos_order_deg),
+    SCHEMA_FIELD(base_sec_analog_outputs, right_spoiler_1_pos_order_deg),
+    SCHEMA_FIELD(base_sec_analog_outputs, left_spoiler_2_pos_order_deg),
+    SCHEMA_FIELD(base_sec_analog_outputs, right_spoiler_2_pos_order_deg),
+};
+
+static_assert(SCHEMA_FIELD_END(base_sec_analog_outputs, left_elev_pos_order_deg, alignof(decltype(base_sec_analog_outputs::right_elev_pos_order_deg))) == offsetof(base_sec_analog_outputs, right_elev_pos_order_deg) &&
+              SCHEMA_FIELD_END(base_sec_analog_outputs, right_elev_pos_order_deg, alignof(decltype(base_sec_analog_outputs::ths_pos_order_deg))) == offsetof(base_sec_analog_outputs, ths_pos_order_deg) &&
+              SCHEMA_FIELD_END(base_sec_analog_outputs, ths_pos_order_deg, alignof(decltype(base_sec_analog_outputs::left_spoiler_1_pos_order_deg))) == offsetof(base_sec_analog_outputs, left_spoiler_1_pos_order_deg) &&
+              SCHEMA_FIELD_END(base_sec_analog_outputs, left_spoiler_1_pos_order_deg, alignof(decltype(base_sec_analog_outputs::right_spoiler_1_pos_order_deg))) == offsetof(base_sec_analog_outputs, right_spoiler_1_pos_order_deg) &&
+              SCHEMA_FIELD_END(base_sec_analog_outputs, right_spoiler_1_pos_order_deg, alignof(decltype(base_sec_analog_outputs::left_spoiler_2_pos_order_deg))) == offsetof(base_sec_analog_outputs, left_spoiler_2_pos_order_deg) &&
+              SCHEMA_FIELD_END(base_sec_analog_outputs, left_spoiler_2_pos_order_deg, alignof(decltype(base_sec_analog_outputs::right_spoiler_2_pos_order_deg))) == offsetof(base_sec_analog_outputs, right_spoiler_2_pos_order_deg) &&
+              SCHEMA_FIELD_END(base_sec_analog_outputs, right_spoiler_2_pos_order_deg, alignof(base_sec_analog_outputs)) == sizeof(base_sec_analog_outputs),
+              "schema of base_sec_analog_outputs does not cover all of its members, regenerate the schema");
+
+constexpr SchemaField base_fac_bus_fields[] = {
+    SCHEMA_FIELD(base_fac_bus, discrete_word_1),
+    SCHEMA_FIELD(base_fac_bus, gamma_a_deg),
+    SCHEMA_FIELD(base_fac_bus, gamma_t_deg),
+    SCHEMA_FIELD(base_fac_bus, total_weight_lbs),
+    SCHEMA_FIELD(base_fac_bus, center_of_gravity_pos_percent),
+    SCHEMA_FIELD(base_fac_bus, sideslip_target_deg),
+    SCHEMA_FIELD(base_fac_bus, fac_slat_angle_deg),
+    SCHEMA_FIELD(base_fac_bus, fac_flap_angle_deg),
+    SCHEMA_FIELD(base_fac_bus, discrete_word_2),
+    SCHEMA_FIELD(base_fac_bus, rudder_travel_limit_command_deg),
+    SCHEMA_FIELD(base_fac_bus, delta_r_yaw_damper_deg),
+    SCHEMA_FIELD(base_fac_bus, estimated_sideslip_deg),
+    SCHEMA_FIELD(base_fac_bus, v_alpha_lim_kn),
+    SCHEMA_FIELD(base_fac_bus, v_ls_kn),
+    SCHEMA_FIELD(base_fac_bus, v_stall_kn),
+    SCHEMA_FIELD(base_fac_bus, v_alpha_prot_kn),
+    SCHEMA_FIELD(base_fac_bus, v_stall_warn_kn),
+    SCHEMA_FIELD(base_fac_bus, speed_trend_kn),
+    SCHEMA_FIELD(base_fac_bus, v_3_kn),
+    SCHEMA_FIELD(base_fac_bus, v_4_kn),
+    SCHEMA_FIELD(base_fac_bus, v_man_kn),
+    SCHEMA_FIELD(base_fac_bus, v_max_kn),
+    SCHEMA_FIELD(base_fac_bus, v_fe_next_kn),
+    SCHEMA_FIELD(base_fac_bus, discrete_word_3),
+    SCHEMA_FIELD(base_fac_bus, discrete_word_4),
+    SCHEMA_FIELD(base_fac_bus, discrete_word_5),
+    SCHEMA_FIELD(base_fac_bus, delta_r_rudder_trim_deg),
+    SCHEMA_FIELD(base_fac_bus, rudder_trim_pos_deg),
+};
+
+static_assert(SCHEMA_FIELD_END(base_fac_bus, discrete_word_1, alignof(decltype(base_fac_bus::gamma_a_deg))) == offsetof(base_fac_bus, gamma_a_deg) &&
+              SCHEMA_FIELD_END(base_fac_bus, gamma_a_deg, alignof(decltype(base_fac_bus::gamma_t_deg))) == offsetof(base_fac_bus, gamma_t_deg) &&
+              SCHEMA_FIELD_END(base_fac_bus, gamma_t_deg, alignof(decltype(base_fac_bus::total_weight_lbs))) == offsetof(base_fac_bus, total_weight_lbs) &&
+              SCHEMA_FIELD_END(base_fac_bus, total_weight_lbs, alignof(decltype(base_fac_bus::center_of_gravity_pos_percent))) == offsetof(base_fac_bus, center_of_gravity_pos_percent) &&
+              SCHEMA_FIELD_END(base_fac_bus, center_of_gravity_pos_percent, alignof(decltype(base_fac_bus::sideslip_target_deg))) == offsetof(base_fac_bus, sideslip_target_deg) &&
+              SCHEMA_FIELD_END(base_fac_bus, sideslip_target_deg, alignof(decltype(base_fac_bus::fac_slat_angle_deg))) == offsetof(base_fac_bus, fac_slat_angle_deg) &&
+              SCHEMA_FIELD_END(base_fac_bus, fac_slat_angle_deg, alignof(decltype(base_fac_bus::fac_flap_angle_deg))) == offsetof(base_fac_bus, fac_flap_angle_deg) &&
+              SCHEMA_FIELD_END(base_fac_bus, fac_flap_angle_deg, alignof(decltype(base_fac_bus::discrete_word_2))) == offsetof(base_fac_bus, discrete_word_2) &&
+              SCHEMA_FIELD_END(base_fac_bus, discrete_word_2, alignof(decltype(base_fac_bus::rudder_travel_limit_command_deg))) == offsetof(base_fac_bus, rudder_travel_limit_command_deg) &&
+              SCHEMA_FIELD_END(base_fac_bus, rudder_travel_limit_command_deg, alignof(decltype(base_fac_bus::delta_r_yaw_damper_deg))) == offsetof(base_fac_bus, delta_r_yaw_damper_deg) &&
+              SCHEMA_FIELD_END(base_fac_bus, delta_r_yaw_damper_deg, alignof(decltype(base_fac_bus::estimated_sideslip_deg))) == offsetof(base_fac_bus, estimated_sideslip_deg) &&
+              SCHEMA_FIELD_END(base_fac_bus, estimated_sideslip_deg, alignof(decltype(base_fac_bus::v_alpha_lim_kn))) == offsetof(base_fac_bus, v_alpha_lim_kn) &&
+              SCHEMA_FIELD_END(base_fac_bus, v_alpha_lim_kn, alignof(decltype(base_fac_bus::v_ls_kn))) == offsetof(base_fac_bus, v_ls_kn) &&
+              SCHEMA_FIELD_END(base_fac_bus, v_ls_kn, alignof(decltype(base_fac_bus::v_stall_kn))) == offsetof(base_fac_bus, v_stall_kn) &&
+              SCHEMA_FIELD_END(base_fac_bus, v_stall_kn, alignof(decltype(base_fac_bus::v_alpha_prot_kn))) == offsetof(base_fac_bus, v_alpha_prot_kn) &&
+              SCHEMA_FIELD_END(base_fac_bus, v_alpha_prot_kn, alignof(decltype(base_fac_bus::v_stall_warn_kn))) == offsetof(base_fac_bus, v_stall_warn_kn) &&
+              SCHEMA_FIELD_END(base_fac_bus, v_stall_warn_kn, alignof(decltype(base_fac_bus::speed_trend_kn))) == offsetof(base_fac_bus, speed_trend_kn) &&
+              SCHEMA_FIELD_END(base_fac_bus, speed_trend_kn, alignof(decltype(base_fac_bus::v_3_kn))) == offsetof(base_fac_bus, v_3_kn) &&
+              SCHEMA_FIELD_END(base_fac_bus, v_3_kn, alignof(decltype(base_fac_bus::v_4_kn))) == offsetof(base_fac_bus, v_4_kn) &&
+              SCHEMA_FIELD_END(base_fac_bus, v_4_kn, alignof(decltype(base_fac_bus::v_man_kn))) == offsetof(base_fac_bus, v_man_kn) &&
+              SCHEMA_FIELD_END(base_fac_bus, v_man_kn, alignof(decltype(base_fac_bus::v_max_kn))) == offsetof(base_fac_bus, v_max_kn) &&
+              SCHEMA_FIELD_END(base_fac_bus, v_max_kn, alignof(decltype(base_fac_bus::v_fe_next_kn))) == offsetof(base_fac_bus, v_fe_next_kn) &&
+              SCHEMA_FIELD_END(base_fac_bus, v_fe_next_kn, alignof(decltype(base_fac_bus::discrete_word_3))) == offsetof(base_fac_bus, discrete_word_3) &&
+              SCHEMA_FIELD_END(base_fac_bus, discrete_word_3, alignof(decltype(base_fac_bus::discrete_word_4))) == offsetof(base_fac_bus, discrete_word_4) &&
+              SCHEMA_FIELD_END(base_fac_bus, discrete_word_4, alignof(decltype(base_fac_bus::discrete_word_5))) == offsetof(base_fac_bus, discrete_word_5) &&
+              SCHEMA_FIELD_END(base_fac_bus, discrete_word_5, alignof(decltype(base_fac_bus::delta_r_rudder_trim_deg))) == offsetof(base_fac_bus, delta_r_rudder_trim_deg) &&
+              SCHEMA_FIELD_END(base_fac_bus, delta_r_rudder_trim_deg, alignof(decltype(base_fac_bus::rudder_trim_pos_deg))) == offsetof(base_fac_bus, rudder_trim_pos_deg) &&
+              SCHEMA_FIELD_END(base_fac_bus, rudder_trim_pos_deg, alignof(base_fac_bus)) == sizeof(base_fac_bus),
+              "schema of base_fac_bus does not cover all of its members, regenerate the schema");
+
+constexpr SchemaField base_fac_discrete_outputs_fields[] = {
+    SCHEMA_FIELD(base_fac_discrete_outputs, fac_healthy),
+    SCHEMA_FIELD(base_fac_discrete_outputs, yaw_damper_engaged),
+    SCHEMA_FIELD(base_fac_discrete_outputs, rudder_trim_engaged),
+    SCHEMA_FIELD(base_fac_discrete_outputs, rudder_travel_lim_engaged),
+    SCHEMA_FIELD(base_fac_discrete_outputs, rudder_travel_lim_emergency_reset),
+    SCHEMA_FIELD(base_fac_discrete_outputs, yaw_damper_avail_for_norm_law),
+};
+
+static_assert(SCHEMA_FIELD_END(base_fac_discrete_outputs, fac_healthy, alignof(decltype(base_fac_discrete_outputs::yaw_damper_engaged))) == offsetof(base_fac_discrete_outputs, yaw_damper_engaged) &&
+              SCHEMA_FIELD_END(base_fac_discrete_outputs, yaw_damper_engaged, alignof(decltype(base_fac_discrete_outputs::rudder_trim_engaged))) == offsetof(base_fac_discrete_outputs, rudder_trim_engaged) &&
+              SCHEMA_FIELD_END(base_fac_discrete_outputs, rudder_trim_engaged, alignof(decltype(base_fac_discrete_outputs::rudder_travel_lim_engaged))) == offsetof(base_fac_discrete_outputs, rudder_travel_lim_engaged) &&
+              SCHEMA_FIELD_END(base_fac_discrete_outputs, rudder_travel_lim_engaged, alignof(decltype(base_fac_discrete_outputs::rudder_travel_lim_emergency_reset))) == offsetof(base_fac_discrete_outputs, rudder_travel_lim_emergency_reset) &&
+              SCHEMA_FIELD_END(base_fac_discrete_outputs, rudder_travel_lim_emergency_reset, alignof(decltype(base_fac_discrete_outputs::yaw_damper_avail_for_norm_law))) == offsetof(base_fac_discrete_outputs, yaw_damper_avail_for_norm_law) &&
+              SCHEMA_FIELD_END(base_fac_discrete_outputs, yaw_damper_avail_for_norm_law, alignof(base_fac_discrete_outputs)) == sizeof(base_fac_discrete_outputs),
+              "schema of base_fac_discrete_outputs does not cover all of its members, regenerate the schema");
+
+constexpr SchemaField base_fac_analog_outputs_fields[] = {
+    SCHEMA_FIELD(base_fac_analog_outputs, yaw_damper_order_deg),
+    SCHEMA_FIELD(base_fac_analog_outputs, rudder_trim_order_deg),
+    SCHEMA_FIELD(base_fac_analog_outputs, rudder_travel_limit_order_deg),
+};
+
+static_assert(SCHEMA_FIELD_END(base_fac_analog_outputs, yaw_damper_order_deg, alignof(decltype(base_fac_analog_outputs::rudder_trim_order_deg))) == offsetof(base_fac_analog_outputs, rudder_trim_order_deg) &&
+              SCHEMA_FIELD_END(base_fac_analog_outputs, rudder_trim_order_deg, alignof(decltype(base_fac_analog_outputs::rudder_travel_limit_order_deg))) == offsetof(base_fac_analog_outputs, rudder_travel_limit_order_deg) &&
+              SCHEMA_FIELD_END(base_fac_analog_outputs, rudder_travel_limit_order_deg, alignof(base_fac_analog_outputs)) == sizeof(base_fac_analog_outputs),
+              "schema of base_fac_analog_outputs does not cover all of its members, regenerate the schema");
+
+constexpr SchemaField base_adr_bus_fields[] = {
+    SCHEMA_FIELD(base_adr_bus, altitude_standard_ft),
+    SCHEMA_FIELD(base_adr_bus, altitude_corrected_ft),
+    SCHEMA_FIELD(base_adr_bus, mach),
+    SCHEMA_FIELD(base_adr_bus, airspeed_computed_kn),
+    SCHEMA_FIELD(base_adr_bus, airspeed_true_kn),
+    SCHEMA_FIELD(base_adr_bus, vertical_speed_ft_min),
+    SCHEMA_FIELD(base_adr_bus, aoa_corrected_deg),
+    SCHEMA_FIELD(base_adr_bus, corrected_average_static_pressure),
+};
+
+static_assert(SCHEMA_FIELD_END(base_adr_bus, altitude_standard_ft, alignof(decltype(base_adr_bus::altitude_corrected_ft))) == offsetof(base_adr_bus, altitude_corrected_ft) &&
+              SCHEMA_FIELD_END(base_adr_bus, altitude_corrected_ft, alignof(decltype(base_adr_bus::mach))) == offsetof(base_adr_bus, mach) &&
+              SCHEMA_FIELD_END(base_adr_bus, mach, alignof(decltype(base_adr_bus::airspeed_computed_kn))) == offsetof(base_adr_bus, airspeed_computed_kn) &&
+              SCHEMA_FIELD_END(base_adr_bus, airspeed_computed_kn, alignof(decltype(base_adr_bus::airspeed_true_kn))) == offsetof(base_adr_bus, airspeed_true_kn) &&
+              SCHEMA_FIELD_END(base_adr_bus, airspeed_true_kn, alignof(decltype(base_adr_bus::vertical_speed_ft_min))) == offsetof(base_adr_bus, vertical_speed_ft_min) &&
+              SCHEMA_FIELD_END(base_adr_bus, vertical_speed_ft_min, alignof(decltype(base_adr_bus::aoa_corrected_deg))) == offsetof(base_adr_bus, aoa_corrected_deg) &&
+              SCHEMA_FIELD_END(base_adr_bus, aoa_corrected_deg, alignof(decltype(base_adr_bus::corrected_average_static_pressure))) == offsetof(base_adr_bus, corrected_average_static_pressure) &&
+              SCHEMA_FIELD_END(base_adr_bus, corrected_average_static_pressure, alignof(base_adr_bus)) == sizeof(base_adr_bus),
+              "schema of base_adr_bus does not cover all of its members, regenerate the schema");
+
+constexpr SchemaField base_ir_bus_fields[] = {
+    SCHEMA_FIELD(base_ir_bus, discrete_word_1),
+    SCHEMA_FIELD(base_ir_bus, latitude_deg),
+    SCHEMA_FIELD(base_ir_bus, longitude_deg),
+    SCHEMA_FIELD(base_ir_bus, ground_speed_kn),
+    SCHEMA_FIELD(base_ir_bus, track_angle_true_deg),
+    SCHEMA_FIELD(base_ir_bus, heading_true_deg),
+    SCHEMA_FIELD(base_ir_bus, wind_speed_kn),
+    SCHEMA_FIELD(base_ir_bus, wind_direction_true_deg),
+    SCHEMA_FIELD(base_ir_bus, track_angle_magnetic_deg),
+    SCHEMA_FIELD(base_ir_bus, heading_magnetic_deg),
+    SCHEMA_FIELD(base_ir_bus, drift_angle_deg),
+    SCHEMA_FIELD(base_ir_bus, flight_path_angle_deg),
+    SCHEMA_FIELD(base_ir_bus, flight_path_accel_g),
+    SCHEMA_FIELD(base_ir_bus, pitch_angle_deg),
+    SCHEMA_FIELD(base_ir_bus, roll_angle_deg),
+    SCHEMA_FIELD(base_ir_bus, body_pitch_rate_deg_s),
+    SCHEMA_FIELD(base_ir_bus, body_roll_rate_deg_s),
+    SCHEMA_FIELD(base_ir_bus, body_yaw_rate_deg_s),
+    SCHEMA_FIELD(base_ir_bus, body_long_accel_g),
+    SCHEMA_FIELD(base_ir_bus, body_lat_accel_g),
+    SCHEMA_FIELD(base_ir_bus, body_normal_accel_g),
+    SCHEMA_FIELD(base_ir_bus, track_angle_rate_deg_s),
+    SCHEMA_FIELD(base_ir_bus, pitch_att_rate_deg_s),
+    SCHEMA_FIELD(base_ir_bus, roll_att_rate_deg_s),
+    SCHEMA_FIELD(base_ir_bus, inertial_alt_ft),
+    SCHEMA_FIELD(base_ir_bus, along_track_horiz_acc_g),
+    SCHEMA_FIELD(base_ir_bus, cross_track_horiz_acc_g),
+    SCHEMA_FIELD(base_ir_bus, vertical_accel_g),
+    SCHEMA_FIELD(base_ir_bus, inertial_vertical_speed_ft_s),
+    SCHEMA_FIELD(base_ir_bus, north_south_velocity_kn),
+    SCHEMA_FIELD(base_ir_bus, east_west_velocity_kn),
+};
+
+static_assert(SCHEMA_FIELD_END(base_ir_bus, discrete_word_1, alignof(decltype(base_ir_bus::latitude_deg))) == offsetof(base_ir_bus, latitude_deg) &&
+              SCHEMA_FIELD_END(base_ir_bus, latitude_deg, alignof(decltype(base_ir_bus::longitude_deg))) == offsetof(base_ir_bus, longitude_deg) &&
+              SCHEMA_FIELD_END(base_ir_bus, longitude_deg, alignof(decltype(base_ir_bus::ground_speed_kn))) == offsetof(base_ir_bus, ground_speed_kn) &&
+              SCHEMA_FIELD_END(base_ir_bus, ground_speed_kn, alignof(decltype(base_ir_bus::track_angle_true_deg))) == offsetof(base_ir_bus, track_angle_true_deg) &&
+              SCHEMA_FIELD_END(base_ir_bus, track_angle_true_deg, alignof(decltype(base_ir_bus::heading_true_deg))) == offsetof(base_ir_bus, heading_true_deg) &&
+              SCHEMA_FIELD_END(base_ir_bus, heading_true_deg, alignof(decltype(base_ir_bus::wind_speed_kn))) == offsetof(base_ir_bus, wind_speed_kn) &&
+              SCHEMA_FIELD_END(base_ir_bus, wind_speed_kn, alignof(decltype(base_ir_bus::wind_direction_true_deg))) == offsetof(base_ir_bus, wind_direction_true_deg) &&
+              SCHEMA_FIELD_END(base_ir_bus, wind_direction_true_deg, alignof(decltype(base_ir_bus::track_angle_magnetic_deg))) == offsetof(base_ir_bus, track_angle_magnetic_deg) &&
+              SCHEMA_FIELD_END(base_ir_bus, track_angle_magnetic_deg, alignof(decltype(base_ir_bus::heading_magnetic_deg))) == offsetof(base_ir_bus, heading_magnetic_deg) &&
+              SCHEMA_FIELD_END(base_ir_bus, heading_magnetic_deg, alignof(decltype(base_ir_bus::drift_angle_deg))) == offsetof(base_ir_bus, drift_angle_deg) &&
+              SCHEMA_FIELD_END(base_ir_bus, drift_angle_deg, alignof(decltype(base_ir_bus::flight_path_angle_deg))) == offsetof(base_ir_bus, flight_path_angle_deg) &&
+              SCHEMA_FIELD_END(base_ir_bus, flight_path_angle_deg, alignof(decltype(base_ir_bus::flight_path_accel_g))) == offsetof(base_ir_bus, flight_path_accel_g) &&
+              SCHEMA_FIELD_END(base_ir_bus, flight_path_accel_g, alignof(decltype(base_ir_bus::pitch_angle_deg))) == offsetof(base_ir_bus, pitch_angle_deg) &&
+              SCHEMA_FIELD_END(base_ir_bus, pitch_angle_deg, alignof(decltype(base_ir_bus::roll_angle_deg))) == offsetof(base_ir_bus, roll_angle_deg) &&
+              SCHEMA_FIELD_END(base_ir_bus, roll_angle_deg, alignof(decltype(base_ir_bus::body_pitch_rate_deg_s))) == offsetof(base_ir_bus, body_pitch_rate_deg_s) &&
+              SCHEMA_FIELD_END(base_ir_bus, body_pitch_rate_deg_s, alignof(decltype(base_ir_bus::body_roll_rate_deg_s))) == offsetof(base_ir_bus, body_roll_rate_deg_s) &&
+              SCHEMA_FIELD_END(base_ir_bus, body_roll_rate_deg_s, alignof(decltype(base_ir_bus::body_yaw_rate_deg_s))) == offsetof(base_ir_bus, body_yaw_rate_deg_s) &&
+              SCHEMA_FIELD_END(base_ir_bus, body_yaw_rate_deg_s, alignof(decltype(base_ir_bus::body_long_accel_g))) == offsetof(base_ir_bus, body_long_accel_g) &&
+              SCHEMA_FIELD_END(base_ir_bus, body_long_accel_g, alignof(decltype(base_ir_bus::body_lat_accel_g))) == offsetof(base_ir_bus, body_lat_accel_g) &&
+              SCHEMA_FIELD_END(base_ir_bus, body_lat_accel_g, alignof(decltype(base_ir_bus::body_normal_accel_g))) == offsetof(base_ir_bus, body_normal_accel_g) &&
+              SCHEMA_FIELD_END(base_ir_bus, body_normal_accel_g, alignof(decltype(base_ir_bus::track_angle_rate_deg_s))) == offsetof(base_ir_bus, track_angle_rate_deg_s) &&
+              SCHEMA_FIELD_END(base_ir_bus, track_angle_rate_deg_s, alignof(decltype(base_ir_bus::pitch_att_rate_deg_s))) == offsetof(base_ir_bus, pitch_att_rate_deg_s) &&
+              SCHEMA_FIELD_END(base_ir_bus, pitch_att_rate_deg_s, alignof(decltype(base_ir_bus::roll_att_rate_deg_s))) == offsetof(base_ir_bus, roll_att_rate_deg_s) &&
+              SCHEMA_FIELD_END(base_ir_bus, roll_att_rate_deg_s, alignof(decltype(base_ir_bus::inertial_alt_ft))) == offsetof(base_ir_bus, inertial_alt_ft) &&
+              SCHEMA_FIELD_END(base_ir_bus, inertial_alt_ft, alignof(decltype(base_ir_bus::along_track_horiz_acc_g))) == offsetof(base_ir_bus, along_track_horiz_acc_g) &&
+              SCHEMA_FIELD_END(base_ir_bus, along_track_horiz_acc_g, alignof(decltype(base_ir_bus::cross_track_horiz_acc_g))) == offsetof(base_ir_bus, cross_track_horiz_acc_g) &&
+              SCHEMA_FIELD_END(base_ir_bus, cross_track_horiz_acc_g, alignof(decltype(base_ir_bus::vertical_accel_g))) == offsetof(base_ir_bus, vertical_accel_g) &&
+              SCHEMA_FIELD_END(base_ir_bus, vertical_accel_g, alignof(decltype(base_ir_bus::inertial_vertical_speed_ft_s))) == offsetof(base_ir_bus, inertial_vertical_speed_ft_s) &&
+              SCHEMA_FIELD_END(base_ir_bus, inertial_vertical_speed_ft_s, alignof(decltype(base_ir_bus::north_south_velocity_kn))) == offsetof(base_ir_bus, north_south_velocity_kn) &&
+              SCHEMA_FIELD_END(base_ir_bus, north_south_velocity_kn, alignof(decltype(base_ir_bus::east_west_velocity_kn))) == offsetof(base_ir_bus, east_west_velocity_kn) &&
+              SCHEMA_FIELD_END(base_ir_bus, east_west_velocity_kn, alignof(base_ir_bus)) == sizeof(base_ir_bus),
+              "schema of base_ir_bus does not cover all of its members, regenerate the schema");
+
+constexpr SchemaField base_ra_bus_fields[] = {
+    SCHEMA_FIELD(base_ra_bus, radio_height_ft),
+};
+
+static_assert(SCHEMA_FIELD_END(base_ra_bus, radio_height_ft, alignof(base_ra_bus)) == sizeof(base_ra_bus),
+              "schema of base_ra_bus does not cover all of its members, regenerate the schema");
+
+constexpr SchemaField base_ils_bus_fields[] = {
+    SCHEMA_FIELD(base_ils_bus, runway_heading_deg),
+    SCHEMA_FIELD(base_ils_bus, ils_frequency_mhz),
+    SCHEMA_FIELD(base_ils_bus, localizer_deviation_deg),
+    SCHEMA_FIELD(base_ils_bus, glideslope_deviation_deg),
+};
+
+static_assert(SCHEMA_FIELD_END(base_ils_bus, runway_heading_deg, alignof(decltype(base_ils_bus::ils_frequency_mhz))) == offsetof(base_ils_bus, ils_frequency_mhz) &&
+              SCHEMA_FIELD_END(base_ils_bus, ils_frequency_mhz, alignof(decltype(base_ils_bus::localizer_deviation_deg))) == offsetof(base_ils_bus, localizer_deviation_deg) &&
+              SCHEMA_FIELD_END(base_ils_bus, localizer_deviation_deg, alignof(decltype(base_ils_bus::glideslope_deviation_deg))) == offsetof(base_ils_bus, glideslope_deviation_deg) &&
+              SCHEMA_FIELD_END(base_ils_bus, glideslope_deviation_deg, alignof(base_ils_bus)) == sizeof(base_ils_bus),
+              "schema of base_ils_bus does not cover all of its members, regenerate the schema");
+
+constexpr SchemaField base_fmgc_logic_outputs_fields[] = {
+    SCHEMA_FIELD(base_fmgc_logic_outputs, on_ground),
+    SCHEMA_FIELD(base_fmgc_logic_outputs, gnd_eng_stop_flt_5s),
+    SCHEMA_FIELD(base_fmgc_logic_outputs, one_engine_out),
+    SCHEMA_FIELD(base_fmgc_logic_outputs, engine_running),
+    SCHEMA_FIELD(base_fmgc_logic_outputs, ap_fd_athr_common_condition),
+    SCHEMA_FIELD(base_fmgc_logic_outputs, ap_fd_common_condition),
+    SCHEMA_FIELD(base_fmgc_logic_outputs, fd_own_engaged),
+    SCHEMA_FIELD(base_fmgc_logic_outputs, ap_own_engaged),
+    SCHEMA_FIELD(base_fmgc_logic_outputs, athr_own_engaged),
+    SCHEMA_FIELD(base_fmgc_logic_outputs, ap_inop),
+    SCHEMA_FIELD(base_fmgc_logic_outputs, athr_inop),
+    SCHEMA_FIELD(base_fmgc_logic_outputs, fmgc_opp_priority),
+    SCHEMA_FIELD(base_fmgc_logic_outputs, double_adr_failure),
+    SCHEMA_FIELD(base_fmgc_logic_outputs, double_ir_failure),
+    SCHEMA_FIELD(base_fmgc_logic_outputs, all_adr_valid),
+    SCHEMA_FIELD(base_fmgc_logic_outputs, all_ir_valid),
+    SCHEMA_FIELD(base_fmgc_logic_outputs, adr_computation_data),
+    SCHEMA_FIELD(base_fmgc_logic_outputs, ir_computation_data),
+    SCHEMA_FIELD(base_fmgc_logic_outputs, ra_computation_data),
+    SCHEMA_FIELD(base_fmgc_logic_outputs, dual_ra_failure),
+    SCHEMA_FIELD(base_fmgc_logic_outputs, both_ra_valid),
+    SCHEMA_FIELD(base_fmgc_logic_outputs, fac_lg_data_failure),
+    SCHEMA_FIELD(base_fmgc_logic_outputs, fac_flap_slat_data_failure),
+    SCHEMA_FIELD(base_fmgc_logic_outputs, flap_slat_lever_position),
+    SCHEMA_FIELD(base_fmgc_logic_outputs, fac_speeds_failure),
+    SCHEMA_FIELD(base_fmgc_logic_outputs, fac_weights_failure),
+    SCHEMA_FIELD(base_fmgc_logic_outputs, fac_rudder_control_failure),
+    SCHEMA_FIELD(base_fmgc_logic_outputs, both_fac_rudder_valid),
+    SCHEMA_FIELD(base_fmgc_logic_outputs, chosen_fac_bus),
+    SCHEMA_FIELD(base_fmgc_logic_outputs, fcu_failure),
+    SCHEMA_FIELD(base_fmgc_logic_outputs, ils_failure),
+    SCHEMA_FIELD(base_fmgc_logic_outputs, both_ils_valid),
+    SCHEMA_FIELD(base_fmgc_logic_outputs, ils_computation_data),
+    SCHEMA_FIELD(base_fmgc_logic_outputs, ils_tune_inhibit),
+    SCHEMA_FIELD(base_fmgc_logic_outputs, rwy_hdg_memo),
+    SCHEMA_FIELD(base_fmgc_logic_outputs, tcas_failure),
+    SCHEMA_FIELD(base_fmgc_logic_outputs, tcas_mode_available),
+};
+
+static_assert(SCHEMA_FIELD_END(base_fmgc_logic_outputs, on_ground, alignof(decltype(base_fmgc_logic_outputs::gnd_eng_stop_flt_5s))) == offsetof(base_fmgc_logic_outputs, gnd_eng_stop_flt_5s) &&
+              SCHEMA_FIELD_END(base_fmgc_logic_outputs, gnd_eng_stop_flt_5s, alignof(decltype(base_fmgc_logic_outputs::one_engine_out))) == offsetof(base_fmgc_logic_outputs, one_engine_out) &&
+              SCHEMA_FIELD_END(base_fmgc_logic_outputs, one_engine_out, alignof(decltype(base_fmgc_logic_outputs::engine_running))) == offsetof(base_fmgc_logic_outputs, engine_running) &&
+              SCHEMA_FIELD_END(base_fmgc_logic_outputs, engine_running, alignof(decltype(base_fmgc_logic_outputs::ap_fd_athr_common_condition))) == offsetof(base_fmgc_logic_outputs, ap_fd_athr_common_condition) &&
+              SCHEMA_FIELD_END(base_fmgc_logic_outputs, ap_fd_athr_common_condition, alignof(decltype(base_fmgc_logic_outputs::ap_fd_common_condition))) == offsetof(base_fmgc_logic_outputs, ap_fd_common_condition) &&
+              SCHEMA_FIELD_END(base_fmgc_logic_outputs, ap_fd_common_condition, alignof(decltype(base_fmgc_logic_outputs::fd_own_engaged))) == offsetof(base_fmgc_logic_outputs, fd_own_engaged) &&
+              SCHEMA_FIELD_END(base_fmgc_logic_outputs, fd_own_engaged, alignof(decltype(base_fmgc_logic_outputs::ap_own_engaged))) == offsetof(base_fmgc_logic_outputs, ap_own_engaged) &&
+              SCHEMA_FIELD_END(base_fmgc_logic_outputs, ap_own_engaged, alignof(decltype(base_fmgc_logic_outputs::athr_own_engaged))) == offsetof(base_fmgc_logic_outputs, athr_own_engaged) &&
+              SCHEMA_FIELD_END(base_fmgc_logic_outputs, athr_own_engaged, alignof(decltype(base_fmgc_logic_outputs::ap_inop))) == offsetof(base_fmgc_logic_outputs, ap_inop) &&
+              SCHEMA_FIELD_END(base_fmgc_logic_outputs, ap_inop, alignof(decltype(base_fmgc_logic_outputs::athr_inop))) == offsetof(base_fmgc_logic_outputs, athr_inop) &&
+              SCHEMA_FIELD_END(base_fmgc_logic_outputs, athr_inop, alignof(decltype(base_fmgc_logic_outputs::fmgc_opp_priority))) == offsetof(base_fmgc_logic_outputs, fmgc_opp_priority) &&
+              SCHEMA_FIELD_END(base_fmgc_logic_outputs, fmgc_opp_priority, alignof(decltype(base_fmgc_logic_outputs::double_adr_failure))) == offsetof(base_fmgc_logic_outputs, double_adr_failure) &&
+              SCHEMA_FIELD_END(base_fmgc_logic_outputs, double_adr_failure, alignof(decltype(base_fmgc_logic_outputs::double_ir_failure))) == offsetof(base_fmgc_logic_outputs, double_ir_failure) &&
+              SCHEMA_FIELD_END(base_fmgc_logic_outputs, double_ir_failure, alignof(decltype(base_fmgc_logic_outputs::all_adr_valid))) == offsetof(base_fmgc_logic_outputs, all_adr_valid) &&
+              SCHEMA_FIELD_END(base_fmgc_logic_outputs, all_adr_valid, alignof(decltype(base_fmgc_logic_outputs::all_ir_valid))) == offsetof(base_fmgc_logic_outputs, all_ir_valid) &&
+              SCHEMA_FIELD_END(base_fmgc_logic_outputs, all_ir_valid, alignof(decltype(base_fmgc_logic_outputs::adr_computation_data))) == offsetof(base_fmgc_logic_outputs, adr_computation_data) &&
+              SCHEMA_FIELD_END(base_fmgc_logic_outputs, adr_computation_data, alignof(decltype(base_fmgc_logic_outputs::ir_computation_data))) == offsetof(base_fmgc_logic_outputs, ir_computation_data) &&
+              SCHEMA_FIELD_END(base_fmgc_logic_outputs, ir_computation_data, alignof(decltype(base_fmgc_logic_outputs::ra_computation_data))) == offsetof(base_fmgc_logic_outputs, ra_computation_data) &&
+              SCHEMA_FIELD_END(base_fmgc_logic_outputs, ra_computation_data, alignof(decltype(base_fmgc_logic_outputs::dual_ra_failure))) == offsetof(base_fmgc_logic_outputs, dual_ra_failure) &&
+              SCHEMA_FIELD_END(base_fmgc_logic_outputs, dual_ra_failure, alignof(decltype(base_fmgc_logic_outputs::both_ra_valid))) == offsetof(base_fmgc_logic_outputs, both_ra_valid) &&
+              SCHEMA_FIELD_END(base_fmgc_logic_outputs, both_ra_valid, alignof(decltype(base_fmgc_logic_outputs::fac_lg_data_failure))) == offsetof(base_fmgc_logic_outputs, fac_lg_data_failure) &&
+              SCHEMA_FIELD_END(base_fmgc_logic_outputs, fac_lg_data_failure, alignof(decltype(base_fmgc_logic_outputs::fac_flap_slat_data_failure))) == offsetof(base_fmgc_logic_outputs, fac_flap_slat_data_failure) &&
+              SCHEMA_FIELD_END(base_fmgc_logic_outputs, fac_flap_slat_data_failure, alignof(decltype(base_fmgc_logic_outputs::flap_slat_lever_position))) == offsetof(base_fmgc_logic_outputs, flap_slat_lever_position) &&
+              SCHEMA_FIELD_END(base_fmgc_logic_outputs, flap_slat_lever_position, alignof(decltype(base_fmgc_logic_outputs::fac_speeds_failure))) == offsetof(base_fmgc_logic_outputs, fac_speeds_failure) &&
+              SCHEMA_FIELD_END(base_fmgc_logic_outputs, fac_speeds_failure, alignof(decltype(base_fmgc_logic_outputs::fac_weights_failure))) == offsetof(base_fmgc_logic_outputs, fac_weights_failure) &&
+              SCHEMA_FIELD_END(base_fmgc_logic_outputs, fac_weights_failure, alignof(decltype(base_fmgc_logic_outputs::fac_rudder_control_failure))) == offsetof(base_fmgc_logic_outputs, fac_rudder_control_failure) &&
+              SCHEMA_FIELD_END(base_fmgc_logic_outputs, fac_rudder_control_failure, alignof(decltype(base_fmgc_logic_outputs::both_fac_rudder_valid))) == offsetof(base_fmgc_logic_outputs, both_fac_rudder_valid) &&
+              SCHEMA_FIELD_END(base_fmgc_logic_outputs, both_fac_rudder_valid, alignof(decltype(base_fmgc_logic_outputs::chosen_fac_bus))) == offsetof(base_fmgc_logic_outputs, chosen_fac_bus) &&
+              SCHEMA_FIELD_END(base_fmgc_logic_outputs, chosen_fac_bus, alignof(decltype(base_fmgc_logic_outputs::fcu_failure))) == offsetof(base_fmgc_logic_outputs, fcu_failure) &&
+              SCHEMA_FIELD_END(base_fmgc_logic_outputs, fcu_failure, alignof(decltype(base_fmgc_logic_outputs::ils_failure))) == offsetof(base_fmgc_logic_outputs, ils_failure) &&
+              SCHEMA_FIELD_END(base_fmgc_logic_outputs, ils_failure, alignof(decltype(base_fmgc_logic_outputs::both_ils_valid))) == offsetof(base_fmgc_logic_outputs, both_ils_valid) &&
+              SCHEMA_FIELD_END(base_fmgc_logic_outputs, both_ils_valid, alignof(decltype(base_fmgc_logic_outputs::ils_computation_data))) == offsetof(base_fmgc_logic_outputs, ils_computation_data) &&
+              SCHEMA_FIELD_END(base_fmgc_logic_outputs, ils_computation_data, alignof(decltype(base_fmgc_logic_outputs::ils_tune_inhibit))) == offsetof(base_fmgc_logic_outputs, ils_tune_inhibit) &&
+              SCHEMA_FIELD_END(base_fmgc_logic_outputs, ils_tune_inhibit, alignof(decltype(base_fmgc_logic_outputs::rwy_hdg_memo))) == offsetof(base_fmgc_logic_outputs, rwy_hdg_memo) &&
+              SCHEMA_FIELD_END(base_fmgc_logic_outputs, rwy_hdg_memo, alignof(decltype(base_fmgc_logic_outputs::tcas_failure))) == offsetof(base_fmgc_logic_outputs, tcas_failure) &&
+              SCHEMA_FIELD_END(base_fmgc_logic_outputs, tcas_failure, alignof(decltype(base_fmgc_logic_outputs::tcas_mode_available))) == offsetof(base_fmgc_logic_outputs, tcas_mode_available) &&
+              SCHEMA_FIELD_END(base_fmgc_logic_outputs, tcas_mode_available, alignof(base_fmgc_logic_outputs)) == sizeof(base_fmgc_logic_outputs),
+              "schema of base_fmgc_logic_outputs does not cover all of its members, regenerate the schema");
+
+constexpr SchemaField base_fmgc_lateral_modes_fields[] = {
+    SCHEMA_FIELD(base_fmgc_lateral_modes, rwy_active),
+    SCHEMA_FIELD(base_fmgc_lateral_modes, nav_active),
+    SCHEMA_FIELD(base_fmgc_lateral_modes, loc_cpt_active),
+    SCHEMA_FIELD(base_fmgc_lateral_modes, loc_trk_active),
+    SCHEMA_FIELD(base_fmgc_lateral_modes, roll_goaround_active),
+    SCHEMA_FIELD(base_fmgc_lateral_modes, hdg_active),
+    SCHEMA_FIELD(base_fmgc_lateral_modes, trk_active),
+    SCHEMA_FIELD(base_fmgc_lateral_modes, rwy_loc_submode_active),
+    SCHEMA_FIELD(base_fmgc_lateral_modes, rwy_trk_submode_active),
+    SCHEMA_FIELD(base_fmgc_lateral_modes, land_active),
+    SCHEMA_FIELD(base_fmgc_lateral_modes, align_submode_active),
+    SCHEMA_FIELD(base_fmgc_lateral_modes, rollout_submode_active),
+};
+
+static_assert(SCHEMA_FIELD_END(base_fmgc_lateral_modes, rwy_active, alignof(decltype(base_fmgc_lateral_modes::nav_active))) == offsetof(base_fmgc_lateral_modes, nav_active) &&
+              SCHEMA_FIELD_END(base_fmgc_lateral_modes, nav_active, alignof(decltype(base_fmgc_lateral_modes::loc_cpt_active))) == offsetof(base_fmgc_lateral_modes, loc_cpt_active) &&
+              SCHEMA_FIELD_END(base_fmgc_lateral_modes, loc_cpt_active, alignof(decltype(base_fmgc_lateral_modes::loc_trk_active))) == offsetof(base_fmgc_lateral_modes, loc_trk_active) &&
+              SCHEMA_FIELD_END(base_fmgc_lateral_modes, loc_trk_active, alignof(decltype(base_fmgc_lateral_modes::roll_goaround_active))) == offsetof(base_fmgc_lateral_modes, roll_goaround_active) &&
+              SCHEMA_FIELD_END(base_fmgc_lateral_modes, roll_goaround_active, alignof(decltype(base_fmgc_lateral_modes::hdg_active))) == offsetof(base_fmgc_lateral_modes, hdg_active) &&
+              SCHEMA_FIELD_END(base_fmgc_lateral_modes, hdg_active, alignof(decltype(base_fmgc_lateral_modes::trk_active))) == offsetof(base_fmgc_lateral_modes, trk_active) &&
+              SCHEMA_FIELD_END(base_fmgc_lateral_modes, trk_active, alignof(decltype(base_fmgc_lateral_modes::rwy_loc_submode_active))) == offsetof(base_fmgc_lateral_modes, rwy_loc_submode_active) &&
+              SCHEMA_FIELD_END(base_fmgc_lateral_modes, rwy_loc_submode_active, alignof(decltype(base_fmgc_lateral_modes::rwy_trk_submode_active))) == offsetof(base_fmgc_lateral_modes, rwy_trk_submode_active) &&
+              SCHEMA_FIELD_END(base_fmgc_lateral_modes, rwy_trk_submode_active, alignof(decltype(base_fmgc_lateral_modes::land_active))) == offsetof(base_fmgc_lateral_modes, land_active) &&
+              SCHEMA_FIELD_END(base_fmgc_lateral_modes, land_active, alignof(decltype(base_fmgc_lateral_modes::align_submode_active))) == offsetof(base_fmgc_lateral_modes, align_submode_active) &&
+              SCHEMA_FIELD_END(base_fmgc_lateral_modes, align_submode_active, alignof(decltype(base_fmgc_lateral_modes::rollout_submode_active))) == offsetof(base_fmgc_lateral_modes, rollout_submode_active) &&
+              SCHEMA_FIELD_END(base_fmgc_lateral_modes, rollout_submode_active, alignof(base_fmgc_lateral_modes)) == sizeof(base_fmgc_lateral_modes),
+              "schema of base_fmgc_lateral_modes does not cover all of its members, regenerate the schema");
+
+constexpr SchemaField base_fmgc_longitudinal_modes_fields[] = {
+    SCHEMA_FIELD(base_fmgc_longitudinal_modes, clb_active),
+    SCHEMA_FIELD(base_fmgc_longitudinal_modes, des_active),
+    SCHEMA_FIELD(base_fmgc_longitudinal_modes, op_clb_active),
+    SCHEMA_FIELD(base_fmgc_longitudinal_modes, op_des_active),
+    SCHEMA_FIELD(base_fmgc_longitudinal_modes, exp_clb_active),
+    SCHEMA_FIELD(base_fmgc_longitudinal_modes, exp_des_active),
+    SCHEMA_FIELD(base_fmgc_longitudinal_modes, pitch_takeoff_active),
+    SCHEMA_FIELD(base_fmgc_longitudinal_modes, pitch_goaround_active),
+    SCHEMA_FIELD(base_fmgc_longitudinal_modes, vs_active),
+    SCHEMA_FIELD(base_fmgc_longitudinal_modes, fpa_active),
+    SCHEMA_FIELD(base_fmgc_longitudinal_modes, alt_acq_active),
+    SCHEMA_FIELD(base_fmgc_longitudinal_modes, alt_hold_active),
+    SCHEMA_FIELD(base_fmgc_longitudinal_modes, fma_dash_display),
+    SCHEMA_FIELD(base_fmgc_longitudinal_modes, gs_capt_active),
+    SCHEMA_FIELD(base_fmgc_longitudinal_modes, gs_trk_active),
+    SCHEMA_FIELD(base_fmgc_longitudinal_modes, final_des_active),
+    SCHEMA_FIELD(base_fmgc_longitudinal_modes, flare_active),
+    SCHEMA_FIELD(base_fmgc_longitudinal_modes, cruise_active),
+    SCHEMA_FIELD(base_fmgc_longitudinal_modes, tcas_active),
+};
+
+static_assert(SCHEMA_FIELD_END(base_fmgc_longitudinal_modes, clb_active, alignof(decltype(base_fmgc_longitudinal_modes::des_active))) == offsetof(base_fmgc_longitudinal_modes, des_active) &&
+              SCHEMA_FIELD_END(base_fmgc_longitudinal_modes, des_active, alignof(decltype(base_fmgc_longitudinal_modes::op_clb_active))) == offsetof(base_fmgc_longitudinal_modes, op_clb_active) &&
+              SCHEMA_FIELD_END(base_fmgc_longitudinal_modes, op_clb_active, alignof(decltype(base_fmgc_longitudinal_modes::op_des_active))) == offsetof(base_fmgc_longitudinal_modes, op_des_active) &&
+              SCHEMA_FIELD_END(base_fmgc_longitudinal_modes, op_des_active, alignof(decltype(base_fmgc_longitudinal_modes::exp_clb_active))) == offsetof(base_fmgc_longitudinal_modes, exp_clb_active) &&
+              SCHEMA_FIELD_END(base_fmgc_longitudinal_modes, exp_clb_active, alignof(decltype(base_fmgc_longitudinal_modes::exp_des_active))) == offsetof(base_fmgc_longitudinal_modes, exp_des_active) &&
+              SCHEMA_FIELD_END(base_fmgc_longitudinal_modes, exp_des_active, alignof(decltype(base_fmgc_longitudinal_modes::pitch_takeoff_active))) == offsetof(base_fmgc_longitudinal_modes, pitch_takeoff_active) &&
+              SCHEMA_FIELD_END(base_fmgc_longitudinal_modes, pitch_takeoff_active, alignof(decltype(base_fmgc_longitudinal_modes::pitch_goaround_active))) == offsetof(base_fmgc_longitudinal_modes, pitch_goaround_active) &&
+              SCHEMA_FIELD_END(base_fmgc_longitudinal_modes, pitch_goaround_active, alignof(decltype(base_fmgc_longitudinal_modes::vs_active))) == offsetof(base_fmgc_longitudinal_modes, vs_active) &&
+              SCHEMA_FIELD_END(base_fmgc_longitudinal_modes, vs_active, alignof(decltype(base_fmgc_longitudinal_modes::fpa_active))) == offsetof(base_fmgc_longitudinal_modes, fpa_active) &&
+              SCHEMA_FIELD_END(base_fmgc_longitudinal_modes, fpa_active, alignof(decltype(base_fmgc_longitudinal_modes::alt_acq_active))) == offsetof(base_fmgc_longitudinal_modes, alt_acq_active) &&
+              SCHEMA_FIELD_END(base_fmgc_longitudinal_modes, alt_acq_active, alignof(decltype(base_fmgc_longitudinal_modes::alt_hold_active))) == offsetof(base_fmgc_longitudinal_modes, alt_hold_active) &&
+              SCHEMA_FIELD_END(base_fmgc_longitudinal_modes, alt_hold_active, alignof(decltype(base_fmgc_longitudinal_modes::fma_dash_display))) == offsetof(base_fmgc_longitudinal_modes, fma_dash_display) &&
+              SCHEMA_FIELD_END(base_fmgc_longitudinal_modes, fma_dash_display, alignof(decltype(base_fmgc_longitudinal_modes::gs_capt_active))) == offsetof(base_fmgc_longitudinal_modes, gs_capt_active) &&
+              SCHEMA_FIELD_END(base_fmgc_longitudinal_modes, gs_capt_active, alignof(decltype(base_fmgc_longitudinal_modes::gs_trk_active))) == offsetof(base_fmgc_longitudinal_modes, gs_trk_active) &&
+              SCHEMA_FIELD_END(base_fmgc_longitudinal_modes, gs_trk_active, alignof(decltype(base_fmgc_longitudinal_modes::final_des_active))) == offsetof(base_fmgc_longitudinal_modes, final_des_active) &&
+              SCHEMA_FIELD_END(base_fmgc_longitudinal_modes, final_des_active, alignof(decltype(base_fmgc_longitudinal_modes::flare_active))) == offsetof(base_fmgc_longitudinal_modes, flare_active) &&
+              SCHEMA_FIELD_END(base_fmgc_longitudinal_modes, flare_active, alignof(decltype(base_fmgc_longitudinal_modes::cruise_active))) == offsetof(base_fmgc_longitudinal_modes, cruise_active) &&
+              SCHEMA_FIELD_END(base_fmgc_longitudinal_modes, cruise_active, alignof(decltype(base_fmgc_longitudinal_modes::tcas_active))) == offsetof(base_fmgc_longitudinal_modes, tcas_active) &&
+              SCHEMA_FIELD_END(base_fmgc_longitudinal_modes, tcas_active, alignof(base_fmgc_longitudinal_modes)) == sizeof(base_fmgc_longitudinal_modes),
+              "schema of base_fmgc_longitudinal_modes does not cover all of its members, regenerate the schema");
+
+constexpr SchemaField base_fmgc_armed_modes_fields[] = {
+    SCHEMA_FIELD(base_fmgc_armed_modes, alt_acq_armed),
+    SCHEMA_FIELD(base_fmgc_armed_modes, alt_acq_arm_possible),
+    SCHEMA_FIELD(base_fmgc_armed_modes, nav_armed),
+    SCHEMA_FIELD(base_fmgc_armed_modes, loc_armed),
+    SCHEMA_FIELD(base_fmgc_armed_modes, land_armed),
+    SCHEMA_FIELD(base_fmgc_armed_modes, glide_armed),
+    SCHEMA_FIELD(base_fmgc_armed_modes, final_des_armed),
+    SCHEMA_FIELD(base_fmgc_armed_modes, clb_armed),
+    SCHEMA_FIELD(base_fmgc_armed_modes, des_armed),
+    SCHEMA_FIELD(base_fmgc_armed_modes, tcas_armed),
+};
+
+static_assert(SCHEMA_FIELD_END(base_fmgc_armed_modes, alt_acq_armed, alignof(decltype(base_fmgc_armed_modes::alt_acq_arm_possible))) == offsetof(base_fmgc_armed_modes, alt_acq_arm_possible) &&
+              SCHEMA_FIELD_END(base_fmgc_armed_modes, alt_acq_arm_possible, alignof(decltype(base_fmgc_armed_modes::nav_armed))) == offsetof(base_fmgc_armed_modes, nav_armed) &&
+              SCHEMA_FIELD_END(base_fmgc_armed_modes, nav_armed, alignof(decltype(base_fmgc_armed_modes::loc_armed))) == offsetof(base_fmgc_armed_modes, loc_armed) &&
+              SCHEMA_FIELD_END(base_fmgc_armed_modes, loc_armed, alignof(decltype(base_fmgc_armed_modes::land_armed))) == offsetof(base_fmgc_armed_modes, land_armed) &&
+              SCHEMA_FIELD_END(base_fmgc_armed_modes, land_armed, alignof(decltype(base_fmgc_armed_modes::glide_armed))) == offsetof(base_fmgc_armed_modes, glide_armed) &&
+              SCHEMA_FIELD_END(base_fmgc_armed_modes, glide_armed, alignof(decltype(base_fmgc_armed_modes::final_des_armed))) == offsetof(base_fmgc_armed_modes, final_des_armed) &&
+              SCHEMA_FIELD_END(base_fmgc_armed_modes, final_des_armed, alignof(decltype(base_fmgc_armed_modes::clb_armed))) == offsetof(base_fmgc_armed_modes, clb_armed) &&
+              SCHEMA_FIELD_END(base_fmgc_armed_modes, clb_armed, alignof(decltype(base_fmgc_armed_modes::des_armed))) == offsetof(base_fmgc_armed_modes, des_armed) &&
+              SCHEMA_FIELD_END(base_fmgc_armed_modes, des_armed, alignof(decltype(base_fmgc_armed_modes::tcas_armed))) == offsetof(base_fmgc_armed_modes, tcas_armed) &&
+              SCHEMA_FIELD_END(base_fmgc_armed_modes, tcas_armed, alignof(base_fmgc_armed_modes)) == sizeof(base_fmgc_armed_modes),
+              "schema of base_fmgc_armed_modes does not cover all of its members, regenerate the schema");
+
+constexpr SchemaField base_fmgc_ap_fd_logic_outputs_fields[] = {
+    SCHEMA_FIELD(base_fmgc_ap_fd_logic_outputs, lateral_modes),
+    SCHEMA_FIELD(base_fmgc_ap_fd_logic_outputs, longitudinal_modes),
+    SCHEMA_FIELD(base_fmgc_ap_fd_logic_outputs, armed_modes),
+    SCHEMA_FIELD(base_fmgc_ap_fd_logic_outputs, active_lateral_law),
+    SCHEMA_FIELD(base_fmgc_ap_fd_logic_outputs, active_longitudinal_law),
+    SCHEMA_FIELD(base_fmgc_ap_fd_logic_outputs, auto_spd_control_active),
+    SCHEMA_FIELD(base_fmgc_ap_fd_logic_outputs, manual_spd_control_active),
+    SCHEMA_FIELD(base_fmgc_ap_fd_logic_outputs, mach_control_active),
+    SCHEMA_FIELD(base_fmgc_ap_fd_logic_outputs, spd_target_kts),
+    SCHEMA_FIELD(base_fmgc_ap_fd_logic_outputs, pfd_spd_target_kts),
+    SCHEMA_FIELD(base_fmgc_ap_fd_logic_outputs, alt_cstr_applicable),
+    SCHEMA_FIELD(base_fmgc_ap_fd_logic_outputs, alt_sel_or_cstr),
+    SCHEMA_FIELD(base_fmgc_ap_fd_logic_outputs, fmgc_opp_mode_sync),
+    SCHEMA_FIELD(base_fmgc_ap_fd_logic_outputs, any_ap_fd_engaged),
+    SCHEMA_FIELD(base_fmgc_ap_fd_logic_outputs, any_lateral_mode_engaged),
+    SCHEMA_FIELD(base_fmgc_ap_fd_logic_outputs, any_longitudinal_mode_engaged),
+    SCHEMA_FIELD(base_fmgc_ap_fd_logic_outputs, lateral_mode_reset),
+    SCHEMA_FIELD(base_fmgc_ap_fd_logic_outputs, longitudinal_mode_reset),
+    SCHEMA_FIELD(base_fmgc_ap_fd_logic_outputs, hdg_trk_preset_available),
+    SCHEMA_FIELD(base_fmgc_ap_fd_logic_outputs, alt_soft_mode_active),
+    SCHEMA_FIELD(base_fmgc_ap_fd_logic_outputs, fd_auto_disengage),
+    SCHEMA_FIELD(base_fmgc_ap_fd_logic_outputs, ap_fd_mode_reversion),
+    SCHEMA_FIELD(base_fmgc_ap_fd_logic_outputs, lateral_mode_reversion),
+    SCHEMA_FIELD(base_fmgc_ap_fd_logic_outputs, longitudinal_mode_reversion_vs),
+    SCHEMA_FIELD(base_fmgc_ap_fd_logic_outputs, longitudinal_mode_reversion_op_clb),
+    SCHEMA_FIELD(base_fmgc_ap_fd_logic_outputs, pitch_fd_bars_flashing),
+    SCHEMA_FIELD(base_fmgc_ap_fd_logic_outputs, roll_fd_bars_flashing),
+    SCHEMA_FIELD(base_fmgc_ap_fd_logic_outputs, loc_bc_selection),
+    SCHEMA_FIELD(base_fmgc_ap_fd_logic_outputs, vs_target_not_held),
+    SCHEMA_FIELD(base_fmgc_ap_fd_logic_outputs, tcas_vs_target),
+    SCHEMA_FIELD(base_fmgc_ap_fd_logic_outputs, tcas_ra_corrective),
+    SCHEMA_FIELD(base_fmgc_ap_fd_logic_outputs, active_tcas_submode),
+    SCHEMA_FIELD(base_fmgc_ap_fd_logic_outputs, tcas_alt_acq_cond),
+    SCHEMA_FIELD(base_fmgc_ap_fd_logic_outputs, tcas_alt_hold_cond),
+    SCHEMA_FIELD(base_fmgc_ap_fd_logic_outputs, tcas_ra_inhibited),
+    SCHEMA_FIELD(base_fmgc_ap_fd_logic_outputs, trk_fpa_deselected),
+    SCHEMA_FIELD(base_fmgc_ap_fd_logic_outputs, longi_large_box_tcas),
+    SCHEMA_FIELD(base_fmgc_ap_fd_logic_outputs, land_2_capability),
+    SCHEMA_FIELD(base_fmgc_ap_fd_logic_outputs, land_3_fail_passive_capability),
+    SCHEMA_FIELD(base_fmgc_ap_fd_logic_outputs, land_3_fail_op_capability),
+    SCHEMA_FIELD(base_fmgc_ap_fd_logic_outputs, land_2_inop),
+    SCHEMA_FIELD(base_fmgc_ap_fd_logic_outputs, land_3_fail_passive_inop),
+    SCHEMA_FIELD(base_fmgc_ap_fd_logic_outputs, land_3_fail_op_inop),
+    SCHEMA_FIELD(base_fmgc_ap_fd_logic_outputs, land_2_capacity),
+    SCHEMA_FIELD(base_fmgc_ap_fd_logic_outputs, land_3_fail_passive_capacity),
+    SCHEMA_FIELD(base_fmgc_ap_fd_logic_outputs, land_3_fail_op_capacity),
+};
+
+static_assert(SCHEMA_FIELD_END(base_fmgc_ap_fd_logic_outputs, lateral_modes, alignof(decltype(base_fmgc_ap_fd_logic_outputs::longitudinal_modes))) == offsetof(base_fmgc_ap_fd_logic_outputs, longitudinal_modes) &&
+              SCHEMA_FIELD_END(base_fmgc_ap_fd_logic_outputs, longitudinal_modes, alignof(decltype(base_fmgc_ap_fd_logic_outputs::armed_modes))) == offsetof(base_fmgc_ap_fd_logic_outputs, armed_modes) &&
+              SCHEMA_FIELD_END(base_fmgc_ap_fd_logic_outputs, armed_modes, alignof(decltype(base_fmgc_ap_fd_logic_outputs::active_lateral_law))) == offsetof(base_fmgc_ap_fd_logic_outputs, active_lateral_law) &&
+              SCHEMA_FIELD_END(base_fmgc_ap_fd_logic_outputs, active_lateral_law, alignof(decltype(base_fmgc_ap_fd_logic_outputs::active_longitudinal_law))) == offsetof(base_fmgc_ap_fd_logic_outputs, active_longitudinal_law) &&
+              SCHEMA_FIELD_END(base_fmgc_ap_fd_logic_outputs, active_longitudinal_law, alignof(decltype(base_fmgc_ap_fd_logic_outputs::auto_spd_control_active))) == offsetof(base_fmgc_ap_fd_logic_outputs, auto_spd_control_active) &&
+              SCHEMA_FIELD_END(base_fmgc_ap_fd_logic_outputs, auto_spd_control_active, alignof(decltype(base_fmgc_ap_fd_logic_outputs::manual_spd_control_active))) == offsetof(base_fmgc_ap_fd_logic_outputs, manual_spd_control_active) &&
+              SCHEMA_FIELD_END(base_fmgc_ap_fd_logic_outputs, manual_spd_control_active, alignof(decltype(base_fmgc_ap_fd_logic_outputs::mach_control_active))) == offsetof(base_fmgc_ap_fd_logic_outputs, mach_control_active) &&
+              SCHEMA_FIELD_END(base_fmgc_ap_fd_logic_outputs, mach_control_active, alignof(decltype(base_fmgc_ap_fd_logic_outputs::spd_target_kts))) == offsetof(base_fmgc_ap_fd_logic_outputs, spd_target_kts) &&
+              SCHEMA_FIELD_END(base_fmgc_ap_fd_logic_outputs, spd_target_kts, alignof(decltype(base_fmgc_ap_fd_logic_outputs::pfd_spd_target_kts))) == offsetof(base_fmgc_ap_fd_logic_outputs, pfd_spd_target_kts) &&
+              SCHEMA_FIELD_END(base_fmgc_ap_fd_logic_outputs, pfd_spd_target_kts, alignof(decltype(base_fmgc_ap_fd_logic_outputs::alt_cstr_applicable))) == offsetof(base_fmgc_ap_fd_logic_outputs, alt_cstr_applicable) &&
+              SCHEMA_FIELD_END(base_fmgc_ap_fd_logic_outputs, alt_cstr_applicable, alignof(decltype(base_fmgc_ap_fd_logic_outputs::alt_sel_or_cstr))) == offsetof(base_fmgc_ap_fd_logic_outputs, alt_sel_or_cstr) &&
+              SCHEMA_FIELD_END(base_fmgc_ap_fd_logic_outputs, alt_sel_or_cstr, alignof(decltype(base_fmgc_ap_fd_logic_outputs::fmgc_opp_mode_sync))) == offsetof(base_fmgc_ap_fd_logic_outputs, fmgc_opp_mode_sync) &&
+              SCHEMA_FIELD_END(base_fmgc_ap_fd_logic_outputs, fmgc_opp_mode_sync, alignof(decltype(base_fmgc_ap_fd_logic_outputs::any_ap_fd_engaged))) == offsetof(base_fmgc_ap_fd_logic_outputs, any_ap_fd_engaged) &&
+              SCHEMA_FIELD_END(base_fmgc_ap_fd_logic_outputs, any_ap_fd_engaged, alignof(decltype(base_fmgc_ap_fd_logic_outputs::any_lateral_mode_engaged))) == offsetof(base_fmgc_ap_fd_logic_outputs, any_lateral_mode_engaged) &&
+              SCHEMA_FIELD_END(base_fmgc_ap_fd_logic_outputs, any_lateral_mode_engaged, alignof(decltype(base_fmgc_ap_fd_logic_outputs::any_longitudinal_mode_engaged))) == offsetof(base_fmgc_ap_fd_logic_outputs, any_longitudinal_mode_engaged) &&
+              SCHEMA_FIELD_END(base_fmgc_ap_fd_logic_outputs, any_longitudinal_mode_engaged, alignof(decltype(base_fmgc_ap_fd_logic_outputs::lateral_mode_reset))) == offsetof(base_fmgc_ap_fd_logic_outputs, lateral_mode_reset) &&
+              SCHEMA_FIELD_END(base_fmgc_ap_fd_logic_outputs, lateral_mode_reset, alignof(decltype(base_fmgc_ap_fd_logic_outputs::longitudinal_mode_reset))) == offsetof(base_fmgc_ap_fd_logic_outputs, longitudinal_mode_reset) &&
+              SCHEMA_FIELD_END(base_fmgc_ap_fd_logic_outputs, longitudinal_mode_reset, alignof(decltype(base_fmgc_ap_fd_logic_outputs::hdg_trk_preset_available))) == offsetof(base_fmgc_ap_fd_logic_outputs, hdg_trk_preset_available) &&
+              SCHEMA_FIELD_END(base_fmgc_ap_fd_logic_outputs, hdg_trk_preset_available, alignof(decltype(base_fmgc_ap_fd_logic_outputs::alt_soft_mode_active))) == offsetof(base_fmgc_ap_fd_logic_outputs, alt_soft_mode_active) &&
+              SCHEMA_FIELD_END(base_fmgc_ap_fd_logic_outputs, alt_soft_mode_active, alignof(decltype(base_fmgc_ap_fd_logic_outputs::fd_auto_disengage))) == offsetof(base_fmgc_ap_fd_logic_outputs, fd_auto_disengage) &&
+              SCHEMA_FIELD_END(base_fmgc_ap_fd_logic_outputs, fd_auto_disengage, alignof(decltype(base_fmgc_ap_fd_logic_outputs::ap_fd_mode_reversion))) == offsetof(base_fmgc_ap_fd_logic_outputs, ap_fd_mode_reversion) &&
+              SCHEMA_FIELD_END(base_fmgc_ap_fd_logic_outputs, ap_fd_mode_reversion, alignof(decltype(base_fmgc_ap_fd_logic_outputs::lateral_mode_reversion))) == offsetof(base_fmgc_ap_fd_logic_outputs, lateral_mode_reversion) &&
+              SCHEMA_FIELD_END(base_fmgc_ap_fd_logic_outputs, lateral_mode_reversion, alignof(decltype(base_fmgc_ap_fd_logic_outputs::longitudinal_mode_reversion_vs))) == offsetof(base_fmgc_ap_fd_logic_outputs, longitudinal_mode_reversion_vs) &&
+              SCHEMA_FIELD_END(base_fmgc_ap_fd_logic_outputs, longitudinal_mode_reversion_vs, alignof(decltype(base_fmgc_ap_fd_logic_outputs::longitudinal_mode_reversion_op_clb))) == offsetof(base_fmgc_ap_fd_logic_outputs, longitudinal_mode_reversion_op_clb) &&
+              SCHEMA_FIELD_END(base_fmgc_ap_fd_logic_outputs, longitudinal_mode_reversion_op_clb, alignof(decltype(base_fmgc_ap_fd_logic_outputs::pitch_fd_bars_flashing))) == offsetof(base_fmgc_ap_fd_logic_outputs, pitch_fd_bars_flashing) &&
+              SCHEMA_FIELD_END(base_fmgc_ap_fd_logic_outputs, pitch_fd_bars_flashing, alignof(decltype(base_fmgc_ap_fd_logic_outputs::roll_fd_bars_flashing))) == offsetof(base_fmgc_ap_fd_logic_outputs, roll_fd_bars_flashing) &&
+              SCHEMA_FIELD_END(base_fmgc_ap_fd_logic_outputs, roll_fd_bars_flashing, alignof(decltype(base_fmgc_ap_fd_logic_outputs::loc_bc_selection))) == offsetof(base_fmgc_ap_fd_logic_outputs, loc_bc_selection) &&
+              SCHEMA_FIELD_END(base_fmgc_ap_fd_logic_outputs, loc_bc_selection, alignof(decltype(base_fmgc_ap_fd_logic_outputs::vs_target_not_held))) == offsetof(base_fmgc_ap_fd_logic_outputs, vs_target_not_held) &&
+              SCHEMA_FIELD_END(base_fmgc_ap_fd_logic_outputs, vs_target_not_held, alignof(decltype(base_fmgc_ap_fd_logic_outputs::tcas_vs_target))) == offsetof(base_fmgc_ap_fd_logic_outputs, tcas_vs_target) &&
+              SCHEMA_FIELD_END(base_fmgc_ap_fd_logic_outputs, tcas_vs_target, alignof(decltype(base_fmgc_ap_fd_logic_outputs::tcas_ra_corrective))) == offsetof(base_fmgc_ap_fd_logic_outputs, tcas_ra_corrective) &&
+              SCHEMA_FIELD_END(base_fmgc_ap_fd_logic_outputs, tcas_ra_corrective, alignof(decltype(base_fmgc_ap_fd_logic_outputs::active_tcas_submode))) == offsetof(base_fmgc_ap_fd_logic_outputs, active_tcas_submode) &&
+              SCHEMA_FIELD_END(base_fmgc_ap_fd_logic_outputs, active_tcas_submode, alignof(decltype(base_fmgc_ap_fd_logic_outputs::tcas_alt_acq_cond))) == offsetof(base_fmgc_ap_fd_logic_outputs, tcas_alt_acq_cond) &&
+              SCHEMA_FIELD_END(base_fmgc_ap_fd_logic_outputs, tcas_alt_acq_cond, alignof(decltype(base_fmgc_ap_fd_logic_outputs::tcas_alt_hold_cond))) == offsetof(base_fmgc_ap_fd_logic_outputs, tcas_alt_hold_cond) &&
+              SCHEMA_FIELD_END(base_fmgc_ap_fd_logic_outputs, tcas_alt_hold_cond, alignof(decltype(base_fmgc_ap_fd_logic_outputs::tcas_ra_inhibited))) == offsetof(base_fmgc_ap_fd_logic_outputs, tcas_ra_inhibited) &&
+              SCHEMA_FIELD_END(base_fmgc_ap_fd_logic_outputs, tcas_ra_inhibited, alignof(decltype(base_fmgc_ap_fd_logic_outputs::trk_fpa_deselected))) == offsetof(base_fmgc_ap_fd_logic_outputs, trk_fpa_deselected) &&
+              SCHEMA_FIELD_END(base_fmgc_ap_fd_logic_outputs, trk_fpa_deselected, alignof(decltype(base_fmgc_ap_fd_logic_outputs::longi_large_box_tcas))) == offsetof(base_fmgc_ap_fd_logic_outputs, longi_large_box_tcas) &&
+              SCHEMA_FIELD_END(base_fmgc_ap_fd_logic_outputs, longi_large_box_tcas, alignof(decltype(base_fmgc_ap_fd_logic_outputs::land_2_capability))) == offsetof(base_fmgc_ap_fd_logic_outputs, land_2_capability) &&
+              SCHEMA_FIELD_END(base_fmgc_ap_fd_logic_outputs, land_2_capability, alignof(decltype(base_fmgc_ap_fd_logic_outputs::land_3_fail_passive_capability))) == offsetof(base_fmgc_ap_fd_logic_outputs, land_3_fail_passive_capability) &&
+              SCHEMA_FIELD_END(base_fmgc_ap_fd_logic_outputs, land_3_fail_passive_capability, alignof(decltype(base_fmgc_ap_fd_logic_outputs::land_3_fail_op_capability))) == offsetof(base_fmgc_ap_fd_logic_outputs, land_3_fail_op_capability) &&
+              SCHEMA_FIELD_END(base_fmgc_ap_fd_logic_outputs, land_3_fail_op_capability, alignof(decltype(base_fmgc_ap_fd_logic_outputs::land_2_inop))) == offsetof(base_fmgc_ap_fd_logic_outputs, land_2_inop) &&
+              SCHEMA_FIELD_END(base_fmgc_ap_fd_logic_outputs, land_2_inop, alignof(decltype(base_fmgc_ap_fd_logic_outputs::land_3_fail_passive_inop))) == offsetof(base_fmgc_ap_fd_logic_outputs, land_3_fail_passive_inop) &&
+              SCHEMA_FIELD_END(base_fmgc_ap_fd_logic_outputs, land_3_fail_passive_inop, alignof(decltype(base_fmgc_ap_fd_logic_outputs::land_3_fail_op_inop))) == offsetof(base_fmgc_ap_fd_logic_outputs, land_3_fail_op_inop) &&
+              SCHEMA_FIELD_END(base_fmgc_ap_fd_logic_outputs, land_3_fail_op_inop, alignof(decltype(base_fmgc_ap_fd_logic_outputs::land_2_capacity))) == offsetof(base_fmgc_ap_fd_logic_outputs, land_2_capacity) &&
+              SCHEMA_FIELD_END(base_fmgc_ap_fd_logic_outputs, land_2_capacity, alignof(decltype(base_fmgc_ap_fd_logic_outputs::land_3_fail_passive_capacity))) == offsetof(base_fmgc_ap_fd_logic_outputs, land_3_fail_passive_capacity) &&
+              SCHEMA_FIELD_END(base_fmgc_ap_fd_logic_outputs, land_3_fail_passive_capacity, alignof(decltype(base_fmgc_ap_fd_logic_outputs::land_3_fail_op_capacity))) == offsetof(base_fmgc_ap_fd_logic_outputs, land_3_fail_op_capacity) &&
+              SCHEMA_FIELD_END(base_fmgc_ap_fd_logic_outputs, land_3_fail_op_capacity, alignof(base_fmgc_ap_fd_logic_outputs)) == sizeof(base_fmgc_ap_fd_logic_outputs),
+              "schema of base_fmgc_ap_fd_logic_outputs does not cover all of its members, regenerate the schema");
+
+constexpr SchemaField ap_raw_output_command_fields[] = {
+    SCHEMA_FIELD(ap_raw_output_command, Theta_c_deg),
+    SCHEMA_FIELD(ap_raw_output_command, Phi_c_deg),
+    SCHEMA_FIELD(ap_raw_output_command, Beta_c_deg),
+};
+
+static_assert(SCHEMA_FIELD_END(ap_raw_output_command, Theta_c_deg, alignof(decltype(ap_raw_output_command::Phi_c_deg))) == offsetof(ap_raw_output_command, Phi_c_deg) &&
+              SCHEMA_FIELD_END(ap_raw_output_command, Phi_c_deg, alignof(decltype(ap_raw_output_command::Beta_c_deg))) == offsetof(ap_raw_output_command, Beta_c_deg) &&
+              SCHEMA_FIELD_END(ap_raw_output_command, Beta_c_deg, alignof(ap_raw_output_command)) == sizeof(ap_raw_output_command),
+              "schema of ap_raw_output_command does not cover all of its members, regenerate the schema");
+
+constexpr SchemaField ap_raw_laws_flare_fields[] = {
+    SCHEMA_FIELD(ap_raw_laws_flare, condition_Flare),
+    SCHEMA_FIELD(ap_raw_laws_flare, H_dot_radio_fpm),
+    SCHEMA_FIELD(ap_raw_laws_flare, H_dot_c_fpm),
+    SCHEMA_FIELD(ap_raw_laws_flare, delta_Theta_H_dot_deg),
+    SCHEMA_FIELD(ap_raw_laws_flare, delta_Theta_bz_deg),
+    SCHEMA_FIELD(ap_raw_laws_flare, delta_Theta_bx_deg),
+    SCHEMA_FIELD(ap_raw_laws_flare, delta_Theta_beta_c_deg),
+};
+
+static_assert(SCHEMA_FIELD_END(ap_raw_laws_flare, condition_Flare, alignof(decltype(ap_raw_laws_flare::H_dot_radio_fpm))) == offsetof(ap_raw_laws_flare, H_dot_radio_fpm) &&
+              SCHEMA_FIELD_END(ap_raw_laws_flare, H_dot_radio_fpm, alignof(decltype(ap_raw_laws_flare::H_dot_c_fpm))) == offsetof(ap_raw_laws_flare, H_dot_c_fpm) &&
+              SCHEMA_FIELD_END(ap_raw_laws_flare, H_dot_c_fpm, alignof(decltype(ap_raw_laws_flare::delta_Theta_H_dot_deg))) == offsetof(ap_raw_laws_flare, delta_Theta_H_dot_deg) &&
+              SCHEMA_FIELD_END(ap_raw_laws_flare, delta_Theta_H_dot_deg, alignof(decltype(ap_raw_laws_flare::delta_Theta_bz_deg))) == offsetof(ap_raw_laws_flare, delta_Theta_bz_deg) &&
+              SCHEMA_FIELD_END(ap_raw_laws_flare, delta_Theta_bz_deg, alignof(decltype(ap_raw_laws_flare::delta_Theta_bx_deg))) == offsetof(ap_raw_laws_flare, delta_Theta_bx_deg) &&
+              SCHEMA_FIELD_END(ap_raw_laws_flare, delta_Theta_bx_deg, alignof(decltype(ap_raw_laws_flare::delta_Theta_beta_c_deg))) == offsetof(ap_raw_laws_flare, delta_Theta_beta_c_deg) &&
+              SCHEMA_FIELD_END(ap_raw_laws_flare, delta_Theta_beta_c_deg, alignof(ap_raw_laws_flare)) == sizeof(ap_raw_laws_flare),
+              "schema of ap_raw_laws_flare does not cover all of its members, regenerate the schema");
+
+constexpr SchemaField ap_raw_output_fields[] = {
+    SCHEMA_FIELD(ap_raw_output, Phi_loc_c),
+    SCHEMA_FIELD(ap_raw_output, Nosewheel_c),
+    SCHEMA_FIELD(ap_raw_output, flight_director),
+    SCHEMA_FIELD(ap_raw_output, autopilot),
+    SCHEMA_FIELD(ap_raw_output, flare_law),
+};
+
+static_assert(SCHEMA_FIELD_END(ap_raw_output, Phi_loc_c, alignof(decltype(ap_raw_output::Nosewheel_c))) == offsetof(ap_raw_output, Nosewheel_c) &&
+              SCHEMA_FIELD_END(ap_raw_output, Nosewheel_c, alignof(decltype(ap_raw_output::flight_director))) == offsetof(ap_raw_output, flight_director) &&
+              SCHEMA_FIELD_END(ap_raw_output, flight_director, alignof(decltype(ap_raw_output::autopilot))) == offsetof(ap_raw_output, autopilot) &&
+              SCHEMA_FIELD_END(ap_raw_output, autopilot, alignof(decltype(ap_raw_output::flare_law))) == offsetof(ap_raw_output, flare_law) &&
+              SCHEMA_FIELD_END(ap_raw_output, flare_law, alignof(ap_raw_output)) == sizeof(ap_raw_output),
+              "schema of ap_raw_output does not cover all of its members, regenerate the schema");
+
+constexpr SchemaField base_fmgc_athr_outputs_fields[] = {
+    SCHEMA_FIELD(base_fmgc_athr_outputs, athr_active),
+    SCHEMA_FIELD(base_fmgc_athr_outputs, athr_limited),
+    SCHEMA_FIELD(base_fmgc_athr_outputs, alpha_floor_mode_active),
+    SCHEMA_FIELD(base_fmgc_athr_outputs, thrust_mode_active),
+    SCHEMA_FIELD(base_fmgc_athr_outputs, thrust_target_idle),
+    SCHEMA_FIELD(base_fmgc_athr_outputs, speed_mach_mode_active),
+    SCHEMA_FIELD(base_fmgc_athr_outputs, retard_mode_active),
+    SCHEMA_FIELD(base_fmgc_athr_outputs, fma_mode),
+    SCHEMA_FIELD(base_fmgc_athr_outputs, fma_message),
+    SCHEMA_FIELD(base_fmgc_athr_outputs, n1_c_percent),
+};
+
+static_assert(SCHEMA_FIELD_END(base_fmgc_athr_outputs, athr_active, alignof(decltype(base_fmgc_athr_outputs::athr_limited))) == offsetof(base_fmgc_athr_outputs, athr_limited) &&
+              SCHEMA_FIELD_END(base_fmgc_athr_outputs, athr_limited, alignof(decltype(base_fmgc_athr_outputs::alpha_floor_mode_active))) == offsetof(base_fmgc_athr_outputs, alpha_floor_mode_active) &&
+              SCHEMA_FIELD_END(base_fmgc_athr_outputs, alpha_floor_mode_active, alignof(decltype(base_fmgc_athr_outputs::thrust_mode_active))) == offsetof(base_fmgc_athr_outputs, thrust_mode_active) &&
+              SCHEMA_FIELD_END(base_fmgc_athr_outputs, thrust_mode_active, alignof(decltype(base_fmgc_athr_outputs::thrust_target_idle))) == offsetof(base_fmgc_athr_outputs, thrust_target_idle) &&
+              SCHEMA_FIELD_END(base_fmgc_athr_outputs, thrust_target_idle, alignof(decltype(base_fmgc_athr_outputs::speed_mach_mode_active))) == offsetof(base_fmgc_athr_outputs, speed_mach_mode_active) &&
+              SCHEMA_FIELD_END(base_fmgc_athr_outputs, speed_mach_mode_active, alignof(decltype(base_fmgc_athr_outputs::retard_mode_active))) == offsetof(base_fmgc_athr_outputs, retard_mode_active) &&
+              SCHEMA_FIELD_END(base_fmgc_athr_outputs, retard_mode_active, alignof(decltype(base_fmgc_athr_outputs::fma_mode))) == offsetof(base_fmgc_athr_outputs, fma_mode) &&
+              SCHEMA_FIELD_END(base_fmgc_athr_outputs, fma_mode, alignof(decltype(base_fmgc_athr_outputs::fma_message))) == offsetof(base_fmgc_athr_outputs, fma_message) &&
+              SCHEMA_FIELD_END(base_fmgc_athr_outputs, fma_message, alignof(decltype(base_fmgc_athr_outputs::n1_c_percent))) == offsetof(base_fmgc_athr_outputs, n1_c_percent) &&
+              SCHEMA_FIELD_END(base_fmgc_athr_outputs, n1_c_percent, alignof(base_fmgc_athr_outputs)) == sizeof(base_fmgc_athr_outputs),
+              "schema of base_fmgc_athr_outputs does not cover all of its members, regenerate the schema");
+
+constexpr SchemaField base_fmgc_discrete_outputs_fields[] = {
+    SCHEMA_FIELD(base_fmgc_discrete_outputs, athr_own_engaged),
+    SCHEMA_FIELD(base_fmgc_discrete_outputs, fd_own_engaged),
+    SCHEMA_FIELD(base_fmgc_discrete_outputs, ap_own_engaged),
+    SCHEMA_FIELD(base_fmgc_discrete_outputs, fcu_own_fail),
+    SCHEMA_FIELD(base_fmgc_discrete_outputs, fmgc_healthy),
+    SCHEMA_FIELD(base_fmgc_discrete_outputs, ils_test_inhibit),
+};
+
+static_assert(SCHEMA_FIELD_END(base_fmgc_discrete_outputs, athr_own_engaged, alignof(decltype(base_fmgc_discrete_outputs::fd_own_engaged))) == offsetof(base_fmgc_discrete_outputs, fd_own_engaged) &&
+              SCHEMA_FIELD_END(base_fmgc_discrete_outputs, fd_own_engaged, alignof(decltype(base_fmgc_discrete_outputs::ap_own_engaged))) == offsetof(base_fmgc_discrete_outputs, ap_own_engaged) &&
+              SCHEMA_FIELD_END(base_fmgc_discrete_outputs, ap_own_engaged, alignof(decltype(base_fmgc_discrete_outputs::fcu_own_fail))) == offsetof(base_fmgc_discrete_outputs, fcu_own_fail) &&
+              SCHEMA_FIELD_END(base_fmgc_discrete_outputs, fcu_own_fail, alignof(decltype(base_fmgc_discrete_outputs::fmgc_healthy))) == offsetof(base_fmgc_discrete_outputs, fmgc_healthy) &&
+              SCHEMA_FIELD_END(base_fmgc_discrete_outputs, fmgc_healthy, alignof(decltype(base_fmgc_discrete_outputs::ils_test_inhibit))) == offsetof(base_fmgc_discrete_outputs, ils_test_inhibit) &&
+              SCHEMA_FIELD_END(base_fmgc_discrete_outputs, ils_test_inhibit, alignof(base_fmgc_discrete_outputs)) == sizeof(base_fmgc_discrete_outputs),
+              "schema of base_fmgc_discrete_outputs does not cover all of its members, regenerate the schema");
+
+constexpr SchemaField base_fmgc_a_bus_fields[] = {
+    SCHEMA_FIELD(base_fmgc_a_bus, pfd_sel_spd_kts),
+    SCHEMA_FIELD(base_fmgc_a_bus, runway_hdg_memorized_deg),
+    SCHEMA_FIELD(base_fmgc_a_bus, preset_mach_from_mcdu),
+    SCHEMA_FIELD(base_fmgc_a_bus, preset_speed_from_mcdu_kts),
+    SCHEMA_FIELD(base_fmgc_a_bus, roll_fd_command),
+    SCHEMA_FIELD(base_fmgc_a_bus, pitch_fd_command),
+    SCHEMA_FIELD(base_fmgc_a_bus, yaw_fd_command),
+    SCHEMA_FIELD(base_fmgc_a_bus, discrete_word_5),
+    SCHEMA_FIELD(base_fmgc_a_bus, discrete_word_4),
+    SCHEMA_FIELD(base_fmgc_a_bus, fm_alt_constraint_ft),
+    SCHEMA_FIELD(base_fmgc_a_bus, altitude_ft),
+    SCHEMA_FIELD(base_fmgc_a_bus, mach),
+    SCHEMA_FIELD(base_fmgc_a_bus, cas_kts),
+    SCHEMA_FIELD(base_fmgc_a_bus, flx_to_temp_deg_c),
+    SCHEMA_FIELD(base_fmgc_a_bus, ats_discrete_word),
+    SCHEMA_FIELD(base_fmgc_a_bus, ats_fma_discrete_word),
+    SCHEMA_FIELD(base_fmgc_a_bus, discrete_word_3),
+    SCHEMA_FIELD(base_fmgc_a_bus, discrete_word_1),
+    SCHEMA_FIELD(base_fmgc_a_bus, discrete_word_2),
+    SCHEMA_FIELD(base_fmgc_a_bus, discrete_word_6),
+    SCHEMA_FIELD(base_fmgc_a_bus, synchro_spd_mach_value),
+    SCHEMA_FIELD(base_fmgc_a_bus, low_target_speed_margin_kts),
+    SCHEMA_FIELD(base_fmgc_a_bus, high_target_speed_margin_kts),
+    SCHEMA_FIELD(base_fmgc_a_bus, delta_p_ail_voted_cmd_deg),
+    SCHEMA_FIELD(base_fmgc_a_bus, delta_p_splr_voted_cmd_deg),
+    SCHEMA_FIELD(base_fmgc_a_bus, delta_r_voted_cmd_deg),
+    SCHEMA_FIELD(base_fmgc_a_bus, delta_nosewheel_voted_cmd_deg),
+    SCHEMA_FIELD(base_fmgc_a_bus, delta_q_voted_cmd_deg),
+    SCHEMA_FIELD(base_fmgc_a_bus, track_deg),
+    SCHEMA_FIELD(base_fmgc_a_bus, heading_deg),
+    SCHEMA_FIELD(base_fmgc_a_bus, fpa_deg),
+    SCHEMA_FIELD(base_fmgc_a_bus, n1_command_percent),
+    SCHEMA_FIELD(base_fmgc_a_bus, vertical_speed_ft_min),
+    SCHEMA_FIELD(base_fmgc_a_bus, discrete_word_7),
+};
+
+static_assert(SCHEMA_FIELD_END(base_fmgc_a_bus, pfd_sel_spd_kts, alignof(decltype(base_fmgc_a_bus::runway_hdg_memorized_deg))) == offsetof(base_fmgc_a_bus, runway_hdg_memorized_deg) &&
+              SCHEMA_FIELD_END(base_fmgc_a_bus, runway_hdg_memorized_deg, alignof(decltype(base_fmgc_a_bus::preset_mach_from_mcdu))) == offsetof(base_fmgc_a_bus, preset_mach_from_mcdu) &&
+              SCHEMA_FIELD_END(base_fmgc_a_bus, preset_mach_from_mcdu, alignof(decltype(base_fmgc_a_bus::preset_speed_from_mcdu_kts))) == offsetof(base_fmgc_a_bus, preset_speed_from_mcdu_kts) &&
+              SCHEMA_FIELD_END(base_fmgc_a_bus, preset_speed_from_mcdu_kts, alignof(decltype(base_fmgc_a_bus::roll_fd_command))) == offsetof(base_fmgc_a_bus, roll_fd_command) &&
+              SCHEMA_FIELD_END(base_fmgc_a_bus, roll_fd_command, alignof(decltype(base_fmgc_a_bus::pitch_fd_command))) == offsetof(base_fmgc_a_bus, pitch_fd_command) &&
+              SCHEMA_FIELD_END(base_fmgc_a_bus, pitch_fd_command, alignof(decltype(base_fmgc_a_bus::yaw_fd_command))) == offsetof(base_fmgc_a_bus, yaw_fd_command) &&
+              SCHEMA_FIELD_END(base_fmgc_a_bus, yaw_fd_command, alignof(decltype(base_fmgc_a_bus::discrete_word_5))) == offsetof(base_fmgc_a_bus, discrete_word_5) &&
+              SCHEMA_FIELD_END(base_fmgc_a_bus, discrete_word_5, alignof(decltype(base_fmgc_a_bus::discrete_word_4))) == offsetof(base_fmgc_a_bus, discrete_word_4) &&
+              SCHEMA_FIELD_END(base_fmgc_a_bus, discrete_word_4, alignof(decltype(base_fmgc_a_bus::fm_alt_constraint_ft))) == offsetof(base_fmgc_a_bus, fm_alt_constraint_ft) &&
+              SCHEMA_FIELD_END(base_fmgc_a_bus, fm_alt_constraint_ft, alignof(decltype(base_fmgc_a_bus::altitude_ft))) == offsetof(base_fmgc_a_bus, altitude_ft) &&
+              SCHEMA_FIELD_END(base_fmgc_a_bus, altitude_ft, alignof(decltype(base_fmgc_a_bus::mach))) == offsetof(base_fmgc_a_bus, mach) &&
+              SCHEMA_FIELD_END(base_fmgc_a_bus, mach, alignof(decltype(base_fmgc_a_bus::cas_kts))) == offsetof(base_fmgc_a_bus, cas_kts) &&
+              SCHEMA_FIELD_END(base_fmgc_a_bus, cas_kts, alignof(decltype(base_fmgc_a_bus::flx_to_temp_deg_c))) == offsetof(base_fmgc_a_bus, flx_to_temp_deg_c) &&
+              SCHEMA_FIELD_END(base_fmgc_a_bus, flx_to_temp_deg_c, alignof(decltype(base_fmgc_a_bus::ats_discrete_word))) == offsetof(base_fmgc_a_bus, ats_discrete_word) &&
+              SCHEMA_FIELD_END(base_fmgc_a_bus, ats_discrete_word, alignof(decltype(base_fmgc_a_bus::ats_fma_discrete_word))) == offsetof(base_fmgc_a_bus, ats_fma_discrete_word) &&
+              SCHEMA_FIELD_END(base_fmgc_a_bus, ats_fma_discrete_word, alignof(decltype(base_fmgc_a_bus::discrete_word_3))) == offsetof(base_fmgc_a_bus, discrete_word_3) &&
+              SCHEMA_FIELD_END(base_fmgc_a_bus, discrete_word_3, alignof(decltype(base_fmgc_a_bus::discrete_word_1))) == offsetof(base_fmgc_a_bus, discrete_word_1) &&
+              SCHEMA_FIELD_END(base_fmgc_a_bus, discrete_word_1, alignof(decltype(base_fmgc_a_bus::discrete_word_2))) == offsetof(base_fmgc_a_bus, discrete_word_2) &&
+              SCHEMA_FIELD_END(base_fmgc_a_bus, discrete_word_2, alignof(decltype(base_fmgc_a_bus::discrete_word_6))) == offsetof(base_fmgc_a_bus, discrete_word_6) &&
+              SCHEMA_FIELD_END(base_fmgc_a_bus, discrete_word_6, alignof(decltype(base_fmgc_a_bus::synchro_spd_mach_value))) == offsetof(base_fmgc_a_bus, synchro_spd_mach_value) &&
+              SCHEMA_FIELD_END(base_fmgc_a_bus, synchro_spd_mach_value, alignof(decltype(base_fmgc_a_bus::low_target_speed_margin_kts))) == offsetof(base_fmgc_a_bus, low_target_speed_margin_kts) &&
+              SCHEMA_FIELD_END(base_fmgc_a_bus, low_target_speed_margin_kts, alignof(decltype(base_fmgc_a_bus::high_target_speed_margin_kts))) == offsetof(base_fmgc_a_bus, high_target_speed_margin_kts) &&
+              SCHEMA_FIELD_END(base_fmgc_a_bus, high_target_speed_margin_kts, alignof(decltype(base_fmgc_a_bus::delta_p_ail_voted_cmd_deg))) == offsetof(base_fmgc_a_bus, delta_p_ail_voted_cmd_deg) &&
+              SCHEMA_FIELD_END(base_fmgc_a_bus, delta_p_ail_voted_cmd_deg, alignof(decltype(base_fmgc_a_bus::delta_p_splr_voted_cmd_deg))) == offsetof(base_fmgc_a_bus, delta_p_splr_voted_cmd_deg) &&
+              SCHEMA_FIELD_END(base_fmgc_a_bus, delta_p_splr_voted_cmd_deg, alignof(decltype(base_fmgc_a_bus::delta_r_voted_cmd_deg))) == offsetof(base_fmgc_a_bus, delta_r_voted_cmd_deg) &&
+              SCHEMA_FIELD_END(base_fmgc_a_bus, delta_r_voted_cmd_deg, alignof(decltype(base_fmgc_a_bus::delta_nosewheel_voted_cmd_deg))) == offsetof(base_fmgc_a_bus, delta_nosewheel_voted_cmd_deg) &&
+              SCHEMA_FIELD_END(base_fmgc_a_bus, delta_nosewheel_voted_cmd_deg, alignof(decltype(base_fmgc_a_bus::delta_q_voted_cmd_deg))) == offsetof(base_fmgc_a_bus, delta_q_voted_cmd_deg) &&
+              SCHEMA_FIELD_END(base_fmgc_a_bus, delta_q_voted_cmd_deg, alignof(decltype(base_fmgc_a_bus::track_deg))) == offsetof(base_fmgc_a_bus, track_deg) &&
+              SCHEMA_FIELD_END(base_fmgc_a_bus, track_deg, alignof(decltype(base_fmgc_a_bus::heading_deg))) == offsetof(base_fmgc_a_bus, heading_deg) &&
+              SCHEMA_FIELD_END(base_fmgc_a_bus, heading_deg, alignof(decltype(base_fmgc_a_bus::fpa_deg))) == offsetof(base_fmgc_a_bus, fpa_deg) &&
+              SCHEMA_FIELD_END(base_fmgc_a_bus, fpa_deg, alignof(decltype(base_fmgc_a_bus::n1_command_percent))) == offsetof(base_fmgc_a_bus, n1_command_percent) &&
+              SCHEMA_FIELD_END(base_fmgc_a_bus, n1_command_percent, alignof(decltype(base_fmgc_a_bus::vertical_speed_ft_min))) == offsetof(base_fmgc_a_bus, vertical_speed_ft_min) &&
+              SCHEMA_FIELD_END(base_fmgc_a_bus, vertical_speed_ft_min, alignof(decltype(base_fmgc_a_bus::discrete_word_7))) == offsetof(base_fmgc_a_bus, discrete_word_7) &&
+              SCHEMA_FIELD_END(base_fmgc_a_bus, discrete_word_7, alignof(base_fmgc_a_bus)) == sizeof(base_fmgc_a_bus),
+              "schema of base_fmgc_a_bus does not cover all of its members, regenerate the schema");
+
+constexpr SchemaField base_fmgc_b_bus_fields[] = {
+    SCHEMA_FIELD(base_fmgc_b_bus, fac_weight_lbs),
+    SCHEMA_FIELD(base_fmgc_b_bus, fm_weight_lbs),
+    SCHEMA_FIELD(base_fmgc_b_bus, fac_cg_percent),
+    SCHEMA_FIELD(base_fmgc_b_bus, fm_cg_percent),
+    SCHEMA_FIELD(base_fmgc_b_bus, fg_radio_height_ft),
+    SCHEMA_FIELD(base_fmgc_b_bus, discrete_word_4),
+    SCHEMA_FIELD(base_fmgc_b_bus, ats_discrete_word),
+    SCHEMA_FIELD(base_fmgc_b_bus, discrete_word_3),
+    SCHEMA_FIELD(base_fmgc_b_bus, discrete_word_1),
+    SCHEMA_FIELD(base_fmgc_b_bus, discrete_word_2),
+    SCHEMA_FIELD(base_fmgc_b_bus, approach_spd_target_kn),
+    SCHEMA_FIELD(base_fmgc_b_bus, delta_p_ail_cmd_deg),
+    SCHEMA_FIELD(base_fmgc_b_bus, delta_p_splr_cmd_deg),
+    SCHEMA_FIELD(base_fmgc_b_bus, delta_r_cmd_deg),
+    SCHEMA_FIELD(base_fmgc_b_bus, delta_nose_wheel_cmd_deg),
+    SCHEMA_FIELD(base_fmgc_b_bus, delta_q_cmd_deg),
+    SCHEMA_FIELD(base_fmgc_b_bus, n1_left_percent),
+    SCHEMA_FIELD(base_fmgc_b_bus, n1_right_percent),
+};
+
+static_assert(SCHEMA_FIELD_END(base_fmgc_b_bus, fac_weight_lbs, alignof(decltype(base_fmgc_b_bus::fm_weight_lbs))) == offsetof(base_fmgc_b_bus, fm_weight_lbs) &&
+              SCHEMA_FIELD_END(base_fmgc_b_bus, fm_weight_lbs, alignof(decltype(base_fmgc_b_bus::fac_cg_percent))) == offsetof(base_fmgc_b_bus, fac_cg_percent) &&
+              SCHEMA_FIELD_END(base_fmgc_b_bus, fac_cg_percent, alignof(decltype(base_fmgc_b_bus::fm_cg_percent))) == offsetof(base_fmgc_b_bus, fm_cg_percent) &&
+              SCHEMA_FIELD_END(base_fmgc_b_bus, fm_cg_percent, alignof(decltype(base_fmgc_b_bus::fg_radio_height_ft))) == offsetof(base_fmgc_b_bus, fg_radio_height_ft) &&
+              SCHEMA_FIELD_END(base_fmgc_b_bus, fg_radio_height_ft, alignof(decltype(base_fmgc_b_bus::discrete_word_4))) == offsetof(base_fmgc_b_bus, discrete_word_4) &&
+              SCHEMA_FIELD_END(base_fmgc_b_bus, discrete_word_4, alignof(decltype(base_fmgc_b_bus::ats_discrete_word))) == offsetof(base_fmgc_b_bus, ats_discrete_word) &&
+              SCHEMA_FIELD_END(base_fmgc_b_bus, ats_discrete_word, alignof(decltype(base_fmgc_b_bus::discrete_word_3))) == offsetof(base_fmgc_b_bus, discrete_word_3) &&
+              SCHEMA_FIELD_END(base_fmgc_b_bus, discrete_word_3, alignof(decltype(base_fmgc_b_bus::discrete_word_1))) == offsetof(base_fmgc_b_bus, discrete_word_1) &&
+              SCHEMA_FIELD_END(base_fmgc_b_bus, discrete_word_1, alignof(decltype(base_fmgc_b_bus::discrete_word_2))) == offsetof(base_fmgc_b_bus, discrete_word_2) &&
+              SCHEMA_FIELD_END(base_fmgc_b_bus, discrete_word_2, alignof(decltype(base_fmgc_b_bus::approach_spd_target_kn))) == offsetof(base_fmgc_b_bus, approach_spd_target_kn) &&
+              SCHEMA_FIELD_END(base_fmgc_b_bus, approach_spd_target_kn, alignof(decltype(base_fmgc_b_bus::delta_p_ail_cmd_deg))) == offsetof(base_fmgc_b_bus, delta_p_ail_cmd_deg) &&
+              SCHEMA_FIELD_END(base_fmgc_b_bus, delta_p_ail_cmd_deg, alignof(decltype(base_fmgc_b_bus::delta_p_splr_cmd_deg))) == offsetof(base_fmgc_b_bus, delta_p_splr_cmd_deg) &&
+              SCHEMA_FIELD_END(base_fmgc_b_bus, delta_p_splr_cmd_deg, alignof(decltype(base_fmgc_b_bus::delta_r_cmd_deg))) == offsetof(base_fmgc_b_bus, delta_r_cmd_deg) &&
+              SCHEMA_FIELD_END(base_fmgc_b_bus, delta_r_cmd_deg, alignof(decltype(base_fmgc_b_bus::delta_nose_wheel_cmd_deg))) == offsetof(base_fmgc_b_bus, delta_nose_wheel_cmd_deg) &&
+              SCHEMA_FIELD_END(base_fmgc_b_bus, delta_nose_wheel_cmd_deg, alignof(decltype(base_fmgc_b_bus::delta_q_cmd_deg))) == offsetof(base_fmgc_b_bus, delta_q_cmd_deg) &&
+              SCHEMA_FIELD_END(base_fmgc_b_bus, delta_q_cmd_deg, alignof(decltype(base_fmgc_b_bus::n1_left_percent))) == offsetof(base_fmgc_b_bus, n1_left_percent) &&
+              SCHEMA_FIELD_END(base_fmgc_b_bus, n1_left_percent, alignof(decltype(base_fmgc_b_bus::n1_right_percent))) == offsetof(base_fmgc_b_bus, n1_right_percent) &&
+              SCHEMA_FIELD_END(base_fmgc_b_bus, n1_right_percent, alignof(base_fmgc_b_bus)) == sizeof(base_fmgc_b_bus),
+              "schema of base_fmgc_b_bus does not cover all of its members, regenerate the schema");
+
+constexpr SchemaField base_fmgc_bus_outputs_fields[] = {
+    SCHEMA_FIELD(base_fmgc_bus_outputs, fmgc_a_bus),
+    SCHEMA_FIELD(base_fmgc_bus_outputs, fmgc_b_bus),
+};
+
+static_assert(SCHEMA_FIELD_END(base_fmgc_bus_outputs, fmgc_a_bus, alignof(decltype(base_fmgc_bus_outputs::fmgc_b_bus))) == offsetof(base_fmgc_bus_outputs, fmgc_b_bus) &&
+              SCHEMA_FIELD_END(base_fmgc_bus_outputs, fmgc_b_bus, alignof(base_fmgc_bus_outputs)) == sizeof(base_fmgc_bus_outputs),
+              "schema of base_fmgc_bus_outputs does not cover all of its members, regenerate the schema");
+
+constexpr SchemaField base_ecu_bus_fields[] = {
+    SCHEMA_FIELD(base_ecu_bus, selected_tla_deg),
+    SCHEMA_FIELD(base_ecu_bus, n1_ref_percent),
+    SCHEMA_FIELD(base_ecu_bus, selected_flex_temp_deg),
+    SCHEMA_FIELD(base_ecu_bus, ecu_status_word_1),
+    SCHEMA_FIELD(base_ecu_bus, ecu_status_word_2),
+    SCHEMA_FIELD(base_ecu_bus, ecu_status_word_3),
+    SCHEMA_FIELD(base_ecu_bus, n1_limit_percent),
+    SCHEMA_FIELD(base_ecu_bus, n1_maximum_percent),
+    SCHEMA_FIELD(base_ecu_bus, n1_command_percent),
+    SCHEMA_FIELD(base_ecu_bus, selected_n2_actual_percent),
+    SCHEMA_FIELD(base_ecu_bus, selected_n1_actual_percent),
+    SCHEMA_FIELD(base_ecu_bus, ecu_maintenance_word_6),
+};
+
+static_assert(SCHEMA_FIELD_END(base_ecu_bus, selected_tla_deg, alignof(decltype(base_ecu_bus::n1_ref_percent))) == offsetof(base_ecu_bus, n1_ref_percent) &&
+              SCHEMA_FIELD_END(base_ecu_bus, n1_ref_percent, alignof(decltype(base_ecu_bus::selected_flex_temp_deg))) == offsetof(base_ecu_bus, selected_flex_temp_deg) &&
+              SCHEMA_FIELD_END(base_ecu_bus, selected_flex_temp_deg, alignof(decltype(base_ecu_bus::ecu_status_word_1))) == offsetof(base_ecu_bus, ecu_status_word_1) &&
+              SCHEMA_FIELD_END(base_ecu_bus, ecu_status_word_1, alignof(decltype(base_ecu_bus::ecu_status_word_2))) == offsetof(base_ecu_bus, ecu_status_word_2) &&
+              SCHEMA_FIELD_END(base_ecu_bus, ecu_status_word_2, alignof(decltype(base_ecu_bus::ecu_status_word_3))) == offsetof(base_ecu_bus, ecu_status_word_3) &&
+              SCHEMA_FIELD_END(base_ecu_bus, ecu_status_word_3, alignof(decltype(base_ecu_bus::n1_limit_percent))) == offsetof(base_ecu_bus, n1_limit_percent) &&
+              SCHEMA_FIELD_END(base_ecu_bus, n1_limit_percent, alignof(decltype(base_ecu_bus::n1_maximum_percent))) == offsetof(base_ecu_bus, n1_maximum_percent) &&
+              SCHEMA_FIELD_END(base_ecu_bus, n1_maximum_percent, alignof(decltype(base_ecu_bus::n1_command_percent))) == offsetof(base_ecu_bus, n1_command_percent) &&
+              SCHEMA_FIELD_END(base_ecu_bus, n1_command_percent, alignof(decltype(base_ecu_bus::selected_n2_actual_percent))) == offsetof(base_ecu_bus, selected_n2_actual_percent) &&
+              SCHEMA_FIELD_END(base_ecu_bus, selected_n2_actual_percent, alignof(decltype(base_ecu_bus::selected_n1_actual_percent))) == offsetof(base_ecu_bus, selected_n1_actual_percent) &&
+              SCHEMA_FIELD_END(base_ecu_bus, selected_n1_actual_percent, alignof(decltype(base_ecu_bus::ecu_maintenance_word_6))) == offsetof(base_ecu_bus, ecu_maintenance_word_6) &&
+              SCHEMA_FIELD_END(base_ecu_bus, ecu_maintenance_word_6, alignof(base_ecu_bus)) == sizeof(base_ecu_bus),
+              "schema of base_ecu_bus does not cover all of its members, regenerate the schema");
+
+constexpr SchemaField base_fcu_bus_fields[] = {
+    SCHEMA_FIELD(base_fcu_bus, selected_hdg_deg),
+    SCHEMA_FIELD(base_fcu_bus, selected_alt_ft),
+    SCHEMA_FIELD(base_fcu_bus, selected_spd_kts),
+    SCHEMA_FIELD(base_fcu_bus, selected_vz_ft_min),
+    SCHEMA_FIELD(base_fcu_bus, selected_mach),
+    SCHEMA_FIELD(base_fcu_bus, selected_trk_deg),
+    SCHEMA_FIELD(base_fcu_bus, selected_fpa_deg),
+    SCHEMA_FIELD(base_fcu_bus, ats_fma_discrete_word),
+    SCHEMA_FIELD(base_fcu_bus, fcu_flex_to_temp_deg_c),
+    SCHEMA_FIELD(base_fcu_bus, ats_discrete_word),
+    SCHEMA_FIELD(base_fcu_bus, eis_discrete_word_1_left),
+    SCHEMA_FIELD(base_fcu_bus, eis_discrete_word_1_right),
+    SCHEMA_FIELD(base_fcu_bus, eis_discrete_word_2_left),
+    SCHEMA_FIELD(base_fcu_bus, eis_discrete_word_2_right),
+    SCHEMA_FIELD(base_fcu_bus, baro_setting_left_hpa),
+    SCHEMA_FIELD(base_fcu_bus, baro_setting_right_hpa),
+    SCHEMA_FIELD(base_fcu_bus, baro_setting_left_inhg),
+    SCHEMA_FIELD(base_fcu_bus, baro_setting_right_inhg),
+    SCHEMA_FIELD(base_fcu_bus, fcu_discrete_word_2),
+    SCHEMA_FIELD(base_fcu_bus, fcu_discrete_word_1),
+    SCHEMA_FIELD(base_fcu_bus, n1_cmd_percent),
+};
+
+static_assert(SCHEMA_FIELD_END(base_fcu_bus, selected_hdg_deg, alignof(decltype(base_fcu_bus::selected_alt_ft))) == offsetof(base_fcu_bus, selected_alt_ft) &&
+              SCHEMA_FIELD_END(base_fcu_bus, selected_alt_ft, alignof(decltype(base_fcu_bus::selected_spd_kts))) == offsetof(base_fcu_bus, selected_spd_kts) &&
+              SCHEMA_FIELD_END(base_fcu_bus, selected_spd_kts, alignof(decltype(base_fcu_bus::selected_vz_ft_min))) == offsetof(base_fcu_bus, selected_vz_ft_min) &&
+              SCHEMA_FIELD_END(base_fcu_bus, selected_vz_ft_min, alignof(decltype(base_fcu_bus::selected_mach))) == offsetof(base_fcu_bus, selected_mach) &&
+              SCHEMA_FIELD_END(base_fcu_bus, selected_mach, alignof(decltype(base_fcu_bus::selected_trk_deg))) == offsetof(base_fcu_bus, selected_trk_deg) &&
+              SCHEMA_FIELD_END(base_fcu_bus, selected_trk_deg, alignof(decltype(base_fcu_bus::selected_fpa_deg))) == offsetof(base_fcu_bus, selected_fpa_deg) &&
+              SCHEMA_FIELD_END(base_fcu_bus, selected_fpa_deg, alignof(decltype(base_fcu_bus::ats_fma_discrete_word))) == offsetof(base_fcu_bus, ats_fma_discrete_word) &&
+              SCHEMA_FIELD_END(base_fcu_bus, ats_fma_discrete_word, alignof(decltype(base_fcu_bus::fcu_flex_to_temp_deg_c))) == offsetof(base_fcu_bus, fcu_flex_to_temp_deg_c) &&
+              SCHEMA_FIELD_END(base_fcu_bus, fcu_flex_to_temp_deg_c, alignof(decltype(base_fcu_bus::ats_discrete_word))) == offsetof(base_fcu_bus, ats_discrete_word) &&
+              SCHEMA_FIELD_END(base_fcu_bus, ats_discrete_word, alignof(decltype(base_fcu_bus::eis_discrete_word_1_left))) == offsetof(base_fcu_bus, eis_discrete_word_1_left) &&
+              SCHEMA_FIELD_END(base_fcu_bus, eis_discrete_word_1_left, alignof(decltype(base_fcu_bus::eis_discrete_word_1_right))) == offsetof(base_fcu_bus, eis_discrete_word_1_right) &&
+              SCHEMA_FIELD_END(base_fcu_bus, eis_discrete_word_1_right, alignof(decltype(base_fcu_bus::eis_discrete_word_2_left))) == offsetof(base_fcu_bus, eis_discrete_word_2_left) &&
+              SCHEMA_FIELD_END(base_fcu_bus, eis_discrete_word_2_left, alignof(decltype(base_fcu_bus::eis_discrete_word_2_right))) == offsetof(base_fcu_bus, eis_discrete_word_2_right) &&
+              SCHEMA_FIELD_END(base_fcu_bus, eis_discrete_word_2_right, alignof(decltype(base_fcu_bus::baro_setting_left_hpa))) == offsetof(base_fcu_bus, baro_setting_left_hpa) &&
+              SCHEMA_FIELD_END(base_fcu_bus, baro_setting_left_hpa, alignof(decltype(base_fcu_bus::baro_setting_right_hpa))) == offsetof(base_fcu_bus, baro_setting_right_hpa) &&
+              SCHEMA_FIELD_END(base_fcu_bus, baro_setting_right_hpa, alignof(decltype(base_fcu_bus::baro_setting_left_inhg))) == offsetof(base_fcu_bus, baro_setting_left_inhg) &&
+              SCHEMA_FIELD_END(base_fcu_bus, baro_setting_left_inhg, alignof(decltype(base_fcu_bus::baro_setting_right_inhg))) == offsetof(base_fcu_bus, baro_setting_right_inhg) &&
+              SCHEMA_FIELD_END(base_fcu_bus, baro_setting_right_inhg, alignof(decltype(base_fcu_bus::fcu_discrete_word_2))) == offsetof(base_fcu_bus, fcu_discrete_word_2) &&
+              SCHEMA_FIELD_END(base_fcu_bus, fcu_discrete_word_2, alignof(decltype(base_fcu_bus::fcu_discrete_word_1))) == offsetof(base_fcu_bus, fcu_discrete_word_1) &&
+              SCHEMA_FIELD_END(base_fcu_bus, fcu_discrete_word_1, alignof(decltype(base_fcu_bus::n1_cmd_percent))) == offsetof(base_fcu_bus, n1_cmd_percent) &&
+              SCHEMA_FIELD_END(base_fcu_bus, n1_cmd_percent, alignof(base_fcu_bus)) == sizeof(base_fcu_bus),
+              "schema of base_fcu_bus does not cover all of its members, regenerate the schema");
+
+constexpr SchemaField base_tcas_bus_fields[] = {
+    SCHEMA_FIELD(base_tcas_bus, sensitivity_level),
+    SCHEMA_FIELD(base_tcas_bus, vertical_resolution_advisory),
+};
+
+static_assert(SCHEMA_FIELD_END(base_tcas_bus, sensitivity_level, alignof(decltype(base_tcas_bus::vertical_resolution_advisory))) == offsetof(base_tcas_bus, vertical_resolution_advisory) &&
+              SCHEMA_FIELD_END(base_tcas_bus, vertical_resolution_advisory, alignof(base_tcas_bus)) == sizeof(base_tcas_bus),
+              "schema of base_tcas_bus does not cover all of its members, regenerate the schema");
+
+constexpr SchemaField base_fmgc_bus_inputs_fields[] = {
+    SCHEMA_FIELD(base_fmgc_bus_inputs, fac_opp_bus),
+    SCHEMA_FIELD(base_fmgc_bus_inputs, fac_own_bus),
+    SCHEMA_FIELD(base_fmgc_bus_inputs, adr_3_bus),
+    SCHEMA_FIELD(base_fmgc_bus_inputs, ir_3_bus),
+    SCHEMA_FIELD(base_fmgc_bus_inputs, adr_opp_bus),
+    SCHEMA_FIELD(base_fmgc_bus_inputs, ir_opp_bus),
+    SCHEMA_FIELD(base_fmgc_bus_inputs, adr_own_bus),
+    SCHEMA_FIELD(base_fmgc_bus_inputs, ir_own_bus),
+    SCHEMA_FIELD(base_fmgc_bus_inputs, fadec_opp_bus),
+    SCHEMA_FIELD(base_fmgc_bus_inputs, fadec_own_bus),
+    SCHEMA_FIELD(base_fmgc_bus_inputs, ra_opp_bus),
+    SCHEMA_FIELD(base_fmgc_bus_inputs, ra_own_bus),
+    SCHEMA_FIELD(base_fmgc_bus_inputs, ils_opp_bus),
+    SCHEMA_FIELD(base_fmgc_bus_inputs, ils_own_bus),
+    SCHEMA_FIELD(base_fmgc_bus_inputs, fmgc_opp_bus),
+    SCHEMA_FIELD(base_fmgc_bus_inputs, fcu_bus),
+    SCHEMA_FIELD(base_fmgc_bus_inputs, tcas_bus),
+};
+
+static_assert(SCHEMA_FIELD_END(base_fmgc_bus_inputs, fac_opp_bus, alignof(decltype(base_fmgc_bus_inputs::fac_own_bus))) == offsetof(base_fmgc_bus_inputs, fac_own_bus) &&
+              SCHEMA_FIELD_END(base_fmgc_bus_inputs, fac_own_bus, alignof(decltype(base_fmgc_bus_inputs::adr_3_bus))) == offsetof(base_fmgc_bus_inputs, adr_3_bus) &&
+              SCHEMA_FIELD_END(base_fmgc_bus_inputs, adr_3_bus, alignof(decltype(base_fmgc_bus_inputs::ir_3_bus))) == offsetof(base_fmgc_bus_inputs, ir_3_bus) &&
+              SCHEMA_FIELD_END(base_fmgc_bus_inputs, ir_3_bus, alignof(decltype(base_fmgc_bus_inputs::adr_opp_bus))) == offsetof(base_fmgc_bus_inputs, adr_opp_bus) &&
+              SCHEMA_FIELD_END(base_fmgc_bus_inputs, adr_opp_bus, alignof(decltype(base_fmgc_bus_inputs::ir_opp_bus))) == offsetof(base_fmgc_bus_inputs, ir_opp_bus) &&
+              SCHEMA_FIELD_END(base_fmgc_bus_inputs, ir_opp_bus, alignof(decltype(base_fmgc_bus_inputs::adr_own_bus))) == offsetof(base_fmgc_bus_inputs, adr_own_bus) &&
+              SCHEMA_FIELD_END(base_fmgc_bus_inputs, adr_own_bus, alignof(decltype(base_fmgc_bus_inputs::ir_own_bus))) == offsetof(base_fmgc_bus_inputs, ir_own_bus) &&
+              SCHEMA_FIELD_END(base_fmgc_bus_inputs, ir_own_bus, alignof(decltype(base_fmgc_bus_inputs::fadec_opp_bus))) == offsetof(base_fmgc_bus_inputs, fadec_opp_bus) &&
+              SCHEMA_FIELD_END(base_fmgc_bus_inputs, fadec_opp_bus, alignof(decltype(base_fmgc_bus_inputs::fadec_own_bus))) == offsetof(base_fmgc_bus_inputs, fadec_own_bus) &&
+              SCHEMA_FIELD_END(base_fmgc_bus_inputs, fadec_own_bus, alignof(decltype(base_fmgc_bus_inputs::ra_opp_bus))) == offsetof(base_fmgc_bus_inputs, ra_opp_bus) &&
+              SCHEMA_FIELD_END(base_fmgc_bus_inputs, ra_opp_bus, alignof(decltype(base_fmgc_bus_inputs::ra_own_bus))) == offsetof(base_fmgc_bus_inputs, ra_own_bus) &&
+              SCHEMA_FIELD_END(base_fmgc_bus_inputs, ra_own_bus, alignof(decltype(base_fmgc_bus_inputs::ils_opp_bus))) == offsetof(base_fmgc_bus_inputs, ils_opp_bus) &&
+              SCHEMA_FIELD_END(base_fmgc_bus_inputs, ils_opp_bus, alignof(decltype(base_fmgc_bus_inputs::ils_own_bus))) == offsetof(base_fmgc_bus_inputs, ils_own_bus) &&
+              SCHEMA_FIELD_END(base_fmgc_bus_inputs, ils_own_bus, alignof(decltype(base_fmgc_bus_inputs::fmgc_opp_bus))) == offsetof(base_fmgc_bus_inputs, fmgc_opp_bus) &&
+              SCHEMA_FIELD_END(base_fmgc_bus_inputs, fmgc_opp_bus, alignof(decltype(base_fmgc_bus_inputs::fcu_bus))) == offsetof(base_fmgc_bus_inputs, fcu_bus) &&
+              SCHEMA_FIELD_END(base_fmgc_bus_inputs, fcu_bus, alignof(decltype(base_fmgc_bus_inputs::tcas_bus))) == offsetof(base_fmgc_bus_inputs, tcas_bus) &&
+              SCHEMA_FIELD_END(base_fmgc_bus_inputs, tcas_bus, alignof(base_fmgc_bus_inputs)) == sizeof(base_fmgc_bus_inputs),
+              "schema of base_fmgc_bus_inputs does not cover all of its members, regenerate the schema");
+
+constexpr SchemaField base_fmgc_discrete_inputs_fields[] = {
+    SCHEMA_FIELD(base_fmgc_discrete_inputs, is_unit_1),
+    SCHEMA_FIELD(base_fmgc_discrete_inputs, athr_opp_engaged),
+    SCHEMA_FIELD(base_fmgc_discrete_inputs, fcu_athr_button),
+    SCHEMA_FIELD(base_fmgc_discrete_inputs, athr_instinctive_disc),
+    SCHEMA_FIELD(base_fmgc_discrete_inputs, fd_opp_engaged),
+    SCHEMA_FIELD(base_fmgc_discrete_inputs, ap_opp_engaged),
+    SCHEMA_FIELD(base_fmgc_discrete_inputs, fcu_ap_button),
+    SCHEMA_FIELD(base_fmgc_discrete_inputs, ap_instinctive_disc),
+    SCHEMA_FIELD(base_fmgc_discrete_inputs, powersupply_split),
+    SCHEMA_FIELD(base_fmgc_discrete_inputs, fcu_opp_healthy),
+    SCHEMA_FIELD(base_fmgc_discrete_inputs, fcu_own_healthy),
+    SCHEMA_FIELD(base_fmgc_discrete_inputs, fac_opp_healthy),
+    SCHEMA_FIELD(base_fmgc_discrete_inputs, fac_own_healthy),
+    SCHEMA_FIELD(base_fmgc_discrete_inputs, fmgc_opp_healthy),
+    SCHEMA_FIELD(base_fmgc_discrete_inputs, mcdu_opp_fail),
+    SCHEMA_FIELD(base_fmgc_discrete_inputs, mcdu_own_fail),
+    SCHEMA_FIELD(base_fmgc_discrete_inputs, nav_control_opp),
+    SCHEMA_FIELD(base_fmgc_discrete_inputs, nav_control_own),
+    SCHEMA_FIELD(base_fmgc_discrete_inputs, fwc_opp_valid),
+    SCHEMA_FIELD(base_fmgc_discrete_inputs, fwc_own_valid),
+    SCHEMA_FIELD(base_fmgc_discrete_inputs, pfd_opp_valid),
+    SCHEMA_FIELD(base_fmgc_discrete_inputs, pfd_own_valid),
+    SCHEMA_FIELD(base_fmgc_discrete_inputs, adc_3_switch),
+    SCHEMA_FIELD(base_fmgc_discrete_inputs, att_3_switch),
+    SCHEMA_FIELD(base_fmgc_discrete_inputs, left_wheel_spd_abv_70_kts),
+    SCHEMA_FIELD(base_fmgc_discrete_inputs, right_wheel_spd_abv_70_kts),
+    SCHEMA_FIELD(base_fmgc_discrete_inputs, bscu_opp_valid),
+    SCHEMA_FIELD(base_fmgc_discrete_inputs, bscu_own_valid),
+    SCHEMA_FIELD(base_fmgc_discrete_inputs, nose_gear_pressed_opp),
+    SCHEMA_FIELD(base_fmgc_discrete_inputs, nose_gear_pressed_own),
+    SCHEMA_FIELD(base_fmgc_discrete_inputs, elac_opp_ap_disc),
+    SCHEMA_FIELD(base_fmgc_discrete_inputs, elac_own_ap_disc),
+    SCHEMA_FIELD(base_fmgc_discrete_inputs, eng_opp_stop),
+    SCHEMA_FIELD(base_fmgc_discrete_inputs, eng_own_stop),
+    SCHEMA_FIELD(base_fmgc_discrete_inputs, tcas_ta_display),
+};
+
+static_assert(SCHEMA_FIELD_END(base_fmgc_discrete_inputs, is_unit_1, alignof(decltype(base_fmgc_discrete_inputs::athr_opp_engaged))) == offsetof(base_fmgc_discrete_inputs, athr_opp_engaged) &&
+              SCHEMA_FIELD_END(base_fmgc_discrete_inputs, athr_opp_engaged, alignof(decltype(base_fmgc_discrete_inputs::fcu_athr_button))) == offsetof(base_fmgc_discrete_inputs, fcu_athr_button) &&
+              SCHEMA_FIELD_END(base_fmgc_discrete_inputs, fcu_athr_button, alignof(decltype(base_fmgc_discrete_inputs::athr_instinctive_disc))) == offsetof(base_fmgc_discrete_inputs, athr_instinctive_disc) &&
+              SCHEMA_FIELD_END(base_fmgc_discrete_inputs, athr_instinctive_disc, alignof(decltype(base_fmgc_discrete_inputs::fd_opp_engaged))) == offsetof(base_fmgc_discrete_inputs, fd_opp_engaged) &&
+              SCHEMA_FIELD_END(base_fmgc_discrete_inputs, fd_opp_engaged, alignof(decltype(base_fmgc_discrete_inputs::ap_opp_engaged))) == offsetof(base_fmgc_discrete_inputs, ap_opp_engaged) &&
+              SCHEMA_FIELD_END(base_fmgc_discrete_inputs, ap_opp_engaged, alignof(decltype(base_fmgc_discrete_inputs::fcu_ap_button))) == offsetof(base_fmgc_discrete_inputs, fcu_ap_button) &&
+              SCHEMA_FIELD_END(base_fmgc_discrete_inputs, fcu_ap_button, alignof(decltype(base_fmgc_discrete_inputs::ap_instinctive_disc))) == offsetof(base_fmgc_discrete_inputs, ap_instinctive_disc) &&
+              SCHEMA_FIELD_END(base_fmgc_discrete_inputs, ap_instinctive_disc, alignof(decltype(base_fmgc_discrete_inputs::powersupply_split))) == offsetof(base_fmgc_discrete_inputs, powersupply_split) &&
+              SCHEMA_FIELD_END(base_fmgc_discrete_inputs, powersupply_split, alignof(decltype(base_fmgc_discrete_inputs::fcu_opp_healthy))) == offsetof(base_fmgc_discrete_inputs, fcu_opp_healthy) &&
+              SCHEMA_FIELD_END(base_fmgc_discrete_inputs, fcu_opp_healthy, alignof(decltype(base_fmgc_discrete_inputs::fcu_own_healthy))) == offsetof(base_fmgc_discrete_inputs, fcu_own_healthy) &&
+              SCHEMA_FIELD_END(base_fmgc_discrete_inputs, fcu_own_healthy, alignof(decltype(base_fmgc_discrete_inputs::fac_opp_healthy))) == offsetof(base_fmgc_discrete_inputs, fac_opp_healthy) &&
+              SCHEMA_FIELD_END(base_fmgc_discrete_inputs, fac_opp_healthy, alignof(decltype(base_fmgc_discrete_inputs::fac_own_healthy))) == offsetof(base_fmgc_discrete_inputs, fac_own_healthy) &&
+              SCHEMA_FIELD_END(base_fmgc_discrete_inputs, fac_own_healthy, alignof(decltype(base_fmgc_discrete_inputs::fmgc_opp_healthy))) == offsetof(base_fmgc_discrete_inputs, fmgc_opp_healthy) &&
+              SCHEMA_FIELD_END(base_fmgc_discrete_inputs, fmgc_opp_healthy, alignof(decltype(base_fmgc_discrete_inputs::mcdu_opp_fail))) == offsetof(base_fmgc_discrete_inputs, mcdu_opp_fail) &&
+              SCHEMA_FIELD_END(base_fmgc_discrete_inputs, mcdu_opp_fail, alignof(decltype(base_fmgc_discrete_inputs::mcdu_own_fail))) == offsetof(base_fmgc_discrete_inputs, mcdu_own_fail) &&
+              SCHEMA_FIELD_END(base_fmgc_discrete_inputs, mcdu_own_fail, alignof(decltype(base_fmgc_discrete_inputs::nav_control_opp))) == offsetof(base_fmgc_discrete_inputs, nav_control_opp) &&
+              SCHEMA_FIELD_END(base_fmgc_discrete_inputs, nav_control_opp, alignof(decltype(base_fmgc_discrete_inputs::nav_control_own))) == offsetof(base_fmgc_discrete_inputs, nav_control_own) &&
+              SCHEMA_FIELD_END(base_fmgc_discrete_inputs, nav_control_own, alignof(decltype(base_fmgc_discrete_inputs::fwc_opp_valid))) == offsetof(base_fmgc_discrete_inputs, fwc_opp_valid) &&
+              SCHEMA_FIELD_END(base_fmgc_discrete_inputs, fwc_opp_valid, alignof(decltype(base_fmgc_discrete_inputs::fwc_own_valid))) == offsetof(base_fmgc_discrete_inputs, fwc_own_valid) &&
+              SCHEMA_FIELD_END(base_fmgc_discrete_inputs, fwc_own_valid, alignof(decltype(base_fmgc_discrete_inputs::pfd_opp_valid))) == offsetof(base_fmgc_discrete_inputs, pfd_opp_valid) &&
+              SCHEMA_FIELD_END(base_fmgc_discrete_inputs, pfd_opp_valid, alignof(decltype(base_fmgc_discrete_inputs::pfd_own_valid))) == offsetof(base_fmgc_discrete_inputs, pfd_own_valid) &&
+              SCHEMA_FIELD_END(base_fmgc_discrete_inputs, pfd_own_valid, alignof(decltype(base_fmgc_discrete_inputs::adc_3_switch))) == offsetof(base_fmgc_discrete_inputs, adc_3_switch) &&
+              SCHEMA_FIELD_END(base_fmgc_discrete_inputs, adc_3_switch, alignof(decltype(base_fmgc_discrete_inputs::att_3_switch))) == offsetof(base_fmgc_discrete_inputs, att_3_switch) &&
+              SCHEMA_FIELD_END(base_fmgc_discrete_inputs, att_3_switch, alignof(decltype(base_fmgc_discrete_inputs::left_wheel_spd_abv_70_kts))) == offsetof(base_fmgc_discrete_inputs, left_wheel_spd_abv_70_kts) &&
+              SCHEMA_FIELD_END(base_fmgc_discrete_inputs, left_wheel_spd_abv_70_kts, alignof(decltype(base_fmgc_discrete_inputs::right_wheel_spd_abv_70_kts))) == offsetof(base_fmgc_discrete_inputs, right_wheel_spd_abv_70_kts) &&
+              SCHEMA_FIELD_END(base_fmgc_discrete_inputs, right_wheel_spd_abv_70_kts, alignof(decltype(base_fmgc_discrete_inputs::bscu_opp_valid))) == offsetof(base_fmgc_discrete_inputs, bscu_opp_valid) &&
+              SCHEMA_FIELD_END(base_fmgc_discrete_inputs, bscu_opp_valid, alignof(decltype(base_fmgc_discrete_inputs::bscu_own_valid))) == offsetof(base_fmgc_discrete_inputs, bscu_own_valid) &&
+              SCHEMA_FIELD_END(base_fmgc_discrete_inputs, bscu_own_valid, alignof(decltype(base_fmgc_discrete_inputs::nose_gear_pressed_opp))) == offsetof(base_fmgc_discrete_inputs, nose_gear_pressed_opp) &&
+              SCHEMA_FIELD_END(base_fmgc_discrete_inputs, nose_gear_pressed_opp, alignof(decltype(base_fmgc_discrete_inputs::nose_gear_pressed_own))) == offsetof(base_fmgc_discrete_inputs, nose_gear_pressed_own) &&
+              SCHEMA_FIELD_END(base_fmgc_discrete_inputs, nose_gear_pressed_own, alignof(decltype(base_fmgc_discrete_inputs::elac_opp_ap_disc))) == offsetof(base_fmgc_discrete_inputs, elac_opp_ap_disc) &&
+              SCHEMA_FIELD_END(base_fmgc_discrete_inputs, elac_opp_ap_disc, alignof(decltype(base_fmgc_discrete_inputs::elac_own_ap_disc))) == offsetof(base_fmgc_discrete_inputs, elac_own_ap_disc) &&
+              SCHEMA_FIELD_END(base_fmgc_discrete_inputs, elac_own_ap_disc, alignof(decltype(base_fmgc_discrete_inputs::eng_opp_stop))) == offsetof(base_fmgc_discrete_inputs, eng_opp_stop) &&
+              SCHEMA_FIELD_END(base_fmgc_discrete_inputs, eng_opp_stop, alignof(decltype(base_fmgc_discrete_inputs::eng_own_stop))) == offsetof(base_fmgc_discrete_inputs, eng_own_stop) &&
+              SCHEMA_FIELD_END(base_fmgc_discrete_inputs, eng_own_stop, alignof(decltype(base_fmgc_discrete_inputs::tcas_ta_display))) == offsetof(base_fmgc_discrete_inputs, tcas_ta_display) &&
+              SCHEMA_FIELD_END(base_fmgc_discrete_inputs, tcas_ta_display, alignof(base_fmgc_discrete_inputs)) == sizeof(base_fmgc_discrete_inputs),
+              "schema of base_fmgc_discrete_inputs does not cover all of its members, regenerate the schema");
+
+constexpr SchemaField base_fms_inputs_fields[] = {
+    SCHEMA_FIELD(base_fms_inputs, fm_valid),
+    SCHEMA_FIELD(base_fms_inputs, fms_flight_phase),
+    SCHEMA_FIELD(base_fms_inputs, selected_approach_type),
+    SCHEMA_FIELD(base_fms_inputs, backbeam_selected),
+    SCHEMA_FIELD(base_fms_inputs, fms_loc_distance),
+    SCHEMA_FIELD(base_fms_inputs, fms_unrealistic_gs_angle_deg),
+    SCHEMA_FIELD(base_fms_inputs, fms_weight_lbs),
+    SCHEMA_FIELD(base_fms_inputs, fms_cg_percent),
+    SCHEMA_FIELD(base_fms_inputs, lateral_flight_plan_valid),
+    SCHEMA_FIELD(base_fms_inputs, nav_capture_condition),
+    SCHEMA_FIELD(base_fms_inputs, phi_c_deg),
+    SCHEMA_FIELD(base_fms_inputs, xtk_nmi),
+    SCHEMA_FIELD(base_fms_inputs, tke_deg),
+    SCHEMA_FIELD(base_fms_inputs, phi_limit_deg),
+    SCHEMA_FIELD(base_fms_inputs, direct_to_nav_engage),
+    SCHEMA_FIELD(base_fms_inputs, vertical_flight_plan_valid),
+    SCHEMA_FIELD(base_fms_inputs, final_app_can_engage),
+    SCHEMA_FIELD(base_fms_inputs, next_alt_cstr_ft),
+    SCHEMA_FIELD(base_fms_inputs, requested_des_submode),
+    SCHEMA_FIELD(base_fms_inputs, alt_profile_tgt_ft),
+    SCHEMA_FIELD(base_fms_inputs, vs_target_ft_min),
+    SCHEMA_FIELD(base_fms_inputs, v_2_kts),
+    SCHEMA_FIELD(base_fms_inputs, v_app_kts),
+    SCHEMA_FIELD(base_fms_inputs, v_managed_kts),
+    SCHEMA_FIELD(base_fms_inputs, v_upper_margin_kts),
+    SCHEMA_FIELD(base_fms_inputs, v_lower_margin_kts),
+    SCHEMA_FIELD(base_fms_inputs, show_speed_margins),
+    SCHEMA_FIELD(base_fms_inputs, preset_spd_kts),
+    SCHEMA_FIELD(base_fms_inputs, preset_mach),
+    SCHEMA_FIELD(base_fms_inputs, preset_spd_mach_activate),
+    SCHEMA_FIELD(base_fms_inputs, fms_spd_mode_activate),
+    SCHEMA_FIELD(base_fms_inputs, fms_mach_mode_activate),
+    SCHEMA_FIELD(base_fms_inputs, flex_temp_deg_c),
+    SCHEMA_FIELD(base_fms_inputs, acceleration_alt_ft),
+    SCHEMA_FIELD(base_fms_inputs, acceleration_alt_eo_ft),
+    SCHEMA_FIELD(base_fms_inputs, thrust_reduction_alt_ft),
+    SCHEMA_FIELD(base_fms_inputs, cruise_alt_ft),
+};
+
+static_assert(SCHEMA_FIELD_END(base_fms_inputs, fm_valid, alignof(decltype(base_fms_inputs::fms_flight_phase))) == offsetof(base_fms_inputs, fms_flight_phase) &&
+              SCHEMA_FIELD_END(base_fms_inputs, fms_flight_phase, alignof(decltype(base_fms_inputs::selected_approach_type))) == offsetof(base_fms_inputs, selected_approach_type) &&
+              SCHEMA_FIELD_END(base_fms_inputs, selected_approach_type, alignof(decltype(base_fms_inputs::backbeam_selected))) == offsetof(base_fms_inputs, backbeam_selected) &&
+              SCHEMA_FIELD_END(base_fms_inputs, backbeam_selected, alignof(decltype(base_fms_inputs::fms_loc_distance))) == offsetof(base_fms_inputs, fms_loc_distance) &&
+              SCHEMA_FIELD_END(base_fms_inputs, fms_loc_distance, alignof(decltype(base_fms_inputs::fms_unrealistic_gs_angle_deg))) == offsetof(base_fms_inputs, fms_unrealistic_gs_angle_deg) &&
+              SCHEMA_FIELD_END(base_fms_inputs, fms_unrealistic_gs_angle_deg, alignof(decltype(base_fms_inputs::fms_weight_lbs))) == offsetof(base_fms_inputs, fms_weight_lbs) &&
+              SCHEMA_FIELD_END(base_fms_inputs, fms_weight_lbs, alignof(decltype(base_fms_inputs::fms_cg_percent))) == offsetof(base_fms_inputs, fms_cg_percent) &&
+              SCHEMA_FIELD_END(base_fms_inputs, fms_cg_percent, alignof(decltype(base_fms_inputs::lateral_flight_plan_valid))) == offsetof(base_fms_inputs, lateral_flight_plan_valid) &&
+              SCHEMA_FIELD_END(base_fms_inputs, lateral_flight_plan_valid, alignof(decltype(base_fms_inputs::nav_capture_condition))) == offsetof(base_fms_inputs, nav_capture_condition) &&
+              SCHEMA_FIELD_END(base_fms_inputs, nav_capture_condition, alignof(decltype(base_fms_inputs::phi_c_deg))) == offsetof(base_fms_inputs, phi_c_deg) &&
+              SCHEMA_FIELD_END(base_fms_inputs, phi_c_deg, alignof(decltype(base_fms_inputs::xtk_nmi))) == offsetof(base_fms_inputs, xtk_nmi) &&
+              SCHEMA_FIELD_END(base_fms_inputs, xtk_nmi, alignof(decltype(base_fms_inputs::tke_deg))) == offsetof(base_fms_inputs, tke_deg) &&
+              SCHEMA_FIELD_END(base_fms_inputs, tke_deg, alignof(decltype(base_fms_inputs::phi_limit_deg))) == offsetof(base_fms_inputs, phi_limit_deg) &&
+              SCHEMA_FIELD_END(base_fms_inputs, phi_limit_deg, alignof(decltype(base_fms_inputs::direct_to_nav_engage))) == offsetof(base_fms_inputs, direct_to_nav_engage) &&
+              SCHEMA_FIELD_END(base_fms_inputs, direct_to_nav_engage, alignof(decltype(base_fms_inputs::vertical_flight_plan_valid))) == offsetof(base_fms_inputs, vertical_flight_plan_valid) &&
+              SCHEMA_FIELD_END(base_fms_inputs, vertical_flight_plan_valid, alignof(decltype(base_fms_inputs::final_app_can_engage))) == offsetof(base_fms_inputs, final_app_can_engage) &&
+              SCHEMA_FIELD_END(base_fms_inputs, final_app_can_engage, alignof(decltype(base_fms_inputs::next_alt_cstr_ft))) == offsetof(base_fms_inputs, next_alt_cstr_ft) &&
+              SCHEMA_FIELD_END(base_fms_inputs, next_alt_cstr_ft, alignof(decltype(base_fms_inputs::requested_des_submode))) == offsetof(base_fms_inputs, requested_des_submode) &&
+              SCHEMA_FIELD_END(base_fms_inputs, requested_des_submode, alignof(decltype(base_fms_inputs::alt_profile_tgt_ft))) == offsetof(base_fms_inputs, alt_profile_tgt_ft) &&
+              SCHEMA_FIELD_END(base_fms_inputs, alt_profile_tgt_ft, alignof(decltype(base_fms_inputs::vs_target_ft_min))) == offsetof(base_fms_inputs, vs_target_ft_min) &&
+              SCHEMA_FIELD_END(base_fms_inputs, vs_target_ft_min, alignof(decltype(base_fms_inputs::v_2_kts))) == offsetof(base_fms_inputs, v_2_kts) &&
+              SCHEMA_FIELD_END(base_fms_inputs, v_2_kts, alignof(decltype(base_fms_inputs::v_app_kts))) == offsetof(base_fms_inputs, v_app_kts) &&
+              SCHEMA_FIELD_END(base_fms_inputs, v_app_kts, alignof(decltype(base_fms_inputs::v_managed_kts))) == offsetof(base_fms_inputs, v_managed_kts) &&
+              SCHEMA_FIELD_END(base_fms_inputs, v_managed_kts, alignof(decltype(base_fms_inputs::v_upper_margin_kts))) == offsetof(base_fms_inputs, v_upper_margin_kts) &&
+              SCHEMA_FIELD_END(base_fms_inputs, v_upper_margin_kts, alignof(decltype(base_fms_inputs::v_lower_margin_kts))) == offsetof(base_fms_inputs, v_lower_margin_kts) &&
+              SCHEMA_FIELD_END(base_fms_inputs, v_lower_margin_kts, alignof(decltype(base_fms_inputs::show_speed_margins))) == offsetof(base_fms_inputs, show_speed_margins) &&
+              SCHEMA_FIELD_END(base_fms_inputs, show_speed_margins, alignof(decltype(base_fms_inputs::preset_spd_kts))) == offsetof(base_fms_inputs, preset_spd_kts) &&
+              SCHEMA_FIELD_END(base_fms_inputs, preset_spd_kts, alignof(decltype(base_fms_inputs::preset_mach))) == offsetof(base_fms_inputs, preset_mach) &&
+              SCHEMA_FIELD_END(base_fms_inputs, preset_mach, alignof(decltype(base_fms_inputs::preset_spd_mach_activate))) == offsetof(base_fms_inputs, preset_spd_mach_activate) &&
+              SCHEMA_FIELD_END(base_fms_inputs, preset_spd_mach_activate, alignof(decltype(base_fms_inputs::fms_spd_mode_activate))) == offsetof(base_fms_inputs, fms_spd_mode_activate) &&
+              SCHEMA_FIELD_END(base_fms_inputs, fms_spd_mode_activate, alignof(decltype(base_fms_inputs::fms_mach_mode_activate))) == offsetof(base_fms_inputs, fms_mach_mode_activate) &&
+              SCHEMA_FIELD_END(base_fms_inputs, fms_mach_mode_activate, alignof(decltype(base_fms_inputs::flex_temp_deg_c))) == offsetof(base_fms_inputs, flex_temp_deg_c) &&
+              SCHEMA_FIELD_END(base_fms_inputs, flex_temp_deg_c, alignof(decltype(base_fms_inputs::acceleration_alt_ft))) == offsetof(base_fms_inputs, acceleration_alt_ft) &&
+              SCHEMA_FIELD_END(base_fms_inputs, acceleration_alt_ft, alignof(decltype(base_fms_inputs::acceleration_alt_eo_ft))) == offsetof(base_fms_inputs, acceleration_alt_eo_ft) &&
+              SCHEMA_FIELD_END(base_fms_inputs, acceleration_alt_eo_ft, alignof(decltype(base_fms_inputs::thrust_reduction_alt_ft))) == offsetof(base_fms_inputs, thrust_reduction_alt_ft) &&
+              SCHEMA_FIELD_END(base_fms_inputs, thrust_reduction_alt_ft, alignof(decltype(base_fms_inputs::cruise_alt_ft))) == offsetof(base_fms_inputs, cruise_alt_ft) &&
+              SCHEMA_FIELD_END(base_fms_inputs, cruise_alt_ft, alignof(base_fms_inputs)) == sizeof(base_fms_inputs),
+              "schema of base_fms_inputs does not cover all of its members, regenerate the schema");
+
+constexpr SchemaField athr_output_fields[] = {
+    SCHEMA_FIELD(athr_output, sim_throttle_lever_pos),
+    SCHEMA_FIELD(athr_output, sim_thrust_mode),
+    SCHEMA_FIELD(athr_output, N1_TLA_percent),
+    SCHEMA_FIELD(athr_output, is_in_reverse),
+    SCHEMA_FIELD(athr_output, thrust_limit_type),
+    SCHEMA_FIELD(athr_output, thrust_limit_percent),
+    SCHEMA_FIELD(athr_output, N1_c_percent),
+    SCHEMA_FIELD(athr_output, athr_control_active),
+    SCHEMA_FIELD(athr_output, memo_thrust_active),
+};
+
+static_assert(SCHEMA_FIELD_END(athr_output, sim_throttle_lever_pos, alignof(decltype(athr_output::sim_thrust_mode))) == offsetof(athr_output, sim_thrust_mode) &&
+              SCHEMA_FIELD_END(athr_output, sim_thrust_mode, alignof(decltype(athr_output::N1_TLA_percent))) == offsetof(athr_output, N1_TLA_percent) &&
+              SCHEMA_FIELD_END(athr_output, N1_TLA_percent, alignof(decltype(athr_output::is_in_reverse))) == offsetof(athr_output, is_in_reverse) &&
+              SCHEMA_FIELD_END(athr_output, is_in_reverse, alignof(decltype(athr_output::thrust_limit_type))) == offsetof(athr_output, thrust_limit_type) &&
+              SCHEMA_FIELD_END(athr_output, thrust_limit_type, alignof(decltype(athr_output::thrust_limit_percent))) == offsetof(athr_output, thrust_limit_percent) &&
+              SCHEMA_FIELD_END(athr_output, thrust_limit_percent, alignof(decltype(athr_output::N1_c_percent))) == offsetof(athr_output, N1_c_percent) &&
+              SCHEMA_FIELD_END(athr_output, N1_c_percent, alignof(decltype(athr_output::athr_control_active))) == offsetof(athr_output, athr_control_active) &&
+              SCHEMA_FIELD_END(athr_output, athr_control_active, alignof(decltype(athr_output::memo_thrust_active))) == offsetof(athr_output, memo_thrust_active) &&
+              SCHEMA_FIELD_END(athr_output, memo_thrust_active, alignof(athr_output)) == sizeof(athr_output),
+              "schema of athr_output does not cover all of its members, regenerate the schema");
+
+constexpr SchemaType TYPES[] = {
+    SCHEMA_TYPE(BaseData),
+    SCHEMA_TYPE(AircraftSpecificData),
+    SCHEMA_TYPE(SampledChannels),
+    SCHEMA_TYPE(base_arinc_429),
+    SCHEMA_TYPE(base_elac_out_bus),
+    SCHEMA_TYPE(base_elac_discrete_outputs),
+    SCHEMA_TYPE(base_elac_analog_outputs),
+    SCHEMA_TYPE(base_sec_out_bus),
+    SCHEMA_TYPE(base_sec_discrete_outputs),
+    SCHEMA_TYPE(base_sec_analog_outputs),
+    SCHEMA_TYPE(base_fac_bus),
+    SCHEMA_TYPE(base_fac_discrete_outputs),
+    SCHEMA_TYPE(base_fac_analog_outputs),
+    SCHEMA_TYPE(base_adr_bus),
+    SCHEMA_TYPE(base_ir_bus),
+    SCHEMA_TYPE(base_ra_bus),
+    SCHEMA_TYPE(base_ils_bus),
+    SCHEMA_TYPE(base_fmgc_logic_outputs),
+    SCHEMA_TYPE(base_fmgc_lateral_modes),
+    SCHEMA_TYPE(base_fmgc_longitudinal_modes),
+    SCHEMA_TYPE(base_fmgc_armed_modes),
+    SCHEMA_TYPE(base_fmgc_ap_fd_logic_outputs),
+    SCHEMA_TYPE(ap_raw_output_command),
+    SCHEMA_TYPE(ap_raw_laws_flare),
+    SCHEMA_TYPE(ap_raw_output),
+    SCHEMA_TYPE(base_fmgc_athr_outputs),
+    SCHEMA_TYPE(base_fmgc_discrete_outputs),
+    SCHEMA_TYPE(base_fmgc_a_bus),
+    SCHEMA_TYPE(base_fmgc_b_bus),
+    SCHEMA_TYPE(base_fmgc_bus_outputs),
+    SCHEMA_TYPE(base_ecu_bus),
+    SCHEMA_TYPE(base_fcu_bus),
+    SCHEMA_TYPE(base_tcas_bus),
+    SCHEMA_TYPE(base_fmgc_bus_inputs),
+    SCHEMA_TYPE(base_fmgc_discrete_inputs),
+    SCHEMA_TYPE(base_fms_inputs),
+    SCHEMA_TYPE(athr_output),
+};
+
+}  // namespace fdr_schema
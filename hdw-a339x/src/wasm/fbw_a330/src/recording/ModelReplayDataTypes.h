@@ -0,0 +1,62 @@
+#pragma once
+
+#include "../elac/Elac.h"
+#include "../fac/Fac.h"
+#include "../fmgc/Fmgc.h"
+#include "../model/FadecComputer.h"
+#include "../sec/Sec.h"
+
+// Inputs of the computers as they were handed to the wrappers, together with the resulting outputs. This allows to step
+// the computers offline and to compare the outputs bit by bit (see host/src/ReplayBench.cpp).
+
+struct ModelReplayUpdate {
+  double deltaTime;
+  double simulationTime;
+  bool updated;
+  bool faultActive;
+  bool isPowered;
+};
+
+struct ElacReplayData {
+  ModelReplayUpdate update;
+  ElacComputer::ExternalInputs_ElacComputer_T inputs;
+  base_elac_out_bus busOutputs;
+  base_elac_discrete_outputs discreteOutputs;
+  base_elac_analog_outputs analogOutputs;
+};
+
+struct SecReplayData {
+  ModelReplayUpdate update;
+  SecComputer::ExternalInputs_SecComputer_T inputs;
+  base_sec_out_bus busOutputs;
+  base_sec_discrete_outputs discreteOutputs;
+  base_sec_analog_outputs analogOutputs;
+};
+
+struct FacReplayData {
+  ModelReplayUpdate update;
+  FacComputer::ExternalInputs_FacComputer_T inputs;
+  base_fac_bus busOutputs;
+  base_fac_discrete_outputs discreteOutputs;
+  base_fac_analog_outputs analogOutputs;
+};
+
+struct FmgcReplayData {
+  ModelReplayUpdate update;
+  FmgcComputer::ExternalInputs_FmgcComputer_T inputs;
+  fmgc_outputs outputs;
+};
+
+struct FadecReplayData {
+  ModelReplayUpdate update;
+  FadecComputer::ExternalInputs_FadecComputer_T inputs;
+  athr_out outputs;
+};
+
+struct ModelReplayFrame {
+  ElacReplayData elacs[2];
+  SecReplayData secs[3];
+  FacReplayData facs[2];
+  FmgcReplayData fmgcs[2];
+  FadecReplayData fadecs[2];
+};
@@ -85,3 +85,14 @@ struct AircraftSpecificData {
   unsigned long long aircraft_settings_is_realistic_tiller_enabled;
   double aircraft_settings_any_failures_active;
 };
+
+// channels of the recording profile that were sampled in the frame, the members follow RecordingProfile::Channel
+struct SampledChannels {
+  bool specific;
+  bool elac;
+  bool sec;
+  bool fac;
+  bool fmgc;
+  bool fmgc_inputs;
+  bool fadec;
+};
@@ -0,0 +1,299 @@
+#include <dirent.h>
+#include <stdio.h>
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+#include "RecordingFileWriter.h"
+
+RecordingFileWriter::RecordingFileWriter(const std::string& extension, std::size_t slotCount) : extension(extension) {
+  slots.resize(slotCount);
+#ifdef RECORDING_FILE_WRITER_THREAD
+  worker = std::thread(&RecordingFileWriter::runWorker, this);
+#endif
+}
+
+RecordingFileWriter::~RecordingFileWriter() {
+  close();
+#ifdef RECORDING_FILE_WRITER_THREAD
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    stopRequested = true;
+  }
+  slotQueued.notify_all();
+  worker.join();
+#endif
+
+  if (blockStreamInitialized) {
+    deflateEnd(&blockStream);
+  }
+}
+
+void RecordingFileWriter::setHeader(const void* data, std::size_t size) {
+  header.assign(static_cast<const char*>(data), static_cast<const char*>(data) + size);
+}
+
+void RecordingFileWriter::setBlockFrameCount(std::size_t frameCount) {
+  // gzip wrapper, every block becomes a member of its own
+  if (frameCount > 0 && !blockStreamInitialized) {
+    deflateInit2(&blockStream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY);
+    deflateBuffer.resize(16384);
+    blockStreamInitialized = true;
+  }
+  blockFrameCount = frameCount;
+}
+
+void RecordingFileWriter::push(const void* data,
+                               std::size_t size,
+                               const std::string& newFilepath,
+                               int maximumFileCount,
+                               double timestamp) {
+  // the first frame defines the slot size, a larger frame grows the slots once the queued frames are written, so that no
+  // frame is dropped and no queued frame has to be moved
+  if (size > slotSize) {
+    if (slotSize > 0) {
+      std::cout << "WASM: Recording frame of " << size << " bytes exceeds slot size of " << slotSize << " bytes, growing slots" << std::endl;
+    }
+    waitUntilEmpty();
+    slotSize = size;
+    storage.resize(slotSize * slots.size());
+  }
+
+#ifdef RECORDING_FILE_WRITER_THREAD
+  std::unique_lock<std::mutex> lock(mutex);
+  if (count == slots.size()) {
+    overrunCount++;
+    slotFreed.wait(lock, [this] { return count < slots.size(); });
+  }
+  lock.unlock();
+#else
+  // ring is full -> write the oldest frame now
+  if (count == slots.size()) {
+    overrunCount++;
+    writeNextSlot();
+  }
+#endif
+
+  // the slot at the write index is owned by the producer until count is increased
+  Slot& slot = slots[writeIndex];
+  slot.size = size;
+  slot.newFilepath = newFilepath;
+  slot.maximumFileCount = maximumFileCount;
+  slot.timestamp = timestamp;
+  std::memcpy(storage.data() + writeIndex * slotSize, data, size);
+  writeIndex = (writeIndex + 1) % slots.size();
+
+#ifdef RECORDING_FILE_WRITER_THREAD
+  lock.lock();
+  count++;
+  lock.unlock();
+  slotQueued.notify_one();
+#else
+  count++;
+#endif
+}
+
+void RecordingFileWriter::drain([[maybe_unused]] std::chrono::microseconds budget) {
+#ifndef RECORDING_FILE_WRITER_THREAD
+  auto start = std::chrono::steady_clock::now();
+  while (count > 0 && std::chrono::steady_clock::now() - start < budget) {
+    writeNextStep();
+  }
+#endif
+}
+
+void RecordingFileWriter::close() {
+  waitUntilEmpty();
+  closeFile();
+}
+
+std::uint64_t RecordingFileWriter::getOverrunCount() const {
+  return overrunCount;
+}
+
+bool RecordingFileWriter::writeNextStep() {
+  // the slot at the read index is owned by the consumer until count is decreased
+  Slot& slot = slots[readIndex];
+  if (slot.newFilepath.empty()) {
+    nextStep = SlotStep::WriteFrame;
+  }
+
+  switch (nextStep) {
+    case SlotStep::CloseFile:
+      closeFile();
+      nextStep = SlotStep::OpenFile;
+      return false;
+    case SlotStep::OpenFile:
+      openFile(slot.newFilepath);
+      nextStep = SlotStep::CleanUpFiles;
+      return false;
+    case SlotStep::CleanUpFiles:
+      cleanUpFiles(slot.maximumFileCount);
+      nextStep = SlotStep::WriteFrame;
+      return false;
+    case SlotStep::WriteFrame:
+      break;
+  }
+
+  writeFrame(storage.data() + readIndex * slotSize, slot.size, slot.timestamp);
+  readIndex = (readIndex + 1) % slots.size();
+  nextStep = SlotStep::CloseFile;
+
+#ifdef RECORDING_FILE_WRITER_THREAD
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    count--;
+  }
+  slotFreed.notify_all();
+#else
+  count--;
+#endif
+
+  return true;
+}
+
+void RecordingFileWriter::writeNextSlot() {
+  while (!writeNextStep()) {
+  }
+}
+
+void RecordingFileWriter::waitUntilEmpty() {
+#ifdef RECORDING_FILE_WRITER_THREAD
+  std::unique_lock<std::mutex> lock(mutex);
+  slotFreed.wait(lock, [this] { return count == 0 && !writing; });
+#else
+  while (count > 0) {
+    writeNextSlot();
+  }
+#endif
+}
+
+void RecordingFileWriter::openFile(const std::string& filepath) {
+  closeFile();
+
+  if (blockFrameCount > 0) {
+    // the header of chunked containers is not compressed, so it can be read without inflating the first block
+    blockFileStream.open(filepath, std::ios::binary | std::ios::trunc);
+    blockFileStream.write(header.data(), header.size());
+    fileOffset = header.size();
+    framesInBlock = 0;
+    blockIndex.clear();
+  } else {
+    fileStream = std::make_shared<gzofstream>(filepath.c_str());
+    fileStream->write(header.data(), header.size());
+  }
+}
+
+void RecordingFileWriter::closeFile() {
+  if (blockFileStream.is_open()) {
+    finishBlock();
+    writeBlockIndex();
+    blockFileStream.close();
+  }
+
+  if (fileStream) {
+    fileStream->close();
+    fileStream.reset();
+  }
+}
+
+void RecordingFileWriter::writeFrame(const char* data, std::size_t size, double timestamp) {
+  // frames without an open file can only occur when a caller did not start a file after close()
+  if (blockFileStream.is_open()) {
+    if (framesInBlock == 0) {
+      blockIndex.push_back({timestamp, fileOffset, 0});
+    }
+    deflateToFile(data, size, Z_NO_FLUSH);
+    blockIndex.back().frameCount++;
+    if (++framesInBlock == blockFrameCount) {
+      finishBlock();
+    }
+  } else if (fileStream) {
+    fileStream->write(data, size);
+  }
+}
+
+void RecordingFileWriter::deflateToFile(const char* data, std::size_t size, int flush) {
+  blockStream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data));
+  blockStream.avail_in = static_cast<uInt>(size);
+  do {
+    blockStream.next_out = deflateBuffer.data();
+    blockStream.avail_out = static_cast<uInt>(deflateBuffer.size());
+    deflate(&blockStream, flush);
+    std::size_t compressedSize = deflateBuffer.size() - blockStream.avail_out;
+    blockFileStream.write(reinterpret_cast<const char*>(deflateBuffer.data()), compressedSize);
+    fileOffset += compressedSize;
+  } while (blockStream.avail_out == 0);
+}
+
+void RecordingFileWriter::finishBlock() {
+  if (framesInBlock == 0) {
+    return;
+  }
+
+  deflateToFile(nullptr, 0, Z_FINISH);
+  deflateReset(&blockStream);
+  framesInBlock = 0;
+}
+
+void RecordingFileWriter::writeBlockIndex() {
+  std::uint64_t trailer[3] = {fileOffset, blockIndex.size(), BLOCK_INDEX_MARKER};
+  blockFileStream.write(reinterpret_cast<const char*>(blockIndex.data()), blockIndex.size() * sizeof(BlockIndexEntry));
+  blockFileStream.write(reinterpret_cast<const char*>(trailer), sizeof(trailer));
+}
+
+void RecordingFileWriter::cleanUpFiles(int maximumFileCount) {
+  // std::vector for directory entries
+  std::vector<std::string> files;
+
+  // structure representing an directory entry
+  struct dirent* directoryEntry;
+
+  // open directory
+  DIR* directory = opendir("\\work");
+  if (directory == NULL) {
+    return;
+  }
+
+  // read directory until end
+  while ((directoryEntry = readdir(directory)) != NULL) {
+    // get filename as std::string
+    std::string filename = directoryEntry->d_name;
+
+    // check if file has right extension
+    if (filename.length() > extension.length() &&
+        filename.find(extension, (filename.length() - extension.length())) != std::string::npos) {
+      files.push_back(std::move(filename));
+    }
+  }
+
+  // close directory
+  closedir(directory);
+
+  // sort std::vector
+  std::sort(files.begin(), files.end(), std::greater<>());
+
+  // remove older files
+  while (files.size() > static_cast<std::size_t>(std::max(0, maximumFileCount))) {
+    remove(("\\work\\" + files.back()).c_str());
+    files.pop_back();
+  }
+}
+
+#ifdef RECORDING_FILE_WRITER_THREAD
+void RecordingFileWriter::runWorker() {
+  std::unique_lock<std::mutex> lock(mutex);
+  while (true) {
+    slotQueued.wait(lock, [this] { return count > 0 || stopRequested; });
+    if (count == 0 && stopRequested) {
+      return;
+    }
+    writing = true;
+    lock.unlock();
+    writeNextSlot();
+    lock.lock();
+    writing = false;
+    slotFreed.notify_all();
+  }
+}
+#endif
@@ -0,0 +1,165 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "zfstream.h"
+#include "zlib.h"
+
+// the wasm build has no threads, there the ring is drained in time slices from the gauge thread
+#ifndef _LIBCPP_HAS_NO_THREADS
+#define RECORDING_FILE_WRITER_THREAD
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
+
+/**
+ * @brief Writes fixed size frames to rotating gzip files without blocking the caller on compression or file I/O.
+ *
+ * Frames are copied into a preallocated ring of slots. The ring is written either by a worker thread or, on platforms
+ * without threads, by calling drain() with a time budget. Opening a new file, including the clean up of old files, is
+ * done by the writer as well. No frame is lost when the ring is full: with a worker, push() blocks until the worker has
+ * freed a slot, without one, push() writes the oldest slot synchronously.
+ *
+ * Without a worker, the work is split into steps that drain() runs one at a time: closing the current file, opening
+ * the next one, cleaning up old files and writing a frame. The budget is checked before every step, so a file rotation
+ * is spread over several calls, and frames that do not fit into the budget stay queued for the next call.
+ *
+ * With a block frame count set, files are written as chunked containers instead of a single gzip stream: the header is
+ * stored uncompressed, followed by independently compressed gzip members of block frame count frames each. On close, an
+ * index with the timestamp, file offset and frame count of every block and a trailer (index offset, number of blocks,
+ * BLOCK_INDEX_MARKER) are appended, so readers can seek directly to the block containing a given time.
+ */
+class RecordingFileWriter {
+ public:
+  // last value of the trailer of chunked containers ("FDRINDEX")
+  static constexpr std::uint64_t BLOCK_INDEX_MARKER = 0x5845444e49524446;
+
+  RecordingFileWriter(const std::string& extension, std::size_t slotCount);
+
+  ~RecordingFileWriter();
+
+  /**
+   * @brief Sets the data written at the beginning of every file.
+   */
+  void setHeader(const void* data, std::size_t size);
+
+  /**
+   * @brief Sets the number of frames per block of chunked containers, 0 writes a single gzip stream per file.
+   * @note Needs to be set before the first frame is queued.
+   */
+  void setBlockFrameCount(std::size_t frameCount);
+
+  /**
+   * @brief Queues a frame. The first frame defines the slot size, a larger frame first writes all queued frames and then
+   * grows the slots.
+   * @param newFilepath when not empty, the current file is closed and the frame starts the given file.
+   * @param maximumFileCount number of files with the extension to keep when a new file is started.
+   * @param timestamp time of the frame, used for the block index of chunked containers.
+   */
+  void push(const void* data, std::size_t size, const std::string& newFilepath, int maximumFileCount, double timestamp = 0.0);
+
+  /**
+   * @brief Runs the steps of writing the queued frames as long as the budget is not used up. No-op with a worker.
+   */
+  void drain(std::chrono::microseconds budget);
+
+  /**
+   * @brief Writes all queued frames and closes the file.
+   */
+  void close();
+
+  std::uint64_t getOverrunCount() const;
+
+ private:
+  struct Slot {
+    std::size_t size;
+    std::string newFilepath;
+    int maximumFileCount;
+    double timestamp;
+  };
+
+  // steps of writing a slot, the steps before WriteFrame are only done for slots that start a new file
+  enum class SlotStep { CloseFile, OpenFile, CleanUpFiles, WriteFrame };
+
+  struct BlockIndexEntry {
+    double timestamp;
+    std::uint64_t offset;
+    std::uint64_t frameCount;
+  };
+
+  const std::string extension;
+  std::vector<char> header;
+
+  std::vector<Slot> slots;
+  std::vector<char> storage;
+  std::size_t slotSize = 0;
+  std::size_t readIndex = 0;
+  std::size_t writeIndex = 0;
+  std::size_t count = 0;
+  std::uint64_t overrunCount = 0;
+  SlotStep nextStep = SlotStep::CloseFile;
+
+  std::shared_ptr<gzofstream> fileStream;
+
+  std::size_t blockFrameCount = 0;
+  std::size_t framesInBlock = 0;
+  std::uint64_t fileOffset = 0;
+  std::ofstream blockFileStream;
+  z_stream blockStream = {};
+  bool blockStreamInitialized = false;
+  std::vector<unsigned char> deflateBuffer;
+  std::vector<BlockIndexEntry> blockIndex;
+
+  /**
+   * @brief Runs the next step of writing the slot at the read index, the last step frees the slot.
+   * @return true if the slot was freed.
+   */
+  bool writeNextStep();
+
+  /**
+   * @brief Runs all remaining steps of writing the slot at the read index and frees it.
+   */
+  void writeNextSlot();
+
+  /**
+   * @brief Returns once all queued frames are written, without a worker they are written synchronously.
+   */
+  void waitUntilEmpty();
+
+  void openFile(const std::string& filepath);
+
+  void closeFile();
+
+  void writeFrame(const char* data, std::size_t size, double timestamp);
+
+  /**
+   * @brief Compresses the data into the current block and writes the compressed output to the file.
+   */
+  void deflateToFile(const char* data, std::size_t size, int flush);
+
+  /**
+   * @brief Finishes the gzip member of the current block, the next frame starts a new block.
+   */
+  void finishBlock();
+
+  void writeBlockIndex();
+
+  void cleanUpFiles(int maximumFileCount);
+
+#ifdef RECORDING_FILE_WRITER_THREAD
+  std::mutex mutex;
+  std::condition_variable slotQueued;
+  std::condition_variable slotFreed;
+  bool stopRequested = false;
+  bool writing = false;
+  std::thread worker;
+
+  void runWorker();
+#endif
+};
@@ -0,0 +1,122 @@
+#include "RecordingProfile.h"
+
+#include <cstdlib>
+#include <sstream>
+
+namespace {
+
+struct ProfileDefinition {
+  const char* name;
+  // sampling of the channels in the order of RecordingProfile::Channel, "off", "every_frame" or a rate in Hz
+  const char* samplings[RecordingProfile::CHANNEL_COUNT];
+};
+
+// clang-format off
+constexpr ProfileDefinition PROFILES[] = {
+    // name               SPECIFIC       ELAC           SEC            FAC            FMGC           FMGC_INPUTS    FADEC
+    {"full",            {"every_frame", "every_frame", "every_frame", "every_frame", "every_frame", "every_frame", "every_frame"}},
+    {"flight-controls", {"10",          "every_frame", "every_frame", "every_frame", "off",         "off",         "off"}},
+    {"autoflight",      {"10",          "10",          "off",         "10",          "every_frame", "5",           "1"}},
+    {"engines",         {"every_frame", "off",         "off",         "off",         "10",          "off",         "every_frame"}},
+};
+// clang-format on
+
+}  // namespace
+
+bool RecordingProfile::setProfile(const std::string& name) {
+  const ProfileDefinition* definition = &PROFILES[0];
+  for (const auto& profile : PROFILES) {
+    if (name == profile.name) {
+      definition = &profile;
+    }
+  }
+
+  profileName = definition->name;
+  for (int i = 0; i < CHANNEL_COUNT; i++) {
+    parseSampling(definition->samplings[i], samplings[i]);
+    overrides[i].clear();
+    nextSampleTimes[i] = 0;
+  }
+
+  return profileName == name;
+}
+
+const std::string& RecordingProfile::getProfileName() const {
+  return profileName;
+}
+
+bool RecordingProfile::setOverride(Channel channel, const std::string& value) {
+  if (!parseSampling(value, samplings[channel])) {
+    return false;
+  }
+  overrides[channel] = value;
+  return true;
+}
+
+const std::string& RecordingProfile::getOverride(Channel channel) const {
+  return overrides[channel];
+}
+
+std::string RecordingProfile::getDescription(Channel channel) const {
+  const Sampling& sampling = samplings[channel];
+  if (!sampling.recorded) {
+    return "off";
+  } else if (sampling.rate <= 0) {
+    return "every frame";
+  }
+
+  std::stringstream result;
+  result << sampling.rate << " Hz";
+  return result.str();
+}
+
+bool RecordingProfile::isRecorded(Channel channel) const {
+  return samplings[channel].recorded;
+}
+
+bool RecordingProfile::isDecimated() const {
+  for (const auto& sampling : samplings) {
+    if (sampling.recorded && sampling.rate > 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool RecordingProfile::isDue(Channel channel, double simulationTime) {
+  const Sampling& sampling = samplings[channel];
+  if (sampling.rate <= 0) {
+    return sampling.recorded;
+  }
+
+  // samples are spaced by the period on average, the sampling restarts when the simulation time jumps
+  double period = 1.0 / sampling.rate;
+  double& nextSampleTime = nextSampleTimes[channel];
+  if (simulationTime < nextSampleTime - period || simulationTime >= nextSampleTime + period) {
+    nextSampleTime = simulationTime;
+  }
+  if (simulationTime < nextSampleTime) {
+    return false;
+  }
+
+  nextSampleTime += period;
+  return true;
+}
+
+bool RecordingProfile::parseSampling(const std::string& value, Sampling& sampling) {
+  if (value == "off") {
+    sampling = {false, 0};
+    return true;
+  } else if (value == "every_frame") {
+    sampling = {true, 0};
+    return true;
+  }
+
+  char* end = nullptr;
+  double rate = std::strtod(value.c_str(), &end);
+  if (value.empty() || *end != '\0' || !(rate > 0)) {
+    return false;
+  }
+  sampling = {true, rate};
+  return true;
+}
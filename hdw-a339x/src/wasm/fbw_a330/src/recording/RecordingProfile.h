@@ -0,0 +1,66 @@
+#pragma once
+
+#include <string>
+
+/**
+ * @brief Selects the channels of the flight data recorder and the rate at which they are sampled.
+ *
+ * A profile defines the sampling of every channel, single channels can be overridden with "off", "every_frame" or a
+ * rate in Hz. Channels that are not due keep their last sample in the frame, so the layout of a file stays constant, a
+ * flag per channel in the frame tells new samples from held ones.
+ */
+class RecordingProfile {
+ public:
+  // the base data is always recorded with every frame as it carries the simulation time
+  enum Channel { SPECIFIC = 0, ELAC, SEC, FAC, FMGC, FMGC_INPUTS, FADEC, CHANNEL_COUNT };
+
+  // names of the channels in the configuration
+  static constexpr const char* CHANNEL_NAMES[CHANNEL_COUNT] = {"SPECIFIC", "ELAC", "SEC", "FAC", "FMGC", "FMGC_INPUTS", "FADEC"};
+
+  static constexpr const char* DEFAULT_PROFILE = "full";
+
+  /**
+   * @brief Applies the sampling of a profile (full, flight-controls, autoflight or engines) and clears the overrides.
+   * @return false if the profile is unknown, the full profile is used in that case.
+   */
+  bool setProfile(const std::string& name);
+
+  const std::string& getProfileName() const;
+
+  /**
+   * @brief Overrides the sampling of the profile for a channel.
+   * @return false if the value is invalid, the sampling of the profile is kept in that case.
+   */
+  bool setOverride(Channel channel, const std::string& value);
+
+  // empty if the channel uses the sampling of the profile
+  const std::string& getOverride(Channel channel) const;
+
+  std::string getDescription(Channel channel) const;
+
+  bool isRecorded(Channel channel) const;
+
+  /**
+   * @brief Returns true if a recorded channel is sampled at a rate instead of every frame.
+   */
+  bool isDecimated() const;
+
+  /**
+   * @brief Returns true if the channel needs to be sampled in the frame with the given simulation time.
+   */
+  bool isDue(Channel channel, double simulationTime);
+
+ private:
+  struct Sampling {
+    bool recorded;
+    // rate in Hz, zero samples every frame
+    double rate;
+  };
+
+  static bool parseSampling(const std::string& value, Sampling& sampling);
+
+  std::string profileName = DEFAULT_PROFILE;
+  Sampling samplings[CHANNEL_COUNT] = {};
+  std::string overrides[CHANNEL_COUNT] = {};
+  double nextSampleTimes[CHANNEL_COUNT] = {};
+};
@@ -0,0 +1,63 @@
+#include "RecordingSchema.h"
+
+#include <cstring>
+
+namespace {
+
+template <typename T>
+void appendValue(std::vector<char>& output, T value) {
+  const char* data = reinterpret_cast<const char*>(&value);
+  output.insert(output.end(), data, data + sizeof(value));
+}
+
+void appendString(std::vector<char>& output, const char* value) {
+  uint16_t length = static_cast<uint16_t>(std::strlen(value));
+  appendValue(output, length);
+  output.insert(output.end(), value, value + length);
+}
+
+}  // namespace
+
+RecordingSchema::RecordingSchema(const SchemaType* types, std::size_t typeCount) : types(types), typeCount(typeCount) {}
+
+void RecordingSchema::clear() {
+  segments.clear();
+}
+
+std::size_t RecordingSchema::getSegmentCount() const {
+  return segments.size();
+}
+
+void RecordingSchema::serialize(std::vector<char>& output) const {
+  appendValue(output, SCHEMA_MARKER);
+
+  // the size is filled in when the schema is complete
+  std::size_t sizePosition = output.size();
+  appendValue(output, uint64_t(0));
+  std::size_t start = output.size();
+
+  appendValue(output, static_cast<uint32_t>(typeCount));
+  for (std::size_t i = 0; i < typeCount; i++) {
+    const SchemaType& type = types[i];
+    appendString(output, type.name);
+    appendValue(output, type.size);
+    appendValue(output, type.fieldCount);
+    for (uint32_t j = 0; j < type.fieldCount; j++) {
+      const SchemaField& field = type.fields[j];
+      appendString(output, field.name);
+      appendValue(output, static_cast<uint8_t>(field.type));
+      appendValue(output, field.offset);
+      appendValue(output, field.count);
+      appendValue(output, field.typeIndex);
+    }
+  }
+
+  appendValue(output, static_cast<uint32_t>(segments.size()));
+  for (const auto& segment : segments) {
+    appendString(output, segment.name.c_str());
+    appendValue(output, segment.typeIndex);
+  }
+
+  uint64_t size = output.size() - start;
+  std::memcpy(output.data() + sizePosition, &size, sizeof(size));
+}
@@ -0,0 +1,142 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @brief Type of a schema field, arrays are described by the element type and a count.
+ */
+enum class SchemaFieldType : uint8_t {
+  Bool = 0,
+  Int8 = 1,
+  UInt8 = 2,
+  Int16 = 3,
+  UInt16 = 4,
+  Int32 = 5,
+  UInt32 = 6,
+  Int64 = 7,
+  UInt64 = 8,
+  Float32 = 9,
+  Float64 = 10,
+  Struct = 11,
+};
+
+struct SchemaField {
+  const char* name;
+  SchemaFieldType type;
+  uint32_t offset;
+  uint32_t count;
+  // index of the nested type for struct fields, -1 otherwise
+  int32_t typeIndex;
+};
+
+struct SchemaType {
+  const char* name;
+  uint32_t size;
+  const SchemaField* fields;
+  uint32_t fieldCount;
+};
+
+/**
+ * @brief Index of a type in the generated type table, specialized by the generated schema header.
+ */
+template <typename T>
+struct SchemaTypeIndex;
+
+template <typename T>
+constexpr SchemaFieldType getSchemaFieldType() {
+  using Element = std::remove_all_extents_t<T>;
+  if constexpr (std::is_enum_v<Element>) {
+    return getSchemaFieldType<std::underlying_type_t<Element>>();
+  } else if constexpr (std::is_same_v<Element, bool>) {
+    return SchemaFieldType::Bool;
+  } else if constexpr (std::is_floating_point_v<Element>) {
+    static_assert(sizeof(Element) == 4 || sizeof(Element) == 8, "unsupported floating point type");
+    return sizeof(Element) == 4 ? SchemaFieldType::Float32 : SchemaFieldType::Float64;
+  } else if constexpr (std::is_integral_v<Element>) {
+    static_assert(sizeof(Element) <= 8, "unsupported integer type");
+    constexpr bool isSigned = std::is_signed_v<Element>;
+    switch (sizeof(Element)) {
+      case 1:
+        return isSigned ? SchemaFieldType::Int8 : SchemaFieldType::UInt8;
+      case 2:
+        return isSigned ? SchemaFieldType::Int16 : SchemaFieldType::UInt16;
+      case 4:
+        return isSigned ? SchemaFieldType::Int32 : SchemaFieldType::UInt32;
+      default:
+        return isSigned ? SchemaFieldType::Int64 : SchemaFieldType::UInt64;
+    }
+  } else {
+    static_assert(std::is_class_v<Element>, "unsupported field type");
+    return SchemaFieldType::Struct;
+  }
+}
+
+template <typename T>
+constexpr int32_t getSchemaTypeIndex() {
+  using Element = std::remove_all_extents_t<T>;
+  if constexpr (std::is_class_v<Element>) {
+    return SchemaTypeIndex<Element>::value;
+  } else {
+    return -1;
+  }
+}
+
+template <typename T>
+constexpr uint32_t getSchemaFieldCount() {
+  return sizeof(T) / sizeof(std::remove_all_extents_t<T>);
+}
+
+// types, offsets and sizes are taken from the compiler, the generated schema only provides the member names
+#define SCHEMA_FIELD(type, member)                                                                    \
+  SchemaField {                                                                                       \
+    #member, getSchemaFieldType<decltype(type::member)>(), offsetof(type, member),                    \
+        getSchemaFieldCount<decltype(type::member)>(), getSchemaTypeIndex<decltype(type::member)>() \
+  }
+
+#define SCHEMA_TYPE(type) \
+  SchemaType { #type, sizeof(type), fdr_schema::type##_fields, sizeof(fdr_schema::type##_fields) / sizeof(SchemaField) }
+
+// end of a member including the padding up to the next member or the end of the type, the generated schema asserts that
+// it reaches the next member for every member, so a member missing in the schema does not compile
+#define SCHEMA_FIELD_END(type, member, alignment) \
+  ((offsetof(type, member) + sizeof(type::member) + (alignment)-1) / (alignment) * (alignment))
+
+/**
+ * @brief Describes the layout of recorded frames as a sequence of named segments of the generated types.
+ *
+ * The serialized schema starts with SCHEMA_MARKER and its size, followed by the type table (name, size and fields of
+ * every type) and the segments (name and type index) in the order they appear in a frame. Strings are stored with a
+ * 16 bit length, all values are little endian.
+ */
+class RecordingSchema {
+ public:
+  // "FDRSCHEM"
+  static constexpr uint64_t SCHEMA_MARKER = 0x4d45484353524446;
+
+  RecordingSchema(const SchemaType* types, std::size_t typeCount);
+
+  template <typename T>
+  void addSegment(const std::string& name) {
+    segments.push_back({name, SchemaTypeIndex<T>::value});
+  }
+
+  void clear();
+
+  std::size_t getSegmentCount() const;
+
+  void serialize(std::vector<char>& output) const;
+
+ private:
+  struct Segment {
+    std::string name;
+    int32_t typeIndex;
+  };
+
+  const SchemaType* types;
+  std::size_t typeCount;
+  std::vector<Segment> segments;
+};
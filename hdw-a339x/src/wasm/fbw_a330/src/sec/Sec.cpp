@@ -1,11 +1,16 @@
 #include "Sec.h"
 #include <iostream>
 
-Sec::Sec(bool isUnit1, bool isUnit3) : isUnit1(isUnit1), isUnit3(isUnit3) {
+Sec::Sec(bool isUnit1, bool isUnit3)
+    : modelInputs(secComputer.getExternalInputs()), modelOutputs(secComputer.getExternalOutputs().out), isUnit1(isUnit1), isUnit3(isUnit3) {
   secComputer.initialize();
 }
 
-Sec::Sec(const Sec& obj) : isUnit1(obj.isUnit1), isUnit3(obj.isUnit3) {
+Sec::Sec(const Sec& obj)
+    : modelInputs(secComputer.getExternalInputs()),
+      modelOutputs(secComputer.getExternalOutputs().out),
+      isUnit1(obj.isUnit1),
+      isUnit3(obj.isUnit3) {
   secComputer.initialize();
 }
 
@@ -32,9 +37,9 @@ void Sec::update(double deltaTime, double simulationTime, bool faultActive, bool
   updateSelfTest(deltaTime);
   monitorSelf(faultActive);
 
-  secComputer.setExternalInputs(&modelInputs);
   secComputer.step();
-  modelOutputs = secComputer.getExternalOutputs().out;
+
+  writeOutputs();
 }
 
 // Perform self monitoring. If
@@ -88,72 +93,47 @@ void Sec::updateSelfTest(double deltaTime) {
   }
 }
 
-// Write the bus output data and return it.
-base_sec_out_bus Sec::getBusOutputs() {
-  base_sec_out_bus output = {};
-
+// Write the output data of the update, it stays valid until the next update.
+void Sec::writeOutputs() {
   if (!monitoringHealthy) {
-    output.left_spoiler_1_position_deg.SSM = Arinc429SignStatus::FailureWarning;
-    output.right_spoiler_1_position_deg.SSM = Arinc429SignStatus::FailureWarning;
-    output.left_spoiler_2_position_deg.SSM = Arinc429SignStatus::FailureWarning;
-    output.right_spoiler_2_position_deg.SSM = Arinc429SignStatus::FailureWarning;
-    output.left_elevator_position_deg.SSM = Arinc429SignStatus::FailureWarning;
-    output.right_elevator_position_deg.SSM = Arinc429SignStatus::FailureWarning;
-    output.ths_position_deg.SSM = Arinc429SignStatus::FailureWarning;
-    output.left_sidestick_pitch_command_deg.SSM = Arinc429SignStatus::FailureWarning;
-    output.right_sidestick_pitch_command_deg.SSM = Arinc429SignStatus::FailureWarning;
-    output.left_sidestick_roll_command_deg.SSM = Arinc429SignStatus::FailureWarning;
-    output.right_sidestick_roll_command_deg.SSM = Arinc429SignStatus::FailureWarning;
-    output.speed_brake_lever_command_deg.SSM = Arinc429SignStatus::FailureWarning;
-    output.thrust_lever_angle_1_deg.SSM = Arinc429SignStatus::FailureWarning;
-    output.thrust_lever_angle_2_deg.SSM = Arinc429SignStatus::FailureWarning;
-    output.discrete_status_word_1.SSM = Arinc429SignStatus::FailureWarning;
-    output.discrete_status_word_2.SSM = Arinc429SignStatus::FailureWarning;
-
-    return output;
+    busOutputs = {};
+    busOutputs.left_spoiler_1_position_deg.SSM = Arinc429SignStatus::FailureWarning;
+    busOutputs.right_spoiler_1_position_deg.SSM = Arinc429SignStatus::FailureWarning;
+    busOutputs.left_spoiler_2_position_deg.SSM = Arinc429SignStatus::FailureWarning;
+    busOutputs.right_spoiler_2_position_deg.SSM = Arinc429SignStatus::FailureWarning;
+    busOutputs.left_elevator_position_deg.SSM = Arinc429SignStatus::FailureWarning;
+    busOutputs.right_elevator_position_deg.SSM = Arinc429SignStatus::FailureWarning;
+    busOutputs.ths_position_deg.SSM = Arinc429SignStatus::FailureWarning;
+    busOutputs.left_sidestick_pitch_command_deg.SSM = Arinc429SignStatus::FailureWarning;
+    busOutputs.right_sidestick_pitch_command_deg.SSM = Arinc429SignStatus::FailureWarning;
+    busOutputs.left_sidestick_roll_command_deg.SSM = Arinc429SignStatus::FailureWarning;
+    busOutputs.right_sidestick_roll_command_deg.SSM = Arinc429SignStatus::FailureWarning;
+    busOutputs.speed_brake_lever_command_deg.SSM = Arinc429SignStatus::FailureWarning;
+    busOutputs.thrust_lever_angle_1_deg.SSM = Arinc429SignStatus::FailureWarning;
+    busOutputs.thrust_lever_angle_2_deg.SSM = Arinc429SignStatus::FailureWarning;
+    busOutputs.discrete_status_word_1.SSM = Arinc429SignStatus::FailureWarning;
+    busOutputs.discrete_status_word_2.SSM = Arinc429SignStatus::FailureWarning;
+
+    // all other discretes are false and all orders are zero
+    discreteOutputs = {};
+    discreteOutputs.sec_failed = true;
+    analogOutputs = {};
+    return;
   }
 
-  output = modelOutputs.bus_outputs;
-
-  return output;
+  busOutputs = modelOutputs.bus_outputs;
+  discreteOutputs = modelOutputs.discrete_outputs;
+  analogOutputs = modelOutputs.analog_outputs;
 }
 
-// Write the discrete output data and return it.
-base_sec_discrete_outputs Sec::getDiscreteOutputs() {
-  base_sec_discrete_outputs output = {};
-
-  output.sec_failed = !monitoringHealthy;
-  if (!monitoringHealthy) {
-    output.thr_reverse_selected = false;
-    output.left_elevator_ok = false;
-    output.right_elevator_ok = false;
-    output.ground_spoiler_out = false;
-    output.left_elevator_damping_mode = false;
-    output.right_elevator_damping_mode = false;
-    output.ths_active = false;
-    output.batt_power_supply = false;
-  } else {
-    output = modelOutputs.discrete_outputs;
-  }
-
-  return output;
+const base_sec_out_bus& Sec::getBusOutputs() const {
+  return busOutputs;
 }
 
-// Write the analog outputs and return it.
-base_sec_analog_outputs Sec::getAnalogOutputs() {
-  base_sec_analog_outputs output = {};
-
-  if (!monitoringHealthy) {
-    output.left_elev_pos_order_deg = 0;
-    output.right_elev_pos_order_deg = 0;
-    output.ths_pos_order_deg = 0;
-    output.left_spoiler_1_pos_order_deg = 0;
-    output.right_spoiler_1_pos_order_deg = 0;
-    output.left_spoiler_2_pos_order_deg = 0;
-    output.right_spoiler_2_pos_order_deg = 0;
-  } else {
-    output = modelOutputs.analog_outputs;
-  }
+const base_sec_discrete_outputs& Sec::getDiscreteOutputs() const {
+  return discreteOutputs;
+}
 
-  return output;
+const base_sec_analog_outputs& Sec::getAnalogOutputs() const {
+  return analogOutputs;
 }
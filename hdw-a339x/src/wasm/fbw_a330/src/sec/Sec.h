@@ -9,6 +9,9 @@
 #include "../utils/SRFlipFlop.h"
 
 class Sec {
+  // Model, declared first as the constructors bind the references to its inputs and outputs
+  SecComputer secComputer;
+
  public:
   Sec(bool isUnit1, bool isUnit3);
 
@@ -16,13 +19,14 @@ class Sec {
 
   void update(double deltaTime, double simulationTime, bool faultActive, bool isPowered);
 
-  base_sec_out_bus getBusOutputs();
+  const base_sec_out_bus& getBusOutputs() const;
 
-  base_sec_discrete_outputs getDiscreteOutputs();
+  const base_sec_discrete_outputs& getDiscreteOutputs() const;
 
-  base_sec_analog_outputs getAnalogOutputs();
+  const base_sec_analog_outputs& getAnalogOutputs() const;
 
-  SecComputer::ExternalInputs_SecComputer_T modelInputs = {};
+  // inputs of the model, written in place before update()
+  SecComputer::ExternalInputs_SecComputer_T& modelInputs;
 
  private:
   void initSelfTests();
@@ -35,9 +39,14 @@ class Sec {
 
   void updateSelfTest(double deltaTime);
 
-  // Model
-  SecComputer secComputer;
-  sec_outputs modelOutputs;
+  void writeOutputs();
+
+  const sec_outputs& modelOutputs;
+
+  // outputs of the last update
+  base_sec_out_bus busOutputs = {};
+  base_sec_discrete_outputs discreteOutputs = {};
+  base_sec_analog_outputs analogOutputs = {};
 
   // Computer Self-monitoring vars
   bool monitoringHealthy;
@@ -0,0 +1,36 @@
+#include "FileWatcher.h"
+
+#include <sys/stat.h>
+
+FileWatcher::FileWatcher(const std::string& filepath, double interval) : filepath(filepath), interval(interval) {}
+
+bool FileWatcher::hasChanged(double sampleTime) {
+  timeSinceCheck += sampleTime;
+  if (timeSinceCheck < interval) {
+    return false;
+  }
+  timeSinceCheck = 0;
+
+  // report a change only when the file did not change since the previous check
+  Stamp stamp = readStamp();
+  bool changed = stamp != knownStamp && stamp == previousStamp;
+  previousStamp = stamp;
+  if (changed) {
+    knownStamp = stamp;
+  }
+  return changed;
+}
+
+void FileWatcher::reset() {
+  knownStamp = readStamp();
+  previousStamp = knownStamp;
+  timeSinceCheck = 0;
+}
+
+FileWatcher::Stamp FileWatcher::readStamp() const {
+  struct stat status;
+  if (stat(filepath.c_str(), &status) != 0) {
+    return {false, 0, 0};
+  }
+  return {true, static_cast<long long>(status.st_mtime), static_cast<long long>(status.st_size)};
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <string>
+
+/**
+ * @brief Detects changes of a file by polling its modification time and size at a low rate.
+ *
+ * A change is only reported once the file has been stable for one interval, so a file that is still being written is
+ * not picked up half way.
+ */
+class FileWatcher {
+ public:
+  FileWatcher(const std::string& filepath, double interval);
+
+  /**
+   * @brief Checks the file when the interval has elapsed.
+   * @return true once per change of the file since the last reset() or reported change.
+   */
+  bool hasChanged(double sampleTime);
+
+  /**
+   * @brief Takes the current state of the file as the known state.
+   */
+  void reset();
+
+ private:
+  struct Stamp {
+    bool exists;
+    long long modificationTime;
+    long long size;
+
+    bool operator==(const Stamp& other) const = default;
+  };
+
+  Stamp readStamp() const;
+
+  std::string filepath;
+  double interval;
+  double timeSinceCheck = 0;
+  Stamp knownStamp = {};
+  Stamp previousStamp = {};
+};
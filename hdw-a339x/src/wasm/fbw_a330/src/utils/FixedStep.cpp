@@ -0,0 +1,97 @@
+#include "FixedStep.h"
+
+#include <algorithm>
+#include <cmath>
+
+void FixedStep::setRate(double rate) {
+  stepTime = rate > 0 ? 1.0 / rate : 0;
+  remainder = 0;
+}
+
+double FixedStep::getRate() const {
+  return stepTime > 0 ? 1.0 / stepTime : 0;
+}
+
+void FixedStep::setMaximumSubSteps(int maximumSubSteps) {
+  this->maximumSubSteps = std::max(1, maximumSubSteps);
+}
+
+void FixedStep::setBudget(double budget_us) {
+  this->budget_us = std::max(0.0, budget_us);
+}
+
+double FixedStep::getBudget() const {
+  return budget_us;
+}
+
+bool FixedStep::isEnabled() const {
+  return stepTime > 0;
+}
+
+double FixedStep::getStepTime() const {
+  return stepTime;
+}
+
+int FixedStep::getMaximumSubSteps() const {
+  return maximumSubSteps;
+}
+
+int FixedStep::beginFrame(double sampleTime) {
+  frameTime = sampleTime;
+  frameStartRemainder = remainder;
+
+  double available = remainder + sampleTime;
+  int due = static_cast<int>(std::floor(available / stepTime));
+
+  // the budget allows at least one sub-step, otherwise the model would stop
+  int allowed = maximumSubSteps;
+  if (budget_us > 0 && averageExecutionTime_us > 0) {
+    allowed = std::clamp(static_cast<int>(budget_us / averageExecutionTime_us), 1, maximumSubSteps);
+  }
+
+  limited = due > allowed;
+  if (limited) {
+    // spread the whole frame over the allowed sub-steps
+    subSteps = allowed;
+    subStepTime = available / allowed;
+    remainder = 0;
+  } else {
+    subSteps = due;
+    subStepTime = stepTime;
+    remainder = available - due * stepTime;
+  }
+
+  return subSteps;
+}
+
+int FixedStep::getSubSteps() const {
+  return subSteps;
+}
+
+double FixedStep::getSubStepTime() const {
+  return subStepTime;
+}
+
+double FixedStep::getSubStepFraction(int subStep) const {
+  if (frameTime <= 0) {
+    return 1;
+  }
+  return std::clamp(((subStep + 1) * subStepTime - frameStartRemainder) / frameTime, 0.0, 1.0);
+}
+
+void FixedStep::recordExecutionTime(std::chrono::steady_clock::duration duration) {
+  if (subSteps == 0) {
+    return;
+  }
+
+  double executionTime_us = std::chrono::duration<double, std::micro>(duration).count() / subSteps;
+  if (averageExecutionTime_us == 0) {
+    averageExecutionTime_us = executionTime_us;
+  } else {
+    averageExecutionTime_us += EXECUTION_TIME_FILTER * (executionTime_us - averageExecutionTime_us);
+  }
+}
+
+bool FixedStep::isLimited() const {
+  return limited;
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <chrono>
+
+/**
+ * @brief Splits the frames into sub-steps of a constant size for models that need to run independent of the frame rate.
+ *
+ * The time that does not fill a complete sub-step is carried into the next frame, so a frame can have no sub-step at
+ * all at high frame rates. The number of sub-steps of a frame is limited by a maximum and by a budget of execution
+ * time, measured over the previous frames. When a limit is reached the time of the frame is spread evenly over the
+ * allowed sub-steps, i.e. the steps get longer instead of time being lost.
+ */
+class FixedStep {
+ public:
+  /**
+   * @brief Sets the rate of the sub-steps, 0 disables the fixed step.
+   */
+  void setRate(double rate);
+
+  double getRate() const;
+
+  void setMaximumSubSteps(int maximumSubSteps);
+
+  /**
+   * @brief Sets the execution time budget of the sub-steps of one frame, 0 disables the budget.
+   */
+  void setBudget(double budget_us);
+
+  double getBudget() const;
+
+  bool isEnabled() const;
+
+  double getStepTime() const;
+
+  int getMaximumSubSteps() const;
+
+  /**
+   * @brief Starts a new frame of the given duration.
+   * @return the number of sub-steps to execute in this frame.
+   */
+  int beginFrame(double sampleTime);
+
+  int getSubSteps() const;
+
+  /**
+   * @brief Returns the duration of the sub-steps of the current frame.
+   */
+  double getSubStepTime() const;
+
+  /**
+   * @brief Returns the position of the end of the sub-step within the current frame, from 0 (exclusive) to 1.
+   */
+  double getSubStepFraction(int subStep) const;
+
+  /**
+   * @brief Records the execution time of the sub-steps of the current frame for the budget, once per frame. Models that
+   * share the fixed step record the sum of their execution times.
+   */
+  void recordExecutionTime(std::chrono::steady_clock::duration duration);
+
+  /**
+   * @brief Returns true if the sub-steps of the current frame were limited.
+   */
+  bool isLimited() const;
+
+ private:
+  // weight of a new measurement in the average execution time of a sub-step
+  static constexpr double EXECUTION_TIME_FILTER = 0.1;
+
+  double stepTime = 0;
+  int maximumSubSteps = 16;
+  double budget_us = 0;
+
+  // time since the end of the last sub-step
+  double remainder = 0;
+  double averageExecutionTime_us = 0;
+
+  // current frame
+  double frameTime = 0;
+  double frameStartRemainder = 0;
+  int subSteps = 0;
+  double subStepTime = 0;
+  bool limited = false;
+};
@@ -0,0 +1,84 @@
+#include "StageScheduler.h"
+
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+
+void StageScheduler::initialize(const std::vector<std::string>& stageNames) {
+  stages.clear();
+  stages.resize(stageNames.size());
+  for (std::size_t i = 0; i < stageNames.size(); i++) {
+    stages[i].name = stageNames[i];
+    stages[i].period = 0;
+  }
+  reset();
+}
+
+void StageScheduler::setRate(int stage, double rate) {
+  stages[stage].period = rate > 0 ? 1.0 / rate : 0;
+}
+
+double StageScheduler::getRate(int stage) const {
+  return stages[stage].period > 0 ? 1.0 / stages[stage].period : 0;
+}
+
+void StageScheduler::record(Stage& entry, double interval) {
+  // the first run closes no interval
+  if (entry.runs++ == 0) {
+    return;
+  }
+  entry.sumInterval += interval;
+  entry.sumSquaredInterval += interval * interval;
+  entry.minInterval = std::min(entry.minInterval, interval);
+  entry.maxInterval = std::max(entry.maxInterval, interval);
+}
+
+void StageScheduler::reset() {
+  for (auto& stage : stages) {
+    stage.accumulatedTime = 0;
+    stage.phase = 0;
+    stage.runs = 0;
+    stage.skips = 0;
+    stage.sumInterval = 0;
+    stage.sumSquaredInterval = 0;
+    stage.minInterval = std::numeric_limits<double>::max();
+    stage.maxInterval = 0;
+  }
+}
+
+StageScheduler::Statistics StageScheduler::getStatistics(int stage) const {
+  const Stage& entry = stages[stage];
+  double rate = getRate(stage);
+  if (entry.runs < 2) {
+    return {entry.runs, entry.skips, rate, 0, 0, 0};
+  }
+
+  double intervals = static_cast<double>(entry.runs - 1);
+  double mean = entry.sumInterval / intervals;
+  double nominal = entry.period > 0 ? entry.period : mean;
+
+  // mean squared deviation from the nominal period, expanded so that only the sums need to be kept
+  double meanSquaredJitter = entry.sumSquaredInterval / intervals - 2 * nominal * mean + nominal * nominal;
+  double rmsJitter = std::sqrt(std::max(meanSquaredJitter, 0.0));
+  double maxJitter = std::max(std::abs(entry.maxInterval - nominal), std::abs(entry.minInterval - nominal));
+
+  return {entry.runs, entry.skips, rate, mean * 1000.0, rmsJitter * 1000.0, maxJitter * 1000.0};
+}
+
+bool StageScheduler::writeToFile(const std::string& filepath) const {
+  std::ofstream file(filepath);
+  if (!file.is_open()) {
+    return false;
+  }
+
+  file << "stage,rate_hz,runs,skips,mean_interval_ms,rms_jitter_ms,max_jitter_ms" << std::endl;
+  file << std::fixed << std::setprecision(2);
+  for (std::size_t i = 0; i < stages.size(); i++) {
+    Statistics statistics = getStatistics(i);
+    file << stages[i].name << "," << statistics.rate_hz << "," << statistics.runs << "," << statistics.skips << ","
+         << statistics.meanInterval_ms << "," << statistics.rmsJitter_ms << "," << statistics.maxJitter_ms << std::endl;
+  }
+
+  return true;
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Runs the stages of a frame at their configured nominal rates instead of the visual frame rate.
+ *
+ * A stage with a rate of 0 runs every frame. Otherwise the stage runs on the frame closest to its next nominal run time,
+ * with the time accumulated since its last run as its sample time, so no time is lost when frames are skipped. The
+ * phase is kept across runs so that the mean rate matches the nominal rate even when it does not divide the frame rate.
+ * The interval between two runs is recorded for every stage, the jitter is its deviation from the nominal period, or
+ * from the mean interval for stages running every frame.
+ */
+class StageScheduler {
+ public:
+  struct Statistics {
+    std::size_t runs;
+    std::size_t skips;
+    double rate_hz;
+    double meanInterval_ms;
+    double rmsJitter_ms;
+    double maxJitter_ms;
+  };
+
+  void initialize(const std::vector<std::string>& stageNames);
+
+  /**
+   * @brief Sets the nominal rate of the stage, 0 runs the stage every frame.
+   */
+  void setRate(int stage, double rate);
+
+  double getRate(int stage) const;
+
+  /**
+   * @brief Executes the function with the time accumulated since the last run if the stage is due in this frame.
+   * @return the result of the function, true if the stage is skipped.
+   */
+  template <typename Function>
+  bool run(int stage, double sampleTime, Function function) {
+    Stage& entry = stages[stage];
+    entry.accumulatedTime += sampleTime;
+    entry.phase += sampleTime;
+
+    // run on the frame closest to the next run time, the first frame always runs
+    if (entry.period > 0 && entry.runs > 0 && entry.phase + 0.5 * sampleTime < entry.period) {
+      entry.skips++;
+      return true;
+    }
+
+    double stageSampleTime = entry.accumulatedTime;
+    record(entry, stageSampleTime);
+    entry.accumulatedTime = 0;
+    // keep at most half a frame of lateness, a long frame does not cause catch-up runs
+    entry.phase = entry.period > 0 ? std::min(entry.phase - entry.period, 0.5 * sampleTime) : 0;
+    return function(stageSampleTime);
+  }
+
+  void reset();
+
+  Statistics getStatistics(int stage) const;
+
+  /**
+   * @brief Writes the rates and jitter statistics of all stages as CSV.
+   * @return false if the file could not be written.
+   */
+  bool writeToFile(const std::string& filepath) const;
+
+ private:
+  struct Stage {
+    std::string name;
+    double period;
+    double accumulatedTime;
+    // time since the nominal time of the last run
+    double phase;
+    std::size_t runs;
+    std::size_t skips;
+    // intervals between runs, the first run has no interval
+    double sumInterval;
+    double sumSquaredInterval;
+    double minInterval;
+    double maxInterval;
+  };
+
+  static void record(Stage& entry, double interval);
+
+  std::vector<Stage> stages;
+};
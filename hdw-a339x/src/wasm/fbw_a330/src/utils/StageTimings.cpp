@@ -0,0 +1,91 @@
+#include "StageTimings.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+
+StageTimings::ScopedTimer::ScopedTimer(StageTimings& timings, int stage)
+    : timings(timings), stage(stage), start(timings.enabled ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point()) {}
+
+StageTimings::ScopedTimer::~ScopedTimer() {
+  if (timings.enabled) {
+    timings.record(stage, std::chrono::steady_clock::now() - start);
+  }
+}
+
+void StageTimings::initialize(const std::vector<std::string>& stageNames) {
+  stages.clear();
+  stages.resize(stageNames.size());
+  for (std::size_t i = 0; i < stageNames.size(); i++) {
+    stages[i].name = stageNames[i];
+  }
+  reset();
+}
+
+void StageTimings::setEnabled(bool enabled) {
+  this->enabled = enabled;
+}
+
+bool StageTimings::isEnabled() const {
+  return enabled;
+}
+
+void StageTimings::record(int stage, std::chrono::steady_clock::duration duration) {
+  Stage& entry = stages[stage];
+  entry.samples_ns[entry.next] = std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+  entry.next = (entry.next + 1) % WINDOW_SIZE;
+  entry.count = std::min(entry.count + 1, WINDOW_SIZE);
+}
+
+void StageTimings::reset() {
+  for (auto& stage : stages) {
+    stage.count = 0;
+    stage.next = 0;
+  }
+}
+
+std::size_t StageTimings::getStageCount() const {
+  return stages.size();
+}
+
+const std::string& StageTimings::getStageName(int stage) const {
+  return stages[stage].name;
+}
+
+StageTimings::Statistics StageTimings::getStatistics(int stage) const {
+  const Stage& entry = stages[stage];
+  if (entry.count == 0) {
+    return {0, 0, 0, 0, 0};
+  }
+
+  // copy the window, the ring itself must stay in recording order
+  std::array<std::int64_t, WINDOW_SIZE> sorted;
+  std::copy(entry.samples_ns.begin(), entry.samples_ns.begin() + entry.count, sorted.begin());
+  std::sort(sorted.begin(), sorted.begin() + entry.count);
+
+  double sum = 0;
+  for (std::size_t i = 0; i < entry.count; i++) {
+    sum += static_cast<double>(sorted[i]);
+  }
+
+  std::size_t p99Index = std::min(entry.count - 1, (entry.count * 99) / 100);
+  return {entry.count, sorted[0] / 1000.0, sum / static_cast<double>(entry.count) / 1000.0, sorted[p99Index] / 1000.0,
+          sorted[entry.count - 1] / 1000.0};
+}
+
+bool StageTimings::writeToFile(const std::string& filepath) const {
+  std::ofstream file(filepath);
+  if (!file.is_open()) {
+    return false;
+  }
+
+  file << "stage,samples,min_us,mean_us,p99_us,max_us" << std::endl;
+  file << std::fixed << std::setprecision(2);
+  for (std::size_t i = 0; i < stages.size(); i++) {
+    Statistics statistics = getStatistics(i);
+    file << stages[i].name << "," << statistics.samples << "," << statistics.min_us << "," << statistics.mean_us << ","
+         << statistics.p99_us << "," << statistics.max_us << std::endl;
+  }
+
+  return true;
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Rolling execution time statistics for the stages of a frame.
+ *
+ * Every stage keeps the last WINDOW_SIZE samples in a ring, statistics are only computed when they are requested. When
+ * disabled, measuring a stage costs a single branch.
+ */
+class StageTimings {
+ public:
+  static constexpr std::size_t WINDOW_SIZE = 512;
+
+  struct Statistics {
+    std::size_t samples;
+    double min_us;
+    double mean_us;
+    double p99_us;
+    double max_us;
+  };
+
+  /**
+   * @brief RAII timer, records the time between construction and destruction.
+   */
+  class ScopedTimer {
+   public:
+    ScopedTimer(StageTimings& timings, int stage);
+    ~ScopedTimer();
+
+   private:
+    StageTimings& timings;
+    int stage;
+    std::chrono::steady_clock::time_point start;
+  };
+
+  void initialize(const std::vector<std::string>& stageNames);
+
+  void setEnabled(bool enabled);
+
+  bool isEnabled() const;
+
+  /**
+   * @brief Executes the function and records its execution time for the given stage.
+   * @return the result of the function.
+   */
+  template <typename Function>
+  bool measure(int stage, Function function) {
+    if (!enabled) {
+      return function();
+    }
+    auto start = std::chrono::steady_clock::now();
+    bool result = function();
+    record(stage, std::chrono::steady_clock::now() - start);
+    return result;
+  }
+
+  void record(int stage, std::chrono::steady_clock::duration duration);
+
+  void reset();
+
+  std::size_t getStageCount() const;
+
+  const std::string& getStageName(int stage) const;
+
+  Statistics getStatistics(int stage) const;
+
+  /**
+   * @brief Writes the statistics of all stages as CSV.
+   * @return false if the file could not be written.
+   */
+  bool writeToFile(const std::string& filepath) const;
+
+ private:
+  struct Stage {
+    std::string name;
+    std::array<std::int64_t, WINDOW_SIZE> samples_ns;
+    std::size_t count;
+    std::size_t next;
+  };
+
+  bool enabled = false;
+  std::vector<Stage> stages;
+};
@@ -0,0 +1,148 @@
+// Generates the schema header of the flight data recorder from the recorded C++ data types.
+//
+// Only member names and the nesting of the structs are taken from the headers, types, offsets and sizes are filled in
+// by the compiler when the generated header is compiled (see RecordingSchema.h). The generated header asserts that the
+// members of every type cover it, so a member added to a recorded type without regenerating the schema fails to compile.
+//
+// usage: node generate-fdr-schema.js <output header> <root types, comma separated> <input headers...>
+
+const { readFileSync, writeFileSync } = require('fs');
+const path = require('path');
+
+const SCALAR_TYPES = new Set([
+    'bool',
+    'boolean_T',
+    'char',
+    'int8_T',
+    'uint8_T',
+    'int16_T',
+    'uint16_T',
+    'int32_T',
+    'uint32_T',
+    'int',
+    'unsigned int',
+    'long long',
+    'unsigned long long',
+    'real32_T',
+    'real_T',
+    'float',
+    'double',
+]);
+
+const [outputFile, rootTypeList, ...inputFiles] = process.argv.slice(2);
+if (!outputFile || !rootTypeList || inputFiles.length === 0) {
+    console.error('usage: node generate-fdr-schema.js <output header> <root types, comma separated> <input headers...>');
+    process.exit(1);
+}
+
+const enums = new Set();
+const structs = new Map();
+
+for (const inputFile of inputFiles) {
+    const source = readFileSync(inputFile, 'utf8')
+        .replace(/\/\*[\s\S]*?\*\//g, '')
+        .replace(/\/\/.*$/gm, '');
+
+    for (const match of source.matchAll(/enum\s+(?:class\s+)?(\w+)\s*(?::\s*\w+\s*)?\{/g)) {
+        enums.add(match[1]);
+    }
+
+    // the generated types are guarded, so the same struct can appear in several headers
+    for (const match of source.matchAll(/struct\s+(\w+)\s*\{([^{}]*)\}\s*;/g)) {
+        if (structs.has(match[1])) {
+            continue;
+        }
+
+        const members = match[2]
+            .split(';')
+            .map((declaration) => declaration.trim().replace(/\s+/g, ' '))
+            .filter((declaration) => declaration.length > 0)
+            .map((declaration) => {
+                const member = declaration.match(/^(.+?) (\w+)(?: ?\[\s*\d+\s*\])?$/);
+                if (!member) {
+                    throw new Error(`Unsupported member declaration '${declaration}' in struct ${match[1]}`);
+                }
+                return { type: member[1], name: member[2] };
+            });
+
+        structs.set(match[1], members);
+    }
+}
+
+// emit the types in dependency order, so the nested types of a struct always have lower indices
+const orderedTypes = [];
+const visit = (typeName) => {
+    if (orderedTypes.includes(typeName)) {
+        return;
+    }
+    if (!structs.has(typeName)) {
+        throw new Error(`Struct ${typeName} not found in the input headers`);
+    }
+
+    for (const member of structs.get(typeName)) {
+        if (structs.has(member.type)) {
+            visit(member.type);
+        } else if (!enums.has(member.type) && !SCALAR_TYPES.has(member.type)) {
+            throw new Error(`Unsupported type ${member.type} of ${typeName}::${member.name}`);
+        }
+    }
+    orderedTypes.push(typeName);
+};
+rootTypeList.split(',').forEach((rootType) => visit(rootType.trim()));
+
+const outputDirectory = path.dirname(outputFile);
+const includes = inputFiles.map((inputFile) => `#include "${path.relative(outputDirectory, inputFile).replace(/\\/g, '/')}"`);
+
+const lines = [
+    '// generated by scripts/generate-fdr-schema.js (npm run build-a339x:fdr-schema), do not edit',
+    '#pragma once',
+    '',
+    '#include <cstddef>',
+    '',
+    ...includes,
+    '#include "RecordingSchema.h"',
+    '',
+];
+
+orderedTypes.forEach((typeName, index) => {
+    lines.push(`template <>`);
+    lines.push(`struct SchemaTypeIndex<${typeName}> {`);
+    lines.push(`  static constexpr int32_t value = ${index};`);
+    lines.push(`};`);
+    lines.push('');
+});
+
+lines.push('namespace fdr_schema {');
+lines.push('');
+for (const typeName of orderedTypes) {
+    lines.push(`constexpr SchemaField ${typeName}_fields[] = {`);
+    for (const member of structs.get(typeName)) {
+        lines.push(`    SCHEMA_FIELD(${typeName}, ${member.name}),`);
+    }
+    lines.push('};');
+    lines.push('');
+
+    // every member ends where the next one starts, the last one at the end of the type
+    const members = structs.get(typeName);
+    const ends = members.map((member, index) => {
+        const next = members[index + 1];
+        return next
+            ? `SCHEMA_FIELD_END(${typeName}, ${member.name}, alignof(decltype(${typeName}::${next.name}))) == offsetof(${typeName}, ${next.name})`
+            : `SCHEMA_FIELD_END(${typeName}, ${member.name}, alignof(${typeName})) == sizeof(${typeName})`;
+    });
+    lines.push(`static_assert(${ends.join(' &&\n              ')},`);
+    lines.push(`              "schema of ${typeName} does not cover all of its members, regenerate the schema");`);
+    lines.push('');
+}
+
+lines.push('constexpr SchemaType TYPES[] = {');
+for (const typeName of orderedTypes) {
+    lines.push(`    SCHEMA_TYPE(${typeName}),`);
+}
+lines.push('};');
+lines.push('');
+lines.push('}  // namespace fdr_schema');
+lines.push('');
+
+writeFileSync(outputFile, lines.join('\n'));
+console.log(`Generated schema with ${orderedTypes.length} types in ${outputFile}`);
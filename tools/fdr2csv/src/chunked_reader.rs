@@ -0,0 +1,123 @@
+use crate::{
+    delta_decoder::DeltaDecoder,
+    read_bytes,
+    schema::{Schema, SCHEMA_MARKER},
+};
+use flate2::bufread::MultiGzDecoder;
+use std::{
+    fs::File,
+    io::{prelude::*, BufReader, Error, SeekFrom},
+};
+
+// Chunked containers start with this uncompressed marker, followed by the interface version, the
+// frame size, the number of frames per block, the keyframe interval (0 without delta encoding) and
+// optionally the schema
+pub const CHUNKED_CONTAINER_MARKER: u64 = u64::from_le_bytes(*b"FDRCHUNK");
+
+// Last value of the trailer (index offset, number of blocks, marker) at the end of the file
+pub const BLOCK_INDEX_MARKER: u64 = u64::from_le_bytes(*b"FDRINDEX");
+
+const HEADER_SIZE: u64 = 5 * 8;
+const TRAILER_SIZE: u64 = 3 * 8;
+
+// Entry of the block index, the time is the simulation time of the first frame in the block
+struct BlockIndexEntry {
+    simulation_time: f64,
+    offset: u64,
+}
+
+// Opens a chunked container after its marker has been read. The returned reader yields the raw
+// frames starting with the block that contains `from`, without inflating the blocks before it.
+pub fn open(
+    mut file: File,
+    from: Option<f64>,
+) -> Result<(u64, Option<Schema>, Box<dyn Read>), Error> {
+    let interface_version = read_bytes::<u64>(&mut file)?;
+    let frame_size = read_bytes::<u64>(&mut file)?;
+    let frames_per_block = read_bytes::<u64>(&mut file)?;
+    let keyframe_interval = read_bytes::<u64>(&mut file)?;
+
+    // The uncompressed schema is part of the header, the first block follows it
+    let schema = match read_bytes::<u64>(&mut file) {
+        Ok(SCHEMA_MARKER) => Some(Schema::read(&mut file)?),
+        _ => None,
+    };
+    let first_block_offset = match schema {
+        Some(_) => file.stream_position()?,
+        None => HEADER_SIZE,
+    };
+
+    // Without a valid index (e.g. the recording was interrupted) all blocks are read
+    let file_size = file.seek(SeekFrom::End(0))?;
+    let index = read_index(&mut file, file_size, first_block_offset).ok();
+    let (start_offset, end_offset) = match &index {
+        Some((index_offset, entries)) => {
+            let start = match from {
+                Some(from) => entries
+                    .iter()
+                    .take_while(|entry| entry.simulation_time <= from)
+                    .last()
+                    .or(entries.first())
+                    .map_or(*index_offset, |entry| entry.offset),
+                None => first_block_offset,
+            };
+            (start, *index_offset)
+        }
+        None => {
+            println!("No block index found, reading all blocks");
+            (first_block_offset, file_size)
+        }
+    };
+
+    file.seek(SeekFrom::Start(start_offset))?;
+    let blocks = MultiGzDecoder::new(BufReader::new(file.take(end_offset - start_offset)));
+
+    let reader: Box<dyn Read> = if keyframe_interval > 0 {
+        Box::new(DeltaDecoder::new(
+            blocks,
+            frame_size as usize,
+            keyframe_interval,
+            frames_per_block,
+        ))
+    } else {
+        Box::new(blocks)
+    };
+
+    Ok((interface_version, schema, reader))
+}
+
+fn read_index(
+    file: &mut File,
+    file_size: u64,
+    first_block_offset: u64,
+) -> Result<(u64, Vec<BlockIndexEntry>), Error> {
+    let invalid_index = || Error::new(std::io::ErrorKind::InvalidData, "Invalid block index");
+
+    if file_size < first_block_offset + TRAILER_SIZE {
+        return Err(invalid_index());
+    }
+    file.seek(SeekFrom::Start(file_size - TRAILER_SIZE))?;
+    let index_offset = read_bytes::<u64>(file)?;
+    let block_count = read_bytes::<u64>(file)?;
+    if read_bytes::<u64>(file)? != BLOCK_INDEX_MARKER
+        || index_offset < first_block_offset
+        || index_offset + block_count * 24 + TRAILER_SIZE != file_size
+    {
+        return Err(invalid_index());
+    }
+
+    file.seek(SeekFrom::Start(index_offset))?;
+    let mut reader = BufReader::new(file);
+    let mut entries = Vec::with_capacity(block_count as usize);
+    for _ in 0..block_count {
+        let simulation_time = read_bytes::<f64>(&mut reader)?;
+        let offset = read_bytes::<u64>(&mut reader)?;
+        let _frame_count = read_bytes::<u64>(&mut reader)?;
+        entries.push(BlockIndexEntry {
+            simulation_time,
+            offset,
+        });
+    }
+
+    Ok((index_offset, entries))
+}
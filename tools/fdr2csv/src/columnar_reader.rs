@@ -0,0 +1,178 @@
+use flate2::read::ZlibDecoder;
+use serde::{ser::SerializeTuple, Serialize, Serializer};
+use std::io::{prelude::*, Error, ErrorKind};
+
+use crate::columnar_writer::{ColumnType, COLUMNAR_MARKER};
+
+// Reads the files of ColumnarWriter block by block, see there for the layout
+pub struct ColumnarReader<R: Read> {
+    reader: R,
+    columns: Vec<Column>,
+}
+
+pub struct Column {
+    pub name: String,
+    pub column_type: ColumnType,
+}
+
+// Rows of a block, the values of every column are kept as they are stored in the file
+pub struct Block<'a> {
+    columns: &'a [Column],
+    rows: usize,
+    data: Vec<Vec<u8>>,
+}
+
+#[derive(Clone, Copy, Debug, PartialEq)]
+pub enum Value {
+    Bool(bool),
+    I8(i8),
+    I16(i16),
+    I32(i32),
+    I64(i64),
+    U8(u8),
+    U16(u16),
+    U32(u32),
+    U64(u64),
+    F32(f32),
+    F64(f64),
+}
+
+impl<R: Read> ColumnarReader<R> {
+    // Creates the reader and reads the columns of the file
+    pub fn new(mut reader: R) -> Result<Self, Error> {
+        if read_u64(&mut reader)? != COLUMNAR_MARKER {
+            return Err(invalid_file("not a columnar file"));
+        }
+
+        let column_count = read_u32(&mut reader)?;
+        let mut columns = Vec::with_capacity(column_count as usize);
+        for _ in 0..column_count {
+            let mut column_type = [0u8; 1];
+            reader.read_exact(&mut column_type)?;
+            let column_type = ColumnType::from_u8(column_type[0])
+                .ok_or_else(|| invalid_file("invalid column type"))?;
+            let name = read_string(&mut reader)?;
+            columns.push(Column { name, column_type });
+        }
+
+        Ok(ColumnarReader { reader, columns })
+    }
+
+    pub fn columns(&self) -> &[Column] {
+        &self.columns
+    }
+
+    // Reads the next block, None at the end of the file
+    pub fn read_block(&mut self) -> Result<Option<Block<'_>>, Error> {
+        let rows = read_u32(&mut self.reader)? as usize;
+        if rows == 0 {
+            return Ok(None);
+        }
+
+        let mut data = Vec::with_capacity(self.columns.len());
+        for column in &self.columns {
+            let mut compressed = vec![0u8; read_u32(&mut self.reader)? as usize];
+            self.reader.read_exact(&mut compressed)?;
+            let mut values = Vec::with_capacity(column.column_type.data_size(rows));
+            ZlibDecoder::new(compressed.as_slice()).read_to_end(&mut values)?;
+            if values.len() != column.column_type.data_size(rows) {
+                return Err(invalid_file(&format!(
+                    "invalid size of column '{}'",
+                    column.name
+                )));
+            }
+            data.push(values);
+        }
+
+        Ok(Some(Block {
+            columns: &self.columns,
+            rows,
+            data,
+        }))
+    }
+}
+
+impl<'a> Block<'a> {
+    pub fn rows(&self) -> usize {
+        self.rows
+    }
+
+    pub fn value(&self, column: usize, row: usize) -> Value {
+        let data = &self.data[column];
+        match self.columns[column].column_type {
+            ColumnType::Bool => Value::Bool(data[row / 8] & (1 << (row % 8)) != 0),
+            ColumnType::I8 => Value::I8(data[row] as i8),
+            ColumnType::I16 => Value::I16(i16::from_le_bytes(value_bytes(data, row))),
+            ColumnType::I32 => Value::I32(i32::from_le_bytes(value_bytes(data, row))),
+            ColumnType::I64 => Value::I64(i64::from_le_bytes(value_bytes(data, row))),
+            ColumnType::U8 => Value::U8(data[row]),
+            ColumnType::U16 => Value::U16(u16::from_le_bytes(value_bytes(data, row))),
+            ColumnType::U32 => Value::U32(u32::from_le_bytes(value_bytes(data, row))),
+            ColumnType::U64 => Value::U64(u64::from_le_bytes(value_bytes(data, row))),
+            ColumnType::F32 => Value::F32(f32::from_le_bytes(value_bytes(data, row))),
+            ColumnType::F64 => Value::F64(f64::from_le_bytes(value_bytes(data, row))),
+        }
+    }
+
+    // Returns a row for serialization, the values are serialized like the fields of the records
+    // they were written from, so the CSV of a columnar file matches the CSV of the FDR file
+    pub fn record(&self, row: usize) -> BlockRecord<'_, 'a> {
+        BlockRecord { block: self, row }
+    }
+}
+
+pub struct BlockRecord<'b, 'a> {
+    block: &'b Block<'a>,
+    row: usize,
+}
+
+impl<'b, 'a> Serialize for BlockRecord<'b, 'a> {
+    fn serialize<S: Serializer>(&self, serializer: S) -> Result<S::Ok, S::Error> {
+        let columns = self.block.columns.len();
+        let mut record = serializer.serialize_tuple(columns)?;
+        for column in 0..columns {
+            match self.block.value(column, self.row) {
+                Value::Bool(v) => record.serialize_element(&v)?,
+                Value::I8(v) => record.serialize_element(&v)?,
+                Value::I16(v) => record.serialize_element(&v)?,
+                Value::I32(v) => record.serialize_element(&v)?,
+                Value::I64(v) => record.serialize_element(&v)?,
+                Value::U8(v) => record.serialize_element(&v)?,
+                Value::U16(v) => record.serialize_element(&v)?,
+                Value::U32(v) => record.serialize_element(&v)?,
+                Value::U64(v) => record.serialize_element(&v)?,
+                Value::F32(v) => record.serialize_element(&v)?,
+                Value::F64(v) => record.serialize_element(&v)?,
+            }
+        }
+        record.end()
+    }
+}
+
+fn value_bytes<const N: usize>(data: &[u8], row: usize) -> [u8; N] {
+    data[row * N..(row + 1) * N].try_into().unwrap()
+}
+
+fn invalid_file(message: &str) -> Error {
+    Error::new(ErrorKind::InvalidData, message)
+}
+
+fn read_u32(data: &mut impl Read) -> Result<u32, Error> {
+    let mut value = [0u8; 4];
+    data.read_exact(&mut value)?;
+    Ok(u32::from_le_bytes(value))
+}
+
+fn read_u64(data: &mut impl Read) -> Result<u64, Error> {
+    let mut value = [0u8; 8];
+    data.read_exact(&mut value)?;
+    Ok(u64::from_le_bytes(value))
+}
+
+fn read_string(data: &mut impl Read) -> Result<String, Error> {
+    let mut length = [0u8; 2];
+    data.read_exact(&mut length)?;
+    let mut value = vec![0u8; u16::from_le_bytes(length) as usize];
+    data.read_exact(&mut value)?;
+    String::from_utf8(value).map_err(|_| invalid_file("invalid column name"))
+}
@@ -0,0 +1,497 @@
+use flate2::{write::ZlibEncoder, Compression};
+use serde::{ser, Serialize};
+use std::io::{prelude::*, ErrorKind};
+
+use crate::error::{Error, Result};
+
+// The columnar format stores every elementary field of a record as a typed column. All values are
+// little endian, the layout is:
+//
+//   u64 COLUMNAR_MARKER
+//   u32 number of columns
+//   per column: u8 column type, u16 name length, name (UTF-8, field names joined by '.')
+//   blocks of up to ROWS_PER_BLOCK rows:
+//     u32 number of rows
+//     per column: u32 compressed size, zlib compressed values (bool columns as bitset, LSB first)
+//   u32 0 (end of file)
+//
+// Only one block per column is kept in memory, so the memory usage does not depend on the input.
+// Writers without header and end produce parts that can be concatenated to a single file. The files
+// are read by ColumnarReader (fdr2csv --from-columnar converts them to CSV).
+pub const COLUMNAR_MARKER: u64 = u64::from_le_bytes(*b"FDRCOLMN");
+
+const ROWS_PER_BLOCK: usize = 4096;
+
+#[derive(Clone, Copy, Debug, PartialEq)]
+#[repr(u8)]
+pub enum ColumnType {
+    Bool = 0,
+    I8 = 1,
+    I16 = 2,
+    I32 = 3,
+    I64 = 4,
+    U8 = 5,
+    U16 = 6,
+    U32 = 7,
+    U64 = 8,
+    F32 = 9,
+    F64 = 10,
+}
+
+impl ColumnType {
+    pub fn from_u8(value: u8) -> Option<Self> {
+        match value {
+            0 => Some(ColumnType::Bool),
+            1 => Some(ColumnType::I8),
+            2 => Some(ColumnType::I16),
+            3 => Some(ColumnType::I32),
+            4 => Some(ColumnType::I64),
+            5 => Some(ColumnType::U8),
+            6 => Some(ColumnType::U16),
+            7 => Some(ColumnType::U32),
+            8 => Some(ColumnType::U64),
+            9 => Some(ColumnType::F32),
+            10 => Some(ColumnType::F64),
+            _ => None,
+        }
+    }
+
+    // Size of the values of a block of the given number of rows
+    pub fn data_size(self, rows: usize) -> usize {
+        match self {
+            ColumnType::Bool => (rows + 7) / 8,
+            ColumnType::I8 | ColumnType::U8 => rows,
+            ColumnType::I16 | ColumnType::U16 => rows * 2,
+            ColumnType::I32 | ColumnType::U32 | ColumnType::F32 => rows * 4,
+            ColumnType::I64 | ColumnType::U64 | ColumnType::F64 => rows * 8,
+        }
+    }
+}
+
+struct Column {
+    name: String,
+    column_type: ColumnType,
+    data: Vec<u8>,
+}
+
+pub struct ColumnarWriter<W: Write> {
+    writer: W,
+    columns: Vec<Column>,
+
+    // Number of rows in the current block
+    rows: usize,
+
+    // The schema is built from the field names and types of the first serialized record
+    building_schema: bool,
+    field_name_list: Vec<String>,
+    column_index: usize,
+}
+
+impl<W: Write> ColumnarWriter<W> {
+    // Creates the writer and optionally writes the schema, which is taken from the given record
+    pub fn new<T: Serialize>(writer: W, schema: &T, write_header: bool) -> std::io::Result<Self> {
+        let mut columnar_writer = ColumnarWriter {
+            writer,
+            columns: Vec::new(),
+            rows: 0,
+            building_schema: true,
+            field_name_list: Vec::new(),
+            column_index: 0,
+        };
+        schema
+            .serialize(&mut columnar_writer)
+            .map_err(to_io_error)?;
+        columnar_writer.building_schema = false;
+
+        if !write_header {
+            return Ok(columnar_writer);
+        }
+
+        columnar_writer
+            .writer
+            .write_all(&COLUMNAR_MARKER.to_le_bytes())?;
+        columnar_writer
+            .writer
+            .write_all(&(columnar_writer.columns.len() as u32).to_le_bytes())?;
+        for column in &columnar_writer.columns {
+            columnar_writer
+                .writer
+                .write_all(&[column.column_type as u8])?;
+            columnar_writer
+                .writer
+                .write_all(&(column.name.len() as u16).to_le_bytes())?;
+            columnar_writer.writer.write_all(column.name.as_bytes())?;
+        }
+
+        Ok(columnar_writer)
+    }
+
+    pub fn serialize<T: Serialize>(&mut self, record: &T) -> std::io::Result<()> {
+        self.column_index = 0;
+        record.serialize(&mut *self).map_err(to_io_error)?;
+        if self.column_index != self.columns.len() {
+            return Err(to_io_error(schema_mismatch()));
+        }
+
+        self.rows += 1;
+        if self.rows == ROWS_PER_BLOCK {
+            self.write_block()?;
+        }
+
+        Ok(())
+    }
+
+    // Writes the remaining rows and optionally the end of the file
+    pub fn finish(mut self, write_end: bool) -> std::io::Result<()> {
+        if self.rows > 0 {
+            self.write_block()?;
+        }
+        if write_end {
+            self.writer.write_all(&0u32.to_le_bytes())?;
+        }
+        self.writer.flush()
+    }
+
+    fn write_block(&mut self) -> std::io::Result<()> {
+        self.writer.write_all(&(self.rows as u32).to_le_bytes())?;
+        for column in &mut self.columns {
+            let mut encoder = ZlibEncoder::new(Vec::new(), Compression::fast());
+            encoder.write_all(&column.data)?;
+            let compressed = encoder.finish()?;
+            self.writer
+                .write_all(&(compressed.len() as u32).to_le_bytes())?;
+            self.writer.write_all(&compressed)?;
+            column.data.clear();
+        }
+        self.rows = 0;
+
+        Ok(())
+    }
+
+    // Returns the column of the current field, or adds it while the schema is built
+    fn next_column(&mut self, column_type: ColumnType) -> Result<Option<&mut Column>> {
+        if self.building_schema {
+            self.columns.push(Column {
+                name: self.field_name_list.join("."),
+                column_type,
+                data: Vec::new(),
+            });
+            return Ok(None);
+        }
+
+        let column = self
+            .columns
+            .get_mut(self.column_index)
+            .filter(|column| column.column_type == column_type)
+            .ok_or_else(schema_mismatch)?;
+        self.column_index += 1;
+
+        Ok(Some(column))
+    }
+
+    fn serialize_value(&mut self, column_type: ColumnType, bytes: &[u8]) -> Result<()> {
+        if let Some(column) = self.next_column(column_type)? {
+            column.data.extend_from_slice(bytes);
+        }
+        Ok(())
+    }
+
+    fn serialize_bit(&mut self, value: bool) -> Result<()> {
+        let bit = self.rows % 8;
+        if let Some(column) = self.next_column(ColumnType::Bool)? {
+            if bit == 0 {
+                column.data.push(0);
+            }
+            if value {
+                *column.data.last_mut().unwrap() |= 1 << bit;
+            }
+        }
+        Ok(())
+    }
+}
+
+fn schema_mismatch() -> Error {
+    Error::Message("Record does not match the schema".to_owned())
+}
+
+fn to_io_error(error: Error) -> std::io::Error {
+    std::io::Error::new(ErrorKind::Other, error.to_string())
+}
+
+impl<'a, W: Write> ser::Serializer for &'a mut ColumnarWriter<W> {
+    type Ok = ();
+    type Error = Error;
+
+    type SerializeSeq = ser::Impossible<(), Error>;
+    type SerializeTuple = ser::Impossible<(), Error>;
+    type SerializeTupleStruct = ser::Impossible<(), Error>;
+    type SerializeTupleVariant = ser::Impossible<(), Error>;
+    type SerializeMap = ser::Impossible<(), Error>;
+    type SerializeStruct = Self;
+    type SerializeStructVariant = ser::Impossible<(), Error>;
+
+    // Every elementary data type is appended to its own column
+    fn serialize_bool(self, v: bool) -> Result<()> {
+        self.serialize_bit(v)
+    }
+
+    fn serialize_i8(self, v: i8) -> Result<()> {
+        self.serialize_value(ColumnType::I8, &v.to_le_bytes())
+    }
+
+    fn serialize_i16(self, v: i16) -> Result<()> {
+        self.serialize_value(ColumnType::I16, &v.to_le_bytes())
+    }
+
+    fn serialize_i32(self, v: i32) -> Result<()> {
+        self.serialize_value(ColumnType::I32, &v.to_le_bytes())
+    }
+
+    fn serialize_i64(self, v: i64) -> Result<()> {
+        self.serialize_value(ColumnType::I64, &v.to_le_bytes())
+    }
+
+    fn serialize_u8(self, v: u8) -> Result<()> {
+        self.serialize_value(ColumnType::U8, &v.to_le_bytes())
+    }
+
+    fn serialize_u16(self, v: u16) -> Result<()> {
+        self.serialize_value(ColumnType::U16, &v.to_le_bytes())
+    }
+
+    fn serialize_u32(self, v: u32) -> Result<()> {
+        self.serialize_value(ColumnType::U32, &v.to_le_bytes())
+    }
+
+    fn serialize_u64(self, v: u64) -> Result<()> {
+        self.serialize_value(ColumnType::U64, &v.to_le_bytes())
+    }
+
+    fn serialize_f32(self, v: f32) -> Result<()> {
+        self.serialize_value(ColumnType::F32, &v.to_le_bytes())
+    }
+
+    fn serialize_f64(self, v: f64) -> Result<()> {
+        self.serialize_value(ColumnType::F64, &v.to_le_bytes())
+    }
+
+    fn serialize_char(self, _v: char) -> Result<()> {
+        Err(Error::Message("Unsupported datatype".to_owned()))
+    }
+
+    fn serialize_str(self, _v: &str) -> Result<()> {
+        Err(Error::Message("Unsupported datatype".to_owned()))
+    }
+
+    fn serialize_bytes(self, _v: &[u8]) -> Result<()> {
+        Err(Error::Message("Unsupported datatype".to_owned()))
+    }
+
+    fn serialize_none(self) -> Result<()> {
+        Err(Error::Message("Unsupported datatype".to_owned()))
+    }
+
+    fn serialize_some<T>(self, _value: &T) -> Result<()>
+    where
+        T: ?Sized + Serialize,
+    {
+        Err(Error::Message("Unsupported datatype".to_owned()))
+    }
+
+    fn serialize_unit(self) -> Result<()> {
+        Err(Error::Message("Unsupported datatype".to_owned()))
+    }
+
+    fn serialize_unit_struct(self, _name: &'static str) -> Result<()> {
+        Err(Error::Message("Unsupported datatype".to_owned()))
+    }
+
+    fn serialize_unit_variant(
+        self,
+        _name: &'static str,
+        _variant_index: u32,
+        _variant: &'static str,
+    ) -> Result<()> {
+        Err(Error::Message("Unsupported datatype".to_owned()))
+    }
+
+    fn serialize_newtype_struct<T>(self, _name: &'static str, _value: &T) -> Result<()>
+    where
+        T: ?Sized + Serialize,
+    {
+        Err(Error::Message("Unsupported datatype".to_owned()))
+    }
+
+    fn serialize_newtype_variant<T>(
+        self,
+        _name: &'static str,
+        _variant_index: u32,
+        _variant: &'static str,
+        _value: &T,
+    ) -> Result<()>
+    where
+        T: ?Sized + Serialize,
+    {
+        Err(Error::Message("Unsupported datatype".to_owned()))
+    }
+
+    fn serialize_seq(self, _len: Option<usize>) -> Result<Self::SerializeSeq> {
+        Err(Error::Message("Unsupported datatype".to_owned()))
+    }
+
+    fn serialize_tuple(self, _len: usize) -> Result<Self::SerializeTuple> {
+        Err(Error::Message("Unsupported datatype".to_owned()))
+    }
+
+    fn serialize_tuple_struct(
+        self,
+        _name: &'static str,
+        _len: usize,
+    ) -> Result<Self::SerializeTupleStruct> {
+        Err(Error::Message("Unsupported datatype".to_owned()))
+    }
+
+    fn serialize_tuple_variant(
+        self,
+        _name: &'static str,
+        _variant_index: u32,
+        _variant: &'static str,
+        _len: usize,
+    ) -> Result<Self::SerializeTupleVariant> {
+        Err(Error::Message("Unsupported datatype".to_owned()))
+    }
+
+    fn serialize_map(self, _len: Option<usize>) -> Result<Self::SerializeMap> {
+        Err(Error::Message("Unsupported datatype".to_owned()))
+    }
+
+    // For structs, return this as the Serializer. Nothing else needs to be done here.
+    fn serialize_struct(self, _name: &'static str, _len: usize) -> Result<Self::SerializeStruct> {
+        Ok(self)
+    }
+
+    fn serialize_struct_variant(
+        self,
+        _name: &'static str,
+        _variant_index: u32,
+        _variant: &'static str,
+        _len: usize,
+    ) -> Result<Self::SerializeStructVariant> {
+        Err(Error::Message("Unsupported datatype".to_owned()))
+    }
+}
+
+// The field names are only needed to name the columns while the schema is built
+impl<'a, W: Write> ser::SerializeStruct for &'a mut ColumnarWriter<W> {
+    type Ok = ();
+    type Error = Error;
+
+    fn serialize_field<T>(&mut self, key: &'static str, value: &T) -> Result<()>
+    where
+        T: ?Sized + Serialize,
+    {
+        if self.building_schema {
+            self.field_name_list.push(key.to_owned());
+            value.serialize(&mut **self)?;
+            self.field_name_list.pop();
+            Ok(())
+        } else {
+            value.serialize(&mut **self)
+        }
+    }
+
+    fn end(self) -> Result<()> {
+        Ok(())
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use crate::a339x_headers::base_arinc_429;
+    use crate::columnar_reader::{ColumnarReader, Value};
+
+    #[derive(Serialize)]
+    struct Record {
+        simulation_time: f64,
+        on_ground: bool,
+        altitude: base_arinc_429,
+    }
+
+    fn record(row: usize) -> Record {
+        Record {
+            simulation_time: match row {
+                1 => f64::NAN,
+                2 => -0.0,
+                _ => row as f64 * 0.1,
+            },
+            on_ground: row % 3 == 0,
+            altitude: base_arinc_429 {
+                SSM: (row % 4) as u32,
+                Data: row as f32 * 2.5,
+            },
+        }
+    }
+
+    // The rows span a full block and a partial block that does not end on a byte of the bitset
+    #[test]
+    fn round_trip_across_block_boundary() {
+        let row_count = ROWS_PER_BLOCK + 13;
+        let mut file = Vec::new();
+        let mut writer = ColumnarWriter::new(&mut file, &record(0), true).unwrap();
+        for row in 0..row_count {
+            writer.serialize(&record(row)).unwrap();
+        }
+        writer.finish(true).unwrap();
+
+        let mut reader = ColumnarReader::new(file.as_slice()).unwrap();
+        let columns: Vec<(&str, ColumnType)> = reader
+            .columns()
+            .iter()
+            .map(|column| (column.name.as_str(), column.column_type))
+            .collect();
+        assert_eq!(
+            columns,
+            [
+                ("simulation_time", ColumnType::F64),
+                ("on_ground", ColumnType::Bool),
+                ("altitude.SSM", ColumnType::U32),
+                ("altitude.Data", ColumnType::F32),
+            ]
+        );
+
+        let mut row = 0;
+        let mut block_rows = Vec::new();
+        while let Some(block) = reader.read_block().unwrap() {
+            block_rows.push(block.rows());
+            for i in 0..block.rows() {
+                let expected = record(row);
+                let Value::F64(simulation_time) = block.value(0, i) else {
+                    panic!("simulation_time of row {row} is not f64");
+                };
+                assert_eq!(
+                    simulation_time.to_bits(),
+                    expected.simulation_time.to_bits()
+                );
+                assert_eq!(
+                    block.value(1, i),
+                    Value::Bool(expected.on_ground),
+                    "row {row}"
+                );
+                assert_eq!(
+                    block.value(2, i),
+                    Value::U32(expected.altitude.SSM),
+                    "row {row}"
+                );
+                assert_eq!(
+                    block.value(3, i),
+                    Value::F32(expected.altitude.Data),
+                    "row {row}"
+                );
+                row += 1;
+            }
+        }
+        assert_eq!(block_rows, [ROWS_PER_BLOCK, 13]);
+        assert_eq!(row, row_count);
+    }
+}
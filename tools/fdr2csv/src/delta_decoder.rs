@@ -0,0 +1,84 @@
+use std::io::{prelude::*, Error, ErrorKind};
+
+// Delta encoded files start with this marker, followed by the interface version, the frame size
+// and the keyframe interval (all u64)
+pub const DELTA_ENCODING_MARKER: u64 = u64::from_le_bytes(*b"FDRDELTA");
+
+// Reader that restores the raw frames of a delta encoded file. Every n-th frame of a file or of a
+// block of a chunked container is a keyframe and stored as is, all other frames are stored as XOR
+// against the previous frame.
+pub struct DeltaDecoder<R: Read> {
+    inner: R,
+    keyframe_interval: u64,
+    frames_per_block: u64,
+    frame_index: u64,
+    previous: Vec<u8>,
+    current: Vec<u8>,
+    position: usize,
+}
+
+impl<R: Read> DeltaDecoder<R> {
+    // The input needs to start at a file or block boundary, a frames_per_block of 0 means that the
+    // input is not split into blocks
+    pub fn new(inner: R, frame_size: usize, keyframe_interval: u64, frames_per_block: u64) -> Self {
+        DeltaDecoder {
+            inner,
+            keyframe_interval: keyframe_interval.max(1),
+            frames_per_block,
+            frame_index: 0,
+            previous: vec![0u8; frame_size],
+            current: vec![0u8; frame_size],
+            position: frame_size,
+        }
+    }
+
+    // Reads and decodes the next frame, returns false at the end of the input
+    fn read_frame(&mut self) -> Result<bool, Error> {
+        let mut filled = 0;
+        while filled < self.current.len() {
+            match self.inner.read(&mut self.current[filled..]) {
+                Ok(0) => break,
+                Ok(n) => filled += n,
+                Err(e) if e.kind() == ErrorKind::Interrupted => continue,
+                Err(e) => return Err(e),
+            }
+        }
+
+        // the input may only end at a frame boundary
+        if filled == 0 {
+            return Ok(false);
+        } else if filled < self.current.len() {
+            return Err(Error::new(ErrorKind::UnexpectedEof, "Truncated frame"));
+        }
+
+        let block_frame_index = if self.frames_per_block > 0 {
+            self.frame_index % self.frames_per_block
+        } else {
+            self.frame_index
+        };
+        if block_frame_index % self.keyframe_interval != 0 {
+            for (value, previous) in self.current.iter_mut().zip(self.previous.iter()) {
+                *value ^= previous;
+            }
+        }
+        self.previous.copy_from_slice(&self.current);
+        self.frame_index += 1;
+        self.position = 0;
+
+        Ok(true)
+    }
+}
+
+impl<R: Read> Read for DeltaDecoder<R> {
+    fn read(&mut self, buf: &mut [u8]) -> Result<usize, Error> {
+        if self.position == self.current.len() && !self.read_frame()? {
+            return Ok(0);
+        }
+
+        let count = buf.len().min(self.current.len() - self.position);
+        buf[..count].copy_from_slice(&self.current[self.position..self.position + count]);
+        self.position += count;
+
+        Ok(count)
+    }
+}
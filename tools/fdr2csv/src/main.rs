@@ -1,33 +1,57 @@
 use bytemuck::AnyBitPattern;
 use clap::Parser;
-use csv::WriterBuilder;
+use columnar_reader::ColumnarReader;
+use columnar_writer::ColumnarWriter;
+use csv::{Writer, WriterBuilder};
 use flate2::bufread::GzDecoder;
+use schema::Schema;
+use serde::Serialize;
 use std::{
-    fs::{File, OpenOptions},
-    io::{prelude::*, BufReader, BufWriter, Error, ErrorKind},
+    cell::RefCell,
+    fs::{self, File, OpenOptions},
+    io::{prelude::*, BufReader, BufWriter, Error, ErrorKind, SeekFrom},
     mem,
+    path::Path,
+    sync::{
+        atomic::{AtomicUsize, Ordering},
+        Mutex,
+    },
+    thread,
 };
 
 mod a333x;
 mod a333x_headers;
 mod a339x;
 mod a339x_headers;
+mod chunked_reader;
+mod columnar_reader;
+mod columnar_writer;
 mod su95x;
 mod su95x_headers;
 mod csv_header_serializer;
+mod delta_decoder;
 mod error;
+mod schema;
 
-#[derive(Debug)]
+#[derive(Debug, Clone, Copy, PartialEq)]
 enum AircraftType {
     A333X,
     A339X,
     SU95X,
 }
 
+// Layout of the records of a file, either known to the converter by the interface version or
+// described by the schema of the file
+#[derive(Debug, PartialEq)]
+enum RecordLayout {
+    Aircraft(AircraftType),
+    Schema(Schema),
+}
+
 #[derive(Parser, Debug)]
 #[command(version, about, long_about = None)]
 struct Args {
-    /// Input file
+    /// Input file, or a directory whose .fdr files are converted in parallel into one output
     #[arg(short, long)]
     input: String,
     /// Output file
@@ -48,48 +72,182 @@ struct Args {
     /// Print raw interface version of input file
     #[arg(short = 'r', long, default_value_t = false)]
     get_raw_input_file_version: bool,
+    /// Only convert entries with a simulation time at or after this time (s)
+    #[arg(long)]
+    from: Option<f64>,
+    /// Only convert entries with a simulation time at or before this time (s)
+    #[arg(long)]
+    to: Option<f64>,
+    /// Write typed columns in compressed blocks instead of CSV
+    #[arg(short, long, default_value_t = false)]
+    columnar: bool,
+    /// Input file was written with --columnar, convert it to CSV
+    #[arg(long, default_value_t = false, conflicts_with_all(["columnar", "fields", "from", "to"]))]
+    from_columnar: bool,
+    /// Only convert these comma separated fields, a name also selects all fields below it (e.g.
+    /// "base,fmgc_1.athr"). Requires a file with schema.
+    #[arg(long)]
+    fields: Option<String>,
+}
+
+enum OutputWriter {
+    Csv(Writer<BufWriter<File>>),
+    Columnar(ColumnarWriter<BufWriter<File>>),
+}
+
+impl OutputWriter {
+    fn serialize<T: Serialize>(&mut self, record: &T) -> Result<(), std::io::Error> {
+        match self {
+            OutputWriter::Csv(writer) => Ok(writer.serialize(record)?),
+            OutputWriter::Columnar(writer) => writer.serialize(record),
+        }
+    }
+
+    fn finish(self, write_end: bool) -> Result<(), std::io::Error> {
+        match self {
+            OutputWriter::Csv(mut writer) => writer.flush(),
+            OutputWriter::Columnar(writer) => writer.finish(write_end),
+        }
+    }
+}
+
+// Size of the buffer between the decompression and the record parsing
+const READ_BUFFER_SIZE: usize = 1 << 20;
+
+thread_local! {
+    // Buffer reused by read_bytes, values are copied out of it so it needs no alignment
+    static READ_BYTES_BUFFER: RefCell<Vec<u8>> = RefCell::new(Vec::new());
 }
 
 // Read number of bytes specified by the size of T from the binary file
 pub fn read_bytes<T: AnyBitPattern>(reader: &mut impl Read) -> Result<T, Error> {
     let size = mem::size_of::<T>();
 
-    // allocate the buffer that will hold the value read from the binary
-    let mut buf = vec![0u8; size];
-
-    // now read from the reader into the buffer
-    reader.read_exact(&mut buf)?;
+    READ_BYTES_BUFFER.with(|buffer| {
+        let mut buf = buffer.borrow_mut();
+        if buf.len() < size {
+            buf.resize(size, 0);
+        }
 
-    // If the read was successful, reinterpret the bytes as the struct, and return
-    let res = bytemuck::from_bytes::<T>(buf.as_slice());
+        // now read from the reader into the buffer
+        reader.read_exact(&mut buf[..size])?;
 
-    Ok(*res)
+        // If the read was successful, reinterpret the bytes as the struct, and return
+        Ok(bytemuck::pod_read_unaligned::<T>(&buf[..size]))
+    })
 }
 
-fn main() -> Result<(), std::io::Error> {
-    // Parse CLI arguments
-    let args = Args::parse();
-
-    // Open the input file
-    let in_file = File::open(args.input.trim())
+// Opens the input file, returns the file version, the schema if the file has one and a reader
+// positioned at the first record
+fn open_input(input: &str, args: &Args) -> Result<(u64, Option<Schema>, Box<dyn Read>), Error> {
+    let mut in_file = File::open(input.trim())
         .map_err(|e| std::io::Error::new(e.kind(), "Failed to open input file!"))?;
 
-    // Create Gzip Reader
-    let mut reader: Box<dyn Read> = if args.no_compression {
-        Box::new(BufReader::new(in_file))
+    // Chunked containers start with an uncompressed marker and are read through their block index
+    let is_chunked_container =
+        read_bytes::<u64>(&mut in_file).ok() == Some(chunked_reader::CHUNKED_CONTAINER_MARKER);
+
+    let mut reader: Box<dyn Read>;
+    let mut file_format_version;
+    let schema;
+    if is_chunked_container {
+        (file_format_version, schema, reader) = chunked_reader::open(in_file, args.from)?;
     } else {
-        Box::new(GzDecoder::new(BufReader::new(in_file)))
-    };
+        in_file.seek(SeekFrom::Start(0))?;
+
+        // Create Gzip Reader
+        reader = if args.no_compression {
+            Box::new(BufReader::new(in_file))
+        } else {
+            Box::new(GzDecoder::new(BufReader::new(in_file)))
+        };
+
+        // Read file version, delta encoded files carry it after the marker
+        file_format_version = read_bytes::<u64>(&mut reader)?;
+        let is_delta_encoded = file_format_version == delta_decoder::DELTA_ENCODING_MARKER;
+        let mut frame_size = 0;
+        let mut keyframe_interval = 0;
+        if is_delta_encoded {
+            file_format_version = read_bytes::<u64>(&mut reader)?;
+            frame_size = read_bytes::<u64>(&mut reader)?;
+            keyframe_interval = read_bytes::<u64>(&mut reader)?;
+        }
+
+        // The schema follows the header and is not delta encoded
+        (schema, reader) = Schema::read_optional(reader)?;
+
+        if is_delta_encoded {
+            reader = Box::new(delta_decoder::DeltaDecoder::new(
+                reader,
+                frame_size as usize,
+                keyframe_interval,
+                0,
+            ));
+        }
+    }
+
+    // Records are parsed from large decompressed chunks instead of inflating every field on its own
+    Ok((
+        file_format_version,
+        schema,
+        Box::new(BufReader::with_capacity(READ_BUFFER_SIZE, reader)),
+    ))
+}
 
-    // Read file version
-    let file_format_version = read_bytes::<u64>(&mut reader)?;
-    let aircraft_type = if file_format_version > a339x::INTERFACE_MIN_VERSION {
+fn get_aircraft_type(file_format_version: u64) -> AircraftType {
+    if file_format_version > a339x::INTERFACE_MIN_VERSION {
         AircraftType::A339X
     } else if file_format_version > su95x::INTERFACE_MIN_VERSION {
         AircraftType::A333X
     } else {
         AircraftType::SU95X
-    };
+    }
+}
+
+// Creates the output writer, the CSV header and the columnar schema are taken from the given record
+fn create_writer<T: Serialize>(
+    mut buf_writer: BufWriter<File>,
+    record: &T,
+    args: &Args,
+    write_header: bool,
+) -> Result<OutputWriter, Error> {
+    if args.columnar {
+        return Ok(OutputWriter::Columnar(ColumnarWriter::new(
+            buf_writer,
+            record,
+            write_header,
+        )?));
+    }
+
+    // Generate and write the header
+    if write_header {
+        let header = csv_header_serializer::to_string(record, args.delimiter)
+            .map_err(|_| std::io::Error::new(ErrorKind::Other, "Failed to generate header."))?;
+
+        buf_writer.write(header.as_bytes())?;
+    }
+
+    // Create the CSV writer
+    Ok(OutputWriter::Csv(
+        WriterBuilder::new()
+            .delimiter(args.delimiter as u8)
+            .has_headers(false)
+            .from_writer(buf_writer),
+    ))
+}
+
+// Converts a single file. The header and the end of the output are optional, so that the outputs
+// of consecutive files can be concatenated.
+fn convert(
+    input: &str,
+    output: &str,
+    args: &Args,
+    write_header: bool,
+    write_end: bool,
+    print_progress: bool,
+) -> Result<(RecordLayout, u64), Error> {
+    let (file_format_version, schema, mut reader) = open_input(input, args)?;
+    let aircraft_type = get_aircraft_type(file_format_version);
 
     let aircraft_interface_version = match aircraft_type {
         AircraftType::SU95X => su95x::INTERFACE_VERSION,
@@ -97,97 +255,155 @@ fn main() -> Result<(), std::io::Error> {
         AircraftType::A339X => a339x::INTERFACE_VERSION,
     };
 
-    // Print or check file version
-    if args.get_input_file_version {
-        println!(
-            "Aircraft Type is {:?}, Interface version is {}",
-            aircraft_type, file_format_version
-        );
-        return Ok(());
-    } else if args.get_raw_input_file_version {
-        println!("{}", file_format_version);
-        return Ok(());
-    } else if aircraft_interface_version != file_format_version {
-        return Err(std::io::Error::new(
-            ErrorKind::InvalidInput,
-            format!(
-                "Mismatch between converter and file version (expected {aircraft_interface_version}, got {file_format_version})",
-            ),
-        ));
-    }
+    // Check file version, files with schema can be converted independent of the version
+    let layout = match schema {
+        Some(mut schema) => {
+            if let Some(fields) = &args.fields {
+                schema.project(fields)?;
+            }
+            if (args.from.is_some() || args.to.is_some()) && !schema.has_simulation_time() {
+                return Err(std::io::Error::new(
+                    ErrorKind::InvalidInput,
+                    format!("Schema of '{input}' has no simulation time to select the time range"),
+                ));
+            }
+            RecordLayout::Schema(schema)
+        }
+        None => {
+            if args.fields.is_some() {
+                return Err(std::io::Error::new(
+                    ErrorKind::InvalidInput,
+                    format!("'{input}' has no schema to select fields from"),
+                ));
+            }
+            if aircraft_interface_version != file_format_version {
+                return Err(std::io::Error::new(
+                    ErrorKind::InvalidInput,
+                    format!(
+                        "Mismatch between converter and file version of '{input}' (expected {aircraft_interface_version}, got {file_format_version})",
+                    ),
+                ));
+            }
+            RecordLayout::Aircraft(aircraft_type)
+        }
+    };
 
     // Print info on conversion start
-    println!(
-        "Converting from '{}' to '{}' for aircraft type '{:?}' with interface version '{}' and delimiter '{}'",
-        args.input, args.output.clone().unwrap(), aircraft_type, file_format_version, args.delimiter
-    );
+    match &layout {
+        RecordLayout::Aircraft(aircraft_type) => println!(
+            "Converting from '{}' to '{}' for aircraft type '{:?}' with interface version '{}' and delimiter '{}'",
+            input, output, aircraft_type, file_format_version, args.delimiter
+        ),
+        RecordLayout::Schema(_) => println!(
+            "Converting from '{}' to '{}' using the schema of the file with interface version '{}' and delimiter '{}'",
+            input, output, file_format_version, args.delimiter
+        ),
+    }
+
+    // Time range to convert, entries are ordered by simulation time
+    let from = args.from.unwrap_or(f64::NEG_INFINITY);
+    let to = args.to.unwrap_or(f64::INFINITY);
 
     // Open or create output file in truncate mode
     let out_file = OpenOptions::new()
         .write(true)
         .truncate(true)
         .create(true)
-        .open(args.output.clone().unwrap().trim())
+        .open(output.trim())
         .map_err(|e| std::io::Error::new(e.kind(), "Failed to open output file!"))?;
 
-    let mut buf_writer = BufWriter::new(out_file);
+    let buf_writer = BufWriter::new(out_file);
 
     let mut counter = 0;
 
-    // Generate and write the header
-    let header = match aircraft_type {
-        AircraftType::SU95X => {
-            csv_header_serializer::to_string(&su95x::FdrData::default(), args.delimiter)
+    // Create the writer, the header is taken from a default record
+    let mut writer = match &layout {
+        RecordLayout::Aircraft(AircraftType::SU95X) => {
+            create_writer(buf_writer, &su95x::FdrData::default(), args, write_header)
         }
-        AircraftType::A333X => {
-            csv_header_serializer::to_string(&a333x::FdrData::default(), args.delimiter)
+        RecordLayout::Aircraft(AircraftType::A333X) => {
+            create_writer(buf_writer, &a333x::FdrData::default(), args, write_header)
         }
-        AircraftType::A339X => {
-            csv_header_serializer::to_string(&a339x::FdrData::default(), args.delimiter)
+        RecordLayout::Aircraft(AircraftType::A339X) => {
+            create_writer(buf_writer, &a339x::FdrData::default(), args, write_header)
         }
-    }
-    .map_err(|_| std::io::Error::new(ErrorKind::Other, "Failed to generate header."))?;
-
-    buf_writer.write(header.as_bytes())?;
-
-    // Create the CSV writer, and serialize the file.
-    let mut writer = WriterBuilder::new()
-        .delimiter(args.delimiter as u8)
-        .has_headers(false)
-        .from_writer(buf_writer);
+        RecordLayout::Schema(schema) => create_writer(
+            buf_writer,
+            &schema.record(&vec![0u8; schema.frame_size()]),
+            args,
+            write_header,
+        ),
+    }?;
 
-    match aircraft_type {
-        AircraftType::SU95X => {
+    match &layout {
+        RecordLayout::Aircraft(AircraftType::SU95X) => {
             while let Ok(fdr_data) = su95x::read_record(&mut reader) {
+                if fdr_data.simulation_time() < from {
+                    continue;
+                } else if fdr_data.simulation_time() > to {
+                    break;
+                }
+
                 writer.serialize(&fdr_data)?;
 
                 counter += 1;
 
-                if counter % 1000 == 0 {
+                if print_progress && counter % 1000 == 0 {
                     print!("Processed {counter} entries...\r");
                     std::io::stdout().flush()?;
                 }
             }
         }
-        AircraftType::A333X => {
+        RecordLayout::Aircraft(AircraftType::A333X) => {
             while let Ok(fdr_data) = a333x::read_record(&mut reader) {
+                if fdr_data.simulation_time() < from {
+                    continue;
+                } else if fdr_data.simulation_time() > to {
+                    break;
+                }
+
                 writer.serialize(&fdr_data)?;
 
                 counter += 1;
 
-                if counter % 1000 == 0 {
+                if print_progress && counter % 1000 == 0 {
                     print!("Processed {counter} entries...\r");
                     std::io::stdout().flush()?;
                 }
             }
         }
-        AircraftType::A339X => {
+        RecordLayout::Aircraft(AircraftType::A339X) => {
             while let Ok(fdr_data) = a339x::read_record(&mut reader) {
+                if fdr_data.simulation_time() < from {
+                    continue;
+                } else if fdr_data.simulation_time() > to {
+                    break;
+                }
+
                 writer.serialize(&fdr_data)?;
 
                 counter += 1;
 
-                if counter % 1000 == 0 {
+                if print_progress && counter % 1000 == 0 {
+                    print!("Processed {counter} entries...\r");
+                    std::io::stdout().flush()?;
+                }
+            }
+        }
+        RecordLayout::Schema(schema) => {
+            let mut frame = vec![0u8; schema.frame_size()];
+            while reader.read_exact(&mut frame).is_ok() {
+                if schema.simulation_time(&frame) < from {
+                    continue;
+                } else if schema.simulation_time(&frame) > to {
+                    break;
+                }
+
+                writer.serialize(&schema.record(&frame))?;
+
+                counter += 1;
+
+                if print_progress && counter % 1000 == 0 {
                     print!("Processed {counter} entries...\r");
                     std::io::stdout().flush()?;
                 }
@@ -195,6 +411,212 @@ fn main() -> Result<(), std::io::Error> {
         }
     }
 
+    writer.finish(write_end)?;
+
+    Ok((layout, counter))
+}
+
+// Converts a file written with --columnar to CSV, the header and the values are written like the
+// CSV of the FDR files the columnar file was converted from
+fn convert_columnar(args: &Args) -> Result<u64, Error> {
+    let input = &args.input;
+    let output = args.output.as_ref().unwrap();
+
+    let in_file = File::open(input.trim())
+        .map_err(|e| std::io::Error::new(e.kind(), "Failed to open input file!"))?;
+    let mut reader = ColumnarReader::new(BufReader::with_capacity(READ_BUFFER_SIZE, in_file))?;
+
+    println!(
+        "Converting from columnar file '{}' with {} columns to '{}' with delimiter '{}'",
+        input,
+        reader.columns().len(),
+        output,
+        args.delimiter
+    );
+
+    // Open or create output file in truncate mode
+    let out_file = OpenOptions::new()
+        .write(true)
+        .truncate(true)
+        .create(true)
+        .open(output.trim())
+        .map_err(|e| std::io::Error::new(e.kind(), "Failed to open output file!"))?;
+
+    let mut buf_writer = BufWriter::new(out_file);
+    let mut header = String::new();
+    for column in reader.columns() {
+        header += &column.name;
+        header.push(args.delimiter);
+    }
+    header.push('\n');
+    buf_writer.write_all(header.as_bytes())?;
+
+    let mut writer = WriterBuilder::new()
+        .delimiter(args.delimiter as u8)
+        .has_headers(false)
+        .from_writer(buf_writer);
+
+    let mut counter = 0;
+    while let Some(block) = reader.read_block()? {
+        for row in 0..block.rows() {
+            writer.serialize(block.record(row))?;
+
+            counter += 1;
+
+            if counter % 1000 == 0 {
+                print!("Processed {counter} entries...\r");
+                std::io::stdout().flush()?;
+            }
+        }
+    }
+
+    writer.flush()?;
+
+    Ok(counter)
+}
+
+// Converts all .fdr files of a directory into one output. The files are converted concurrently
+// into temporary parts, which are then concatenated in the order of the file names. The file
+// names are the UTC start time of the recording, so the output is in time order.
+fn convert_directory(args: &Args) -> Result<(), Error> {
+    let output = args.output.clone().unwrap();
+
+    let mut inputs: Vec<String> = fs::read_dir(args.input.trim())?
+        .filter_map(|entry| entry.ok().map(|entry| entry.path()))
+        .filter(|path| {
+            path.extension()
+                .map_or(false, |extension| extension == "fdr")
+        })
+        .map(|path| path.to_string_lossy().into_owned())
+        .collect();
+    inputs.sort();
+
+    if inputs.is_empty() {
+        return Err(std::io::Error::new(
+            ErrorKind::NotFound,
+            "No .fdr files found in input directory!",
+        ));
+    }
+
+    let parts: Vec<String> = (0..inputs.len())
+        .map(|i| format!("{}.part{i}", output.trim()))
+        .collect();
+    let results: Mutex<Vec<Option<Result<(RecordLayout, u64), Error>>>> =
+        Mutex::new((0..inputs.len()).map(|_| None).collect());
+    let next_input = AtomicUsize::new(0);
+    let worker_count = thread::available_parallelism()
+        .map_or(1, |count| count.get())
+        .min(inputs.len());
+
+    // Only the first part has a header and only the last part has an end
+    thread::scope(|scope| {
+        for _ in 0..worker_count {
+            scope.spawn(|| loop {
+                let i = next_input.fetch_add(1, Ordering::Relaxed);
+                if i >= inputs.len() {
+                    break;
+                }
+                let result = convert(
+                    &inputs[i],
+                    &parts[i],
+                    args,
+                    i == 0,
+                    i == inputs.len() - 1,
+                    false,
+                );
+                results.lock().unwrap()[i] = Some(result);
+            });
+        }
+    });
+
+    let mut counter = 0;
+    let mut layouts = Vec::new();
+    let mut first_error = None;
+    for result in results.into_inner().unwrap() {
+        match result.unwrap() {
+            Ok((layout, count)) => {
+                layouts.push(layout);
+                counter += count;
+            }
+            Err(e) => {
+                first_error.get_or_insert(e);
+            }
+        }
+    }
+
+    if first_error.is_none() && layouts.windows(2).any(|layouts| layouts[0] != layouts[1]) {
+        first_error = Some(std::io::Error::new(
+            ErrorKind::InvalidInput,
+            "Input directory contains files of different aircraft types or schemas!",
+        ));
+    }
+
+    // Concatenate the parts in order
+    if first_error.is_none() {
+        let out_file = OpenOptions::new()
+            .write(true)
+            .truncate(true)
+            .create(true)
+            .open(output.trim())
+            .map_err(|e| std::io::Error::new(e.kind(), "Failed to open output file!"))?;
+        let mut buf_writer = BufWriter::new(out_file);
+        for part in &parts {
+            std::io::copy(&mut File::open(part)?, &mut buf_writer)?;
+        }
+        buf_writer.flush()?;
+    }
+
+    for part in &parts {
+        let _ = fs::remove_file(part);
+    }
+
+    match first_error {
+        Some(e) => Err(e),
+        None => {
+            println!("Processed {counter} entries of {} files...", inputs.len());
+            Ok(())
+        }
+    }
+}
+
+fn main() -> Result<(), std::io::Error> {
+    // Parse CLI arguments
+    let args = Args::parse();
+
+    // Print file version
+    if args.get_input_file_version || args.get_raw_input_file_version {
+        let (file_format_version, _, _) = open_input(&args.input, &args)?;
+        if args.get_input_file_version {
+            println!(
+                "Aircraft Type is {:?}, Interface version is {}",
+                get_aircraft_type(file_format_version),
+                file_format_version
+            );
+        } else {
+            println!("{}", file_format_version);
+        }
+        return Ok(());
+    }
+
+    if args.from_columnar {
+        let counter = convert_columnar(&args)?;
+        println!("Processed {counter} entries...");
+        return Ok(());
+    }
+
+    if Path::new(args.input.trim()).is_dir() {
+        return convert_directory(&args);
+    }
+
+    let (_, counter) = convert(
+        &args.input,
+        args.output.as_ref().unwrap(),
+        &args,
+        true,
+        true,
+        true,
+    )?;
+
     println!("Processed {counter} entries...");
 
     Result::Ok(())
@@ -0,0 +1,335 @@
+use serde::{ser::SerializeStruct, Serialize, Serializer};
+use std::io::{prelude::*, Cursor, Error, ErrorKind};
+
+// Files with a schema carry it right after the header, starting with this marker and the size of
+// the schema (u64). All values are little endian, strings are stored with a u16 length:
+//
+//   u32 number of types
+//   per type: name, u32 size, u32 number of fields
+//     per field: name, u8 field type, u32 offset, u32 count (array length), i32 nested type index
+//   u32 number of segments
+//   per segment: name, i32 type index
+//
+// A frame is the sequence of the segments, so the file can be decoded without knowing the
+// interface version it was recorded with.
+pub const SCHEMA_MARKER: u64 = u64::from_le_bytes(*b"FDRSCHEM");
+
+// Name of the field with the simulation time, used to select the time range to convert
+const SIMULATION_TIME_FIELD: &str = "base.simulation_time_s";
+
+#[derive(Clone, Copy, Debug, PartialEq)]
+enum FieldType {
+    Bool,
+    I8,
+    U8,
+    I16,
+    U16,
+    I32,
+    U32,
+    I64,
+    U64,
+    F32,
+    F64,
+}
+
+impl FieldType {
+    fn from_u8(value: u8) -> Option<Self> {
+        match value {
+            0 => Some(FieldType::Bool),
+            1 => Some(FieldType::I8),
+            2 => Some(FieldType::U8),
+            3 => Some(FieldType::I16),
+            4 => Some(FieldType::U16),
+            5 => Some(FieldType::I32),
+            6 => Some(FieldType::U32),
+            7 => Some(FieldType::I64),
+            8 => Some(FieldType::U64),
+            9 => Some(FieldType::F32),
+            10 => Some(FieldType::F64),
+            _ => None,
+        }
+    }
+
+    fn size(self) -> usize {
+        match self {
+            FieldType::Bool | FieldType::I8 | FieldType::U8 => 1,
+            FieldType::I16 | FieldType::U16 => 2,
+            FieldType::I32 | FieldType::U32 | FieldType::F32 => 4,
+            FieldType::I64 | FieldType::U64 | FieldType::F64 => 8,
+        }
+    }
+}
+
+// Field type of nested structs in the type table
+const STRUCT_FIELD_TYPE: u8 = 11;
+
+struct TypeField {
+    name: String,
+    field_type: u8,
+    offset: usize,
+    count: usize,
+    type_index: i32,
+}
+
+struct TypeDefinition {
+    size: usize,
+    fields: Vec<TypeField>,
+}
+
+// Elementary field of a frame, arrays are split into one field per element
+#[derive(Debug, PartialEq)]
+struct Field {
+    // Serde needs static field names, they are allocated once per schema
+    name: &'static str,
+    field_type: FieldType,
+    offset: usize,
+}
+
+#[derive(Debug, PartialEq)]
+pub struct Schema {
+    fields: Vec<Field>,
+    frame_size: usize,
+    simulation_time_offset: Option<usize>,
+}
+
+impl Schema {
+    // Reads the schema after its marker
+    pub fn read(reader: &mut impl Read) -> Result<Self, Error> {
+        let mut size = [0u8; 8];
+        reader.read_exact(&mut size)?;
+        let mut data = vec![0u8; u64::from_le_bytes(size) as usize];
+        reader.read_exact(&mut data)?;
+
+        Self::parse(&mut Cursor::new(data))
+            .map_err(|e| Error::new(ErrorKind::InvalidData, format!("Invalid schema: {e}")))
+    }
+
+    // Reads the schema if the reader is positioned at one. The returned reader continues at the
+    // first frame.
+    pub fn read_optional(
+        mut reader: Box<dyn Read>,
+    ) -> Result<(Option<Self>, Box<dyn Read>), Error> {
+        let mut marker = Vec::with_capacity(8);
+        reader.by_ref().take(8).read_to_end(&mut marker)?;
+
+        if marker == SCHEMA_MARKER.to_le_bytes() {
+            Ok((Some(Self::read(&mut reader)?), reader))
+        } else {
+            Ok((None, Box::new(Cursor::new(marker).chain(reader))))
+        }
+    }
+
+    fn parse(data: &mut Cursor<Vec<u8>>) -> Result<Self, Error> {
+        let type_count = read_u32(data)? as usize;
+        let mut types: Vec<TypeDefinition> = Vec::with_capacity(type_count);
+        for _ in 0..type_count {
+            let _name = read_string(data)?;
+            let size = read_u32(data)? as usize;
+            let field_count = read_u32(data)? as usize;
+            let mut fields = Vec::with_capacity(field_count);
+            for _ in 0..field_count {
+                fields.push(TypeField {
+                    name: read_string(data)?,
+                    field_type: read_u8(data)?,
+                    offset: read_u32(data)? as usize,
+                    count: read_u32(data)? as usize,
+                    type_index: read_u32(data)? as i32,
+                });
+            }
+            types.push(TypeDefinition { size, fields });
+        }
+
+        let mut schema = Schema {
+            fields: Vec::new(),
+            frame_size: 0,
+            simulation_time_offset: None,
+        };
+
+        let segment_count = read_u32(data)? as usize;
+        for _ in 0..segment_count {
+            let name = read_string(data)?;
+            let type_index = read_u32(data)? as i32;
+            let segment_type = get_type(&types, type_index, types.len())?;
+            schema.add_fields(&types, type_index as usize, &name, schema.frame_size)?;
+            schema.frame_size += segment_type.size;
+        }
+
+        schema.simulation_time_offset = schema
+            .fields
+            .iter()
+            .find(|field| field.name == SIMULATION_TIME_FIELD && field.field_type == FieldType::F64)
+            .map(|field| field.offset);
+
+        Ok(schema)
+    }
+
+    // Adds the elementary fields of the type at the given offset
+    fn add_fields(
+        &mut self,
+        types: &[TypeDefinition],
+        type_index: usize,
+        prefix: &str,
+        offset: usize,
+    ) -> Result<(), Error> {
+        let definition = &types[type_index];
+        for type_field in &definition.fields {
+            // nested types always precede the types using them, which also rules out cycles
+            let (element_size, field_type) = if type_field.field_type == STRUCT_FIELD_TYPE {
+                (
+                    get_type(types, type_field.type_index, type_index)?.size,
+                    None,
+                )
+            } else {
+                let field_type = FieldType::from_u8(type_field.field_type)
+                    .ok_or_else(|| invalid_schema("unknown field type"))?;
+                (field_type.size(), Some(field_type))
+            };
+
+            if type_field.offset + element_size * type_field.count > definition.size {
+                return Err(invalid_schema("field exceeds its type"));
+            }
+
+            for i in 0..type_field.count {
+                let name = if type_field.count > 1 {
+                    format!("{prefix}.{}.{i}", type_field.name)
+                } else {
+                    format!("{prefix}.{}", type_field.name)
+                };
+                let element_offset = offset + type_field.offset + i * element_size;
+
+                match field_type {
+                    Some(field_type) => self.fields.push(Field {
+                        name: Box::leak(name.into_boxed_str()),
+                        field_type,
+                        offset: element_offset,
+                    }),
+                    None => self.add_fields(
+                        types,
+                        type_field.type_index as usize,
+                        &name,
+                        element_offset,
+                    )?,
+                }
+            }
+        }
+
+        Ok(())
+    }
+
+    // Only keeps the fields that match one of the comma separated names, a name also selects all
+    // fields below it (e.g. "fmgc_1.athr")
+    pub fn project(&mut self, names: &str) -> Result<(), Error> {
+        let names: Vec<&str> = names.split(',').map(str::trim).collect();
+        self.fields.retain(|field| {
+            names.iter().any(|name| {
+                field.name == *name
+                    || (field.name.starts_with(name) && field.name[name.len()..].starts_with('.'))
+            })
+        });
+
+        if self.fields.is_empty() {
+            return Err(Error::new(
+                ErrorKind::InvalidInput,
+                "No fields of the schema match the selected fields!",
+            ));
+        }
+        Ok(())
+    }
+
+    pub fn frame_size(&self) -> usize {
+        self.frame_size
+    }
+
+    pub fn has_simulation_time(&self) -> bool {
+        self.simulation_time_offset.is_some()
+    }
+
+    pub fn simulation_time(&self, frame: &[u8]) -> f64 {
+        self.simulation_time_offset
+            .map_or(0.0, |offset| f64::from_le_bytes(value_bytes(frame, offset)))
+    }
+
+    // Returns the record of a frame for serialization with the fields of the schema
+    pub fn record<'a>(&'a self, frame: &'a [u8]) -> SchemaRecord<'a> {
+        SchemaRecord {
+            schema: self,
+            frame,
+        }
+    }
+}
+
+pub struct SchemaRecord<'a> {
+    schema: &'a Schema,
+    frame: &'a [u8],
+}
+
+impl<'a> Serialize for SchemaRecord<'a> {
+    fn serialize<S: Serializer>(&self, serializer: S) -> Result<S::Ok, S::Error> {
+        let frame = self.frame;
+        let mut record = serializer.serialize_struct("FdrData", self.schema.fields.len())?;
+        for field in &self.schema.fields {
+            let offset = field.offset;
+            match field.field_type {
+                FieldType::Bool => record.serialize_field(field.name, &(frame[offset] != 0))?,
+                FieldType::I8 => record.serialize_field(field.name, &(frame[offset] as i8))?,
+                FieldType::U8 => record.serialize_field(field.name, &frame[offset])?,
+                FieldType::I16 => record
+                    .serialize_field(field.name, &i16::from_le_bytes(value_bytes(frame, offset)))?,
+                FieldType::U16 => record
+                    .serialize_field(field.name, &u16::from_le_bytes(value_bytes(frame, offset)))?,
+                FieldType::I32 => record
+                    .serialize_field(field.name, &i32::from_le_bytes(value_bytes(frame, offset)))?,
+                FieldType::U32 => record
+                    .serialize_field(field.name, &u32::from_le_bytes(value_bytes(frame, offset)))?,
+                FieldType::I64 => record
+                    .serialize_field(field.name, &i64::from_le_bytes(value_bytes(frame, offset)))?,
+                FieldType::U64 => record
+                    .serialize_field(field.name, &u64::from_le_bytes(value_bytes(frame, offset)))?,
+                FieldType::F32 => record
+                    .serialize_field(field.name, &f32::from_le_bytes(value_bytes(frame, offset)))?,
+                FieldType::F64 => record
+                    .serialize_field(field.name, &f64::from_le_bytes(value_bytes(frame, offset)))?,
+            }
+        }
+        record.end()
+    }
+}
+
+fn value_bytes<const N: usize>(frame: &[u8], offset: usize) -> [u8; N] {
+    frame[offset..offset + N].try_into().unwrap()
+}
+
+fn get_type(
+    types: &[TypeDefinition],
+    type_index: i32,
+    limit: usize,
+) -> Result<&TypeDefinition, Error> {
+    if type_index < 0 || type_index as usize >= limit {
+        return Err(invalid_schema("invalid type index"));
+    }
+    Ok(&types[type_index as usize])
+}
+
+fn invalid_schema(message: &str) -> Error {
+    Error::new(ErrorKind::InvalidData, message)
+}
+
+fn read_u8(data: &mut impl Read) -> Result<u8, Error> {
+    let mut value = [0u8; 1];
+    data.read_exact(&mut value)?;
+    Ok(value[0])
+}
+
+fn read_u32(data: &mut impl Read) -> Result<u32, Error> {
+    let mut value = [0u8; 4];
+    data.read_exact(&mut value)?;
+    Ok(u32::from_le_bytes(value))
+}
+
+fn read_string(data: &mut impl Read) -> Result<String, Error> {
+    let mut length = [0u8; 2];
+    data.read_exact(&mut length)?;
+    let mut value = vec![0u8; u16::from_le_bytes(length) as usize];
+    data.read_exact(&mut value)?;
+    String::from_utf8(value).map_err(|_| invalid_schema("invalid name"))
+}